@@ -0,0 +1,152 @@
+// Copyright (c) 2016-2018 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+// Function benchmark
+//
+// Builds, copies, moves and invokes the callbacks the engine creates most often
+// and counts the heap allocations they cause by hooking the global operator new.
+//
+// Build from the repository root:
+//   g++ -std=c++17 -O2 -Isrc benchmarks/FunctionBenchmark.cpp -o function_benchmark
+//   cl /std:c++17 /O2 /EHsc /Isrc benchmarks\FunctionBenchmark.cpp
+
+#include <kiwano/core/Function.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+static size_t allocation_count = 0;
+
+void* operator new(size_t size)
+{
+    ++allocation_count;
+    if (void* ptr = std::malloc(size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    ++allocation_count;
+    return std::malloc(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+using namespace kiwano;
+
+namespace
+{
+
+struct Target
+{
+    float value = 0;
+
+    void Update(float dt)
+    {
+        value += dt;
+    }
+
+    float GetValue() const
+    {
+        return value;
+    }
+};
+
+struct DerivedTarget : Target
+{
+};
+
+float EaseInQuad(float t)
+{
+    return t * t;
+}
+
+}  // namespace
+
+int main()
+{
+    const int iterations = 1000000;
+
+    Target        target;
+    DerivedTarget derived;
+    int           counter = 0;
+
+    size_t allocations = allocation_count;
+    auto   start       = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < iterations; ++i)
+    {
+        Function<float(float)> ease      = EaseInQuad;
+        Function<float(float)> lambda    = [](float t) { return 1 - t; };
+        Function<void(float)>  update    = Closure(&target, &Target::Update);
+        Function<float()>      get_value = Closure(&derived, &Target::GetValue);
+        Function<void()>       callback  = [&counter, &target]() {
+            ++counter;
+            target.value += 1;
+        };
+
+        Function<void()>       copy  = callback;
+        Function<void()>       moved = std::move(copy);
+        UniqueFunction<void()> task  = std::move(moved);
+
+        ease(0.5f);
+        lambda(0.5f);
+        update(0.1f);
+        get_value();
+        task();
+    }
+
+    auto   end               = std::chrono::steady_clock::now();
+    size_t small_allocations = allocation_count - allocations;
+    double ns_per_iteration  = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+
+    // Callables that don't fit into the inline storage still go to the heap once
+    struct Large
+    {
+        double values[8];
+    } large{};
+
+    allocations                  = allocation_count;
+    Function<double()> large_fn  = [large]() { return large.values[0]; };
+    Function<double()> large_cpy = large_fn;
+    size_t large_allocations     = allocation_count - allocations;
+
+    auto                  owned = std::make_unique<int>(1);
+    UniqueFunction<int()> move_only([ptr = std::move(owned)]() { return *ptr; });
+
+    std::printf("sizeof(Function<void()>): %zu bytes\n", sizeof(Function<void()>));
+    std::printf("small callables: %zu allocations in %d iterations, %.1f ns per iteration\n", small_allocations,
+                iterations, ns_per_iteration);
+    std::printf("large callable: %zu allocation(s) for one object and one copy\n", large_allocations);
+    std::printf("checks: counter=%d large=%.0f/%.0f move_only=%d\n", counter, large_fn(), large_cpy(), move_only());
+    return 0;
+}
@@ -0,0 +1,168 @@
+// Copyright (c) 2016-2018 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+
+// Headless stage benchmark
+//
+// Runs Application::Run with the headless window and the software renderer: a stage with a rectangle
+// and a sprite decoded from an embedded PNG image is updated and rendered for a number of frames (120
+// by default, or the first argument), then the program checks a few pixels of the last frame and
+// prints the average frame time. The exit code is non-zero when a pixel is wrong. A second argument
+// saves the last frame as a BMP file.
+//
+// Build it with the CMake project in this directory, which compiles the engine core without the Win32
+// and DirectX code:
+//
+//     cmake -S benchmarks -B build && cmake --build build && ./build/HeadlessStageBenchmark
+
+#include <kiwano/kiwano.h>
+#include <kiwano/render/Software/RendererImpl.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace kiwano;
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+// 8x8 RGBA image, the left half is opaque blue and the right half is 50% green
+const uint8_t kImagePng[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x08, 0x06, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xbe,
+    0x8b, 0x00, 0x00, 0x00, 0x16, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0x63, 0x60, 0x60, 0xf8, 0xff,
+    0x1f, 0x05, 0xff, 0x67, 0x68, 0x40, 0xc1, 0x23, 0x43, 0x01, 0x00, 0xca, 0x0f, 0x6f, 0xa1, 0xab,
+    0xfb, 0x81, 0x29, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+int         frame_count = 120;
+const char* output_path = nullptr;
+bool        passed      = false;
+double      frame_time  = 0;
+
+struct PixelCheck
+{
+    uint32_t    x, y;
+    uint32_t    expected;
+    const char* what;
+};
+
+// Premultiplied ARGB32 on a black background
+const PixelCheck kChecks[] = {
+    { 60, 60, 0xFFFF0000, "rectangle" },
+    { 5, 5, 0xFF000000, "background" },
+    { 208, 56, 0xFF0000FF, "opaque half of the sprite" },
+    { 224, 56, 0xFF008000, "translucent half of the sprite" },
+};
+
+class BenchStage : public Stage
+{
+public:
+    BenchStage()
+        : frames_(0)
+    {
+        RectActorPtr rect = new RectActor(Size(100, 80));
+        rect->SetFillColor(Color::Red);
+        rect->SetPosition(20, 20);
+        AddChild(rect);
+
+        TexturePtr texture = new Texture;
+        texture->Load(BinaryData(kImagePng, sizeof(kImagePng)));
+        texture->SetInterpolationMode(InterpolationMode::Nearest);
+
+        SpritePtr sprite = new Sprite(texture);
+        sprite->SetPosition(200, 40);
+        sprite->SetScale(4, 4);
+        AddChild(sprite);
+    }
+
+    void OnUpdate(Duration dt) override
+    {
+        // The first update runs before anything is rendered
+        if (frames_ == 1)
+            start_ = Clock::now();
+
+        if (frames_++ < frame_count)
+            return;
+
+        frame_time = std::chrono::duration<double, std::micro>(Clock::now() - start_).count() / (frame_count - 1);
+
+        auto& renderer = RendererImpl::GetInstance();
+        auto  target   = renderer.GetTargetBitmap();
+
+        passed = true;
+        for (const auto& check : kChecks)
+        {
+            uint32_t pixel = target->GetPixel(check.x, check.y);
+            if (pixel != check.expected)
+            {
+                std::printf("%s: pixel (%u, %u) is %08X, expected %08X\n", check.what, check.x, check.y, pixel,
+                            check.expected);
+                passed = false;
+            }
+        }
+
+        if (output_path)
+            renderer.SaveTargetToFile(output_path);
+
+        Application::GetInstance().Quit();
+    }
+
+private:
+    int               frames_;
+    Clock::time_point start_;
+};
+
+class BenchRunner : public Runner
+{
+public:
+    BenchRunner(const Settings& settings)
+        : Runner(settings)
+    {
+    }
+
+    void OnReady() override
+    {
+        Director::GetInstance().EnterStage(new BenchStage);
+    }
+};
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc > 1)
+        frame_count = std::max(2, std::atoi(argv[1]));
+    if (argc > 2)
+        output_path = argv[2];
+
+    Settings settings;
+    settings.window.width  = 320;
+    settings.window.height = 240;
+
+    Application::GetInstance().Run(new BenchRunner(settings));
+
+    std::printf("%d frames, %.0f us per frame, pixel check %s\n", frame_count, frame_time, passed ? "passed" : "failed");
+    return passed ? 0 : 1;
+}
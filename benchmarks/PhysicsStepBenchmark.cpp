@@ -0,0 +1,219 @@
+// Copyright (c) 2016-2018 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+// Physics step benchmark
+//
+// Steps the scene used to measure the parallel physics step: 8 piles of falling boxes and circles
+// (5000 by default) between walls, with a 10 link revolute chain above each pile, 5088 bodies in total.
+// The thread count is set with PhysicWorld::SetThreadCount, 1 runs the serial step of Box2D.
+// It prints the average step time, the b2Profile stages, and hashes of the final body states and
+// of the contact events, which have to be equal for every thread count greater than 1.
+//
+// Usage: PhysicsStepBenchmark [threads = 1] [bodies = 5000] [steps = 300]
+//
+// Build it as a Kiwano application with kiwano-physics, e.g. replace the main file of one of the samples
+// with this file.
+
+#include <kiwano/kiwano.h>
+#include <kiwano-physics/PhysicWorld.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace kiwano;
+using namespace kiwano::physics;
+
+namespace
+{
+
+const uint64_t hash_basis = 1469598103934665603ull;
+const uint64_t hash_prime = 1099511628211ull;
+
+uint64_t Hash(uint64_t hash, uint64_t value)
+{
+    return (hash ^ value) * hash_prime;
+}
+
+uint64_t Hash(uint64_t hash, float value)
+{
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return Hash(hash, uint64_t(bits));
+}
+
+// Counts the contact events and hashes them in the order they are raised
+class EventCounter : public b2ContactListener
+{
+public:
+    uint64_t begin = 0;
+    uint64_t end   = 0;
+    uint64_t pre   = 0;
+    uint64_t post  = 0;
+    uint64_t hash  = hash_basis;
+
+    void BeginContact(b2Contact* contact) override
+    {
+        ++begin;
+        hash = Hash(hash, uint64_t(uintptr_t(contact->GetFixtureA()->GetUserData())));
+    }
+
+    void EndContact(b2Contact* contact) override
+    {
+        ++end;
+        hash = Hash(hash, uint64_t(uintptr_t(contact->GetFixtureA()->GetUserData())));
+    }
+
+    void PreSolve(b2Contact*, const b2Manifold*) override
+    {
+        ++pre;
+    }
+
+    void PostSolve(b2Contact*, const b2ContactImpulse* impulse) override
+    {
+        ++post;
+        hash = Hash(hash, impulse->normalImpulses[0]);
+    }
+};
+
+// Fixtures are numbered in creation order, so the event hash does not depend on addresses
+void BuildScene(b2World* world, int bodies)
+{
+    const int piles = 8;
+    uintptr_t id    = 1;
+
+    for (int p = 0; p < piles; ++p)
+    {
+        float x0 = p * 40.0f;
+
+        b2BodyDef ground_def;
+        ground_def.position.Set(x0, 0);
+        b2Body* ground = world->CreateBody(&ground_def);
+
+        b2EdgeShape floor;
+        floor.Set(b2Vec2(-18, 0), b2Vec2(18, 0));
+        ground->CreateFixture(&floor, 0)->SetUserData((void*)id++);
+
+        b2PolygonShape wall;
+        wall.SetAsBox(0.5f, 60, b2Vec2(-18, 60), 0);
+        ground->CreateFixture(&wall, 0)->SetUserData((void*)id++);
+        wall.SetAsBox(0.5f, 60, b2Vec2(18, 60), 0);
+        ground->CreateFixture(&wall, 0)->SetUserData((void*)id++);
+
+        // A pendulum chain above every pile
+        b2Body* prev = ground;
+        for (int k = 0; k < 10; ++k)
+        {
+            b2BodyDef link_def;
+            link_def.type = b2_dynamicBody;
+            link_def.position.Set(x0 + 0.5f + k, 80);
+            b2Body* link = world->CreateBody(&link_def);
+
+            b2PolygonShape shape;
+            shape.SetAsBox(0.5f, 0.1f);
+            link->CreateFixture(&shape, 1)->SetUserData((void*)id++);
+
+            b2RevoluteJointDef joint_def;
+            joint_def.Initialize(prev, link, b2Vec2(x0 + k, 80));
+            world->CreateJoint(&joint_def);
+            prev = link;
+        }
+    }
+
+    b2PolygonShape box;
+    box.SetAsBox(0.45f, 0.45f);
+
+    b2CircleShape circle;
+    circle.m_radius = 0.45f;
+
+    const int per_pile = bodies / piles;
+    for (int p = 0; p < piles; ++p)
+    {
+        for (int i = 0; i < per_pile; ++i)
+        {
+            b2BodyDef body_def;
+            body_def.type = b2_dynamicBody;
+            body_def.position.Set(p * 40.0f - 16 + (i % 32) + 0.05f * (i % 3), 1 + (i / 32) * 1.05f);
+            b2Body* body = world->CreateBody(&body_def);
+
+            b2FixtureDef fixture_def;
+            fixture_def.density  = 1;
+            fixture_def.friction = 0.6f;
+            fixture_def.shape    = (i % 4 == 0) ? (b2Shape*)&circle : (b2Shape*)&box;
+            body->CreateFixture(&fixture_def)->SetUserData((void*)id++);
+        }
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    int threads = argc > 1 ? std::atoi(argv[1]) : 1;
+    int bodies  = argc > 2 ? std::atoi(argv[2]) : 5000;
+    int steps   = argc > 3 ? std::atoi(argv[3]) : 300;
+
+    PhysicWorldPtr world = MakePtr<PhysicWorld>();
+    world->SetThreadCount(uint32_t(threads > 0 ? threads : 1));
+
+    // The scene is built in Box2D units with y pointing up
+    b2World* b2world = world->GetB2World();
+    b2world->SetGravity(b2Vec2(0, -10));
+
+    EventCounter counter;
+    b2world->SetContactListener(&counter);
+
+    BuildScene(b2world, bodies);
+
+    b2Profile total = {};
+    auto      start = std::chrono::steady_clock::now();
+    for (int i = 0; i < steps; ++i)
+    {
+        b2world->Step(1.0f / 60, 8, 3);
+
+        const b2Profile& profile = world->GetProfile();
+        total.collide += profile.collide;
+        total.solve += profile.solve;
+        total.broadphase += profile.broadphase;
+        total.solveTOI += profile.solveTOI;
+    }
+    double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    uint64_t state_hash = hash_basis;
+    int      awake      = 0;
+    for (b2Body* body = b2world->GetBodyList(); body; body = body->GetNext())
+    {
+        state_hash = Hash(state_hash, body->GetPosition().x);
+        state_hash = Hash(state_hash, body->GetPosition().y);
+        state_hash = Hash(state_hash, body->GetAngle());
+        awake += body->IsAwake() ? 1 : 0;
+    }
+
+    std::printf("threads %u, bodies %d, steps %d\n", world->GetThreadCount(), b2world->GetBodyCount(), steps);
+    std::printf("step %.2f ms (collide %.2f, solve %.2f, broad-phase %.2f, toi %.2f)\n", elapsed / steps,
+                total.collide / steps, total.solve / steps, total.broadphase / steps, total.solveTOI / steps);
+    std::printf("contacts %d, awake bodies %d\n", b2world->GetContactCount(), awake);
+    std::printf("state hash %016llx\n", (unsigned long long)state_hash);
+    std::printf("events %llu begin, %llu end, %llu pre-solve, %llu post-solve, hash %016llx\n",
+                (unsigned long long)counter.begin, (unsigned long long)counter.end, (unsigned long long)counter.pre,
+                (unsigned long long)counter.post, (unsigned long long)counter.hash);
+    return 0;
+}
@@ -0,0 +1,165 @@
+// Copyright (c) 2016-2018 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+// Render snapshot benchmark
+//
+// Times the four stages of a frame for a scene with 1500 rotating rectangles: updating the actors,
+// rendering them directly, recording them into a RenderSnapshot and replaying the snapshot. From these
+// it estimates the frame time of pipelined rendering when the update and render threads run on
+// different cores. The amount of per-actor logic can be passed as the first argument.
+//
+// Build it as a Kiwano application, e.g. replace the main file of one of the samples with this file.
+
+#include <kiwano/kiwano.h>
+#include <kiwano/render/RenderSnapshot.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace kiwano;
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+int logic_iterations = 200;
+
+double Microseconds(Clock::time_point start, Clock::time_point end)
+{
+    return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+class BenchStage : public Stage
+{
+public:
+    void DoUpdate(Duration dt)
+    {
+        Update(dt);
+    }
+
+    void DoRender(RenderContext& ctx)
+    {
+        Render(ctx);
+    }
+};
+
+class Mover : public RectActor
+{
+public:
+    Mover()
+        : RectActor(Size(40, 30))
+        , phase_(0)
+    {
+    }
+
+    void OnUpdate(Duration dt) override
+    {
+        // Stands for game logic
+        float sum = 0;
+        for (int i = 0; i < logic_iterations; ++i)
+            sum += std::sin(phase_ + i * 0.01f);
+
+        phase_ += 0.05f;
+        SetRotation(GetRotation() + 1.f + sum * 1e-6f);
+    }
+
+private:
+    float phase_;
+};
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc > 1)
+        logic_iterations = std::atoi(argv[1]);
+
+    WindowConfig config;
+    config.width  = 640;
+    config.height = 480;
+
+    WindowPtr window = Window::Create(config);
+    Renderer& renderer = Renderer::GetInstance();
+    renderer.MakeContextForWindow(window);
+
+    RenderContext&     ctx   = renderer.GetContext();
+    RefPtr<BenchStage> stage = new BenchStage;
+    for (int i = 0; i < 1500; ++i)
+    {
+        RefPtr<Mover> actor = new Mover;
+        actor->SetFillColor(Color(1, 0, 0, .3f));
+        actor->SetPosition(float(i % 600), float(i % 400));
+        actor->SetRotation(float(i));
+        stage->AddChild(actor);
+    }
+
+    RenderSnapshotPtr snapshot = MakePtr<RenderSnapshot>();
+
+    const int warmup = 3, frames = 30;
+    double    update = 0, render = 0, record = 0, replay = 0;
+    for (int frame = 0; frame < warmup + frames; ++frame)
+    {
+        auto t0 = Clock::now();
+        stage->DoUpdate(Duration(16));
+
+        auto t1 = Clock::now();
+        ctx.BeginDraw();
+        renderer.Clear();
+        stage->DoRender(ctx);
+        ctx.EndDraw();
+
+        auto t2 = Clock::now();
+        snapshot->Reset(ctx);
+        stage->DoRender(*snapshot);
+
+        auto t3 = Clock::now();
+        ctx.BeginDraw();
+        renderer.Clear();
+        snapshot->Replay(ctx);
+        ctx.EndDraw();
+
+        auto t4 = Clock::now();
+        if (frame >= warmup)
+        {
+            update += Microseconds(t0, t1);
+            render += Microseconds(t1, t2);
+            record += Microseconds(t2, t3);
+            replay += Microseconds(t3, t4);
+        }
+    }
+
+    update /= frames;
+    render /= frames;
+    record /= frames;
+    replay /= frames;
+
+    // The update thread updates and records the next frame while the render thread replays the previous one
+    const double serial    = update + render;
+    const double pipelined = std::max(update + record, replay);
+
+    std::printf("logic iterations %d\n", logic_iterations);
+    std::printf("update %.0f us, render %.0f us, record %.0f us, replay %.0f us\n", update, render, record, replay);
+    std::printf("serial frame %.0f us, pipelined frame %.0f us (%.2fx)\n", serial, pipelined, serial / pipelined);
+    return 0;
+}
@@ -0,0 +1,148 @@
+// Copyright (c) 2016-2018 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+// Sprite batch benchmark
+//
+// Draws 5000 small sprites from 64 textures, loose and packed into a TextureAtlas, with sprite
+// batching off and on, and prints the draw calls and the average frame time of each case. The last
+// case rotates the sprites, which are not batched and fall back to separate draws.
+// The number of sprites can be passed as the first argument.
+//
+// Build it as a Kiwano application, e.g. replace the main file of one of the samples with this file.
+
+#include <kiwano/kiwano.h>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace kiwano;
+
+namespace
+{
+
+class BenchStage : public Stage
+{
+public:
+    void DoUpdate(Duration dt)
+    {
+        Update(dt);
+    }
+
+    void DoRender(RenderContext& ctx)
+    {
+        Render(ctx);
+    }
+};
+
+TexturePtr CreateTexture(float size, const Color& color)
+{
+    TexturePtr       texture = MakePtr<Texture>();
+    RenderContextPtr ctx     = RenderContext::Create(*texture, Size(size, size));
+
+    ctx->BeginDraw();
+    ctx->Clear(color);
+    ctx->EndDraw();
+    return texture;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    const int count = argc > 1 ? std::atoi(argv[1]) : 5000;
+
+    WindowConfig config;
+    config.width  = 800;
+    config.height = 600;
+
+    WindowPtr window = Window::Create(config);
+    Renderer& renderer = Renderer::GetInstance();
+    renderer.MakeContextForWindow(window);
+
+    RenderContext& ctx = renderer.GetContext();
+    ctx.SetCollectingStatus(true);
+
+    Vector<TexturePtr> textures;
+    for (int i = 0; i < 64; ++i)
+    {
+        textures.push_back(CreateTexture(float(16 + i % 33), Color(i / 64.f, 1 - i / 64.f, .5f)));
+    }
+
+    RefPtr<BenchStage> stage = new BenchStage;
+    Vector<SpritePtr>  sprites;
+
+    std::srand(7);
+    for (int i = 0; i < count; ++i)
+    {
+        SpritePtr sprite = new Sprite(textures[i % textures.size()]);
+        sprite->SetPosition(float(std::rand() % 800), float(std::rand() % 600));
+        sprite->SetOpacity(.5f + (std::rand() % 50) / 100.f);
+        stage->AddChild(sprite);
+        sprites.push_back(sprite);
+    }
+    stage->DoUpdate(0);
+
+    auto measure = [&](const char* name, bool batching) {
+        const int frames = 20;
+
+        ctx.SetSpriteBatchingEnabled(batching);
+
+        double   total = 0;
+        uint32_t calls = 0;
+        for (int frame = 0; frame <= frames; ++frame)
+        {
+            Time start = Time::Now();
+            ctx.BeginDraw();
+            renderer.Clear();
+            stage->DoRender(ctx);
+            ctx.EndDraw();
+
+            // The first frame is a warm-up
+            if (frame > 0)
+                total += double((Time::Now() - start).GetMilliseconds());
+
+            calls = ctx.GetStatus().draw_calls;
+        }
+        std::printf("%-28s draw calls %6u, avg frame %.2f ms\n", name, calls, total / frames);
+    };
+
+    measure("loose, unbatched", false);
+    measure("loose, batched", true);
+
+    TextureAtlasPtr atlas = MakePtr<TextureAtlas>(512);
+    for (auto& sprite : sprites)
+    {
+        sprite->SetFrame(atlas->Add(sprite->GetFrame()));
+    }
+    std::printf("atlas: %zu pages, occupancy %.1f%%\n", atlas->GetPages().size(), atlas->GetOccupancy() * 100);
+
+    measure("atlas, unbatched", false);
+    measure("atlas, batched", true);
+
+    for (auto& sprite : sprites)
+    {
+        sprite->SetRotation(float(std::rand() % 360));
+    }
+    stage->DoUpdate(0);
+
+    measure("atlas, rotated, unbatched", false);
+    measure("atlas, rotated, batched", true);
+    return 0;
+}
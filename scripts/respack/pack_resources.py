@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+# Copyright (c) 2016-2020 Kiwano - Nomango
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+"""
+Packs a resource directory into a Kiwano resource pack (see ResourcePack.h).
+
+Entries are named by their path relative to the input directory, so a manifest
+in the directory can be loaded with ResourceCache::LoadFromPack and refers to
+its files the same way as on disk.
+
+usage: pack_resources.py [-h] [-c] [-a ALIGNMENT] [-x PATTERN] input output
+"""
+
+import argparse
+import fnmatch
+import os
+import struct
+import sys
+
+MAGIC = 0x4B41504B  # "KPAK"
+VERSION = 1
+FLAG_COMPRESSED = 1
+
+HEADER_FORMAT = '<IIIIQQ'
+INDEX_FORMAT = '<QQQII'
+
+# Formats that are compressed already gain nothing from LZ4
+COMPRESSED_EXTENSIONS = {'.png', '.jpg', '.jpeg', '.gif', '.webp', '.ogg', '.mp3', '.zip', '.kpak'}
+
+LZ4_MIN_MATCH = 4
+LZ4_LAST_LITERALS = 5
+LZ4_MF_LIMIT = 12
+LZ4_MAX_OFFSET = 65535
+
+
+def _write_length(out, length):
+    while length >= 255:
+        out.append(255)
+        length -= 255
+    out.append(length)
+
+
+def _write_sequence(out, src, anchor, literal_length, offset, match_length):
+    match_code = match_length - LZ4_MIN_MATCH if match_length else 0
+    out.append((min(literal_length, 15) << 4) | min(match_code, 15))
+    if literal_length >= 15:
+        _write_length(out, literal_length - 15)
+    out += src[anchor:anchor + literal_length]
+    if match_length:
+        out.append(offset & 0xFF)
+        out.append(offset >> 8)
+        if match_code >= 15:
+            _write_length(out, match_code - 15)
+
+
+def lz4_compress(src):
+    """Compresses data in the LZ4 block format, the same way as ResourcePackWriter."""
+    out = bytearray()
+    size = len(src)
+    anchor = 0
+    if size > LZ4_MF_LIMIT:
+        table = {}
+        match_limit = size - LZ4_LAST_LITERALS
+        search_limit = size - LZ4_MF_LIMIT
+        pos = 1
+        while pos < search_limit:
+            sequence = src[pos:pos + 4]
+            candidate = table.get(sequence, -1)
+            table[sequence] = pos
+            if candidate < 0 or pos - candidate > LZ4_MAX_OFFSET:
+                pos += 1
+                continue
+            length = LZ4_MIN_MATCH
+            while pos + length < match_limit and src[candidate + length] == src[pos + length]:
+                length += 1
+            _write_sequence(out, src, anchor, pos - anchor, pos - candidate, length)
+            pos += length
+            anchor = pos
+    _write_sequence(out, src, anchor, size - anchor, 0, 0)
+    return bytes(out)
+
+
+def collect_files(input_dir, excludes):
+    files = []
+    for root, _, names in os.walk(input_dir):
+        for name in names:
+            path = os.path.join(root, name)
+            entry = os.path.relpath(path, input_dir).replace(os.sep, '/')
+            if any(fnmatch.fnmatch(entry, pattern) for pattern in excludes):
+                continue
+            files.append((entry, path))
+    return sorted(files)
+
+
+def write_pack(files, output, compress, alignment):
+    entries = []
+    with open(output, 'wb') as f:
+        # The header is written again after the index offset is known
+        f.write(struct.pack(HEADER_FORMAT, MAGIC, VERSION, len(files), alignment, 0, 0))
+        offset = struct.calcsize(HEADER_FORMAT)
+
+        for name, path in files:
+            with open(path, 'rb') as src:
+                data = src.read()
+
+            flags = 0
+            stored = data
+            if compress and data and os.path.splitext(name)[1].lower() not in COMPRESSED_EXTENSIONS:
+                compressed = lz4_compress(data)
+                if len(compressed) < len(data):
+                    stored = compressed
+                    flags |= FLAG_COMPRESSED
+
+            aligned = (offset + alignment - 1) & ~(alignment - 1)
+            f.write(b'\0' * (aligned - offset))
+            f.write(stored)
+            entries.append((name, aligned, len(stored), len(data), flags))
+            offset = aligned + len(stored)
+
+        index_offset = offset
+        for name, entry_offset, stored_size, original_size, flags in entries:
+            encoded = name.encode('utf-8')
+            f.write(struct.pack(INDEX_FORMAT, entry_offset, stored_size, original_size, flags, len(encoded)))
+            f.write(encoded)
+            offset += struct.calcsize(INDEX_FORMAT) + len(encoded)
+
+        f.seek(0)
+        f.write(struct.pack(HEADER_FORMAT, MAGIC, VERSION, len(entries), alignment, index_offset,
+                            offset - index_offset))
+    return entries
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Pack a resource directory into a Kiwano resource pack.')
+    parser.add_argument('input', help='resource directory')
+    parser.add_argument('output', help='resource pack file')
+    parser.add_argument('-c', '--compress', action='store_true',
+                        help='compress entries with LZ4, except formats that are compressed already')
+    parser.add_argument('-a', '--alignment', type=int, default=16, help='data alignment in bytes (default: 16)')
+    parser.add_argument('-x', '--exclude', action='append', default=[], metavar='PATTERN',
+                        help='exclude entries matching the pattern, can be repeated')
+    args = parser.parse_args()
+
+    if args.alignment <= 0 or args.alignment & (args.alignment - 1):
+        parser.error('alignment must be a power of 2')
+    if not os.path.isdir(args.input):
+        parser.error('input directory not found: ' + args.input)
+
+    files = collect_files(args.input, args.exclude)
+    entries = write_pack(files, args.output, args.compress, args.alignment)
+
+    original = sum(e[3] for e in entries)
+    stored = sum(e[2] for e in entries)
+    print('%d entries, %d bytes -> %d bytes stored' % (len(entries), original, stored))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -34,6 +34,7 @@ For discussion please visit http://box2d.org/forum
 #include "Common/b2Settings.h"
 #include "Common/b2Draw.h"
 #include "Common/b2Timer.h"
+#include "Common/b2TaskExecutor.h"
 
 #include "Collision/Shapes/b2CircleShape.h"
 #include "Collision/Shapes/b2EdgeShape.h"
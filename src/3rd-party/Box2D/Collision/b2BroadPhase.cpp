@@ -17,6 +17,7 @@
 */
 
 #include "Box2D/Collision/b2BroadPhase.h"
+#include "Box2D/Common/b2TaskExecutor.h"
 
 b2BroadPhase::b2BroadPhase()
 {
@@ -29,10 +30,19 @@ b2BroadPhase::b2BroadPhase()
 	m_moveCapacity = 16;
 	m_moveCount = 0;
 	m_moveBuffer = (int32*)b2Alloc(m_moveCapacity * sizeof(int32));
+
+	m_threadPairs = nullptr;
+	m_threadPairCount = 0;
 }
 
 b2BroadPhase::~b2BroadPhase()
 {
+	for (int32 i = 0; i < m_threadPairCount; ++i)
+	{
+		b2Free(m_threadPairs[i].pairs);
+	}
+	b2Free(m_threadPairs);
+
 	b2Free(m_moveBuffer);
 	b2Free(m_pairBuffer);
 }
@@ -117,3 +127,114 @@ bool b2BroadPhase::QueryCallback(int32 proxyId)
 
 	return true;
 }
+
+// Gathers the pairs of one moved proxy into a per thread buffer.
+struct b2PairQueryCallback
+{
+	bool QueryCallback(int32 proxyId)
+	{
+		// A proxy cannot form a pair with itself.
+		if (proxyId == queryProxyId)
+		{
+			return true;
+		}
+
+		// Grow the pair buffer as needed.
+		if (buffer->count == buffer->capacity)
+		{
+			b2Pair* oldBuffer = buffer->pairs;
+			buffer->capacity *= 2;
+			buffer->pairs = (b2Pair*)b2Alloc(buffer->capacity * sizeof(b2Pair));
+			memcpy(buffer->pairs, oldBuffer, buffer->count * sizeof(b2Pair));
+			b2Free(oldBuffer);
+		}
+
+		buffer->pairs[buffer->count].proxyIdA = b2Min(proxyId, queryProxyId);
+		buffer->pairs[buffer->count].proxyIdB = b2Max(proxyId, queryProxyId);
+		++buffer->count;
+
+		return true;
+	}
+
+	b2PairBuffer* buffer;
+	int32 queryProxyId;
+};
+
+struct b2PairQueryTask : public b2Task
+{
+	void Execute(int32 begin, int32 end, int32 threadIndex) override
+	{
+		b2PairQueryCallback callback;
+		callback.buffer = threadPairs + threadIndex;
+
+		for (int32 i = begin; i < end; ++i)
+		{
+			callback.queryProxyId = moveBuffer[i];
+			if (callback.queryProxyId == b2BroadPhase::e_nullProxy)
+			{
+				continue;
+			}
+
+			// The tree is only read here, so the queries can run side by side.
+			tree->Query(&callback, tree->GetFatAABB(callback.queryProxyId));
+		}
+	}
+
+	const b2DynamicTree* tree;
+	const int32* moveBuffer;
+	b2PairBuffer* threadPairs;
+};
+
+void b2BroadPhase::QueryPairs(b2TaskExecutor* executor)
+{
+	int32 threadCount = executor->GetThreadCount();
+	if (m_threadPairCount < threadCount)
+	{
+		b2PairBuffer* oldBuffers = m_threadPairs;
+		m_threadPairs = (b2PairBuffer*)b2Alloc(threadCount * sizeof(b2PairBuffer));
+		memcpy(m_threadPairs, oldBuffers, m_threadPairCount * sizeof(b2PairBuffer));
+		b2Free(oldBuffers);
+
+		for (int32 i = m_threadPairCount; i < threadCount; ++i)
+		{
+			m_threadPairs[i].capacity = 16;
+			m_threadPairs[i].pairs = (b2Pair*)b2Alloc(m_threadPairs[i].capacity * sizeof(b2Pair));
+		}
+		m_threadPairCount = threadCount;
+	}
+
+	for (int32 i = 0; i < m_threadPairCount; ++i)
+	{
+		m_threadPairs[i].count = 0;
+	}
+
+	b2PairQueryTask task;
+	task.tree = &m_tree;
+	task.moveBuffer = m_moveBuffer;
+	task.threadPairs = m_threadPairs;
+	executor->ParallelFor(m_moveCount, 64, &task);
+
+	// Merge the thread buffers. The order depends on the scheduling, but the
+	// pairs are sorted afterwards so the result does not.
+	int32 pairCount = 0;
+	for (int32 i = 0; i < m_threadPairCount; ++i)
+	{
+		pairCount += m_threadPairs[i].count;
+	}
+
+	if (pairCount > m_pairCapacity)
+	{
+		b2Free(m_pairBuffer);
+		while (m_pairCapacity < pairCount)
+		{
+			m_pairCapacity *= 2;
+		}
+		m_pairBuffer = (b2Pair*)b2Alloc(m_pairCapacity * sizeof(b2Pair));
+	}
+
+	for (int32 i = 0; i < m_threadPairCount; ++i)
+	{
+		memcpy(m_pairBuffer + m_pairCount, m_threadPairs[i].pairs, m_threadPairs[i].count * sizeof(b2Pair));
+		m_pairCount += m_threadPairs[i].count;
+	}
+}
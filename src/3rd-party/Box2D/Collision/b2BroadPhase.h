@@ -24,12 +24,22 @@
 #include "b2DynamicTree.h"
 #include <algorithm>
 
+class b2TaskExecutor;
+
 struct b2Pair
 {
 	int32 proxyIdA;
 	int32 proxyIdB;
 };
 
+/// Pairs gathered by one thread during a parallel pair update.
+struct b2PairBuffer
+{
+	b2Pair* pairs;
+	int32 count;
+	int32 capacity;
+};
+
 /// The broad-phase is used for computing pairs and performing volume queries and ray casts.
 /// This broad-phase does not persist pairs. Instead, this reports potentially new pairs.
 /// It is up to the client to consume the new pairs and to track subsequent overlap.
@@ -72,8 +82,10 @@ public:
 	int32 GetProxyCount() const;
 
 	/// Update the pairs. This results in pair callbacks. This can only add pairs.
+	/// If an executor is given the tree queries run in parallel, the callbacks are
+	/// still made on the calling thread in the same order.
 	template <typename T>
-	void UpdatePairs(T* callback);
+	void UpdatePairs(T* callback, b2TaskExecutor* executor = nullptr);
 
 	/// Query an AABB for overlapping proxies. The callback class
 	/// is called for each proxy that overlaps the supplied AABB.
@@ -113,6 +125,8 @@ private:
 
 	bool QueryCallback(int32 proxyId);
 
+	void QueryPairs(b2TaskExecutor* executor);
+
 	b2DynamicTree m_tree;
 
 	int32 m_proxyCount;
@@ -125,6 +139,9 @@ private:
 	int32 m_pairCapacity;
 	int32 m_pairCount;
 
+	b2PairBuffer* m_threadPairs;
+	int32 m_threadPairCount;
+
 	int32 m_queryProxyId;
 };
 
@@ -182,26 +199,33 @@ inline float32 b2BroadPhase::GetTreeQuality() const
 }
 
 template <typename T>
-void b2BroadPhase::UpdatePairs(T* callback)
+void b2BroadPhase::UpdatePairs(T* callback, b2TaskExecutor* executor)
 {
 	// Reset pair buffer
 	m_pairCount = 0;
 
 	// Perform tree queries for all moving proxies.
-	for (int32 i = 0; i < m_moveCount; ++i)
+	if (executor)
 	{
-		m_queryProxyId = m_moveBuffer[i];
-		if (m_queryProxyId == e_nullProxy)
+		QueryPairs(executor);
+	}
+	else
+	{
+		for (int32 i = 0; i < m_moveCount; ++i)
 		{
-			continue;
-		}
+			m_queryProxyId = m_moveBuffer[i];
+			if (m_queryProxyId == e_nullProxy)
+			{
+				continue;
+			}
 
-		// We have to query the tree with the fat AABB so that
-		// we don't fail to create a pair that may touch later.
-		const b2AABB& fatAABB = m_tree.GetFatAABB(m_queryProxyId);
+			// We have to query the tree with the fat AABB so that
+			// we don't fail to create a pair that may touch later.
+			const b2AABB& fatAABB = m_tree.GetFatAABB(m_queryProxyId);
 
-		// Query tree, create pairs and add them pair buffer.
-		m_tree.Query(this, fatAABB);
+			// Query tree, create pairs and add them pair buffer.
+			m_tree.Query(this, fatAABB);
+		}
 	}
 
 	// Reset move buffer
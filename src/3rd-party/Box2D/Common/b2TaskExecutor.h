@@ -0,0 +1,53 @@
+/*
+* Copyright (c) 2006-2011 Erin Catto http://www.box2d.org
+*
+* This software is provided 'as-is', without any express or implied
+* warranty.  In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it
+* freely, subject to the following restrictions:
+* 1. The origin of this software must not be misrepresented; you must not
+* claim that you wrote the original software. If you use this software
+* in a product, an acknowledgment in the product documentation would be
+* appreciated but is not required.
+* 2. Altered source versions must be plainly marked as such, and must not be
+* misrepresented as being the original software.
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef B2_TASK_EXECUTOR_H
+#define B2_TASK_EXECUTOR_H
+
+#include "b2Settings.h"
+
+/// A unit of work that can be split into ranges and run on several threads.
+class b2Task
+{
+public:
+	virtual ~b2Task() {}
+
+	/// Process the items [begin, end). The thread index is in the range
+	/// [0, b2TaskExecutor::GetThreadCount()) and is never used by two
+	/// ranges at the same time, so it can be used to pick per thread storage.
+	virtual void Execute(int32 begin, int32 end, int32 threadIndex) = 0;
+};
+
+/// Implement this to let the world run parts of the time step in parallel.
+/// The world gives the same results for any thread count. The executor is
+/// owned by you and must remain in scope while it is registered.
+/// @see b2World::SetTaskExecutor
+class b2TaskExecutor
+{
+public:
+	virtual ~b2TaskExecutor() {}
+
+	/// The number of threads that may execute tasks, including the calling thread.
+	virtual int32 GetThreadCount() const = 0;
+
+	/// Split [0, count) into ranges of at least minRange items and execute the
+	/// task on them. This must not return before every range is finished.
+	virtual void ParallelFor(int32 count, int32 minRange, b2Task* task) = 0;
+};
+
+#endif
@@ -150,6 +150,7 @@ protected:
 	friend class b2ContactSolver;
 	friend class b2Body;
 	friend class b2Fixture;
+	friend struct b2ContactUpdateTask;
 
 	// Flags stored in m_flags
 	enum
@@ -189,6 +190,12 @@ protected:
 
 	void Update(b2ContactListener* listener);
 
+	// Update is split in two for the parallel step. UpdateManifold only writes
+	// to this contact and can run on any thread, ReportUpdate wakes the bodies
+	// and calls the listener.
+	bool UpdateManifold(b2Manifold* oldManifold);
+	void ReportUpdate(const b2Manifold& oldManifold, bool touching, b2ContactListener* listener);
+
 	static b2ContactRegister s_registers[b2Shape::e_typeCount][b2Shape::e_typeCount];
 	static bool s_initialized;
 
@@ -19,6 +19,7 @@
 #include "b2DistanceJoint.h"
 #include "../b2Body.h"
 #include "../b2TimeStep.h"
+#include "../b2Island.h"
 
 // 1-D constrained system
 // m (v2 - v1) = lambda
@@ -61,8 +62,8 @@ b2DistanceJoint::b2DistanceJoint(const b2DistanceJointDef* def)
 
 void b2DistanceJoint::InitVelocityConstraints(const b2SolverData& data)
 {
-	m_indexA = m_bodyA->m_islandIndex;
-	m_indexB = m_bodyB->m_islandIndex;
+	m_indexA = data.island->GetIndex(m_bodyA);
+	m_indexB = data.island->GetIndex(m_bodyB);
 	m_localCenterA = m_bodyA->m_sweep.localCenter;
 	m_localCenterB = m_bodyB->m_sweep.localCenter;
 	m_invMassA = m_bodyA->m_invMass;
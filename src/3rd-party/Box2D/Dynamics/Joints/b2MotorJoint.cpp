@@ -19,6 +19,7 @@
 #include "b2MotorJoint.h"
 #include "../b2Body.h"
 #include "../b2TimeStep.h"
+#include "../b2Island.h"
 
 // Point-to-point constraint
 // Cdot = v2 - v1
@@ -63,8 +64,8 @@ b2MotorJoint::b2MotorJoint(const b2MotorJointDef* def)
 
 void b2MotorJoint::InitVelocityConstraints(const b2SolverData& data)
 {
-	m_indexA = m_bodyA->m_islandIndex;
-	m_indexB = m_bodyB->m_islandIndex;
+	m_indexA = data.island->GetIndex(m_bodyA);
+	m_indexB = data.island->GetIndex(m_bodyB);
 	m_localCenterA = m_bodyA->m_sweep.localCenter;
 	m_localCenterB = m_bodyB->m_sweep.localCenter;
 	m_invMassA = m_bodyA->m_invMass;
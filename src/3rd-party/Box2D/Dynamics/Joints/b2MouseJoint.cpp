@@ -19,6 +19,7 @@
 #include "b2MouseJoint.h"
 #include "../b2Body.h"
 #include "../b2TimeStep.h"
+#include "../b2Island.h"
 
 // p = attached point, m = mouse point
 // C = p - m
@@ -95,7 +96,7 @@ float32 b2MouseJoint::GetDampingRatio() const
 
 void b2MouseJoint::InitVelocityConstraints(const b2SolverData& data)
 {
-	m_indexB = m_bodyB->m_islandIndex;
+	m_indexB = data.island->GetIndex(m_bodyB);
 	m_localCenterB = m_bodyB->m_sweep.localCenter;
 	m_invMassB = m_bodyB->m_invMass;
 	m_invIB = m_bodyB->m_invI;
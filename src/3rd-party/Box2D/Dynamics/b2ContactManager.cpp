@@ -21,6 +21,7 @@
 #include "Box2D/Dynamics/b2Fixture.h"
 #include "Box2D/Dynamics/b2WorldCallbacks.h"
 #include "Box2D/Dynamics/Contacts/b2Contact.h"
+#include "Box2D/Common/b2TaskExecutor.h"
 
 b2ContactFilter b2_defaultFilter;
 b2ContactListener b2_defaultListener;
@@ -32,6 +33,14 @@ b2ContactManager::b2ContactManager()
 	m_contactFilter = &b2_defaultFilter;
 	m_contactListener = &b2_defaultListener;
 	m_allocator = nullptr;
+	m_taskExecutor = nullptr;
+	m_updateBuffer = nullptr;
+	m_updateCapacity = 0;
+}
+
+b2ContactManager::~b2ContactManager()
+{
+	b2Free(m_updateBuffer);
 }
 
 void b2ContactManager::Destroy(b2Contact* c)
@@ -41,9 +50,13 @@ void b2ContactManager::Destroy(b2Contact* c)
 	b2Body* bodyA = fixtureA->GetBody();
 	b2Body* bodyB = fixtureB->GetBody();
 
-	if (m_contactListener && c->IsTouching())
+	if (m_contactListener)
 	{
-		m_contactListener->EndContact(c);
+		if (c->IsTouching())
+		{
+			m_contactListener->EndContact(c);
+		}
+		m_contactListener->DestroyContact(c);
 	}
 
 	// Remove from the world.
@@ -104,6 +117,12 @@ void b2ContactManager::Destroy(b2Contact* c)
 // contact list.
 void b2ContactManager::Collide()
 {
+	if (m_taskExecutor)
+	{
+		CollideParallel();
+		return;
+	}
+
 	// Update awake contacts.
 	b2Contact* c = m_contactList;
 	while (c)
@@ -169,9 +188,121 @@ void b2ContactManager::Collide()
 	}
 }
 
+// A contact visited by CollideParallel, in contact list order.
+struct b2ContactUpdate
+{
+	b2Contact* contact;
+	b2Manifold oldManifold;
+	bool touching;
+	bool destroy;
+};
+
+struct b2ContactUpdateTask : public b2Task
+{
+	void Execute(int32 begin, int32 end, int32 threadIndex) override
+	{
+		B2_NOT_USED(threadIndex);
+
+		for (int32 i = begin; i < end; ++i)
+		{
+			b2ContactUpdate* update = updates + i;
+			if (update->destroy == false)
+			{
+				update->touching = update->contact->UpdateManifold(&update->oldManifold);
+			}
+		}
+	}
+
+	b2ContactUpdate* updates;
+};
+
+// Same as Collide, in three passes. The filtering and overlap tests run first and
+// decide which contacts persist, the manifolds are then evaluated in parallel and
+// finally the contacts are destroyed or reported in the original list order. Unlike
+// Collide, a body woken by a contact in this step does not activate the contacts
+// after it until the next step.
+void b2ContactManager::CollideParallel()
+{
+	if (m_contactCount > m_updateCapacity)
+	{
+		b2Free(m_updateBuffer);
+		m_updateCapacity = b2Max(m_contactCount, 2 * m_updateCapacity);
+		m_updateBuffer = (b2ContactUpdate*)b2Alloc(m_updateCapacity * sizeof(b2ContactUpdate));
+	}
+
+	int32 updateCount = 0;
+	for (b2Contact* c = m_contactList; c; c = c->GetNext())
+	{
+		b2Fixture* fixtureA = c->GetFixtureA();
+		b2Fixture* fixtureB = c->GetFixtureB();
+		int32 indexA = c->GetChildIndexA();
+		int32 indexB = c->GetChildIndexB();
+		b2Body* bodyA = fixtureA->GetBody();
+		b2Body* bodyB = fixtureB->GetBody();
+
+		b2ContactUpdate* update = m_updateBuffer + updateCount;
+		update->contact = c;
+		update->destroy = true;
+
+		// Is this contact flagged for filtering?
+		if (c->m_flags & b2Contact::e_filterFlag)
+		{
+			// Should these bodies collide?
+			if (bodyB->ShouldCollide(bodyA) == false)
+			{
+				++updateCount;
+				continue;
+			}
+
+			// Check user filtering.
+			if (m_contactFilter && m_contactFilter->ShouldCollide(fixtureA, fixtureB) == false)
+			{
+				++updateCount;
+				continue;
+			}
+
+			// Clear the filtering flag.
+			c->m_flags &= ~b2Contact::e_filterFlag;
+		}
+
+		bool activeA = bodyA->IsAwake() && bodyA->m_type != b2_staticBody;
+		bool activeB = bodyB->IsAwake() && bodyB->m_type != b2_staticBody;
+
+		// At least one body must be awake and it must be dynamic or kinematic.
+		if (activeA == false && activeB == false)
+		{
+			continue;
+		}
+
+		int32 proxyIdA = fixtureA->m_proxies[indexA].proxyId;
+		int32 proxyIdB = fixtureB->m_proxies[indexB].proxyId;
+
+		// Contacts that cease to overlap in the broad-phase are destroyed.
+		update->destroy = m_broadPhase.TestOverlap(proxyIdA, proxyIdB) == false;
+		++updateCount;
+	}
+
+	b2ContactUpdateTask task;
+	task.updates = m_updateBuffer;
+	m_taskExecutor->ParallelFor(updateCount, 32, &task);
+
+	for (int32 i = 0; i < updateCount; ++i)
+	{
+		b2ContactUpdate* update = m_updateBuffer + i;
+		if (update->destroy)
+		{
+			Destroy(update->contact);
+		}
+		else
+		{
+			update->contact->ReportUpdate(update->oldManifold, update->touching, m_contactListener);
+		}
+	}
+}
+
 void b2ContactManager::FindNewContacts()
 {
-	m_broadPhase.UpdatePairs(this);
+	m_broadPhase.UpdatePairs(this, m_taskExecutor);
 }
 
 void b2ContactManager::AddPair(void* proxyUserDataA, void* proxyUserDataB)
@@ -25,12 +25,15 @@ class b2Contact;
 class b2ContactFilter;
 class b2ContactListener;
 class b2BlockAllocator;
+class b2TaskExecutor;
+struct b2ContactUpdate;
 
 // Delegate of b2World.
 class b2ContactManager
 {
 public:
 	b2ContactManager();
+	~b2ContactManager();
 
 	// Broad-phase callback.
 	void AddPair(void* proxyUserDataA, void* proxyUserDataB);
@@ -40,6 +43,9 @@ public:
 	void Destroy(b2Contact* c);
 
 	void Collide();
+
+	// Collide with the narrow phase spread over the executor threads.
+	void CollideParallel();
             
 	b2BroadPhase m_broadPhase;
 	b2Contact* m_contactList;
@@ -47,6 +53,10 @@ public:
 	b2ContactFilter* m_contactFilter;
 	b2ContactListener* m_contactListener;
 	b2BlockAllocator* m_allocator;
+	b2TaskExecutor* m_taskExecutor;
+
+	b2ContactUpdate* m_updateBuffer;
+	int32 m_updateCapacity;
 };
 
 #endif
@@ -26,6 +26,13 @@
 #include "Box2D/Dynamics/Joints/b2Joint.h"
 #include "Box2D/Common/b2StackAllocator.h"
 #include "Box2D/Common/b2Timer.h"
+#include <algorithm>
+
+// Used to sort the shared static bodies for lookup.
+static bool b2IslandStaticLessThan(const b2IslandStatic& static1, const b2IslandStatic& static2)
+{
+	return static1.body < static2.body;
+}
 
 /*
 Position Correction Notes
@@ -150,7 +157,8 @@ b2Island::b2Island(
 	int32 contactCapacity,
 	int32 jointCapacity,
 	b2StackAllocator* allocator,
-	b2ContactListener* listener)
+	b2ContactListener* listener,
+	bool shareStatics)
 {
 	m_bodyCapacity = bodyCapacity;
 	m_contactCapacity = contactCapacity;
@@ -158,6 +166,7 @@ b2Island::b2Island(
 	m_bodyCount = 0;
 	m_contactCount = 0;
 	m_jointCount = 0;
+	m_staticCount = 0;
 
 	m_allocator = allocator;
 	m_listener = listener;
@@ -168,11 +177,21 @@ b2Island::b2Island(
 
 	m_velocities = (b2Velocity*)m_allocator->Allocate(m_bodyCapacity * sizeof(b2Velocity));
 	m_positions = (b2Position*)m_allocator->Allocate(m_bodyCapacity * sizeof(b2Position));
+
+	m_statics = nullptr;
+	if (shareStatics)
+	{
+		m_statics = (b2IslandStatic*)m_allocator->Allocate(m_bodyCapacity * sizeof(b2IslandStatic));
+	}
 }
 
 b2Island::~b2Island()
 {
 	// Warning: the order should reverse the constructor order.
+	if (m_statics)
+	{
+		m_allocator->Free(m_statics);
+	}
 	m_allocator->Free(m_positions);
 	m_allocator->Free(m_velocities);
 	m_allocator->Free(m_joints);
@@ -186,6 +205,13 @@ void b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& g
 
 	float32 h = step.dt;
 
+	// Shared static bodies are only read, other islands may use them at the same time.
+	bool shared = m_statics != nullptr;
+	if (m_staticCount > 1)
+	{
+		std::sort(m_statics, m_statics + m_staticCount, b2IslandStaticLessThan);
+	}
+
 	// Integrate velocities and apply damping. Initialize the body state.
 	for (int32 i = 0; i < m_bodyCount; ++i)
 	{
@@ -197,8 +223,11 @@ void b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& g
 		float32 w = b->m_angularVelocity;
 
 		// Store positions for continuous collision.
-		b->m_sweep.c0 = b->m_sweep.c;
-		b->m_sweep.a0 = b->m_sweep.a;
+		if (shared == false || b->m_type != b2_staticBody)
+		{
+			b->m_sweep.c0 = b->m_sweep.c;
+			b->m_sweep.a0 = b->m_sweep.a;
+		}
 
 		if (b->m_type == b2_dynamicBody)
 		{
@@ -230,10 +259,12 @@ void b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& g
 	solverData.step = step;
 	solverData.positions = m_positions;
 	solverData.velocities = m_velocities;
+	solverData.island = this;
 
 	// Initialize velocity constraints.
 	b2ContactSolverDef contactSolverDef;
 	contactSolverDef.step = step;
+	contactSolverDef.island = this;
 	contactSolverDef.contacts = m_contacts;
 	contactSolverDef.count = m_contactCount;
 	contactSolverDef.positions = m_positions;
@@ -330,6 +361,11 @@ void b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& g
 	for (int32 i = 0; i < m_bodyCount; ++i)
 	{
 		b2Body* body = m_bodies[i];
+		if (shared && body->m_type == b2_staticBody)
+		{
+			continue;
+		}
+
 		body->m_sweep.c = m_positions[i].c;
 		body->m_sweep.a = m_positions[i].a;
 		body->m_linearVelocity = m_velocities[i].v;
@@ -375,6 +411,11 @@ void b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& g
 			for (int32 i = 0; i < m_bodyCount; ++i)
 			{
 				b2Body* b = m_bodies[i];
+				if (shared && b->m_type == b2_staticBody)
+				{
+					continue;
+				}
+
 				b->SetAwake(false);
 			}
 		}
@@ -403,6 +444,7 @@ void b2Island::SolveTOI(const b2TimeStep& subStep, int32 toiIndexA, int32 toiInd
 	contactSolverDef.step = subStep;
 	contactSolverDef.positions = m_positions;
 	contactSolverDef.velocities = m_velocities;
+	contactSolverDef.island = this;
 	b2ContactSolver contactSolver(&contactSolverDef);
 
 	// Solve position constraints.
@@ -537,3 +579,21 @@ void b2Island::Report(const b2ContactVelocityConstraint* constraints)
 		m_listener->PostSolve(c, &impulse);
 	}
 }
+
+int32 b2Island::FindStatic(const b2Body* body) const
+{
+	b2IslandStatic key;
+	key.body = body;
+	key.index = 0;
+
+	const b2IslandStatic* begin = m_statics;
+	const b2IslandStatic* end = m_statics + m_staticCount;
+	const b2IslandStatic* it = std::lower_bound(begin, end, key, b2IslandStaticLessThan);
+	if (it != end && it->body == body)
+	{
+		return it->index;
+	}
+
+	// Not part of this island, e.g. the ground bodies of a gear joint.
+	return body->m_islandIndex;
+}
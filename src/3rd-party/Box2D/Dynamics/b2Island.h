@@ -30,12 +30,19 @@ class b2ContactListener;
 struct b2ContactVelocityConstraint;
 struct b2Profile;
 
+/// Island index of a static body in an island that shares static bodies.
+struct b2IslandStatic
+{
+	const b2Body* body;
+	int32 index;
+};
+
 /// This is an internal class.
 class b2Island
 {
 public:
 	b2Island(int32 bodyCapacity, int32 contactCapacity, int32 jointCapacity,
-			b2StackAllocator* allocator, b2ContactListener* listener);
+			b2StackAllocator* allocator, b2ContactListener* listener, bool shareStatics = false);
 	~b2Island();
 
 	void Clear()
@@ -43,6 +50,7 @@ public:
 		m_bodyCount = 0;
 		m_contactCount = 0;
 		m_jointCount = 0;
+		m_staticCount = 0;
 	}
 
 	void Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& gravity, bool allowSleep);
@@ -69,14 +77,48 @@ public:
 		m_joints[m_jointCount++] = joint;
 	}
 
+	/// Add a body to an island that is solved at the same time as other islands.
+	/// Static bodies can be part of several of these islands, so their island
+	/// index is kept here instead of in the body.
+	void AddShared(b2Body* body)
+	{
+		b2Assert(m_bodyCount < m_bodyCapacity);
+		b2Assert(m_statics != nullptr);
+		if (body->m_type == b2_staticBody)
+		{
+			m_statics[m_staticCount].body = body;
+			m_statics[m_staticCount].index = m_bodyCount;
+			++m_staticCount;
+		}
+		else
+		{
+			body->m_islandIndex = m_bodyCount;
+		}
+		m_bodies[m_bodyCount] = body;
+		++m_bodyCount;
+	}
+
+	/// Get the index of a body in this island.
+	int32 GetIndex(const b2Body* body) const
+	{
+		if (m_staticCount == 0 || body->m_type != b2_staticBody)
+		{
+			return body->m_islandIndex;
+		}
+		return FindStatic(body);
+	}
+
 	void Report(const b2ContactVelocityConstraint* constraints);
 
+	int32 FindStatic(const b2Body* body) const;
+
 	b2StackAllocator* m_allocator;
 	b2ContactListener* m_listener;
 
 	b2Body** m_bodies;
 	b2Contact** m_contacts;
 	b2Joint** m_joints;
+	b2IslandStatic* m_statics;
 
 	b2Position* m_positions;
 	b2Velocity* m_velocities;
@@ -84,6 +126,7 @@ public:
 	int32 m_bodyCount;
 	int32 m_jointCount;
 	int32 m_contactCount;
+	int32 m_staticCount;
 
 	int32 m_bodyCapacity;
 	int32 m_contactCapacity;
@@ -21,6 +21,8 @@
 
 #include "../Common/b2Math.h"
 
+class b2Island;
+
 /// Profiling data. Times are in milliseconds.
 struct b2Profile
 {
@@ -65,6 +67,7 @@ struct b2SolverData
 	b2TimeStep step;
 	b2Position* positions;
 	b2Velocity* velocities;
+	const b2Island* island;
 };
 
 #endif
@@ -32,12 +32,17 @@
 #include "Box2D/Collision/b2TimeOfImpact.h"
 #include "Box2D/Common/b2Draw.h"
 #include "Box2D/Common/b2Timer.h"
+#include "Box2D/Common/b2TaskExecutor.h"
 #include <new>
 
 b2World::b2World(const b2Vec2& gravity)
 {
 	m_destructionListener = nullptr;
 	m_debugDraw = nullptr;
+	m_taskExecutor = nullptr;
+
+	m_threadAllocators = nullptr;
+	m_threadAllocatorCount = 0;
 
 	m_bodyList = nullptr;
 	m_jointList = nullptr;
@@ -82,6 +87,12 @@ b2World::~b2World()
 
 		b = bNext;
 	}
+
+	for (int32 i = 0; i < m_threadAllocatorCount; ++i)
+	{
+		m_threadAllocators[i].~b2StackAllocator();
+	}
+	b2Free(m_threadAllocators);
 }
 
 void b2World::SetDestructionListener(b2DestructionListener* listener)
@@ -104,6 +115,35 @@ void b2World::SetDebugDraw(b2Draw* debugDraw)
 	m_debugDraw = debugDraw;
 }
 
+void b2World::SetTaskExecutor(b2TaskExecutor* executor)
+{
+	b2Assert(IsLocked() == false);
+	if (IsLocked())
+	{
+		return;
+	}
+
+	m_taskExecutor = executor;
+	m_contactManager.m_taskExecutor = executor;
+
+	int32 threadCount = executor ? executor->GetThreadCount() : 0;
+	if (threadCount > m_threadAllocatorCount)
+	{
+		for (int32 i = 0; i < m_threadAllocatorCount; ++i)
+		{
+			m_threadAllocators[i].~b2StackAllocator();
+		}
+		b2Free(m_threadAllocators);
+
+		m_threadAllocators = (b2StackAllocator*)b2Alloc(threadCount * sizeof(b2StackAllocator));
+		for (int32 i = 0; i < threadCount; ++i)
+		{
+			new (m_threadAllocators + i) b2StackAllocator();
+		}
+		m_threadAllocatorCount = threadCount;
+	}
+}
+
 b2Body* b2World::CreateBody(const b2BodyDef* def)
 {
 	b2Assert(IsLocked() == false);
@@ -389,6 +429,13 @@ void b2World::Solve(const b2TimeStep& step)
 	m_profile.solveVelocity = 0.0f;
 	m_profile.solvePosition = 0.0f;
 
+	if (m_taskExecutor)
+	{
+		SolveParallel(step);
+		SynchronizeFixtures();
+		return;
+	}
+
 	// Size the island for the worst case.
 	b2Island island(m_bodyCount,
 					m_contactManager.m_contactCount,
@@ -547,30 +594,320 @@ void b2World::Solve(const b2TimeStep& step)
 
 	m_stackAllocator.Free(stack);
 
+	SynchronizeFixtures();
+}
+
+// A range of the island buffers built by SolveParallel.
+struct b2IslandRange
+{
+	int32 bodyStart, bodyCount;
+	int32 contactStart, contactCount;
+	int32 jointStart, jointCount;
+};
+
+struct b2IslandSolveTask : public b2Task
+{
+	void Execute(int32 begin, int32 end, int32 threadIndex) override
 	{
-		b2Timer timer;
-		// Synchronize fixtures, check for out of range bodies.
-		for (b2Body* b = m_bodyList; b; b = b->GetNext())
+		b2Profile* threadProfile = profiles + threadIndex;
+
+		for (int32 i = begin; i < end; ++i)
 		{
-			// If a body was not in an island then it did not move.
-			if ((b->m_flags & b2Body::e_islandFlag) == 0)
+			const b2IslandRange* range = ranges + i;
+
+			// Contact events are reported by the world after all islands are solved.
+			b2Island island(range->bodyCount,
+							range->contactCount,
+							range->jointCount,
+							allocators + threadIndex,
+							nullptr,
+							true);
+
+			for (int32 j = 0; j < range->bodyCount; ++j)
 			{
-				continue;
+				island.AddShared(bodies[range->bodyStart + j]);
+			}
+			for (int32 j = 0; j < range->contactCount; ++j)
+			{
+				island.Add(contacts[range->contactStart + j]);
+			}
+			for (int32 j = 0; j < range->jointCount; ++j)
+			{
+				island.Add(joints[range->jointStart + j]);
 			}
 
+			b2Profile profile;
+			island.Solve(&profile, step, gravity, allowSleep);
+			threadProfile->solveInit += profile.solveInit;
+			threadProfile->solveVelocity += profile.solveVelocity;
+			threadProfile->solvePosition += profile.solvePosition;
+		}
+	}
+
+	const b2IslandRange* ranges;
+	b2Body** bodies;
+	b2Contact** contacts;
+	b2Joint** joints;
+	b2StackAllocator* allocators;
+	b2Profile* profiles;
+	b2TimeStep step;
+	b2Vec2 gravity;
+	bool allowSleep;
+};
+
+// Same as Solve, but the islands are solved on the executor threads. All islands are
+// found first, with the same search as Solve, so the islands and the order of their
+// bodies and constraints do not depend on the thread count. Each island only writes
+// to its own bodies and constraints, static bodies are shared and only read.
+void b2World::SolveParallel(const b2TimeStep& step)
+{
+	// Clear all the island flags.
+	for (b2Body* b = m_bodyList; b; b = b->m_next)
+	{
+		b->m_flags &= ~b2Body::e_islandFlag;
+	}
+	for (b2Contact* c = m_contactManager.m_contactList; c; c = c->m_next)
+	{
+		c->m_flags &= ~b2Contact::e_islandFlag;
+	}
+	for (b2Joint* j = m_jointList; j; j = j->m_next)
+	{
+		j->m_islandFlag = false;
+	}
+
+	// A static body is added once to every island that touches it, at most once
+	// per contact or joint.
+	int32 contactCapacity = m_contactManager.m_contactCount;
+	int32 bodyCapacity = m_bodyCount + contactCapacity + m_jointCount;
+
+	int32 threadCount = m_taskExecutor->GetThreadCount();
+	b2Assert(threadCount <= m_threadAllocatorCount);
+
+	b2Profile* profiles = (b2Profile*)m_stackAllocator.Allocate(threadCount * sizeof(b2Profile));
+	memset(profiles, 0, threadCount * sizeof(b2Profile));
+
+	b2IslandRange* ranges = (b2IslandRange*)m_stackAllocator.Allocate(m_bodyCount * sizeof(b2IslandRange));
+	b2Body** bodies = (b2Body**)m_stackAllocator.Allocate(bodyCapacity * sizeof(b2Body*));
+	b2Contact** contacts = (b2Contact**)m_stackAllocator.Allocate(contactCapacity * sizeof(b2Contact*));
+	b2Joint** joints = (b2Joint**)m_stackAllocator.Allocate(m_jointCount * sizeof(b2Joint*));
+
+	int32 islandCount = 0;
+	int32 bodyCount = 0;
+	int32 contactCount = 0;
+	int32 jointCount = 0;
+
+	// Build all awake islands.
+	int32 stackSize = m_bodyCount;
+	b2Body** stack = (b2Body**)m_stackAllocator.Allocate(stackSize * sizeof(b2Body*));
+	for (b2Body* seed = m_bodyList; seed; seed = seed->m_next)
+	{
+		if (seed->m_flags & b2Body::e_islandFlag)
+		{
+			continue;
+		}
+
+		if (seed->IsAwake() == false || seed->IsActive() == false)
+		{
+			continue;
+		}
+
+		// The seed can be dynamic or kinematic.
+		if (seed->GetType() == b2_staticBody)
+		{
+			continue;
+		}
+
+		b2IslandRange* range = ranges + islandCount;
+		range->bodyStart = bodyCount;
+		range->contactStart = contactCount;
+		range->jointStart = jointCount;
+
+		int32 stackCount = 0;
+		stack[stackCount++] = seed;
+		seed->m_flags |= b2Body::e_islandFlag;
+
+		// Perform a depth first search (DFS) on the constraint graph.
+		while (stackCount > 0)
+		{
+			// Grab the next body off the stack and add it to the island.
+			b2Body* b = stack[--stackCount];
+			b2Assert(b->IsActive() == true);
+			b2Assert(bodyCount < bodyCapacity);
+			bodies[bodyCount++] = b;
+
+			// Make sure the body is awake (without resetting sleep timer).
+			b->m_flags |= b2Body::e_awakeFlag;
+
+			// To keep islands as small as possible, we don't
+			// propagate islands across static bodies.
 			if (b->GetType() == b2_staticBody)
 			{
 				continue;
 			}
 
-			// Update fixtures (for broad-phase).
-			b->SynchronizeFixtures();
+			// Search all contacts connected to this body.
+			for (b2ContactEdge* ce = b->m_contactList; ce; ce = ce->next)
+			{
+				b2Contact* contact = ce->contact;
+
+				// Has this contact already been added to an island?
+				if (contact->m_flags & b2Contact::e_islandFlag)
+				{
+					continue;
+				}
+
+				// Is this contact solid and touching?
+				if (contact->IsEnabled() == false ||
+					contact->IsTouching() == false)
+				{
+					continue;
+				}
+
+				// Skip sensors.
+				bool sensorA = contact->m_fixtureA->m_isSensor;
+				bool sensorB = contact->m_fixtureB->m_isSensor;
+				if (sensorA || sensorB)
+				{
+					continue;
+				}
+
+				contacts[contactCount++] = contact;
+				contact->m_flags |= b2Contact::e_islandFlag;
+
+				b2Body* other = ce->other;
+
+				// Was the other body already added to this island?
+				if (other->m_flags & b2Body::e_islandFlag)
+				{
+					continue;
+				}
+
+				b2Assert(stackCount < stackSize);
+				stack[stackCount++] = other;
+				other->m_flags |= b2Body::e_islandFlag;
+			}
+
+			// Search all joints connect to this body.
+			for (b2JointEdge* je = b->m_jointList; je; je = je->next)
+			{
+				if (je->joint->m_islandFlag == true)
+				{
+					continue;
+				}
+
+				b2Body* other = je->other;
+
+				// Don't simulate joints connected to inactive bodies.
+				if (other->IsActive() == false)
+				{
+					continue;
+				}
+
+				joints[jointCount++] = je->joint;
+				je->joint->m_islandFlag = true;
+
+				if (other->m_flags & b2Body::e_islandFlag)
+				{
+					continue;
+				}
+
+				b2Assert(stackCount < stackSize);
+				stack[stackCount++] = other;
+				other->m_flags |= b2Body::e_islandFlag;
+			}
 		}
 
-		// Look for new contacts.
-		m_contactManager.FindNewContacts();
-		m_profile.broadphase = timer.GetMilliseconds();
+		range->bodyCount = bodyCount - range->bodyStart;
+		range->contactCount = contactCount - range->contactStart;
+		range->jointCount = jointCount - range->jointStart;
+		++islandCount;
+
+		// Allow static bodies to participate in other islands.
+		for (int32 i = range->bodyStart; i < bodyCount; ++i)
+		{
+			b2Body* b = bodies[i];
+			if (b->GetType() == b2_staticBody)
+			{
+				b->m_flags &= ~b2Body::e_islandFlag;
+			}
+		}
+	}
+
+	m_stackAllocator.Free(stack);
+
+	b2IslandSolveTask task;
+	task.ranges = ranges;
+	task.bodies = bodies;
+	task.contacts = contacts;
+	task.joints = joints;
+	task.allocators = m_threadAllocators;
+	task.profiles = profiles;
+	task.step = step;
+	task.gravity = m_gravity;
+	task.allowSleep = m_allowSleep;
+	m_taskExecutor->ParallelFor(islandCount, 1, &task);
+
+	for (int32 i = 0; i < threadCount; ++i)
+	{
+		m_profile.solveInit += profiles[i].solveInit;
+		m_profile.solveVelocity += profiles[i].solveVelocity;
+		m_profile.solvePosition += profiles[i].solvePosition;
+	}
+
+	// Report the impulses in island order. They were stored in the manifolds
+	// for warm starting.
+	b2ContactListener* listener = m_contactManager.m_contactListener;
+	if (listener)
+	{
+		for (int32 i = 0; i < contactCount; ++i)
+		{
+			b2Contact* c = contacts[i];
+			const b2Manifold* manifold = c->GetManifold();
+
+			b2ContactImpulse impulse;
+			impulse.count = manifold->pointCount;
+			for (int32 j = 0; j < manifold->pointCount; ++j)
+			{
+				impulse.normalImpulses[j] = manifold->points[j].normalImpulse;
+				impulse.tangentImpulses[j] = manifold->points[j].tangentImpulse;
+			}
+
+			listener->PostSolve(c, &impulse);
+		}
+	}
+
+	m_stackAllocator.Free(joints);
+	m_stackAllocator.Free(contacts);
+	m_stackAllocator.Free(bodies);
+	m_stackAllocator.Free(ranges);
+	m_stackAllocator.Free(profiles);
+}
+
+// Synchronize the fixtures of the bodies that moved and look for new contacts.
+void b2World::SynchronizeFixtures()
+{
+	b2Timer timer;
+	// Synchronize fixtures, check for out of range bodies.
+	for (b2Body* b = m_bodyList; b; b = b->GetNext())
+	{
+		// If a body was not in an island then it did not move.
+		if ((b->m_flags & b2Body::e_islandFlag) == 0)
+		{
+			continue;
+		}
+
+		if (b->GetType() == b2_staticBody)
+		{
+			continue;
+		}
+
+		// Update fixtures (for broad-phase).
+		b->SynchronizeFixtures();
 	}
+
+	// Look for new contacts.
+	m_contactManager.FindNewContacts();
+	m_profile.broadphase = timer.GetMilliseconds();
 }
 
 // Find TOI contacts and solve them.
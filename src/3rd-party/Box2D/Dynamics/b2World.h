@@ -34,6 +34,7 @@ class b2Body;
 class b2Draw;
 class b2Fixture;
 class b2Joint;
+class b2TaskExecutor;
 
 /// The world class manages all physics entities, dynamic simulation,
 /// and asynchronous queries. The world also contains efficient memory
@@ -66,6 +67,17 @@ public:
 	/// by you and must remain in scope.
 	void SetDebugDraw(b2Draw* debugDraw);
 
+	/// Register a task executor to run the broad-phase, the narrow phase and the
+	/// island solver on several threads. Pass nullptr to step on the calling thread
+	/// only. Results are the same for any thread count, but can differ slightly from
+	/// stepping without an executor. The executor is owned by you and must remain
+	/// in scope.
+	/// @warning This function is locked during callbacks.
+	void SetTaskExecutor(b2TaskExecutor* executor);
+
+	/// Get the registered task executor.
+	b2TaskExecutor* GetTaskExecutor() const;
+
 	/// Create a rigid body given a definition. No reference to the definition
 	/// is retained.
 	/// @warning This function is locked during callbacks.
@@ -225,14 +237,21 @@ private:
 	friend class b2Controller;
 
 	void Solve(const b2TimeStep& step);
+	void SolveParallel(const b2TimeStep& step);
 	void SolveTOI(const b2TimeStep& step);
 
+	void SynchronizeFixtures();
+
 	void DrawJoint(b2Joint* joint);
 	void DrawShape(b2Fixture* shape, const b2Transform& xf, const b2Color& color);
 
 	b2BlockAllocator m_blockAllocator;
 	b2StackAllocator m_stackAllocator;
 
+	// One stack allocator per executor thread for the islands solved in parallel.
+	b2StackAllocator* m_threadAllocators;
+	int32 m_threadAllocatorCount;
+
 	int32 m_flags;
 
 	b2ContactManager m_contactManager;
@@ -248,6 +267,7 @@ private:
 
 	b2DestructionListener* m_destructionListener;
 	b2Draw* m_debugDraw;
+	b2TaskExecutor* m_taskExecutor;
 
 	// This is used to compute the time step ratio to
 	// support a variable time step.
@@ -263,6 +283,11 @@ private:
 	b2Profile m_profile;
 };
 
+inline b2TaskExecutor* b2World::GetTaskExecutor() const
+{
+	return m_taskExecutor;
+}
+
 inline b2Body* b2World::GetBodyList()
 {
 	return m_bodyList;
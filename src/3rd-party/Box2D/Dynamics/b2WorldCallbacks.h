@@ -89,6 +89,10 @@ public:
 	/// Called when two fixtures cease to touch.
 	virtual void EndContact(b2Contact* contact) { B2_NOT_USED(contact); }
 
+	/// Called when a contact is about to be destroyed, after EndContact if it
+	/// was touching. Use this to drop any references you kept to the contact.
+	virtual void DestroyContact(b2Contact* contact) { B2_NOT_USED(contact); }
+
 	/// This is called after a contact is updated. This allows you to inspect a
 	/// contact before it goes to the solver. If you are careful, you can modify the
 	/// contact manifold (e.g. disable contact).
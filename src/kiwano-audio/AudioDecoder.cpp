@@ -0,0 +1,421 @@
+// Copyright (c) 2016-2018 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <kiwano-audio/AudioDecoder.h>
+#include <kiwano/utils/Logger.h>
+
+#if defined(KGE_PLATFORM_WINDOWS)
+#include <kiwano-audio/Transcoder.h>
+#endif
+
+namespace kiwano
+{
+namespace audio
+{
+
+namespace
+{
+
+const uint16_t WAVE_FORMAT_TAG_PCM        = 0x0001;
+const uint16_t WAVE_FORMAT_TAG_FLOAT      = 0x0003;
+const uint16_t WAVE_FORMAT_TAG_IMA_ADPCM  = 0x0011;
+const uint16_t WAVE_FORMAT_TAG_EXTENSIBLE = 0xFFFE;
+
+const int ADPCM_INDEX_TABLE[16] = { -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8 };
+
+const int ADPCM_STEP_TABLE[89] = {
+    7,     8,     9,     10,    11,    12,    13,    14,    16,    17,    19,    21,    23,    25,    28,
+    31,    34,    37,    41,    45,    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,   337,   371,   408,   449,   494,
+    544,   598,   658,   724,   796,   876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,  5894,  6484,  7132,  7845,  8630,
+    9493,  10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+inline uint16_t ReadUInt16(const uint8_t* p)
+{
+    return uint16_t(p[0] | (p[1] << 8));
+}
+
+inline uint32_t ReadUInt32(const uint8_t* p)
+{
+    return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+}
+
+inline int16_t ClampSample(int32_t sample)
+{
+    return int16_t(std::min(std::max(sample, -32768), 32767));
+}
+
+struct AdpcmChannel
+{
+    int32_t predictor;
+    int32_t step_index;
+
+    int16_t Decode(uint8_t nibble)
+    {
+        const int32_t step = ADPCM_STEP_TABLE[step_index];
+
+        int32_t diff = step >> 3;
+        if (nibble & 1)
+            diff += step >> 2;
+        if (nibble & 2)
+            diff += step >> 1;
+        if (nibble & 4)
+            diff += step;
+        if (nibble & 8)
+            diff = -diff;
+
+        predictor  = ClampSample(predictor + diff);
+        step_index = std::min(std::max(step_index + ADPCM_INDEX_TABLE[nibble], 0), 88);
+        return int16_t(predictor);
+    }
+};
+
+}  // namespace
+
+AudioDecoderPtr AudioDecoder::Create(const BinaryData& data)
+{
+    if (WaveDecoder::IsWave(data))
+    {
+        WaveDecoderPtr decoder = MakePtr<WaveDecoder>();
+        if (decoder && decoder->Open(data))
+            return decoder;
+        return nullptr;
+    }
+
+#if defined(KGE_PLATFORM_WINDOWS)
+    MediaFoundationDecoderPtr decoder = MakePtr<MediaFoundationDecoder>();
+    if (decoder && decoder->Open(data))
+        return decoder;
+#endif
+
+    KGE_WARNF("AudioDecoder::Create failed: unsupported audio format");
+    return nullptr;
+}
+
+AudioDecoderPtr AudioDecoder::Create(const String& file_path)
+{
+    BinaryData data = BinaryData::FromFile(file_path);
+    if (!data.IsValid())
+        return nullptr;
+    return Create(data);
+}
+
+AudioDecoder::AudioDecoder()
+    : frames_count_(0)
+    , position_(0)
+{
+}
+
+AudioDecoder::~AudioDecoder() {}
+
+Duration AudioDecoder::GetDuration() const
+{
+    if (format_.sample_rate == 0)
+        return Duration();
+    return Duration(int64_t(frames_count_ * 1000 / format_.sample_rate));
+}
+
+WaveDecoder::WaveDecoder()
+    : encoding_(Encoding::Pcm)
+    , source_bits_(0)
+    , source_block_align_(0)
+    , frames_per_block_(0)
+    , cached_block_(UINT64_MAX)
+{
+}
+
+bool WaveDecoder::IsWave(const BinaryData& data)
+{
+    const uint8_t* p = data.GetBytes();
+    return data.GetSize() >= 12 && std::memcmp(p, "RIFF", 4) == 0 && std::memcmp(p + 8, "WAVE", 4) == 0;
+}
+
+bool WaveDecoder::Open(const BinaryData& data)
+{
+    if (!IsWave(data))
+    {
+        Fail("WaveDecoder::Open failed: not a WAVE file");
+        return false;
+    }
+
+    const uint8_t* fmt          = nullptr;
+    uint32_t       fmt_size     = 0;
+    uint64_t       data_offset  = 0;
+    uint64_t       data_size    = 0;
+    uint64_t       fact_samples = 0;
+
+    // Walk through the chunks, each chunk is padded to an even size
+    uint64_t offset = 12;
+    while (offset + 8 <= data.GetSize())
+    {
+        const uint8_t* chunk      = data.GetBytes() + offset;
+        const uint32_t chunk_size = ReadUInt32(chunk + 4);
+        const uint64_t available  = data.GetSize() - offset - 8;
+
+        if (std::memcmp(chunk, "fmt ", 4) == 0 && chunk_size >= 16 && chunk_size <= available)
+        {
+            fmt      = chunk + 8;
+            fmt_size = chunk_size;
+        }
+        else if (std::memcmp(chunk, "fact", 4) == 0 && chunk_size >= 4 && chunk_size <= available)
+        {
+            fact_samples = ReadUInt32(chunk + 8);
+        }
+        else if (std::memcmp(chunk, "data", 4) == 0)
+        {
+            // Truncated files still play what they have
+            data_offset = offset + 8;
+            data_size   = std::min<uint64_t>(chunk_size, available);
+            break;
+        }
+        offset += 8 + uint64_t(chunk_size) + (chunk_size & 1);
+    }
+
+    if (!fmt || !data_offset)
+    {
+        Fail("WaveDecoder::Open failed: missing fmt or data chunk");
+        return false;
+    }
+
+    uint16_t format_tag = ReadUInt16(fmt);
+    if (format_tag == WAVE_FORMAT_TAG_EXTENSIBLE && fmt_size >= 26)
+    {
+        // The format tag is stored in the first two bytes of the sub-format GUID
+        format_tag = ReadUInt16(fmt + 24);
+    }
+
+    const uint16_t channels    = ReadUInt16(fmt + 2);
+    const uint32_t sample_rate = ReadUInt32(fmt + 4);
+    const uint16_t block_align = ReadUInt16(fmt + 12);
+    const uint16_t bits        = ReadUInt16(fmt + 14);
+
+    if (channels == 0 || sample_rate == 0 || block_align == 0)
+    {
+        Fail("WaveDecoder::Open failed: invalid format");
+        return false;
+    }
+
+    switch (format_tag)
+    {
+    case WAVE_FORMAT_TAG_PCM:
+        if (bits != 8 && bits != 16 && bits != 24 && bits != 32)
+        {
+            Fail(strings::Format("WaveDecoder::Open failed: unsupported PCM bits %d", int(bits)));
+            return false;
+        }
+        encoding_ = Encoding::Pcm;
+        break;
+    case WAVE_FORMAT_TAG_FLOAT:
+        if (bits != 32)
+        {
+            Fail(strings::Format("WaveDecoder::Open failed: unsupported float bits %d", int(bits)));
+            return false;
+        }
+        encoding_ = Encoding::Float;
+        break;
+    case WAVE_FORMAT_TAG_IMA_ADPCM:
+        if (bits != 4 || channels > 2 || block_align <= 4u * channels)
+        {
+            Fail("WaveDecoder::Open failed: unsupported IMA ADPCM format");
+            return false;
+        }
+        encoding_ = Encoding::ImaAdpcm;
+        break;
+    default:
+        Fail(strings::Format("WaveDecoder::Open failed: unsupported format tag 0x%04X", int(format_tag)));
+        return false;
+    }
+
+    if (encoding_ != Encoding::ImaAdpcm && block_align != channels * bits / 8)
+    {
+        Fail("WaveDecoder::Open failed: invalid block align");
+        return false;
+    }
+
+    format_.sample_rate     = sample_rate;
+    format_.channels        = channels;
+    format_.bits_per_sample = 16;
+
+    source_bits_        = bits;
+    source_block_align_ = block_align;
+    samples_            = data.Slice(data_offset, data_size);
+    position_           = 0;
+    cached_block_       = UINT64_MAX;
+
+    if (encoding_ == Encoding::ImaAdpcm)
+    {
+        // Every block starts with a 4-byte header per channel which holds the first sample,
+        // followed by 4-bit samples interleaved in groups of 8 per channel
+        frames_per_block_ = (block_align - 4u * channels) / (4u * channels) * 8 + 1;
+
+        const uint64_t full_blocks = data_size / block_align;
+        const uint64_t rest        = data_size % block_align;
+
+        frames_count_ = full_blocks * frames_per_block_;
+        if (rest >= 4u * channels)
+            frames_count_ += (rest - 4u * channels) / (4u * channels) * 8 + 1;
+
+        if (fact_samples && fact_samples < frames_count_)
+            frames_count_ = fact_samples;
+
+        block_cache_.resize(size_t(frames_per_block_) * channels);
+    }
+    else
+    {
+        frames_per_block_ = 1;
+        frames_count_     = data_size / block_align;
+        block_cache_.clear();
+    }
+    return true;
+}
+
+size_t WaveDecoder::Read(void* buffer, size_t frames)
+{
+    if (!samples_.IsValid() || position_ >= frames_count_)
+        return 0;
+
+    frames = size_t(std::min<uint64_t>(frames, frames_count_ - position_));
+
+    int16_t* output = static_cast<int16_t*>(buffer);
+    if (encoding_ == Encoding::ImaAdpcm)
+        frames = ReadAdpcm(output, frames);
+    else
+        frames = ReadPcm(output, frames);
+
+    position_ += frames;
+    return frames;
+}
+
+size_t WaveDecoder::ReadPcm(int16_t* output, size_t frames)
+{
+    const uint8_t* input   = samples_.GetBytes() + position_ * source_block_align_;
+    const size_t   samples = frames * format_.channels;
+
+    switch (source_bits_)
+    {
+    case 8:
+        for (size_t i = 0; i < samples; ++i)
+            output[i] = int16_t((int32_t(input[i]) - 128) << 8);
+        break;
+    case 16:
+        std::memcpy(output, input, samples * 2);
+        break;
+    case 24:
+        for (size_t i = 0; i < samples; ++i, input += 3)
+            output[i] = int16_t(input[1] | (input[2] << 8));
+        break;
+    case 32:
+        if (encoding_ == Encoding::Float)
+        {
+            for (size_t i = 0; i < samples; ++i, input += 4)
+            {
+                float value;
+                std::memcpy(&value, input, sizeof(value));
+                output[i] = ClampSample(int32_t(value * 32767.0f));
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < samples; ++i, input += 4)
+                output[i] = int16_t(input[2] | (input[3] << 8));
+        }
+        break;
+    }
+    return frames;
+}
+
+size_t WaveDecoder::ReadAdpcm(int16_t* output, size_t frames)
+{
+    const uint16_t channels = format_.channels;
+
+    size_t   done     = 0;
+    uint64_t position = position_;
+    while (done < frames)
+    {
+        if (!DecodeAdpcmBlock(position / frames_per_block_))
+            break;
+
+        const size_t start = size_t(position % frames_per_block_);
+        const size_t count = std::min(frames - done, size_t(frames_per_block_) - start);
+
+        std::memcpy(output + done * channels, block_cache_.data() + start * channels, count * channels * 2);
+        done += count;
+        position += count;
+    }
+    return done;
+}
+
+bool WaveDecoder::DecodeAdpcmBlock(uint64_t block)
+{
+    if (block == cached_block_)
+        return true;
+
+    const uint16_t channels = format_.channels;
+    const uint64_t offset   = block * source_block_align_;
+    if (offset + 4u * channels > samples_.GetSize())
+        return false;
+
+    const uint8_t* input = samples_.GetBytes() + offset;
+    const size_t   size  = size_t(std::min<uint64_t>(source_block_align_, samples_.GetSize() - offset));
+
+    AdpcmChannel state[2] = {};
+    for (uint16_t ch = 0; ch < channels; ++ch)
+    {
+        state[ch].predictor  = int16_t(ReadUInt16(input + ch * 4));
+        state[ch].step_index = std::min<int32_t>(input[ch * 4 + 2], 88);
+
+        block_cache_[ch] = int16_t(state[ch].predictor);
+    }
+
+    // Each group holds 4 bytes (8 samples) per channel, low nibble first
+    const size_t groups = (size - 4u * channels) / (4u * channels);
+    const size_t stride = size_t(channels);
+
+    const uint8_t* p = input + 4u * channels;
+    for (size_t group = 0; group < groups; ++group)
+    {
+        for (uint16_t ch = 0; ch < channels; ++ch)
+        {
+            int16_t* out = block_cache_.data() + (1 + group * 8) * stride + ch;
+            for (int i = 0; i < 4; ++i, ++p)
+            {
+                out[(i * 2) * stride]     = state[ch].Decode(*p & 0x0F);
+                out[(i * 2 + 1) * stride] = state[ch].Decode(*p >> 4);
+            }
+        }
+    }
+
+    cached_block_ = block;
+    return true;
+}
+
+bool WaveDecoder::Seek(uint64_t frame)
+{
+    if (!samples_.IsValid())
+        return false;
+
+    position_ = std::min(frame, frames_count_);
+    return true;
+}
+
+}  // namespace audio
+}  // namespace kiwano
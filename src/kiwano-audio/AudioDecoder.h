@@ -0,0 +1,205 @@
+// Copyright (c) 2016-2018 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <kiwano/core/Common.h>
+#include <kiwano/core/BinaryData.h>
+#include <kiwano/core/Duration.h>
+#include <kiwano/base/ObjectBase.h>
+
+namespace kiwano
+{
+namespace audio
+{
+
+KGE_DECLARE_SMART_PTR(AudioDecoder);
+KGE_DECLARE_SMART_PTR(WaveDecoder);
+
+/**
+ * \addtogroup Audio
+ * @{
+ */
+
+/**
+ * \~chinese
+ * @brief 音频格式
+ * @details 解码后的音频数据为交错存储的 16 位有符号整数 PCM
+ */
+struct KGE_API AudioFormat
+{
+    uint32_t sample_rate;      ///< 采样率
+    uint16_t channels;         ///< 声道数
+    uint16_t bits_per_sample;  ///< 采样位数
+
+    AudioFormat();
+
+    /// \~chinese
+    /// @brief 获取每帧的字节数
+    /// @details 一帧包含每个声道的一个采样
+    uint32_t GetBlockAlign() const;
+
+    /// \~chinese
+    /// @brief 获取每秒的字节数
+    uint32_t GetBytesPerSecond() const;
+};
+
+/**
+ * \~chinese
+ * @brief 音频解码器
+ * @details 按帧增量解码音频数据，并且可以跳转到任意位置，用于流式播放
+ */
+class KGE_API AudioDecoder : public ObjectBase
+{
+public:
+    /// \~chinese
+    /// @brief 根据数据格式创建解码器
+    /// @details WAV 数据使用内置的解码器，Windows 平台上的其他格式使用 Media Foundation 解码
+    /// @return 不支持的格式返回空指针
+    static AudioDecoderPtr Create(const BinaryData& data);
+
+    /// \~chinese
+    /// @brief 根据文件格式创建解码器
+    /// @details 文件被映射到内存，不会一次性读取
+    /// @return 文件不存在或格式不支持时返回空指针
+    static AudioDecoderPtr Create(const String& file_path);
+
+    virtual ~AudioDecoder();
+
+    /// \~chinese
+    /// @brief 获取解码后的音频格式
+    const AudioFormat& GetFormat() const;
+
+    /// \~chinese
+    /// @brief 获取音频总帧数
+    uint64_t GetFramesCount() const;
+
+    /// \~chinese
+    /// @brief 获取下一次解码的位置（帧）
+    uint64_t GetPosition() const;
+
+    /// \~chinese
+    /// @brief 获取音频时长
+    Duration GetDuration() const;
+
+    /// \~chinese
+    /// @brief 解码音频帧
+    /// @param buffer 输出缓冲，大小至少为帧数乘以每帧的字节数
+    /// @param frames 最多解码的帧数
+    /// @return 实际解码的帧数，到达末尾时返回零
+    virtual size_t Read(void* buffer, size_t frames) = 0;
+
+    /// \~chinese
+    /// @brief 跳转到指定位置
+    /// @param frame 帧位置
+    virtual bool Seek(uint64_t frame) = 0;
+
+protected:
+    AudioDecoder();
+
+protected:
+    AudioFormat format_;
+    uint64_t    frames_count_;
+    uint64_t    position_;
+};
+
+/**
+ * \~chinese
+ * @brief WAV 解码器
+ * @details 支持 8/16/24/32 位整数 PCM、32 位浮点 PCM 和 IMA ADPCM 编码的 WAV 数据，
+ * 不依赖平台的解码库
+ */
+class KGE_API WaveDecoder : public AudioDecoder
+{
+public:
+    WaveDecoder();
+
+    /// \~chinese
+    /// @brief 打开 WAV 数据
+    /// @details 解码器共享持有数据，不会复制
+    bool Open(const BinaryData& data);
+
+    /// \~chinese
+    /// @brief 数据是否是 WAV 格式
+    static bool IsWave(const BinaryData& data);
+
+    size_t Read(void* buffer, size_t frames) override;
+
+    bool Seek(uint64_t frame) override;
+
+private:
+    size_t ReadPcm(int16_t* output, size_t frames);
+
+    size_t ReadAdpcm(int16_t* output, size_t frames);
+
+    bool DecodeAdpcmBlock(uint64_t block);
+
+private:
+    enum class Encoding
+    {
+        Pcm,
+        Float,
+        ImaAdpcm,
+    };
+
+    Encoding        encoding_;
+    uint16_t        source_bits_;
+    uint32_t        source_block_align_;
+    uint32_t        frames_per_block_;
+    uint64_t        cached_block_;
+    Vector<int16_t> block_cache_;
+    BinaryData      samples_;
+};
+
+/** @} */
+
+inline AudioFormat::AudioFormat()
+    : sample_rate(0)
+    , channels(0)
+    , bits_per_sample(16)
+{
+}
+
+inline uint32_t AudioFormat::GetBlockAlign() const
+{
+    return uint32_t(channels) * bits_per_sample / 8;
+}
+
+inline uint32_t AudioFormat::GetBytesPerSecond() const
+{
+    return sample_rate * GetBlockAlign();
+}
+
+inline const AudioFormat& AudioDecoder::GetFormat() const
+{
+    return format_;
+}
+
+inline uint64_t AudioDecoder::GetFramesCount() const
+{
+    return frames_count_;
+}
+
+inline uint64_t AudioDecoder::GetPosition() const
+{
+    return position_;
+}
+
+}  // namespace audio
+}  // namespace kiwano
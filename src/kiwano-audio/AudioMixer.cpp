@@ -0,0 +1,441 @@
+// Copyright (c) 2016-2018 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <kiwano-audio/AudioMixer.h>
+#include <kiwano-audio/SampleConverter.h>
+#include <kiwano/utils/Logger.h>
+#include <chrono>
+#include <cmath>
+
+namespace kiwano
+{
+namespace audio
+{
+
+namespace
+{
+
+// Frames mixed at once, bounds the size of the bus and scratch buffers
+const size_t MIX_BLOCK_FRAMES = 1024;
+
+const float INT16_TO_FLOAT = 1.f / 32768.f;
+
+}  // namespace
+
+MixerVoice::MixerVoice(AudioMixer* mixer)
+    : playing_(false)
+    , paused_(false)
+    , loops_left_(0)
+    , volume_(1.f)
+    , pan_(0.f)
+    , pitch_(1.f)
+    , position_(0)
+    , mixer_(mixer)
+{
+    if (mixer_)
+        mixer_->AddVoice(this);
+}
+
+MixerVoice::~MixerVoice()
+{
+    if (mixer_)
+        mixer_->RemoveVoice(this);
+}
+
+bool MixerVoice::Start(SoundBufferPtr buffer, int loop_count)
+{
+    if (!mixer_ || !buffer || !buffer->IsValid() || buffer->GetFormat().bits_per_sample != 16)
+        return false;
+
+    auto lock   = LockMixer();
+    buffer_     = buffer;
+    position_   = 0;
+    loops_left_ = loop_count;
+    playing_    = true;
+    paused_     = false;
+    return true;
+}
+
+void MixerVoice::Stop()
+{
+    auto lock = LockMixer();
+    playing_  = false;
+    paused_   = false;
+    buffer_   = nullptr;
+}
+
+void MixerVoice::Pause()
+{
+    auto lock = LockMixer();
+    paused_   = true;
+}
+
+void MixerVoice::Resume()
+{
+    auto lock = LockMixer();
+    paused_   = false;
+}
+
+void MixerVoice::SetVolume(float volume)
+{
+    auto lock = LockMixer();
+    volume_   = volume;
+}
+
+bool MixerVoice::IsFinished() const
+{
+    auto lock = LockMixer();
+    return !playing_;
+}
+
+void MixerVoice::SetPan(float pan)
+{
+    auto lock = LockMixer();
+    pan_      = std::min(std::max(pan, -1.f), 1.f);
+}
+
+void MixerVoice::SetPitch(float pitch)
+{
+    auto lock = LockMixer();
+    pitch_    = std::max(pitch, 0.f);
+}
+
+std::unique_lock<std::mutex> MixerVoice::LockMixer() const
+{
+    if (mixer_)
+        return std::unique_lock<std::mutex>(mixer_->mutex_);
+    return std::unique_lock<std::mutex>();
+}
+
+void MixerVoice::Mix(float* output, size_t frames, const AudioFormat& format, float master_volume,
+                     Vector<float>& scratch)
+{
+    const float volume     = volume_ * master_volume;
+    float       left_gain  = volume;
+    float       right_gain = volume;
+    if (format.channels == 2)
+    {
+        // Balance law, the centre keeps the original level on both sides
+        if (pan_ > 0)
+            left_gain *= 1.f - pan_;
+        else
+            right_gain *= 1.f + pan_;
+    }
+
+    const AudioFormat& source = buffer_->GetFormat();
+    const uint64_t     total  = buffer_->GetFramesCount();
+    const double       step   = double(source.sample_rate) / format.sample_rate * pitch_;
+
+    size_t done = 0;
+    while (done < frames && playing_)
+    {
+        float* block = output + done * format.channels;
+
+        size_t count = 0;
+        if (step == 1.0 && position_ == std::floor(position_))
+            count = MixDirect(block, frames - done, format, left_gain, right_gain, scratch);
+        else
+            count = MixResampled(block, frames - done, format, left_gain, right_gain, step);
+
+        done += count;
+
+        if (position_ >= double(total))
+        {
+            if (loops_left_ != 0)
+            {
+                position_ -= double(total);
+                if (loops_left_ > 0)
+                    --loops_left_;
+            }
+            else
+            {
+                playing_ = false;
+            }
+        }
+        else if (count == 0)
+        {
+            break;
+        }
+    }
+}
+
+size_t MixerVoice::MixDirect(float* output, size_t frames, const AudioFormat& format, float left_gain,
+                             float right_gain, Vector<float>& scratch)
+{
+    const AudioFormat& source   = buffer_->GetFormat();
+    const uint16_t     channels = source.channels;
+    const uint64_t     position = uint64_t(position_);
+    const uint64_t     total    = buffer_->GetFramesCount();
+
+    size_t count = size_t(std::min<uint64_t>(frames, total - position));
+    count        = std::min(count, scratch.size() / std::max<size_t>(channels, format.channels));
+
+    const int16_t* input  = reinterpret_cast<const int16_t*>(buffer_->GetData().GetBytes()) + position * channels;
+    float*         buffer = scratch.data();
+
+    if (channels == format.channels)
+    {
+        ConvertInt16ToFloat(input, buffer, count * channels);
+    }
+    else if (channels == 1 && format.channels == 2)
+    {
+        // Convert into the upper half, then spread forward without overwriting unread samples
+        float* mono = buffer + count;
+        ConvertInt16ToFloat(input, mono, count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float sample = mono[i];
+            buffer[i * 2]      = sample;
+            buffer[i * 2 + 1]  = sample;
+        }
+    }
+    else if (format.channels == 1)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            int32_t sum = 0;
+            for (uint16_t c = 0; c < channels; ++c)
+                sum += input[i * channels + c];
+            buffer[i] = float(sum) * INT16_TO_FLOAT / channels;
+        }
+    }
+    else
+    {
+        // Multi-channel sources keep their front left and right channels
+        for (size_t i = 0; i < count; ++i)
+        {
+            buffer[i * 2]     = float(input[i * channels]) * INT16_TO_FLOAT;
+            buffer[i * 2 + 1] = float(input[i * channels + 1]) * INT16_TO_FLOAT;
+        }
+    }
+
+    MixSamples(buffer, output, count * format.channels, left_gain, right_gain);
+
+    position_ += double(count);
+    return count;
+}
+
+size_t MixerVoice::MixResampled(float* output, size_t frames, const AudioFormat& format, float left_gain,
+                                float right_gain, double step)
+{
+    const AudioFormat& source   = buffer_->GetFormat();
+    const uint16_t     channels = source.channels;
+    const uint64_t     total    = buffer_->GetFramesCount();
+    const int16_t*     samples  = reinterpret_cast<const int16_t*>(buffer_->GetData().GetBytes());
+
+    size_t i = 0;
+    for (; i < frames && position_ < double(total); ++i)
+    {
+        const uint64_t index = uint64_t(position_);
+        const float    frac  = float(position_ - double(index));
+
+        // Interpolate across the loop point when looping
+        uint64_t next = index + 1;
+        if (next >= total)
+            next = (loops_left_ != 0) ? 0 : index;
+
+        const int16_t* a = samples + index * channels;
+        const int16_t* b = samples + next * channels;
+
+        if (format.channels == 1)
+        {
+            float sum = 0;
+            for (uint16_t c = 0; c < channels; ++c)
+                sum += float(a[c]) + float(b[c] - a[c]) * frac;
+            output[i] += sum * INT16_TO_FLOAT / channels * left_gain;
+        }
+        else
+        {
+            const uint16_t right = channels > 1 ? 1 : 0;
+
+            const float left_sample  = float(a[0]) + float(b[0] - a[0]) * frac;
+            const float right_sample = float(a[right]) + float(b[right] - a[right]) * frac;
+
+            output[i * 2] += left_sample * INT16_TO_FLOAT * left_gain;
+            output[i * 2 + 1] += right_sample * INT16_TO_FLOAT * right_gain;
+        }
+
+        position_ += step;
+    }
+    return i;
+}
+
+AudioMixer::AudioMixer(uint32_t sample_rate, uint16_t channels)
+    : running_(false)
+    , master_volume_(1.f)
+{
+    format_.sample_rate     = sample_rate;
+    format_.channels        = std::min(std::max(channels, uint16_t(1)), uint16_t(2));
+    format_.bits_per_sample = 16;
+
+    bus_.resize(MIX_BLOCK_FRAMES * format_.channels);
+    scratch_.resize(MIX_BLOCK_FRAMES * 2);
+}
+
+AudioMixer::~AudioMixer()
+{
+    Stop();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto voice : voices_)
+    {
+        voice->mixer_ = nullptr;
+    }
+    voices_.clear();
+
+    if (sink_)
+    {
+        sink_->Close();
+        sink_ = nullptr;
+    }
+}
+
+bool AudioMixer::SetSink(AudioSinkPtr sink)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (sink_)
+    {
+        sink_->Close();
+    }
+
+    sink_ = sink;
+    if (sink_ && !sink_->Open(format_))
+    {
+        sink_ = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void AudioMixer::SetMasterVolume(float volume)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    master_volume_ = std::min(std::max(volume, 0.f), 224.f);
+}
+
+VoicePtr AudioMixer::CreateVoice()
+{
+    return MakePtr<MixerVoice>(this);
+}
+
+void AudioMixer::Mix(float* output, size_t frames)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    MixLocked(output, frames);
+}
+
+void AudioMixer::Render(size_t frames)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    while (frames)
+    {
+        size_t count = std::min(frames, MIX_BLOCK_FRAMES);
+        MixLocked(bus_.data(), count);
+
+        if (sink_)
+            sink_->Write(bus_.data(), count);
+
+        frames -= count;
+    }
+}
+
+void AudioMixer::Start(Duration period)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_)
+        return;
+
+    const int64_t milliseconds = std::max<int64_t>(period.GetMilliseconds(), 1);
+    const size_t  frames       = size_t(std::max<int64_t>(format_.sample_rate * milliseconds / 1000, 1));
+
+    running_ = true;
+    thread_  = std::thread([=]() {
+        auto next = std::chrono::steady_clock::now();
+        while (true)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!running_)
+                    break;
+            }
+
+            Render(frames);
+
+            next += std::chrono::milliseconds(milliseconds);
+            std::this_thread::sleep_until(next);
+        }
+    });
+}
+
+void AudioMixer::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_)
+            return;
+        running_ = false;
+    }
+    thread_.join();
+}
+
+uint32_t AudioMixer::GetPlayingCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    uint32_t count = 0;
+    for (auto voice : voices_)
+    {
+        if (voice->playing_ && !voice->paused_)
+            ++count;
+    }
+    return count;
+}
+
+void AudioMixer::AddVoice(MixerVoice* voice)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    voices_.push_back(voice);
+}
+
+void AudioMixer::RemoveVoice(MixerVoice* voice)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    voices_.erase(std::remove(voices_.begin(), voices_.end(), voice), voices_.end());
+}
+
+void AudioMixer::MixLocked(float* output, size_t frames)
+{
+    std::fill(output, output + frames * format_.channels, 0.f);
+
+    for (size_t offset = 0; offset < frames; offset += MIX_BLOCK_FRAMES)
+    {
+        const size_t count = std::min(frames - offset, MIX_BLOCK_FRAMES);
+        float*       block = output + offset * format_.channels;
+
+        for (auto voice : voices_)
+        {
+            if (voice->playing_ && !voice->paused_)
+                voice->Mix(block, count, format_, master_volume_, scratch_);
+        }
+    }
+}
+
+}  // namespace audio
+}  // namespace kiwano
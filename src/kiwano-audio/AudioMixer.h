@@ -0,0 +1,209 @@
+// Copyright (c) 2016-2018 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <thread>
+#include <mutex>
+#include <kiwano-audio/AudioSink.h>
+#include <kiwano-audio/VoicePool.h>
+#include <kiwano/core/Singleton.h>
+
+namespace kiwano
+{
+namespace audio
+{
+
+class AudioMixer;
+
+KGE_DECLARE_SMART_PTR(MixerVoice);
+
+/**
+ * \addtogroup Audio
+ * @{
+ */
+
+/**
+ * \~chinese
+ * @brief 软件混音器声部
+ * @details 支持音量、声像和播放速率，采样率与混音器不同时使用线性插值转换
+ */
+class KGE_API MixerVoice : public Voice
+{
+    friend class AudioMixer;
+
+public:
+    /// \~chinese
+    /// @brief 创建声部
+    /// @param mixer 混音器，声部的生命周期内必须有效
+    MixerVoice(AudioMixer* mixer);
+
+    virtual ~MixerVoice();
+
+    bool Start(SoundBufferPtr buffer, int loop_count) override;
+
+    void Stop() override;
+
+    void Pause() override;
+
+    void Resume() override;
+
+    void SetVolume(float volume) override;
+
+    bool IsFinished() const override;
+
+    /// \~chinese
+    /// @brief 设置声像
+    /// @param pan 声像，-1 为左声道，0 为居中，1 为右声道
+    void SetPan(float pan);
+
+    /// \~chinese
+    /// @brief 设置播放速率
+    /// @param pitch 播放速率，1.0 为原始速率
+    void SetPitch(float pitch);
+
+private:
+    std::unique_lock<std::mutex> LockMixer() const;
+
+    void Mix(float* output, size_t frames, const AudioFormat& format, float master_volume, Vector<float>& scratch);
+
+    size_t MixDirect(float* output, size_t frames, const AudioFormat& format, float left_gain, float right_gain,
+                     Vector<float>& scratch);
+
+    size_t MixResampled(float* output, size_t frames, const AudioFormat& format, float left_gain, float right_gain,
+                        double step);
+
+private:
+    bool           playing_;
+    bool           paused_;
+    int            loops_left_;
+    float          volume_;
+    float          pan_;
+    float          pitch_;
+    double         position_;
+    SoundBufferPtr buffer_;
+    AudioMixer*    mixer_;
+};
+
+/**
+ * \~chinese
+ * @brief 软件混音器
+ * @details 在浮点总线上混合所有声部并输出到音频输出，不依赖平台的音频接口。
+ * 可以手动调用 Render 渲染指定的帧数，也可以启动后台线程按实时速率渲染。
+ * 非 Windows 平台上，声部池默认使用全局混音器创建声部
+ */
+class KGE_API AudioMixer : public Singleton<AudioMixer>
+{
+    friend class MixerVoice;
+
+public:
+    /// \~chinese
+    /// @brief 创建混音器
+    /// @param sample_rate 输出采样率
+    /// @param channels 输出声道数，支持单声道和双声道
+    AudioMixer(uint32_t sample_rate = 44100, uint16_t channels = 2);
+
+    ~AudioMixer();
+
+    /// \~chinese
+    /// @brief 获取输出格式
+    const AudioFormat& GetFormat() const;
+
+    /// \~chinese
+    /// @brief 设置音频输出
+    /// @details 旧的输出将被关闭
+    bool SetSink(AudioSinkPtr sink);
+
+    /// \~chinese
+    /// @brief 获取音频输出
+    AudioSinkPtr GetSink() const;
+
+    /// \~chinese
+    /// @brief 获取主音量
+    float GetMasterVolume() const;
+
+    /// \~chinese
+    /// @brief 设置主音量
+    void SetMasterVolume(float volume);
+
+    /// \~chinese
+    /// @brief 创建声部
+    VoicePtr CreateVoice();
+
+    /// \~chinese
+    /// @brief 混合指定帧数的音频到缓冲
+    /// @param output 交错存储的浮点输出缓冲，大小至少为帧数乘以声道数
+    /// @param frames 帧数
+    void Mix(float* output, size_t frames);
+
+    /// \~chinese
+    /// @brief 混合指定帧数的音频并写入音频输出
+    void Render(size_t frames);
+
+    /// \~chinese
+    /// @brief 启动后台线程按实时速率渲染
+    /// @param period 每次渲染的时长
+    void Start(Duration period = 10);
+
+    /// \~chinese
+    /// @brief 停止后台渲染线程
+    void Stop();
+
+    /// \~chinese
+    /// @brief 获取正在播放的声部数量
+    uint32_t GetPlayingCount() const;
+
+private:
+    void AddVoice(MixerVoice* voice);
+
+    void RemoveVoice(MixerVoice* voice);
+
+    void MixLocked(float* output, size_t frames);
+
+private:
+    bool                running_;
+    float               master_volume_;
+    AudioFormat         format_;
+    AudioSinkPtr        sink_;
+    Vector<MixerVoice*> voices_;
+    Vector<float>       bus_;
+    Vector<float>       scratch_;
+    std::thread         thread_;
+    mutable std::mutex  mutex_;
+};
+
+/** @} */
+
+inline const AudioFormat& AudioMixer::GetFormat() const
+{
+    return format_;
+}
+
+inline AudioSinkPtr AudioMixer::GetSink() const
+{
+    return sink_;
+}
+
+inline float AudioMixer::GetMasterVolume() const
+{
+    return master_volume_;
+}
+
+}  // namespace audio
+}  // namespace kiwano
@@ -27,6 +27,142 @@ namespace kiwano
 {
 namespace audio
 {
+
+namespace
+{
+
+class XAudio2Voice : public Voice
+{
+public:
+    XAudio2Voice(IXAudio2* x_audio2)
+        : volume_(1.f)
+        , x_audio2_(x_audio2)
+        , voice_(nullptr)
+    {
+    }
+
+    virtual ~XAudio2Voice()
+    {
+        if (voice_)
+        {
+            voice_->DestroyVoice();
+            voice_ = nullptr;
+        }
+    }
+
+    bool Start(SoundBufferPtr buffer, int loop_count) override
+    {
+        const AudioFormat& format = buffer->GetFormat();
+
+        // A source voice can only play the format it was created with
+        if (voice_
+            && (format.sample_rate != format_.sample_rate || format.channels != format_.channels
+                || format.bits_per_sample != format_.bits_per_sample))
+        {
+            voice_->DestroyVoice();
+            voice_ = nullptr;
+        }
+
+        HRESULT hr = S_OK;
+        if (voice_)
+        {
+            voice_->Stop();
+            voice_->FlushSourceBuffers();
+        }
+        else
+        {
+            WAVEFORMATEX wave_format    = { 0 };
+            wave_format.wFormatTag      = WAVE_FORMAT_PCM;
+            wave_format.nChannels       = format.channels;
+            wave_format.nSamplesPerSec  = format.sample_rate;
+            wave_format.wBitsPerSample  = format.bits_per_sample;
+            wave_format.nBlockAlign     = WORD(format.GetBlockAlign());
+            wave_format.nAvgBytesPerSec = format.GetBytesPerSecond();
+
+            hr = x_audio2_->CreateSourceVoice(&voice_, &wave_format, 0, XAUDIO2_DEFAULT_FREQ_RATIO);
+            if (SUCCEEDED(hr))
+            {
+                format_ = format;
+                voice_->SetVolume(volume_);
+            }
+        }
+
+        if (SUCCEEDED(hr))
+        {
+            loop_count = (loop_count < 0) ? XAUDIO2_LOOP_INFINITE : std::min(loop_count, XAUDIO2_LOOP_INFINITE - 1);
+
+            XAUDIO2_BUFFER xbuffer = { 0 };
+            xbuffer.pAudioData     = buffer->GetData().GetBytes();
+            xbuffer.AudioBytes     = uint32_t(buffer->GetData().GetSize());
+            xbuffer.Flags          = XAUDIO2_END_OF_STREAM;
+            xbuffer.LoopCount      = static_cast<uint32_t>(loop_count);
+
+            hr = voice_->SubmitSourceBuffer(&xbuffer);
+        }
+
+        if (SUCCEEDED(hr))
+        {
+            hr = voice_->Start();
+        }
+
+        if (FAILED(hr))
+        {
+            KGE_ERRORF("Starting pooled voice failed with HRESULT of %08X", hr);
+            return false;
+        }
+
+        buffer_ = buffer;
+        return true;
+    }
+
+    void Stop() override
+    {
+        if (voice_)
+        {
+            voice_->Stop();
+            voice_->FlushSourceBuffers();
+        }
+    }
+
+    void Pause() override
+    {
+        if (voice_)
+            voice_->Stop();
+    }
+
+    void Resume() override
+    {
+        if (voice_)
+            voice_->Start();
+    }
+
+    void SetVolume(float volume) override
+    {
+        volume_ = volume;
+        if (voice_)
+            voice_->SetVolume(volume);
+    }
+
+    bool IsFinished() const override
+    {
+        if (!voice_)
+            return true;
+
+        XAUDIO2_VOICE_STATE state;
+        voice_->GetState(&state, XAUDIO2_VOICE_NOSAMPLESPLAYED);
+        return state.BuffersQueued == 0;
+    }
+
+private:
+    float                volume_;
+    AudioFormat          format_;
+    SoundBufferPtr       buffer_;
+    IXAudio2*            x_audio2_;
+    IXAudio2SourceVoice* voice_;
+};
+
+}  // namespace
+
 AudioModule::AudioModule()
     : x_audio2_(nullptr)
     , mastering_voice_(nullptr)
@@ -74,19 +210,24 @@ void AudioModule::DestroyModule()
 }
 
 bool AudioModule::CreateSound(Sound& sound, const Transcoder::Buffer& buffer)
+{
+    return CreateSound(sound, buffer.format, nullptr);
+}
+
+bool AudioModule::CreateSound(Sound& sound, const WAVEFORMATEX* format, IXAudio2VoiceCallback* callback)
 {
     KGE_ASSERT(x_audio2_ && "AudioModule hasn't been initialized!");
 
     HRESULT hr = S_OK;
 
-    if (buffer.format == nullptr)
+    if (format == nullptr)
         hr = E_INVALIDARG;
 
     if (SUCCEEDED(hr))
     {
         IXAudio2SourceVoice* voice = nullptr;
 
-        hr = x_audio2_->CreateSourceVoice(&voice, buffer.format, 0, XAUDIO2_DEFAULT_FREQ_RATIO);
+        hr = x_audio2_->CreateSourceVoice(&voice, format, 0, XAUDIO2_DEFAULT_FREQ_RATIO, callback);
 
         if (SUCCEEDED(hr))
         {
@@ -109,6 +250,13 @@ bool AudioModule::CreateSound(Sound& sound, const Transcoder::Buffer& buffer)
     return true;
 }
 
+VoicePtr AudioModule::CreateVoice()
+{
+    KGE_ASSERT(x_audio2_ && "AudioModule hasn't been initialized!");
+
+    return MakePtr<XAudio2Voice>(x_audio2_);
+}
+
 void AudioModule::Open()
 {
     KGE_ASSERT(x_audio2_ && "AudioModule hasn't been initialized!");
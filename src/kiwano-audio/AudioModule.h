@@ -21,6 +21,7 @@
 #pragma once
 #include <kiwano-audio/Sound.h>
 #include <kiwano-audio/Transcoder.h>
+#include <kiwano-audio/VoicePool.h>
 #include <kiwano/core/Common.h>
 #include <kiwano/base/Module.h>
 #include <xaudio2.h>
@@ -32,7 +33,7 @@ namespace audio
 
 /**
  * \~chinese
- * \defgroup Audio Ƶģ
+ * \defgroup Audio 音频模块
  */
 
 /**
@@ -42,7 +43,7 @@ namespace audio
 
 /**
  * \~chinese
- * @brief Ƶģ
+ * @brief 音频模块
  */
 class KGE_API AudioModule
     : public Singleton<AudioModule>
@@ -52,17 +53,28 @@ class KGE_API AudioModule
 
 public:
     /// \~chinese
-    /// @brief Ƶ豸
+    /// @brief 开启音频设备
     void Open();
 
     /// \~chinese
-    /// @brief رƵ豸
+    /// @brief 关闭音频设备
     void Close();
 
     /// \~chinese
-    /// @brief ӽݻдƵ
+    /// @brief 从解码器数据缓冲中创建音频对象
     bool CreateSound(Sound& sound, const Transcoder::Buffer& buffer);
 
+    /// \~chinese
+    /// @brief 根据音频格式创建音频对象
+    /// @param sound 音频对象
+    /// @param format 音频格式
+    /// @param callback 音频缓冲回调，流式播放时用于归还和补充缓冲
+    bool CreateSound(Sound& sound, const WAVEFORMATEX* format, IXAudio2VoiceCallback* callback = nullptr);
+
+    /// \~chinese
+    /// @brief 创建用于声部池的声部
+    VoicePtr CreateVoice();
+
 public:
     void SetupModule() override;
 
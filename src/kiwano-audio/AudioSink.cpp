@@ -0,0 +1,153 @@
+// Copyright (c) 2016-2018 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <kiwano-audio/AudioSink.h>
+#include <kiwano-audio/SampleConverter.h>
+#include <kiwano/utils/Logger.h>
+
+namespace kiwano
+{
+namespace audio
+{
+
+namespace
+{
+
+inline void WriteUInt16(std::ofstream& ofs, uint16_t value)
+{
+    const char bytes[2] = { char(value & 0xFF), char(value >> 8) };
+    ofs.write(bytes, 2);
+}
+
+inline void WriteUInt32(std::ofstream& ofs, uint32_t value)
+{
+    const char bytes[4] = { char(value & 0xFF), char((value >> 8) & 0xFF), char((value >> 16) & 0xFF),
+                            char(value >> 24) };
+    ofs.write(bytes, 4);
+}
+
+}  // namespace
+
+NullAudioSink::NullAudioSink()
+    : channels_(0)
+    , frames_written_(0)
+    , peak_(0.f)
+{
+}
+
+bool NullAudioSink::Open(const AudioFormat& format)
+{
+    channels_       = format.channels;
+    frames_written_ = 0;
+    peak_           = 0.f;
+    return true;
+}
+
+void NullAudioSink::Write(const float* samples, size_t frames)
+{
+    const size_t count = frames * channels_;
+    for (size_t i = 0; i < count; ++i)
+    {
+        peak_ = std::max(peak_, std::abs(samples[i]));
+    }
+    frames_written_ += frames;
+}
+
+void NullAudioSink::Close() {}
+
+WaveFileSink::WaveFileSink(const String& file_path)
+    : file_path_(file_path)
+    , frames_written_(0)
+{
+}
+
+WaveFileSink::~WaveFileSink()
+{
+    Close();
+}
+
+bool WaveFileSink::Open(const AudioFormat& format)
+{
+    Close();
+
+    ofs_.open(file_path_.c_str(), std::ios::binary | std::ios::trunc);
+    if (!ofs_.is_open())
+    {
+        KGE_ERRORF("Open wave file '%s' failed", file_path_.c_str());
+        return false;
+    }
+
+    format_                 = format;
+    format_.bits_per_sample = 16;
+    frames_written_         = 0;
+
+    // The sizes are patched when the file is closed
+    WriteHeader();
+    return ofs_.good();
+}
+
+void WaveFileSink::Write(const float* samples, size_t frames)
+{
+    if (!ofs_.is_open())
+        return;
+
+    const size_t count = frames * format_.channels;
+    samples_.resize(count);
+    ConvertFloatToInt16(samples, samples_.data(), count);
+
+    // Samples are little endian on every supported platform
+    ofs_.write(reinterpret_cast<const char*>(samples_.data()), std::streamsize(count * sizeof(int16_t)));
+
+    frames_written_ += frames;
+}
+
+void WaveFileSink::Close()
+{
+    if (!ofs_.is_open())
+        return;
+
+    ofs_.seekp(0);
+    WriteHeader();
+    ofs_.close();
+}
+
+void WaveFileSink::WriteHeader()
+{
+    const uint32_t data_size = uint32_t(std::min<uint64_t>(frames_written_ * format_.GetBlockAlign(), 0xFFFFFFFF - 36));
+
+    ofs_.write("RIFF", 4);
+    WriteUInt32(ofs_, 36 + data_size);
+    ofs_.write("WAVE", 4);
+
+    ofs_.write("fmt ", 4);
+    WriteUInt32(ofs_, 16);
+    WriteUInt16(ofs_, 1);  // WAVE_FORMAT_PCM
+    WriteUInt16(ofs_, format_.channels);
+    WriteUInt32(ofs_, format_.sample_rate);
+    WriteUInt32(ofs_, format_.GetBytesPerSecond());
+    WriteUInt16(ofs_, uint16_t(format_.GetBlockAlign()));
+    WriteUInt16(ofs_, format_.bits_per_sample);
+
+    ofs_.write("data", 4);
+    WriteUInt32(ofs_, data_size);
+}
+
+}  // namespace audio
+}  // namespace kiwano
@@ -0,0 +1,149 @@
+// Copyright (c) 2016-2018 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <fstream>
+#include <kiwano-audio/AudioDecoder.h>
+
+namespace kiwano
+{
+namespace audio
+{
+
+KGE_DECLARE_SMART_PTR(AudioSink);
+KGE_DECLARE_SMART_PTR(NullAudioSink);
+KGE_DECLARE_SMART_PTR(WaveFileSink);
+
+/**
+ * \addtogroup Audio
+ * @{
+ */
+
+/**
+ * \~chinese
+ * @brief 音频输出
+ * @details 接收软件混音器输出的交错存储的浮点采样
+ */
+class KGE_API AudioSink : public ObjectBase
+{
+public:
+    /// \~chinese
+    /// @brief 打开输出
+    /// @param format 混音器的输出格式
+    virtual bool Open(const AudioFormat& format) = 0;
+
+    /// \~chinese
+    /// @brief 写入音频帧
+    /// @param samples 交错存储的浮点采样
+    /// @param frames 帧数
+    virtual void Write(const float* samples, size_t frames) = 0;
+
+    /// \~chinese
+    /// @brief 关闭输出
+    virtual void Close() = 0;
+};
+
+/**
+ * \~chinese
+ * @brief 空音频输出
+ * @details 丢弃所有数据，只记录写入的帧数和峰值，用于无音频设备的环境和性能测试
+ */
+class KGE_API NullAudioSink : public AudioSink
+{
+public:
+    NullAudioSink();
+
+    bool Open(const AudioFormat& format) override;
+
+    void Write(const float* samples, size_t frames) override;
+
+    void Close() override;
+
+    /// \~chinese
+    /// @brief 获取写入的帧数
+    uint64_t GetFramesWritten() const;
+
+    /// \~chinese
+    /// @brief 获取写入的采样的最大绝对值
+    float GetPeak() const;
+
+private:
+    uint16_t channels_;
+    uint64_t frames_written_;
+    float    peak_;
+};
+
+/**
+ * \~chinese
+ * @brief WAV 文件音频输出
+ * @details 将混音结果保存为 16 位 PCM 的 WAV 文件
+ */
+class KGE_API WaveFileSink : public AudioSink
+{
+public:
+    /// \~chinese
+    /// @brief 创建 WAV 文件音频输出
+    /// @param file_path 文件路径
+    WaveFileSink(const String& file_path);
+
+    virtual ~WaveFileSink();
+
+    bool Open(const AudioFormat& format) override;
+
+    void Write(const float* samples, size_t frames) override;
+
+    /// \~chinese
+    /// @brief 写入文件头中的数据大小并关闭文件
+    void Close() override;
+
+    /// \~chinese
+    /// @brief 获取写入的帧数
+    uint64_t GetFramesWritten() const;
+
+private:
+    void WriteHeader();
+
+private:
+    String          file_path_;
+    AudioFormat     format_;
+    uint64_t        frames_written_;
+    Vector<int16_t> samples_;
+    std::ofstream   ofs_;
+};
+
+/** @} */
+
+inline uint64_t NullAudioSink::GetFramesWritten() const
+{
+    return frames_written_;
+}
+
+inline float NullAudioSink::GetPeak() const
+{
+    return peak_;
+}
+
+inline uint64_t WaveFileSink::GetFramesWritten() const
+{
+    return frames_written_;
+}
+
+}  // namespace audio
+}  // namespace kiwano
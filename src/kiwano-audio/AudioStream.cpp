@@ -0,0 +1,289 @@
+// Copyright (c) 2016-2018 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <kiwano-audio/AudioStream.h>
+
+namespace kiwano
+{
+namespace audio
+{
+
+AudioStream::AudioStream(AudioDecoderPtr decoder, Duration buffer_duration, uint32_t buffer_count)
+    : running_(false)
+    , quit_(false)
+    , finished_(false)
+    , seek_pending_(false)
+    , loop_count_(0)
+    , loops_left_(0)
+    , generation_(0)
+    , underruns_(0)
+    , frames_per_buffer_(0)
+    , seek_frame_(0)
+    , decoder_(decoder)
+{
+    KGE_ASSERT(decoder_ && "AudioStream requires a decoder");
+
+    const AudioFormat& format = decoder_->GetFormat();
+
+    int64_t frames     = int64_t(format.sample_rate) * buffer_duration.GetMilliseconds() / 1000;
+    frames_per_buffer_ = uint32_t(std::max<int64_t>(frames, 1));
+
+    slots_.resize(std::max(buffer_count, 2u));
+    for (auto& slot : slots_)
+    {
+        slot.memory.resize(size_t(frames_per_buffer_) * format.GetBlockAlign());
+        slot.state  = SlotState::Free;
+        slot.buffer = Buffer{ slot.memory.data(), 0, 0, false };
+    }
+}
+
+AudioStream::~AudioStream()
+{
+    Stop();
+}
+
+void AudioStream::SetLoopCount(int loop_count)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    loop_count_ = loop_count;
+    loops_left_ = loop_count;
+}
+
+void AudioStream::Start()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_)
+        return;
+
+    quit_    = false;
+    running_ = true;
+    worker_  = std::thread(&AudioStream::WorkerMain, this);
+}
+
+void AudioStream::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_)
+            return;
+        quit_ = true;
+    }
+    cond_.notify_all();
+
+    // Must not be called from the ready callback, which runs on the worker thread
+    worker_.join();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = false;
+    cond_.notify_all();
+}
+
+void AudioStream::Seek(uint64_t frame)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Buffers being decoded are dropped by the worker when it sees the new generation
+    ++generation_;
+    for (size_t index : ready_)
+    {
+        slots_[index].state = SlotState::Free;
+    }
+    ready_.clear();
+
+    seek_frame_   = frame;
+    seek_pending_ = true;
+    finished_     = false;
+    loops_left_   = loop_count_;
+    cond_.notify_all();
+}
+
+void AudioStream::Prefill()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    cond_.wait(lock, [this]() {
+        if (!running_ || finished_)
+            return true;
+        if (seek_pending_)
+            return false;
+        for (const auto& slot : slots_)
+        {
+            if (slot.state == SlotState::Free || slot.state == SlotState::Decoding)
+                return false;
+        }
+        return true;
+    });
+}
+
+const AudioStream::Buffer* AudioStream::Acquire()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (ready_.empty())
+    {
+        // Only count it when nothing is left to play
+        if (!finished_ && std::none_of(slots_.begin(), slots_.end(),
+                                       [](const Slot& slot) { return slot.state == SlotState::InUse; }))
+        {
+            ++underruns_;
+        }
+        return nullptr;
+    }
+
+    size_t index = ready_.front();
+    ready_.pop_front();
+
+    slots_[index].state = SlotState::InUse;
+    return &slots_[index].buffer;
+}
+
+void AudioStream::Release(const Buffer* buffer)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& slot : slots_)
+    {
+        if (&slot.buffer == buffer)
+        {
+            KGE_ASSERT(slot.state == SlotState::InUse && "Buffer has not been acquired");
+            slot.state = SlotState::Free;
+            break;
+        }
+    }
+    cond_.notify_all();
+}
+
+void AudioStream::SetReadyCallback(Function<void()> callback)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    ready_callback_ = callback;
+}
+
+bool AudioStream::IsEndOfStream() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return finished_ && ready_.empty();
+}
+
+uint32_t AudioStream::GetUnderrunCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return underruns_;
+}
+
+void AudioStream::WorkerMain()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        auto free_slot = slots_.end();
+        cond_.wait(lock, [&]() {
+            if (quit_ || seek_pending_)
+                return true;
+            if (finished_)
+                return false;
+            free_slot = std::find_if(slots_.begin(), slots_.end(),
+                                     [](const Slot& slot) { return slot.state == SlotState::Free; });
+            return free_slot != slots_.end();
+        });
+
+        if (quit_)
+            break;
+
+        if (seek_pending_)
+        {
+            // The decoder is only used on this thread
+            seek_pending_ = false;
+            decoder_->Seek(seek_frame_);
+            continue;
+        }
+
+        Slot& slot = *free_slot;
+        slot.state = SlotState::Decoding;
+
+        const uint32_t generation = generation_;
+
+        int loops = loops_left_;
+        lock.unlock();
+
+        bool end = Decode(slot.buffer, loops);
+
+        lock.lock();
+        if (generation != generation_)
+        {
+            // A seek happened while decoding
+            slot.state = SlotState::Free;
+            continue;
+        }
+
+        loops_left_               = loops;
+        finished_                 = end;
+        slot.buffer.end_of_stream = end;
+        slot.state                = SlotState::Ready;
+        ready_.push_back(size_t(&slot - slots_.data()));
+        cond_.notify_all();
+
+        if (ready_callback_)
+        {
+            auto callback = ready_callback_;
+            lock.unlock();
+            callback();
+            lock.lock();
+        }
+    }
+}
+
+bool AudioStream::Decode(Buffer& buffer, int& loops)
+{
+    const uint32_t block_align = decoder_->GetFormat().GetBlockAlign();
+
+    buffer.start_frame = decoder_->GetPosition();
+
+    bool   end        = false;
+    size_t frames     = 0;
+    size_t since_seek = 0;
+    while (frames < frames_per_buffer_)
+    {
+        size_t count = decoder_->Read(buffer.data + frames * block_align, frames_per_buffer_ - frames);
+        if (count)
+        {
+            frames += count;
+            since_seek += count;
+            continue;
+        }
+
+        // An empty track can not loop
+        if (loops != 0 && (since_seek || (frames == 0 && buffer.start_frame != 0)))
+        {
+            if (loops > 0)
+                --loops;
+
+            decoder_->Seek(0);
+            since_seek = 0;
+            continue;
+        }
+
+        end = true;
+        break;
+    }
+
+    buffer.size = uint32_t(frames * block_align);
+    return end;
+}
+
+}  // namespace audio
+}  // namespace kiwano
@@ -0,0 +1,193 @@
+// Copyright (c) 2016-2018 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <kiwano-audio/AudioDecoder.h>
+
+namespace kiwano
+{
+namespace audio
+{
+
+KGE_DECLARE_SMART_PTR(AudioStream);
+
+/**
+ * \addtogroup Audio
+ * @{
+ */
+
+/**
+ * \~chinese
+ * @brief 音频流
+ * @details 后台线程将音频分块解码到固定数量的缓冲中，播放端按顺序取出缓冲播放，用完后归还给音频流重新填充。
+ * 内存占用只取决于缓冲的数量和大小，与音频时长无关
+ */
+class KGE_API AudioStream : public ObjectBase
+{
+public:
+    /// \~chinese
+    /// @brief 音频流缓冲
+    struct Buffer
+    {
+        uint8_t* data;           ///< 音频数据
+        uint32_t size;           ///< 音频数据大小，最后一个缓冲可能为零
+        uint64_t start_frame;    ///< 缓冲第一帧在音频中的位置
+        bool     end_of_stream;  ///< 是否是音频的最后一个缓冲
+    };
+
+    /// \~chinese
+    /// @brief 创建音频流
+    /// @param decoder 音频解码器
+    /// @param buffer_duration 每个缓冲的时长
+    /// @param buffer_count 缓冲数量，最少两个
+    AudioStream(AudioDecoderPtr decoder, Duration buffer_duration = 250, uint32_t buffer_count = 4);
+
+    virtual ~AudioStream();
+
+    /// \~chinese
+    /// @brief 获取音频解码器
+    AudioDecoderPtr GetDecoder() const;
+
+    /// \~chinese
+    /// @brief 获取音频格式
+    const AudioFormat& GetFormat() const;
+
+    /// \~chinese
+    /// @brief 获取缓冲数量
+    uint32_t GetBufferCount() const;
+
+    /// \~chinese
+    /// @brief 获取每个缓冲的大小（字节）
+    uint32_t GetBufferSize() const;
+
+    /// \~chinese
+    /// @brief 设置循环次数
+    /// @param loop_count 解码到末尾后从头重复的次数，设置 -1 为无限循环
+    void SetLoopCount(int loop_count);
+
+    /// \~chinese
+    /// @brief 启动后台解码线程
+    void Start();
+
+    /// \~chinese
+    /// @brief 停止后台解码线程
+    /// @details 已解码的缓冲仍然可以取出
+    void Stop();
+
+    /// \~chinese
+    /// @brief 跳转到指定位置
+    /// @details 丢弃已解码但还未取出的缓冲，已取出的缓冲不受影响
+    /// @param frame 帧位置
+    void Seek(uint64_t frame);
+
+    /// \~chinese
+    /// @brief 等待所有缓冲填充完毕或解码到末尾
+    void Prefill();
+
+    /// \~chinese
+    /// @brief 取出下一个已解码的缓冲
+    /// @return 没有已解码的缓冲时返回空指针
+    const Buffer* Acquire();
+
+    /// \~chinese
+    /// @brief 归还取出的缓冲
+    void Release(const Buffer* buffer);
+
+    /// \~chinese
+    /// @brief 设置缓冲就绪的回调函数
+    /// @details 回调函数在后台线程中调用
+    void SetReadyCallback(Function<void()> callback);
+
+    /// \~chinese
+    /// @brief 是否已经解码到末尾，并且所有缓冲都已取出
+    bool IsEndOfStream() const;
+
+    /// \~chinese
+    /// @brief 获取缓冲不足的次数
+    /// @details 在音频结束前取出缓冲但没有已解码的缓冲时计数
+    uint32_t GetUnderrunCount() const;
+
+private:
+    void WorkerMain();
+
+    bool Decode(Buffer& buffer, int& loops);
+
+private:
+    enum class SlotState
+    {
+        Free,
+        Decoding,
+        Ready,
+        InUse,
+    };
+
+    struct Slot
+    {
+        Buffer          buffer;
+        SlotState       state;
+        Vector<uint8_t> memory;
+    };
+
+    bool                    running_;
+    bool                    quit_;
+    bool                    finished_;
+    bool                    seek_pending_;
+    int                     loop_count_;
+    int                     loops_left_;
+    uint32_t                generation_;
+    uint32_t                underruns_;
+    uint32_t                frames_per_buffer_;
+    uint64_t                seek_frame_;
+    AudioDecoderPtr         decoder_;
+    Vector<Slot>            slots_;
+    Deque<size_t>           ready_;
+    Function<void()>        ready_callback_;
+    std::thread             worker_;
+    mutable std::mutex      mutex_;
+    std::condition_variable cond_;
+};
+
+/** @} */
+
+inline AudioDecoderPtr AudioStream::GetDecoder() const
+{
+    return decoder_;
+}
+
+inline const AudioFormat& AudioStream::GetFormat() const
+{
+    return decoder_->GetFormat();
+}
+
+inline uint32_t AudioStream::GetBufferCount() const
+{
+    return uint32_t(slots_.size());
+}
+
+inline uint32_t AudioStream::GetBufferSize() const
+{
+    return frames_per_buffer_ * GetFormat().GetBlockAlign();
+}
+
+}  // namespace audio
+}  // namespace kiwano
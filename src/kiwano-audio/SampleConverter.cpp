@@ -0,0 +1,112 @@
+// Copyright (c) 2016-2018 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <kiwano-audio/SampleConverter.h>
+#include <cmath>
+
+#if defined(KGE_SIMD_SSE2)
+#include <emmintrin.h>
+#endif
+
+namespace kiwano
+{
+namespace audio
+{
+
+namespace
+{
+
+const float INT16_TO_FLOAT = 1.f / 32768.f;
+const float FLOAT_TO_INT16 = 32768.f;
+
+}  // namespace
+
+void ConvertInt16ToFloat(const int16_t* input, float* output, size_t count)
+{
+    size_t i = 0;
+
+#if defined(KGE_SIMD_SSE2)
+    const __m128 scale = _mm_set1_ps(INT16_TO_FLOAT);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+        // Sign extend to 32 bits by placing each sample in the high half and shifting back
+        __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16);
+        __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16);
+
+        _mm_storeu_ps(output + i, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+        _mm_storeu_ps(output + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        output[i] = float(input[i]) * INT16_TO_FLOAT;
+    }
+}
+
+void ConvertFloatToInt16(const float* input, int16_t* output, size_t count)
+{
+    size_t i = 0;
+
+#if defined(KGE_SIMD_SSE2)
+    const __m128 scale = _mm_set1_ps(FLOAT_TO_INT16);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        // Round to nearest, the saturating pack clamps to the int16 range
+        __m128i lo = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(input + i), scale));
+        __m128i hi = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(input + i + 4), scale));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packs_epi32(lo, hi));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        float sample = std::nearbyint(input[i] * FLOAT_TO_INT16);
+        output[i]    = int16_t(std::min(std::max(sample, -32768.f), 32767.f));
+    }
+}
+
+void MixSamples(const float* input, float* output, size_t count, float left_gain, float right_gain)
+{
+    size_t i = 0;
+
+#if defined(KGE_SIMD_SSE2)
+    const __m128 gains = _mm_setr_ps(left_gain, right_gain, left_gain, right_gain);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 mixed = _mm_add_ps(_mm_loadu_ps(output + i), _mm_mul_ps(_mm_loadu_ps(input + i), gains));
+        _mm_storeu_ps(output + i, mixed);
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        output[i] += input[i] * ((i & 1) ? right_gain : left_gain);
+    }
+}
+
+}  // namespace audio
+}  // namespace kiwano
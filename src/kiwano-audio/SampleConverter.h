@@ -0,0 +1,62 @@
+// Copyright (c) 2016-2018 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <kiwano/core/Common.h>
+
+namespace kiwano
+{
+namespace audio
+{
+
+/**
+ * \addtogroup Audio
+ * @{
+ */
+
+/// \~chinese
+/// @brief 将 16 位整数采样转换为 [-1, 1) 范围的浮点采样
+/// @param input 整数采样
+/// @param output 浮点采样
+/// @param count 采样数量
+KGE_API void ConvertInt16ToFloat(const int16_t* input, float* output, size_t count);
+
+/// \~chinese
+/// @brief 将浮点采样转换为 16 位整数采样
+/// @details 超出 [-1, 1) 范围的采样被截断
+/// @param input 浮点采样
+/// @param output 整数采样
+/// @param count 采样数量
+KGE_API void ConvertFloatToInt16(const float* input, int16_t* output, size_t count);
+
+/// \~chinese
+/// @brief 将交错存储的双声道浮点采样乘以增益后累加到输出
+/// @details 偶数位置的采样使用左声道增益，奇数位置的采样使用右声道增益，单声道数据的两个增益应相同
+/// @param input 输入采样
+/// @param output 输出采样
+/// @param count 采样数量
+/// @param left_gain 左声道增益
+/// @param right_gain 右声道增益
+KGE_API void MixSamples(const float* input, float* output, size_t count, float left_gain, float right_gain);
+
+/** @} */
+
+}  // namespace audio
+}  // namespace kiwano
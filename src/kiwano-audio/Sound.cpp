@@ -27,22 +27,55 @@ namespace kiwano
 {
 namespace audio
 {
-Sound::Sound(const String& file_path)
+
+class Sound::StreamingCallback : public IXAudio2VoiceCallback
+{
+public:
+    StreamingCallback(Sound* sound)
+        : sound_(sound)
+    {
+    }
+
+    void STDMETHODCALLTYPE OnBufferEnd(void* context) override
+    {
+        sound_->OnStreamBufferEnd(static_cast<const AudioStream::Buffer*>(context));
+    }
+
+    void STDMETHODCALLTYPE OnVoiceProcessingPassStart(UINT32 bytes_required) override {}
+
+    void STDMETHODCALLTYPE OnVoiceProcessingPassEnd() override {}
+
+    void STDMETHODCALLTYPE OnStreamEnd() override {}
+
+    void STDMETHODCALLTYPE OnBufferStart(void* context) override {}
+
+    void STDMETHODCALLTYPE OnLoopEnd(void* context) override {}
+
+    void STDMETHODCALLTYPE OnVoiceError(void* context, HRESULT error) override {}
+
+private:
+    Sound* sound_;
+};
+
+Sound::Sound(const String& file_path, bool streaming)
     : Sound()
 {
-    Load(file_path);
+    Load(file_path, streaming);
 }
 
-Sound::Sound(const Resource& res)
+Sound::Sound(const Resource& res, bool streaming)
     : Sound()
 {
-    Load(res);
+    Load(res, streaming);
 }
 
 Sound::Sound()
     : opened_(false)
     , playing_(false)
+    , stream_active_(false)
+    , loop_count_(0)
     , voice_(nullptr)
+    , callback_(nullptr)
 {
 }
 
@@ -51,7 +84,7 @@ Sound::~Sound()
     Close();
 }
 
-bool Sound::Load(const String& file_path)
+bool Sound::Load(const String& file_path, bool streaming)
 {
     if (!FileSystem::GetInstance().IsFileExists(file_path))
     {
@@ -66,6 +99,17 @@ bool Sound::Load(const String& file_path)
 
     String full_path = FileSystem::GetInstance().GetFullPathForFile(file_path);
 
+    if (streaming)
+    {
+        AudioDecoderPtr decoder = AudioDecoder::Create(full_path);
+        if (!decoder)
+        {
+            KGE_ERRORF("Load media file '%s' for streaming failed", file_path.c_str());
+            return false;
+        }
+        return OpenStream(decoder);
+    }
+
     HRESULT hr = transcoder_.LoadMediaFile(full_path);
     if (FAILED(hr))
     {
@@ -83,17 +127,33 @@ bool Sound::Load(const String& file_path)
     return true;
 }
 
-bool Sound::Load(const Resource& res)
+bool Sound::Load(const Resource& res, bool streaming)
+{
+    return Load(res.GetData(), streaming);
+}
+
+bool Sound::Load(const BinaryData& data, bool streaming)
 {
     if (opened_)
     {
         Close();
     }
 
-    HRESULT hr = transcoder_.LoadMediaResource(res);
+    if (streaming)
+    {
+        AudioDecoderPtr decoder = AudioDecoder::Create(data);
+        if (!decoder)
+        {
+            KGE_ERRORF("Load media data for streaming failed");
+            return false;
+        }
+        return OpenStream(decoder);
+    }
+
+    HRESULT hr = transcoder_.LoadMediaData(data);
     if (FAILED(hr))
     {
-        KGE_ERRORF("Load media resource failed with HRESULT of %08X", hr);
+        KGE_ERRORF("Load media data failed with HRESULT of %08X", hr);
         return false;
     }
 
@@ -122,6 +182,24 @@ void Sound::Play(int loop_count)
 
     KGE_ASSERT(voice_ != nullptr && "IXAudio2SourceVoice* is NULL");
 
+    if (stream_)
+    {
+        StopStream();
+
+        stream_->SetLoopCount(loop_count);
+        stream_->Seek(0);
+        StartStream();
+
+        HRESULT hr = voice_->Start();
+        if (FAILED(hr))
+        {
+            KGE_ERRORF("Starting streaming voice failed with HRESULT of %08X", hr);
+        }
+
+        playing_ = SUCCEEDED(hr);
+        return;
+    }
+
     // if sound stream is not empty, stop() will clear it
     XAUDIO2_VOICE_STATE state;
     voice_->GetState(&state);
@@ -129,7 +207,8 @@ void Sound::Play(int loop_count)
         Stop();
 
     // clamp loop count
-    loop_count = (loop_count < 0) ? XAUDIO2_LOOP_INFINITE : std::min(loop_count, XAUDIO2_LOOP_INFINITE - 1);
+    loop_count  = (loop_count < 0) ? XAUDIO2_LOOP_INFINITE : std::min(loop_count, XAUDIO2_LOOP_INFINITE - 1);
+    loop_count_ = loop_count;
 
     auto wave_buffer = transcoder_.GetBuffer();
 
@@ -173,6 +252,13 @@ void Sound::Stop()
 {
     KGE_ASSERT(voice_ != nullptr && "IXAudio2SourceVoice* is NULL");
 
+    if (stream_)
+    {
+        StopStream();
+        playing_ = false;
+        return;
+    }
+
     HRESULT hr = voice_->Stop();
 
     if (SUCCEEDED(hr))
@@ -185,8 +271,73 @@ void Sound::Stop()
         playing_ = false;
 }
 
+void Sound::Seek(Duration position)
+{
+    if (!opened_)
+    {
+        KGE_ERRORF("Sound must be opened first!");
+        return;
+    }
+
+    KGE_ASSERT(voice_ != nullptr && "IXAudio2SourceVoice* is NULL");
+
+    const int64_t milliseconds = std::max<int64_t>(position.GetMilliseconds(), 0);
+
+    if (stream_)
+    {
+        uint64_t frame = uint64_t(milliseconds) * stream_->GetFormat().sample_rate / 1000;
+
+        StopStream();
+        stream_->Seek(frame);
+        StartStream();
+
+        if (playing_)
+            voice_->Start();
+        return;
+    }
+
+    auto wave_buffer = transcoder_.GetBuffer();
+    if (!wave_buffer.format || !wave_buffer.format->nBlockAlign)
+        return;
+
+    const uint32_t frames_count = wave_buffer.size / wave_buffer.format->nBlockAlign;
+    const uint64_t frame        = uint64_t(milliseconds) * wave_buffer.format->nSamplesPerSec / 1000;
+    if (frame >= frames_count)
+    {
+        Stop();
+        return;
+    }
+
+    voice_->Stop();
+    voice_->FlushSourceBuffers();
+
+    XAUDIO2_BUFFER buffer = { 0 };
+    buffer.pAudioData     = wave_buffer.data;
+    buffer.Flags          = XAUDIO2_END_OF_STREAM;
+    buffer.AudioBytes     = wave_buffer.size;
+    buffer.PlayBegin      = static_cast<uint32_t>(frame);
+    buffer.LoopCount      = static_cast<uint32_t>(loop_count_);
+
+    HRESULT hr = voice_->SubmitSourceBuffer(&buffer);
+    if (SUCCEEDED(hr) && playing_)
+    {
+        hr = voice_->Start();
+    }
+
+    if (FAILED(hr))
+    {
+        KGE_ERRORF("Seeking sound failed with HRESULT of %08X", hr);
+        playing_ = false;
+    }
+}
+
 void Sound::Close()
 {
+    if (stream_)
+    {
+        StopStream();
+    }
+
     if (voice_)
     {
         voice_->Stop();
@@ -195,6 +346,14 @@ void Sound::Close()
         voice_ = nullptr;
     }
 
+    // callbacks have finished after the voice is destroyed
+    if (callback_)
+    {
+        delete callback_;
+        callback_ = nullptr;
+    }
+
+    stream_ = nullptr;
     transcoder_.ClearBuffer();
 
     opened_  = false;
@@ -214,6 +373,10 @@ bool Sound::IsPlaying() const
 
         if (buffers_queued && playing_)
             return true;
+
+        // a stream may be waiting for the next buffer
+        if (stream_ && playing_ && !stream_->IsEndOfStream())
+            return true;
     }
     return false;
 }
@@ -234,5 +397,104 @@ void Sound::SetVolume(float volume)
     volume = std::min(std::max(volume, -224.f), 224.f);
     voice_->SetVolume(volume);
 }
+
+bool Sound::OpenStream(AudioDecoderPtr decoder)
+{
+    const AudioFormat& format = decoder->GetFormat();
+
+    WAVEFORMATEX wave_format    = { 0 };
+    wave_format.wFormatTag      = WAVE_FORMAT_PCM;
+    wave_format.nChannels       = format.channels;
+    wave_format.nSamplesPerSec  = format.sample_rate;
+    wave_format.wBitsPerSample  = format.bits_per_sample;
+    wave_format.nBlockAlign     = WORD(format.GetBlockAlign());
+    wave_format.nAvgBytesPerSec = format.GetBytesPerSecond();
+
+    stream_   = MakePtr<AudioStream>(decoder);
+    callback_ = new (std::nothrow) StreamingCallback(this);
+
+    if (!stream_ || !callback_ || !AudioModule::GetInstance().CreateSound(*this, &wave_format, callback_))
+    {
+        Close();
+        return false;
+    }
+
+    stream_->SetReadyCallback(Closure(this, &Sound::SubmitStreamBuffers));
+
+    opened_ = true;
+    return true;
+}
+
+void Sound::StartStream()
+{
+    stream_->Start();
+    stream_->Prefill();
+
+    {
+        std::lock_guard<std::mutex> lock(stream_mutex_);
+        stream_active_ = true;
+    }
+    SubmitStreamBuffers();
+}
+
+void Sound::StopStream()
+{
+    {
+        std::lock_guard<std::mutex> lock(stream_mutex_);
+        stream_active_ = false;
+    }
+
+    stream_->Stop();
+
+    if (voice_)
+    {
+        // the flushed buffers are released in OnBufferEnd
+        voice_->Stop();
+        voice_->FlushSourceBuffers();
+    }
+}
+
+void Sound::SubmitStreamBuffers()
+{
+    std::lock_guard<std::mutex> lock(stream_mutex_);
+    if (!stream_active_ || !voice_)
+        return;
+
+    while (const AudioStream::Buffer* stream_buffer = stream_->Acquire())
+    {
+        if (stream_buffer->size == 0)
+        {
+            bool end_of_stream = stream_buffer->end_of_stream;
+            stream_->Release(stream_buffer);
+            if (end_of_stream)
+                voice_->Discontinuity();
+            continue;
+        }
+
+        XAUDIO2_BUFFER buffer = { 0 };
+        buffer.pAudioData     = stream_buffer->data;
+        buffer.AudioBytes     = stream_buffer->size;
+        buffer.Flags          = stream_buffer->end_of_stream ? XAUDIO2_END_OF_STREAM : 0;
+        buffer.pContext       = const_cast<AudioStream::Buffer*>(stream_buffer);
+
+        HRESULT hr = voice_->SubmitSourceBuffer(&buffer);
+        if (FAILED(hr))
+        {
+            KGE_ERRORF("Submitting stream buffer failed with HRESULT of %08X", hr);
+            stream_->Release(stream_buffer);
+            break;
+        }
+    }
+}
+
+void Sound::OnStreamBufferEnd(const AudioStream::Buffer* buffer)
+{
+    if (stream_ && buffer)
+    {
+        stream_->Release(buffer);
+        SubmitStreamBuffers();
+    }
+}
+
 }  // namespace audio
 }  // namespace kiwano
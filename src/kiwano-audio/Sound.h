@@ -19,7 +19,9 @@
 // THE SOFTWARE.
 
 #pragma once
+#include <mutex>
 #include <kiwano-audio/Transcoder.h>
+#include <kiwano-audio/AudioStream.h>
 #include <kiwano/core/Resource.h>
 #include <kiwano/base/ObjectBase.h>
 #include <kiwano/platform/win32/ComPtr.hpp>
@@ -40,7 +42,7 @@ KGE_DECLARE_SMART_PTR(Sound);
 
 /**
  * \~chinese
- * @brief Ƶ
+ * @brief 音频对象
  */
 class KGE_API Sound : public ObjectBase
 {
@@ -48,65 +50,85 @@ class KGE_API Sound : public ObjectBase
 
 public:
     /// \~chinese
-    /// @brief Ƶ
-    /// @param res Ƶļ·
-    Sound(const String& file_path);
+    /// @brief 创建音频对象
+    /// @param res 本地音频文件路径
+    /// @param streaming 是否流式播放
+    Sound(const String& file_path, bool streaming = false);
 
     /// \~chinese
-    /// @brief Ƶ
-    /// @param res ƵԴ
-    Sound(const Resource& res);
+    /// @brief 创建音频对象
+    /// @param res 音频资源
+    /// @param streaming 是否流式播放
+    Sound(const Resource& res, bool streaming = false);
 
     Sound();
 
     virtual ~Sound();
 
     /// \~chinese
-    /// @brief 򿪱Ƶļ
-    /// @param res Ƶļ·
-    bool Load(const String& file_path);
+    /// @brief 打开本地音频文件
+    /// @param res 本地音频文件路径
+    /// @param streaming 是否流式播放，流式播放时文件被映射到内存并在后台线程中分块解码，
+    /// 内存占用与音频时长无关，适合较长的音乐
+    bool Load(const String& file_path, bool streaming = false);
 
     /// \~chinese
-    /// @brief ƵԴ
-    /// @param res ƵԴ
-    bool Load(const Resource& res);
+    /// @brief 打开音频资源
+    /// @param res 音频资源
+    /// @param streaming 是否流式播放
+    bool Load(const Resource& res, bool streaming = false);
 
     /// \~chinese
-    /// @brief ǷЧ
+    /// @brief 打开音频数据
+    /// @param data 音频数据，非流式播放时解码后不再需要，流式播放时被共享持有
+    /// @param streaming 是否流式播放
+    bool Load(const BinaryData& data, bool streaming = false);
+
+    /// \~chinese
+    /// @brief 是否有效
     bool IsValid() const;
 
     /// \~chinese
-    /// @brief 
-    /// @param loop_count ѭ -1 Ϊѭ
+    /// @brief 是否是流式播放
+    bool IsStreaming() const;
+
+    /// \~chinese
+    /// @brief 播放
+    /// @param loop_count 播放循环次数，设置 -1 为循环播放
     void Play(int loop_count = 0);
 
     /// \~chinese
-    /// @brief ͣ
+    /// @brief 暂停
     void Pause();
 
     /// \~chinese
-    /// @brief 
+    /// @brief 继续
     void Resume();
 
     /// \~chinese
-    /// @brief ֹͣ
+    /// @brief 停止
     void Stop();
 
     /// \~chinese
-    /// @brief رղԴ
+    /// @brief 跳转到指定位置
+    /// @param position 播放位置
+    void Seek(Duration position);
+
+    /// \~chinese
+    /// @brief 关闭并销毁资源
     void Close();
 
     /// \~chinese
-    /// @brief Ƿڲ
+    /// @brief 是否正在播放
     bool IsPlaying() const;
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取音量
     float GetVolume() const;
 
     /// \~chinese
-    /// @brief 
-    /// @param volume С1.0 Ϊԭʼ,  1 ΪŴ, 0 ΪС
+    /// @brief 设置音量
+    /// @param volume 音量大小，1.0 为原始音量, 大于 1 为放大音量, 0 为最小音量
     void SetVolume(float volume);
 
 private:
@@ -114,11 +136,28 @@ private:
 
     void SetXAudio2Voice(IXAudio2SourceVoice* voice);
 
+    bool OpenStream(AudioDecoderPtr decoder);
+
+    void StartStream();
+
+    void StopStream();
+
+    void SubmitStreamBuffers();
+
+    void OnStreamBufferEnd(const AudioStream::Buffer* buffer);
+
 private:
+    class StreamingCallback;
+
     bool                 opened_;
     bool                 playing_;
+    bool                 stream_active_;
+    int                  loop_count_;
     Transcoder           transcoder_;
     IXAudio2SourceVoice* voice_;
+    AudioStreamPtr       stream_;
+    StreamingCallback*   callback_;
+    std::mutex           stream_mutex_;
 };
 
 /** @} */
@@ -132,5 +171,10 @@ inline void Sound::SetXAudio2Voice(IXAudio2SourceVoice* voice)
 {
     voice_ = voice;
 }
+
+inline bool Sound::IsStreaming() const
+{
+    return stream_ != nullptr;
+}
 }  // namespace audio
 }  // namespace kiwano
@@ -0,0 +1,203 @@
+// Copyright (c) 2016-2018 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <kiwano-audio/SoundBuffer.h>
+#include <kiwano/utils/Logger.h>
+#include <kiwano/platform/FileSystem.h>
+
+namespace kiwano
+{
+namespace audio
+{
+
+SoundBufferPtr SoundBuffer::Preload(const String& file_path)
+{
+    size_t hash_code = std::hash<String>{}(file_path);
+    if (SoundBufferPtr ptr = SoundBufferCache::GetInstance().GetBuffer(hash_code))
+    {
+        return ptr;
+    }
+    SoundBufferPtr ptr = MakePtr<SoundBuffer>();
+    if (ptr && ptr->Load(file_path))
+    {
+        SoundBufferCache::GetInstance().AddBuffer(hash_code, ptr);
+    }
+    return ptr;
+}
+
+SoundBufferPtr SoundBuffer::Preload(const Resource& res)
+{
+    size_t hash_code = res.GetId();
+    if (SoundBufferPtr ptr = SoundBufferCache::GetInstance().GetBuffer(hash_code))
+    {
+        return ptr;
+    }
+    SoundBufferPtr ptr = MakePtr<SoundBuffer>();
+    if (ptr && ptr->Load(res))
+    {
+        SoundBufferCache::GetInstance().AddBuffer(hash_code, ptr);
+    }
+    return ptr;
+}
+
+SoundBuffer::SoundBuffer() {}
+
+SoundBuffer::~SoundBuffer() {}
+
+bool SoundBuffer::Load(const String& file_path)
+{
+    if (!FileSystem::GetInstance().IsFileExists(file_path))
+    {
+        KGE_WARNF("Media file '%s' not found", file_path.c_str());
+        return false;
+    }
+
+    AudioDecoderPtr decoder = AudioDecoder::Create(file_path);
+    if (!decoder)
+    {
+        KGE_ERRORF("Load media file '%s' failed", file_path.c_str());
+        return false;
+    }
+    return Load(decoder);
+}
+
+bool SoundBuffer::Load(const Resource& res)
+{
+    return Load(res.GetData());
+}
+
+bool SoundBuffer::Load(const BinaryData& data)
+{
+    AudioDecoderPtr decoder = AudioDecoder::Create(data);
+    if (!decoder)
+    {
+        KGE_ERRORF("Load media data failed");
+        return false;
+    }
+    return Load(decoder);
+}
+
+bool SoundBuffer::Load(AudioDecoderPtr decoder)
+{
+    if (!decoder)
+        return false;
+
+    const AudioFormat& format      = decoder->GetFormat();
+    const uint32_t     block_align = format.GetBlockAlign();
+    if (block_align == 0)
+        return false;
+
+    // The frames count may be an estimation, read until the decoder runs dry
+    const size_t chunk_frames = 4096;
+
+    Vector<uint8_t> samples;
+    samples.reserve(size_t(decoder->GetFramesCount()) * block_align);
+
+    size_t length = 0;
+    while (true)
+    {
+        samples.resize(length + chunk_frames * block_align);
+
+        size_t frames = decoder->Read(samples.data() + length, chunk_frames);
+        length += frames * block_align;
+
+        if (frames < chunk_frames)
+            break;
+    }
+    samples.resize(length);
+    samples.shrink_to_fit();
+
+    if (samples.empty())
+    {
+        KGE_WARNF("Decoded sound buffer is empty");
+        return false;
+    }
+
+    format_ = format;
+    data_   = BinaryData(std::move(samples));
+    return true;
+}
+
+Duration SoundBuffer::GetDuration() const
+{
+    if (format_.sample_rate == 0)
+        return Duration();
+    return Duration(int64_t(GetFramesCount() * 1000 / format_.sample_rate));
+}
+
+SoundBufferCache::SoundBufferCache() {}
+
+SoundBufferCache::~SoundBufferCache()
+{
+    Clear();
+}
+
+void SoundBufferCache::AddBuffer(size_t key, SoundBufferPtr buffer)
+{
+    cache_.Add(key, buffer, buffer ? buffer->GetMemorySize() : 0);
+}
+
+SoundBufferPtr SoundBufferCache::GetBuffer(size_t key) const
+{
+    return cache_.Get(key);
+}
+
+void SoundBufferCache::RemoveBuffer(size_t key)
+{
+    cache_.Remove(key);
+}
+
+void SoundBufferCache::Clear()
+{
+    cache_.Clear();
+}
+
+void SoundBufferCache::SetMemoryBudget(size_t budget)
+{
+    cache_.SetMemoryBudget(budget);
+}
+
+size_t SoundBufferCache::GetMemoryBudget() const
+{
+    return cache_.GetMemoryBudget();
+}
+
+size_t SoundBufferCache::Trim()
+{
+    return cache_.Trim();
+}
+
+size_t SoundBufferCache::Purge()
+{
+    return cache_.Purge();
+}
+
+const CacheStats& SoundBufferCache::GetStats() const
+{
+    return cache_.GetStats();
+}
+
+void SoundBufferCache::ResetStats()
+{
+    cache_.ResetStats();
+}
+
+}  // namespace audio
+}  // namespace kiwano
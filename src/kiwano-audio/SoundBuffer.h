@@ -0,0 +1,198 @@
+// Copyright (c) 2016-2018 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <kiwano-audio/AudioDecoder.h>
+#include <kiwano/core/Resource.h>
+#include <kiwano/core/Singleton.h>
+#include <kiwano/core/LruCache.h>
+
+namespace kiwano
+{
+namespace audio
+{
+
+KGE_DECLARE_SMART_PTR(SoundBuffer);
+
+/**
+ * \addtogroup Audio
+ * @{
+ */
+
+/**
+ * \~chinese
+ * @brief 音频缓冲
+ * @details 保存完整解码后的 PCM 数据，数据只读，可以被多个声音实例同时播放
+ */
+class KGE_API SoundBuffer : public ObjectBase
+{
+public:
+    /// \~chinese
+    /// @brief 预加载本地音频文件
+    /// @details 解码后的数据保存在音频缓冲缓存中，重复加载同一个文件不会再次解码
+    static SoundBufferPtr Preload(const String& file_path);
+
+    /// \~chinese
+    /// @brief 预加载音频资源
+    /// @details 解码后的数据保存在音频缓冲缓存中，重复加载同一个资源不会再次解码
+    static SoundBufferPtr Preload(const Resource& res);
+
+    SoundBuffer();
+
+    virtual ~SoundBuffer();
+
+    /// \~chinese
+    /// @brief 解码本地音频文件
+    bool Load(const String& file_path);
+
+    /// \~chinese
+    /// @brief 解码音频资源
+    bool Load(const Resource& res);
+
+    /// \~chinese
+    /// @brief 解码音频数据
+    bool Load(const BinaryData& data);
+
+    /// \~chinese
+    /// @brief 读取解码器的全部数据
+    bool Load(AudioDecoderPtr decoder);
+
+    /// \~chinese
+    /// @brief 是否有效
+    bool IsValid() const;
+
+    /// \~chinese
+    /// @brief 获取音频格式
+    const AudioFormat& GetFormat() const;
+
+    /// \~chinese
+    /// @brief 获取 PCM 数据
+    const BinaryData& GetData() const;
+
+    /// \~chinese
+    /// @brief 获取音频总帧数
+    uint64_t GetFramesCount() const;
+
+    /// \~chinese
+    /// @brief 获取音频时长
+    Duration GetDuration() const;
+
+    /// \~chinese
+    /// @brief 获取占用的内存大小（字节）
+    size_t GetMemorySize() const;
+
+private:
+    AudioFormat format_;
+    BinaryData  data_;
+};
+
+/**
+ * \~chinese
+ * @brief 音频缓冲缓存
+ * @details 按文件路径或资源ID缓存解码后的音频缓冲。
+ * 设置内存预算后，占用内存超出预算时将淘汰最久未使用、且只被缓存引用的音频缓冲
+ */
+class KGE_API SoundBufferCache final : public Singleton<SoundBufferCache>
+{
+    friend Singleton<SoundBufferCache>;
+
+public:
+    /// \~chinese
+    /// @brief 添加音频缓冲缓存
+    void AddBuffer(size_t key, SoundBufferPtr buffer);
+
+    /// \~chinese
+    /// @brief 获取音频缓冲缓存
+    SoundBufferPtr GetBuffer(size_t key) const;
+
+    /// \~chinese
+    /// @brief 移除音频缓冲缓存
+    void RemoveBuffer(size_t key);
+
+    /// \~chinese
+    /// @brief 清空缓存
+    void Clear();
+
+    /// \~chinese
+    /// @brief 设置内存预算
+    /// @param budget 内存预算（字节），为零时不限制
+    void SetMemoryBudget(size_t budget);
+
+    /// \~chinese
+    /// @brief 获取内存预算
+    size_t GetMemoryBudget() const;
+
+    /// \~chinese
+    /// @brief 淘汰最久未使用的音频缓冲，直到占用内存不超过预算
+    /// @return 淘汰的音频缓冲数量
+    size_t Trim();
+
+    /// \~chinese
+    /// @brief 淘汰所有只被缓存引用的音频缓冲
+    /// @return 淘汰的音频缓冲数量
+    size_t Purge();
+
+    /// \~chinese
+    /// @brief 获取统计数据
+    const CacheStats& GetStats() const;
+
+    /// \~chinese
+    /// @brief 重置命中、未命中和淘汰次数
+    void ResetStats();
+
+    ~SoundBufferCache();
+
+private:
+    SoundBufferCache();
+
+private:
+    mutable LruCache<size_t, SoundBufferPtr> cache_;
+};
+
+/** @} */
+
+inline bool SoundBuffer::IsValid() const
+{
+    return format_.channels != 0 && data_.IsValid();
+}
+
+inline const AudioFormat& SoundBuffer::GetFormat() const
+{
+    return format_;
+}
+
+inline const BinaryData& SoundBuffer::GetData() const
+{
+    return data_;
+}
+
+inline uint64_t SoundBuffer::GetFramesCount() const
+{
+    const uint32_t block_align = format_.GetBlockAlign();
+    return block_align ? data_.GetSize() / block_align : 0;
+}
+
+inline size_t SoundBuffer::GetMemorySize() const
+{
+    return size_t(data_.GetSize());
+}
+
+}  // namespace audio
+}  // namespace kiwano
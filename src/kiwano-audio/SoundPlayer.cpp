@@ -25,9 +25,10 @@ namespace kiwano
 namespace audio
 {
 
-SoundPlayer::SoundPlayer()
+SoundPlayer::SoundPlayer(uint32_t max_voices)
     : volume_(1.f)
 {
+    voice_pool_ = MakePtr<VoicePool>(max_voices);
 }
 
 SoundPlayer::~SoundPlayer()
@@ -48,14 +49,13 @@ size_t SoundPlayer::GetId(const Resource& res) const
 size_t SoundPlayer::Load(const String& file_path)
 {
     size_t id = GetId(file_path);
-    if (sound_cache_.end() != sound_cache_.find(id))
+    if (buffer_cache_.end() != buffer_cache_.find(id))
         return id;
 
-    SoundPtr sound = MakePtr<Sound>();
-    if (sound && sound->Load(file_path))
+    SoundBufferPtr buffer = SoundBuffer::Preload(file_path);
+    if (buffer && buffer->IsValid())
     {
-        sound->SetVolume(volume_);
-        sound_cache_.insert(std::make_pair(id, sound));
+        buffer_cache_.insert(std::make_pair(id, buffer));
         return id;
     }
     return 0;
@@ -64,48 +64,47 @@ size_t SoundPlayer::Load(const String& file_path)
 size_t SoundPlayer::Load(const Resource& res)
 {
     size_t id = GetId(res);
-    if (sound_cache_.end() != sound_cache_.find(id))
+    if (buffer_cache_.end() != buffer_cache_.find(id))
         return id;
 
-    SoundPtr sound = MakePtr<Sound>();
-
-    if (sound && sound->Load(res))
+    SoundBufferPtr buffer = SoundBuffer::Preload(res);
+    if (buffer && buffer->IsValid())
     {
-        sound->SetVolume(volume_);
-        sound_cache_.insert(std::make_pair(id, sound));
+        buffer_cache_.insert(std::make_pair(id, buffer));
         return id;
     }
     return 0;
 }
 
-void SoundPlayer::Play(size_t id, int loop_count)
+uint32_t SoundPlayer::Play(size_t id, int loop_count, int priority)
 {
-    if (auto sound = GetSound(id))
-        sound->Play(loop_count);
+    if (auto buffer = GetBuffer(id))
+        return voice_pool_->Play(buffer, loop_count, priority);
+    return 0;
 }
 
 void SoundPlayer::Pause(size_t id)
 {
-    if (auto sound = GetSound(id))
-        sound->Pause();
+    if (auto buffer = GetBuffer(id))
+        voice_pool_->PauseBuffer(buffer.Get());
 }
 
 void SoundPlayer::Resume(size_t id)
 {
-    if (auto sound = GetSound(id))
-        sound->Resume();
+    if (auto buffer = GetBuffer(id))
+        voice_pool_->ResumeBuffer(buffer.Get());
 }
 
 void SoundPlayer::Stop(size_t id)
 {
-    if (auto sound = GetSound(id))
-        sound->Stop();
+    if (auto buffer = GetBuffer(id))
+        voice_pool_->StopBuffer(buffer.Get());
 }
 
 bool SoundPlayer::IsPlaying(size_t id)
 {
-    if (auto sound = GetSound(id))
-        return sound->IsPlaying();
+    if (auto buffer = GetBuffer(id))
+        return voice_pool_->IsBufferPlaying(buffer.Get());
     return false;
 }
 
@@ -117,47 +116,36 @@ float SoundPlayer::GetVolume() const
 void SoundPlayer::SetVolume(float volume)
 {
     volume_ = std::min(std::max(volume, -224.f), 224.f);
-    for (auto& pair : sound_cache_)
-    {
-        pair.second->SetVolume(volume_);
-    }
+    voice_pool_->SetMasterVolume(volume_);
 }
 
-SoundPtr SoundPlayer::GetSound(size_t id) const
+SoundBufferPtr SoundPlayer::GetBuffer(size_t id) const
 {
-    auto iter = sound_cache_.find(id);
-    if (iter != sound_cache_.end())
+    auto iter = buffer_cache_.find(id);
+    if (iter != buffer_cache_.end())
         return iter->second;
-    return SoundPtr();
+    return SoundBufferPtr();
 }
 
 void SoundPlayer::PauseAll()
 {
-    for (auto& pair : sound_cache_)
-    {
-        pair.second->Pause();
-    }
+    voice_pool_->PauseAll();
 }
 
 void SoundPlayer::ResumeAll()
 {
-    for (auto& pair : sound_cache_)
-    {
-        pair.second->Resume();
-    }
+    voice_pool_->ResumeAll();
 }
 
 void SoundPlayer::StopAll()
 {
-    for (auto& pair : sound_cache_)
-    {
-        pair.second->Stop();
-    }
+    voice_pool_->StopAll();
 }
 
 void SoundPlayer::ClearCache()
 {
-    sound_cache_.clear();
+    voice_pool_->StopAll();
+    buffer_cache_.clear();
 }
 }  // namespace audio
 }  // namespace kiwano
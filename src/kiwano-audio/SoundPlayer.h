@@ -19,7 +19,7 @@
 // THE SOFTWARE.
 
 #pragma once
-#include <kiwano-audio/Sound.h>
+#include <kiwano-audio/VoicePool.h>
 #include <kiwano/base/ObjectBase.h>
 
 namespace kiwano
@@ -35,102 +35,121 @@ KGE_DECLARE_SMART_PTR(SoundPlayer);
 
 /**
  * \~chinese
- * @brief Ƶ
+ * @brief 音频播放器
+ * @details 加载的音频解码后保存在共享的音频缓冲缓存中，播放时从声部池中取出声部，同一个音频可以同时播放多个实例
  */
 class KGE_API SoundPlayer : public ObjectBase
 {
 public:
-    SoundPlayer();
+    /// \~chinese
+    /// @brief 创建音频播放器
+    /// @param max_voices 最多同时播放的声音实例数量
+    SoundPlayer(uint32_t max_voices = 32);
 
     ~SoundPlayer();
 
     /// \~chinese
-    /// @brief رƵļ
-    /// @param file_path Ƶļ·
-    /// @return Ƶʶ
+    /// @brief 加载本地音频文件
+    /// @param file_path 本地音频文件路径
+    /// @return 音频标识符
     size_t Load(const String& file_path);
 
     /// \~chinese
-    /// @brief ƵԴ
-    /// @param res ƵԴ
-    /// @return Ƶʶ
+    /// @brief 加载音频资源
+    /// @param res 音频资源
+    /// @return 音频标识符
     size_t Load(const Resource& res);
 
     /// \~chinese
-    /// @brief Ƶ
-    /// @param id Ƶʶ
-    /// @param loop_count ѭ -1 Ϊѭ
-    void Play(size_t id, int loop_count = 0);
+    /// @brief 播放音频的新实例
+    /// @details 声部用尽时停止优先级不高于此实例的最早播放的实例，否则放弃播放
+    /// @param id 音频标识符
+    /// @param loop_count 播放循环次数，设置 -1 为循环播放
+    /// @param priority 优先级
+    /// @return 声音实例标识符，可以通过声部池控制单个实例，无法播放时返回零
+    uint32_t Play(size_t id, int loop_count = 0, int priority = 0);
 
     /// \~chinese
-    /// @brief ͣƵ
-    /// @param id Ƶʶ
+    /// @brief 暂停音频的所有实例
+    /// @param id 音频标识符
     void Pause(size_t id);
 
     /// \~chinese
-    /// @brief Ƶ
-    /// @param id Ƶʶ
+    /// @brief 继续播放音频的所有实例
+    /// @param id 音频标识符
     void Resume(size_t id);
 
     /// \~chinese
-    /// @brief ֹͣƵ
-    /// @param id Ƶʶ
+    /// @brief 停止音频的所有实例
+    /// @param id 音频标识符
     void Stop(size_t id);
 
     /// \~chinese
-    /// @brief ȡƵ״̬
-    /// @param id Ƶʶ
+    /// @brief 获取音频播放状态
+    /// @param id 音频标识符
+    /// @return 是否有实例正在播放
     bool IsPlaying(size_t id);
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取音量
     float GetVolume() const;
 
     /// \~chinese
-    /// @brief 
-    /// @param volume С1.0 Ϊԭʼ,  1 ΪŴ, 0 ΪС
+    /// @brief 设置音量
+    /// @param volume 音量大小，1.0 为原始音量, 大于 1 为放大音量, 0 为最小音量
     void SetVolume(float volume);
 
     /// \~chinese
-    /// @brief ȡƵļid
-    /// @param file_path Ƶļ·
-    /// @return Ƶʶ
+    /// @brief 获取本地音频文件id
+    /// @param file_path 本地音频文件路径
+    /// @return 音频标识符
     size_t GetId(const String& file_path) const;
 
     /// \~chinese
-    /// @brief ȡƵԴid
-    /// @param res ƵԴ
-    /// @return Ƶʶ
+    /// @brief 获取音频资源id
+    /// @param res 音频资源
+    /// @return 音频标识符
     size_t GetId(const Resource& res) const;
 
     /// \~chinese
-    /// @brief ȡֶ
-    /// @param id Ƶʶ
-    SoundPtr GetSound(size_t id) const;
+    /// @brief 获取音频缓冲
+    /// @param id 音频标识符
+    SoundBufferPtr GetBuffer(size_t id) const;
+
+    /// \~chinese
+    /// @brief 获取声部池
+    VoicePoolPtr GetVoicePool() const;
 
     /// \~chinese
-    /// @brief ͣƵ
+    /// @brief 暂停所有音频
     void PauseAll();
 
     /// \~chinese
-    /// @brief Ƶ
+    /// @brief 继续播放所有音频
     void ResumeAll();
 
     /// \~chinese
-    /// @brief ֹͣƵ
+    /// @brief 停止所有音频
     void StopAll();
 
     /// \~chinese
-    /// @brief 
+    /// @brief 停止所有音频并清除缓存
+    /// @details 音频缓冲仍然保存在共享的音频缓冲缓存中
     void ClearCache();
 
 private:
-    float volume_;
+    float        volume_;
+    VoicePoolPtr voice_pool_;
 
-    using SoundMap = Map<size_t, SoundPtr>;
-    SoundMap sound_cache_;
+    using BufferMap = Map<size_t, SoundBufferPtr>;
+    BufferMap buffer_cache_;
 };
 
 /** @} */
+
+inline VoicePoolPtr SoundPlayer::GetVoicePool() const
+{
+    return voice_pool_;
+}
 }  // namespace audio
 }  // namespace kiwano
@@ -35,6 +35,172 @@ namespace kiwano
 namespace audio
 {
 
+namespace
+{
+
+// A read-only stream that reads the binary data in place, unlike SHCreateMemStream which copies it
+class BinaryDataStream : public IStream
+{
+public:
+    BinaryDataStream(const BinaryData& data)
+        : ref_count_(0)
+        , position_(0)
+        , data_(data)
+    {
+    }
+
+    // IUnknown methods
+    HRESULT STDMETHODCALLTYPE QueryInterface(REFIID iid, void** ppvObject) override
+    {
+        if (!ppvObject)
+            return E_POINTER;
+
+        if (iid == IID_IUnknown || iid == __uuidof(ISequentialStream) || iid == __uuidof(IStream))
+        {
+            *ppvObject = static_cast<IStream*>(this);
+            AddRef();
+            return S_OK;
+        }
+        *ppvObject = nullptr;
+        return E_NOINTERFACE;
+    }
+
+    ULONG STDMETHODCALLTYPE AddRef() override
+    {
+        return InterlockedIncrement(&ref_count_);
+    }
+
+    ULONG STDMETHODCALLTYPE Release() override
+    {
+        ULONG count = InterlockedDecrement(&ref_count_);
+        if (count == 0)
+            delete this;
+        return count;
+    }
+
+    // ISequentialStream methods
+    HRESULT STDMETHODCALLTYPE Read(void* pv, ULONG cb, ULONG* pcbRead) override
+    {
+        if (!pv)
+            return STG_E_INVALIDPOINTER;
+
+        const uint64_t size   = data_.GetSize();
+        const ULONG    length = ULONG(std::min<uint64_t>(cb, position_ < size ? size - position_ : 0));
+
+        if (length)
+        {
+            std::memcpy(pv, data_.GetBytes() + position_, length);
+            position_ += length;
+        }
+
+        if (pcbRead)
+            *pcbRead = length;
+        return length == cb ? S_OK : S_FALSE;
+    }
+
+    HRESULT STDMETHODCALLTYPE Write(const void* pv, ULONG cb, ULONG* pcbWritten) override
+    {
+        return STG_E_ACCESSDENIED;
+    }
+
+    // IStream methods
+    HRESULT STDMETHODCALLTYPE Seek(LARGE_INTEGER dlibMove, DWORD dwOrigin, ULARGE_INTEGER* plibNewPosition) override
+    {
+        int64_t origin = 0;
+        switch (dwOrigin)
+        {
+        case STREAM_SEEK_SET:
+            origin = 0;
+            break;
+        case STREAM_SEEK_CUR:
+            origin = int64_t(position_);
+            break;
+        case STREAM_SEEK_END:
+            origin = int64_t(data_.GetSize());
+            break;
+        default:
+            return STG_E_INVALIDFUNCTION;
+        }
+
+        const int64_t position = origin + dlibMove.QuadPart;
+        if (position < 0)
+            return STG_E_INVALIDFUNCTION;
+
+        position_ = uint64_t(position);
+        if (plibNewPosition)
+            plibNewPosition->QuadPart = position_;
+        return S_OK;
+    }
+
+    HRESULT STDMETHODCALLTYPE SetSize(ULARGE_INTEGER libNewSize) override
+    {
+        return STG_E_ACCESSDENIED;
+    }
+
+    HRESULT STDMETHODCALLTYPE CopyTo(IStream* pstm, ULARGE_INTEGER cb, ULARGE_INTEGER* pcbRead,
+                                     ULARGE_INTEGER* pcbWritten) override
+    {
+        return E_NOTIMPL;
+    }
+
+    HRESULT STDMETHODCALLTYPE Commit(DWORD grfCommitFlags) override
+    {
+        return S_OK;
+    }
+
+    HRESULT STDMETHODCALLTYPE Revert() override
+    {
+        return S_OK;
+    }
+
+    HRESULT STDMETHODCALLTYPE LockRegion(ULARGE_INTEGER libOffset, ULARGE_INTEGER cb, DWORD dwLockType) override
+    {
+        return STG_E_INVALIDFUNCTION;
+    }
+
+    HRESULT STDMETHODCALLTYPE UnlockRegion(ULARGE_INTEGER libOffset, ULARGE_INTEGER cb, DWORD dwLockType) override
+    {
+        return STG_E_INVALIDFUNCTION;
+    }
+
+    HRESULT STDMETHODCALLTYPE Stat(STATSTG* pstatstg, DWORD grfStatFlag) override
+    {
+        if (!pstatstg)
+            return STG_E_INVALIDPOINTER;
+
+        ZeroMemory(pstatstg, sizeof(STATSTG));
+        pstatstg->type            = STGTY_STREAM;
+        pstatstg->cbSize.QuadPart = data_.GetSize();
+        pstatstg->grfMode         = STGM_READ;
+        return S_OK;
+    }
+
+    HRESULT STDMETHODCALLTYPE Clone(IStream** ppstm) override
+    {
+        if (!ppstm)
+            return STG_E_INVALIDPOINTER;
+
+        BinaryDataStream* stream = new (std::nothrow) BinaryDataStream(data_);
+        if (!stream)
+            return E_OUTOFMEMORY;
+
+        stream->position_ = position_;
+        stream->AddRef();
+        *ppstm = stream;
+        return S_OK;
+    }
+
+private:
+    virtual ~BinaryDataStream() {}
+
+private:
+    ULONG      ref_count_;
+    uint64_t   position_;
+    BinaryData data_;
+};
+
+}  // namespace
+
 Transcoder::Transcoder()
     : wave_format_(nullptr)
     , wave_data_(nullptr)
@@ -87,6 +253,11 @@ HRESULT Transcoder::LoadMediaFile(const String& file_path)
 }
 
 HRESULT Transcoder::LoadMediaResource(const Resource& res)
+{
+    return LoadMediaData(res.GetData());
+}
+
+HRESULT Transcoder::LoadMediaData(const BinaryData& data)
 {
     HRESULT hr = S_OK;
 
@@ -94,18 +265,15 @@ HRESULT Transcoder::LoadMediaResource(const Resource& res)
     ComPtr<IMFByteStream>   byte_stream;
     ComPtr<IMFSourceReader> reader;
 
-    BinaryData data = res.GetData();
     if (!data.IsValid())
     {
         return E_FAIL;
     }
 
-    stream = win32::dlls::Shlwapi::Get().SHCreateMemStream(static_cast<const BYTE*>(data.buffer),
-                                                           static_cast<uint32_t>(data.size));
+    stream = new (std::nothrow) BinaryDataStream(data);
 
     if (stream == nullptr)
     {
-        KGE_ERRORF("SHCreateMemStream failed");
         return E_OUTOFMEMORY;
     }
 
@@ -147,25 +315,25 @@ HRESULT Transcoder::ReadSource(IMFSourceReader* reader)
         hr = partial_type->SetGUID(MF_MT_SUBTYPE, MFAudioFormat_PCM);
     }
 
-    //  source reader ýͣʹúʵĽȥƵ
+    // 设置 source reader 的媒体类型，它将使用合适的解码器去解码这个音频
     if (SUCCEEDED(hr))
     {
         hr = reader->SetCurrentMediaType((DWORD)MF_SOURCE_READER_FIRST_AUDIO_STREAM, 0, partial_type.Get());
     }
 
-    //  IMFMediaType лȡ WAVEFORMAT ṹ
+    // 从 IMFMediaType 中获取 WAVEFORMAT 结构
     if (SUCCEEDED(hr))
     {
         hr = reader->GetCurrentMediaType((DWORD)MF_SOURCE_READER_FIRST_AUDIO_STREAM, &uncompressed_type);
     }
 
-    // ָƵ
+    // 指定音频流
     if (SUCCEEDED(hr))
     {
         hr = reader->SetStreamSelection((DWORD)MF_SOURCE_READER_FIRST_AUDIO_STREAM, true);
     }
 
-    // ȡ WAVEFORMAT 
+    // 获取 WAVEFORMAT 数据
     if (SUCCEEDED(hr))
     {
         uint32_t size = 0;
@@ -173,7 +341,7 @@ HRESULT Transcoder::ReadSource(IMFSourceReader* reader)
             uncompressed_type.Get(), &wave_format_, &size, (DWORD)MFWaveFormatExConvertFlag_Normal);
     }
 
-    // ƵС
+    // 估算音频流大小
     if (SUCCEEDED(hr))
     {
         PROPVARIANT prop;
@@ -186,7 +354,7 @@ HRESULT Transcoder::ReadSource(IMFSourceReader* reader)
         PropVariantClear(&prop);
     }
 
-    // ȡƵ
+    // 读取音频数据
     if (SUCCEEDED(hr))
     {
         DWORD flags    = 0;
@@ -266,5 +434,251 @@ HRESULT Transcoder::ReadSource(IMFSourceReader* reader)
 
     return hr;
 }
+
+MediaFoundationDecoder::MediaFoundationDecoder()
+    : end_of_stream_(false)
+    , seek_pending_(false)
+    , seek_frame_(0)
+    , pending_offset_(0)
+{
+}
+
+MediaFoundationDecoder::~MediaFoundationDecoder() {}
+
+bool MediaFoundationDecoder::Open(const BinaryData& data)
+{
+    HRESULT hr = S_OK;
+
+    ComPtr<IStream>       stream;
+    ComPtr<IMFByteStream> byte_stream;
+    ComPtr<IMFMediaType>  partial_type;
+    ComPtr<IMFMediaType>  uncompressed_type;
+    WAVEFORMATEX*         wave_format = nullptr;
+
+    if (!data.IsValid())
+    {
+        return false;
+    }
+
+    stream = new (std::nothrow) BinaryDataStream(data);
+
+    if (stream == nullptr)
+    {
+        return false;
+    }
+
+    hr = dlls::MediaFoundation::Get().MFCreateMFByteStreamOnStream(stream.Get(), &byte_stream);
+
+    if (SUCCEEDED(hr))
+    {
+        hr = dlls::MediaFoundation::Get().MFCreateSourceReaderFromByteStream(byte_stream.Get(), nullptr, &reader_);
+    }
+
+    if (SUCCEEDED(hr))
+    {
+        hr = dlls::MediaFoundation::Get().MFCreateMediaType(&partial_type);
+    }
+
+    if (SUCCEEDED(hr))
+    {
+        hr = partial_type->SetGUID(MF_MT_MAJOR_TYPE, MFMediaType_Audio);
+    }
+
+    if (SUCCEEDED(hr))
+    {
+        hr = partial_type->SetGUID(MF_MT_SUBTYPE, MFAudioFormat_PCM);
+    }
+
+    // 统一解码为 16 位 PCM
+    if (SUCCEEDED(hr))
+    {
+        hr = partial_type->SetUINT32(MF_MT_AUDIO_BITS_PER_SAMPLE, 16);
+    }
+
+    if (SUCCEEDED(hr))
+    {
+        hr = reader_->SetCurrentMediaType((DWORD)MF_SOURCE_READER_FIRST_AUDIO_STREAM, 0, partial_type.Get());
+    }
+
+    if (SUCCEEDED(hr))
+    {
+        hr = reader_->GetCurrentMediaType((DWORD)MF_SOURCE_READER_FIRST_AUDIO_STREAM, &uncompressed_type);
+    }
+
+    if (SUCCEEDED(hr))
+    {
+        hr = reader_->SetStreamSelection((DWORD)MF_SOURCE_READER_FIRST_AUDIO_STREAM, true);
+    }
+
+    if (SUCCEEDED(hr))
+    {
+        uint32_t size = 0;
+        hr            = dlls::MediaFoundation::Get().MFCreateWaveFormatExFromMFMediaType(
+            uncompressed_type.Get(), &wave_format, &size, (DWORD)MFWaveFormatExConvertFlag_Normal);
+    }
+
+    if (SUCCEEDED(hr))
+    {
+        if (wave_format->wBitsPerSample != 16 || wave_format->nChannels == 0)
+        {
+            hr = E_FAIL;
+        }
+        else
+        {
+            format_.sample_rate     = wave_format->nSamplesPerSec;
+            format_.channels        = wave_format->nChannels;
+            format_.bits_per_sample = wave_format->wBitsPerSample;
+        }
+        ::CoTaskMemFree(wave_format);
+    }
+
+    // 根据时长估算总帧数
+    if (SUCCEEDED(hr))
+    {
+        PROPVARIANT prop;
+        PropVariantInit(&prop);
+
+        if (SUCCEEDED(reader_->GetPresentationAttribute((DWORD)MF_SOURCE_READER_MEDIASOURCE, MF_PD_DURATION, &prop)))
+        {
+            frames_count_ = uint64_t(prop.uhVal.QuadPart) * format_.sample_rate / 10000000;
+        }
+        PropVariantClear(&prop);
+    }
+
+    if (FAILED(hr))
+    {
+        KGE_WARNF("MediaFoundationDecoder::Open failed with HRESULT of %08X", hr);
+        reader_.Reset();
+        return false;
+    }
+
+    data_          = data;
+    position_      = 0;
+    end_of_stream_ = false;
+    return true;
+}
+
+size_t MediaFoundationDecoder::Read(void* buffer, size_t frames)
+{
+    if (!reader_)
+        return 0;
+
+    const uint32_t block_align = format_.GetBlockAlign();
+
+    uint8_t* output = reinterpret_cast<uint8_t*>(buffer);
+    size_t   length = frames * block_align;
+    size_t   copied = 0;
+
+    while (copied < length)
+    {
+        if (pending_offset_ >= pending_.size())
+        {
+            if (end_of_stream_ || FAILED(ReadNextSample()))
+                break;
+            continue;
+        }
+
+        size_t count = std::min(length - copied, pending_.size() - pending_offset_);
+        std::memcpy(output + copied, pending_.data() + pending_offset_, count);
+        pending_offset_ += count;
+        copied += count;
+    }
+
+    size_t count = copied / block_align;
+    position_ += count;
+    return count;
+}
+
+bool MediaFoundationDecoder::Seek(uint64_t frame)
+{
+    if (!reader_ || format_.sample_rate == 0)
+        return false;
+
+    PROPVARIANT prop;
+    PropVariantInit(&prop);
+    prop.vt            = VT_I8;
+    prop.hVal.QuadPart = LONGLONG(frame * 10000000 / format_.sample_rate);
+
+    HRESULT hr = reader_->SetCurrentPosition(GUID_NULL, prop);
+    PropVariantClear(&prop);
+
+    if (FAILED(hr))
+    {
+        KGE_WARNF("MediaFoundationDecoder::Seek failed with HRESULT of %08X", hr);
+        return false;
+    }
+
+    // 压缩格式只能跳转到附近的关键帧，解码时再丢弃目标位置之前的数据
+    pending_.clear();
+    pending_offset_ = 0;
+    end_of_stream_  = false;
+    seek_pending_   = true;
+    seek_frame_     = frame;
+    position_       = frame;
+    return true;
+}
+
+HRESULT MediaFoundationDecoder::ReadNextSample()
+{
+    DWORD flags = 0;
+
+    ComPtr<IMFSample>      sample;
+    ComPtr<IMFMediaBuffer> buffer;
+
+    HRESULT hr = reader_->ReadSample((DWORD)MF_SOURCE_READER_FIRST_AUDIO_STREAM, 0, nullptr, &flags, nullptr, &sample);
+
+    if (FAILED(hr) || (flags & MF_SOURCE_READERF_ENDOFSTREAM))
+    {
+        end_of_stream_ = true;
+        return hr;
+    }
+
+    pending_.clear();
+    pending_offset_ = 0;
+
+    if (sample == nullptr)
+    {
+        return S_OK;
+    }
+
+    hr = sample->ConvertToContiguousBuffer(&buffer);
+
+    if (SUCCEEDED(hr))
+    {
+        BYTE* audio_data  = nullptr;
+        DWORD data_length = 0;
+
+        hr = buffer->Lock(&audio_data, nullptr, &data_length);
+
+        if (SUCCEEDED(hr))
+        {
+            pending_.assign(audio_data, audio_data + data_length);
+            hr = buffer->Unlock();
+        }
+    }
+
+    if (SUCCEEDED(hr) && seek_pending_)
+    {
+        seek_pending_ = false;
+
+        LONGLONG time = 0;
+        if (SUCCEEDED(sample->GetSampleTime(&time)))
+        {
+            uint64_t sample_frame = uint64_t(std::max<LONGLONG>(time, 0)) * format_.sample_rate / 10000000;
+            if (sample_frame < seek_frame_)
+            {
+                size_t skip     = size_t(seek_frame_ - sample_frame) * format_.GetBlockAlign();
+                pending_offset_ = std::min(pending_.size(), skip);
+            }
+        }
+    }
+
+    if (FAILED(hr))
+    {
+        end_of_stream_ = true;
+    }
+    return hr;
+}
+
 }  // namespace audio
 }  // namespace kiwano
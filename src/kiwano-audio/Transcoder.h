@@ -20,6 +20,8 @@
 
 #pragma once
 #include <kiwano/core/Resource.h>
+#include <kiwano/platform/win32/ComPtr.hpp>
+#include <kiwano-audio/AudioDecoder.h>
 #include <mfapi.h>
 #include <mfidl.h>
 #include <mfreadwrite.h>
@@ -30,6 +32,8 @@ namespace audio
 {
 class Sound;
 
+KGE_DECLARE_SMART_PTR(MediaFoundationDecoder);
+
 /**
  * \addtogroup Audio
  * @{
@@ -37,7 +41,7 @@ class Sound;
 
 /**
  * \~chinese
- * @brief Ƶ
+ * @brief 音频解码器
  */
 class KGE_API Transcoder
 {
@@ -46,13 +50,13 @@ class KGE_API Transcoder
 public:
     /**
      * \~chinese
-     * @brief Ƶݻ
+     * @brief 音频数据缓冲
      */
     struct Buffer
     {
-        BYTE*               data;    ///< Ƶ
-        uint32_t            size;    ///< ƵݴС
-        const WAVEFORMATEX* format;  ///< Ƶݸʽ
+        BYTE*               data;    ///< 音频数据
+        uint32_t            size;    ///< 音频数据大小
+        const WAVEFORMATEX* format;  ///< 音频数据格式
     };
 
     Transcoder();
@@ -60,24 +64,28 @@ public:
     ~Transcoder();
 
     /// \~chinese
-    /// @brief ȡݻ
+    /// @brief 获取数据缓冲
     Buffer GetBuffer() const;
 
     /// \~chinese
-    /// @brief ݻ
+    /// @brief 清空数据缓冲
     void ClearBuffer();
 
 private:
     /// \~chinese
-    /// @brief 뱾Ƶļ
+    /// @brief 解码本地音频文件
     HRESULT LoadMediaFile(const String& file_path);
 
     /// \~chinese
-    /// @brief ƵԴ
+    /// @brief 解码音频资源
     HRESULT LoadMediaResource(const Resource& res);
 
     /// \~chinese
-    /// @brief ȡƵԴ
+    /// @brief 解码音频数据
+    HRESULT LoadMediaData(const BinaryData& data);
+
+    /// \~chinese
+    /// @brief 读取音频源数据
     HRESULT ReadSource(IMFSourceReader* reader);
 
 private:
@@ -86,6 +94,42 @@ private:
     WAVEFORMATEX* wave_format_;
 };
 
+/**
+ * \~chinese
+ * @brief Media Foundation 流式解码器
+ * @details 按需从 Source Reader 读取并解码音频样本，用于流式播放 MP3 等压缩格式
+ */
+class KGE_API MediaFoundationDecoder : public AudioDecoder
+{
+public:
+    MediaFoundationDecoder();
+
+    virtual ~MediaFoundationDecoder();
+
+    /// \~chinese
+    /// @brief 打开音频数据
+    /// @details 解码器共享持有数据，不会复制
+    bool Open(const BinaryData& data);
+
+    size_t Read(void* buffer, size_t frames) override;
+
+    bool Seek(uint64_t frame) override;
+
+private:
+    /// \~chinese
+    /// @brief 读取下一个音频样本到待读取缓冲
+    HRESULT ReadNextSample();
+
+private:
+    bool                    end_of_stream_;
+    bool                    seek_pending_;
+    uint64_t                seek_frame_;
+    size_t                  pending_offset_;
+    Vector<uint8_t>         pending_;
+    BinaryData              data_;
+    ComPtr<IMFSourceReader> reader_;
+};
+
 /** @} */
 }  // namespace audio
 }  // namespace kiwano
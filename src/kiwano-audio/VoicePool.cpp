@@ -0,0 +1,321 @@
+// Copyright (c) 2016-2018 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <kiwano-audio/VoicePool.h>
+#include <kiwano/utils/Logger.h>
+
+#if defined(KGE_PLATFORM_WINDOWS)
+#include <kiwano-audio/AudioModule.h>
+#else
+#include <kiwano-audio/AudioMixer.h>
+#endif
+
+namespace kiwano
+{
+namespace audio
+{
+
+VoicePool::VoicePool(uint32_t max_voices, const VoiceFactory& factory)
+    : master_volume_(1.f)
+    , next_instance_(0)
+    , next_order_(0)
+    , stolen_count_(0)
+    , rejected_count_(0)
+    , factory_(factory)
+{
+    slots_.resize(max_voices);
+    for (auto& slot : slots_)
+    {
+        slot.instance = 0;
+        slot.priority = 0;
+        slot.order    = 0;
+        slot.volume   = 1.f;
+        slot.paused   = false;
+    }
+}
+
+VoicePool::~VoicePool()
+{
+    StopAll();
+}
+
+uint32_t VoicePool::Play(SoundBufferPtr buffer, int loop_count, int priority, float volume)
+{
+    if (!buffer || !buffer->IsValid())
+        return 0;
+
+    Slot* slot = AcquireSlot(priority);
+    if (!slot)
+    {
+        ++rejected_count_;
+        return 0;
+    }
+
+    if (!slot->voice)
+    {
+        slot->voice = CreateVoice();
+        if (!slot->voice)
+        {
+            KGE_WARNF("VoicePool failed to create a voice");
+            return 0;
+        }
+    }
+
+    slot->voice->SetVolume(volume * master_volume_);
+    if (!slot->voice->Start(buffer, loop_count))
+    {
+        return 0;
+    }
+
+    // Instance ids are never zero
+    if (++next_instance_ == 0)
+        ++next_instance_;
+
+    slot->buffer   = buffer;
+    slot->instance = next_instance_;
+    slot->priority = priority;
+    slot->order    = ++next_order_;
+    slot->volume   = volume;
+    slot->paused   = false;
+    return slot->instance;
+}
+
+void VoicePool::Stop(uint32_t instance)
+{
+    if (Slot* slot = FindSlot(instance))
+    {
+        slot->voice->Stop();
+        ReleaseSlot(*slot);
+    }
+}
+
+void VoicePool::Pause(uint32_t instance)
+{
+    if (Slot* slot = FindSlot(instance))
+    {
+        slot->voice->Pause();
+        slot->paused = true;
+    }
+}
+
+void VoicePool::Resume(uint32_t instance)
+{
+    if (Slot* slot = FindSlot(instance))
+    {
+        slot->voice->Resume();
+        slot->paused = false;
+    }
+}
+
+bool VoicePool::IsPlaying(uint32_t instance) const
+{
+    if (const Slot* slot = FindSlot(instance))
+        return !slot->paused && !slot->voice->IsFinished();
+    return false;
+}
+
+void VoicePool::SetVolume(uint32_t instance, float volume)
+{
+    if (Slot* slot = FindSlot(instance))
+    {
+        slot->volume = volume;
+        slot->voice->SetVolume(volume * master_volume_);
+    }
+}
+
+void VoicePool::StopBuffer(const SoundBuffer* buffer)
+{
+    for (auto& slot : slots_)
+    {
+        if (slot.instance && slot.buffer.Get() == buffer)
+        {
+            slot.voice->Stop();
+            ReleaseSlot(slot);
+        }
+    }
+}
+
+void VoicePool::PauseBuffer(const SoundBuffer* buffer)
+{
+    for (auto& slot : slots_)
+    {
+        if (slot.instance && slot.buffer.Get() == buffer)
+        {
+            slot.voice->Pause();
+            slot.paused = true;
+        }
+    }
+}
+
+void VoicePool::ResumeBuffer(const SoundBuffer* buffer)
+{
+    for (auto& slot : slots_)
+    {
+        if (slot.instance && slot.buffer.Get() == buffer && slot.paused)
+        {
+            slot.voice->Resume();
+            slot.paused = false;
+        }
+    }
+}
+
+bool VoicePool::IsBufferPlaying(const SoundBuffer* buffer) const
+{
+    for (const auto& slot : slots_)
+    {
+        if (slot.instance && slot.buffer.Get() == buffer && !slot.paused && !slot.voice->IsFinished())
+            return true;
+    }
+    return false;
+}
+
+void VoicePool::StopAll()
+{
+    for (auto& slot : slots_)
+    {
+        if (slot.instance)
+        {
+            slot.voice->Stop();
+            ReleaseSlot(slot);
+        }
+    }
+}
+
+void VoicePool::PauseAll()
+{
+    for (auto& slot : slots_)
+    {
+        if (slot.instance)
+        {
+            slot.voice->Pause();
+            slot.paused = true;
+        }
+    }
+}
+
+void VoicePool::ResumeAll()
+{
+    for (auto& slot : slots_)
+    {
+        if (slot.instance && slot.paused)
+        {
+            slot.voice->Resume();
+            slot.paused = false;
+        }
+    }
+}
+
+void VoicePool::SetMasterVolume(float volume)
+{
+    master_volume_ = std::min(std::max(volume, -224.f), 224.f);
+    for (auto& slot : slots_)
+    {
+        if (slot.instance)
+            slot.voice->SetVolume(slot.volume * master_volume_);
+    }
+}
+
+void VoicePool::Reclaim()
+{
+    for (auto& slot : slots_)
+    {
+        if (slot.instance && !slot.paused && slot.voice->IsFinished())
+            ReleaseSlot(slot);
+    }
+}
+
+uint32_t VoicePool::GetActiveCount() const
+{
+    uint32_t count = 0;
+    for (const auto& slot : slots_)
+    {
+        if (slot.instance && (slot.paused || !slot.voice->IsFinished()))
+            ++count;
+    }
+    return count;
+}
+
+VoicePool::Slot* VoicePool::FindSlot(uint32_t instance)
+{
+    return const_cast<Slot*>(static_cast<const VoicePool*>(this)->FindSlot(instance));
+}
+
+const VoicePool::Slot* VoicePool::FindSlot(uint32_t instance) const
+{
+    if (instance == 0)
+        return nullptr;
+
+    for (const auto& slot : slots_)
+    {
+        if (slot.instance == instance)
+            return &slot;
+    }
+    return nullptr;
+}
+
+VoicePool::Slot* VoicePool::AcquireSlot(int priority)
+{
+    Reclaim();
+
+    Slot* victim = nullptr;
+    for (auto& slot : slots_)
+    {
+        if (!slot.instance)
+            return &slot;
+
+        // The lowest priority loses, the oldest one among equals
+        if (!victim || slot.priority < victim->priority
+            || (slot.priority == victim->priority && slot.order < victim->order))
+        {
+            victim = &slot;
+        }
+    }
+
+    if (victim && victim->priority <= priority)
+    {
+        victim->voice->Stop();
+        ReleaseSlot(*victim);
+        ++stolen_count_;
+        return victim;
+    }
+    return nullptr;
+}
+
+void VoicePool::ReleaseSlot(Slot& slot)
+{
+    slot.buffer   = nullptr;
+    slot.instance = 0;
+    slot.paused   = false;
+}
+
+VoicePtr VoicePool::CreateVoice()
+{
+    if (factory_)
+        return factory_();
+
+#if defined(KGE_PLATFORM_WINDOWS)
+    return AudioModule::GetInstance().CreateVoice();
+#else
+    return AudioMixer::GetInstance().CreateVoice();
+#endif
+}
+
+}  // namespace audio
+}  // namespace kiwano
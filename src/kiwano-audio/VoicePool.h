@@ -0,0 +1,235 @@
+// Copyright (c) 2016-2018 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <kiwano-audio/SoundBuffer.h>
+
+namespace kiwano
+{
+namespace audio
+{
+
+KGE_DECLARE_SMART_PTR(Voice);
+KGE_DECLARE_SMART_PTR(VoicePool);
+
+/**
+ * \addtogroup Audio
+ * @{
+ */
+
+/**
+ * \~chinese
+ * @brief 声部
+ * @details 播放音频缓冲的底层通道，由音频后端实现，可以反复用于播放不同的音频缓冲
+ */
+class KGE_API Voice : public ObjectBase
+{
+public:
+    /// \~chinese
+    /// @brief 从头开始播放音频缓冲
+    /// @param buffer 音频缓冲，播放期间被持有
+    /// @param loop_count 播放循环次数，设置 -1 为循环播放
+    virtual bool Start(SoundBufferPtr buffer, int loop_count) = 0;
+
+    /// \~chinese
+    /// @brief 停止播放
+    virtual void Stop() = 0;
+
+    /// \~chinese
+    /// @brief 暂停播放
+    virtual void Pause() = 0;
+
+    /// \~chinese
+    /// @brief 继续播放
+    virtual void Resume() = 0;
+
+    /// \~chinese
+    /// @brief 设置音量
+    virtual void SetVolume(float volume) = 0;
+
+    /// \~chinese
+    /// @brief 是否已经播放完毕
+    virtual bool IsFinished() const = 0;
+};
+
+/**
+ * \~chinese
+ * @brief 声部池
+ * @details 管理固定数量的声部，同一个音频缓冲可以同时播放多个实例。
+ * 声部用尽时，停止优先级最低的实例中最早播放的一个，如果所有实例的优先级都高于新的实例，则放弃播放新的实例
+ */
+class KGE_API VoicePool : public ObjectBase
+{
+public:
+    /// \~chinese
+    /// @brief 声部创建函数
+    using VoiceFactory = Function<VoicePtr()>;
+
+    /// \~chinese
+    /// @brief 创建声部池
+    /// @param max_voices 最多同时播放的实例数量
+    /// @param factory 声部创建函数，为空时在 Windows 平台上使用音频模块创建声部，在其他平台上使用全局软件混音器创建声部
+    VoicePool(uint32_t max_voices = 32, const VoiceFactory& factory = nullptr);
+
+    virtual ~VoicePool();
+
+    /// \~chinese
+    /// @brief 播放音频缓冲的新实例
+    /// @param buffer 音频缓冲
+    /// @param loop_count 播放循环次数，设置 -1 为循环播放
+    /// @param priority 优先级，声部用尽时优先级较低的实例先被停止
+    /// @param volume 实例音量
+    /// @return 实例标识符，无法播放时返回零
+    uint32_t Play(SoundBufferPtr buffer, int loop_count = 0, int priority = 0, float volume = 1.f);
+
+    /// \~chinese
+    /// @brief 停止实例
+    void Stop(uint32_t instance);
+
+    /// \~chinese
+    /// @brief 暂停实例
+    void Pause(uint32_t instance);
+
+    /// \~chinese
+    /// @brief 继续播放实例
+    void Resume(uint32_t instance);
+
+    /// \~chinese
+    /// @brief 实例是否正在播放
+    bool IsPlaying(uint32_t instance) const;
+
+    /// \~chinese
+    /// @brief 设置实例音量
+    void SetVolume(uint32_t instance, float volume);
+
+    /// \~chinese
+    /// @brief 停止音频缓冲的所有实例
+    void StopBuffer(const SoundBuffer* buffer);
+
+    /// \~chinese
+    /// @brief 暂停音频缓冲的所有实例
+    void PauseBuffer(const SoundBuffer* buffer);
+
+    /// \~chinese
+    /// @brief 继续播放音频缓冲的所有实例
+    void ResumeBuffer(const SoundBuffer* buffer);
+
+    /// \~chinese
+    /// @brief 音频缓冲是否有实例正在播放
+    bool IsBufferPlaying(const SoundBuffer* buffer) const;
+
+    /// \~chinese
+    /// @brief 停止所有实例
+    void StopAll();
+
+    /// \~chinese
+    /// @brief 暂停所有实例
+    void PauseAll();
+
+    /// \~chinese
+    /// @brief 继续播放所有实例
+    void ResumeAll();
+
+    /// \~chinese
+    /// @brief 获取主音量
+    float GetMasterVolume() const;
+
+    /// \~chinese
+    /// @brief 设置主音量
+    /// @details 实例的实际音量为实例音量乘以主音量
+    void SetMasterVolume(float volume);
+
+    /// \~chinese
+    /// @brief 回收已经播放完毕的声部
+    /// @details 播放新实例时会自动回收
+    void Reclaim();
+
+    /// \~chinese
+    /// @brief 获取最多同时播放的实例数量
+    uint32_t GetMaxVoices() const;
+
+    /// \~chinese
+    /// @brief 获取正在使用的声部数量
+    uint32_t GetActiveCount() const;
+
+    /// \~chinese
+    /// @brief 获取被停止以播放新实例的次数
+    uint32_t GetStolenCount() const;
+
+    /// \~chinese
+    /// @brief 获取因优先级不足而放弃播放的次数
+    uint32_t GetRejectedCount() const;
+
+private:
+    struct Slot
+    {
+        VoicePtr       voice;
+        SoundBufferPtr buffer;
+        uint32_t       instance;
+        int            priority;
+        uint64_t       order;
+        float          volume;
+        bool           paused;
+    };
+
+    Slot* FindSlot(uint32_t instance);
+
+    const Slot* FindSlot(uint32_t instance) const;
+
+    Slot* AcquireSlot(int priority);
+
+    void ReleaseSlot(Slot& slot);
+
+    VoicePtr CreateVoice();
+
+private:
+    float        master_volume_;
+    uint32_t     next_instance_;
+    uint64_t     next_order_;
+    uint32_t     stolen_count_;
+    uint32_t     rejected_count_;
+    VoiceFactory factory_;
+    Vector<Slot> slots_;
+};
+
+/** @} */
+
+inline float VoicePool::GetMasterVolume() const
+{
+    return master_volume_;
+}
+
+inline uint32_t VoicePool::GetMaxVoices() const
+{
+    return uint32_t(slots_.size());
+}
+
+inline uint32_t VoicePool::GetStolenCount() const
+{
+    return stolen_count_;
+}
+
+inline uint32_t VoicePool::GetRejectedCount() const
+{
+    return rejected_count_;
+}
+
+}  // namespace audio
+}  // namespace kiwano
@@ -21,5 +21,12 @@
 #pragma once
 
 #include <kiwano-audio/AudioModule.h>
+#include <kiwano-audio/AudioDecoder.h>
+#include <kiwano-audio/AudioStream.h>
+#include <kiwano-audio/SoundBuffer.h>
+#include <kiwano-audio/VoicePool.h>
+#include <kiwano-audio/SampleConverter.h>
+#include <kiwano-audio/AudioSink.h>
+#include <kiwano-audio/AudioMixer.h>
 #include <kiwano-audio/Sound.h>
 #include <kiwano-audio/SoundPlayer.h>
@@ -28,12 +28,12 @@ namespace imgui
 KGE_DECLARE_SMART_PTR(ImGuiLayer);
 
 /// \~chinese
-/// @brief ImGuiܵ
+/// @brief ImGui管道
 using ImGuiPipeline = Function<void()>;
 
 /**
  * \~chinese
- * @brief ImGuiͼ
+ * @brief ImGui图层
  */
 class ImGuiLayer : public LayerActor
 {
@@ -41,27 +41,27 @@ public:
     ImGuiLayer();
 
     /// \~chinese
-    /// @brief ImGuiͼ
-    /// @param name Ԫ
-    /// @param item ܵ
+    /// @brief 创建ImGui图层
+    /// @param name 元素名称
+    /// @param item 管道
     ImGuiLayer(const String& name, const ImGuiPipeline& item);
 
     virtual ~ImGuiLayer();
 
     /// \~chinese
-    /// @brief  ImGui Ԫ
-    /// @param name Ԫ
-    /// @param item ܵ
+    /// @brief 添加 ImGui 元素
+    /// @param name 元素名称
+    /// @param item 管道
     void AddItem(const String& name, const ImGuiPipeline& item);
 
     /// \~chinese
-    /// @brief Ƴ ImGui Ԫ
-    /// @param name Ԫ
+    /// @brief 移除 ImGui 元素
+    /// @param name 元素名称
     void RemoveItem(const String& name);
 
-    // ƳԪ
+    // 移除所有元素
     /// \~chinese
-    /// @brief ƳԪ
+    /// @brief 移除所有元素
     void RemoveAllItems();
 
 public:
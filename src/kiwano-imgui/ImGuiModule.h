@@ -30,7 +30,7 @@ namespace imgui
 
 /**
  * \~chinese
- * @brief ImGuiģ
+ * @brief ImGui模块
  */
 class ImGuiModule
     : public Singleton<ImGuiModule>
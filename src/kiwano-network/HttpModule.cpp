@@ -18,8 +18,11 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <atomic>
+#include <algorithm>
 #include <chrono>
 #include <thread>
+#include <fstream>
 #include <kiwano/utils/Logger.h>
 #include <kiwano/platform/Application.h>
 #include <kiwano-network/HttpRequest.h>
@@ -27,15 +30,32 @@
 #include <kiwano-network/HttpModule.h>
 #include <curl/curl.h>  // CURL
 
+#pragma comment(lib, "ws2_32.lib")
+
 namespace
 {
 using namespace kiwano;
 using namespace kiwano::network;
 
-uint32_t write_data(void* buffer, uint32_t size, uint32_t nmemb, void* userp)
+// Longest time the network thread waits for socket activity, it is woken up earlier for new requests
+const int wait_timeout_ms = 1000;
+
+// How often paused streaming transfers check whether the main thread has caught up
+const int poll_interval_ms = 10;
+
+// Streamed response data is handed to the main thread in chunks of about this size
+const size_t stream_chunk_size = 64 * 1024;
+
+// A streaming transfer is paused while the main thread has this much data left to consume
+const size_t stream_pending_limit = 4 * 1024 * 1024;
+
+// Minimum interval between two progress callbacks
+const auto progress_interval = std::chrono::milliseconds(100);
+
+size_t write_data(void* buffer, size_t size, size_t nmemb, void* userp)
 {
-    String*  recv_buffer = (String*)userp;
-    uint32_t total       = size * nmemb;
+    String* recv_buffer = (String*)userp;
+    size_t  total       = size * nmemb;
 
     // add data to the end of recv_buffer
     // write data maybe called more than once in a single request
@@ -44,23 +64,37 @@ uint32_t write_data(void* buffer, uint32_t size, uint32_t nmemb, void* userp)
     return total;
 }
 
-class Curl
+class CurlTransfer
 {
 public:
-    Curl()
-        : curl_(curl_easy_init())
+    // Where the response body goes
+    enum class Sink
+    {
+        Memory,
+        Stream,
+        File,
+    };
+
+    CurlTransfer(CURL* curl, HttpRequestPtr request)
+        : curl_(curl)
         , curl_headers_(nullptr)
+        , request_(request)
+        , response_(MakePtr<HttpResponse>(request))
+        , sink_(Sink::Memory)
+        , body_started_(false)
+        , file_failed_(false)
+        , paused_(false)
+        , resume_offset_(0)
+        , received_bytes_(0)
+        , total_bytes_(0)
+        , start_time_(std::chrono::steady_clock::now())
+        , last_progress_time_(start_time_)
     {
+        error_buffer_[0] = 0;
     }
 
-    ~Curl()
+    ~CurlTransfer()
     {
-        if (curl_)
-        {
-            curl_easy_cleanup(curl_);
-            curl_ = nullptr;
-        }
-
         if (curl_headers_)
         {
             curl_slist_free_all(curl_headers_);
@@ -68,14 +102,46 @@ public:
         }
     }
 
-    bool Init(HttpModule* client, const Vector<String>& headers, const String& url, String* response_data,
-              String* response_header, char* error_buffer)
+    inline HttpRequestPtr GetRequest() const
     {
-        if (!SetOption(CURLOPT_ERRORBUFFER, error_buffer))
-            return false;
-        if (!SetOption(CURLOPT_TIMEOUT, client->GetTimeoutForRead()))
+        return request_;
+    }
+
+    inline HttpResponsePtr GetResponse() const
+    {
+        return response_;
+    }
+
+    bool Init(HttpModule* client, CURLSH* share)
+    {
+        if (!SetOption(CURLOPT_ERRORBUFFER, error_buffer_))
             return false;
-        if (!SetOption(CURLOPT_CONNECTTIMEOUT, client->GetTimeoutForConnect()))
+        Duration timeout_for_read    = request_->GetTimeoutForRead();
+        Duration timeout_for_connect = request_->GetTimeoutForConnect();
+        if (timeout_for_read.IsZero())
+            timeout_for_read = client->GetTimeoutForRead();
+        if (timeout_for_connect.IsZero())
+            timeout_for_connect = client->GetTimeoutForConnect();
+
+        if (!request_->GetDownloadFile().empty() || request_->GetDataCallback())
+        {
+            // Downloads and streams may take any time, only a stalled transfer times out
+            long stall_seconds = std::max(long((timeout_for_read.GetMilliseconds() + 999) / 1000), 1L);
+            if (!SetOption(CURLOPT_LOW_SPEED_LIMIT, 1L))
+                return false;
+            if (!SetOption(CURLOPT_LOW_SPEED_TIME, stall_seconds))
+                return false;
+
+            Duration total_timeout = request_->GetTimeoutForRead();
+            if (!total_timeout.IsZero() && !SetOption(CURLOPT_TIMEOUT_MS, long(total_timeout.GetMilliseconds())))
+                return false;
+        }
+        else
+        {
+            if (!SetOption(CURLOPT_TIMEOUT_MS, long(timeout_for_read.GetMilliseconds())))
+                return false;
+        }
+        if (!SetOption(CURLOPT_CONNECTTIMEOUT_MS, long(timeout_for_connect.GetMilliseconds())))
             return false;
 
         const String& ssl_ca_file = client->GetSSLVerification();
@@ -101,29 +167,173 @@ public:
         if (!SetOption(CURLOPT_ACCEPT_ENCODING, ""))
             return false;
 
+        // share DNS cache and TLS sessions between all requests
+        if (share && !SetOption(CURLOPT_SHARE, share))
+            return false;
+
+        if (client->IsKeepAlive())
+        {
+            if (!SetOption(CURLOPT_TCP_KEEPALIVE, 1L))
+                return false;
+        }
+        else
+        {
+            if (!SetOption(CURLOPT_FORBID_REUSE, 1L))
+                return false;
+        }
+
         // set request headers
-        if (!headers.empty())
+        for (const auto& pair : request_->GetHeaders())
         {
-            for (const auto& header : headers)
+            String header = pair.first + ":" + pair.second;
+            curl_headers_ = curl_slist_append(curl_headers_, header.c_str());
+        }
+
+        // resume a download with a range request
+        const String& file_path = request_->GetDownloadFile();
+        if (!file_path.empty() && request_->IsDownloadResumable() && request_->GetType() == HttpType::Get)
+        {
+            std::ifstream ifs(file_path.c_str(), std::ios::binary | std::ios::ate);
+            if (ifs && ifs.tellg() > 0)
             {
-                curl_headers_ = curl_slist_append(curl_headers_, header.c_str());
+                resume_offset_ = uint64_t(ifs.tellg());
+
+                String range  = "Range:bytes=" + std::to_string(resume_offset_) + "-";
+                curl_headers_ = curl_slist_append(curl_headers_, range.c_str());
             }
-            if (!SetOption(CURLOPT_HTTPHEADER, curl_headers_))
+        }
+
+        if (curl_headers_ && !SetOption(CURLOPT_HTTPHEADER, curl_headers_))
+            return false;
+
+        if (!SetOption(CURLOPT_URL, request_->GetUrl().c_str()) || !SetOption(CURLOPT_WRITEFUNCTION, WriteBody)
+            || !SetOption(CURLOPT_WRITEDATA, this) || !SetOption(CURLOPT_HEADERFUNCTION, write_data)
+            || !SetOption(CURLOPT_HEADERDATA, &response_header_))
+            return false;
+
+        if (request_->GetProgressCallback())
+        {
+            if (!SetOption(CURLOPT_NOPROGRESS, 0L) || !SetOption(CURLOPT_XFERINFOFUNCTION, UpdateProgress)
+                || !SetOption(CURLOPT_XFERINFODATA, this))
                 return false;
         }
 
-        return SetOption(CURLOPT_URL, url.c_str()) && SetOption(CURLOPT_WRITEFUNCTION, write_data)
-               && SetOption(CURLOPT_WRITEDATA, response_data) && SetOption(CURLOPT_HEADERFUNCTION, write_data)
-               && SetOption(CURLOPT_HEADERDATA, response_header);
+        request_data_ = request_->GetData();
+
+        switch (request_->GetType())
+        {
+        case HttpType::Get:
+            return SetOption(CURLOPT_FOLLOWLOCATION, 1L);
+        case HttpType::Post:
+            return SetOption(CURLOPT_POST, 1L) && SetOption(CURLOPT_POSTFIELDSIZE, long(request_data_.size()))
+                   && SetOption(CURLOPT_POSTFIELDS, request_data_.c_str());
+        case HttpType::Put:
+            return SetOption(CURLOPT_CUSTOMREQUEST, "PUT")
+                   && SetOption(CURLOPT_POSTFIELDSIZE, long(request_data_.size()))
+                   && SetOption(CURLOPT_POSTFIELDS, request_data_.c_str());
+        case HttpType::Delete:
+            return SetOption(CURLOPT_CUSTOMREQUEST, "DELETE") && SetOption(CURLOPT_FOLLOWLOCATION, 1L);
+        default:
+            KGE_ERRORF("HttpModule: unknown request type, only GET, POST, PUT or DELETE is supported");
+            return false;
+        }
     }
 
-    bool Perform(long* response_code)
+    void Finish(CURLcode result)
     {
-        if (CURLE_OK != curl_easy_perform(curl_))
-            return false;
+        long response_code = 0;
+        curl_easy_getinfo(curl_, CURLINFO_RESPONSE_CODE, &response_code);
+
+        bool ok = (result == CURLE_OK) && (response_code >= 200 && response_code < 300);
+
+        const String& file_path = request_->GetDownloadFile();
+        if (!file_path.empty())
+        {
+            if (result == CURLE_OK && response_code == 416 && resume_offset_ > 0)
+            {
+                // the requested range starts at the end of file, so the download has already completed
+                ok = true;
+            }
+            else if (ok && !body_started_)
+            {
+                // empty response body
+                file_.open(file_path.c_str(), std::ios::binary | std::ios::trunc);
+                file_failed_ = !file_;
+                ok           = !file_failed_;
+            }
+
+            if (file_.is_open())
+            {
+                file_.close();
+                if (!file_)
+                    file_failed_ = true;
+            }
+
+            if (file_failed_)
+            {
+                ok = false;
+                KGE_ERRORF("HttpModule: failed to write file '%s'", file_path.c_str());
+            }
+        }
+
+        FlushChunk();
+
+        if (request_->GetProgressCallback())
+        {
+            PostProgress(ok);
+        }
+
+        response_->SetResponseCode(response_code);
+        response_->SetHeader(response_header_);
+        response_->SetData(BinaryData(std::move(response_data_)));
+        response_->SetSucceed(ok);
+        if (!ok)
+        {
+            if (file_failed_)
+                response_->SetError("failed to write file: " + file_path);
+            else if (error_buffer_[0] == 0 && result != CURLE_OK)
+                response_->SetError(curl_easy_strerror(result));
+            else
+                response_->SetError(error_buffer_);
+        }
+    }
+
+    // Hand streamed data received so far to the main thread
+    void FlushChunk()
+    {
+        if (chunk_.empty())
+            return;
+
+        HttpRequestPtr request = request_;
+        BinaryData     chunk(std::move(chunk_));
+        chunk_.clear();
 
-        CURLcode code = curl_easy_getinfo(curl_, CURLINFO_RESPONSE_CODE, response_code);
-        return code == CURLE_OK && (*response_code >= 200 && *response_code < 300);
+        auto pending = pending_bytes_;
+        *pending += size_t(chunk.GetSize());
+
+        Application::GetInstance().PreformInMainThread([=]() {
+            const auto& callback = request->GetDataCallback();
+            if (callback && !request->IsCancelled())
+            {
+                callback(request.Get(), chunk);
+            }
+            *pending -= size_t(chunk.GetSize());
+        });
+    }
+
+    inline bool IsPaused() const
+    {
+        return paused_;
+    }
+
+    // Resume a streaming transfer once the main thread has caught up
+    void ResumeIfDrained()
+    {
+        if (paused_ && *pending_bytes_ < stream_pending_limit)
+        {
+            paused_ = false;
+            curl_easy_pause(curl_, CURLPAUSE_CONT);
+        }
     }
 
     template <typename... _Args>
@@ -132,50 +342,425 @@ public:
         return CURLE_OK == curl_easy_setopt(curl_, option, std::forward<_Args>(args)...);
     }
 
+private:
+    static size_t WriteBody(char* buffer, size_t size, size_t nmemb, void* userp)
+    {
+        return ((CurlTransfer*)userp)->OnBody(buffer, size * nmemb);
+    }
+
+    static int UpdateProgress(void* userp, curl_off_t dltotal, curl_off_t dlnow, curl_off_t, curl_off_t)
+    {
+        CurlTransfer* transfer = (CurlTransfer*)userp;
+        if (transfer->request_->IsCancelled())
+            return 1;  // abort the transfer
+
+        transfer->total_bytes_ = dltotal > 0 ? uint64_t(dltotal) : 0;
+
+        auto now = std::chrono::steady_clock::now();
+        if (now - transfer->last_progress_time_ >= progress_interval)
+        {
+            transfer->last_progress_time_ = now;
+            transfer->PostProgress();
+        }
+        return 0;
+    }
+
+    size_t OnBody(const char* data, size_t size)
+    {
+        if (request_->IsCancelled())
+            return 0;  // abort the transfer
+
+        if (!body_started_)
+        {
+            body_started_ = true;
+            StartBody();
+        }
+
+        if (sink_ == Sink::Stream && *pending_bytes_ >= stream_pending_limit)
+        {
+            // curl keeps the data and delivers it again after the transfer is resumed
+            paused_ = true;
+            return CURL_WRITEFUNC_PAUSE;
+        }
+
+        received_bytes_ += size;
+
+        switch (sink_)
+        {
+        case Sink::Memory:
+            response_data_.append(data, size);
+            break;
+        case Sink::Stream:
+            chunk_.append(data, size);
+            if (chunk_.size() >= stream_chunk_size)
+                FlushChunk();
+            break;
+        case Sink::File:
+            if (file_failed_)
+                return 0;  // abort the transfer
+            file_.write(data, std::streamsize(size));
+            if (!file_)
+            {
+                file_failed_ = true;
+                return 0;
+            }
+            break;
+        }
+        return size;
+    }
+
+    // Choose where the body goes once the final status code is known
+    void StartBody()
+    {
+        long response_code = 0;
+        curl_easy_getinfo(curl_, CURLINFO_RESPONSE_CODE, &response_code);
+
+        if (response_code < 200 || response_code >= 300)
+        {
+            // keep error pages in memory
+            if (response_code != 416)
+                resume_offset_ = 0;
+            return;
+        }
+
+        const String& file_path = request_->GetDownloadFile();
+        if (!file_path.empty())
+        {
+            bool append = (resume_offset_ > 0 && response_code == 206);
+            if (!append)
+                resume_offset_ = 0;
+
+            file_.open(file_path.c_str(), std::ios::binary | (append ? std::ios::app : std::ios::trunc));
+            file_failed_ = !file_;
+            sink_        = Sink::File;
+        }
+        else if (request_->GetDataCallback())
+        {
+            chunk_.reserve(stream_chunk_size + CURL_MAX_WRITE_SIZE);
+            pending_bytes_ = std::make_shared<std::atomic<size_t>>(0);
+            sink_          = Sink::Stream;
+        }
+        else
+        {
+            double content_length = -1;
+            curl_easy_getinfo(curl_, CURLINFO_CONTENT_LENGTH_DOWNLOAD, &content_length);
+            if (content_length > 0)
+                response_data_.reserve(size_t(content_length));
+        }
+    }
+
+    void PostProgress(bool completed = false)
+    {
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time_).count();
+
+        HttpProgress progress;
+        progress.received_bytes = resume_offset_ + received_bytes_;
+        if (completed)
+            progress.total_bytes = progress.received_bytes;
+        else
+            progress.total_bytes = total_bytes_ ? resume_offset_ + total_bytes_ : 0;
+        progress.bytes_per_second = elapsed > 0 ? double(received_bytes_) / elapsed : 0;
+
+        HttpRequestPtr request = request_;
+        Application::GetInstance().PreformInMainThread([=]() {
+            const auto& callback = request->GetProgressCallback();
+            if (callback && !request->IsCancelled())
+            {
+                callback(request.Get(), progress);
+            }
+        });
+    }
+
+private:
+    CURL*           curl_;
+    curl_slist*     curl_headers_;
+    HttpRequestPtr  request_;
+    HttpResponsePtr response_;
+    String          request_data_;
+    String          response_data_;
+    String          response_header_;
+    char            error_buffer_[CURL_ERROR_SIZE];
+
+    Sink          sink_;
+    bool          body_started_;
+    bool          file_failed_;
+    bool          paused_;
+    uint64_t      resume_offset_;
+    uint64_t      received_bytes_;
+    uint64_t      total_bytes_;
+    String        chunk_;
+    std::ofstream file_;
+
+    std::shared_ptr<std::atomic<size_t>> pending_bytes_;
+
+    std::chrono::steady_clock::time_point start_time_;
+    std::chrono::steady_clock::time_point last_progress_time_;
+};
+
+// Returns "scheme://host:port" of a url, requests with the same key share the per-host connection limit
+String GetHostKey(const String& url)
+{
+    size_t scheme_end = url.find("://");
+    scheme_end        = (scheme_end == String::npos) ? 0 : scheme_end + 3;
+
+    size_t end = url.find_first_of("/?#", scheme_end);
+    if (end == String::npos)
+        end = url.size();
+
+    // skip user info
+    size_t start = url.rfind('@', end);
+    start        = (start != String::npos && start >= scheme_end) ? start + 1 : scheme_end;
+
+    String host = url.substr(0, scheme_end);
+    host.append(url, start, end - start);
+    std::transform(host.begin(), host.end(), host.begin(), ::tolower);
+    return host;
+}
+
+// A loopback UDP socket connected to itself, sending a byte to it interrupts curl_multi_wait
+curl_socket_t OpenWakeupSocket()
+{
+    curl_socket_t sock = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (sock == CURL_SOCKET_BAD)
+        return CURL_SOCKET_BAD;
+
+    sockaddr_in addr      = {};
+    int         addr_len  = int(sizeof(addr));
+    u_long      non_block = 1;
+    addr.sin_family       = AF_INET;
+    addr.sin_addr.s_addr  = htonl(INADDR_LOOPBACK);
+    addr.sin_port         = 0;
+
+    if (::bind(sock, (sockaddr*)&addr, addr_len) != 0 || ::getsockname(sock, (sockaddr*)&addr, &addr_len) != 0
+        || ::connect(sock, (sockaddr*)&addr, addr_len) != 0 || ::ioctlsocket(sock, FIONBIO, &non_block) != 0)
+    {
+        ::closesocket(sock);
+        return CURL_SOCKET_BAD;
+    }
+    return sock;
+}
+
+class CurlMulti
+{
 public:
-    static inline bool GetRequest(HttpModule* client, const Vector<String>& headers, const String& url,
-                                  long* response_code, String* response_data, String* response_header,
-                                  char* error_buffer)
+    CurlMulti()
+        : multi_(curl_multi_init())
+        , share_(curl_share_init())
+        , max_total_(0)
+        , max_per_host_(0)
     {
-        Curl curl;
-        return curl.Init(client, headers, url, response_data, response_header, error_buffer)
-               && curl.SetOption(CURLOPT_FOLLOWLOCATION, true) && curl.Perform(response_code);
+        if (share_)
+        {
+            curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+            curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+        }
     }
 
-    static inline bool PostRequest(HttpModule* client, const Vector<String>& headers, const String& url,
-                                   const String& request_data, long* response_code, String* response_data,
-                                   String* response_header, char* error_buffer)
+    ~CurlMulti()
     {
-        Curl curl;
-        return curl.Init(client, headers, url, response_data, response_header, error_buffer)
-               && curl.SetOption(CURLOPT_POST, 1) && curl.SetOption(CURLOPT_POSTFIELDS, request_data.c_str())
-               && curl.SetOption(CURLOPT_POSTFIELDSIZE, request_data.size()) && curl.Perform(response_code);
+        for (auto& pair : transfers_)
+        {
+            curl_multi_remove_handle(multi_, pair.first);
+            curl_easy_cleanup(pair.first);
+        }
+        transfers_.clear();
+
+        for (auto curl : idle_handles_)
+        {
+            curl_easy_cleanup(curl);
+        }
+        idle_handles_.clear();
+
+        if (multi_)
+        {
+            curl_multi_cleanup(multi_);
+            multi_ = nullptr;
+        }
+
+        if (share_)
+        {
+            curl_share_cleanup(share_);
+            share_ = nullptr;
+        }
+    }
+
+    inline size_t GetRunningCount() const
+    {
+        return transfers_.size();
     }
 
-    static inline bool PutRequest(HttpModule* client, const Vector<String>& headers, const String& url,
-                                  const String& request_data, long* response_code, String* response_data,
-                                  String* response_header, char* error_buffer)
+    inline bool IsEmpty() const
     {
-        Curl curl;
-        return curl.Init(client, headers, url, response_data, response_header, error_buffer)
-               && curl.SetOption(CURLOPT_CUSTOMREQUEST, "PUT")
-               && curl.SetOption(CURLOPT_POSTFIELDS, request_data.c_str())
-               && curl.SetOption(CURLOPT_POSTFIELDSIZE, request_data.size()) && curl.Perform(response_code);
+        return transfers_.empty();
     }
 
-    static inline bool DeleteRequest(HttpModule* client, const Vector<String>& headers, const String& url,
-                                     long* response_code, String* response_data, String* response_header,
-                                     char* error_buffer)
+    inline Vector<HttpResponsePtr>& GetFinished()
     {
-        Curl curl;
-        return curl.Init(client, headers, url, response_data, response_header, error_buffer)
-               && curl.SetOption(CURLOPT_CUSTOMREQUEST, "DELETE") && curl.SetOption(CURLOPT_FOLLOWLOCATION, true)
-               && curl.Perform(response_code);
+        return finished_;
+    }
+
+    void SetLimits(uint32_t max_total, uint32_t max_per_host)
+    {
+        if (max_total_ != max_total)
+        {
+            max_total_ = max_total;
+            curl_multi_setopt(multi_, CURLMOPT_MAX_TOTAL_CONNECTIONS, long(max_total));
+
+            while (idle_handles_.size() > max_total)
+            {
+                curl_easy_cleanup(idle_handles_.back());
+                idle_handles_.pop_back();
+            }
+        }
+
+        if (max_per_host_ != max_per_host)
+        {
+            max_per_host_ = max_per_host;
+            curl_multi_setopt(multi_, CURLMOPT_MAX_HOST_CONNECTIONS, long(max_per_host));
+        }
+    }
+
+    void Add(HttpModule* client, HttpRequestPtr request)
+    {
+        CURL* curl = AcquireHandle();
+        if (!curl)
+        {
+            HttpResponsePtr response = MakePtr<HttpResponse>(request);
+            response->SetError("failed to create curl handle");
+            finished_.push_back(response);
+            return;
+        }
+
+        std::unique_ptr<CurlTransfer> transfer(new CurlTransfer(curl, request));
+        if (!transfer->Init(client, share_) || CURLM_OK != curl_multi_add_handle(multi_, curl))
+        {
+            transfer->Finish(CURLE_FAILED_INIT);
+            finished_.push_back(transfer->GetResponse());
+            ReleaseHandle(curl);
+            return;
+        }
+        transfers_[curl] = std::move(transfer);
+    }
+
+    // Abort transfers whose requests have been cancelled
+    void RemoveCancelled(Vector<HttpRequestPtr>& cancelled)
+    {
+        for (auto iter = transfers_.begin(); iter != transfers_.end();)
+        {
+            if (iter->second->GetRequest()->IsCancelled())
+            {
+                CURL* curl = iter->first;
+                curl_multi_remove_handle(multi_, curl);
+                cancelled.push_back(iter->second->GetRequest());
+                iter = transfers_.erase(iter);
+                ReleaseHandle(curl);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+    }
+
+    void Perform()
+    {
+        int running = 0;
+        while (curl_multi_perform(multi_, &running) == CURLM_CALL_MULTI_PERFORM)
+            continue;
+
+        // don't hold back streamed data on slow connections
+        for (auto& pair : transfers_)
+        {
+            pair.second->FlushChunk();
+            pair.second->ResumeIfDrained();
+        }
+
+        int      msgs_left = 0;
+        CURLMsg* msg       = nullptr;
+        while ((msg = curl_multi_info_read(multi_, &msgs_left)) != nullptr)
+        {
+            if (msg->msg != CURLMSG_DONE)
+                continue;
+
+            CURL*    curl   = msg->easy_handle;
+            CURLcode result = msg->data.result;
+
+            curl_multi_remove_handle(multi_, curl);
+
+            auto iter = transfers_.find(curl);
+            if (iter != transfers_.end())
+            {
+                iter->second->Finish(result);
+                finished_.push_back(iter->second->GetResponse());
+                transfers_.erase(iter);
+            }
+            ReleaseHandle(curl);
+        }
+    }
+
+    bool HasPaused() const
+    {
+        for (const auto& pair : transfers_)
+        {
+            if (pair.second->IsPaused())
+                return true;
+        }
+        return false;
+    }
+
+    // Wait for socket activity of the transfers or a wakeup signal
+    void Wait(curl_socket_t wakeup, int timeout_ms)
+    {
+        if (wakeup == CURL_SOCKET_BAD)
+        {
+            // curl returns at once when it has no sockets to wait on
+            int numfds = 0;
+            if (CURLM_OK != curl_multi_wait(multi_, nullptr, 0, timeout_ms, &numfds) || numfds == 0)
+                std::this_thread::sleep_for(std::chrono::milliseconds(poll_interval_ms));
+            return;
+        }
+
+        curl_waitfd waitfd = {};
+        waitfd.fd          = wakeup;
+        waitfd.events      = CURL_WAIT_POLLIN;
+        curl_multi_wait(multi_, &waitfd, 1, timeout_ms, nullptr);
+
+        if (waitfd.revents & CURL_WAIT_POLLIN)
+        {
+            char buffer[64];
+            while (::recv(wakeup, buffer, int(sizeof(buffer)), 0) > 0)
+                continue;
+        }
     }
 
 private:
-    CURL*       curl_;
-    curl_slist* curl_headers_;
+    CURL* AcquireHandle()
+    {
+        if (!idle_handles_.empty())
+        {
+            CURL* curl = idle_handles_.back();
+            idle_handles_.pop_back();
+            return curl;
+        }
+        return curl_easy_init();
+    }
+
+    void ReleaseHandle(CURL* curl)
+    {
+        // connections live in the multi handle, so a reset handle still reuses them
+        curl_easy_reset(curl);
+        idle_handles_.push_back(curl);
+    }
+
+private:
+    CURLM*   multi_;
+    CURLSH*  share_;
+    uint32_t max_total_;
+    uint32_t max_per_host_;
+
+    Vector<CURL*>                                      idle_handles_;
+    UnorderedMap<CURL*, std::unique_ptr<CurlTransfer>> transfers_;
+    Vector<HttpResponsePtr>                            finished_;
 };
 }  // namespace
 
@@ -186,7 +771,13 @@ namespace network
 HttpModule::HttpModule()
     : timeout_for_connect_(30000 /* 30 seconds */)
     , timeout_for_read_(60000 /* 60 seconds */)
+    , max_concurrency_(8)
+    , max_connections_per_host_(6)
+    , keep_alive_(true)
+    , max_queue_size_(256)
+    , queued_count_(0)
     , quit_flag_(false)
+    , wakeup_socket_(uintptr_t(CURL_SOCKET_BAD))
 {
 }
 
@@ -194,126 +785,238 @@ void HttpModule::SetupModule()
 {
     ::curl_global_init(CURL_GLOBAL_ALL);
 
-    std::thread thread(Closure(this, &HttpModule::NetworkThread));
-    thread.detach();
+    wakeup_socket_ = uintptr_t(OpenWakeupSocket());
+    if (curl_socket_t(wakeup_socket_) == CURL_SOCKET_BAD)
+    {
+        KGE_WARNF("HttpModule: failed to create the wakeup socket, the network thread falls back to polling");
+    }
+
+    quit_flag_      = false;
+    network_thread_ = std::thread(Closure(this, &HttpModule::NetworkThread));
 }
 
 void HttpModule::DestroyModule()
 {
     // Set quit flag
-    quit_flag_ = true;
-
-    // Send a fake request
     {
         std::unique_lock<std::mutex> lock(request_mutex_);
-        request_queue_.push(nullptr);
+        quit_flag_ = true;
     }
 
     // Notify work thread
-    sleep_cond_.notify_one();
+    WakeUp();
+
+    // Wait for work thread to abort its transfers and exit
+    if (network_thread_.joinable())
+    {
+        network_thread_.join();
+    }
+
+    // Drop requests that were never sent
+    {
+        std::unique_lock<std::mutex> lock(request_mutex_);
+        for (auto& queue : request_queues_)
+        {
+            queue.clear();
+        }
+        queued_count_ = 0;
+        running_requests_.clear();
+    }
 
-    // Wait for work thread destroyed
+    if (curl_socket_t(wakeup_socket_) != CURL_SOCKET_BAD)
     {
-        std::unique_lock<std::mutex> lock(quit_mutex_);
-        quit_cond_.wait_for(lock, std::chrono::seconds(1));
+        ::closesocket(curl_socket_t(wakeup_socket_));
+        wakeup_socket_ = uintptr_t(CURL_SOCKET_BAD);
     }
 
     // Clear curl resources
     ::curl_global_cleanup();
 }
 
-void HttpModule::Send(HttpRequestPtr request)
+bool HttpModule::Send(HttpRequestPtr request)
 {
     if (!request)
-        return;
+        return false;
+
+    {
+        std::unique_lock<std::mutex> lock(request_mutex_);
+        if (max_queue_size_ && queued_count_ >= max_queue_size_)
+        {
+            RemoveCancelledRequests();
+            if (queued_count_ >= max_queue_size_)
+            {
+                KGE_WARNF("HttpModule: request queue is full, request to '%s' is rejected", request->GetUrl().c_str());
+                return false;
+            }
+        }
 
+        request_queues_[int(request->GetPriority())].push_back(request);
+        ++queued_count_;
+    }
+    WakeUp();
+    return true;
+}
+
+void HttpModule::CancelAll()
+{
     {
         std::unique_lock<std::mutex> lock(request_mutex_);
-        request_queue_.push(request);
+        for (auto& queue : request_queues_)
+        {
+            for (auto& request : queue)
+            {
+                request->Cancel();
+            }
+            queue.clear();
+        }
+        queued_count_ = 0;
+
+        // running requests are aborted by the network thread
+        for (auto& request : running_requests_)
+        {
+            request->Cancel();
+        }
+    }
+    WakeUp();
+}
+
+void HttpModule::WakeUp()
+{
+    curl_socket_t sock = curl_socket_t(wakeup_socket_);
+    if (sock != CURL_SOCKET_BAD)
+    {
+        const char signal = 0;
+        ::send(sock, &signal, 1, 0);
+    }
+}
+
+bool HttpModule::PopRequest(HttpRequestPtr& request, const UnorderedMap<String, uint32_t>& host_connections)
+{
+    const uint32_t max_per_host = max_connections_per_host_;
+
+    // Higher priority first, requests to a host that has reached the connection limit stay in the queue
+    for (int i = int(HttpPriority::High); i >= int(HttpPriority::Low); --i)
+    {
+        auto& queue = request_queues_[i];
+        for (auto iter = queue.begin(); iter != queue.end();)
+        {
+            if ((*iter)->IsCancelled())
+            {
+                iter = queue.erase(iter);
+                --queued_count_;
+                continue;
+            }
+
+            if (max_per_host)
+            {
+                auto host = host_connections.find(GetHostKey((*iter)->GetUrl()));
+                if (host != host_connections.end() && host->second >= max_per_host)
+                {
+                    ++iter;
+                    continue;
+                }
+            }
+
+            request = *iter;
+            queue.erase(iter);
+            --queued_count_;
+            return true;
+        }
+    }
+    return false;
+}
+
+void HttpModule::RemoveCancelledRequests()
+{
+    for (auto& queue : request_queues_)
+    {
+        auto iter = std::remove_if(queue.begin(), queue.end(),
+                                   [](const HttpRequestPtr& request) { return request->IsCancelled(); });
+        queued_count_ -= size_t(std::distance(iter, queue.end()));
+        queue.erase(iter, queue.end());
     }
-    sleep_cond_.notify_one();
 }
 
 void HttpModule::NetworkThread()
 {
-    while (true)
+    CurlMulti multi;
+
+    UnorderedMap<String, uint32_t> host_connections;  // running requests of each host
+    Vector<HttpRequestPtr>         requests;
+    Vector<HttpRequestPtr>         done_requests;
+    while (!quit_flag_)
     {
-        HttpRequestPtr request;
         {
             std::unique_lock<std::mutex> lock(request_mutex_);
-            sleep_cond_.wait(lock, [&]() { return !request_queue_.empty(); });
 
-            request = request_queue_.front();
-            request_queue_.pop();
+            // Take as many requests as the concurrency limits allow
+            size_t         running = multi.GetRunningCount();
+            HttpRequestPtr request;
+            while (running + requests.size() < max_concurrency_ && PopRequest(request, host_connections))
+            {
+                ++host_connections[GetHostKey(request->GetUrl())];
+                requests.push_back(request);
+                running_requests_.push_back(request);
+            }
         }
 
         if (quit_flag_)
+            break;
+
+        multi.SetLimits(max_concurrency_, max_connections_per_host_);
+        multi.RemoveCancelled(done_requests);
+        for (auto& request : requests)
         {
-            quit_cond_.notify_one();
-            return;
+            if (request->IsCancelled())
+                done_requests.push_back(request);
+            else
+                multi.Add(this, request);
         }
+        requests.clear();
 
-        HttpResponsePtr response = MakePtr<HttpResponse>(request);
-        Perform(request, response);
+        multi.Perform();
+
+        auto& finished = multi.GetFinished();
+        for (auto& response : finished)
+        {
+            done_requests.push_back(response->GetRequest());
+            DispatchResponse(response);
+        }
+        finished.clear();
+
+        if (!done_requests.empty())
+        {
+            // Slots are freed, take queued requests before waiting again
+            for (auto& request : done_requests)
+            {
+                auto host = host_connections.find(GetHostKey(request->GetUrl()));
+                if (host != host_connections.end() && --host->second == 0)
+                    host_connections.erase(host);
+            }
 
-        response_mutex_.lock();
-        response_queue_.push(response);
-        response_mutex_.unlock();
+            std::unique_lock<std::mutex> lock(request_mutex_);
+            for (auto& request : done_requests)
+            {
+                auto iter = std::find(running_requests_.begin(), running_requests_.end(), request);
+                if (iter != running_requests_.end())
+                    running_requests_.erase(iter);
+            }
+            done_requests.clear();
+            continue;
+        }
 
-        Application::GetInstance().PreformInMainThread(Closure(this, &HttpModule::DispatchResponseCallback));
+        // Send, CancelAll, limit changes and DestroyModule interrupt the wait
+        multi.Wait(curl_socket_t(wakeup_socket_), multi.HasPaused() ? poll_interval_ms : wait_timeout_ms);
     }
 }
 
-void HttpModule::Perform(HttpRequestPtr request, HttpResponsePtr response)
+void HttpModule::DispatchResponse(HttpResponsePtr response)
 {
-    bool   ok                 = false;
-    long   response_code      = 0;
-    char   error_message[256] = { 0 };
-    String response_header;
-    String response_data;
-    String url  = request->GetUrl();
-    String data = request->GetData();
-
-    Vector<String> headers;
-    headers.reserve(request->GetHeaders().size());
-    for (const auto& pair : request->GetHeaders())
-    {
-        headers.push_back(pair.first + ":" + pair.second);
-    }
-
-    switch (request->GetType())
-    {
-    case HttpType::Get:
-        ok = Curl::GetRequest(this, headers, url, &response_code, &response_data, &response_header, error_message);
-        break;
-    case HttpType::Post:
-        ok = Curl::PostRequest(this, headers, url, data, &response_code, &response_data, &response_header,
-                               error_message);
-        break;
-    case HttpType::Put:
-        ok =
-            Curl::PutRequest(this, headers, url, data, &response_code, &response_data, &response_header, error_message);
-        break;
-    case HttpType::Delete:
-        ok = Curl::DeleteRequest(this, headers, url, &response_code, &response_data, &response_header, error_message);
-        break;
-    default:
-        KGE_ERRORF("HttpModule: unknown request type, only GET, POST, PUT or DELETE is supported");
-        return;
-    }
-
-    response->SetResponseCode(response_code);
-    response->SetHeader(response_header);
-    response->SetData(response_data);
-    if (!ok)
-    {
-        response->SetSucceed(false);
-        response->SetError(error_message);
-    }
-    else
-    {
-        response->SetSucceed(true);
-    }
+    response_mutex_.lock();
+    response_queue_.push(response);
+    response_mutex_.unlock();
+
+    Application::GetInstance().PreformInMainThread(Closure(this, &HttpModule::DispatchResponseCallback));
 }
 
 void HttpModule::DispatchResponseCallback()
@@ -328,7 +1031,7 @@ void HttpModule::DispatchResponseCallback()
     }
     response_mutex_.unlock();
 
-    if (response)
+    if (response && !response->GetRequest()->IsCancelled())
     {
         HttpRequestPtr request  = response->GetRequest();
         const auto&    callback = request->GetResponseCallback();
@@ -21,7 +21,7 @@
 #pragma once
 #include <atomic>
 #include <mutex>
-#include <condition_variable>
+#include <thread>
 #include <kiwano/core/Common.h>
 #include <kiwano/base/Module.h>
 
@@ -31,7 +31,7 @@ namespace network
 {
 /**
  * \~chinese
- * \defgroup Network ģ
+ * \defgroup Network 网络模块
  */
 
 /**
@@ -41,7 +41,8 @@ namespace network
 
 /**
  * \~chinese
- * @brief HTTPģ
+ * @brief HTTP模块
+ * @details 网络线程使用 curl multi 接口并发执行请求，空闲的连接和 curl 句柄会被复用
  */
 class KGE_API HttpModule
     : public Singleton<HttpModule>
@@ -51,33 +52,81 @@ class KGE_API HttpModule
 
 public:
     /// \~chinese
-    /// @brief HTTP
-    /// @param[in] request HTTP
-    /// @details ۽ʧܶӦص
-    void Send(HttpRequestPtr request);
+    /// @brief 发送HTTP请求
+    /// @param[in] request HTTP请求
+    /// @details 发送请求后，无论结束或失败都将调用请求的响应回调函数，被取消的请求除外
+    /// @return 请求队列已满时返回 false，请求不会被发送
+    bool Send(HttpRequestPtr request);
 
     /// \~chinese
-    /// @brief ӳʱʱ
+    /// @brief 取消所有排队中和进行中的请求
+    /// @details 适用于切换场景时中断不再需要的请求
+    void CancelAll();
+
+    /// \~chinese
+    /// @brief 获取排队中的请求数
+    size_t GetQueuedCount() const;
+
+    /// \~chinese
+    /// @brief 设置请求队列的最大长度
+    /// @details 队列已满时 Send 会拒绝新的请求，默认为 256，设置为 0 时不限制
+    void SetMaxQueueSize(size_t max_size);
+
+    /// \~chinese
+    /// @brief 获取请求队列的最大长度
+    size_t GetMaxQueueSize() const;
+
+    /// \~chinese
+    /// @brief 设置连接超时时长
     void SetTimeoutForConnect(Duration timeout);
 
     /// \~chinese
-    /// @brief ȡӳʱʱ
+    /// @brief 获取连接超时时长
     Duration GetTimeoutForConnect() const;
 
     /// \~chinese
-    /// @brief öȡʱʱ
+    /// @brief 设置读取超时时长
+    /// @details 普通请求中为整个请求允许的最长时间；下载到文件和流式接收的请求没有总时长限制，
+    /// 只在持续这么长时间没有收到数据时超时
     void SetTimeoutForRead(Duration timeout);
 
     /// \~chinese
-    /// @brief ȡȡʱʱ
+    /// @brief 获取读取超时时长
     Duration GetTimeoutForRead() const;
 
     /// \~chinese
-    /// @brief SSLַ֤
+    /// @brief 设置最大并发请求数
+    /// @details 超出的请求在队列中等待，默认为 8
+    void SetMaxConcurrency(uint32_t max_concurrency);
+
+    /// \~chinese
+    /// @brief 获取最大并发请求数
+    uint32_t GetMaxConcurrency() const;
+
+    /// \~chinese
+    /// @brief 设置单个主机的最大连接数
+    /// @details 默认为 6，设置为 0 时不限制。同一主机上进行中的请求达到上限时，后续请求在队列中等待
+    void SetMaxConnectionsPerHost(uint32_t max_connections);
+
+    /// \~chinese
+    /// @brief 获取单个主机的最大连接数
+    uint32_t GetMaxConnectionsPerHost() const;
+
+    /// \~chinese
+    /// @brief 设置是否保持连接
+    /// @details 开启时请求完成后保留连接供后续请求复用，默认开启
+    void SetKeepAlive(bool enabled);
+
+    /// \~chinese
+    /// @brief 是否保持连接
+    bool IsKeepAlive() const;
+
+    /// \~chinese
+    /// @brief 设置SSL证书地址
     void SetSSLVerification(const String& root_certificate_path);
 
     /// \~chinese
-    /// @brief ȡSSLַ֤
+    /// @brief 获取SSL证书地址
     const String& GetSSLVerification() const;
 
 public:
@@ -90,7 +139,13 @@ private:
 
     void NetworkThread();
 
-    void Perform(HttpRequestPtr request, HttpResponsePtr response);
+    void WakeUp();
+
+    bool PopRequest(HttpRequestPtr& request, const UnorderedMap<String, uint32_t>& host_connections);
+
+    void RemoveCancelledRequests();
+
+    void DispatchResponse(HttpResponsePtr response);
 
     void DispatchResponseCallback();
 
@@ -98,19 +153,24 @@ private:
     Duration timeout_for_connect_;
     Duration timeout_for_read_;
 
+    std::atomic<uint32_t> max_concurrency_;
+    std::atomic<uint32_t> max_connections_per_host_;
+    std::atomic<bool>     keep_alive_;
+
     String ssl_verification_;
 
-    std::mutex            request_mutex_;
-    Queue<HttpRequestPtr> request_queue_;
+    mutable std::mutex     request_mutex_;
+    size_t                 max_queue_size_;
+    size_t                 queued_count_;
+    Deque<HttpRequestPtr>  request_queues_[3];  // indexed by HttpPriority
+    Vector<HttpRequestPtr> running_requests_;
 
     std::mutex             response_mutex_;
     Queue<HttpResponsePtr> response_queue_;
 
-    std::condition_variable sleep_cond_;
-
-    std::atomic<bool>       quit_flag_;
-    std::mutex              quit_mutex_;
-    std::condition_variable quit_cond_;
+    std::atomic<bool> quit_flag_;
+    uintptr_t         wakeup_socket_;  // curl_socket_t
+    std::thread       network_thread_;
 };
 
 /** @} */
@@ -135,6 +195,56 @@ inline Duration HttpModule::GetTimeoutForRead() const
     return timeout_for_read_;
 }
 
+inline size_t HttpModule::GetQueuedCount() const
+{
+    std::lock_guard<std::mutex> lock(request_mutex_);
+    return queued_count_;
+}
+
+inline void HttpModule::SetMaxQueueSize(size_t max_size)
+{
+    std::lock_guard<std::mutex> lock(request_mutex_);
+    max_queue_size_ = max_size;
+}
+
+inline size_t HttpModule::GetMaxQueueSize() const
+{
+    std::lock_guard<std::mutex> lock(request_mutex_);
+    return max_queue_size_;
+}
+
+inline void HttpModule::SetMaxConcurrency(uint32_t max_concurrency)
+{
+    max_concurrency_ = max_concurrency > 0 ? max_concurrency : 1;
+    WakeUp();
+}
+
+inline uint32_t HttpModule::GetMaxConcurrency() const
+{
+    return max_concurrency_;
+}
+
+inline void HttpModule::SetMaxConnectionsPerHost(uint32_t max_connections)
+{
+    max_connections_per_host_ = max_connections;
+    WakeUp();
+}
+
+inline uint32_t HttpModule::GetMaxConnectionsPerHost() const
+{
+    return max_connections_per_host_;
+}
+
+inline void HttpModule::SetKeepAlive(bool enabled)
+{
+    keep_alive_ = enabled;
+}
+
+inline bool HttpModule::IsKeepAlive() const
+{
+    return keep_alive_;
+}
+
 inline void HttpModule::SetSSLVerification(const String& root_certificate_path)
 {
     ssl_verification_ = root_certificate_path;
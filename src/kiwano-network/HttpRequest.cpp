@@ -28,6 +28,9 @@ namespace network
 
 HttpRequest::HttpRequest(const String& url, HttpType type, const ResponseCallback& callback)
     : type_(type)
+    , priority_(HttpPriority::Normal)
+    , resumable_(false)
+    , cancelled_(false)
     , url_(url)
     , response_cb_(callback)
 {
@@ -19,7 +19,10 @@
 // THE SOFTWARE.
 
 #pragma once
+#include <atomic>
 #include <kiwano/core/Common.h>
+#include <kiwano/core/Duration.h>
+#include <kiwano/core/BinaryData.h>
 #include <kiwano/base/ObjectBase.h>
 #include <kiwano/utils/Json.h>
 
@@ -37,116 +40,223 @@ KGE_DECLARE_SMART_PTR(HttpRequest);
  */
 
 /// \~chinese
-/// @brief HTTP
+/// @brief HTTP请求类型
 enum class HttpType
 {
-    Unknown,  ///< δ֪
-    Get,      ///< HTTP GET
-    Post,     ///< HTTP POST
-    Put,      ///< HTTP PUT
-    Delete    ///< HTTP DELETE
+    Unknown,  ///< 未知
+    Get,      ///< HTTP GET请求
+    Post,     ///< HTTP POST请求
+    Put,      ///< HTTP PUT请求
+    Delete    ///< HTTP DELETE请求
+};
+
+/// \~chinese
+/// @brief HTTP请求优先级
+/// @details 队列中优先级高的请求先被发送，同一优先级按发送顺序
+enum class HttpPriority
+{
+    Low,     ///< 低优先级，如统计上报
+    Normal,  ///< 普通优先级
+    High     ///< 高优先级
+};
+
+/// \~chinese
+/// @brief HTTP下载进度
+struct HttpProgress
+{
+    uint64_t received_bytes;    ///< 已接收的字节数，包含断点续传前已下载的部分
+    uint64_t total_bytes;       ///< 总字节数，未知时为 0
+    double   bytes_per_second;  ///< 本次传输的平均下载速度（字节/秒）
 };
 
 /**
  * \~chinese
- * @brief HTTP
+ * @brief HTTP请求
  */
 class KGE_API HttpRequest : public ObjectBase
 {
 public:
     /// \~chinese
-    /// @brief Ӧص
+    /// @brief 响应回调函数
     using ResponseCallback = Function<void(HttpRequest* /* request */, HttpResponse* /* response */)>;
 
     /// \~chinese
-    /// @brief HTTP
-    /// @param url ַ
-    /// @param type 
-    /// @param callback Ӧص
+    /// @brief 数据块回调函数
+    using DataCallback = Function<void(HttpRequest* /* request */, const BinaryData& /* chunk */)>;
+
+    /// \~chinese
+    /// @brief 下载进度回调函数
+    using ProgressCallback = Function<void(HttpRequest* /* request */, const HttpProgress& /* progress */)>;
+
+    /// \~chinese
+    /// @brief 创建HTTP请求
+    /// @param url 请求地址
+    /// @param type 请求类型
+    /// @param callback 响应回调函数
     HttpRequest(const String& url, HttpType type, const ResponseCallback& callback);
 
     /// \~chinese
-    /// @brief HTTP
-    /// @param url ַ
-    /// @param type 
-    /// @param data 
-    /// @param callback Ӧص
+    /// @brief 创建HTTP请求
+    /// @param url 请求地址
+    /// @param type 请求类型
+    /// @param data 请求数据
+    /// @param callback 响应回调函数
     HttpRequest(const String& url, HttpType type, const String& data, const ResponseCallback& callback);
 
     /// \~chinese
-    /// @brief HTTP
-    /// @param url ַ
-    /// @param type 
-    /// @param json JSON
-    /// @param callback Ӧص
+    /// @brief 创建HTTP请求
+    /// @param url 请求地址
+    /// @param type 请求类型
+    /// @param json 请求的JSON数据
+    /// @param callback 响应回调函数
     HttpRequest(const String& url, HttpType type, const Json& json, const ResponseCallback& callback);
 
     HttpRequest();
 
     /// \~chinese
-    /// @brief ַ
+    /// @brief 设置请求地址
     void SetUrl(const String& url);
 
     /// \~chinese
-    /// @brief 
+    /// @brief 设置请求类型
     void SetType(HttpType type);
 
     /// \~chinese
-    /// @brief 
+    /// @brief 设置请求数据
     void SetData(const String& data);
 
     /// \~chinese
-    /// @brief JSON
+    /// @brief 设置请求的JSON数据
     void SetJsonData(const Json& json);
 
     /// \~chinese
-    /// @brief HTTPͷ
+    /// @brief 设置HTTP头
     void SetHeaders(const Map<String, String>& headers);
 
     /// \~chinese
-    /// @brief HTTPͷ
+    /// @brief 设置HTTP头
     void SetHeader(const String& field, const String& content);
 
     /// \~chinese
-    /// @brief Ӧص
+    /// @brief 设置响应回调函数
     void SetResponseCallback(const ResponseCallback& callback);
 
     /// \~chinese
-    /// @brief ȡַ
+    /// @brief 设置数据块回调函数
+    /// @details 设置后响应数据以数据块的形式在主线程中依次传递，不再保存到响应中，适用于接收大量数据
+    void SetDataCallback(const DataCallback& callback);
+
+    /// \~chinese
+    /// @brief 设置下载进度回调函数
+    /// @details 在主线程中调用，传输期间大约每 100 毫秒调用一次，响应回调之前会再调用一次
+    void SetProgressCallback(const ProgressCallback& callback);
+
+    /// \~chinese
+    /// @brief 设置优先级
+    void SetPriority(HttpPriority priority);
+
+    /// \~chinese
+    /// @brief 设置连接超时时长
+    /// @details 为 0 时使用 HttpModule 的设置
+    void SetTimeoutForConnect(Duration timeout);
+
+    /// \~chinese
+    /// @brief 设置读取超时时长
+    /// @details 即整个请求允许的最长时间，为 0 时使用 HttpModule 的设置。下载到文件和流式接收的请求只在显式设置时
+    /// 限制总时长，未设置时只在持续一段时间（HttpModule 的读取超时时长）没有收到数据时超时
+    void SetTimeoutForRead(Duration timeout);
+
+    /// \~chinese
+    /// @brief 取消请求
+    /// @details 排队中的请求不再发送，进行中的请求会被中断。在主线程中取消后，请求的所有回调函数都不会再被调用
+    void Cancel();
+
+    /// \~chinese
+    /// @brief 设置下载文件
+    /// @details 响应数据直接写入文件而不保存到响应中，非 2xx 响应的数据不会写入文件
+    /// @param file_path 文件路径
+    /// @param resume 是否断点续传，开启后若文件已存在则通过 Range 请求剩余部分，服务器不支持时重新下载
+    void SetDownloadFile(const String& file_path, bool resume = false);
+
+    /// \~chinese
+    /// @brief 获取请求地址
     const String& GetUrl() const;
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取请求类型
     HttpType GetType() const;
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取请求数据
     const String& GetData() const;
 
     /// \~chinese
-    /// @brief ȡHTTPͷ
+    /// @brief 获取HTTP头
     Map<String, String>& GetHeaders();
 
     /// \~chinese
-    /// @brief ȡHTTPͷ
+    /// @brief 获取HTTP头
     const String& GetHeader(const String& header) const;
 
     /// \~chinese
-    /// @brief ȡӦص
+    /// @brief 获取响应回调函数
     const ResponseCallback& GetResponseCallback() const;
 
+    /// \~chinese
+    /// @brief 获取数据块回调函数
+    const DataCallback& GetDataCallback() const;
+
+    /// \~chinese
+    /// @brief 获取下载进度回调函数
+    const ProgressCallback& GetProgressCallback() const;
+
+    /// \~chinese
+    /// @brief 获取下载文件路径
+    const String& GetDownloadFile() const;
+
+    /// \~chinese
+    /// @brief 下载文件是否断点续传
+    bool IsDownloadResumable() const;
+
+    /// \~chinese
+    /// @brief 获取优先级
+    HttpPriority GetPriority() const;
+
+    /// \~chinese
+    /// @brief 获取连接超时时长
+    Duration GetTimeoutForConnect() const;
+
+    /// \~chinese
+    /// @brief 获取读取超时时长
+    Duration GetTimeoutForRead() const;
+
+    /// \~chinese
+    /// @brief 请求是否已取消
+    bool IsCancelled() const;
+
 private:
-    HttpType                type_;
+    HttpType            type_;
+    HttpPriority        priority_;
+    bool                resumable_;
+    std::atomic<bool>   cancelled_;
+    Duration            timeout_for_connect_;
+    Duration            timeout_for_read_;
     String              url_;
     String              data_;
+    String              download_file_;
     Map<String, String> headers_;
     ResponseCallback    response_cb_;
+    DataCallback        data_cb_;
+    ProgressCallback    progress_cb_;
 };
 
 /** @} */
 
 inline HttpRequest::HttpRequest()
     : type_(HttpType::Unknown)
+    , priority_(HttpPriority::Normal)
+    , resumable_(false)
+    , cancelled_(false)
 {
 }
 
@@ -209,5 +319,81 @@ inline const HttpRequest::ResponseCallback& HttpRequest::GetResponseCallback() c
 {
     return response_cb_;
 }
+
+inline void HttpRequest::SetDataCallback(const DataCallback& callback)
+{
+    data_cb_ = callback;
+}
+
+inline const HttpRequest::DataCallback& HttpRequest::GetDataCallback() const
+{
+    return data_cb_;
+}
+
+inline void HttpRequest::SetProgressCallback(const ProgressCallback& callback)
+{
+    progress_cb_ = callback;
+}
+
+inline const HttpRequest::ProgressCallback& HttpRequest::GetProgressCallback() const
+{
+    return progress_cb_;
+}
+
+inline void HttpRequest::SetDownloadFile(const String& file_path, bool resume)
+{
+    download_file_ = file_path;
+    resumable_     = resume;
+}
+
+inline const String& HttpRequest::GetDownloadFile() const
+{
+    return download_file_;
+}
+
+inline bool HttpRequest::IsDownloadResumable() const
+{
+    return resumable_;
+}
+
+inline void HttpRequest::SetPriority(HttpPriority priority)
+{
+    priority_ = priority;
+}
+
+inline HttpPriority HttpRequest::GetPriority() const
+{
+    return priority_;
+}
+
+inline void HttpRequest::SetTimeoutForConnect(Duration timeout)
+{
+    timeout_for_connect_ = timeout;
+}
+
+inline Duration HttpRequest::GetTimeoutForConnect() const
+{
+    return timeout_for_connect_;
+}
+
+inline void HttpRequest::SetTimeoutForRead(Duration timeout)
+{
+    timeout_for_read_ = timeout;
+}
+
+inline Duration HttpRequest::GetTimeoutForRead() const
+{
+    return timeout_for_read_;
+}
+
+inline void HttpRequest::Cancel()
+{
+    cancelled_ = true;
+}
+
+inline bool HttpRequest::IsCancelled() const
+{
+    return cancelled_;
+}
 }  // namespace network
 }  // namespace kiwano
@@ -34,7 +34,7 @@ KGE_DECLARE_SMART_PTR(HttpResponse);
 
 /**
  * \~chinese
- * @brief HTTPӦ
+ * @brief HTTP响应
  */
 class KGE_API HttpResponse : public ObjectBase
 {
@@ -42,47 +42,53 @@ public:
     HttpResponse(HttpRequestPtr request);
 
     /// \~chinese
-    /// @brief ȡӦHTTP
+    /// @brief 获取对应的HTTP请求
     HttpRequestPtr GetRequest() const;
 
     /// \~chinese
-    /// @brief ȡӦ״̬
+    /// @brief 获取响应状态
     bool IsSucceed() const;
 
     /// \~chinese
-    /// @brief ȡHTTP״̬
+    /// @brief 获取HTTP状态码
     long GetResponseCode() const;
 
     /// \~chinese
-    /// @brief ȡӦͷ
+    /// @brief 获取响应头
     String GetHeader() const;
 
     /// \~chinese
-    /// @brief ȡӦ
-    const String& GetData() const;
+    /// @brief 获取响应数据
+    /// @details 响应数据持有接收缓冲区的内存，可以直接用于加载纹理、字体等资源而不需要复制
+    /// @note 请求设置了数据块回调或下载文件时，只有非 2xx 响应的数据会保存在这里
+    const BinaryData& GetData() const;
 
     /// \~chinese
-    /// @brief ȡϢ
+    /// @brief 获取响应数据的字符串副本
+    String GetDataAsString() const;
+
+    /// \~chinese
+    /// @brief 获取错误信息
     const String& GetError() const;
 
     /// \~chinese
-    /// @brief Ӧ״̬
+    /// @brief 设置响应状态
     void SetSucceed(bool succeed);
 
     /// \~chinese
-    /// @brief HTTP״̬
+    /// @brief 设置HTTP状态码
     void SetResponseCode(long response_code);
 
     /// \~chinese
-    /// @brief Ӧͷ
+    /// @brief 设置响应头
     void SetHeader(const String& response_header);
 
     /// \~chinese
-    /// @brief Ӧ
-    void SetData(const String& response_data);
+    /// @brief 设置响应数据
+    void SetData(const BinaryData& response_data);
 
     /// \~chinese
-    /// @brief ôϢ
+    /// @brief 设置错误信息
     void SetError(const String& error_buffer);
 
 private:
@@ -90,9 +96,9 @@ private:
     long           response_code_;
     HttpRequestPtr request_;
 
-    String response_header_;
-    String response_data_;
-    String error_buffer_;
+    String     response_header_;
+    BinaryData response_data_;
+    String     error_buffer_;
 };
 
 /** @} */
@@ -139,16 +145,23 @@ inline String HttpResponse::GetHeader() const
     return response_header_;
 }
 
-inline void HttpResponse::SetData(const String& response_data)
+inline void HttpResponse::SetData(const BinaryData& response_data)
 {
     response_data_ = response_data;
 }
 
-inline const String& HttpResponse::GetData() const
+inline const BinaryData& HttpResponse::GetData() const
 {
     return response_data_;
 }
 
+inline String HttpResponse::GetDataAsString() const
+{
+    if (!response_data_.IsValid())
+        return String();
+    return String(static_cast<const char*>(response_data_.GetBuffer()), size_t(response_data_.GetSize()));
+}
+
 inline void HttpResponse::SetError(const String& error_buffer)
 {
     error_buffer_ = error_buffer;
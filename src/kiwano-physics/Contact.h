@@ -32,78 +32,78 @@ namespace physics
  */
 
 /// \~chinese
-/// @brief Ӵ
+/// @brief 物理接触
 class KGE_API Contact
 {
 public:
     Contact();
 
     /// \~chinese
-    /// @brief ǷǽӴ
+    /// @brief 是否是接触
     bool IsTouching() const;
 
     /// \~chinese
-    /// @brief û (һʱ䲽)
+    /// @brief 启用或禁用 (仅作用于一个时间步)
     void SetEnabled(bool flag);
 
     /// \~chinese
-    /// @brief Ƿ
+    /// @brief 是否启用
     bool IsEnabled() const;
 
     /// \~chinese
-    /// @brief ȡAļо
+    /// @brief 获取物体A的夹具
     Fixture* GetFixtureA() const;
 
     /// \~chinese
-    /// @brief ȡBļо
+    /// @brief 获取物体B的夹具
     Fixture* GetFixtureB() const;
 
     /// \~chinese
-    /// @brief ȡA
+    /// @brief 获取物体A
     PhysicBody* GetBodyA() const;
 
     /// \~chinese
-    /// @brief ȡB
+    /// @brief 获取物体B
     PhysicBody* GetBodyB() const;
 
     /// \~chinese
-    /// @brief Ħ
+    /// @brief 设置摩擦力
     void SetFriction(float friction);
 
     /// \~chinese
-    /// @brief ȡĦ
+    /// @brief 获取摩擦力
     float GetFriction() const;
 
     /// \~chinese
-    /// @brief Ħ
+    /// @brief 重置摩擦力
     void ResetFriction();
 
     /// \~chinese
-    /// @brief õԻָ
+    /// @brief 设置弹性恢复
     void SetRestitution(float restitution);
 
     /// \~chinese
-    /// @brief ȡԻָ
+    /// @brief 获取弹性恢复
     float GetRestitution() const;
 
     /// \~chinese
-    /// @brief õԻָ
+    /// @brief 重置弹性恢复
     void ResetRestitution();
 
     /// \~chinese
-    /// @brief ٶ
+    /// @brief 设置切线速度
     void SetTangentSpeed(float speed);
 
     /// \~chinese
-    /// @brief ȡٶ
+    /// @brief 获取切线速度
     float GetTangentSpeed() const;
 
     /// \~chinese
-    /// @brief ȡb2Contact
+    /// @brief 获取b2Contact
     b2Contact* GetB2Contact() const;
 
     /// \~chinese
-    /// @brief b2Contact
+    /// @brief 设置b2Contact
     void SetB2Contact(b2Contact* contact);
 
     bool operator==(const Contact& rhs) const;
@@ -114,7 +114,7 @@ private:
 };
 
 /// \~chinese
-/// @brief Ӵб
+/// @brief 物理接触列表
 class ContactList
 {
     template <typename _Ty>
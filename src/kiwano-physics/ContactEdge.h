@@ -31,26 +31,26 @@ namespace physics
  */
 
 /// \~chinese
-/// @brief Ӵ
+/// @brief 接触边
 class KGE_API ContactEdge
 {
 public:
     ContactEdge();
 
     /// \~chinese
-    /// @brief ȡӴ
+    /// @brief 获取接触物体
     PhysicBody* GetOtherBody() const;
 
     /// \~chinese
-    /// @brief ȡӴ
+    /// @brief 获取接触
     Contact GetContact() const;
 
     /// \~chinese
-    /// @brief ȡb2ContactEdge
+    /// @brief 获取b2ContactEdge
     b2ContactEdge* GetB2ContactEdge() const;
 
     /// \~chinese
-    /// @brief b2ContactEdge
+    /// @brief 设置b2ContactEdge
     void SetB2ContactEdge(b2ContactEdge* edge);
 
     bool operator==(const ContactEdge& rhs) const;
@@ -61,7 +61,7 @@ private:
 };
 
 /// \~chinese
-/// @brief Ӵб
+/// @brief 物理接触边列表
 class ContactEdgeList
 {
     template <typename _Ty>
@@ -35,11 +35,11 @@ KGE_DECLARE_SMART_PTR(ContactEndEvent);
  */
 
 /// \~chinese
-/// @brief Ӵʼ¼
+/// @brief 物理接触开始事件
 class KGE_API ContactBeginEvent : public Event
 {
 public:
-    Contact contact;  ///< ĽӴ
+    Contact contact;  ///< 产生的接触
 
     ContactBeginEvent();
 
@@ -47,11 +47,11 @@ public:
 };
 
 /// \~chinese
-/// @brief Ӵ¼
+/// @brief 物理接触结束事件
 class KGE_API ContactEndEvent : public Event
 {
 public:
-    Contact contact;  ///< ĽӴ
+    Contact contact;  ///< 产生的接触
 
     ContactEndEvent();
 
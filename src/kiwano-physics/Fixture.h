@@ -35,18 +35,18 @@ KGE_DECLARE_SMART_PTR(Fixture);
  */
 
 /// \~chinese
-/// @brief о
+/// @brief 物理夹具
 class KGE_API Fixture : public ObjectBase
 {
 public:
     /// \~chinese
-    /// @brief о߲
+    /// @brief 夹具参数
     struct Param
     {
-        float density     = 0.0f;   ///< ܶ
-        float friction    = 0.2f;   ///< Ħ
-        float restitution = 0.0f;   ///< Իָ
-        bool  is_sensor   = false;  ///< ǷǽӴ
+        float density     = 0.0f;   ///< 密度
+        float friction    = 0.2f;   ///< 摩擦力
+        float restitution = 0.0f;   ///< 弹性恢复
+        bool  is_sensor   = false;  ///< 是否是接触传感器
 
         Param() {}
 
@@ -60,39 +60,39 @@ public:
     };
 
     /// \~chinese
-    /// @brief Բμо
-    /// @param param о߲
-    /// @param radius Բΰ뾶
-    /// @param offset ƫ
+    /// @brief 创建圆形夹具
+    /// @param param 夹具参数
+    /// @param radius 圆形半径
+    /// @param offset 偏移量
     static FixturePtr CreateCircle(const Param& param, float radius, const Point& offset = Point());
 
     /// \~chinese
-    /// @brief μо
-    /// @param param о߲
-    /// @param size δС
-    /// @param offset ƫ
-    /// @param rotation תǶ
+    /// @brief 创建矩形夹具
+    /// @param param 夹具参数
+    /// @param size 矩形大小
+    /// @param offset 偏移量
+    /// @param rotation 旋转角度
     static FixturePtr CreateRect(const Param& param, const Size& size, const Point& offset = Point(),
                                  float rotation = 0.f);
 
     /// \~chinese
-    /// @brief μо
-    /// @param param о߲
-    /// @param vertexs ζ
+    /// @brief 创建多边形夹具
+    /// @param param 夹具参数
+    /// @param vertexs 多边形顶点
     static FixturePtr CreatePolygon(const Param& param, const Vector<Point>& vertexs);
 
     /// \~chinese
-    /// @brief ߼о
-    /// @param param о߲
-    /// @param p1 ߵ
-    /// @param p2 ߵյ
+    /// @brief 创建边夹具
+    /// @param param 夹具参数
+    /// @param p1 边的起点
+    /// @param p2 边的终点
     static FixturePtr CreateEdge(const Param& param, const Point& p1, const Point& p2);
 
     /// \~chinese
-    /// @brief о
-    /// @param param о߲
-    /// @param vertexs 
-    /// @param loop Ƿյ
+    /// @brief 创建链条夹具
+    /// @param param 夹具参数
+    /// @param vertexs 链条顶点
+    /// @param loop 是否连接链条的起点和终点
     static FixturePtr CreateChain(const Param& param, const Vector<Point>& vertices, bool loop = false);
 
     Fixture();
@@ -100,68 +100,68 @@ public:
     virtual ~Fixture();
 
     /// \~chinese
-    /// @brief ʼо
+    /// @brief 初始化夹具
     bool Init(PhysicBodyPtr body);
 
     /// \~chinese
-    /// @brief ʼо
+    /// @brief 初始化夹具
     bool Init(PhysicBody* body);
 
     /// \~chinese
-    /// @brief ȡоڵ
+    /// @brief 获取夹具所在的物体
     PhysicBody* GetBody() const;
 
     /// \~chinese
-    /// @brief ǷǽӴ
+    /// @brief 是否是接触传感器
     bool IsSensor() const;
 
     /// \~chinese
-    /// @brief üоǷǽӴ
-    /// @details ӴֻӴӰ˶
+    /// @brief 设置夹具是否是接触传感器
+    /// @details 接触传感器只会产生物理接触，而不会影响物体运动
     void SetSensor(bool sensor);
 
     /// \~chinese
-    /// @brief ȡоߵ
+    /// @brief 获取夹具的质量数据
     void GetMassData(float* mass, Point* center, float* inertia) const;
 
     /// \~chinese
-    /// @brief ȡܶ
+    /// @brief 获取密度
     float GetDensity() const;
 
     /// \~chinese
-    /// @brief ܶ
+    /// @brief 设置密度
     void SetDensity(float density);
 
     /// \~chinese
-    /// @brief ȡĦ [N]
+    /// @brief 获取摩擦力 [N]
     float GetFriction() const;
 
     /// \~chinese
-    /// @brief Ħ [N]
+    /// @brief 设置摩擦力 [N]
     void SetFriction(float friction);
 
     /// \~chinese
-    /// @brief ȡԻָ
+    /// @brief 获取弹性恢复
     float GetRestitution() const;
 
     /// \~chinese
-    /// @brief õԻָ
+    /// @brief 设置弹性恢复
     void SetRestitution(float restitution);
 
     /// \~chinese
-    /// @brief 
+    /// @brief 点测试
     bool TestPoint(const Point& p) const;
 
     /// \~chinese
-    /// @brief ټо
+    /// @brief 销毁夹具
     void Destroy();
 
     /// \~chinese
-    /// @brief ȡb2Fixture
+    /// @brief 获取b2Fixture
     b2Fixture* GetB2Fixture() const;
 
     /// \~chinese
-    /// @brief b2Fixture
+    /// @brief 设置b2Fixture
     void SetB2Fixture(b2Fixture* fixture);
 
     bool operator==(const Fixture& rhs) const;
@@ -174,7 +174,7 @@ private:
 };
 
 /// \~chinese
-/// @brief об
+/// @brief 物理夹具列表
 class FixtureList
 {
     template <typename _Ty>
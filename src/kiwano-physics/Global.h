@@ -36,33 +36,33 @@ namespace global
 {
 
 /// \~chinese
-/// @brief ȡȫű
-/// @details űָĵλתĻصıĬϱΪ1:100
+/// @brief 获取全局缩放比例
+/// @details 缩放比例是指由物理世界的单位米转换到屏幕像素的比例，默认比例为1:100
 float GetScale();
 
 /// \~chinese
-/// @brief ȫű
-/// @details űָĵλתĻصıĬϱΪ1:100
+/// @brief 设置全局缩放比例
+/// @details 缩放比例是指由物理世界的单位米转换到屏幕像素的比例，默认比例为1:100
 void SetScale(float scale);
 
 /// \~chinese
-/// @brief Ϸ絥λתΪ絥λ
-/// @details ȫűĵλתΪصλ
+/// @brief 游戏世界单位转换为物理世界单位
+/// @details 根据全局缩放比例将物理世界的单位米转换为像素单位
 float WorldToLocal(float value);
 
 /// \~chinese
-/// @brief Ϸ絥λתΪ絥λ
-/// @details ȫűĵλתΪصλ
+/// @brief 游戏世界单位转换为物理世界单位
+/// @details 根据全局缩放比例将物理世界的单位米转换为像素单位
 Vec2 WorldToLocal(const b2Vec2& pos);
 
 /// \~chinese
-/// @brief 絥λתΪϷ絥λ
-/// @details ȫűصλתΪĵλ
+/// @brief 物理世界单位转换为游戏世界单位
+/// @details 根据全局缩放比例将像素单位转换为物理世界的单位米
 float LocalToWorld(float value);
 
 /// \~chinese
-/// @brief 絥λתΪϷ絥λ
-/// @details ȫűصλתΪĵλ
+/// @brief 物理世界单位转换为游戏世界单位
+/// @details 根据全局缩放比例将像素单位转换为物理世界的单位米
 b2Vec2 LocalToWorld(const Vec2& pos);
 
 }  // namespace global
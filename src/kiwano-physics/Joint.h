@@ -44,35 +44,35 @@ KGE_DECLARE_SMART_PTR(WheelJoint);
  */
 
 /// \~chinese
-/// @brief ؽ
+/// @brief 关节
 class KGE_API Joint : public ObjectBase
 {
 public:
     /// \~chinese
-    /// @brief ؽ
+    /// @brief 关节类型
     enum class Type
     {
-        Unknown = 0,  ///< δ֪
-        Revolute,     ///< תؽ
-        Prismatic,    ///< ƽƹؽ
-        Distance,     ///< ̶ؽ
-        Pulley,       ///< ֹؽ
-        Mouse,        ///< ؽ
-        Gear,         ///< ֹؽ
-        Wheel,        ///< ֹؽ
-        Weld,         ///< ӹؽ
-        Friction,     ///< Ħؽ
-        Rope,         ///< ؽ
-        Motor         ///< ؽ
+        Unknown = 0,  ///< 未知
+        Revolute,     ///< 旋转关节
+        Prismatic,    ///< 平移关节
+        Distance,     ///< 固定距离关节
+        Pulley,       ///< 滑轮关节
+        Mouse,        ///< 鼠标关节
+        Gear,         ///< 齿轮关节
+        Wheel,        ///< 轮关节
+        Weld,         ///< 焊接关节
+        Friction,     ///< 摩擦关节
+        Rope,         ///< 绳关节
+        Motor         ///< 马达关节
     };
 
     /// \~chinese
-    /// @brief ؽڻ
+    /// @brief 关节基础参数
     struct ParamBase
     {
-        PhysicBody* body_a;             ///< ؽӵA
-        PhysicBody* body_b;             ///< ؽӵB
-        bool        collide_connected;  // ؽӵǷײ
+        PhysicBody* body_a;             ///< 关节连接的物体A
+        PhysicBody* body_b;             ///< 关节连接的物体B
+        bool        collide_connected;  // 关节连接的物体是否允许碰撞
 
         ParamBase(PhysicBody* body_a, PhysicBody* body_b)
             : body_a(body_a)
@@ -92,35 +92,35 @@ public:
     virtual ~Joint();
 
     /// \~chinese
-    /// @brief ʼؽ
+    /// @brief 初始化关节
     virtual bool Init(PhysicWorld* world);
 
     /// \~chinese
-    /// @brief ʼؽ
+    /// @brief 初始化关节
     bool Init(PhysicWorld* world, b2JointDef* joint_def);
 
     /// \~chinese
-    /// @brief ȡؽӵA
+    /// @brief 获取关节连接的物体A
     PhysicBodyPtr GetBodyA() const;
 
     /// \~chinese
-    /// @brief ȡؽӵB
+    /// @brief 获取关节连接的物体B
     PhysicBodyPtr GetBodyB() const;
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取物理世界
     PhysicWorld* GetWorld() const;
 
     /// \~chinese
-    /// @brief ٹؽ
+    /// @brief 销毁关节
     void Destroy();
 
     /// \~chinese
-    /// @brief ȡb2Joint
+    /// @brief 获取b2Joint
     b2Joint* GetB2Joint() const;
 
     /// \~chinese
-    /// @brief b2Joint
+    /// @brief 设置b2Joint
     void SetB2Joint(b2Joint* joint);
 
 private:
@@ -130,18 +130,18 @@ private:
 };
 
 /// \~chinese
-/// @brief ̶ؽ
+/// @brief 固定距离关节
 class KGE_API DistanceJoint : public Joint
 {
 public:
     /// \~chinese
-    /// @brief ̶ؽڲ
+    /// @brief 固定距离关节参数
     struct Param : public Joint::ParamBase
     {
-        Point anchor_a;       ///< ؽAϵӵ
-        Point anchor_b;       ///< ؽBϵӵ
-        float frequency_hz;   ///< ӦٶȣֵԽ߹ؽӦٶԽ죬ȥԽ
-        float damping_ratio;  ///< ʣֵԽؽ˶Խ
+        Point anchor_a;       ///< 关节在物体A上的连接点
+        Point anchor_b;       ///< 关节在物体B上的连接点
+        float frequency_hz;   ///< 响应速度，数值越高关节响应的速度越快，看上去越坚固
+        float damping_ratio;  ///< 阻尼率，值越大关节运动阻尼越大
 
         Param()
             : Param(nullptr, nullptr, Point(), Point())
@@ -159,36 +159,36 @@ public:
     };
 
     /// \~chinese
-    /// @brief ̶ؽ
-    /// @param param ؽڲ
+    /// @brief 创建固定距离关节
+    /// @param param 关节参数
     DistanceJoint(const Param& param);
 
     /// \~chinese
-    /// @brief ʼؽ
+    /// @brief 初始化关节
     bool Init(PhysicWorld* world) override;
 
     /// \~chinese
-    /// @brief ùؽڳ
+    /// @brief 设置关节长度
     void SetLength(float length);
 
     /// \~chinese
-    /// @brief ȡؽڳ
+    /// @brief 获取关节长度
     float GetLength() const;
 
     /// \~chinese
-    /// @brief õӦٶ []
+    /// @brief 设置弹簧响应速度 [赫兹]
     void SetFrequency(float hz);
 
     /// \~chinese
-    /// @brief ȡӦٶ []
+    /// @brief 获取弹簧响应速度 [赫兹]
     float GetFrequency() const;
 
     /// \~chinese
-    /// @brief 
+    /// @brief 设置阻尼率
     void SetDampingRatio(float ratio);
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取阻尼率
     float GetDampingRatio() const;
 
 private:
@@ -197,15 +197,15 @@ private:
 };
 
 /// \~chinese
-/// @brief Ħؽ
+/// @brief 摩擦关节
 class KGE_API FrictionJoint : public Joint
 {
 public:
     struct Param : public Joint::ParamBase
     {
-        Point anchor;      ///< Ħõ
-        float max_force;   ///< Ħ
-        float max_torque;  ///< Ť
+        Point anchor;      ///< 摩擦作用点
+        float max_force;   ///< 最大摩擦力
+        float max_torque;  ///< 最大扭力
 
         Param()
             : Param(nullptr, nullptr, Point())
@@ -222,28 +222,28 @@ public:
     };
 
     /// \~chinese
-    /// @brief Ħؽ
-    /// @param param ؽڲ
+    /// @brief 创建摩擦关节
+    /// @param param 关节参数
     FrictionJoint(const Param& param);
 
     /// \~chinese
-    /// @brief ʼؽ
+    /// @brief 初始化关节
     bool Init(PhysicWorld* world) override;
 
     /// \~chinese
-    /// @brief Ħ
+    /// @brief 设置最大摩擦力
     void SetMaxForce(float force);
 
     /// \~chinese
-    /// @brief ȡĦ
+    /// @brief 获取最大摩擦力
     float GetMaxForce() const;
 
     /// \~chinese
-    /// @brief ת
+    /// @brief 设置最大转矩
     void SetMaxTorque(float torque);
 
     /// \~chinese
-    /// @brief ȡת
+    /// @brief 获取最大转矩
     float GetMaxTorque() const;
 
 private:
@@ -252,17 +252,17 @@ private:
 };
 
 /// \~chinese
-/// @brief ֹؽ
+/// @brief 齿轮关节
 class KGE_API GearJoint : public Joint
 {
 public:
     /// \~chinese
-    /// @brief ֹؽڲ
+    /// @brief 齿轮关节参数
     struct Param : public Joint::ParamBase
     {
-        Joint* joint_a;  ///< ؽAתؽ/ƽƹؽڣ
-        Joint* joint_b;  ///< ؽBתؽ/ƽƹؽڣ
-        float  ratio;    ///< ִ
+        Joint* joint_a;  ///< 关节A（旋转关节/平移关节）
+        Joint* joint_b;  ///< 关节B（旋转关节/平移关节）
+        float  ratio;    ///< 齿轮传动比
 
         Param()
             : Param(nullptr, nullptr)
@@ -279,20 +279,20 @@ public:
     };
 
     /// \~chinese
-    /// @brief ֹؽ
-    /// @param param ؽڲ
+    /// @brief 创建齿轮关节
+    /// @param param 关节参数
     GearJoint(const Param& param);
 
     /// \~chinese
-    /// @brief ʼؽ
+    /// @brief 初始化关节
     bool Init(PhysicWorld* world) override;
 
     /// \~chinese
-    /// @brief 趨ִ
+    /// @brief 设定齿轮传动比
     void SetRatio(float ratio);
 
     /// \~chinese
-    /// @brief ȡִ
+    /// @brief 获取齿轮传动比
     float GetRatio() const;
 
 private:
@@ -301,17 +301,17 @@ private:
 };
 
 /// \~chinese
-/// @brief ؽ
+/// @brief 马达关节
 class KGE_API MotorJoint : public Joint
 {
 public:
     /// \~chinese
-    /// @brief ؽڲ
+    /// @brief 马达关节参数
     struct Param : public Joint::ParamBase
     {
-        float max_force;          ///< Ħ
-        float max_torque;         ///< ת
-        float correction_factor;  ///< λýӣΧ 0-1
+        float max_force;          ///< 最大摩擦力
+        float max_torque;         ///< 最大转矩
+        float correction_factor;  ///< 位置矫正因子（范围 0-1）
 
         Param()
             : Param(nullptr, nullptr)
@@ -328,28 +328,28 @@ public:
     };
 
     /// \~chinese
-    /// @brief ؽ
-    /// @param param ؽڲ
+    /// @brief 创建马达关节
+    /// @param param 关节参数
     MotorJoint(const Param& param);
 
     /// \~chinese
-    /// @brief ʼؽ
+    /// @brief 初始化关节
     bool Init(PhysicWorld* world) override;
 
     /// \~chinese
-    /// @brief Ħ
+    /// @brief 设置最大摩擦力
     void SetMaxForce(float force);
 
     /// \~chinese
-    /// @brief ȡĦ
+    /// @brief 获取最大摩擦力
     float GetMaxForce() const;
 
     /// \~chinese
-    /// @brief ת
+    /// @brief 设置最大转矩
     void SetMaxTorque(float torque);
 
     /// \~chinese
-    /// @brief ȡת
+    /// @brief 获取最大转矩
     float GetMaxTorque() const;
 
 private:
@@ -358,22 +358,22 @@ private:
 };
 
 /// \~chinese
-/// @brief ƽƹؽ
+/// @brief 平移关节
 class KGE_API PrismaticJoint : public Joint
 {
 public:
     /// \~chinese
-    /// @brief ƽƹؽڲ
+    /// @brief 平移关节参数
     struct Param : public Joint::ParamBase
     {
-        Point anchor;        ///< ؽλ
-        Vec2  axis;          ///< Aķ
-        bool  enable_limit;  ///< Ƿ
-        float lower_translation;  ///< ƶСƣ뷽ͬΪΪƺЧ
-        float upper_translation;  ///< ƶƣ뷽ͬΪΪƺЧ
-        bool  enable_motor;     ///< Ƿ
-        float max_motor_force;  ///<  [N]
-        float motor_speed;      ///< ת [degree/s]
+        Point anchor;        ///< 关节位置
+        Vec2  axis;          ///< 物体A滑动的方向
+        bool  enable_limit;  ///< 是否启用限制
+        float lower_translation;  ///< 移动的最小限制，与方向同向为正，反向为负，启用限制后才有效果
+        float upper_translation;  ///< 移动的最大限制，与方向同向为正，反向为负，启用限制后才有效果
+        bool  enable_motor;     ///< 是否启用马达
+        float max_motor_force;  ///< 最大马达力 [N]
+        float motor_speed;      ///< 马达转速 [degree/s]
 
         Param()
             : Param(nullptr, nullptr, Point(), Vec2())
@@ -395,68 +395,68 @@ public:
     };
 
     /// \~chinese
-    /// @brief ƽƹؽ
-    /// @param param ؽڲ
+    /// @brief 创建平移关节
+    /// @param param 关节参数
     PrismaticJoint(const Param& param);
 
     /// \~chinese
-    /// @brief ʼؽ
+    /// @brief 初始化关节
     bool Init(PhysicWorld* world) override;
 
     /// \~chinese
-    /// @brief ȡο
+    /// @brief 获取参考角
     float GetReferenceAngle() const;
 
     /// \~chinese
-    /// @brief ȡؽת
+    /// @brief 获取关节转换
     float GetJointTranslation() const;
 
     /// \~chinese
-    /// @brief ȡؽٶ
+    /// @brief 获取关节速度
     float GetJointSpeed() const;
 
     /// \~chinese
-    /// @brief Ƿùؽ
+    /// @brief 是否启用关节限制
     bool IsLimitEnabled() const;
 
     /// \~chinese
-    /// @brief Ƿùؽ
+    /// @brief 设置是否启用关节限制
     void EnableLimit(bool flag);
 
     /// \~chinese
-    /// @brief ȡƽС
+    /// @brief 获取平移最小限制
     float GetLowerLimit() const;
 
     /// \~chinese
-    /// @brief ȡƽ
+    /// @brief 获取平移最大限制
     float GetUpperLimit() const;
 
     /// \~chinese
-    /// @brief ùؽ
+    /// @brief 设置关节限制
     void SetLimits(float lower, float upper);
 
     /// \~chinese
-    /// @brief Ƿ
+    /// @brief 是否启用马达
     bool IsMotorEnabled() const;
 
     /// \~chinese
-    /// @brief Ƿ
+    /// @brief 设置是否启用马达
     void EnableMotor(bool flag);
 
     /// \~chinese
-    /// @brief ת [degree/s]
+    /// @brief 设置马达转速 [degree/s]
     void SetMotorSpeed(float speed);
 
     /// \~chinese
-    /// @brief ȡת [degree/s]
+    /// @brief 获取马达转速 [degree/s]
     float GetMotorSpeed() const;
 
     /// \~chinese
-    /// @brief  [N]
+    /// @brief 设置最大马达力 [N]
     void SetMaxMotorForce(float force);
 
     /// \~chinese
-    /// @brief ȡ [N]
+    /// @brief 获取最大马达力 [N]
     float GetMaxMotorForce() const;
 
 private:
@@ -465,19 +465,19 @@ private:
 };
 
 /// \~chinese
-/// @brief ֹؽ
+/// @brief 滑轮关节
 class KGE_API PulleyJoint : public Joint
 {
 public:
     /// \~chinese
-    /// @brief ֹؽڲ
+    /// @brief 滑轮关节参数
     struct Param : public Joint::ParamBase
     {
-        Point anchor_a;         ///< ؽAϵõ
-        Point anchor_b;         ///< ؽBϵõ
-        Point ground_anchor_a;  ///< AӦĻֵλ
-        Point ground_anchor_b;  ///< BӦĻֵλ
-        float ratio;            ///< ֱȣؽڴʱ½ͷλƱ
+        Point anchor_a;         ///< 关节在物体A上的作用点
+        Point anchor_b;         ///< 关节在物体B上的作用点
+        Point ground_anchor_a;  ///< 物体A对应的滑轮的位置
+        Point ground_anchor_b;  ///< 物体B对应的滑轮的位置
+        float ratio;            ///< 滑轮比，关节传动时，滑轮上升和下降的两头的位移比例
 
         Param()
             : Param(nullptr, nullptr, Point(), Point(), Point(), Point())
@@ -497,40 +497,40 @@ public:
     };
 
     /// \~chinese
-    /// @brief ֹؽ
-    /// @param param ؽڲ
+    /// @brief 创建滑轮关节
+    /// @param param 关节参数
     PulleyJoint(const Param& param);
 
     /// \~chinese
-    /// @brief ʼؽ
+    /// @brief 初始化关节
     bool Init(PhysicWorld* world) override;
 
     /// \~chinese
-    /// @brief AӦĻֵλ
+    /// @brief 物体A对应的滑轮的位置
     Point GetGroundAnchorA() const;
 
     /// \~chinese
-    /// @brief BӦĻֵλ
+    /// @brief 物体B对应的滑轮的位置
     Point GetGroundAnchorB() const;
 
     /// \~chinese
-    /// @brief ȡִ
+    /// @brief 获取滑轮传动比
     float GetRatio() const;
 
     /// \~chinese
-    /// @brief ȡA뻬ֵľ
+    /// @brief 获取物体A与滑轮的距离
     float GetLengthA() const;
 
     /// \~chinese
-    /// @brief ȡB뻬ֵľ
+    /// @brief 获取物体B与滑轮的距离
     float GetLengthB() const;
 
     /// \~chinese
-    /// @brief ȡA뻬ֵĵǰ
+    /// @brief 获取物体A与滑轮的当前距离
     float GetCurrentLengthA() const;
 
     /// \~chinese
-    /// @brief ȡB뻬ֵĵǰ
+    /// @brief 获取物体B与滑轮的当前距离
     float GetCurrentLengthB() const;
 
 private:
@@ -539,21 +539,21 @@ private:
 };
 
 /// \~chinese
-/// @brief תؽ
+/// @brief 旋转关节
 class KGE_API RevoluteJoint : public Joint
 {
 public:
     /// \~chinese
-    /// @brief תؽڲ
+    /// @brief 旋转关节参数
     struct Param : public Joint::ParamBase
     {
-        Point anchor;        ///< ؽλ
-        bool  enable_limit;  ///< Ƿ
-        float lower_angle;  ///< ƶСƣ뷽ͬΪΪƺЧ
-        float upper_angle;  ///< ƶƣ뷽ͬΪΪƺЧ
-        bool  enable_motor;      ///< Ƿ
-        float max_motor_torque;  ///<  [N]
-        float motor_speed;       ///< ת [degree/s]
+        Point anchor;        ///< 关节位置
+        bool  enable_limit;  ///< 是否启用限制
+        float lower_angle;  ///< 移动的最小限制，与方向同向为正，反向为负，启用限制后才有效果
+        float upper_angle;  ///< 移动的最大限制，与方向同向为正，反向为负，启用限制后才有效果
+        bool  enable_motor;      ///< 是否启用马达
+        float max_motor_torque;  ///< 最大马达力 [N]
+        float motor_speed;       ///< 马达转速 [degree/s]
 
         Param()
             : Param(nullptr, nullptr, Point())
@@ -574,68 +574,68 @@ public:
     };
 
     /// \~chinese
-    /// @brief תؽ
-    /// @param param ؽڲ
+    /// @brief 创建旋转关节
+    /// @param param 关节参数
     RevoluteJoint(const Param& param);
 
     /// \~chinese
-    /// @brief ʼؽ
+    /// @brief 初始化关节
     bool Init(PhysicWorld* world) override;
 
     /// \~chinese
-    /// @brief ȡο
+    /// @brief 获取参考角
     float GetReferenceAngle() const;
 
     /// \~chinese
-    /// @brief ȡؽڽǶ
+    /// @brief 获取关节角度
     float GetJointAngle() const;
 
     /// \~chinese
-    /// @brief ȡؽٶ
+    /// @brief 获取关节速度
     float GetJointSpeed() const;
 
     /// \~chinese
-    /// @brief Ƿùؽ
+    /// @brief 是否启用关节限制
     bool IsLimitEnabled() const;
 
     /// \~chinese
-    /// @brief Ƿùؽ
+    /// @brief 设置是否启用关节限制
     void EnableLimit(bool flag);
 
     /// \~chinese
-    /// @brief ȡƽС
+    /// @brief 获取平移最小限制
     float GetLowerLimit() const;
 
     /// \~chinese
-    /// @brief ȡƽ
+    /// @brief 获取平移最大限制
     float GetUpperLimit() const;
 
     /// \~chinese
-    /// @brief ùؽ
+    /// @brief 设置关节限制
     void SetLimits(float lower, float upper);
 
     /// \~chinese
-    /// @brief Ƿ
+    /// @brief 是否启用马达
     bool IsMotorEnabled() const;
 
     /// \~chinese
-    /// @brief Ƿ
+    /// @brief 设置是否启用马达
     void EnableMotor(bool flag);
 
     /// \~chinese
-    /// @brief ת [degree/s]
+    /// @brief 设置马达转速 [degree/s]
     void SetMotorSpeed(float speed);
 
     /// \~chinese
-    /// @brief ȡת [degree/s]
+    /// @brief 获取马达转速 [degree/s]
     float GetMotorSpeed() const;
 
     /// \~chinese
-    /// @brief ת [N/m]
+    /// @brief 设置最大马达转矩 [N/m]
     void SetMaxMotorTorque(float torque);
 
     /// \~chinese
-    /// @brief ȡת [N/m]
+    /// @brief 获取最大马达转矩 [N/m]
     float GetMaxMotorTorque() const;
 
 private:
@@ -644,17 +644,17 @@ private:
 };
 
 /// \~chinese
-/// @brief ؽ
+/// @brief 绳关节
 class KGE_API RopeJoint : public Joint
 {
 public:
     /// \~chinese
-    /// @brief ؽڲ
+    /// @brief 绳关节参数
     struct Param : public Joint::ParamBase
     {
-        Point local_anchor_a;  ///< ؽAϵӵ
-        Point local_anchor_b;  ///< ؽBϵӵ
-        float max_length;      ///< 󳤶
+        Point local_anchor_a;  ///< 关节在物体A上的连接点
+        Point local_anchor_b;  ///< 关节在物体B上的连接点
+        float max_length;      ///< 绳索最大长度
 
         Param()
             : Param(nullptr, nullptr, Point(), Point())
@@ -671,20 +671,20 @@ public:
     };
 
     /// \~chinese
-    /// @brief ؽ
-    /// @param param ؽڲ
+    /// @brief 创建绳关节
+    /// @param param 关节参数
     RopeJoint(const Param& param);
 
     /// \~chinese
-    /// @brief ʼؽ
+    /// @brief 初始化关节
     bool Init(PhysicWorld* world) override;
 
     /// \~chinese
-    /// @brief ùؽ󳤶
+    /// @brief 设置关节最大长度
     void SetMaxLength(float length);
 
     /// \~chinese
-    /// @brief ȡؽ󳤶
+    /// @brief 获取关节最大长度
     float GetMaxLength() const;
 
 private:
@@ -693,17 +693,17 @@ private:
 };
 
 /// \~chinese
-/// @brief ӹؽ
+/// @brief 焊接关节
 class KGE_API WeldJoint : public Joint
 {
 public:
     /// \~chinese
-    /// @brief ӹؽڲ
+    /// @brief 焊接关节参数
     struct Param : public Joint::ParamBase
     {
-        Point anchor;         ///< λ
-        float frequency_hz;   ///< ӦٶȣֵԽ߹ؽӦٶԽ죬ȥԽ
-        float damping_ratio;  ///< ʣֵԽؽ˶Խ
+        Point anchor;         ///< 焊接位置
+        float frequency_hz;   ///< 响应速度，数值越高关节响应的速度越快，看上去越坚固
+        float damping_ratio;  ///< 阻尼率，值越大关节运动阻尼越大
 
         Param()
             : Param(nullptr, nullptr, Point())
@@ -720,32 +720,32 @@ public:
     };
 
     /// \~chinese
-    /// @brief ӹؽ
-    /// @param param ؽڲ
+    /// @brief 创建焊接关节
+    /// @param param 关节参数
     WeldJoint(const Param& param);
 
     /// \~chinese
-    /// @brief ʼؽ
+    /// @brief 初始化关节
     bool Init(PhysicWorld* world) override;
 
     /// \~chinese
-    /// @brief ȡBAĽǶ
+    /// @brief 获取物体B相对于物体A的角度
     float GetReferenceAngle() const;
 
     /// \~chinese
-    /// @brief õӦٶ []
+    /// @brief 设置弹簧响应速度 [赫兹]
     void SetFrequency(float hz);
 
     /// \~chinese
-    /// @brief ȡӦٶ []
+    /// @brief 获取弹簧响应速度 [赫兹]
     float GetFrequency() const;
 
     /// \~chinese
-    /// @brief 
+    /// @brief 设置阻尼率
     void SetDampingRatio(float ratio);
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取阻尼率
     float GetDampingRatio() const;
 
 private:
@@ -754,21 +754,21 @@ private:
 };
 
 /// \~chinese
-/// @brief ֹؽ
+/// @brief 轮关节
 class KGE_API WheelJoint : public Joint
 {
 public:
     /// \~chinese
-    /// @brief ֹؽڲ
+    /// @brief 轮关节参数
     struct Param : public Joint::ParamBase
     {
-        Point anchor;            ///< ֹؽλ
-        Vec2  axis;              ///< A
-        bool  enable_motor;      ///< Ƿ
-        float max_motor_torque;  ///<  [N]
-        float motor_speed;       ///< ת [degree/s]
-        float frequency_hz;      ///< ӦٶȣֵԽ߹ؽӦٶԽ죬ȥԽ
-        float damping_ratio;     ///< ʣֵԽؽ˶Խ
+        Point anchor;            ///< 轮关节位置
+        Vec2  axis;              ///< 物体A滑动方向
+        bool  enable_motor;      ///< 是否启用马达
+        float max_motor_torque;  ///< 最大马达力 [N]
+        float motor_speed;       ///< 马达转速 [degree/s]
+        float frequency_hz;      ///< 响应速度，数值越高关节响应的速度越快，看上去越坚固
+        float damping_ratio;     ///< 弹簧阻尼率，值越大关节运动阻尼越大
 
         Param()
             : Param(nullptr, nullptr, Point(), Vec2())
@@ -789,68 +789,68 @@ public:
     };
 
     /// \~chinese
-    /// @brief ֹؽ
-    /// @param param ؽڲ
+    /// @brief 创建轮关节
+    /// @param param 关节参数
     WheelJoint(const Param& param);
 
     /// \~chinese
-    /// @brief ʼؽ
+    /// @brief 初始化关节
     bool Init(PhysicWorld* world) override;
 
     /// \~chinese
-    /// @brief ȡؽڵǰƽƾ
+    /// @brief 获取关节当前的平移距离
     float GetJointTranslation() const;
 
     /// \~chinese
-    /// @brief ȡؽڵǰٶ
+    /// @brief 获取关节当前的线性速度
     float GetJointLinearSpeed() const;
 
     /// \~chinese
-    /// @brief ȡؽڵǰĽǶ
+    /// @brief 获取关节当前的角度
     float GetJointAngle() const;
 
     /// \~chinese
-    /// @brief ȡؽڵǰתٶ
+    /// @brief 获取关节当前的旋转速度
     float GetJointAngularSpeed() const;
 
     /// \~chinese
-    /// @brief Ƿ
+    /// @brief 是否启用马达
     bool IsMotorEnabled() const;
 
     /// \~chinese
-    /// @brief Ƿ
+    /// @brief 设置是否启用马达
     void EnableMotor(bool flag);
 
     /// \~chinese
-    /// @brief ת [degree/s]
+    /// @brief 设置马达转速 [degree/s]
     void SetMotorSpeed(float speed);
 
     /// \~chinese
-    /// @brief ȡת [degree/s]
+    /// @brief 获取马达转速 [degree/s]
     float GetMotorSpeed() const;
 
     /// \~chinese
-    /// @brief ת [N/m]
+    /// @brief 设置最大马达转矩 [N/m]
     void SetMaxMotorTorque(float torque);
 
     /// \~chinese
-    /// @brief ȡת [N/m]
+    /// @brief 获取最大马达转矩 [N/m]
     float GetMaxMotorTorque() const;
 
     /// \~chinese
-    /// @brief õӦٶ
+    /// @brief 设置弹簧响应速度
     void SetSpringFrequencyHz(float hz);
 
     /// \~chinese
-    /// @brief ȡӦٶ
+    /// @brief 获取弹簧响应速度
     float GetSpringFrequencyHz() const;
 
     /// \~chinese
-    /// @brief õ
+    /// @brief 设置弹簧阻尼率
     void SetSpringDampingRatio(float ratio);
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取弹簧阻尼率
     float GetSpringDampingRatio() const;
 
 private:
@@ -859,19 +859,19 @@ private:
 };
 
 /// \~chinese
-/// @brief ؽ
-/// @details ʹĳ׷ϵָ㣬׷λ
+/// @brief 鼠标关节
+/// @details 用于使身体的某个点追踪世界上的指定点，例如让物体追踪鼠标位置
 class KGE_API MouseJoint : public Joint
 {
 public:
     /// \~chinese
-    /// @brief ؽڲ
+    /// @brief 鼠标关节参数
     struct Param : public Joint::ParamBase
     {
-        Point target;         ///< ؽĿλ
-        float max_force;      ///< Aϵ
-        float frequency_hz;   ///< ӦٶȣֵԽ߹ؽӦٶԽ죬ȥԽ
-        float damping_ratio;  ///< ʣֵԽؽ˶Խ
+        Point target;         ///< 关节作用目标位置
+        float max_force;      ///< 作用在物体A上的最大力
+        float frequency_hz;   ///< 响应速度，数值越高关节响应的速度越快，看上去越坚固
+        float damping_ratio;  ///< 阻尼率，值越大关节运动阻尼越大
 
         Param()
             : Param(nullptr, nullptr, Point())
@@ -889,36 +889,36 @@ public:
     };
 
     /// \~chinese
-    /// @brief ؽ
-    /// @param param ؽڲ
+    /// @brief 创建鼠标关节
+    /// @param param 关节参数
     MouseJoint(const Param& param);
 
     /// \~chinese
-    /// @brief ʼؽ
+    /// @brief 初始化关节
     bool Init(PhysicWorld* world) override;
 
     /// \~chinese
-    /// @brief 趨Ħ [N]
+    /// @brief 设定最大摩擦力 [N]
     void SetMaxForce(float force);
 
     /// \~chinese
-    /// @brief ȡĦ [N]
+    /// @brief 获取最大摩擦力 [N]
     float GetMaxForce() const;
 
     /// \~chinese
-    /// @brief Ӧٶ [hz]
+    /// @brief 设置响应速度 [hz]
     void SetFrequency(float hz);
 
     /// \~chinese
-    /// @brief ȡӦٶ [hz]
+    /// @brief 获取响应速度 [hz]
     float GetFrequency() const;
 
     /// \~chinese
-    /// @brief 
+    /// @brief 设置阻尼率
     void SetDampingRatio(float ratio);
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取阻尼率
     float GetDampingRatio() const;
 
 private:
@@ -35,6 +35,11 @@ PhysicBody::PhysicBody(PhysicWorld* world, Type type)
     , category_bits_(0x0001)
     , mask_bits_(0xFFFF)
     , group_index_(0)
+    , in_world_(false)
+    , awake_before_(false)
+    , synced_version_(0)
+    , parent_rotation_(0.0f)
+    , bound_index_(size_t(-1))
 {
     SetName(KGE_PHYSIC_COMP_NAME);
 
@@ -58,10 +63,20 @@ void PhysicBody::InitComponent(Actor* actor)
     actor->SetPhysicBody(this);
 
     UpdateFromActor(actor);
+
+    if (world_)
+    {
+        world_->AddBoundBody(this);
+    }
 }
 
 void PhysicBody::DestroyComponent()
 {
+    if (world_)
+    {
+        world_->RemoveBoundBody(this);
+    }
+
     GetBoundActor()->SetPhysicBody(nullptr);
 
     // Detach from actor first
@@ -105,37 +120,83 @@ void PhysicBody::Destroy()
         b2world->DestroyBody(body_);
     }
 
+    if (world_)
+    {
+        world_->RemoveBoundBody(this);
+    }
+
     body_  = nullptr;
     world_ = nullptr;
 
     Component::RemoveFromActor();
 }
 
-void PhysicBody::BeforeSimulation(Actor* actor, const Matrix3x2& parent_to_world, const Matrix3x2& actor_to_world,
-                                  float parent_rotation)
+void PhysicBody::BeforeSimulation(Actor* world_actor, bool force)
+{
+    Actor* actor = GetBoundActor();
+
+    // The version of an actor changes whenever its transform or the transform of an ancestor changes
+    actor->UpdateTransform();
+    if (force || synced_version_ != actor->transform_version_)
+    {
+        in_world_ = UpdateParentTransform(actor, world_actor);
+        if (in_world_)
+        {
+            Matrix3x2 actor_to_world = actor->GetTransformMatrixToParent() * parent_to_world_;
+            UpdateFromActor(actor, actor_to_world, parent_rotation_ + actor->GetRotation());
+        }
+        synced_version_ = actor->transform_version_;
+    }
+
+    awake_before_ = body_->IsAwake();
+}
+
+void PhysicBody::AfterSimulation()
 {
-    UpdateFromActor(actor, actor_to_world, parent_rotation + actor->GetRotation());
+    if (!in_world_ || body_->GetType() == b2_staticBody)
+        return;
 
-    /*if (actor->GetAnchor() != Vec2(0.5f, 0.5f))
+    // Sleeping bodies have not been moved by the simulation
+    if (!awake_before_ && !body_->IsAwake())
+        return;
+
+    Actor* actor = GetBoundActor();
+
+    Point position = GetPosition();
+    if (position_cached_ != position)
     {
-        Point position = parent_to_world.Invert().Transform(position_cached_);
+        actor->SetPosition(world_to_parent_.Transform(position));
+        position_cached_ = position;
+    }
+    actor->SetRotation(GetRotation() - parent_rotation_);
 
-        offset_ = position - actor->GetPosition();
-    }*/
+    // Changes made here are already known by the body
+    actor->UpdateTransform();
+    synced_version_ = actor->transform_version_;
 }
 
-void PhysicBody::AfterSimulation(Actor* actor, const Matrix3x2& parent_to_world, float parent_rotation)
+bool PhysicBody::UpdateParentTransform(Actor* actor, Actor* world_actor)
 {
-    Point position_in_parent = GetPosition();
-    if (position_cached_ != position_in_parent)
+    if (!world_actor || actor == world_actor)
+        return false;
+
+    parent_rotation_ = 0.0f;
+    parent_to_world_ = Matrix3x2();
+
+    Actor* ptr = actor->GetParent();
+    while (ptr && ptr != world_actor)
     {
-        /*position_in_parent = parent_to_world.Invert().Transform(position_in_parent);
-        actor->SetPosition(position_in_parent - offset_);*/
+        parent_rotation_ += ptr->GetRotation();
+        parent_to_world_ *= ptr->GetTransformMatrixToParent();
 
-        position_in_parent = parent_to_world.Invert().Transform(position_in_parent);
-        actor->SetPosition(position_in_parent);
+        ptr = ptr->GetParent();
     }
-    actor->SetRotation(GetRotation() - parent_rotation);
+
+    if (!ptr)
+        return false;
+
+    world_to_parent_ = parent_to_world_.Invert();
+    return true;
 }
 
 void PhysicBody::UpdateFromActor(Actor* actor)
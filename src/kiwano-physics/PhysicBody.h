@@ -35,323 +35,331 @@ class PhysicWorld;
  */
 
 /// \~chinese
-/// @brief 
+/// @brief 物体
 class KGE_API PhysicBody : public Component
 {
     friend class PhysicWorld;
 
 public:
     /// \~chinese
-    /// @brief 
+    /// @brief 物体类型
     enum class Type
     {
-        Static = 0,  ///< ̬
-        Kinematic,   ///< ѧ
-        Dynamic,     ///< ̬
+        Static = 0,  ///< 静态物体
+        Kinematic,   ///< 动力学物体
+        Dynamic,     ///< 动态物体
     };
 
     /// \~chinese
-    /// @brief ʼ
-    /// @param world 
-    /// @param type 
+    /// @brief 初始化物体
+    /// @param world 物理世界
+    /// @param type 物体类型
     PhysicBody(PhysicWorld* world, Type type);
 
     /// \~chinese
-    /// @brief ʼ
-    /// @param world 
-    /// @param type 
+    /// @brief 初始化物体
+    /// @param world 物理世界
+    /// @param type 物体类型
     PhysicBody(PhysicWorldPtr world, Type type);
 
     virtual ~PhysicBody();
 
     /// \~chinese
-    /// @brief ʼ
-    /// @param[in] world 
+    /// @brief 初始化物体
+    /// @param[in] world 物理世界
     bool Init(PhysicWorld* world);
 
     /// \~chinese
-    /// @brief Ӽо
+    /// @brief 添加夹具
     void AddFixture(FixturePtr fixture);
 
     /// \~chinese
-    /// @brief Բμо
-    /// @param radius Բΰ뾶
-    /// @param density ܶ
+    /// @brief 添加圆形夹具
+    /// @param radius 圆形半径
+    /// @param density 物体密度
     /// @param
     Fixture* AddCircleShape(float radius, float density, float friction = 0.2f);
 
     /// \~chinese
-    /// @brief Ӿμо
-    /// @param size δС
-    /// @param density ܶ
+    /// @brief 添加矩形夹具
+    /// @param size 矩形大小
+    /// @param density 物体密度
     Fixture* AddRectShape(const Vec2& size, float density, float friction = 0.2f);
 
     /// \~chinese
-    /// @brief Ӷμо
-    /// @param vertexs ζ˵
-    /// @param density ܶ
+    /// @brief 添加多边形夹具
+    /// @param vertexs 多边形端点
+    /// @param density 物体密度
     Fixture* AddPolygonShape(const Vector<Point>& vertexs, float density, float friction = 0.2f);
 
     /// \~chinese
-    /// @brief ߶μо
-    /// @param p1 ߶
-    /// @param p2 ߶յ
-    /// @param density ܶ
+    /// @brief 添加线段形夹具
+    /// @param p1 线段起点
+    /// @param p2 线段终点
+    /// @param density 物体密度
     Fixture* AddEdgeShape(const Point& p1, const Point& p2, float density, float friction = 0.2f);
 
     /// \~chinese
-    /// @brief μо
-    /// @param vertexs ˵
-    /// @param loop Ƿպ
-    /// @param density ܶ
+    /// @brief 添加链条形夹具
+    /// @param vertexs 链条端点
+    /// @param loop 是否闭合
+    /// @param density 物体密度
     Fixture* AddChainShape(const Vector<Point>& vertices, bool loop, float density, float friction = 0.2f);
 
     /// \~chinese
-    /// @brief Ƴо
+    /// @brief 移除夹具
     void RemoveFixture(FixturePtr fixture);
 
     /// \~chinese
-    /// @brief Ƴмо
+    /// @brief 移除所有夹具
     void RemoveAllFixtures();
 
     /// \~chinese
-    /// @brief ȡоб
+    /// @brief 获取夹具列表
     FixtureList GetFixtureList() const;
 
     /// \~chinese
-    /// @brief ȡӴб
+    /// @brief 获取接触边列表
     ContactEdgeList GetContactList() const;
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取类别码
     uint16_t GetCategoryBits() const;
 
     /// \~chinese
-    /// @brief 
+    /// @brief 设置类别码
     void SetCategoryBits(uint16_t category_bits);
 
     /// \~chinese
-    /// @brief ȡײ
+    /// @brief 获取碰撞掩码
     uint16_t GetMaskBits() const;
 
     /// \~chinese
-    /// @brief ײ
+    /// @brief 设置碰撞掩码
     void SetMaskBits(uint16_t mask_bits);
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取组索引
     int16_t GetGroupIndex() const;
 
     /// \~chinese
-    /// @brief 
+    /// @brief 设置组索引
     void SetGroupIndex(int16_t index);
 
     /// \~chinese
-    /// @brief ȡתǶ
+    /// @brief 获取旋转角度
     float GetRotation() const;
 
     /// \~chinese
-    /// @brief תǶ
+    /// @brief 设置旋转角度
     void SetRotation(float angle);
 
     /// \~chinese
-    /// @brief ȡλ
+    /// @brief 获取物体位置
     Point GetPosition() const;
 
     /// \~chinese
-    /// @brief λ
+    /// @brief 设置物体位置
     void SetPosition(const Point& pos);
 
     /// \~chinese
-    /// @brief λúת任
+    /// @brief 位置和旋转变换
     void SetTransform(const Point& pos, float angle);
 
     /// \~chinese
-    /// @brief ȡ [kg]
+    /// @brief 获取质量 [kg]
     float GetMass() const;
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取惯性
     float GetInertia() const;
 
     /// \~chinese
-    /// @brief ȡ
-    /// @param[out] mass  [kg]
-    /// @param[out] center λ
-    /// @param[out] inertia 
+    /// @brief 获取质量数据
+    /// @param[out] mass 物体质量 [kg]
+    /// @param[out] center 质心位置
+    /// @param[out] inertia 惯性
     void GetMassData(float* mass, Point* center, float* inertia) const;
 
     /// \~chinese
-    /// @brief 
-    /// @param mass  [kg]
-    /// @param center λ
-    /// @param inertia 
+    /// @brief 设置质量数据
+    /// @param mass 物体质量 [kg]
+    /// @param center 质心位置
+    /// @param inertia 惯性
     void SetMassData(float mass, const Point& center, float inertia);
 
     /// \~chinese
-    /// @brief 
+    /// @brief 重置质量数据
     void ResetMassData();
 
     /// \~chinese
-    /// @brief ȡϵϵĵϵλ
+    /// @brief 获取世界坐标系上的点在物体上的位置
     Point GetLocalPoint(const Point& world) const;
 
     /// \~chinese
-    /// @brief ϵеתϵ
+    /// @brief 将世界坐标系中的向量转换到物体坐标系下
     Vec2 GetLocalVector(const Vec2& world) const;
 
     /// \~chinese
-    /// @brief ȡϵĵϵλ
+    /// @brief 获取物体上的点在世界坐标系的位置
     Point GetWorldPoint(const Point& local) const;
 
     /// \~chinese
-    /// @brief ϵеתϵ
+    /// @brief 将物体坐标系中的向量转换到世界坐标系下
     Vec2 GetWorldVector(const Vec2& local) const;
 
     /// \~chinese
-    /// @brief ȡλ
+    /// @brief 获取物体质心相对于物体的位置
     Point GetLocalCenter() const;
 
     /// \~chinese
-    /// @brief ȡλ
+    /// @brief 获取物体质心位置
     Point GetWorldCenter() const;
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取物体类型
     Type GetType() const;
 
     /// \~chinese
-    /// @brief 
+    /// @brief 设置物体类型
     void SetType(Type type);
 
     /// \~chinese
-    /// @brief ȡı
+    /// @brief 获取物体受重力的比例
     float GetGravityScale() const;
 
     /// \~chinese
-    /// @brief ı
+    /// @brief 设置物体受重力的比例
     void SetGravityScale(float scale);
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取线性阻尼
     float GetLinearDamping() const;
 
     /// \~chinese
-    /// @brief 
+    /// @brief 设置线性阻尼
     void SetLinearDamping(float damping);
 
     /// \~chinese
-    /// @brief ȡת
+    /// @brief 获取旋转阻尼
     float GetAngularDamping() const;
 
     /// \~chinese
-    /// @brief ת
+    /// @brief 设置旋转阻尼
     void SetAngularDamping(float damping);
 
     /// \~chinese
-    /// @brief ʩ
-    /// @param force ĴСͷ
-    /// @param point ʩ
-    /// @param wake Ƿ
+    /// @brief 施力
+    /// @param force 力的大小和方向
+    /// @param point 施力点
+    /// @param wake 是否唤醒物体
     void ApplyForce(const Vec2& force, const Point& point, bool wake = true);
 
     /// \~chinese
-    /// @brief ʩ
-    /// @param force ĴСͷ
-    /// @param wake Ƿ
+    /// @brief 给物体中心施力
+    /// @param force 力的大小和方向
+    /// @param wake 是否唤醒物体
     void ApplyForceToCenter(const Vec2& force, bool wake = true);
 
     /// \~chinese
-    /// @brief ʩŤ
-    /// @param torque Ť
-    /// @param wake Ƿ
+    /// @brief 施加扭矩
+    /// @param torque 扭矩
+    /// @param wake 是否唤醒物体
     void ApplyTorque(float torque, bool wake = false);
 
     /// \~chinese
-    /// @brief תǶǷ̶
+    /// @brief 旋转角度是否固定
     bool IsIgnoreRotation() const;
 
     /// \~chinese
-    /// @brief Ƿ̶תǶ
+    /// @brief 设置是否固定旋转角度
     void SetIgnoreRotation(bool flag);
 
     /// \~chinese
-    /// @brief Ƿӵ
+    /// @brief 是否是子弹物体
     bool IsBullet() const;
 
     /// \~chinese
-    /// @brief Ƿӵ
+    /// @brief 设置物体是否是子弹物体
     void SetBullet(bool flag);
 
     /// \~chinese
-    /// @brief Ƿڻ״̬
+    /// @brief 是否处于唤醒状态
     bool IsAwake() const;
 
     /// \~chinese
-    /// @brief û״̬
+    /// @brief 设置唤醒状态
     void SetAwake(bool flag);
 
     /// \~chinese
-    /// @brief Ƿ
+    /// @brief 是否启用休眠
     bool IsSleepingAllowed() const;
 
     /// \~chinese
-    /// @brief Ƿ
+    /// @brief 设置是否允许休眠
     void SetSleepingAllowed(bool flag);
 
     /// \~chinese
-    /// @brief Ƿ
+    /// @brief 是否启用
     bool IsActive() const;
 
     /// \~chinese
-    /// @brief ״̬
+    /// @brief 设置启用状态
     void SetActive(bool flag);
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取物体所在物理世界
     PhysicWorld* GetWorld() const;
 
     /// \~chinese
-    /// @brief 
+    /// @brief 销毁物体
     void Destroy();
 
     /// \~chinese
-    /// @brief ȡb2Body
+    /// @brief 获取b2Body
     b2Body* GetB2Body() const;
 
     /// \~chinese
-    /// @brief b2Body
+    /// @brief 设置b2Body
     void SetB2Body(b2Body* body);
 
 protected:
     /// \~chinese
-    /// @brief ʼ
+    /// @brief 初始化组件
     void InitComponent(Actor* actor) override;
 
     /// \~chinese
-    /// @brief 
+    /// @brief 销毁组件
     void DestroyComponent() override;
 
     /// \~chinese
-    /// @brief ״̬
+    /// @brief 更新物体状态
     void UpdateFromActor(Actor* actor);
 
     /// \~chinese
-    /// @brief ״̬
+    /// @brief 更新物体状态
     void UpdateFromActor(Actor* actor, const Matrix3x2& actor_to_world, float parent_rotation);
 
     /// \~chinese
-    /// @brief ¼о߹
+    /// @brief 更新夹具过滤器
     void UpdateFixtureFilter(b2Fixture* fixture);
 
     /// \~chinese
-    /// @brief ǰ
-    void BeforeSimulation(Actor* actor, const Matrix3x2& parent_to_world, const Matrix3x2& actor_to_world,
-                          float parent_rotation);
+    /// @brief 更新物理身体前
+    /// @details 角色的变换在上次同步后被修改时，将角色的位置和旋转同步到物体
+    /// @param world_actor 物理世界所在角色
+    /// @param force 是否忽略缓存强制同步
+    void BeforeSimulation(Actor* world_actor, bool force);
 
     /// \~chinese
-    /// @brief 
-    void AfterSimulation(Actor* actorconst, const Matrix3x2& parent_to_world, float parent_rotation);
+    /// @brief 更新物理身体后
+    /// @details 仅同步模拟前后处于唤醒状态的物体
+    void AfterSimulation();
+
+    /// \~chinese
+    /// @brief 更新父角色到物理世界的变换缓存
+    /// @return 角色是否在物理世界所在角色之下
+    bool UpdateParentTransform(Actor* actor, Actor* world_actor);
 
 private:
     PhysicWorld* world_;
@@ -365,6 +373,15 @@ private:
 
     Point offset_;
     Point position_cached_;
+
+    // Cached when the actor changes, the transform from its parent to the physic world
+    bool      in_world_;
+    bool      awake_before_;
+    uint32_t  synced_version_;
+    float     parent_rotation_;
+    size_t    bound_index_;
+    Matrix3x2 parent_to_world_;
+    Matrix3x2 world_to_parent_;
 };
 
 /** @} */
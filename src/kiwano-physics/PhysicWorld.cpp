@@ -20,6 +20,10 @@
 
 #include <kiwano-physics/PhysicWorld.h>
 #include <kiwano-physics/ContactEvent.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
 
 namespace kiwano
 {
@@ -28,83 +32,167 @@ namespace physics
 
 class PhysicWorld::DebugDrawer : public b2Draw
 {
+    // Primitives of the same color are collected into vertex buffers and
+    // submitted as one stroked and one filled shape at the end of the frame.
+    // The filled shape uses the winding rule, so overlapping shapes of the same
+    // color do not cancel each other out
+    struct Batch
+    {
+        b2Color        color;
+        BrushPtr       brush;
+        Vector<Point>  lines;          // Pairs of segment end points
+        Vector<Point>  polygons;       // Vertices of all filled polygons
+        Vector<size_t> polygon_sizes;  // Vertex count of each filled polygon
+        Vector<Point>  circles;        // Centers of stroked circles
+        Vector<float>  circle_radii;
+        Vector<Point>  solid_circles;  // Centers of filled circles
+        Vector<float>  solid_circle_radii;
+
+        void Clear()
+        {
+            lines.clear();
+            polygons.clear();
+            polygon_sizes.clear();
+            circles.clear();
+            circle_radii.clear();
+            solid_circles.clear();
+            solid_circle_radii.clear();
+        }
+    };
+
 public:
-    DebugDrawer(const Size& size)
+    DebugDrawer()
     {
-        canvas_ = MakePtr<Canvas>(size);
-        ctx_    = canvas_->GetContext2D();
-
         b2Draw::SetFlags(b2Draw::e_shapeBit | b2Draw::e_jointBit | b2Draw::e_jointBit | b2Draw::e_centerOfMassBit);
-    }
 
-    void BeginDraw()
-    {
-        ctx_->BeginDraw();
-        ctx_->Clear();
+        maker_.SetFillMode(FillMode::Winding);
     }
 
-    void EndDraw()
+    // Visible region in physic world coordinates, primitives outside of it are dropped
+    void BeginDraw(const b2AABB& visible_region)
     {
-        ctx_->EndDraw();
+        visible_region_ = visible_region;
+        for (auto& batch : batches_)
+        {
+            batch.Clear();
+        }
     }
 
-    void Render(RenderContext& ctx)
+    void EndDraw(RenderContext& ctx)
     {
-        canvas_->OnRender(ctx);
-    }
+        ctx.SetCurrentStrokeStyle(nullptr);
 
-    void SetFillColor(const b2Color& color)
-    {
-        ctx_->SetFillColor(reinterpret_cast<const Color&>(color));
-    }
+        // Fill all shapes first so that outlines, joints and axes stay on top
+        for (auto& batch : batches_)
+        {
+            if (batch.polygons.empty() && batch.solid_circles.empty())
+                continue;
+
+            const Point* vertices = batch.polygons.data();
+            for (auto size : batch.polygon_sizes)
+            {
+                maker_.BeginPath(vertices[0]);
+                maker_.AddLines(vertices + 1, size - 1);
+                maker_.EndFigure(true);
+                vertices += size;
+            }
+            for (size_t i = 0; i < batch.solid_circles.size(); ++i)
+            {
+                AddCircleFigure(batch.solid_circles[i], batch.solid_circle_radii[i]);
+            }
+
+            ShapePtr shape = maker_.GetShape();
+            if (shape)
+            {
+                ctx.SetCurrentBrush(batch.brush);
+                ctx.FillShape(*shape);
+            }
+        }
 
-    void SetLineColor(const b2Color& color)
-    {
-        ctx_->SetStrokeColor(reinterpret_cast<const Color&>(color));
+        for (auto& batch : batches_)
+        {
+            if (batch.lines.empty() && batch.circles.empty())
+                continue;
+
+            for (size_t i = 0; i + 1 < batch.lines.size(); i += 2)
+            {
+                maker_.BeginPath(batch.lines[i]);
+                maker_.AddLine(batch.lines[i + 1]);
+                maker_.EndFigure(false);
+            }
+            for (size_t i = 0; i < batch.circles.size(); ++i)
+            {
+                AddCircleFigure(batch.circles[i], batch.circle_radii[i]);
+            }
+
+            ShapePtr shape = maker_.GetShape();
+            if (shape)
+            {
+                ctx.SetCurrentBrush(batch.brush);
+                ctx.DrawShape(*shape);
+            }
+        }
     }
 
     void DrawPolygon(const b2Vec2* vertices, int32 vertexCount, const b2Color& color) override
     {
-        SetLineColor(color);
+        if (!IsVisible(vertices, vertexCount))
+            return;
+
+        Batch& batch = GetBatch(color);
 
         b2Vec2 p1 = vertices[vertexCount - 1];
         for (int32 i = 0; i < vertexCount; ++i)
         {
             b2Vec2 p2 = vertices[i];
-            ctx_->DrawLine(global::WorldToLocal(p1), global::WorldToLocal(p2));
+            batch.lines.push_back(global::WorldToLocal(p1));
+            batch.lines.push_back(global::WorldToLocal(p2));
             p1 = p2;
         }
     }
 
     void DrawSolidPolygon(const b2Vec2* vertices, int32 vertexCount, const b2Color& color) override
     {
-        Vector<Point> local_vertices;
+        if (vertexCount < 2 || !IsVisible(vertices, vertexCount))
+            return;
+
+        Batch& batch = GetBatch(color);
         for (int32 i = 0; i < vertexCount; ++i)
         {
-            local_vertices.push_back(global::WorldToLocal(vertices[i]));
+            batch.polygons.push_back(global::WorldToLocal(vertices[i]));
         }
-        ShapePtr polygon = Shape::CreatePolygon(local_vertices);
-
-        SetFillColor(color);
-        ctx_->FillShape(polygon);
+        batch.polygon_sizes.push_back(size_t(vertexCount));
     }
 
     void DrawCircle(const b2Vec2& center, float32 radius, const b2Color& color) override
     {
-        SetLineColor(color);
-        ctx_->DrawCircle(global::WorldToLocal(center), global::WorldToLocal(radius));
+        if (!IsVisible(center, radius))
+            return;
+
+        Batch& batch = GetBatch(color);
+        batch.circles.push_back(global::WorldToLocal(center));
+        batch.circle_radii.push_back(global::WorldToLocal(radius));
     }
 
     void DrawSolidCircle(const b2Vec2& center, float32 radius, const b2Vec2& axis, const b2Color& color) override
     {
-        SetFillColor(color);
-        ctx_->FillCircle(global::WorldToLocal(center), global::WorldToLocal(radius));
+        if (!IsVisible(center, radius))
+            return;
+
+        Batch& batch = GetBatch(color);
+        batch.solid_circles.push_back(global::WorldToLocal(center));
+        batch.solid_circle_radii.push_back(global::WorldToLocal(radius));
     }
 
     void DrawSegment(const b2Vec2& p1, const b2Vec2& p2, const b2Color& color) override
     {
-        SetLineColor(color);
-        ctx_->DrawLine(global::WorldToLocal(p1), global::WorldToLocal(p2));
+        b2Vec2 vertices[] = { p1, p2 };
+        if (!IsVisible(vertices, 2))
+            return;
+
+        Batch& batch = GetBatch(color);
+        batch.lines.push_back(global::WorldToLocal(p1));
+        batch.lines.push_back(global::WorldToLocal(p2));
     }
 
     void DrawTransform(const b2Transform& xf) override
@@ -113,28 +201,206 @@ public:
 
         b2Color red(1.0f, 0.0f, 0.0f);
         b2Color green(0.0f, 1.0f, 0.0f);
-        b2Vec2  p1 = xf.p, p2;
 
-        p2 = p1 + k_axisScale * xf.q.GetXAxis();
+        DrawSegment(xf.p, xf.p + k_axisScale * xf.q.GetXAxis(), red);
+        DrawSegment(xf.p, xf.p + k_axisScale * xf.q.GetYAxis(), green);
+    }
+
+    void DrawPoint(const b2Vec2& p, float32 size, const b2Color& color) override
+    {
+        if (!IsVisible(p, size))
+            return;
+
+        Batch& batch = GetBatch(color);
+        batch.solid_circles.push_back(global::WorldToLocal(p));
+        batch.solid_circle_radii.push_back(global::WorldToLocal(size));
+    }
 
-        SetLineColor(red);
-        ctx_->DrawLine(global::WorldToLocal(p1), global::WorldToLocal(p2));
+private:
+    Batch& GetBatch(const b2Color& color)
+    {
+        // Box2D only uses a handful of colors
+        for (auto& batch : batches_)
+        {
+            const b2Color& c = batch.color;
+            if (c.r == color.r && c.g == color.g && c.b == color.b && c.a == color.a)
+                return batch;
+        }
 
-        p2 = p1 + k_axisScale * xf.q.GetYAxis();
+        batches_.emplace_back();
 
-        SetLineColor(green);
-        ctx_->DrawLine(global::WorldToLocal(p1), global::WorldToLocal(p2));
+        Batch& batch = batches_.back();
+        batch.color  = color;
+        batch.brush  = MakePtr<Brush>(reinterpret_cast<const Color&>(color));
+        return batch;
     }
 
-    void DrawPoint(const b2Vec2& p, float32 size, const b2Color& color) override
+    bool IsVisible(const b2Vec2* vertices, int32 count) const
+    {
+        b2AABB aabb;
+        aabb.lowerBound = aabb.upperBound = vertices[0];
+        for (int32 i = 1; i < count; ++i)
+        {
+            aabb.lowerBound = b2Min(aabb.lowerBound, vertices[i]);
+            aabb.upperBound = b2Max(aabb.upperBound, vertices[i]);
+        }
+        return b2TestOverlap(aabb, visible_region_);
+    }
+
+    bool IsVisible(const b2Vec2& center, float32 radius) const
+    {
+        b2AABB aabb;
+        aabb.lowerBound = center - b2Vec2(radius, radius);
+        aabb.upperBound = center + b2Vec2(radius, radius);
+        return b2TestOverlap(aabb, visible_region_);
+    }
+
+    // Box2D polygons are counter-clockwise and keep that orientation after WorldToLocal, which only scales.
+    // A clockwise sweep in the y-down local space has the same orientation, so circles wind like polygons
+    void AddCircleFigure(const Point& center, float radius)
+    {
+        const Size radius_size(radius, radius);
+        maker_.BeginPath(Point(center.x + radius, center.y));
+        maker_.AddArc(Point(center.x - radius, center.y), radius_size, 0.0f);
+        maker_.AddArc(Point(center.x + radius, center.y), radius_size, 0.0f);
+        maker_.EndFigure(true);
+    }
+
+private:
+    b2AABB        visible_region_;
+    ShapeMaker    maker_;
+    Vector<Batch> batches_;
+};
+
+class PhysicWorld::TaskExecutor : public b2TaskExecutor
+{
+public:
+    TaskExecutor(uint32_t thread_count)
+        : thread_count_(int32(thread_count))
+        , quit_(false)
+        , generation_(0)
+        , busy_workers_(0)
+        , task_(nullptr)
+        , count_(0)
+        , range_size_(0)
+        , range_count_(0)
+        , next_range_(0)
+    {
+        // The calling thread always takes part, so one thread less is started
+        for (int32 i = 1; i < thread_count_; ++i)
+        {
+            workers_.emplace_back(Closure(this, &TaskExecutor::WorkerLoop), i);
+        }
+    }
+
+    ~TaskExecutor()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            quit_ = true;
+        }
+        work_cond_.notify_all();
+
+        for (auto& worker : workers_)
+        {
+            worker.join();
+        }
+    }
+
+    int32 GetThreadCount() const override
+    {
+        return thread_count_;
+    }
+
+    void ParallelFor(int32 count, int32 min_range, b2Task* task) override
+    {
+        if (count <= 0)
+            return;
+
+        // A few ranges per thread keep the threads busy when the items have different costs,
+        // e.g. islands of different sizes
+        int32 range_count = std::min((count + min_range - 1) / min_range, thread_count_ * 4);
+        if (range_count <= 1 || workers_.empty())
+        {
+            task->Execute(0, count, 0);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_        = task;
+            count_       = count;
+            range_count_ = range_count;
+            range_size_  = (count + range_count - 1) / range_count;
+            next_range_.store(0);
+            busy_workers_ = int32(workers_.size());
+            ++generation_;
+        }
+        work_cond_.notify_all();
+
+        ExecuteRanges(0);
+
+        // Every worker has to see this generation, so none of them reads the task after returning
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cond_.wait(lock, [this]() { return busy_workers_ == 0; });
+        task_ = nullptr;
+    }
+
+private:
+    void WorkerLoop(int32 thread_index)
     {
-        SetFillColor(color);
-        ctx_->FillCircle(global::WorldToLocal(p), global::WorldToLocal(size));
+        uint64_t generation = 0;
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                work_cond_.wait(lock, [&]() { return quit_ || generation_ != generation; });
+                if (quit_)
+                    break;
+                generation = generation_;
+            }
+
+            ExecuteRanges(thread_index);
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--busy_workers_ == 0)
+            {
+                done_cond_.notify_one();
+            }
+        }
+    }
+
+    void ExecuteRanges(int32 thread_index)
+    {
+        while (true)
+        {
+            int32 range = next_range_.fetch_add(1);
+            if (range >= range_count_)
+                break;
+
+            int32 begin = range * range_size_;
+            int32 end   = std::min(begin + range_size_, count_);
+            if (begin < end)
+            {
+                task_->Execute(begin, end, thread_index);
+            }
+        }
     }
 
 private:
-    CanvasPtr              canvas_;
-    CanvasRenderContextPtr ctx_;
+    int32                   thread_count_;
+    bool                    quit_;
+    uint64_t                generation_;
+    int32                   busy_workers_;
+    b2Task*                 task_;
+    int32                   count_;
+    int32                   range_size_;
+    int32                   range_count_;
+    std::atomic<int32>      next_range_;
+    Vector<std::thread>     workers_;
+    std::mutex              mutex_;
+    std::condition_variable work_cond_;
+    std::condition_variable done_cond_;
 };
 
 class DestructionListener : public b2DestructionListener
@@ -155,40 +421,54 @@ public:
     void SayGoodbye(b2Fixture* fixture) override {}
 };
 
-class ContactListener : public b2ContactListener
+template <typename _Ty>
+RefPtr<_Ty> AcquireContactEvent(RefPtr<_Ty>& cached)
 {
-    Function<void(Event*)> dispatcher_;
+    // Reuse the cached event unless a listener is still holding it
+    if (!cached || cached->GetRefCount() > 1)
+    {
+        cached = MakePtr<_Ty>();
+    }
+    return cached;
+}
+
+class PhysicWorld::ContactListener : public b2ContactListener
+{
+    PhysicWorld* world_;
 
 public:
-    ContactListener(Function<void(Event*)> dispatcher)
-        : dispatcher_(dispatcher)
+    ContactListener(PhysicWorld* world)
+        : world_(world)
     {
     }
 
     void BeginContact(b2Contact* b2contact) override
     {
-        Contact contact;
-        contact.SetB2Contact(b2contact);
-
-        ContactBeginEventPtr evt = new ContactBeginEvent(contact);
-        dispatcher_(evt.Get());
+        world_->pending_contacts_.push_back(ContactRecord{ b2contact, true });
     }
 
     void EndContact(b2Contact* b2contact) override
     {
-        PhysicBody* body_a = static_cast<PhysicBody*>(b2contact->GetFixtureA()->GetBody()->GetUserData());
-        PhysicBody* body_b = static_cast<PhysicBody*>(b2contact->GetFixtureB()->GetBody()->GetUserData());
-        if (!body_a || !body_b || !body_a->GetBoundActor() || !body_b->GetBoundActor())
+        if (!b2contact->IsTouching())
         {
-            // Don't dispatch contact event after the body has been detached
+            world_->pending_contacts_.push_back(ContactRecord{ b2contact, false });
             return;
         }
 
-        Contact contact;
-        contact.SetB2Contact(b2contact);
+        // The contact is being destroyed while it is still touching, so it can't be
+        // kept until the end of the step. Dispatch the event right now, unless the
+        // listeners have never been told that it began.
+        if (world_->CancelContactEvents(b2contact))
+            return;
+
+        ContactEndEventPtr evt = AcquireContactEvent(world_->end_event_);
+        evt->contact.SetB2Contact(b2contact);
+        world_->DispatchContactEvent(evt.Get(), evt->contact);
+    }
 
-        ContactEndEventPtr evt = new ContactEndEvent(contact);
-        dispatcher_(evt.Get());
+    void DestroyContact(b2Contact* b2contact) override
+    {
+        world_->CancelContactEvents(b2contact);
     }
 
     void PreSolve(b2Contact* contact, const b2Manifold* oldManifold) override
@@ -220,7 +500,7 @@ PhysicWorld::PhysicWorld()
     destroy_listener_ = std::make_unique<DestructionListener>(Closure(this, &PhysicWorld::JointRemoved));
     world_.SetDestructionListener(destroy_listener_.get());
 
-    contact_listener_ = std::make_unique<ContactListener>(Closure(this, &PhysicWorld::DispatchEvent));
+    contact_listener_ = std::make_unique<ContactListener>(this);
     world_.SetContactListener(contact_listener_.get());
 }
 
@@ -228,6 +508,7 @@ PhysicWorld::~PhysicWorld()
 {
     world_.SetDestructionListener(nullptr);
     world_.SetContactListener(nullptr);
+    world_.SetTaskExecutor(nullptr);
 
     // Make sure b2World was destroyed after b2Body
     RemoveAllJoints();
@@ -340,41 +621,128 @@ void PhysicWorld::InitComponent(Actor* actor)
     Component::InitComponent(actor);
 
     // Update body status
-    Actor* world_actor = GetBoundActor();
-    BeforeSimulation(world_actor, Matrix3x2(), 0.0f);
+    BeforeSimulation(true);
 }
 
 void PhysicWorld::OnUpdate(Duration dt)
 {
-    Actor* world_actor = GetBoundActor();
-
-    BeforeSimulation(world_actor, Matrix3x2(), 0.0f);
+    BeforeSimulation(false);
 
     // Update physic world
     world_.Step(dt.GetSeconds(), vel_iter_, pos_iter_);
 
-    AfterSimulation(world_actor, Matrix3x2(), 0.0f);
+    AfterSimulation();
+
+    DispatchContactEvents();
 }
 
 void PhysicWorld::OnRender(RenderContext& ctx)
 {
-    if (drawer_)
+    Actor* world_actor = GetBoundActor();
+    if (drawer_ && world_actor)
     {
-        drawer_->BeginDraw();
+        // Map the render target back to the world actor to find the visible region
+        Matrix3x2 to_target = world_actor->GetRenderMatrix() * ctx.GetGlobalTransform();
+        Matrix3x2 to_local  = to_target.Invert();
+        Size      size      = ctx.GetSize();
+
+        Point corners[] = { to_local.Transform(Point(0, 0)), to_local.Transform(Point(size.x, 0)),
+                            to_local.Transform(Point(size.x, size.y)), to_local.Transform(Point(0, size.y)) };
+
+        b2AABB region;
+        region.lowerBound = region.upperBound = global::LocalToWorld(corners[0]);
+        for (const auto& corner : corners)
+        {
+            b2Vec2 p          = global::LocalToWorld(corner);
+            region.lowerBound = b2Min(region.lowerBound, p);
+            region.upperBound = b2Max(region.upperBound, p);
+        }
+
+        drawer_->BeginDraw(region);
         world_.DrawDebugData();
-        drawer_->EndDraw();
+        drawer_->EndDraw(ctx);
+    }
+}
+
+void PhysicWorld::DispatchContactEvents()
+{
+    // Listeners may destroy bodies and cancel the remaining records, but no record is
+    // added until the next step
+    for (size_t i = 0; i < pending_contacts_.size(); ++i)
+    {
+        const ContactRecord record = pending_contacts_[i];
+        if (!record.contact)
+            continue;
+
+        if (record.begin)
+        {
+            ContactBeginEventPtr evt = AcquireContactEvent(begin_event_);
+            evt->contact.SetB2Contact(record.contact);
+            DispatchContactEvent(evt.Get(), evt->contact);
+        }
+        else
+        {
+            ContactEndEventPtr evt = AcquireContactEvent(end_event_);
+            evt->contact.SetB2Contact(record.contact);
+            DispatchContactEvent(evt.Get(), evt->contact);
+        }
+    }
+    pending_contacts_.clear();
+}
 
-        drawer_->Render(ctx);
+void PhysicWorld::DispatchContactEvent(Event* evt, const Contact& contact)
+{
+    b2Contact*  b2contact = contact.GetB2Contact();
+    PhysicBody* body_a    = static_cast<PhysicBody*>(b2contact->GetFixtureA()->GetBody()->GetUserData());
+    PhysicBody* body_b    = static_cast<PhysicBody*>(b2contact->GetFixtureB()->GetBody()->GetUserData());
+    if (!body_a || !body_b)
+        return;
+
+    Actor* actor_a = body_a->GetBoundActor();
+    if (actor_a && actor_a->IsEventDispatchEnabled())
+    {
+        if (!actor_a->HandleEvent(evt))
+            return;
+    }
+
+    Actor* actor_b = body_b->GetBoundActor();
+    if (actor_b && actor_b != actor_a && actor_b->IsEventDispatchEnabled())
+    {
+        if (!actor_b->HandleEvent(evt))
+            return;
+    }
+
+    Actor* world_actor = GetBoundActor();
+    if (world_actor && world_actor != actor_a && world_actor != actor_b && world_actor->IsEventDispatchEnabled())
+    {
+        if (!contact_filter_ || contact_filter_(contact))
+        {
+            world_actor->HandleEvent(evt);
+        }
     }
 }
 
-void PhysicWorld::DispatchEvent(Event* evt)
+bool PhysicWorld::CancelContactEvents(b2Contact* b2contact)
 {
-    Actor* actor = GetBoundActor();
-    if (actor)
+    // Records can only go stale when bodies are changed outside of the step
+    if (world_.IsLocked())
+        return false;
+
+    // Listeners still see the state before the first record
+    bool found = false, began = false;
+    for (auto& record : pending_contacts_)
     {
-        actor->DispatchEvent(evt);
+        if (record.contact == b2contact)
+        {
+            if (!found)
+            {
+                found = true;
+                began = record.begin;
+            }
+            record.contact = nullptr;
+        }
     }
+    return began;
 }
 
 void PhysicWorld::JointRemoved(b2Joint* b2joint)
@@ -390,47 +758,74 @@ void PhysicWorld::JointRemoved(b2Joint* b2joint)
     }
 }
 
-void PhysicWorld::BeforeSimulation(Actor* parent, const Matrix3x2& parent_to_world, float parent_rotation)
+void PhysicWorld::BeforeSimulation(bool force)
 {
-    for (auto child : parent->GetAllChildren())
+    Actor* world_actor = GetBoundActor();
+    for (auto body : bound_bodies_)
     {
-        Matrix3x2 child_to_world = child->GetTransformMatrixToParent() * parent_to_world;
-
-        PhysicBody* body = child->GetPhysicBody();
-        if (body)
-        {
-            body->BeforeSimulation(child.Get(), parent_to_world, child_to_world, parent_rotation);
-        }
+        body->BeforeSimulation(world_actor, force);
+    }
+}
 
-        float rotation = parent_rotation + child->GetRotation();
-        BeforeSimulation(child.Get(), child_to_world, rotation);
+void PhysicWorld::AfterSimulation()
+{
+    for (auto body : bound_bodies_)
+    {
+        body->AfterSimulation();
     }
 }
 
-void PhysicWorld::AfterSimulation(Actor* parent, const Matrix3x2& parent_to_world, float parent_rotation)
+void PhysicWorld::AddBoundBody(PhysicBody* body)
 {
-    for (auto child : parent->GetAllChildren())
+    if (body->bound_index_ == size_t(-1))
     {
-        PhysicBody* body = child->GetPhysicBody();
-        if (body)
-        {
-            body->AfterSimulation(child.Get(), parent_to_world, parent_rotation);
-        }
+        body->bound_index_ = bound_bodies_.size();
+        bound_bodies_.push_back(body);
+    }
+}
+
+void PhysicWorld::RemoveBoundBody(PhysicBody* body)
+{
+    size_t index = body->bound_index_;
+    if (index == size_t(-1))
+        return;
 
-        Matrix3x2 child_to_world = child->GetTransformMatrixToParent() * parent_to_world;
-        float     rotation       = parent_rotation + child->GetRotation();
-        AfterSimulation(child.Get(), child_to_world, rotation);
+    // Swap with the last one, the order of synchronization doesn't matter
+    PhysicBody* last = bound_bodies_.back();
+    bound_bodies_[index] = last;
+    last->bound_index_   = index;
+    bound_bodies_.pop_back();
+
+    body->bound_index_ = size_t(-1);
+}
+
+void PhysicWorld::SetThreadCount(uint32_t count)
+{
+    if (count == GetThreadCount())
+        return;
+
+    world_.SetTaskExecutor(nullptr);
+    executor_.reset();
+
+    if (count > 1)
+    {
+        executor_ = std::unique_ptr<TaskExecutor>(new TaskExecutor(count));
+        world_.SetTaskExecutor(executor_.get());
     }
 }
 
+uint32_t PhysicWorld::GetThreadCount() const
+{
+    return executor_ ? uint32_t(executor_->GetThreadCount()) : 1;
+}
+
 void PhysicWorld::ShowDebugInfo(bool show)
 {
     if (show)
     {
         if (!drawer_)
         {
-            Size size = Renderer::GetInstance().GetOutputSize();
-            drawer_   = std::unique_ptr<DebugDrawer>(new DebugDrawer(size));
+            drawer_ = std::unique_ptr<DebugDrawer>(new DebugDrawer);
 
             world_.SetDebugDraw(drawer_.get());
         }
@@ -21,6 +21,7 @@
 #pragma once
 #include <kiwano-physics/PhysicBody.h>
 #include <kiwano-physics/Joint.h>
+#include <kiwano-physics/ContactEvent.h>
 
 namespace kiwano
 {
@@ -29,7 +30,7 @@ namespace physics
 
 /**
  * \~chinese
- * \defgroup Physics ģ
+ * \defgroup Physics 物理模块
  */
 
 /**
@@ -39,7 +40,7 @@ namespace physics
 
 /**
  * \~chinese
- * @brief 
+ * @brief 物理世界
  */
 class KGE_API PhysicWorld : public Component
 {
@@ -47,107 +48,149 @@ class KGE_API PhysicWorld : public Component
     friend class Joint;
 
 public:
+    /// \~chinese
+    /// @brief 接触事件过滤器
+    using ContactEventFilter = Function<bool(const Contact&)>;
+
     PhysicWorld();
 
     /// \~chinese
-    /// @brief 
-    /// @param gravity 
+    /// @brief 创建物理世界
+    /// @param gravity 重力
     PhysicWorld(const Vec2& gravity);
 
     virtual ~PhysicWorld();
 
     /// \~chinese
-    /// @brief 
+    /// @brief 添加物体
     void AddBody(PhysicBodyPtr body);
 
     /// \~chinese
-    /// @brief Ƴ
+    /// @brief 移除物体
     void RemoveBody(PhysicBodyPtr body);
 
     /// \~chinese
-    /// @brief Ƴ
+    /// @brief 移除所有物体
     void RemoveAllBodies();
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取所有物体
     const List<PhysicBodyPtr>& GetAllBodies() const;
 
     /// \~chinese
-    /// @brief ӹؽ
+    /// @brief 添加关节
     void AddJoint(JointPtr joint);
 
     /// \~chinese
-    /// @brief Ƴؽ
+    /// @brief 移除关节
     void RemoveJoint(JointPtr joint);
 
     /// \~chinese
-    /// @brief Ƴйؽ
+    /// @brief 移除所有关节
     void RemoveAllJoints();
 
     /// \~chinese
-    /// @brief ȡйؽ
+    /// @brief 获取所有关节
     const List<JointPtr>& GetAllJoints() const;
 
     /// \~chinese
-    /// @brief ȡ [N]
+    /// @brief 获取重力 [N]
     Vec2 GetGravity() const;
 
     /// \~chinese
-    /// @brief  [N]
+    /// @brief 设置重力 [N]
     void SetGravity(Vec2 gravity);
 
     /// \~chinese
-    /// @brief ȡӴб
+    /// @brief 获取物理接触列表
     ContactList GetContactList();
 
     /// \~chinese
-    /// @brief ٶȵ, ĬΪ 6
+    /// @brief 设置物理世界所在角色的接触事件过滤器
+    /// @details 接触事件在每次模拟结束后统一分发，只发送给接触双方物体绑定的角色和物理世界所在的角色。
+    /// 设置过滤器后，只有过滤器返回 true 的接触事件会发送给物理世界所在的角色
+    void SetContactEventFilter(const ContactEventFilter& filter);
+
+    /// \~chinese
+    /// @brief 设置速度迭代次数, 默认为 6
     void SetVelocityIterations(int vel_iter);
 
     /// \~chinese
-    /// @brief λõ, ĬΪ 2
+    /// @brief 设置位置迭代次数, 默认为 2
     void SetPositionIterations(int pos_iter);
 
     /// \~chinese
-    /// @brief ǷƵϢ
+    /// @brief 设置模拟使用的线程数量
+    /// @details 默认为 1，即在主线程中模拟。大于 1 时，宽相位检测、接触点更新和刚体岛求解会分配到工作线程中并行执行，
+    /// 接触事件仍在主线程中按固定顺序分发。多线程模拟的结果与线程数量无关，但与单线程模拟可能有细微差别
+    void SetThreadCount(uint32_t count);
+
+    /// \~chinese
+    /// @brief 获取模拟使用的线程数量
+    uint32_t GetThreadCount() const;
+
+    /// \~chinese
+    /// @brief 获取上一次模拟各阶段的耗时（毫秒）
+    const b2Profile& GetProfile() const;
+
+    /// \~chinese
+    /// @brief 设置是否绘制调试信息
     void ShowDebugInfo(bool show);
 
     /// \~chinese
-    /// @brief ȡb2World
+    /// @brief 获取b2World
     b2World* GetB2World();
 
     /// \~chinese
-    /// @brief ȡb2World
+    /// @brief 获取b2World
     const b2World* GetB2World() const;
 
 protected:
     /// \~chinese
-    /// @brief ʼ
+    /// @brief 初始化组件
     void InitComponent(Actor* actor) override;
 
     /// \~chinese
-    /// @brief 
+    /// @brief 更新组件
     void OnUpdate(Duration dt) override;
 
     /// \~chinese
-    /// @brief Ⱦ
+    /// @brief 渲染组件
     void OnRender(RenderContext& ctx) override;
 
     /// \~chinese
-    /// @brief ַ¼
-    void DispatchEvent(Event* evt);
+    /// @brief 分发本次模拟产生的接触事件
+    void DispatchContactEvents();
+
+    /// \~chinese
+    /// @brief 将接触事件发送给接触双方和物理世界所在的角色
+    void DispatchContactEvent(Event* evt, const Contact& contact);
+
+    /// \~chinese
+    /// @brief 取消等待分发的接触事件
+    /// @return 是否存在等待分发的接触开始事件
+    bool CancelContactEvents(b2Contact* b2contact);
 
     /// \~chinese
-    /// @brief ؽƳʱĻص
+    /// @brief 关节移除时的回调函数
     void JointRemoved(b2Joint* b2joint);
 
     /// \~chinese
-    /// @brief ǰ
-    void BeforeSimulation(Actor* parent, const Matrix3x2& parent_to_world, float parent_rotation);
+    /// @brief 更新物理世界前
+    /// @param force 是否同步所有物体
+    void BeforeSimulation(bool force);
 
     /// \~chinese
-    /// @brief 
-    void AfterSimulation(Actor* parent, const Matrix3x2& parent_to_world, float parent_rotation);
+    /// @brief 更新物理世界后
+    void AfterSimulation();
+
+    /// \~chinese
+    /// @brief 物体绑定到角色时加入同步列表
+    void AddBoundBody(PhysicBody* body);
+
+    /// \~chinese
+    /// @brief 物体与角色解绑时移出同步列表
+    void RemoveBoundBody(PhysicBody* body);
 
 private:
     bool    debug_;
@@ -158,15 +201,36 @@ private:
     class DebugDrawer;
     std::unique_ptr<DebugDrawer> drawer_;
 
+    class TaskExecutor;
+    std::unique_ptr<TaskExecutor> executor_;
+
     List<PhysicBodyPtr> bodies_;
     List<JointPtr>      joints_;
+    Vector<PhysicBody*> bound_bodies_;
+
+    struct ContactRecord
+    {
+        b2Contact* contact;
+        bool       begin;
+    };
+
+    class ContactListener;
+    Vector<ContactRecord> pending_contacts_;
+    ContactBeginEventPtr  begin_event_;
+    ContactEndEventPtr    end_event_;
+    ContactEventFilter    contact_filter_;
 
     std::unique_ptr<b2DestructionListener> destroy_listener_;
-    std::unique_ptr<b2ContactListener>     contact_listener_;
+    std::unique_ptr<ContactListener>       contact_listener_;
 };
 
 /** @} */
 
+inline void PhysicWorld::SetContactEventFilter(const ContactEventFilter& filter)
+{
+    contact_filter_ = filter;
+}
+
 inline void PhysicWorld::SetVelocityIterations(int vel_iter)
 {
     vel_iter_ = vel_iter;
@@ -177,5 +241,10 @@ inline void PhysicWorld::SetPositionIterations(int pos_iter)
     pos_iter_ = pos_iter;
 }
 
+inline const b2Profile& PhysicWorld::GetProfile() const
+{
+    return world_.GetProfile();
+}
+
 }  // namespace physics
 }  // namespace kiwano
@@ -31,6 +31,26 @@ namespace
 float default_anchor_x = 0.f;
 float default_anchor_y = 0.f;
 
+// Bumped whenever any local transform changes, actors validated in the current epoch are up to date
+uint64_t transform_epoch = 1;
+
+uint32_t transform_update_count            = 0;
+uint32_t last_frame_transform_update_count = 0;
+
+// Fixed simulation steps started so far, and how far rendering is between the last two of them
+uint32_t simulation_step     = 1;
+float    interpolation_alpha = 1.f;
+
+float LerpAngle(float from, float to, float alpha)
+{
+    float delta = std::fmod(to - from, 360.f);
+    if (delta > 180.f)
+        delta -= 360.f;
+    else if (delta < -180.f)
+        delta += 360.f;
+    return from + delta * alpha;
+}
+
 }  // namespace
 
 void Actor::SetDefaultAnchor(float anchor_x, float anchor_y)
@@ -39,6 +59,27 @@ void Actor::SetDefaultAnchor(float anchor_x, float anchor_y)
     default_anchor_y = anchor_y;
 }
 
+uint32_t Actor::GetLastFrameTransformCount()
+{
+    return last_frame_transform_update_count;
+}
+
+void Actor::ResetTransformCount()
+{
+    last_frame_transform_update_count = transform_update_count;
+    transform_update_count            = 0;
+}
+
+void Actor::AdvanceSimulationStep()
+{
+    ++simulation_step;
+}
+
+void Actor::SetInterpolationAlpha(float alpha)
+{
+    interpolation_alpha = alpha;
+}
+
 Actor::Actor()
     : ComponentManager(this)
     , visible_(true)
@@ -47,12 +88,23 @@ Actor::Actor()
     , cascade_opacity_(true)
     , show_border_(false)
     , evt_dispatch_enabled_(true)
+    , interpolation_enabled_(false)
+    , render_interpolated_(false)
     , dirty_flag_(DirtyFlag::DirtyVisibility)
     , parent_(nullptr)
     , stage_(nullptr)
     , physic_body_(nullptr)
     , hash_name_(0)
     , z_order_(0)
+    , index_proxy_(SpatialIndex::NULL_PROXY)
+    , dirty_index_(0)
+    , render_order_(0)
+    , mouse_sensor_count_(0)
+    , mouse_hover_count_(0)
+    , transform_epoch_(0)
+    , transform_version_(0)
+    , parent_transform_version_(0)
+    , interpolation_step_(0)
     , opacity_(1.f)
     , displayed_opacity_(1.f)
     , anchor_(default_anchor_x, default_anchor_y)
@@ -96,10 +148,13 @@ void Actor::Render(RenderContext& ctx)
         return;
 
     UpdateTransform();
+    UpdateRenderMatrix();
     UpdateOpacity();
 
     if (children_.IsEmpty())
     {
+        UpdateRenderOrder();
+
         if (CheckVisibility(ctx))
         {
             PrepareToRender(ctx);
@@ -120,6 +175,8 @@ void Actor::Render(RenderContext& ctx)
             child = child->GetNext();
         }
 
+        UpdateRenderOrder();
+
         if (CheckVisibility(ctx))
         {
             PrepareToRender(ctx);
@@ -137,7 +194,9 @@ void Actor::Render(RenderContext& ctx)
 
 void Actor::PrepareToRender(RenderContext& ctx)
 {
-    ctx.SetTransform(transform_matrix_);
+    // Sprites batched before this actor must be drawn first
+    ctx.FlushSprites();
+    ctx.SetTransform(GetRenderMatrix());
     ctx.SetBrushOpacity(GetDisplayedOpacity());
 }
 
@@ -150,7 +209,7 @@ void Actor::RenderBorder(RenderContext& ctx)
     {
         Rect bounds = GetBounds();
 
-        ctx.SetTransform(transform_matrix_);
+        ctx.SetTransform(GetRenderMatrix());
 
         ctx.SetCurrentBrush(GetStage()->GetBorderFillBrush());
         ctx.FillRectangle(bounds);
@@ -167,6 +226,13 @@ void Actor::RenderBorder(RenderContext& ctx)
 
 bool Actor::CheckVisibility(RenderContext& ctx) const
 {
+    if (render_interpolated_)
+    {
+        // The render matrix changes every frame, check it directly and refresh the cache afterwards
+        dirty_flag_.Set(DirtyFlag::DirtyVisibility);
+        return !size_.IsOrigin() && ctx.CheckVisibility(GetBounds(), render_matrix_);
+    }
+
     if (dirty_flag_.Has(DirtyFlag::DirtyVisibility))
     {
         dirty_flag_.Unset(DirtyFlag::DirtyVisibility);
@@ -273,9 +339,21 @@ const Matrix3x2& Actor::GetTransformMatrixToParent() const
 
 void Actor::UpdateTransform() const
 {
-    if (!dirty_flag_.Has(DirtyFlag::DirtyTransform))
+    if (transform_epoch_ == transform_epoch)
         return;
 
+    // Ancestors have to be validated first, their versions tell whether this actor is out of date
+    if (parent_)
+        parent_->UpdateTransform();
+
+    transform_epoch_ = transform_epoch;
+
+    if (!dirty_flag_.Has(DirtyFlag::DirtyTransform))
+    {
+        if (!parent_ || parent_transform_version_ == parent_->transform_version_)
+            return;
+    }
+
     dirty_flag_.Unset(DirtyFlag::DirtyTransform);
     dirty_flag_.Set(DirtyFlag::DirtyTransformInverse);
     dirty_flag_.Set(DirtyFlag::DirtyVisibility);
@@ -297,11 +375,19 @@ void Actor::UpdateTransform() const
     if (parent_)
     {
         transform_matrix_ *= parent_->transform_matrix_;
+        parent_transform_version_ = parent_->transform_version_;
     }
 
-    // update children's transform
-    for (const auto& child : children_)
-        child->dirty_flag_.Set(DirtyFlag::DirtyTransform);
+    // children are updated lazily when they find the version changed
+    ++transform_version_;
+    ++transform_update_count;
+
+    // but the spatial index has to know their bounds changed
+    if (stage_ && stage_->IsSpatialIndexEnabled())
+    {
+        for (const auto& child : children_)
+            child->InvalidateBounds();
+    }
 }
 
 void Actor::UpdateOpacity()
@@ -324,11 +410,87 @@ void Actor::UpdateOpacity()
         child->dirty_flag_.Set(DirtyFlag::DirtyOpacity);
 }
 
+void Actor::InvalidateBounds() const
+{
+    if (stage_ && stage_ != this && stage_->IsSpatialIndexEnabled() && !dirty_flag_.Has(DirtyFlag::DirtyBounds))
+    {
+        dirty_flag_.Set(DirtyFlag::DirtyBounds);
+        stage_->IndexActor(const_cast<Actor*>(this));
+    }
+}
+
+void Actor::UpdateRenderMatrix() const
+{
+    bool follow_parent = parent_ && parent_->render_interpolated_;
+    bool interpolate   = interpolation_enabled_ && interpolation_step_ == simulation_step && interpolation_alpha < 1.f;
+
+    render_interpolated_ = follow_parent || interpolate;
+    if (!render_interpolated_)
+        return;
+
+    if (interpolate)
+    {
+        const Transform& from  = prev_transform_;
+        const Transform& to    = transform_;
+        const float      alpha = interpolation_alpha;
+
+        Transform transform;
+        transform.position = from.position + (to.position - from.position) * alpha;
+        transform.scale    = from.scale + (to.scale - from.scale) * alpha;
+        transform.skew     = from.skew + (to.skew - from.skew) * alpha;
+        transform.rotation = LerpAngle(from.rotation, to.rotation, alpha);
+
+        render_matrix_ = transform.IsFast() ? Matrix3x2::Translation(transform.position) : transform.ToMatrix();
+        render_matrix_.Translate(Point(-size_.x * anchor_.x, -size_.y * anchor_.y));
+    }
+    else
+    {
+        render_matrix_ = transform_matrix_to_parent_;
+    }
+
+    if (parent_)
+    {
+        render_matrix_ *= parent_->GetRenderMatrix();
+    }
+}
+
+void Actor::KeepPreviousTransform()
+{
+    // The first change in a simulation step keeps the transform the step started from
+    if (interpolation_enabled_ && interpolation_step_ != simulation_step)
+    {
+        prev_transform_     = transform_;
+        interpolation_step_ = simulation_step;
+    }
+}
+
+void Actor::MarkTransformDirty() const
+{
+    dirty_flag_.Set(DirtyFlag::DirtyTransform);
+    ++transform_epoch;
+    InvalidateBounds();
+}
+
+void Actor::UpdateRenderOrder()
+{
+    if (stage_)
+    {
+        render_order_ = stage_->render_order_counter_++;
+    }
+}
+
 void Actor::SetStage(Stage* stage)
 {
     if (stage_ != stage)
     {
+        if (stage_ && stage_ != this)
+        {
+            stage_->UnindexActor(this);
+        }
+
         stage_ = stage;
+        InvalidateBounds();
+
         for (auto& child : children_)
         {
             child->SetStage(stage);
@@ -401,7 +563,7 @@ void Actor::SetAnchor(const Vec2& anchor)
         return;
 
     anchor_ = anchor;
-    dirty_flag_.Set(DirtyFlag::DirtyTransform);
+    MarkTransformDirty();
 }
 
 void Actor::SetSize(const Size& size)
@@ -410,13 +572,25 @@ void Actor::SetSize(const Size& size)
         return;
 
     size_ = size;
-    dirty_flag_.Set(DirtyFlag::DirtyTransform);
+    MarkTransformDirty();
 }
 
 void Actor::SetTransform(const Transform& transform)
 {
+    KeepPreviousTransform();
     transform_ = transform;
-    dirty_flag_.Set(DirtyFlag::DirtyTransform);
+    MarkTransformDirty();
+}
+
+void Actor::SetInterpolationEnabled(bool enabled)
+{
+    interpolation_enabled_ = enabled;
+    ResetInterpolation();
+}
+
+void Actor::ResetInterpolation()
+{
+    interpolation_step_ = 0;
 }
 
 void Actor::SetVisible(bool val)
@@ -435,8 +609,9 @@ void Actor::SetPosition(const Point& pos)
     if (transform_.position == pos)
         return;
 
+    KeepPreviousTransform();
     transform_.position = pos;
-    dirty_flag_.Set(DirtyFlag::DirtyTransform);
+    MarkTransformDirty();
 }
 
 void Actor::SetScale(const Vec2& scale)
@@ -444,8 +619,9 @@ void Actor::SetScale(const Vec2& scale)
     if (transform_.scale == scale)
         return;
 
+    KeepPreviousTransform();
     transform_.scale = scale;
-    dirty_flag_.Set(DirtyFlag::DirtyTransform);
+    MarkTransformDirty();
 }
 
 void Actor::SetSkew(const Vec2& skew)
@@ -453,8 +629,9 @@ void Actor::SetSkew(const Vec2& skew)
     if (transform_.skew == skew)
         return;
 
+    KeepPreviousTransform();
     transform_.skew = skew;
-    dirty_flag_.Set(DirtyFlag::DirtyTransform);
+    MarkTransformDirty();
 }
 
 void Actor::SetRotation(float angle)
@@ -462,8 +639,9 @@ void Actor::SetRotation(float angle)
     if (transform_.rotation == angle)
         return;
 
+    KeepPreviousTransform();
     transform_.rotation = angle;
-    dirty_flag_.Set(DirtyFlag::DirtyTransform);
+    MarkTransformDirty();
 }
 
 void Actor::AddChild(ActorPtr child)
@@ -489,7 +667,7 @@ void Actor::AddChild(ActorPtr child)
         child->parent_ = this;
         child->SetStage(this->stage_);
 
-        child->dirty_flag_.Set(DirtyFlag::DirtyTransform);
+        child->MarkTransformDirty();
         child->dirty_flag_.Set(DirtyFlag::DirtyOpacity);
         child->Reorder();
     }
@@ -578,6 +756,7 @@ void Actor::RemoveChild(ActorPtr child)
     if (child)
     {
         child->parent_ = nullptr;
+        child->MarkTransformDirty();
         if (child->stage_)
             child->SetStage(nullptr);
         children_.Remove(child);
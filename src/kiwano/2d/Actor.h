@@ -41,12 +41,12 @@ class PhysicBody;
 KGE_DECLARE_SMART_PTR(Actor);
 
 /// \~chinese
-/// @brief ɫб
+/// @brief 角色列表
 typedef IntrusiveList<ActorPtr> ActorList;
 
 /**
  * \~chinese
- * \defgroup Actors ɫ
+ * \defgroup Actors 基础角色
  */
 
 /**
@@ -56,9 +56,9 @@ typedef IntrusiveList<ActorPtr> ActorList;
 
 /**
  * \~chinese
- * @brief ɫ
+ * @brief 角色
  * @details
- * ɫ̨ԪأȾ¡¼ַȹܵСλҲǶ¼ȹܵ
+ * 角色是舞台上最基本的元素，是完成渲染、更新、事件分发等功能的最小单位，也是动画、任务、事件监听等功能的载体
  */
 class KGE_API Actor
     : public ObjectBase
@@ -70,11 +70,13 @@ class KGE_API Actor
 {
     friend class Director;
     friend class Transition;
+    friend class Stage;
+    friend class MouseSensor;
     friend IntrusiveList<ActorPtr>;
 
 public:
     /// \~chinese
-    /// @brief ɫ»ص
+    /// @brief 角色更新回调函数
     typedef Function<void(Duration)> UpdateCallback;
 
     Actor();
@@ -82,416 +84,473 @@ public:
     virtual ~Actor();
 
     /// \~chinese
-    /// @brief ½ɫ
-    /// @details ÿ֡ˢǰøúظúʵֽɫĸ´
-    /// @param dt һθµʱ
+    /// @brief 更新角色
+    /// @details 每帧画面刷新前调用该函数，重载该函数以实现角色的更新处理
+    /// @param dt 距上一次更新的时间间隔
     virtual void OnUpdate(Duration dt);
 
     /// \~chinese
-    /// @brief Ⱦɫ
+    /// @brief 渲染角色
     /// @details
-    /// ÿ֡ˢʱøúĬϲȾظúʵ־Ⱦ
-    /// @param ctx Ⱦ
+    /// 每帧画面刷新时调用该函数，默认不进行渲染，重载该函数以实现具体渲染过程
+    /// @param ctx 渲染上下文
     virtual void OnRender(RenderContext& ctx);
 
     /// \~chinese
-    /// @brief ȡʾ״̬
+    /// @brief 获取显示状态
     bool IsVisible() const;
 
     /// \~chinese
-    /// @brief Ƿü͸
+    /// @brief 是否启用级联透明度
     bool IsCascadeOpacityEnabled() const;
 
     /// \~chinese
-    /// @brief Ƿ¼ַ
+    /// @brief 是否启用渲染插值
+    bool IsInterpolationEnabled() const;
+
+    /// \~chinese
+    /// @brief 是否启用事件分发
     bool IsEventDispatchEnabled() const;
 
     /// \~chinese
-    /// @brief ȡƵ Hash ֵ
+    /// @brief 获取名称的 Hash 值
     size_t GetHashName() const;
 
     /// \~chinese
-    /// @brief ȡ Z ˳
+    /// @brief 获取 Z 轴顺序
     int GetZOrder() const;
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取坐标
     virtual Point GetPosition() const;
 
     /// \~chinese
-    /// @brief ȡ x 
+    /// @brief 获取 x 坐标
     float GetPositionX() const;
 
     /// \~chinese
-    /// @brief ȡ y 
+    /// @brief 获取 y 坐标
     float GetPositionY() const;
 
     /// \~chinese
-    /// @brief ȡС
+    /// @brief 获取大小
     virtual Size GetSize() const;
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取宽度
     float GetWidth() const;
 
     /// \~chinese
-    /// @brief ȡ߶
+    /// @brief 获取高度
     float GetHeight() const;
 
     /// \~chinese
-    /// @brief ȡźĿ
+    /// @brief 获取缩放后的宽度
     float GetScaledWidth() const;
 
     /// \~chinese
-    /// @brief ȡźĸ߶
+    /// @brief 获取缩放后的高度
     float GetScaledHeight() const;
 
     /// \~chinese
-    /// @brief ȡźĴС
+    /// @brief 获取缩放后的大小
     Size GetScaledSize() const;
 
     /// \~chinese
-    /// @brief ȡê
+    /// @brief 获取锚点
     virtual Point GetAnchor() const;
 
     /// \~chinese
-    /// @brief ȡ x ê
+    /// @brief 获取 x 方向锚点
     float GetAnchorX() const;
 
     /// \~chinese
-    /// @brief ȡ y ê
+    /// @brief 获取 y 方向锚点
     float GetAnchorY() const;
 
     /// \~chinese
-    /// @brief ȡ͸
+    /// @brief 获取透明度
     virtual float GetOpacity() const;
 
     /// \~chinese
-    /// @brief ȡʾ͸
+    /// @brief 获取显示透明度
     float GetDisplayedOpacity() const;
 
     /// \~chinese
-    /// @brief ȡתǶ
+    /// @brief 获取旋转角度
     virtual float GetRotation() const;
 
     /// \~chinese
-    /// @brief ȡű
+    /// @brief 获取缩放比例
     virtual Point GetScale() const;
 
     /// \~chinese
-    /// @brief ȡű
+    /// @brief 获取横向缩放比例
     float GetScaleX() const;
 
     /// \~chinese
-    /// @brief ȡű
+    /// @brief 获取纵向缩放比例
     float GetScaleY() const;
 
     /// \~chinese
-    /// @brief ȡнǶ
+    /// @brief 获取错切角度
     virtual Point GetSkew() const;
 
     /// \~chinese
-    /// @brief ȡнǶ
+    /// @brief 获取横向错切角度
     float GetSkewX() const;
 
     /// \~chinese
-    /// @brief ȡнǶ
+    /// @brief 获取纵向错切角度
     float GetSkewY() const;
 
     /// \~chinese
-    /// @brief ȡ任
+    /// @brief 获取变换
     Transform GetTransform() const;
 
     /// \~chinese
-    /// @brief ȡɫ
+    /// @brief 获取父角色
     Actor* GetParent() const;
 
     /// \~chinese
-    /// @brief ȡ̨
+    /// @brief 获取所在舞台
     Stage* GetStage() const;
 
     /// \~chinese
-    /// @brief ȡ߿
+    /// @brief 获取边框
     virtual Rect GetBounds() const;
 
     /// \~chinese
-    /// @brief ȡаΧ
+    /// @brief 获取外切包围盒
     virtual Rect GetBoundingBox() const;
 
     /// \~chinese
-    /// @brief ȡά任
+    /// @brief 获取二维变换矩阵
     const Matrix3x2& GetTransformMatrix() const;
 
     /// \~chinese
-    /// @brief ȡά任
+    /// @brief 获取二维变换的逆矩阵
     const Matrix3x2& GetTransformInverseMatrix() const;
 
     /// \~chinese
-    /// @brief ȡ任ɫĶά任
+    /// @brief 获取变换到父角色的二维变换矩阵
     const Matrix3x2& GetTransformMatrixToParent() const;
 
     /// \~chinese
-    /// @brief ýɫǷɼ
+    /// @brief 获取渲染使用的二维变换矩阵
+    /// @details 启用渲染插值时为上一次固定步长更新前后两个变换之间的插值，否则与二维变换矩阵相同
+    const Matrix3x2& GetRenderMatrix() const;
+
+    /// \~chinese
+    /// @brief 设置角色是否可见
     void SetVisible(bool val);
 
     /// \~chinese
-    /// @brief 
+    /// @brief 设置名称
     void SetName(const String& name);
 
     /// \~chinese
-    /// @brief 
+    /// @brief 设置坐标
     virtual void SetPosition(const Point& point);
 
     /// \~chinese
-    /// @brief 
+    /// @brief 设置坐标
     void SetPosition(float x, float y);
 
     /// \~chinese
-    /// @brief ú
+    /// @brief 设置横坐标
     void SetPositionX(float x);
 
     /// \~chinese
-    /// @brief 
+    /// @brief 设置纵坐标
     void SetPositionY(float y);
 
     /// \~chinese
-    /// @brief ƶ
+    /// @brief 移动至坐标
     void MoveTo(const Point& p);
 
     /// \~chinese
-    /// @brief ƶ
+    /// @brief 移动至坐标
     void MoveTo(float x, float y);
 
     /// \~chinese
-    /// @brief ƶ
+    /// @brief 移动相对坐标
     void MoveBy(const Vec2& trans);
 
     /// \~chinese
-    /// @brief ƶ
+    /// @brief 移动相对坐标
     void MoveBy(float trans_x, float trans_y);
 
     /// \~chinese
-    /// @brief űĬΪ (1.0, 1.0)
+    /// @brief 设置缩放比例，默认为 (1.0, 1.0)
     virtual void SetScale(const Vec2& scale);
 
     /// \~chinese
-    /// @brief űĬΪ (1.0, 1.0)
+    /// @brief 设置缩放比例，默认为 (1.0, 1.0)
     void SetScale(float scalex, float scaley);
 
     /// \~chinese
-    /// @brief ôнǶȣĬΪ (0, 0)
+    /// @brief 设置错切角度，默认为 (0, 0)
     virtual void SetSkew(const Vec2& skew);
 
     /// \~chinese
-    /// @brief ôнǶȣĬΪ (0, 0)
+    /// @brief 设置错切角度，默认为 (0, 0)
     void SetSkew(float skewx, float skewy);
 
     /// \~chinese
-    /// @brief תǶȣĬΪ 0
+    /// @brief 设置旋转角度，默认为 0
     virtual void SetRotation(float rotation);
 
     /// \~chinese
-    /// @brief êλãĬΪ (0, 0), Χ [0, 1]
+    /// @brief 设置锚点位置，默认为 (0, 0), 范围 [0, 1]
     virtual void SetAnchor(const Vec2& anchor);
 
     /// \~chinese
-    /// @brief êλãĬΪ (0, 0), Χ [0, 1]
+    /// @brief 设置锚点位置，默认为 (0, 0), 范围 [0, 1]
     void SetAnchor(float anchorx, float anchory);
 
     /// \~chinese
-    /// @brief ޸ĴС
+    /// @brief 修改大小
     virtual void SetSize(const Size& size);
 
     /// \~chinese
-    /// @brief ޸ĴС
+    /// @brief 修改大小
     void SetSize(float width, float height);
 
     /// \~chinese
-    /// @brief ޸Ŀ
+    /// @brief 修改宽度
     void SetWidth(float width);
 
     /// \~chinese
-    /// @brief ޸ĸ߶
+    /// @brief 修改高度
     void SetHeight(float height);
 
     /// \~chinese
-    /// @brief ͸ȣĬΪ 1.0, Χ [0, 1]
+    /// @brief 设置透明度，默认为 1.0, 范围 [0, 1]
     virtual void SetOpacity(float opacity);
 
     /// \~chinese
-    /// @brief ûü͸
+    /// @brief 启用或禁用级联透明度
     void SetCascadeOpacityEnabled(bool enabled);
 
     /// \~chinese
-    /// @brief öά任
+    /// @brief 启用或禁用渲染插值
+    /// @details 应用程序使用固定步长更新时，启用插值的角色按照插值系数在最近一次更新前后的变换之间平滑渲染，
+    /// 子角色跟随父角色的插值结果。仅影响渲染，点击检测等仍使用实际变换
+    void SetInterpolationEnabled(bool enabled);
+
+    /// \~chinese
+    /// @brief 重置渲染插值
+    /// @details 角色被瞬间移动时调用，避免渲染出从旧位置移动过来的过程
+    void ResetInterpolation();
+
+    /// \~chinese
+    /// @brief 设置二维仿射变换
     void SetTransform(const Transform& transform);
 
     /// \~chinese
-    /// @brief  Z ˳ĬΪ 0
+    /// @brief 设置 Z 轴顺序，默认为 0
     void SetZOrder(int zorder);
 
     /// \~chinese
-    /// @brief ӽɫ
+    /// @brief 添加子角色
     void AddChild(ActorPtr child);
 
     /// \~chinese
-    /// @brief ӽɫ
+    /// @brief 添加子角色
     void AddChild(ActorPtr child, int zorder);
 
     /// \~chinese
-    /// @brief Ӷӽɫ
+    /// @brief 添加多个子角色
     void AddChildren(const Vector<ActorPtr>& children);
 
     /// \~chinese
-    /// @brief ȡͬӽɫ
+    /// @brief 获取名称相同的子角色
     ActorPtr GetChild(const String& name) const;
 
     /// \~chinese
-    /// @brief ȡͬӽɫ
+    /// @brief 获取所有名称相同的子角色
     Vector<ActorPtr> GetChildren(const String& name) const;
 
     /// \~chinese
-    /// @brief ȡȫӽɫ
+    /// @brief 获取全部子角色
     ActorList& GetAllChildren();
 
     /// \~chinese
-    /// @brief ȡȫӽɫ
+    /// @brief 获取全部子角色
     const ActorList& GetAllChildren() const;
 
     /// \~chinese
-    /// @brief Ƴӽɫ
+    /// @brief 移除子角色
     void RemoveChild(ActorPtr child);
 
     /// \~chinese
-    /// @brief Ƴͬӽɫ
+    /// @brief 移除所有名称相同的子角色
     void RemoveChildren(const String& child_name);
 
     /// \~chinese
-    /// @brief Ƴнɫ
+    /// @brief 移除所有角色
     void RemoveAllChildren();
 
     /// \~chinese
-    /// @brief ӸɫƳ
+    /// @brief 从父角色移除
     void RemoveFromParent();
 
     /// \~chinese
-    /// @brief ͣɫ
+    /// @brief 暂停角色更新
     void PauseUpdating();
 
     /// \~chinese
-    /// @brief ɫ
+    /// @brief 继续角色更新
     void ResumeUpdating();
 
     /// \~chinese
-    /// @brief ɫǷͣ
+    /// @brief 角色更新是否暂停
     bool IsUpdatePausing() const;
 
     /// \~chinese
-    /// @brief øʱĻص
+    /// @brief 设置更新时的回调函数
     void SetCallbackOnUpdate(const UpdateCallback& cb);
 
     /// \~chinese
-    /// @brief ȡʱĻص
+    /// @brief 获取更新时的回调函数
     UpdateCallback GetCallbackOnUpdate() const;
 
     /// \~chinese
-    /// @brief жϵǷڽɫ
+    /// @brief 判断点是否在角色内
     virtual bool ContainsPoint(const Point& point) const;
 
     /// \~chinese
-    /// @brief ϵתΪֲϵ
+    /// @brief 将世界坐标系点转换为局部坐标系点
     Point ConvertToLocal(const Point& point) const;
 
     /// \~chinese
-    /// @brief ֲϵתΪϵ
+    /// @brief 将局部坐标系点转换为世界坐标系点
     Point ConvertToWorld(const Point& point) const;
 
     /// \~chinese
-    /// @brief Ⱦɫ߽
+    /// @brief 渲染角色边界
     void ShowBorder(bool show);
 
     /// \~chinese
-    /// @brief ַ¼
-    /// @param evt ¼
-    /// @return Ƿַ¼
+    /// @brief 分发事件
+    /// @param evt 事件
+    /// @return 是否继续分发该事件
     virtual bool DispatchEvent(Event* evt);
 
     /// \~chinese
-    /// @brief ¼Ҳַ
-    /// @param evt ¼
+    /// @brief 处理事件且不分发
+    /// @param evt 事件
     bool HandleEvent(Event* evt);
 
     /// \~chinese
-    /// @brief ر¼ַ
-    /// @param enabled Ƿ
+    /// @brief 开启或关闭事件分发功能
+    /// @param enabled 是否开启
     void SetEventDispatchEnabled(bool enabled);
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取物理身体
     physics::PhysicBody* GetPhysicBody() const;
 
     /// \~chinese
-    /// @brief л
+    /// @brief 序列化
     void DoSerialize(Serializer* serializer) const override;
 
     /// \~chinese
-    /// @brief л
+    /// @brief 反序列化
     void DoDeserialize(Deserializer* deserializer) override;
 
     /// \~chinese
-    /// @brief Ĭê
+    /// @brief 设置默认锚点
     static void SetDefaultAnchor(float anchor_x, float anchor_y);
 
+    /// \~chinese
+    /// @brief 获取上一帧重新计算的二维变换数量
+    static uint32_t GetLastFrameTransformCount();
+
+    /// \~chinese
+    /// @brief 结束当前帧的二维变换计数
+    static void ResetTransformCount();
+
+    /// \~chinese
+    /// @brief 开始一次固定步长更新，此后首次修改变换的角色会保存修改前的变换用于插值
+    static void AdvanceSimulationStep();
+
+    /// \~chinese
+    /// @brief 设置渲染插值系数
+    /// @param alpha 上一次固定步长更新后经过的时间与步长之比，范围 [0.0 - 1.0]
+    static void SetInterpolationAlpha(float alpha);
+
 protected:
     /// \~chinese
-    /// @brief ӽɫ
+    /// @brief 更新自身和所有子角色
     virtual void Update(Duration dt);
 
     /// \~chinese
-    /// @brief Ⱦӽɫ
+    /// @brief 渲染自身和所有子角色
     virtual void Render(RenderContext& ctx);
 
     /// \~chinese
-    /// @brief ӽɫı߽
+    /// @brief 绘制自身和所有子角色的边界
     virtual void RenderBorder(RenderContext& ctx);
 
     /// \~chinese
-    /// @brief ǷȾĵ
+    /// @brief 检查是否在渲染上下文的视区内
     virtual bool CheckVisibility(RenderContext& ctx) const;
 
     /// \~chinese
-    /// @brief ȾǰʼȾ״̬ CheckVisibility ʱøú
+    /// @brief 渲染前初始化渲染上下文状态，仅当 CheckVisibility 返回真时调用该函数
     virtual void PrepareToRender(RenderContext& ctx);
 
     /// \~chinese
-    /// @brief ԼĶά任֪ͨӽɫ
+    /// @brief 更新自己的二维变换
+    /// @details 仅当自身或祖先的二维变换改变时重新计算
     void UpdateTransform() const;
 
     /// \~chinese
-    /// @brief Լӽɫ͸
+    /// @brief 更新渲染使用的二维变换矩阵
+    /// @details 需要在父角色更新渲染矩阵之后调用
+    void UpdateRenderMatrix() const;
+
+    /// \~chinese
+    /// @brief 通知舞台角色的包围盒已改变
+    /// @details 包围盒不随二维变换改变时（如形状改变），需要调用该函数更新舞台的空间索引
+    void InvalidateBounds() const;
+
+    /// \~chinese
+    /// @brief 更新自己和所有子角色的透明度
     void UpdateOpacity();
 
     /// \~chinese
-    /// @brief ӽɫZ˳
+    /// @brief 将所有子角色按Z轴顺序排序
     void Reorder();
 
     /// \~chinese
-    /// @brief ýڵ̨
+    /// @brief 设置节点所在舞台
     void SetStage(Stage* stage);
 
     /// \~chinese
-    /// @brief 
+    /// @brief 设置物理身体
     void SetPhysicBody(physics::PhysicBody* body);
 
     friend physics::PhysicBody;
 
+private:
+    void MarkTransformDirty() const;
+
+    void KeepPreviousTransform();
+
+    void UpdateRenderOrder();
+
 private:
     bool         visible_;
     bool         update_pausing_;
     bool         cascade_opacity_;
     bool         show_border_;
     bool         evt_dispatch_enabled_;
+    bool         interpolation_enabled_;
     mutable bool visible_in_rt_;
+    mutable bool render_interpolated_;
 
     enum DirtyFlag : uint8_t
     {
@@ -499,11 +558,21 @@ private:
         DirtyTransform        = 1,
         DirtyTransformInverse = 1 << 1,
         DirtyOpacity          = 1 << 2,
-        DirtyVisibility       = 1 << 3
+        DirtyVisibility       = 1 << 3,
+        DirtyBounds           = 1 << 4
     };
     mutable Flag<uint8_t> dirty_flag_;
 
     int                  z_order_;
+    int                  index_proxy_;
+    uint32_t             dirty_index_;
+    uint32_t             render_order_;
+    uint16_t             mouse_sensor_count_;
+    uint16_t             mouse_hover_count_;
+    mutable uint64_t     transform_epoch_;
+    mutable uint32_t     transform_version_;
+    mutable uint32_t     parent_transform_version_;
+    uint32_t             interpolation_step_;
     float                opacity_;
     float                displayed_opacity_;
     Actor*               parent_;
@@ -515,10 +584,12 @@ private:
     ActorList            children_;
     UpdateCallback       cb_update_;
     Transform            transform_;
+    Transform            prev_transform_;
 
     mutable Matrix3x2 transform_matrix_;
     mutable Matrix3x2 transform_matrix_inverse_;
     mutable Matrix3x2 transform_matrix_to_parent_;
+    mutable Matrix3x2 render_matrix_;
 };
 
 /** @} */
@@ -543,6 +614,16 @@ inline bool Actor::IsCascadeOpacityEnabled() const
     return cascade_opacity_;
 }
 
+inline bool Actor::IsInterpolationEnabled() const
+{
+    return interpolation_enabled_;
+}
+
+inline const Matrix3x2& Actor::GetRenderMatrix() const
+{
+    return render_interpolated_ ? render_matrix_ : transform_matrix_;
+}
+
 inline bool Actor::IsEventDispatchEnabled() const
 {
     return evt_dispatch_enabled_;
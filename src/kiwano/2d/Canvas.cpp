@@ -76,7 +76,8 @@ void Canvas::OnRender(RenderContext& ctx)
 {
     if (texture_cached_)
     {
-        ctx.DrawTexture(*texture_cached_, nullptr, &GetBounds());
+        Rect bounds = GetBounds();
+        ctx.DrawTexture(*texture_cached_, nullptr, &bounds);
     }
 }
 
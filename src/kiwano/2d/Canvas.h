@@ -37,8 +37,8 @@ KGE_DECLARE_SMART_PTR(CanvasRenderContext);
 
 /**
  * \~chinese
- * @brief 
- * @details ڻͼΡͼֵȸ͵ͼԪͬʱԽݵͼ
+ * @brief 画布
+ * @details 用于绘制图形、图像、文字等各种类型的图元，同时可以将绘制内容导出至图像
  */
 class KGE_API Canvas : public Actor
 {
@@ -46,21 +46,21 @@ public:
     Canvas();
 
     /// \~chinese
-    /// @brief 
-    /// @param size С
+    /// @brief 创建画布
+    /// @param size 画布大小
     Canvas(const Size& size);
 
     /// \~chinese
-    /// @brief ȡ2Dͼ
+    /// @brief 获取2D绘图上下文
     CanvasRenderContextPtr GetContext2D() const;
 
     /// \~chinese
-    /// @brief ջС軭С
-    /// @warning úᵼԭͼʧЧ
+    /// @brief 清空画布大小并重设画布大小
+    /// @warning 该函数会导致原绘图上下文失效
     void ResizeAndClear(Size size);
 
     /// \~chinese
-    /// @brief 
+    /// @brief 导出纹理
     TexturePtr ExportToTexture() const;
 
     void OnRender(RenderContext& ctx) override;
@@ -75,199 +75,199 @@ private:
 
 
 /// \~chinese
-/// @brief Ⱦ
+/// @brief 画布渲染上下文
 class KGE_API CanvasRenderContext : public ObjectBase
 {
 public:
     /// \~chinese
-    /// @brief ʼȾ
+    /// @brief 开始渲染
     void BeginDraw();
 
     /// \~chinese
-    /// @brief Ⱦ
+    /// @brief 结束渲染
     void EndDraw();
 
     /// \~chinese
-    /// @brief ״
-    /// @param shape ״
+    /// @brief 画形状轮廓
+    /// @param shape 形状
     void DrawShape(ShapePtr shape);
 
     /// \~chinese
-    /// @brief ߶
-    /// @param begin ߶
-    /// @param end ߶յ
+    /// @brief 画线段
+    /// @param begin 线段起点
+    /// @param end 线段终点
     void DrawLine(const Point& begin, const Point& end);
 
     /// \~chinese
-    /// @brief Բα߿
-    /// @param center Բԭ
-    /// @param radius Բΰ뾶
+    /// @brief 画圆形边框
+    /// @param center 圆形原点
+    /// @param radius 圆形半径
     void DrawCircle(const Point& center, float radius);
 
     /// \~chinese
-    /// @brief Բα߿
-    /// @param center Բԭ
-    /// @param radius Բ뾶
+    /// @brief 画椭圆形边框
+    /// @param center 椭圆原点
+    /// @param radius 椭圆半径
     void DrawEllipse(const Point& center, const Vec2& radius);
 
     /// \~chinese
-    /// @brief α߿
-    /// @param rect 
+    /// @brief 画矩形边框
+    /// @param rect 矩形
     void DrawRect(const Rect& rect);
 
     /// \~chinese
-    /// @brief ԲǾα߿
-    /// @param rect 
-    /// @param radius Բǰ뾶
+    /// @brief 画圆角矩形边框
+    /// @param rect 矩形
+    /// @param radius 矩形圆角半径
     void DrawRoundedRect(const Rect& rect, const Vec2& radius);
 
     /// \~chinese
-    /// @brief ״
-    /// @param shape ״
+    /// @brief 填充形状
+    /// @param shape 形状
     void FillShape(ShapePtr shape);
 
     /// \~chinese
-    /// @brief Բ
-    /// @param center Բԭ
-    /// @param radius Բΰ뾶
+    /// @brief 填充圆形
+    /// @param center 圆形原点
+    /// @param radius 圆形半径
     void FillCircle(const Point& center, float radius);
 
     /// \~chinese
-    /// @brief Բ
-    /// @param center Բԭ
-    /// @param radius Բ뾶
+    /// @brief 填充椭圆形
+    /// @param center 椭圆原点
+    /// @param radius 椭圆半径
     void FillEllipse(const Point& center, const Vec2& radius);
 
     /// \~chinese
-    /// @brief 
-    /// @param rect 
+    /// @brief 填充矩形
+    /// @param rect 矩形
     void FillRect(const Rect& rect);
 
     /// \~chinese
-    /// @brief ԲǾ
-    /// @param rect 
-    /// @param radius Բǰ뾶
+    /// @brief 填充圆角矩形
+    /// @param rect 矩形
+    /// @param radius 矩形圆角半径
     void FillRoundedRect(const Rect& rect, const Vec2& radius);
 
     /// \~chinese
-    /// @brief 
-    /// @param texture 
-    /// @param pos ƵĿλ
-    /// @param crop_rect ü
+    /// @brief 绘制纹理
+    /// @param texture 纹理
+    /// @param pos 绘制的目标位置
+    /// @param crop_rect 纹理裁剪矩形
     void DrawTexture(TexturePtr texture, const Point& pos, const Rect* crop_rect = nullptr);
 
     /// \~chinese
-    /// @brief 
-    /// @param texture 
-    /// @param pos ƵĿλ
-    /// @param size ƵĿС
-    /// @param crop_rect ü
+    /// @brief 绘制纹理
+    /// @param texture 纹理
+    /// @param pos 绘制的目标位置
+    /// @param size 绘制的目标大小
+    /// @param crop_rect 纹理裁剪矩形
     void DrawTexture(TexturePtr texture, const Point& pos, const Size& size, const Rect* crop_rect = nullptr);
 
     /// \~chinese
-    /// @brief ƾ֡
-    /// @param frame ֡
-    /// @param pos ƵĿλ
+    /// @brief 绘制精灵帧
+    /// @param frame 精灵帧
+    /// @param pos 绘制的目标位置
     void DrawSpriteFrame(const SpriteFrame& frame, const Point& pos);
 
     /// \~chinese
-    /// @brief ƾ֡
-    /// @param frame ֡
-    /// @param pos ƵĿλ
-    /// @param size ƵĿС
+    /// @brief 绘制精灵帧
+    /// @param frame 精灵帧
+    /// @param pos 绘制的目标位置
+    /// @param size 绘制的目标大小
     void DrawSpriteFrame(const SpriteFrame& frame, const Point& pos, const Size& size);
 
     /// \~chinese
-    /// @brief ֲ
-    /// @param text 
-    /// @param style ʽ
-    /// @param point ֵλ
+    /// @brief 绘制文字布局
+    /// @param text 文字
+    /// @param style 文字样式
+    /// @param point 绘制文字的位置
     void DrawTextLayout(const String& text, const TextStyle& style, const Point& point);
 
     /// \~chinese
-    /// @brief ֲ
-    /// @param layout ֲ
-    /// @param point Ʋֵλ
+    /// @brief 绘制文字布局
+    /// @param layout 文字布局
+    /// @param point 绘制布局的位置
     void DrawTextLayout(TextLayoutPtr layout, const Point& point);
 
     /// \~chinese
-    /// @brief ջ
+    /// @brief 清空画布
     void Clear();
 
     /// \~chinese
-    /// @brief ջ
-    /// @param clear_color ɫ
+    /// @brief 清空画布
+    /// @param clear_color 清空颜色
     void Clear(const Color& clear_color);
 
     /// \~chinese
-    /// @brief ɫ
-    /// @param color ɫ
+    /// @brief 设置填充颜色
+    /// @param color 填充颜色
     void SetFillColor(const Color& color);
 
     /// \~chinese
-    /// @brief 仭ˢ
-    /// @param[in] brush 仭ˢ
+    /// @brief 设置填充画刷
+    /// @param[in] brush 填充画刷
     void SetFillBrush(BrushPtr brush);
 
     /// \~chinese
-    /// @brief ȡ仭ˢ
+    /// @brief 获取填充画刷
     BrushPtr GetFillBrush() const;
 
     /// \~chinese
-    /// @brief ɫ
-    /// @param color ɫ
+    /// @brief 设置轮廓颜色
+    /// @param color 轮廓颜色
     void SetStrokeColor(const Color& color);
 
     /// \~chinese
-    /// @brief ˢ
-    /// @param[in] brush ˢ
+    /// @brief 设置轮廓画刷
+    /// @param[in] brush 轮廓画刷
     void SetStrokeBrush(BrushPtr brush);
 
     /// \~chinese
-    /// @brief ȡˢ
+    /// @brief 获取轮廓画刷
     BrushPtr GetStrokeBrush() const;
 
     /// \~chinese
-    /// @brief ʽ
-    /// @param stroke_style ʽ
+    /// @brief 设置轮廓样式
+    /// @param stroke_style 轮廓样式
     void SetStrokeStyle(StrokeStylePtr stroke_style);
 
     /// \~chinese
-    /// @brief ȡʽ
+    /// @brief 获取轮廓样式
     StrokeStylePtr GetStrokeStyle() const;
 
     /// \~chinese
-    /// @brief һü
-    /// @param clip_rect ü
+    /// @brief 添加一个裁剪区域
+    /// @param clip_rect 裁剪矩形
     void PushClipRect(const Rect& clip_rect);
 
     /// \~chinese
-    /// @brief ɾӵĲü
+    /// @brief 删除最近添加的裁剪区域
     void PopClipRect();
 
     /// \~chinese
-    /// @brief һͼ
-    /// @param layer ͼ
+    /// @brief 添加一个图层
+    /// @param layer 图层
     void PushLayer(LayerPtr layer);
 
     /// \~chinese
-    /// @brief ɾӵͼ
+    /// @brief 删除最近添加的图层
     void PopLayer();
 
     /// \~chinese
-    /// @brief ȡС
+    /// @brief 获取画布大小
     Size GetSize() const;
 
     /// \~chinese
-    /// @brief ȾĵĶά任
+    /// @brief 设置渲染上下文的二维变换矩阵
     void SetTransform(const Matrix3x2& matrix);
 
     /// \~chinese
-    /// @brief ÿģʽ
+    /// @brief 设置抗锯齿模式
     void SetAntialiasMode(bool enabled);
 
     /// \~chinese
-    /// @brief ֿģʽ
+    /// @brief 设置文字抗锯齿模式
     void SetTextAntialiasMode(TextAntialiasMode mode);
 
     virtual ~CanvasRenderContext();
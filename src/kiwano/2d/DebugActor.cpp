@@ -22,9 +22,14 @@
 #include <kiwano/utils/Logger.h>
 #include <kiwano/render/Renderer.h>
 #include <kiwano/base/component/MouseSensor.h>
-#include <psapi.h>
 
+#if defined(KGE_PLATFORM_WINDOWS)
+#include <psapi.h>
 #pragma comment(lib, "psapi.lib")
+#else
+#include <fstream>
+#include <unistd.h>
+#endif
 
 namespace kiwano
 {
@@ -77,7 +82,8 @@ void DebugActor::OnRender(RenderContext& ctx)
 {
     ctx.SetCurrentBrush(background_brush_);
     ctx.FillRoundedRectangle(GetBounds(), Vec2{ 5.f, 5.f });
-    ctx.DrawTextLayout(debug_text_, Point(10, 10));
+    if (debug_text_)
+        ctx.DrawTextLayout(*debug_text_, Point(10, 10));
 
     frame_buffer_.PushBack(Time::Now());
     while (frame_buffer_.Back() - frame_buffer_.Front() >= time::Second)
@@ -110,23 +116,39 @@ void DebugActor::OnUpdate(Duration dt)
 
     ss << "Primitives / sec: " << std::fixed << status.primitives * frame_buffer_.Size() << std::endl;
 
+    ss << "Draw calls: " << status.draw_calls << std::endl;
+
+    ss << "Transforms: " << Actor::GetLastFrameTransformCount() << std::endl;
+
     ss << "Memory: ";
     {
+#if defined(KGE_PLATFORM_WINDOWS)
         PROCESS_MEMORY_COUNTERS_EX pmc;
         GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&pmc, sizeof(pmc));
 
-        if (pmc.PrivateUsage > 1024 * 1024)
+        size_t usage = pmc.PrivateUsage;
+#else
+        // Resident set size, the second field of statm in pages
+        size_t        pages = 0, resident = 0;
+        std::ifstream statm("/proc/self/statm");
+        statm >> pages >> resident;
+
+        size_t usage = resident * size_t(::sysconf(_SC_PAGESIZE));
+#endif
+
+        if (usage > 1024 * 1024)
         {
-            ss << pmc.PrivateUsage / (1024 * 1024) << "Mb ";
-            pmc.PrivateUsage %= (1024 * 1024);
+            ss << usage / (1024 * 1024) << "Mb ";
+            usage %= (1024 * 1024);
         }
 
-        ss << pmc.PrivateUsage / 1024 << "Kb";
+        ss << usage / 1024 << "Kb";
     }
 
-    debug_text_.Reset(ss.str(), debug_text_style_);
+    // Create a new layout every time, the old one may still be replayed by a render snapshot
+    debug_text_ = MakePtr<TextLayout>(ss.str(), debug_text_style_);
 
-    Size layout_size = debug_text_.GetSize();
+    Size layout_size = debug_text_->GetSize();
     if (layout_size.x > GetWidth() - 20)
     {
         SetWidth(20 + layout_size.x);
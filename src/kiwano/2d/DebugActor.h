@@ -124,7 +124,7 @@ private:
 
 /**
  * \~chinese
- * @brief Խڵ
+ * @brief 调试节点
  */
 class KGE_API DebugActor : public Actor
 {
@@ -141,10 +141,10 @@ protected:
     bool CheckVisibility(RenderContext& ctx) const override;
 
 private:
-    std::locale comma_locale_;
-    BrushPtr    background_brush_;
-    TextStyle   debug_text_style_;
-    TextLayout  debug_text_;
+    std::locale   comma_locale_;
+    BrushPtr      background_brush_;
+    TextStyle     debug_text_style_;
+    TextLayoutPtr debug_text_;
 
     SimpleRingBuffer<Time> frame_buffer_;
 };
@@ -105,7 +105,8 @@ void GifSprite::OnRender(RenderContext& ctx)
 {
     if (frame_to_render_ && CheckVisibility(ctx))
     {
-        ctx.DrawTexture(*frame_to_render_, nullptr, &GetBounds());
+        Rect bounds = GetBounds();
+        ctx.DrawTexture(*frame_to_render_, nullptr, &bounds);
     }
 }
 
@@ -35,81 +35,81 @@ KGE_DECLARE_SMART_PTR(GifSprite);
 
 /**
  * \~chinese
- * @brief GIF 
+ * @brief GIF 精灵
  */
 class KGE_API GifSprite : public Actor
 {
 public:
     /// \~chinese
-    /// @brief GIFѭص
+    /// @brief GIF播放循环结束回调
     using LoopDoneCallback = Function<void(int /* times */)>;
 
     /// \~chinese
-    /// @brief GIFŽص
+    /// @brief GIF播放结束回调
     using DoneCallback = Function<void()>;
 
     GifSprite();
 
     /// \~chinese
-    /// @brief GIF
-    /// @param file_path GIFͼƬ·
+    /// @brief 创建GIF精灵
+    /// @param file_path GIF图片路径
     GifSprite(const String& file_path);
 
     /// \~chinese
-    /// @brief GIF
-    /// @param res GIFͼƬԴ
+    /// @brief 创建GIF精灵
+    /// @param res GIF图片资源
     GifSprite(const Resource& res);
 
     /// \~chinese
-    /// @brief GIF
-    /// @param gif GIFͼƬ
+    /// @brief 创建GIF精灵
+    /// @param gif GIF图片
     GifSprite(GifImagePtr gif);
 
     /// \~chinese
-    /// @brief GIFͼƬ
-    /// @param file_path GIFͼƬ·
+    /// @brief 加载GIF图片
+    /// @param file_path GIF图片路径
     bool Load(const String& file_path);
 
     /// \~chinese
-    /// @brief GIFͼƬ
-    /// @param res GIFͼƬԴ
+    /// @brief 加载GIF图片
+    /// @param res GIF图片资源
     bool Load(const Resource& res);
 
     /// \~chinese
-    /// @brief GIFͼƬ
-    /// @param gif GIFͼƬ
+    /// @brief 加载GIF图片
+    /// @param gif GIF图片
     bool Load(GifImagePtr gif);
 
     /// \~chinese
-    /// @brief  GIF ѭ
+    /// @brief 设置 GIF 动画循环次数
     void SetLoopCount(int loops);
 
     /// \~chinese
-    /// @brief  GIF ÿѭص
+    /// @brief 设置 GIF 动画每次循环结束回调函数
     void SetLoopDoneCallback(const LoopDoneCallback& cb);
 
     /// \~chinese
-    /// @brief  GIF ص
+    /// @brief 设置 GIF 动画结束回调函数
     void SetDoneCallback(const DoneCallback& cb);
 
     /// \~chinese
-    /// @brief  GIF ͼ
+    /// @brief 设置 GIF 图像
     void SetGifImage(GifImagePtr gif);
 
     /// \~chinese
-    /// @brief ² GIF 
+    /// @brief 重新播放 GIF 动画
     void RestartAnimation();
 
     /// \~chinese
-    /// @brief ȡ GIF ѭص
+    /// @brief 获取 GIF 动画循环结束回调
     LoopDoneCallback GetLoopDoneCallback() const;
 
     /// \~chinese
-    /// @brief ȡ GIF Žص
+    /// @brief 获取 GIF 动画播放结束回调
     DoneCallback GetDoneCallback() const;
 
     /// \~chinese
-    /// @brief ȡ GIF ͼƬ
+    /// @brief 获取 GIF 图片
     GifImagePtr GetGifImage() const;
 
     void OnRender(RenderContext& ctx) override;
@@ -118,35 +118,35 @@ private:
     void Update(Duration dt) override;
 
     /// \~chinese
-    /// @brief Ƿһ֡
+    /// @brief 是否是最后一帧
     bool IsLastFrame() const;
 
     /// \~chinese
-    /// @brief Ƿѽ
+    /// @brief 动画是否已结束
     bool EndOfAnimation() const;
 
     /// \~chinese
-    /// @brief ϳһ֡
+    /// @brief 合成下一帧
     void ComposeNextFrame();
 
     /// \~chinese
-    /// @brief ǰؼ֡
+    /// @brief 解析当前关键帧
     void DisposeCurrentFrame();
 
     /// \~chinese
-    /// @brief һ֡
+    /// @brief 覆盖下一帧
     void OverlayNextFrame();
 
     /// \~chinese
-    /// @brief ϳɺĹؼ֡
+    /// @brief 保存合成后的关键帧
     void SaveComposedFrame();
 
     /// \~chinese
-    /// @brief ָѱĹؼ֡
+    /// @brief 恢复已保存的关键帧
     void RestoreSavedFrame();
 
     /// \~chinese
-    /// @brief յǰͼ
+    /// @brief 清空当前图像区域
     void ClearCurrentFrameArea();
 
 private:
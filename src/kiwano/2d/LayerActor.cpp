@@ -60,8 +60,10 @@ void LayerActor::Render(RenderContext& ctx)
 {
     if (layer_)
     {
+        ctx.FlushSprites();
         ctx.PushLayer(*layer_);
         Actor::Render(ctx);
+        ctx.FlushSprites();
         ctx.PopLayer();
     }
     else
@@ -34,7 +34,7 @@ KGE_DECLARE_SMART_PTR(LayerActor);
 
 /**
  * \~chinese
- * @brief ͼɫ
+ * @brief 图层角色
  */
 class KGE_API LayerActor : public Actor
 {
@@ -44,26 +44,26 @@ public:
     virtual ~LayerActor();
 
     /// \~chinese
-    /// @brief ǷϢû
+    /// @brief 是否开启消息吞没
     bool IsSwallowEventsEnabled() const;
 
     /// \~chinese
-    /// @brief ȡͼ
+    /// @brief 获取图层
     LayerPtr GetLayer() const;
 
     /// \~chinese
-    /// @brief ͼ
-    /// @param layer ͼ
+    /// @brief 设置图层
+    /// @param layer 图层
     void SetLayer(LayerPtr layer);
 
     /// \~chinese
-    /// @brief Ϣû
-    /// @param enabled Ƿ
+    /// @brief 设置消息吞没功能
+    /// @param enabled 是否启用
     void SetSwallowEvents(bool enabled);
 
     /// \~chinese
-    /// @brief ͼ͸
-    /// @param opacity ͸
+    /// @brief 设置图层透明度
+    /// @param opacity 透明度
     void SetOpacity(float opacity) override;
 
     bool DispatchEvent(Event* evt) override;
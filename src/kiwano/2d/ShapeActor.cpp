@@ -82,6 +82,7 @@ void ShapeActor::SetShape(ShapePtr shape)
         bounds_ = Rect{};
         SetSize(0.f, 0.f);
     }
+    InvalidateBounds();
 }
 
 void ShapeActor::OnRender(RenderContext& ctx)
@@ -43,7 +43,7 @@ KGE_DECLARE_SMART_PTR(PolygonActor);
 
 /**
  * \~chinese
- * @brief ״ɫ
+ * @brief 形状角色
  */
 class KGE_API ShapeActor : public Actor
 {
@@ -51,80 +51,80 @@ public:
     ShapeActor();
 
     /// \~chinese
-    /// @brief ״ɫ
-    /// @param shape ״
+    /// @brief 创建形状角色
+    /// @param shape 形状
     ShapeActor(ShapePtr shape);
 
     /// \~chinese
-    /// @brief ״ɫ
-    /// @param shape ״
-    /// @param fill_color ɫ
-    /// @param stroke_color ɫ
+    /// @brief 创建形状角色
+    /// @param shape 形状
+    /// @param fill_color 填充颜色
+    /// @param stroke_color 轮廓颜色
     ShapeActor(ShapePtr shape, const Color& fill_color, const Color& stroke_color);
 
     /// \~chinese
-    /// @brief ״ɫ
-    /// @param shape ״
-    /// @param fill_brush 仭ˢ
-    /// @param stroke_brush ˢ
+    /// @brief 创建形状角色
+    /// @param shape 形状
+    /// @param fill_brush 填充画刷
+    /// @param stroke_brush 轮廓画刷
     ShapeActor(ShapePtr shape, BrushPtr fill_brush, BrushPtr stroke_brush);
 
     virtual ~ShapeActor();
 
     /// \~chinese
-    /// @brief ȡ仭ˢ
+    /// @brief 获取填充画刷
     BrushPtr GetFillBrush() const;
 
     /// \~chinese
-    /// @brief ȡˢ
+    /// @brief 获取轮廓画刷
     BrushPtr GetStrokeBrush() const;
 
     /// \~chinese
-    /// @brief ȡʽ
+    /// @brief 获取线条样式
     StrokeStylePtr GetStrokeStyle() const;
 
     /// \~chinese
-    /// @brief ȡ״
+    /// @brief 获取形状
     ShapePtr GetShape() const;
 
     /// \~chinese
-    /// @brief ȡ߽
+    /// @brief 获取边界
     Rect GetBounds() const override;
 
     /// \~chinese
-    /// @brief ȡаΧ
+    /// @brief 获取外切包围盒
     Rect GetBoundingBox() const override;
 
     /// \~chinese
-    /// @brief жϵǷ״
+    /// @brief 判断点是否在形状内
     bool ContainsPoint(const Point& point) const override;
 
     /// \~chinese
-    /// @brief ɫ
-    /// @param color ɫ
+    /// @brief 设置填充颜色
+    /// @param color 填充颜色
     void SetFillColor(const Color& color);
 
     /// \~chinese
-    /// @brief 仭ˢ
-    /// @param[in] brush 仭ˢ
+    /// @brief 设置填充画刷
+    /// @param[in] brush 填充画刷
     void SetFillBrush(BrushPtr brush);
 
     /// \~chinese
-    /// @brief ɫ
-    /// @param color ɫ
+    /// @brief 设置轮廓颜色
+    /// @param color 轮廓颜色
     void SetStrokeColor(const Color& color);
 
     /// \~chinese
-    /// @brief ˢ
-    /// @param[in] brush ˢ
+    /// @brief 设置轮廓画刷
+    /// @param[in] brush 轮廓画刷
     void SetStrokeBrush(BrushPtr brush);
 
     /// \~chinese
-    /// @brief ʽ
+    /// @brief 设置线条样式
     void SetStrokeStyle(StrokeStylePtr stroke_style);
 
     /// \~chinese
-    /// @brief ״
+    /// @brief 设置形状
     void SetShape(ShapePtr shape);
 
     void OnRender(RenderContext& ctx) override;
@@ -141,42 +141,42 @@ private:
 };
 
 /// \~chinese
-/// @brief ߶νɫ
+/// @brief 线段角色
 class KGE_API LineActor : public ShapeActor
 {
 public:
     LineActor();
 
     /// \~chinese
-    /// @brief ߶νɫ
-    /// @param begin ߶
-    /// @param end ߶յ
+    /// @brief 创建线段角色
+    /// @param begin 线段起点
+    /// @param end 线段终点
     LineActor(const Point& begin, const Point& end);
 
     virtual ~LineActor();
 
     /// \~chinese
-    /// @brief ȡ߶
+    /// @brief 获取线段起点
     const Point& GetBeginPoint() const;
 
     /// \~chinese
-    /// @brief ȡ߶յ
+    /// @brief 获取线段终点
     const Point& GetEndPoint() const;
 
     /// \~chinese
-    /// @brief ߶
-    /// @param begin ߶
+    /// @brief 设置线段起点
+    /// @param begin 线段起点
     void SetBeginPoint(const Point& begin);
 
     /// \~chinese
-    /// @brief ߶յ
-    /// @param end ߶յ
+    /// @brief 设置线段终点
+    /// @param end 线段终点
     void SetEndPoint(const Point& end);
 
     /// \~chinese
-    /// @brief ߶յ
-    /// @param begin ߶
-    /// @param end ߶յ
+    /// @brief 设置线段起点和终点
+    /// @param begin 线段起点
+    /// @param end 线段终点
     void SetLine(const Point& begin, const Point& end);
 
 private:
@@ -185,26 +185,26 @@ private:
 };
 
 /// \~chinese
-/// @brief νɫ
+/// @brief 矩形角色
 class KGE_API RectActor : public ShapeActor
 {
 public:
     RectActor();
 
     /// \~chinese
-    /// @brief νɫ
-    /// @param size δС
+    /// @brief 创建矩形角色
+    /// @param size 矩形大小
     RectActor(const Size& size);
 
     virtual ~RectActor();
 
     /// \~chinese
-    /// @brief ȡδС
+    /// @brief 获取矩形大小
     const Size& GetRectSize() const;
 
     /// \~chinese
-    /// @brief þδС
-    /// @param size δС
+    /// @brief 设置矩形大小
+    /// @param size 矩形大小
     void SetRectSize(const Size& size);
 
 private:
@@ -212,42 +212,42 @@ private:
 };
 
 /// \~chinese
-/// @brief ԲǾνɫ
+/// @brief 圆角矩形角色
 class KGE_API RoundedRectActor : public ShapeActor
 {
 public:
     RoundedRectActor();
 
     /// \~chinese
-    /// @brief ԲǾνɫ
-    /// @param size ԲǾδС
-    /// @param radius Բǰ뾶
+    /// @brief 创建圆角矩形角色
+    /// @param size 圆角矩形大小
+    /// @param radius 圆角半径
     RoundedRectActor(const Size& size, const Vec2& radius);
 
     virtual ~RoundedRectActor();
 
     /// \~chinese
-    /// @brief ȡԲǰ뾶
+    /// @brief 获取圆角半径
     Vec2 GetRadius() const;
 
     /// \~chinese
-    /// @brief ȡԲǾδС
+    /// @brief 获取圆角矩形大小
     Size GetRectSize() const;
 
     /// \~chinese
-    /// @brief Բǰ뾶
-    /// @param radius Բǰ뾶
+    /// @brief 设置圆角半径
+    /// @param radius 圆角半径
     void SetRadius(const Vec2& radius);
 
     /// \~chinese
-    /// @brief ԲǾδС
-    /// @param size ԲǾδС
+    /// @brief 设置圆角矩形大小
+    /// @param size 圆角矩形大小
     void SetRectSize(const Size& size);
 
     /// \~chinese
-    /// @brief ԲǾ
-    /// @param size ԲǾδС
-    /// @param radius Բǰ뾶
+    /// @brief 设置圆角矩形
+    /// @param size 圆角矩形大小
+    /// @param radius 圆角半径
     void SetRoundedRect(const Size& size, const Vec2& radius);
 
 private:
@@ -256,26 +256,26 @@ private:
 };
 
 /// \~chinese
-/// @brief Բνɫ
+/// @brief 圆形角色
 class KGE_API CircleActor : public ShapeActor
 {
 public:
     CircleActor();
 
     /// \~chinese
-    /// @brief Բνɫ
-    /// @param radius Բΰ뾶
+    /// @brief 创建圆形角色
+    /// @param radius 圆形半径
     CircleActor(float radius);
 
     virtual ~CircleActor();
 
     /// \~chinese
-    /// @brief ȡԲΰ뾶
+    /// @brief 获取圆形半径
     float GetRadius() const;
 
     /// \~chinese
-    /// @brief Բΰ뾶
-    /// @param radius Բΰ뾶
+    /// @brief 设置圆形半径
+    /// @param radius 圆形半径
     void SetRadius(float radius);
 
 private:
@@ -283,26 +283,26 @@ private:
 };
 
 /// \~chinese
-/// @brief Բɫ
+/// @brief 椭圆角色
 class KGE_API EllipseActor : public ShapeActor
 {
 public:
     EllipseActor();
 
     /// \~chinese
-    /// @brief Բɫ
-    /// @param radius Բ뾶
+    /// @brief 创建椭圆角色
+    /// @param radius 椭圆半径
     EllipseActor(const Vec2& radius);
 
     virtual ~EllipseActor();
 
     /// \~chinese
-    /// @brief ȡԲ뾶
+    /// @brief 获取椭圆半径
     Vec2 GetRadius() const;
 
     /// \~chinese
-    /// @brief Բ뾶
-    /// @param radius Բ뾶
+    /// @brief 设置椭圆半径
+    /// @param radius 椭圆半径
     void SetRadius(const Vec2& radius);
 
 private:
@@ -310,22 +310,22 @@ private:
 };
 
 /// \~chinese
-/// @brief νɫ
+/// @brief 多边形角色
 class KGE_API PolygonActor : public ShapeActor
 {
 public:
     PolygonActor();
 
     /// \~chinese
-    /// @brief νɫ
-    /// @param vertices ζ˵㼯
+    /// @brief 创建多边形角色
+    /// @param vertices 多边形端点集合
     PolygonActor(const Vector<Point>& vertices);
 
     virtual ~PolygonActor();
 
     /// \~chinese
-    /// @brief öζ˵
-    /// @param vertices ζ˵㼯
+    /// @brief 设置多边形端点
+    /// @param vertices 多边形端点集合
     void SetVertices(const Vector<Point>& vertices);
 };
 
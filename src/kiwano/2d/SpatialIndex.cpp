@@ -0,0 +1,382 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <kiwano/2d/SpatialIndex.h>
+
+namespace kiwano
+{
+
+namespace
+{
+
+inline Rect Combine(const Rect& a, const Rect& b)
+{
+    return Rect(std::min(a.left_top.x, b.left_top.x), std::min(a.left_top.y, b.left_top.y),
+                std::max(a.right_bottom.x, b.right_bottom.x), std::max(a.right_bottom.y, b.right_bottom.y));
+}
+
+inline Rect Expand(const Rect& rect, float margin)
+{
+    return Rect(rect.left_top.x - margin, rect.left_top.y - margin, rect.right_bottom.x + margin,
+                rect.right_bottom.y + margin);
+}
+
+inline bool Contains(const Rect& outer, const Rect& inner)
+{
+    return outer.left_top.x <= inner.left_top.x && outer.left_top.y <= inner.left_top.y
+           && inner.right_bottom.x <= outer.right_bottom.x && inner.right_bottom.y <= outer.right_bottom.y;
+}
+
+// Perimeter is used as the insertion cost instead of area, so that degenerate boxes are handled well
+inline float GetPerimeter(const Rect& rect)
+{
+    return 2.f * ((rect.right_bottom.x - rect.left_top.x) + (rect.right_bottom.y - rect.left_top.y));
+}
+
+}  // namespace
+
+const float SpatialIndex::AABB_MARGIN = 8.f;
+
+SpatialIndex::SpatialIndex()
+    : root_(NULL_PROXY)
+    , free_list_(NULL_PROXY)
+    , proxy_count_(0)
+{
+}
+
+int SpatialIndex::CreateProxy(const Rect& bounds, Actor* actor)
+{
+    int proxy = AllocNode();
+
+    Node& node  = nodes_[proxy];
+    node.aabb   = Expand(bounds, AABB_MARGIN);
+    node.actor  = actor;
+    node.height = 0;
+
+    InsertLeaf(proxy);
+    ++proxy_count_;
+    return proxy;
+}
+
+void SpatialIndex::DestroyProxy(int proxy)
+{
+    KGE_ASSERT(proxy >= 0 && proxy < int(nodes_.size()) && nodes_[proxy].IsLeaf());
+
+    RemoveLeaf(proxy);
+    FreeNode(proxy);
+    --proxy_count_;
+}
+
+bool SpatialIndex::MoveProxy(int proxy, const Rect& bounds)
+{
+    KGE_ASSERT(proxy >= 0 && proxy < int(nodes_.size()) && nodes_[proxy].IsLeaf());
+
+    const Rect& fat_aabb = nodes_[proxy].aabb;
+    if (Contains(fat_aabb, bounds))
+    {
+        // Keep the old box unless it is much larger than the actor now
+        const Rect huge_aabb = Expand(bounds, AABB_MARGIN * 4);
+        if (Contains(huge_aabb, fat_aabb))
+            return false;
+    }
+
+    RemoveLeaf(proxy);
+    nodes_[proxy].aabb = Expand(bounds, AABB_MARGIN);
+    InsertLeaf(proxy);
+    return true;
+}
+
+void SpatialIndex::Clear()
+{
+    nodes_.clear();
+    root_        = NULL_PROXY;
+    free_list_   = NULL_PROXY;
+    proxy_count_ = 0;
+}
+
+int SpatialIndex::AllocNode()
+{
+    int node = free_list_;
+    if (node != NULL_PROXY)
+    {
+        free_list_ = nodes_[node].parent;
+    }
+    else
+    {
+        node = int(nodes_.size());
+        nodes_.emplace_back();
+    }
+
+    Node& n  = nodes_[node];
+    n.actor  = nullptr;
+    n.parent = NULL_PROXY;
+    n.child1 = NULL_PROXY;
+    n.child2 = NULL_PROXY;
+    n.height = 0;
+    return node;
+}
+
+void SpatialIndex::FreeNode(int node)
+{
+    nodes_[node].actor  = nullptr;
+    nodes_[node].parent = free_list_;
+    nodes_[node].height = -1;
+    free_list_          = node;
+}
+
+void SpatialIndex::InsertLeaf(int leaf)
+{
+    if (root_ == NULL_PROXY)
+    {
+        root_               = leaf;
+        nodes_[leaf].parent = NULL_PROXY;
+        return;
+    }
+
+    // Find the best sibling
+    const Rect leaf_aabb = nodes_[leaf].aabb;
+
+    int index = root_;
+    while (!nodes_[index].IsLeaf())
+    {
+        const Node& node = nodes_[index];
+
+        const float area          = GetPerimeter(node.aabb);
+        const float combined_area = GetPerimeter(Combine(node.aabb, leaf_aabb));
+
+        // Cost of creating a new parent for this node and the new leaf
+        const float cost = 2.f * combined_area;
+
+        // Minimum cost of pushing the leaf further down the tree
+        const float inheritance_cost = 2.f * (combined_area - area);
+
+        auto descend_cost = [&](int child) {
+            const Node& child_node = nodes_[child];
+            const float new_area   = GetPerimeter(Combine(child_node.aabb, leaf_aabb));
+            if (child_node.IsLeaf())
+                return new_area + inheritance_cost;
+            return new_area - GetPerimeter(child_node.aabb) + inheritance_cost;
+        };
+
+        const float cost1 = descend_cost(node.child1);
+        const float cost2 = descend_cost(node.child2);
+
+        if (cost < cost1 && cost < cost2)
+            break;
+
+        index = cost1 < cost2 ? node.child1 : node.child2;
+    }
+
+    const int sibling = index;
+
+    // Create a new parent
+    const int old_parent = nodes_[sibling].parent;
+    const int new_parent = AllocNode();
+
+    nodes_[new_parent].parent = old_parent;
+    nodes_[new_parent].aabb   = Combine(leaf_aabb, nodes_[sibling].aabb);
+    nodes_[new_parent].height = nodes_[sibling].height + 1;
+    nodes_[new_parent].child1 = sibling;
+    nodes_[new_parent].child2 = leaf;
+
+    if (old_parent != NULL_PROXY)
+    {
+        if (nodes_[old_parent].child1 == sibling)
+            nodes_[old_parent].child1 = new_parent;
+        else
+            nodes_[old_parent].child2 = new_parent;
+    }
+    else
+    {
+        root_ = new_parent;
+    }
+
+    nodes_[sibling].parent = new_parent;
+    nodes_[leaf].parent    = new_parent;
+
+    RefitAncestors(new_parent);
+}
+
+void SpatialIndex::RemoveLeaf(int leaf)
+{
+    if (leaf == root_)
+    {
+        root_ = NULL_PROXY;
+        return;
+    }
+
+    const int parent       = nodes_[leaf].parent;
+    const int grand_parent = nodes_[parent].parent;
+    const int sibling      = nodes_[parent].child1 == leaf ? nodes_[parent].child2 : nodes_[parent].child1;
+
+    if (grand_parent != NULL_PROXY)
+    {
+        // Destroy the parent and connect the sibling to the grand parent
+        if (nodes_[grand_parent].child1 == parent)
+            nodes_[grand_parent].child1 = sibling;
+        else
+            nodes_[grand_parent].child2 = sibling;
+
+        nodes_[sibling].parent = grand_parent;
+        FreeNode(parent);
+
+        RefitAncestors(grand_parent);
+    }
+    else
+    {
+        root_                  = sibling;
+        nodes_[sibling].parent = NULL_PROXY;
+        FreeNode(parent);
+    }
+}
+
+void SpatialIndex::RefitAncestors(int node)
+{
+    int index = node;
+    while (index != NULL_PROXY)
+    {
+        index = Balance(index);
+
+        Node&       n  = nodes_[index];
+        const Node& c1 = nodes_[n.child1];
+        const Node& c2 = nodes_[n.child2];
+
+        n.height = 1 + std::max(c1.height, c2.height);
+        n.aabb   = Combine(c1.aabb, c2.aabb);
+
+        index = n.parent;
+    }
+}
+
+// Performs a left or right rotation if node A is imbalanced, returns the new root of the subtree
+int SpatialIndex::Balance(int index_a)
+{
+    Node& a = nodes_[index_a];
+    if (a.IsLeaf() || a.height < 2)
+        return index_a;
+
+    const int index_b = a.child1;
+    const int index_c = a.child2;
+    Node&     b       = nodes_[index_b];
+    Node&     c       = nodes_[index_c];
+
+    const int balance = c.height - b.height;
+
+    // Rotate C up
+    if (balance > 1)
+    {
+        const int index_f = c.child1;
+        const int index_g = c.child2;
+        Node&     f       = nodes_[index_f];
+        Node&     g       = nodes_[index_g];
+
+        // Swap A and C
+        c.child1 = index_a;
+        c.parent = a.parent;
+        a.parent = index_c;
+
+        if (c.parent != NULL_PROXY)
+        {
+            if (nodes_[c.parent].child1 == index_a)
+                nodes_[c.parent].child1 = index_c;
+            else
+                nodes_[c.parent].child2 = index_c;
+        }
+        else
+        {
+            root_ = index_c;
+        }
+
+        // Rotate
+        if (f.height > g.height)
+        {
+            c.child2 = index_f;
+            a.child2 = index_g;
+            g.parent = index_a;
+            a.aabb   = Combine(b.aabb, g.aabb);
+            c.aabb   = Combine(a.aabb, f.aabb);
+            a.height = 1 + std::max(b.height, g.height);
+            c.height = 1 + std::max(a.height, f.height);
+        }
+        else
+        {
+            c.child2 = index_g;
+            a.child2 = index_f;
+            f.parent = index_a;
+            a.aabb   = Combine(b.aabb, f.aabb);
+            c.aabb   = Combine(a.aabb, g.aabb);
+            a.height = 1 + std::max(b.height, f.height);
+            c.height = 1 + std::max(a.height, g.height);
+        }
+        return index_c;
+    }
+
+    // Rotate B up
+    if (balance < -1)
+    {
+        const int index_d = b.child1;
+        const int index_e = b.child2;
+        Node&     d       = nodes_[index_d];
+        Node&     e       = nodes_[index_e];
+
+        // Swap A and B
+        b.child1 = index_a;
+        b.parent = a.parent;
+        a.parent = index_b;
+
+        if (b.parent != NULL_PROXY)
+        {
+            if (nodes_[b.parent].child1 == index_a)
+                nodes_[b.parent].child1 = index_b;
+            else
+                nodes_[b.parent].child2 = index_b;
+        }
+        else
+        {
+            root_ = index_b;
+        }
+
+        // Rotate
+        if (d.height > e.height)
+        {
+            b.child2 = index_d;
+            a.child1 = index_e;
+            e.parent = index_a;
+            a.aabb   = Combine(c.aabb, e.aabb);
+            b.aabb   = Combine(a.aabb, d.aabb);
+            a.height = 1 + std::max(c.height, e.height);
+            b.height = 1 + std::max(a.height, d.height);
+        }
+        else
+        {
+            b.child2 = index_e;
+            a.child1 = index_d;
+            d.parent = index_a;
+            a.aabb   = Combine(c.aabb, d.aabb);
+            b.aabb   = Combine(a.aabb, e.aabb);
+            a.height = 1 + std::max(c.height, d.height);
+            b.height = 1 + std::max(a.height, e.height);
+        }
+        return index_b;
+    }
+    return index_a;
+}
+
+}  // namespace kiwano
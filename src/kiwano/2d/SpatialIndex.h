@@ -0,0 +1,212 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <kiwano/core/Common.h>
+#include <kiwano/math/Math.h>
+
+namespace kiwano
+{
+
+class Actor;
+
+/**
+ * \addtogroup Actors
+ * @{
+ */
+
+/**
+ * \~chinese
+ * @brief 空间索引
+ * @details 以角色包围盒为键的动态包围盒树，用于快速查找某一点或某一区域内的角色。
+ * 叶子节点保存外扩后的包围盒，角色小幅移动时不需要更新树结构
+ */
+class KGE_API SpatialIndex : protected Noncopyable
+{
+public:
+    /// \~chinese
+    /// @brief 空代理
+    static const int NULL_PROXY = -1;
+
+    /// \~chinese
+    /// @brief 包围盒外扩距离
+    static const float AABB_MARGIN;
+
+    SpatialIndex();
+
+    /// \~chinese
+    /// @brief 创建代理
+    /// @param bounds 角色包围盒
+    /// @param actor 角色
+    /// @return 代理ID
+    int CreateProxy(const Rect& bounds, Actor* actor);
+
+    /// \~chinese
+    /// @brief 销毁代理
+    /// @param proxy 代理ID
+    void DestroyProxy(int proxy);
+
+    /// \~chinese
+    /// @brief 更新代理的包围盒
+    /// @param proxy 代理ID
+    /// @param bounds 角色包围盒
+    /// @return 树结构是否发生改变
+    bool MoveProxy(int proxy, const Rect& bounds);
+
+    /// \~chinese
+    /// @brief 获取代理对应的角色
+    Actor* GetActor(int proxy) const;
+
+    /// \~chinese
+    /// @brief 获取代理的外扩包围盒
+    const Rect& GetFatBounds(int proxy) const;
+
+    /// \~chinese
+    /// @brief 查找外扩包围盒包含点的所有代理
+    /// @param point 点
+    /// @param callback 回调函数，返回false时停止查找
+    template <typename _Callback>
+    void Query(const Point& point, _Callback&& callback) const;
+
+    /// \~chinese
+    /// @brief 查找外扩包围盒与矩形相交的所有代理
+    /// @param rect 矩形
+    /// @param callback 回调函数，返回false时停止查找
+    template <typename _Callback>
+    void Query(const Rect& rect, _Callback&& callback) const;
+
+    /// \~chinese
+    /// @brief 获取代理数量
+    size_t GetProxyCount() const;
+
+    /// \~chinese
+    /// @brief 获取树的高度
+    int GetHeight() const;
+
+    /// \~chinese
+    /// @brief 清空所有代理
+    void Clear();
+
+private:
+    struct Node
+    {
+        Rect   aabb;
+        Actor* actor;
+        int    parent;  // Next free node when the node is not in use
+        int    child1;
+        int    child2;
+        int    height;  // 0 for leaves, -1 for free nodes
+
+        inline bool IsLeaf() const
+        {
+            return child1 == NULL_PROXY;
+        }
+    };
+
+    int AllocNode();
+
+    void FreeNode(int node);
+
+    void InsertLeaf(int leaf);
+
+    void RemoveLeaf(int leaf);
+
+    void RefitAncestors(int node);
+
+    int Balance(int node);
+
+    template <typename _Overlap, typename _Callback>
+    void QueryNodes(_Overlap&& overlap, _Callback&& callback) const;
+
+private:
+    int          root_;
+    int          free_list_;
+    size_t       proxy_count_;
+    Vector<Node> nodes_;
+};
+
+/** @} */
+
+inline Actor* SpatialIndex::GetActor(int proxy) const
+{
+    KGE_ASSERT(proxy >= 0 && proxy < int(nodes_.size()));
+    return nodes_[proxy].actor;
+}
+
+inline const Rect& SpatialIndex::GetFatBounds(int proxy) const
+{
+    KGE_ASSERT(proxy >= 0 && proxy < int(nodes_.size()));
+    return nodes_[proxy].aabb;
+}
+
+inline size_t SpatialIndex::GetProxyCount() const
+{
+    return proxy_count_;
+}
+
+inline int SpatialIndex::GetHeight() const
+{
+    return root_ == NULL_PROXY ? 0 : nodes_[root_].height;
+}
+
+template <typename _Callback>
+inline void SpatialIndex::Query(const Point& point, _Callback&& callback) const
+{
+    QueryNodes([&](const Rect& aabb) { return aabb.ContainsPoint(point); }, std::forward<_Callback>(callback));
+}
+
+template <typename _Callback>
+inline void SpatialIndex::Query(const Rect& rect, _Callback&& callback) const
+{
+    QueryNodes([&](const Rect& aabb) { return aabb.Intersects(rect); }, std::forward<_Callback>(callback));
+}
+
+template <typename _Overlap, typename _Callback>
+void SpatialIndex::QueryNodes(_Overlap&& overlap, _Callback&& callback) const
+{
+    if (root_ == NULL_PROXY)
+        return;
+
+    // The tree is balanced, so its height is about 1.44 * log2(n) at most
+    int stack[128];
+    int count = 0;
+
+    stack[count++] = root_;
+    while (count > 0)
+    {
+        const Node& node = nodes_[stack[--count]];
+        if (!overlap(node.aabb))
+            continue;
+
+        if (node.IsLeaf())
+        {
+            if (!callback(node.actor))
+                return;
+        }
+        else
+        {
+            KGE_ASSERT(count + 2 <= 128);
+            stack[count++] = node.child1;
+            stack[count++] = node.child2;
+        }
+    }
+}
+
+}  // namespace kiwano
@@ -102,10 +102,28 @@ void Sprite::OnRender(RenderContext& ctx)
 {
     if (frame_.IsValid())
     {
-        ctx.DrawTexture(*frame_.GetTexture(), &frame_.GetCropRect(), &GetBounds());
+        if (ctx.IsSpriteBatchingEnabled())
+        {
+            ctx.DrawSprite(*frame_.GetTexture(), frame_.GetCropRect(), GetBounds(), GetRenderMatrix(),
+                           GetDisplayedOpacity());
+        }
+        else
+        {
+            Rect bounds = GetBounds();
+            ctx.DrawTexture(*frame_.GetTexture(), &frame_.GetCropRect(), &bounds);
+        }
     }
 }
 
+void Sprite::PrepareToRender(RenderContext& ctx)
+{
+    // Batched sprites carry their own transform and opacity, components still need the context state
+    if (ctx.IsSpriteBatchingEnabled() && GetAllComponents().empty())
+        return;
+
+    Actor::PrepareToRender(ctx);
+}
+
 bool Sprite::CheckVisibility(RenderContext& ctx) const
 {
     return frame_.IsValid() && Actor::CheckVisibility(ctx);
@@ -34,7 +34,7 @@ KGE_DECLARE_SMART_PTR(Sprite);
 
 /**
  * \~chinese
- * @brief 
+ * @brief 精灵
  */
 class KGE_API Sprite : public Actor
 {
@@ -42,75 +42,75 @@ public:
     Sprite();
 
     /// \~chinese
-    /// @brief 
-    /// @param file_path ͼƬ·
+    /// @brief 创建精灵
+    /// @param file_path 本地图片路径
     Sprite(const String& file_path);
 
     /// \~chinese
-    /// @brief 
-    /// @param res ͼƬԴ
+    /// @brief 创建精灵
+    /// @param res 图片资源
     Sprite(const Resource& res);
 
     /// \~chinese
-    /// @brief 
-    /// @param texture ͼ
+    /// @brief 创建精灵
+    /// @param texture 图像
     Sprite(TexturePtr texture);
 
     /// \~chinese
-    /// @brief 
-    /// @param file_path ͼƬ·
-    /// @param crop_rect ü
+    /// @brief 创建精灵
+    /// @param file_path 本地图片路径
+    /// @param crop_rect 裁剪矩形
     Sprite(const String& file_path, const Rect& crop_rect);
 
     /// \~chinese
-    /// @brief 
-    /// @param res ͼƬԴ
-    /// @param crop_rect ü
+    /// @brief 创建精灵
+    /// @param res 图片资源
+    /// @param crop_rect 裁剪矩形
     Sprite(const Resource& res, const Rect& crop_rect);
 
     /// \~chinese
-    /// @brief 
-    /// @param texture ͼ
-    /// @param crop_rect ü
+    /// @brief 创建精灵
+    /// @param texture 图像
+    /// @param crop_rect 裁剪矩形
     Sprite(TexturePtr texture, const Rect& crop_rect);
 
     /// \~chinese
-    /// @brief 
-    /// @param frame ֡
+    /// @brief 创建精灵
+    /// @param frame 精灵帧
     Sprite(const SpriteFrame& frame);
 
     virtual ~Sprite();
 
     /// \~chinese
-    /// @brief رͼƬòü
-    /// @param file_path ͼƬ·
+    /// @brief 加载本地图片并重置裁剪矩形
+    /// @param file_path 本地图片路径
     bool Load(const String& file_path);
 
     /// \~chinese
-    /// @brief ͼԴòü
-    /// @param res ͼƬԴ
+    /// @brief 加载图像资源并重置裁剪矩形
+    /// @param res 图片资源
     bool Load(const Resource& res);
 
     /// \~chinese
-    /// @brief ȡͼ
+    /// @brief 获取图像
     TexturePtr GetTexture() const;
 
     /// \~chinese
-    /// @brief ȡü
+    /// @brief 获取裁剪矩形
     Rect GetCropRect() const;
 
     /// \~chinese
-    /// @brief ȡ֡
+    /// @brief 获取精灵帧
     SpriteFrame GetFrame() const;
 
     /// \~chinese
-    /// @brief ʹþü
-    /// @param crop_rect ü
+    /// @brief 使用矩形区域裁剪精灵
+    /// @param crop_rect 裁剪矩形
     void SetCropRect(const Rect& crop_rect);
 
     /// \~chinese
-    /// @brief þ֡
-    /// @param[in] frame ֡
+    /// @brief 设置精灵帧
+    /// @param[in] frame 精灵帧
     void SetFrame(const SpriteFrame& frame);
 
     void OnRender(RenderContext& ctx) override;
@@ -118,6 +118,8 @@ public:
 protected:
     bool CheckVisibility(RenderContext& ctx) const override;
 
+    void PrepareToRender(RenderContext& ctx) override;
+
 private:
     SpriteFrame frame_;
 };
@@ -28,7 +28,7 @@ namespace kiwano
 
 /**
  * \~chinese
- * @brief ֡
+ * @brief 精灵帧
  */
 class KGE_API SpriteFrame
 {
@@ -36,81 +36,81 @@ public:
     SpriteFrame();
 
     /// \~chinese
-    /// @brief ֡
-    /// @param file_path ͼ·
+    /// @brief 创建精灵帧
+    /// @param file_path 图像路径
     SpriteFrame(const String& file_path);
 
     /// \~chinese
-    /// @brief ֡
-    /// @param res ͼԴ
+    /// @brief 创建精灵帧
+    /// @param res 图像资源
     SpriteFrame(const Resource& res);
 
     /// \~chinese
-    /// @brief ֡
-    /// @param texture 
+    /// @brief 创建精灵帧
+    /// @param texture 纹理
     SpriteFrame(TexturePtr texture);
 
     /// \~chinese
-    /// @brief ֡
-    /// @param file_path ͼ·
-    /// @param crop_rect ü
+    /// @brief 创建精灵帧
+    /// @param file_path 图像路径
+    /// @param crop_rect 裁剪矩形
     SpriteFrame(const String& file_path, const Rect& crop_rect);
 
     /// \~chinese
-    /// @brief ֡
-    /// @param res ͼԴ
-    /// @param crop_rect ü
+    /// @brief 创建精灵帧
+    /// @param res 图像资源
+    /// @param crop_rect 裁剪矩形
     SpriteFrame(const Resource& res, const Rect& crop_rect);
 
     /// \~chinese
-    /// @brief ֡
-    /// @param texture 
-    /// @param crop_rect ü
+    /// @brief 创建精灵帧
+    /// @param texture 纹理
+    /// @param crop_rect 裁剪矩形
     SpriteFrame(TexturePtr texture, const Rect& crop_rect);
 
     /// \~chinese
-    /// @brief ͼ
-    /// @param file_path ͼ·
+    /// @brief 加载图像
+    /// @param file_path 图像路径
     bool Load(const String& file_path);
 
     /// \~chinese
-    /// @brief ͼ
-    /// @param res ͼԴ
+    /// @brief 加载图像
+    /// @param res 图像资源
     bool Load(const Resource& res);
 
     /// \~chinese
-    /// @brief ǷЧ
+    /// @brief 是否有效
     bool IsValid() const;
 
     /// \~chinese
-    /// @brief ȡü
+    /// @brief 获取裁剪矩形
     const Rect& GetCropRect() const;
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取纹理
     TexturePtr GetTexture() const;
 
     /// \~chinese
-    /// @brief ȡ֡С
+    /// @brief 获取精灵帧大小
     Size GetSize() const;
 
     /// \~chinese
-    /// @brief ü֡Ϊ
-    /// @param crop_rect ü
+    /// @brief 裁剪精灵帧为矩形
+    /// @param crop_rect 裁剪矩形
     void SetCropRect(const Rect& crop_rect);
 
     /// \~chinese
-    /// @brief òü
-    /// @param texture 
+    /// @brief 设置纹理并重置裁剪矩形
+    /// @param texture 纹理
     void SetTexture(TexturePtr texture);
 
     /// \~chinese
-    /// @brief зָ֡
-    /// @param cols 
-    /// @param rows 
-    /// @param max_num ֡-1ΪָͼȫΪ֡
-    /// @param padding_x X
-    /// @param padding_y Y
+    /// @brief 按行列分割精灵帧
+    /// @param cols 列数
+    /// @param rows 行数
+    /// @param max_num 最大帧数量，设-1为将分割后的图像全部作为序列帧
+    /// @param padding_x X方向间隔
+    /// @param padding_y Y方向间隔
     Vector<SpriteFrame> Split(int cols, int rows, int max_num = -1, float padding_x = 0, float padding_y = 0);
 
 private:
@@ -19,13 +19,35 @@
 // THE SOFTWARE.
 
 #include <kiwano/2d/Stage.h>
+#include <kiwano/event/MouseEvent.h>
 #include <kiwano/utils/Logger.h>
 #include <kiwano/render/Renderer.h>
 
 namespace kiwano
 {
 
+namespace
+{
+
+template <typename _Func>
+void VisitActors(Actor* parent, bool visible_only, const _Func& func)
+{
+    for (auto& child : parent->GetAllChildren())
+    {
+        if (visible_only && !child->IsVisible())
+            continue;
+
+        func(child.Get());
+        VisitActors(child.Get(), visible_only, func);
+    }
+}
+
+}  // namespace
+
 Stage::Stage()
+    : spatial_index_enabled_(false)
+    , hit_cache_valid_(false)
+    , render_order_counter_(0)
 {
     SetStage(this);
 
@@ -33,7 +55,11 @@ Stage::Stage()
     SetSize(Renderer::GetInstance().GetOutputSize());
 }
 
-Stage::~Stage() {}
+Stage::~Stage()
+{
+    // Children must leave the stage before the spatial index is destroyed
+    RemoveAllChildren();
+}
 
 void Stage::OnEnter()
 {
@@ -64,4 +90,231 @@ void Stage::RenderBorder(RenderContext& ctx)
     Actor::RenderBorder(ctx);
 }
 
+void Stage::Render(RenderContext& ctx)
+{
+    render_order_counter_ = 0;
+
+    Actor::Render(ctx);
+    ctx.FlushSprites();
+
+    // Most transforms are updated during rendering, so the index is cheap to refresh now
+    FlushSpatialIndex();
+}
+
+bool Stage::DispatchEvent(Event* evt)
+{
+    if (!spatial_index_enabled_ || !evt->IsType<MouseEvent>())
+        return Actor::DispatchEvent(evt);
+
+    const Point pos = evt->Cast<MouseEvent>()->pos;
+
+    FlushSpatialIndex();
+
+    hit_actors_.clear();
+    spatial_index_.Query(pos, [&](Actor* actor) {
+        if (actor->ContainsPoint(pos))
+            hit_actors_.push_back(actor);
+        return true;
+    });
+    std::sort(hit_actors_.begin(), hit_actors_.end());
+
+    hit_point_       = pos;
+    hit_cache_valid_ = true;
+
+    bool ret = DispatchMouseEvent(this, evt);
+
+    hit_cache_valid_ = false;
+    return ret;
+}
+
+bool Stage::DispatchMouseEvent(Actor* actor, Event* evt)
+{
+    if (!actor->visible_ || !actor->evt_dispatch_enabled_)
+        return true;
+
+    // Same order as Actor::DispatchEvent
+    ActorPtr child = actor->children_.GetLast();
+    while (child)
+    {
+        if (child->GetZOrder() < 0)
+            break;
+
+        if (!DispatchMouseEvent(child.Get(), evt))
+            return false;
+
+        child = child->GetPrev();
+    }
+
+    if (IsMouseEventReceiver(actor) && !actor->HandleEvent(evt))
+        return false;
+
+    while (child)
+    {
+        if (!DispatchMouseEvent(child.Get(), evt))
+            return false;
+
+        child = child->GetPrev();
+    }
+    return true;
+}
+
+bool Stage::IsMouseEventReceiver(const Actor* actor) const
+{
+    // Actors with mouse sensors only care about the events that happen on them, others may listen to any event
+    if (actor->mouse_sensor_count_ == 0 || actor->mouse_hover_count_ != 0 || actor == mouse_capture_.Get())
+        return true;
+    return std::binary_search(hit_actors_.begin(), hit_actors_.end(), actor);
+}
+
+bool Stage::HitTest(const Actor* actor, const Point& point) const
+{
+    // The cache is out of date once any actor has moved during dispatching
+    if (hit_cache_valid_ && dirty_actors_.empty() && point == hit_point_)
+    {
+        return std::binary_search(hit_actors_.begin(), hit_actors_.end(), actor);
+    }
+    return actor->ContainsPoint(point);
+}
+
+void Stage::SetSpatialIndexEnabled(bool enabled)
+{
+    if (spatial_index_enabled_ == enabled)
+        return;
+
+    spatial_index_enabled_ = enabled;
+    if (enabled)
+    {
+        VisitActors(this, false, [](Actor* actor) { actor->InvalidateBounds(); });
+    }
+    else
+    {
+        VisitActors(this, false, [](Actor* actor) {
+            actor->index_proxy_ = SpatialIndex::NULL_PROXY;
+            actor->dirty_flag_.Unset(DirtyFlag::DirtyBounds);
+        });
+
+        spatial_index_.Clear();
+        dirty_actors_.clear();
+        hit_actors_.clear();
+    }
+}
+
+Vector<ActorPtr> Stage::QueryActorsAt(const Point& point)
+{
+    Vector<Actor*> actors;
+    if (spatial_index_enabled_)
+    {
+        FlushSpatialIndex();
+        spatial_index_.Query(point, [&](Actor* actor) {
+            if (IsActorVisible(actor) && actor->ContainsPoint(point))
+                actors.push_back(actor);
+            return true;
+        });
+    }
+    else
+    {
+        VisitActors(this, true, [&](Actor* actor) {
+            if (actor->ContainsPoint(point))
+                actors.push_back(actor);
+        });
+    }
+    return SortByRenderOrder(actors);
+}
+
+Vector<ActorPtr> Stage::QueryActorsInRect(const Rect& rect)
+{
+    Vector<Actor*> actors;
+    if (spatial_index_enabled_)
+    {
+        FlushSpatialIndex();
+        spatial_index_.Query(rect, [&](Actor* actor) {
+            if (IsActorVisible(actor) && actor->GetBoundingBox().Intersects(rect))
+                actors.push_back(actor);
+            return true;
+        });
+    }
+    else
+    {
+        VisitActors(this, true, [&](Actor* actor) {
+            if (actor->GetBoundingBox().Intersects(rect))
+                actors.push_back(actor);
+        });
+    }
+    return SortByRenderOrder(actors);
+}
+
+void Stage::IndexActor(Actor* actor)
+{
+    actor->dirty_index_ = uint32_t(dirty_actors_.size());
+    dirty_actors_.push_back(actor);
+}
+
+void Stage::UnindexActor(Actor* actor)
+{
+    if (actor->index_proxy_ != SpatialIndex::NULL_PROXY)
+    {
+        spatial_index_.DestroyProxy(actor->index_proxy_);
+        actor->index_proxy_ = SpatialIndex::NULL_PROXY;
+    }
+
+    // The stage does not hold references, so the actor must not be left in any list
+    if (actor->dirty_flag_.Has(DirtyFlag::DirtyBounds))
+    {
+        actor->dirty_flag_.Unset(DirtyFlag::DirtyBounds);
+
+        // Leave a hole instead of erasing, removing a large subtree would be quadratic otherwise
+        KGE_ASSERT(dirty_actors_[actor->dirty_index_] == actor);
+        dirty_actors_[actor->dirty_index_] = nullptr;
+    }
+
+    auto iter = std::lower_bound(hit_actors_.begin(), hit_actors_.end(), actor);
+    if (iter != hit_actors_.end() && *iter == actor)
+        hit_actors_.erase(iter);
+}
+
+void Stage::FlushSpatialIndex()
+{
+    // Updating a transform invalidates the children, they are appended and handled in the same loop
+    for (size_t i = 0; i < dirty_actors_.size(); ++i)
+    {
+        Actor* actor = dirty_actors_[i];
+        if (!actor)
+            continue;  // Left the stage after being marked
+
+        KGE_ASSERT(actor->stage_ == this && actor->dirty_flag_.Has(DirtyFlag::DirtyBounds));
+
+        actor->dirty_flag_.Unset(DirtyFlag::DirtyBounds);
+        actor->UpdateTransform();
+
+        const Rect bounds = actor->GetBoundingBox();
+        if (actor->index_proxy_ == SpatialIndex::NULL_PROXY)
+        {
+            actor->index_proxy_ = spatial_index_.CreateProxy(bounds, actor);
+        }
+        else
+        {
+            spatial_index_.MoveProxy(actor->index_proxy_, bounds);
+        }
+    }
+    dirty_actors_.clear();
+}
+
+bool Stage::IsActorVisible(const Actor* actor) const
+{
+    for (; actor && actor != this; actor = actor->GetParent())
+    {
+        if (!actor->IsVisible())
+            return false;
+    }
+    return true;
+}
+
+Vector<ActorPtr> Stage::SortByRenderOrder(Vector<Actor*>& actors) const
+{
+    std::sort(actors.begin(), actors.end(),
+              [](const Actor* lhs, const Actor* rhs) { return lhs->render_order_ > rhs->render_order_; });
+
+    return Vector<ActorPtr>(actors.begin(), actors.end());
+}
+
 }  // namespace kiwano
@@ -20,6 +20,7 @@
 
 #pragma once
 #include <kiwano/2d/Actor.h>
+#include <kiwano/2d/SpatialIndex.h>
 #include <kiwano/render/Brush.h>
 
 namespace kiwano
@@ -33,14 +34,15 @@ KGE_DECLARE_SMART_PTR(Stage);
 
 /**
  * \~chinese
- * @brief ̨
- * @details ̨нɫ壬ǵֱӿƵĶ
+ * @brief 舞台
+ * @details 舞台是所有角色的载体，是导演直接控制的对象
  * @see kiwano::Actor kiwano::Director
  */
 class KGE_API Stage : public Actor
 {
     friend class Transition;
     friend class Director;
+    friend class Actor;
 
 public:
     Stage();
@@ -48,39 +50,111 @@ public:
     virtual ~Stage();
 
     /// \~chinese
-    /// @brief ̨ʱ
-    /// @details ظúԴ̨ǰΪ
+    /// @brief 进入舞台时
+    /// @details 重载该函数以处理进入舞台前的行为
     virtual void OnEnter();
 
     /// \~chinese
-    /// @brief ˳̨ʱ
-    /// @details ظúԴ˳̨ǰΪ
+    /// @brief 退出舞台时
+    /// @details 重载该函数以处理退出舞台前的行为
     virtual void OnExit();
 
     /// \~chinese
-    /// @brief ȡɫ߽仭ˢ
+    /// @brief 获取角色边界填充画刷
     BrushPtr GetBorderFillBrush() const;
 
     /// \~chinese
-    /// @brief ȡɫ߽ˢ
+    /// @brief 获取角色边界轮廓画刷
     BrushPtr GetBorderStrokeBrush() const;
 
     /// \~chinese
-    /// @brief ýɫ߽仭ˢ
+    /// @brief 设置角色边界填充画刷
     void SetBorderFillBrush(BrushPtr brush);
 
     /// \~chinese
-    /// @brief ýɫ߽ˢ
+    /// @brief 设置角色边界轮廓画刷
     void SetBorderStrokeBrush(BrushPtr brush);
 
+    /// \~chinese
+    /// @brief 开启或关闭空间索引
+    /// @details 开启后舞台会维护所有角色包围盒的动态包围盒树，用于加速角色查找和鼠标事件的碰撞检测。
+    /// 分发鼠标事件时仍然遍历整棵角色树，但带有 MouseSensor 组件的角色被视为基于碰撞检测的角色，
+    /// 只有在鼠标位于角色上、鼠标刚离开角色或角色捕获了鼠标时才会收到鼠标事件；其他角色照常收到所有鼠标事件
+    /// @see SetMouseCapture
+    void SetSpatialIndexEnabled(bool enabled);
+
+    /// \~chinese
+    /// @brief 设置捕获鼠标的角色
+    /// @details 开启空间索引后，捕获鼠标的角色即使带有 MouseSensor 组件也会收到所有鼠标事件，
+    /// 例如拖动过程中鼠标移出角色的情况。传入空指针以释放捕获
+    void SetMouseCapture(ActorPtr actor);
+
+    /// \~chinese
+    /// @brief 获取捕获鼠标的角色
+    ActorPtr GetMouseCapture() const;
+
+    /// \~chinese
+    /// @brief 是否开启了空间索引
+    bool IsSpatialIndexEnabled() const;
+
+    /// \~chinese
+    /// @brief 获取空间索引
+    const SpatialIndex& GetSpatialIndex() const;
+
+    /// \~chinese
+    /// @brief 查找包含点的所有可见角色
+    /// @param point 世界坐标系中的点
+    /// @return 按上一次渲染的顺序从前到后排列的角色
+    Vector<ActorPtr> QueryActorsAt(const Point& point);
+
+    /// \~chinese
+    /// @brief 查找包围盒与矩形相交的所有可见角色
+    /// @param rect 世界坐标系中的矩形
+    /// @return 按上一次渲染的顺序从前到后排列的角色
+    Vector<ActorPtr> QueryActorsInRect(const Rect& rect);
+
+    /// \~chinese
+    /// @brief 判断点是否在角色内
+    /// @details 分发鼠标事件时直接使用空间索引的查询结果
+    bool HitTest(const Actor* actor, const Point& point) const;
+
+    bool DispatchEvent(Event* evt) override;
+
 protected:
     /// \~chinese
-    /// @brief ӽɫı߽
+    /// @brief 渲染所有角色
+    void Render(RenderContext& ctx) override;
+
+    /// \~chinese
+    /// @brief 绘制所有子角色的边界
     void RenderBorder(RenderContext& ctx) override;
 
 private:
-    BrushPtr border_fill_brush_;
-    BrushPtr border_stroke_brush_;
+    void IndexActor(Actor* actor);
+
+    void UnindexActor(Actor* actor);
+
+    void FlushSpatialIndex();
+
+    bool DispatchMouseEvent(Actor* actor, Event* evt);
+
+    bool IsMouseEventReceiver(const Actor* actor) const;
+
+    bool IsActorVisible(const Actor* actor) const;
+
+    Vector<ActorPtr> SortByRenderOrder(Vector<Actor*>& actors) const;
+
+private:
+    bool             spatial_index_enabled_;
+    bool             hit_cache_valid_;
+    uint32_t         render_order_counter_;
+    Point            hit_point_;
+    BrushPtr         border_fill_brush_;
+    BrushPtr         border_stroke_brush_;
+    ActorPtr         mouse_capture_;
+    SpatialIndex     spatial_index_;
+    Vector<Actor*>   dirty_actors_;
+    Vector<Actor*>   hit_actors_;
 };
 
 /** @} */
@@ -104,4 +178,24 @@ inline void Stage::SetBorderStrokeBrush(BrushPtr brush)
 {
     border_stroke_brush_ = brush;
 }
+
+inline void Stage::SetMouseCapture(ActorPtr actor)
+{
+    mouse_capture_ = actor;
+}
+
+inline ActorPtr Stage::GetMouseCapture() const
+{
+    return mouse_capture_;
+}
+
+inline bool Stage::IsSpatialIndexEnabled() const
+{
+    return spatial_index_enabled_;
+}
+
+inline const SpatialIndex& Stage::GetSpatialIndex() const
+{
+    return spatial_index_;
+}
 }  // namespace kiwano
@@ -56,14 +56,9 @@ Size TextActor::GetSize() const
 
 void TextActor::SetText(const String& text)
 {
-    if (!layout_)
-    {
-        layout_ = MakePtr<TextLayout>();
-    }
-
     try
     {
-        layout_->Reset(text, style_);
+        ResetLayout(text, style_);
         content_ = text;
     }
     catch (SystemError& e)
@@ -76,7 +71,7 @@ void TextActor::SetStyle(const TextStyle& style)
 {
     style_ = style;
     if (layout_)
-        layout_->Reset(content_, style);
+        ResetLayout(content_, style);
 }
 
 void TextActor::SetFont(FontPtr font)
@@ -84,7 +79,9 @@ void TextActor::SetFont(FontPtr font)
     if (style_.font != font)
     {
         style_.font = font;
-        if (layout_)
+        if (IsLayoutShared())
+            ResetLayout(content_, style_);
+        else if (layout_)
             layout_->SetFont(font);
     }
 }
@@ -94,7 +91,9 @@ void TextActor::SetUnderline(bool enable)
     if (style_.show_underline != enable)
     {
         style_.show_underline = enable;
-        if (layout_)
+        if (IsLayoutShared())
+            ResetLayout(content_, style_);
+        else if (layout_)
             layout_->SetUnderline(enable);
     }
 }
@@ -104,7 +103,9 @@ void TextActor::SetStrikethrough(bool enable)
     if (style_.show_strikethrough != enable)
     {
         style_.show_strikethrough = enable;
-        if (layout_)
+        if (IsLayoutShared())
+            ResetLayout(content_, style_);
+        else if (layout_)
             layout_->SetStrikethrough(enable);
     }
 }
@@ -114,7 +115,9 @@ void TextActor::SetWrapWidth(float wrap_width)
     if (style_.wrap_width != wrap_width)
     {
         style_.wrap_width = wrap_width;
-        if (layout_)
+        if (IsLayoutShared())
+            ResetLayout(content_, style_);
+        else if (layout_)
             layout_->SetWrapWidth(wrap_width);
     }
 }
@@ -124,7 +127,9 @@ void TextActor::SetLineSpacing(float line_spacing)
     if (style_.line_spacing != line_spacing)
     {
         style_.line_spacing = line_spacing;
-        if (layout_)
+        if (IsLayoutShared())
+            ResetLayout(content_, style_);
+        else if (layout_)
             layout_->SetLineSpacing(line_spacing);
     }
 }
@@ -134,7 +139,9 @@ void TextActor::SetAlignment(TextAlign align)
     if (style_.alignment != align)
     {
         style_.alignment = align;
-        if (layout_)
+        if (IsLayoutShared())
+            ResetLayout(content_, style_);
+        else if (layout_)
             layout_->SetAlignment(align);
     }
 }
@@ -144,7 +151,9 @@ void TextActor::SetFillBrush(BrushPtr brush)
     if (style_.fill_brush != brush)
     {
         style_.fill_brush = brush;
-        if (layout_)
+        if (IsLayoutShared())
+            ResetLayout(content_, style_);
+        else if (layout_)
             layout_->SetFillBrush(brush);
     }
 }
@@ -154,7 +163,9 @@ void TextActor::SetOutlineBrush(BrushPtr brush)
     if (style_.outline_brush != brush)
     {
         style_.outline_brush = brush;
-        if (layout_)
+        if (IsLayoutShared())
+            ResetLayout(content_, style_);
+        else if (layout_)
             layout_->SetOutlineBrush(brush);
     }
 }
@@ -164,7 +175,9 @@ void TextActor::SetOutlineStrokeStyle(StrokeStylePtr stroke)
     if (style_.outline_stroke != stroke)
     {
         style_.outline_stroke = stroke;
-        if (layout_)
+        if (IsLayoutShared())
+            ResetLayout(content_, style_);
+        else if (layout_)
             layout_->SetOutlineStrokeStyle(stroke);
     }
 }
@@ -221,6 +234,22 @@ void TextActor::UpdateDirtyLayout()
     }
 }
 
+void TextActor::ResetLayout(const String& text, const TextStyle& style)
+{
+    // The layout drawn in the previous frame may still be replayed by a render snapshot,
+    // so a shared layout is never reset in place
+    if (!layout_ || IsLayoutShared())
+    {
+        layout_ = MakePtr<TextLayout>();
+    }
+    layout_->Reset(text, style);
+}
+
+bool TextActor::IsLayoutShared() const
+{
+    return layout_ && layout_->GetRefCount() > 1;
+}
+
 void TextActor::ForceUpdateLayout()
 {
     if (layout_)
@@ -34,7 +34,7 @@ KGE_DECLARE_SMART_PTR(TextActor);
 
 /**
  * \~chinese
- * @brief ıɫ
+ * @brief 文本角色
  */
 class KGE_API TextActor : public Actor
 {
@@ -42,114 +42,116 @@ public:
     TextActor();
 
     /// \~chinese
-    /// @brief ıɫ
-    /// @param text 
+    /// @brief 创建文本角色
+    /// @param text 文字内容
     TextActor(const String& text);
 
     /// \~chinese
-    /// @brief ıɫ
-    /// @param text 
-    /// @param style ıʽ
+    /// @brief 创建文本角色
+    /// @param text 文字内容
+    /// @param style 文本样式
     TextActor(const String& text, const TextStyle& style);
 
     virtual ~TextActor();
 
     /// \~chinese
-    /// @brief ȡı
+    /// @brief 获取文本
     String GetText() const;
 
     /// \~chinese
-    /// @brief ȡıʽ
+    /// @brief 获取文本样式
     TextStyle GetStyle() const;
 
     /// \~chinese
-    /// @brief ȡı
+    /// @brief 获取文本布局
     TextLayoutPtr GetLayout() const;
 
     /// \~chinese
-    /// @brief ȡС
+    /// @brief 获取大小
     Size GetSize() const override;
 
     /// \~chinese
-    /// @brief ȡ仭ˢ
+    /// @brief 获取填充画刷
     BrushPtr GetFillBrush() const;
 
     /// \~chinese
-    /// @brief ȡ߻ˢ
+    /// @brief 获取描边画刷
     BrushPtr GetOutlineBrush() const;
 
     /// \~chinese
-    /// @brief ȡʽ
+    /// @brief 获取描边线条样式
     StrokeStylePtr GetOutlineStrokeStyle() const;
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取字体
     FontPtr GetFont() const;
 
     /// \~chinese
-    /// @brief ı
+    /// @brief 设置文本
     void SetText(const String& text);
 
     /// \~chinese
-    /// @brief ıʽ
+    /// @brief 设置文本样式
     void SetStyle(const TextStyle& style);
 
     /// \~chinese
-    /// @brief 
+    /// @brief 设置字体
     void SetFont(FontPtr font);
 
     /// \~chinese
-    /// @brief 仭ˢ
+    /// @brief 设置文字填充画刷
     void SetFillBrush(BrushPtr brush);
 
     /// \~chinese
-    /// @brief ɫĬֵΪ Color::White
+    /// @brief 设置文字填充颜色（默认值为 Color::White）
     void SetFillColor(const Color& color);
 
     /// \~chinese
-    /// @brief ıԶеĿȣĬΪ 0
+    /// @brief 设置文本自动换行的宽度（默认为 0）
     void SetWrapWidth(float wrap_width);
 
     /// \~chinese
-    /// @brief мࣨĬΪ 0
+    /// @brief 设置行间距（默认为 0）
     void SetLineSpacing(float line_spacing);
 
     /// \~chinese
-    /// @brief ö뷽ʽĬΪ TextAlign::Left
+    /// @brief 设置对齐方式（默认为 TextAlign::Left）
     void SetAlignment(TextAlign align);
 
     /// \~chinese
-    /// @brief ߻ˢ
+    /// @brief 设置文字描边画刷
     void SetOutlineBrush(BrushPtr brush);
 
     /// \~chinese
-    /// @brief ɫ
+    /// @brief 设置文字描边颜色
     void SetOutlineColor(const Color& outline_color);
 
     /// \~chinese
-    /// @brief ʽ
+    /// @brief 设置描边线条样式
     void SetOutlineStrokeStyle(StrokeStylePtr stroke);
 
     /// \~chinese
-    /// @brief Ƿʾ»ߣĬֵΪ false
+    /// @brief 设置是否显示下划线（默认值为 false）
     void SetUnderline(bool enable);
 
     /// \~chinese
-    /// @brief ǷʾɾߣĬֵΪ false
+    /// @brief 设置是否显示删除线（默认值为 false）
     void SetStrikethrough(bool enable);
 
     /// \~chinese
-    /// @brief ı
+    /// @brief 设置文本布局
+    /// @note 文本布局同时被其他对象（如渲染快照）引用时，修改文字或样式会按当前文字和样式重建一个新的布局，
+    /// 而不是原地修改它
     void SetTextLayout(TextLayoutPtr layout);
 
     /// \~chinese
-    /// @brief ֲ
-    /// @details ֲʱ
+    /// @brief 更新脏文字布局
+    /// @details 仅当文字布局脏时更新
     void UpdateDirtyLayout();
 
     /// \~chinese
-    /// @brief ǿƸֲ
-    /// @details ֲµģֲֶԸ½ڵ״̬
+    /// @brief 强制更新文字布局
+    /// @details 文字布局是懒更新的，手动更新文字布局以更新节点状态
     void ForceUpdateLayout();
 
     void OnRender(RenderContext& ctx) override;
@@ -159,6 +161,11 @@ protected:
 
     bool CheckVisibility(RenderContext& ctx) const override;
 
+private:
+    void ResetLayout(const String& text, const TextStyle& style);
+
+    bool IsLayoutShared() const;
+
 private:
     String        content_;
     TextStyle     style_;
@@ -0,0 +1,270 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <kiwano/2d/TextureAtlas.h>
+#include <kiwano/render/RenderContext.h>
+#include <kiwano/utils/Logger.h>
+
+namespace kiwano
+{
+
+namespace
+{
+
+inline Vec2 GetPixelScale(const Texture& texture)
+{
+    const Size      size       = texture.GetSize();
+    const PixelSize pixel_size = texture.GetSizeInPixels();
+    return Vec2(size.x > 0 ? float(pixel_size.x) / size.x : 1.0f, size.y > 0 ? float(pixel_size.y) / size.y : 1.0f);
+}
+
+}  // namespace
+
+TextureAtlas::TextureAtlas(uint32_t page_size, uint32_t padding)
+    : page_size_(page_size)
+    , padding_(padding)
+    , used_area_(0)
+{
+}
+
+TextureAtlas::~TextureAtlas() {}
+
+SpriteFrame TextureAtlas::Add(TexturePtr texture)
+{
+    return Add(SpriteFrame(texture));
+}
+
+SpriteFrame TextureAtlas::Add(const SpriteFrame& frame)
+{
+    if (!frame.IsValid())
+        return frame;
+
+    TexturePtr texture = frame.GetTexture();
+    if (std::find(textures_.begin(), textures_.end(), texture) != textures_.end())
+    {
+        // Already in this atlas
+        return frame;
+    }
+
+    const Rect& crop_rect = frame.GetCropRect();
+
+    FrameKey key = { texture->GetObjectID(), crop_rect };
+
+    auto iter = frames_.find(key);
+    if (iter != frames_.end())
+        return iter->second;
+
+    // Copy whole pixels covering the crop rect, the fractional part is kept in the new crop rect
+    const Vec2      src_scale  = GetPixelScale(*texture);
+    const PixelSize src_pixels = texture->GetSizeInPixels();
+
+    const Rect  exact(crop_rect.GetLeft() * src_scale.x, crop_rect.GetTop() * src_scale.y,
+                      crop_rect.GetRight() * src_scale.x, crop_rect.GetBottom() * src_scale.y);
+    const float left   = std::max(std::floor(exact.GetLeft()), 0.0f);
+    const float top    = std::max(std::floor(exact.GetTop()), 0.0f);
+    const float right  = std::min(std::ceil(exact.GetRight()), float(src_pixels.x));
+    const float bottom = std::min(std::ceil(exact.GetBottom()), float(src_pixels.y));
+    if (right <= left || bottom <= top)
+        return frame;
+
+    const uint32_t width  = uint32_t(right - left);
+    const uint32_t height = uint32_t(bottom - top);
+    if (width + padding_ > page_size_ || height + padding_ > page_size_)
+    {
+        KGE_WARNF("Texture region (%ux%u) is too large for the atlas pages (%ux%u)", width, height, page_size_,
+                  page_size_);
+        return frame;
+    }
+
+    // Try the existing pages first, a new page is only created when none of them has room
+    size_t   index = 0;
+    uint32_t x     = 0;
+    uint32_t y     = 0;
+    for (; index < pages_.size(); ++index)
+    {
+        if (Insert(pages_[index], width + padding_, height + padding_, x, y))
+            break;
+    }
+
+    if (index == pages_.size())
+    {
+        if (!CreatePage() || !Insert(pages_.back(), width + padding_, height + padding_, x, y))
+            return frame;
+    }
+
+    TexturePtr page = textures_[index];
+    page->CopyFrom(texture, Rect(left, top, right, bottom), Point(float(x), float(y)));
+    used_area_ += uint64_t(width) * height;
+
+    const Vec2 page_scale = GetPixelScale(*page);
+    const Rect new_crop_rect((x + exact.GetLeft() - left) / page_scale.x, (y + exact.GetTop() - top) / page_scale.y,
+                             (x + exact.GetRight() - left) / page_scale.x, (y + exact.GetBottom() - top) / page_scale.y);
+
+    SpriteFrame result(page, new_crop_rect);
+    frames_.insert(std::make_pair(key, result));
+    return result;
+}
+
+void TextureAtlas::Add(FrameSequence& frames)
+{
+    for (size_t i = 0; i < frames.GetFramesCount(); ++i)
+    {
+        frames.SetFrame(i, Add(frames.GetFrame(i)));
+    }
+}
+
+float TextureAtlas::GetOccupancy() const
+{
+    if (pages_.empty())
+        return 0.0f;
+    return float(double(used_area_) / (double(page_size_) * page_size_ * pages_.size()));
+}
+
+void TextureAtlas::Clear()
+{
+    pages_.clear();
+    textures_.clear();
+    frames_.clear();
+    used_area_ = 0;
+}
+
+bool TextureAtlas::Insert(Page& page, uint32_t width, uint32_t height, uint32_t& x, uint32_t& y)
+{
+    auto& skyline = page.skyline;
+
+    // Bottom-left rule: choose the position where the rect ends lowest, then the narrowest segment
+    size_t   best_index  = skyline.size();
+    uint32_t best_bottom = page_size_ + 1;
+    uint32_t best_width  = page_size_ + 1;
+    for (size_t i = 0; i < skyline.size(); ++i)
+    {
+        const uint32_t left = skyline[i].x;
+        if (left + width > page_size_)
+            break;
+
+        // The rect rests on the highest segment it spans
+        uint32_t top     = 0;
+        uint32_t spanned = 0;
+        for (size_t j = i; spanned < width; ++j)
+        {
+            top = std::max(top, skyline[j].y);
+            spanned += skyline[j].width;
+        }
+
+        const uint32_t bottom = top + height;
+        if (bottom > page_size_)
+            continue;
+
+        if (bottom < best_bottom || (bottom == best_bottom && skyline[i].width < best_width))
+        {
+            best_index  = i;
+            best_bottom = bottom;
+            best_width  = skyline[i].width;
+            x           = left;
+            y           = top;
+        }
+    }
+
+    if (best_index == skyline.size())
+        return false;
+
+    // Raise the skyline under the rect
+    const SkylineNode node = { x, y + height, width };
+    skyline.insert(skyline.begin() + best_index, node);
+
+    const uint32_t right = node.x + node.width;
+    for (size_t i = best_index + 1; i < skyline.size();)
+    {
+        if (skyline[i].x >= right)
+            break;
+
+        const uint32_t overlap = right - skyline[i].x;
+        if (skyline[i].width <= overlap)
+        {
+            skyline.erase(skyline.begin() + i);
+            continue;
+        }
+
+        skyline[i].x += overlap;
+        skyline[i].width -= overlap;
+        break;
+    }
+
+    // Merge neighbouring segments at the same height
+    for (size_t i = 0; i + 1 < skyline.size();)
+    {
+        if (skyline[i].y == skyline[i + 1].y)
+        {
+            skyline[i].width += skyline[i + 1].width;
+            skyline.erase(skyline.begin() + i + 1);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    return true;
+}
+
+bool TextureAtlas::CreatePage()
+{
+    TexturePtr       texture = MakePtr<Texture>();
+    RenderContextPtr ctx     = RenderContext::Create(*texture, Size(float(page_size_), float(page_size_)));
+    if (!ctx || !texture->IsValid())
+    {
+        Fail("TextureAtlas::CreatePage failed");
+        return false;
+    }
+
+    // Gaps between the images must stay transparent
+    ctx->BeginDraw();
+    ctx->Clear(Color::Transparent);
+    ctx->EndDraw();
+
+    // Only the requested pixel area is used when DPI scaling makes the page larger
+    const PixelSize pixel_size = texture->GetSizeInPixels();
+
+    Page page;
+    page.skyline.push_back({ 0, 0, std::min(pixel_size.x, page_size_) });
+
+    pages_.push_back(std::move(page));
+    textures_.push_back(texture);
+    return true;
+}
+
+bool TextureAtlas::FrameKey::operator==(const FrameKey& rhs) const
+{
+    return texture_id == rhs.texture_id && crop_rect == rhs.crop_rect;
+}
+
+size_t TextureAtlas::FrameKeyHash::operator()(const FrameKey& key) const
+{
+    const std::hash<float> hasher;
+
+    size_t seed = std::hash<uint64_t>()(key.texture_id);
+    for (float value : { key.crop_rect.GetLeft(), key.crop_rect.GetTop(), key.crop_rect.GetRight(),
+                         key.crop_rect.GetBottom() })
+    {
+        seed ^= hasher(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+}
+
+}  // namespace kiwano
@@ -0,0 +1,140 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <kiwano/core/Common.h>
+#include <kiwano/base/ObjectBase.h>
+#include <kiwano/2d/SpriteFrame.h>
+#include <kiwano/2d/animation/FrameSequence.h>
+
+namespace kiwano
+{
+KGE_DECLARE_SMART_PTR(TextureAtlas);
+
+/**
+ * \addtogroup Actors
+ * @{
+ */
+
+/**
+ * \~chinese
+ * @brief 纹理图集
+ * @details 在运行时将零散的纹理或精灵帧打包到若干张共享的图集页中，使用天际线算法寻找放置位置。
+ * 同一图集页上的精灵在渲染时可以合并为一个精灵批次提交
+ */
+class KGE_API TextureAtlas : public ObjectBase
+{
+public:
+    /// \~chinese
+    /// @brief 创建纹理图集
+    /// @param page_size 图集页的像素宽度和高度
+    /// @param padding 相邻图像之间的像素间距，避免线性插值时采样到相邻图像
+    TextureAtlas(uint32_t page_size = 2048, uint32_t padding = 1);
+
+    virtual ~TextureAtlas();
+
+    /// \~chinese
+    /// @brief 将纹理添加到图集
+    /// @param texture 纹理
+    /// @return 图集中的精灵帧，纹理无法放入图集页时返回原纹理的精灵帧
+    SpriteFrame Add(TexturePtr texture);
+
+    /// \~chinese
+    /// @brief 将精灵帧的裁剪区域添加到图集
+    /// @details 同一纹理中相同的裁剪区域只会被添加一次
+    /// @param frame 精灵帧
+    /// @return 图集中的精灵帧，精灵帧无法放入图集页时返回原精灵帧
+    SpriteFrame Add(const SpriteFrame& frame);
+
+    /// \~chinese
+    /// @brief 将序列帧中的所有精灵帧添加到图集，并将序列帧改写为图集中的精灵帧
+    /// @param frames 序列帧
+    void Add(FrameSequence& frames);
+
+    /// \~chinese
+    /// @brief 获取所有图集页
+    const Vector<TexturePtr>& GetPages() const;
+
+    /// \~chinese
+    /// @brief 获取图集页的像素大小
+    uint32_t GetPageSize() const;
+
+    /// \~chinese
+    /// @brief 获取图集页的空间利用率
+    /// @return 已使用的像素面积与所有图集页面积的比值
+    float GetOccupancy() const;
+
+    /// \~chinese
+    /// @brief 清空图集
+    /// @details 已经添加的精灵帧仍然持有图集页，不受影响
+    void Clear();
+
+private:
+    struct SkylineNode
+    {
+        uint32_t x;
+        uint32_t y;
+        uint32_t width;
+    };
+
+    struct Page
+    {
+        Vector<SkylineNode> skyline;
+    };
+
+    struct FrameKey
+    {
+        uint64_t texture_id;
+        Rect     crop_rect;
+
+        bool operator==(const FrameKey& rhs) const;
+    };
+
+    struct FrameKeyHash
+    {
+        size_t operator()(const FrameKey& key) const;
+    };
+
+    bool Insert(Page& page, uint32_t width, uint32_t height, uint32_t& x, uint32_t& y);
+
+    bool CreatePage();
+
+private:
+    uint32_t                                          page_size_;
+    uint32_t                                          padding_;
+    uint64_t                                          used_area_;
+    Vector<Page>                                      pages_;
+    Vector<TexturePtr>                                textures_;
+    UnorderedMap<FrameKey, SpriteFrame, FrameKeyHash> frames_;
+};
+
+/** @} */
+
+inline const Vector<TexturePtr>& TextureAtlas::GetPages() const
+{
+    return textures_;
+}
+
+inline uint32_t TextureAtlas::GetPageSize() const
+{
+    return page_size_;
+}
+
+}  // namespace kiwano
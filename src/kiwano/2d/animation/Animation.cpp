@@ -25,6 +25,8 @@ namespace kiwano
 {
 Animation::Animation()
     : running_(true)
+    , batched_(false)
+    , batch_rejected_(false)
     , detach_target_(false)
     , loops_done_(0)
     , loops_(0)
@@ -36,6 +38,15 @@ Animation::~Animation() {}
 
 void Animation::Init(Actor* target) {}
 
+void Animation::Detach(Actor* target) {}
+
+bool Animation::EnterBatch(Actor* target)
+{
+    return false;
+}
+
+void Animation::LeaveBatch() {}
+
 void Animation::Update(Actor* target, Duration dt)
 {
     Complete(target);
@@ -36,7 +36,7 @@ KGE_DECLARE_SMART_PTR(AnimationEventHandler);
 
 /**
  * \~chinese
- * \defgroup Animation 
+ * \defgroup Animation 动画
  */
 
 /**
@@ -45,59 +45,59 @@ KGE_DECLARE_SMART_PTR(AnimationEventHandler);
  */
 
 /// \~chinese
-/// @brief ¼
+/// @brief 动画事件
 enum class AnimationEvent
 {
-    Started,   ///< ʼ
-    LoopDone,  ///< һѭ
-    Done,      ///< 
+    Started,   ///< 动画开始
+    LoopDone,  ///< 动画一次循环结束
+    Done,      ///< 动画结束
 };
 
 /// \~chinese
-/// @brief ¼
+/// @brief 动画事件处理器
 class KGE_API AnimationEventHandler : public RefObject
 {
 public:
     /// \~chinese
-    /// @brief ¼
-    /// @param anim 
-    /// @param target ִжĶ
-    /// @param evt ¼
+    /// @brief 处理动画事件
+    /// @param anim 动画对象
+    /// @param target 执行动画的对象
+    /// @param evt 动画事件
     virtual void Handle(Animation* anim, Actor* target, AnimationEvent evt) = 0;
 
     /// \~chinese
-    /// @brief ¼
-    /// @param handler ¼ص
+    /// @brief 创建动画事件处理器
+    /// @param handler 处理动画事件回调函数
     static AnimationEventHandlerPtr Create(const Function<void(Animation*, Actor*, AnimationEvent)>& handler);
 
     /// \~chinese
-    /// @brief ¼
-    /// @param evt Ķ¼
-    /// @param handler ¼ص
+    /// @brief 创建动画事件处理器
+    /// @param evt 处理的动画事件
+    /// @param handler 处理动画事件回调函数
     static AnimationEventHandlerPtr Create(AnimationEvent evt, const Function<void(Animation*, Actor*)>& handler);
 
     /// \~chinese
-    /// @brief Started¼
-    /// @param handler ¼ص
+    /// @brief 创建Started动画事件处理器
+    /// @param handler 处理动画事件回调函数
     static AnimationEventHandlerPtr HandleStarted(const Function<void(Animation*, Actor*)>& handler);
 
     /// \~chinese
-    /// @brief LoopDone¼
-    /// @param handler ¼ص
+    /// @brief 创建LoopDone动画事件处理器
+    /// @param handler 处理动画事件回调函数
     static AnimationEventHandlerPtr HandleLoopDone(const Function<void(Animation*, Actor*)>& handler);
 
     /// \~chinese
-    /// @brief Done¼
-    /// @param handler ¼ص
+    /// @brief 创建Done动画事件处理器
+    /// @param handler 处理动画事件回调函数
     static AnimationEventHandlerPtr HandleDone(const Function<void(Animation*, Actor*)>& handler);
 };
 
 /// \~chinese
-/// @brief б
+/// @brief 动画列表
 typedef IntrusiveList<AnimationPtr> AnimationList;
 
 /// \~chinese
-/// @brief 
+/// @brief 动画
 class KGE_API Animation
     : public ObjectBase
     , public Cloneable<Animation>
@@ -113,121 +113,157 @@ public:
     virtual ~Animation();
 
     /// \~chinese
-    /// @brief 
+    /// @brief 继续动画
     void Resume();
 
     /// \~chinese
-    /// @brief ͣ
+    /// @brief 暂停动画
     void Pause();
 
     /// \~chinese
-    /// @brief ֹͣ
+    /// @brief 停止动画
     void Stop();
 
     /// \~chinese
-    /// @brief öʱ
+    /// @brief 设置动画延时
     void SetDelay(Duration delay);
 
     /// \~chinese
-    /// @brief ѭ
-    /// @param loops ѭ-1 Ϊѭ
+    /// @brief 设置循环次数
+    /// @param loops 循环次数，-1 为永久循环
     void SetLoops(int loops);
 
     /// \~chinese
-    /// @brief ʱƳĿɫ
+    /// @brief 动画结束时移除目标角色
     void RemoveTargetWhenDone();
 
     /// \~chinese
-    /// @brief ȡĵת
+    /// @brief 获取动画的倒转
     virtual Animation* Reverse() const = 0;
 
     /// \~chinese
-    /// @brief ȡ״̬
+    /// @brief 获取动画的运行状态
     bool IsRunning() const;
 
     /// \~chinese
-    /// @brief ȡѭ
+    /// @brief 获取动画的循环次数
     int GetLoops() const;
 
     /// \~chinese
-    /// @brief ȡʱ
+    /// @brief 获取动画的延时
     Duration GetDelay() const;
 
     /// \~chinese
-    /// @brief ö¼
+    /// @brief 设置动画事件处理
     void SetHandler(AnimationEventHandlerPtr handler);
 
     /// \~chinese
-    /// @brief ȡ¼
+    /// @brief 获取动画事件处理
     AnimationEventHandlerPtr GetHandler() const;
 
 protected:
     /// \~chinese
-    /// @brief ʼ
+    /// @brief 初始化动画
     virtual void Init(Actor* target);
 
     /// \~chinese
-    /// @brief ¶
+    /// @brief 更新动画
     virtual void Update(Actor* target, Duration dt);
 
     /// \~chinese
-    /// @brief һʱ䲽
+    /// @brief 动画从角色上移除
+    virtual void Detach(Actor* target);
+
+    /// \~chinese
+    /// @brief 尝试将动画交由补间动画批处理器驱动
+    /// @return 动画不支持批处理时返回 false
+    virtual bool EnterBatch(Actor* target);
+
+    /// \~chinese
+    /// @brief 从补间动画批处理器中取回动画
+    virtual void LeaveBatch();
+
+    /// \~chinese
+    /// @brief 更新一个时间步
     void UpdateStep(Actor* target, Duration dt);
 
     /// \~chinese
-    /// @brief ɶ
+    /// @brief 完成动画
     void Complete(Actor* target);
 
     /// \~chinese
-    /// @brief ö
+    /// @brief 重置动画
     void Reset();
 
     /// \~chinese
-    /// @brief ״̬
+    /// @brief 动画状态
     enum class Status
     {
-        NotStarted,  ///< δʼ
-        Delayed,     ///< ȴʱ
-        Started,     ///< ѿʼ
-        Done,        ///< ѽ
-        Removeable   ///< Ƴ
+        NotStarted,  ///< 未开始
+        Delayed,     ///< 等待延时
+        Started,     ///< 已开始
+        Done,        ///< 已结束
+        Removeable   ///< 可移除
     };
 
     /// \~chinese
-    /// @brief ȡ״̬
+    /// @brief 获取动画状态
     Status GetStatus() const;
 
     /// \~chinese
-    /// @brief ȡʱ
+    /// @brief 获取消逝时间
     Duration GetElapsed() const;
 
     /// \~chinese
-    /// @brief ȡɵѭ
+    /// @brief 设置消逝时间
+    void SetElapsed(Duration elapsed);
+
+    /// \~chinese
+    /// @brief 获取完成的循环次数
     int GetLoopsDone() const;
 
     /// \~chinese
-    /// @brief 
+    /// @brief 结束动画
     void Done();
 
     /// \~chinese
-    /// @brief Ƿѽ
+    /// @brief 是否已结束
     bool IsDone() const;
 
     /// \~chinese
-    /// @brief ǷƳ
+    /// @brief 是否可移除
     bool IsRemoveable() const;
 
     /// \~chinese
-    /// @brief ¼
+    /// @brief 是否由补间动画批处理器驱动
+    bool IsBatched() const;
+
+    /// \~chinese
+    /// @brief 设置是否由补间动画批处理器驱动
+    void SetBatched(bool batched);
+
+    /// \~chinese
+    /// @brief 是否已被补间动画批处理器拒绝
+    bool IsBatchRejected() const;
+
+    /// \~chinese
+    /// @brief 设置是否已被补间动画批处理器拒绝
+    /// @details 被拒绝的动画在设置改变前不会再尝试进入批处理
+    void SetBatchRejected(bool rejected);
+
+    /// \~chinese
+    /// @brief 发出动画事件
     void EmitEvent(Actor* target, AnimationEvent evt);
 
     /// \~chinese
-    /// @brief ִп¡
+    /// @brief 执行克隆
     void DoClone(Animation* to) const;
 
 private:
     Status   status_;
     bool     running_;
+    bool     batched_;
+    bool     batch_rejected_;
     bool     detach_target_;
     int      loops_;
     int      loops_done_;
@@ -246,11 +282,15 @@ inline void Animation::Resume()
 
 inline void Animation::Pause()
 {
+    if (batched_)
+        LeaveBatch();
     running_ = false;
 }
 
 inline void Animation::Stop()
 {
+    if (batched_)
+        LeaveBatch();
     Done();
 }
 
@@ -294,6 +334,26 @@ inline bool Animation::IsRemoveable() const
     return status_ == Status::Removeable;
 }
 
+inline bool Animation::IsBatched() const
+{
+    return batched_;
+}
+
+inline void Animation::SetBatched(bool batched)
+{
+    batched_ = batched;
+}
+
+inline bool Animation::IsBatchRejected() const
+{
+    return batch_rejected_;
+}
+
+inline void Animation::SetBatchRejected(bool rejected)
+{
+    batch_rejected_ = rejected;
+}
+
 inline void Animation::EmitEvent(Actor* target, AnimationEvent evt)
 {
     if (handler_)
@@ -327,6 +387,11 @@ inline Duration Animation::GetElapsed() const
     return elapsed_;
 }
 
+inline void Animation::SetElapsed(Duration elapsed)
+{
+    elapsed_ = elapsed;
+}
+
 inline int Animation::GetLoopsDone() const
 {
     return loops_done_;
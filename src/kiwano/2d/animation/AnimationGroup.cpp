@@ -92,6 +92,14 @@ void AnimationGroup::Update(Actor* target, Duration dt)
     }
 }
 
+void AnimationGroup::Detach(Actor* target)
+{
+    for (auto& animation : animations_)
+    {
+        animation->Detach(target);
+    }
+}
+
 void AnimationGroup::AddAnimation(AnimationPtr animation)
 {
     if (animation)
@@ -32,40 +32,40 @@ KGE_DECLARE_SMART_PTR(AnimationGroup);
 
 
 /// \~chinese
-/// @brief 
+/// @brief 动画组合
 class KGE_API AnimationGroup : public Animation
 {
 public:
     AnimationGroup();
 
     /// \~chinese
-    /// @brief 
-    /// @param animations 
-    /// @param parallel ִͬ
+    /// @brief 创建动画组合
+    /// @param animations 动画集合
+    /// @param parallel 同步执行
     AnimationGroup(const Vector<AnimationPtr>& animations, bool parallel = false);
 
     virtual ~AnimationGroup();
 
     /// \~chinese
-    /// @brief Ӷ
-    /// @param animation 
+    /// @brief 添加动画
+    /// @param animation 动画
     void AddAnimation(AnimationPtr animation);
 
     /// \~chinese
-    /// @brief Ӷ
-    /// @param animations 
+    /// @brief 添加多个动画
+    /// @param animations 动画集合
     void AddAnimation(const Vector<AnimationPtr>& animations);
 
     /// \~chinese
-    /// @brief ȡж
+    /// @brief 获取所有动画
     const AnimationList& GetAnimations() const;
 
     /// \~chinese
-    /// @brief ȡöĿ
+    /// @brief 获取该动画的拷贝对象
     AnimationGroup* Clone() const override;
 
     /// \~chinese
-    /// @brief ȡöĵת
+    /// @brief 获取该动画的倒转
     AnimationGroup* Reverse() const override;
 
 protected:
@@ -73,6 +73,8 @@ protected:
 
     void Update(Actor* target, Duration dt) override;
 
+    void Detach(Actor* target) override;
+
 private:
     bool            parallel_;
     AnimationPtr current_;
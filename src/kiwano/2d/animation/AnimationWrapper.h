@@ -36,7 +36,7 @@ namespace kiwano
 {
 
 /// \~chinese
-/// @brief װ
+/// @brief 动画包装器
 class KGE_API AnimationWrapper
 {
 public:
@@ -48,7 +48,7 @@ public:
     }
 
     /// \~chinese
-    /// @brief ѭ
+    /// @brief 设置循环次数
     inline AnimationWrapper& Loops(int loops)
     {
         if (ptr)
@@ -57,7 +57,7 @@ public:
     }
 
     /// \~chinese
-    /// @brief öӳ
+    /// @brief 设置动画延迟
     inline AnimationWrapper& Delay(Duration delay)
     {
         if (ptr)
@@ -66,7 +66,7 @@ public:
     }
 
     /// \~chinese
-    /// @brief öص
+    /// @brief 设置动画结束回调函数
     inline AnimationWrapper& Handler(AnimationEventHandlerPtr handler)
     {
         if (ptr)
@@ -75,7 +75,7 @@ public:
     }
 
     /// \~chinese
-    /// @brief ʱƳĿɫ
+    /// @brief 动画结束时移除目标角色
     inline AnimationWrapper& RemoveTargetWhenDone()
     {
         if (ptr)
@@ -84,7 +84,7 @@ public:
     }
 
     /// \~chinese
-    /// @brief 
+    /// @brief 设置名称
     inline AnimationWrapper& Name(const String& name)
     {
         if (ptr)
@@ -93,7 +93,7 @@ public:
     }
 
     /// \~chinese
-    /// @brief û
+    /// @brief 设置缓动函数
     inline AnimationWrapper& Ease(const EaseFunc& ease)
     {
         auto tween = dynamic_cast<TweenAnimation*>(ptr.Get());
@@ -105,7 +105,7 @@ public:
     }
 
     /// \~chinese
-    /// @brief ¡
+    /// @brief 克隆动画
     inline AnimationWrapper Clone() const
     {
         if (ptr)
@@ -114,7 +114,7 @@ public:
     }
 
     /// \~chinese
-    /// @brief ȡ򶯻
+    /// @brief 获取反向动画
     inline AnimationWrapper Reverse() const
     {
         if (ptr)
@@ -123,14 +123,14 @@ public:
     }
 
     /// \~chinese
-    /// @brief ȡָ
+    /// @brief 获取指针
     inline Animation* Get() const
     {
         return const_cast<Animation*>(ptr.Get());
     }
 
     /// \~chinese
-    /// @brief ö
+    /// @brief 设置动画
     inline void SetEntity(AnimationPtr ptr)
     {
         this->ptr = ptr;
@@ -164,122 +164,122 @@ namespace animation
 {
 
 /// \~chinese
-/// @brief λƶ
-/// @param duration ʱ
-/// @param displacement λ
+/// @brief 创建相对位移动画
+/// @param duration 动画时长
+/// @param displacement 位移向量
 inline AnimationWrapper MoveBy(kiwano::Duration duration, const Vec2& displacement)
 {
     return AnimationWrapper(new MoveByAnimation(duration, displacement));
 }
 
 /// \~chinese
-/// @brief λƶ
-/// @param duration ʱ
-/// @param distination Ŀ
+/// @brief 创建位移动画
+/// @param duration 动画时长
+/// @param distination 目的坐标
 inline AnimationWrapper MoveTo(kiwano::Duration duration, const Point& distination)
 {
     return AnimationWrapper(new MoveToAnimation(duration, distination));
 }
 
 /// \~chinese
-/// @brief Ծ
-/// @param duration ʱ
-/// @param displacement Ծλ
-/// @param height Ծ߶
-/// @param count Ծ
+/// @brief 创建相对跳跃动画
+/// @param duration 动画时长
+/// @param displacement 跳跃位移向量
+/// @param height 跳跃高度
+/// @param count 跳跃次数
 inline AnimationWrapper JumpBy(kiwano::Duration duration, const Vec2& displacement, float height, int count = 1)
 {
     return AnimationWrapper(new JumpByAnimation(duration, displacement, height, count));
 }
 
 /// \~chinese
-/// @brief Ծ
-/// @param duration ʱ
-/// @param distination Ŀ
-/// @param height Ծ߶
-/// @param count Ծ
+/// @brief 创建跳跃动画
+/// @param duration 动画时长
+/// @param distination 目的坐标
+/// @param height 跳跃高度
+/// @param count 跳跃次数
 inline AnimationWrapper JumpTo(kiwano::Duration duration, const Point& distination, float height, int count = 1)
 {
     return AnimationWrapper(new JumpToAnimation(duration, distination, height, count));
 }
 
 /// \~chinese
-/// @brief Ŷ
-/// @param duration ʱ
-/// @param scale Ա仯ֵ
+/// @brief 创建相对缩放动画
+/// @param duration 动画时长
+/// @param scale 缩放相对变化值
 inline AnimationWrapper ScaleBy(kiwano::Duration duration, Vec2 scale)
 {
     return AnimationWrapper(new ScaleByAnimation(duration, scale));
 }
 
 /// \~chinese
-/// @brief Ŷ
-/// @param duration ʱ
-/// @param scale Ŀֵ
+/// @brief 创建缩放动画
+/// @param duration 动画时长
+/// @param scale 缩放目标值
 inline AnimationWrapper ScaleTo(kiwano::Duration duration, Vec2 scale)
 {
     return AnimationWrapper(new ScaleToAnimation(duration, scale));
 }
 
 /// \~chinese
-/// @brief ͸Ƚ䶯
-/// @param duration ʱ
-/// @param opacity Ŀ͸
+/// @brief 创建透明度渐变动画
+/// @param duration 动画时长
+/// @param opacity 目标透明度
 inline AnimationWrapper FadeTo(kiwano::Duration duration, float opacity)
 {
     return AnimationWrapper(new FadeToAnimation(duration, opacity));
 }
 
 /// \~chinese
-/// @brief 붯
-/// @param duration ʱ
+/// @brief 创建淡入动画
+/// @param duration 动画时长
 inline AnimationWrapper FadeIn(kiwano::Duration duration)
 {
     return AnimationWrapper(new FadeToAnimation(duration, 1.0f));
 }
 
 /// \~chinese
-/// @brief 
-/// @param duration ʱ
+/// @brief 创建淡出动画
+/// @param duration 动画时长
 inline AnimationWrapper FadeOut(kiwano::Duration duration)
 {
     return AnimationWrapper(new FadeToAnimation(duration, 0.0f));
 }
 
 /// \~chinese
-/// @brief ת
-/// @param duration ʱ
-/// @param rotation ǶԱ仯ֵ
+/// @brief 创建相对旋转动画
+/// @param duration 动画时长
+/// @param rotation 角度相对变化值
 inline AnimationWrapper RotateBy(kiwano::Duration duration, float rotation)
 {
     return AnimationWrapper(new RotateByAnimation(duration, rotation));
 }
 
 /// \~chinese
-/// @brief ת
-/// @param duration ʱ
-/// @param rotation ĿǶ
+/// @brief 创建旋转动画
+/// @param duration 动画时长
+/// @param rotation 目标角度
 inline AnimationWrapper RotateTo(kiwano::Duration duration, float rotation)
 {
     return AnimationWrapper(new RotateToAnimation(duration, rotation));
 }
 
 /// \~chinese
-/// @brief Զ嶯
-/// @param duration ʱ
-/// @param tween_func ص
+/// @brief 创建自定义动画
+/// @param duration 动画时长
+/// @param tween_func 动画回调函数
 inline AnimationWrapper Custom(kiwano::Duration duration, Function<void(Actor*, float)> tween_func)
 {
     return AnimationWrapper(CustomAnimation::Create(duration, tween_func));
 }
 
 /// \~chinese
-/// @brief ·߶
-/// @param duration ʱ
-/// @param path ·״
-/// @param rotating Ƿ·߷ת
-/// @param start ·㣨ٷֱȣ
-/// @param end ·յ㣨ٷֱȣ
+/// @brief 创建路径行走动画
+/// @param duration 持续时长
+/// @param path 路径形状
+/// @param rotating 是否沿路径切线方向旋转
+/// @param start 路径起点（百分比）
+/// @param end 路径终点（百分比）
 inline AnimationWrapper Path(kiwano::Duration duration, ShapePtr path, bool rotating = false, float start = 0.f,
                              float end = 1.f)
 {
@@ -287,26 +287,26 @@ inline AnimationWrapper Path(kiwano::Duration duration, ShapePtr path, bool rota
 }
 
 /// \~chinese
-/// @brief ʱ
-/// @param delay ʱʱ
+/// @brief 创建延时动画
+/// @param delay 延时时长
 inline AnimationWrapper Delay(kiwano::Duration delay)
 {
     return AnimationWrapper(new DelayAnimation(delay));
 }
 
 /// \~chinese
-/// @brief ֡
-/// @param duration ʱ
-/// @param frame_seq ֡
+/// @brief 创建帧动画
+/// @param duration 动画时长
+/// @param frame_seq 序列帧
 inline AnimationWrapper Frames(kiwano::Duration duration, FrameSequencePtr frame_seq)
 {
     return AnimationWrapper(new FrameAnimation(duration, frame_seq));
 }
 
 /// \~chinese
-/// @brief 
-/// @param actions 
-/// @param parallel ִͬ
+/// @brief 创建动画组合
+/// @param actions 动画集合
+/// @param parallel 同步执行
 inline AnimationWrapper Group(const Vector<AnimationPtr>& animations, bool parallel = false)
 {
     return AnimationWrapper(new AnimationGroup(animations, parallel));
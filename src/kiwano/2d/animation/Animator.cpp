@@ -20,26 +20,69 @@
 
 #include <kiwano/2d/Actor.h>
 #include <kiwano/2d/animation/Animator.h>
+#include <kiwano/2d/animation/TweenBatch.h>
 #include <kiwano/utils/Logger.h>
 
 namespace kiwano
 {
 
+Animator::Animator()
+    : animation_count_(0)
+    , batched_count_(0)
+    , batch_id_(0)
+{
+}
+
+Animator::~Animator()
+{
+    if (animations_.IsEmpty())
+        return;
+
+    // Animations may outlive the target if someone else holds them
+    for (auto& animation : animations_)
+    {
+        animation->Detach(nullptr);
+    }
+}
+
 void Animator::Update(Actor* target, Duration dt)
 {
     if (animations_.IsEmpty() || !target)
         return;
 
+    if (batched_count_)
+    {
+        // Batched tweens are advanced by TweenBatch only in the frames their target is updated
+        TweenBatch::GetInstance().MarkTargetUpdated(batch_id_, dt);
+
+        if (batched_count_ == animation_count_)
+            return;
+    }
+
     AnimationPtr next;
     for (auto animation = animations_.GetFirst(); animation; animation = next)
     {
         next = animation->GetNext();
 
+        if (animation->IsBatched())
+            continue;
+
         if (animation->IsRunning())
             animation->UpdateStep(target, dt);
 
         if (animation->IsRemoveable())
+        {
+            animation->Detach(target);
             animations_.Remove(animation);
+            --animation_count_;
+        }
+        else if (TweenBatch::GetInstance().IsEnabled() && animation->IsRunning() && !animation->IsBatchRejected()
+                 && animation->GetStatus() == Animation::Status::Started)
+        {
+            // Do not try again every frame, the animation can not be batched until its settings change
+            if (!animation->EnterBatch(target))
+                animation->SetBatchRejected(true);
+        }
     }
 }
 
@@ -50,6 +93,7 @@ Animation* Animator::AddAnimation(AnimationPtr animation)
     if (animation)
     {
         animations_.PushBack(animation);
+        ++animation_count_;
     }
     return animation.Get();
 }
@@ -31,48 +31,58 @@ namespace kiwano
 
 /**
  * \~chinese
- * @brief 
+ * @brief 动画调度器
  */
 class KGE_API Animator
 {
+    friend class TweenAnimation;
+    friend class TweenBatch;
+
 public:
+    Animator();
+
+    ~Animator();
+
     /// \~chinese
-    /// @brief Ӷ
+    /// @brief 添加动画
     Animation* AddAnimation(AnimationPtr animation);
 
     /// \~chinese
-    /// @brief ʼ
+    /// @brief 开始动画
     inline Animation* StartAnimation(AnimationPtr animation)
     {
         return AddAnimation(animation);
     }
 
     /// \~chinese
-    /// @brief ͣ
+    /// @brief 继续所有暂停动画
     void ResumeAllAnimations();
 
     /// \~chinese
-    /// @brief ͣж
+    /// @brief 暂停所有动画
     void PauseAllAnimations();
 
     /// \~chinese
-    /// @brief ֹͣж
+    /// @brief 停止所有动画
     void StopAllAnimations();
 
     /// \~chinese
-    /// @brief ȡָƵĶ
-    /// @param name 
+    /// @brief 获取指定名称的动画
+    /// @param name 动画名称
     Animation* GetAnimation(const String& name);
 
     /// \~chinese
-    /// @brief ȡж
+    /// @brief 获取所有动画
     const AnimationList& GetAllAnimations() const;
 
     /// \~chinese
-    /// @brief ¶
+    /// @brief 更新动画
     void Update(Actor* target, Duration dt);
 
 private:
+    uint32_t      animation_count_;
+    uint32_t      batched_count_;
+    uint32_t      batch_id_;
     AnimationList animations_;
 };
 
@@ -31,29 +31,29 @@ KGE_DECLARE_SMART_PTR(CustomAnimation);
  */
 
 /// \~chinese
-/// @brief Զ嶯
+/// @brief 自定义动画
 class KGE_API CustomAnimation : public TweenAnimation
 {
 public:
     /// \~chinese
-    /// @brief Զ嶯
-    /// @param duration ʱ
+    /// @brief 创建自定义动画
+    /// @param duration 动画时长
     CustomAnimation(Duration duration);
 
     /// \~chinese
-    /// @brief Զ嶯
-    /// @param duration ʱ
-    /// @param tween_func ص
+    /// @brief 创建自定义动画
+    /// @param duration 动画时长
+    /// @param tween_func 动画回调函数
     static CustomAnimationPtr Create(Duration duration, Function<void(Actor*, float)> tween_func);
 
     /// \~chinese
-    /// @brief ʱ
-    /// @param target ִжĿ
-    /// @param frac ȣ0.0 - 1.0
+    /// @brief 动画更新时
+    /// @param target 执行动画的目标
+    /// @param frac 动画进度（0.0 - 1.0）
     virtual void OnAnimationUpdate(Actor* target, float frac) = 0;
 
     /// \~chinese
-    /// @brief ȡöĿ
+    /// @brief 获取该动画的拷贝对象
     CustomAnimation* Clone() const override
     {
         KGE_ERRORF("Clone() not supported in CustomAnimation");
@@ -61,7 +61,7 @@ public:
     }
 
     /// \~chinese
-    /// @brief ȡöĵת
+    /// @brief 获取该动画的倒转
     CustomAnimation* Reverse() const override
     {
         KGE_ERRORF("Reverse() not supported in CustomAnimation");
@@ -33,21 +33,21 @@ KGE_DECLARE_SMART_PTR(DelayAnimation);
 
 
 /// \~chinese
-/// @brief ʱ
+/// @brief 延时动画
 class KGE_API DelayAnimation : public Animation
 {
 public:
     /// \~chinese
-    /// @brief ʱ
-    /// @param delay ʱʱ
+    /// @brief 创建延时动画
+    /// @param delay 延时时长
     DelayAnimation(Duration delay);
 
     /// \~chinese
-    /// @brief ȡöĿ
+    /// @brief 获取该动画的拷贝对象
     DelayAnimation* Clone() const override;
 
     /// \~chinese
-    /// @brief ȡöĵת
+    /// @brief 获取该动画的倒转
     DelayAnimation* Reverse() const override;
 };
 
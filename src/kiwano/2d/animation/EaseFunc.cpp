@@ -21,64 +21,245 @@
 #include <kiwano/2d/animation/EaseFunc.h>
 #include <kiwano/math/Math.h>
 
+#if defined(KGE_SIMD_SSE2)
+#include <emmintrin.h>
+#endif
+
 namespace kiwano
 {
 
-inline EaseFunc MakeEaseIn(float rate)
+namespace
 {
-    return std::bind(math::EaseIn, std::placeholders::_1, rate);
-}
-inline EaseFunc MakeEaseOut(float rate)
+
+const float default_ease_rate      = 2.f;
+const float default_elastic_period = 0.3f;
+
+// Polynomial eases share the same shape: In(t) = t^n, Out(t) = 1 - (1 - t)^n, and InOut joins the two halves
+template <int _Exp>
+inline float PowN(float x)
 {
-    return std::bind(math::EaseOut, std::placeholders::_1, rate);
+    return x * PowN<_Exp - 1>(x);
 }
-inline EaseFunc MakeEaseInOut(float rate)
+
+template <>
+inline float PowN<1>(float x)
 {
-    return std::bind(math::EaseInOut, std::placeholders::_1, rate);
+    return x;
 }
-inline EaseFunc MakeEaseElasticIn(float period)
+
+enum class PolynomialMode
+{
+    In,
+    Out,
+    InOut,
+};
+
+template <int _Exp>
+void EvaluatePolynomial(PolynomialMode mode, float* steps, size_t count)
 {
-    return std::bind(math::EaseElasticIn, std::placeholders::_1, period);
+    size_t i = 0;
+
+#if defined(KGE_SIMD_SSE2)
+    const __m128 one  = _mm_set1_ps(1.f);
+    const __m128 half = _mm_set1_ps(.5f);
+    const __m128 two  = _mm_set1_ps(2.f);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 t = _mm_loadu_ps(steps + i);
+        __m128 r;
+        if (mode == PolynomialMode::In)
+        {
+            r = t;
+            for (int n = 1; n < _Exp; ++n)
+                r = _mm_mul_ps(r, t);
+        }
+        else if (mode == PolynomialMode::Out)
+        {
+            __m128 u = _mm_sub_ps(one, t);
+            __m128 p = u;
+            for (int n = 1; n < _Exp; ++n)
+                p = _mm_mul_ps(p, u);
+            r = _mm_sub_ps(one, p);
+        }
+        else
+        {
+            __m128 lo = _mm_mul_ps(two, t);
+            __m128 hi = _mm_sub_ps(two, lo);
+            __m128 pl = lo, ph = hi;
+            for (int n = 1; n < _Exp; ++n)
+            {
+                pl = _mm_mul_ps(pl, lo);
+                ph = _mm_mul_ps(ph, hi);
+            }
+            pl = _mm_mul_ps(half, pl);
+            ph = _mm_sub_ps(one, _mm_mul_ps(half, ph));
+
+            __m128 mask = _mm_cmplt_ps(t, half);
+            r           = _mm_or_ps(_mm_and_ps(mask, pl), _mm_andnot_ps(mask, ph));
+        }
+        _mm_storeu_ps(steps + i, r);
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        float t = steps[i];
+        if (mode == PolynomialMode::In)
+            steps[i] = PowN<_Exp>(t);
+        else if (mode == PolynomialMode::Out)
+            steps[i] = 1.f - PowN<_Exp>(1.f - t);
+        else if (t < .5f)
+            steps[i] = .5f * PowN<_Exp>(2.f * t);
+        else
+            steps[i] = 1.f - .5f * PowN<_Exp>(2.f - 2.f * t);
+    }
 }
-inline EaseFunc MakeEaseElasticOut(float period)
+
+}  // namespace
+
+float EaseFunc::Evaluate(EaseType type, float step)
 {
-    return std::bind(math::EaseElasticOut, std::placeholders::_1, period);
+    switch (type)
+    {
+    case EaseType::Linear:
+        return math::Linear(step);
+    case EaseType::EaseIn:
+        return math::EaseIn(step, default_ease_rate);
+    case EaseType::EaseOut:
+        return math::EaseOut(step, default_ease_rate);
+    case EaseType::EaseInOut:
+        return math::EaseInOut(step, default_ease_rate);
+    case EaseType::ExpoIn:
+        return math::EaseExponentialIn(step);
+    case EaseType::ExpoOut:
+        return math::EaseExponentialOut(step);
+    case EaseType::ExpoInOut:
+        return math::EaseExponentialInOut(step);
+    case EaseType::ElasticIn:
+        return math::EaseElasticIn(step, default_elastic_period);
+    case EaseType::ElasticOut:
+        return math::EaseElasticOut(step, default_elastic_period);
+    case EaseType::ElasticInOut:
+        return math::EaseElasticInOut(step, default_elastic_period);
+    case EaseType::BounceIn:
+        return math::EaseBounceIn(step);
+    case EaseType::BounceOut:
+        return math::EaseBounceOut(step);
+    case EaseType::BounceInOut:
+        return math::EaseBounceInOut(step);
+    case EaseType::BackIn:
+        return math::EaseBackIn(step);
+    case EaseType::BackOut:
+        return math::EaseBackOut(step);
+    case EaseType::BackInOut:
+        return math::EaseBackInOut(step);
+    case EaseType::QuadIn:
+        return math::EaseQuadIn(step);
+    case EaseType::QuadOut:
+        return math::EaseQuadOut(step);
+    case EaseType::QuadInOut:
+        return math::EaseQuadInOut(step);
+    case EaseType::CubicIn:
+        return math::EaseCubicIn(step);
+    case EaseType::CubicOut:
+        return math::EaseCubicOut(step);
+    case EaseType::CubicInOut:
+        return math::EaseCubicInOut(step);
+    case EaseType::QuartIn:
+        return math::EaseQuartIn(step);
+    case EaseType::QuartOut:
+        return math::EaseQuartOut(step);
+    case EaseType::QuartInOut:
+        return math::EaseQuartInOut(step);
+    case EaseType::QuintIn:
+        return math::EaseQuintIn(step);
+    case EaseType::QuintOut:
+        return math::EaseQuintOut(step);
+    case EaseType::QuintInOut:
+        return math::EaseQuintInOut(step);
+    case EaseType::SineIn:
+        return math::EaseSineIn(step);
+    case EaseType::SineOut:
+        return math::EaseSineOut(step);
+    case EaseType::SineInOut:
+        return math::EaseSineInOut(step);
+    default:
+        KGE_ASSERT(false && "Custom ease function cannot be evaluated by type");
+        return step;
+    }
 }
-inline EaseFunc MakeEaseElasticInOut(float period)
+
+void EaseFunc::Evaluate(EaseType type, float* steps, size_t count)
 {
-    return std::bind(math::EaseElasticInOut, std::placeholders::_1, period);
+    switch (type)
+    {
+    case EaseType::Linear:
+        return;
+    case EaseType::EaseIn:
+    case EaseType::QuadIn:
+        return EvaluatePolynomial<2>(PolynomialMode::In, steps, count);
+    case EaseType::QuadOut:
+        return EvaluatePolynomial<2>(PolynomialMode::Out, steps, count);
+    case EaseType::EaseInOut:
+    case EaseType::QuadInOut:
+        return EvaluatePolynomial<2>(PolynomialMode::InOut, steps, count);
+    case EaseType::CubicIn:
+        return EvaluatePolynomial<3>(PolynomialMode::In, steps, count);
+    case EaseType::CubicOut:
+        return EvaluatePolynomial<3>(PolynomialMode::Out, steps, count);
+    case EaseType::CubicInOut:
+        return EvaluatePolynomial<3>(PolynomialMode::InOut, steps, count);
+    case EaseType::QuartIn:
+        return EvaluatePolynomial<4>(PolynomialMode::In, steps, count);
+    case EaseType::QuartOut:
+        return EvaluatePolynomial<4>(PolynomialMode::Out, steps, count);
+    case EaseType::QuartInOut:
+        return EvaluatePolynomial<4>(PolynomialMode::InOut, steps, count);
+    case EaseType::QuintIn:
+        return EvaluatePolynomial<5>(PolynomialMode::In, steps, count);
+    case EaseType::QuintOut:
+        return EvaluatePolynomial<5>(PolynomialMode::Out, steps, count);
+    case EaseType::QuintInOut:
+        return EvaluatePolynomial<5>(PolynomialMode::InOut, steps, count);
+    default:
+        break;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+        steps[i] = Evaluate(type, steps[i]);
 }
 
-KGE_API EaseFunc Ease::Linear       = math::Linear;
-KGE_API EaseFunc Ease::EaseIn       = MakeEaseIn(2.f);
-KGE_API EaseFunc Ease::EaseOut      = MakeEaseOut(2.f);
-KGE_API EaseFunc Ease::EaseInOut    = MakeEaseInOut(2.f);
-KGE_API EaseFunc Ease::ExpoIn       = math::EaseExponentialIn;
-KGE_API EaseFunc Ease::ExpoOut      = math::EaseExponentialOut;
-KGE_API EaseFunc Ease::ExpoInOut    = math::EaseExponentialInOut;
-KGE_API EaseFunc Ease::BounceIn     = math::EaseBounceIn;
-KGE_API EaseFunc Ease::BounceOut    = math::EaseBounceOut;
-KGE_API EaseFunc Ease::BounceInOut  = math::EaseBounceInOut;
-KGE_API EaseFunc Ease::ElasticIn    = MakeEaseElasticIn(0.3f);
-KGE_API EaseFunc Ease::ElasticOut   = MakeEaseElasticOut(0.3f);
-KGE_API EaseFunc Ease::ElasticInOut = MakeEaseElasticInOut(0.3f);
-KGE_API EaseFunc Ease::SineIn       = math::EaseSineIn;
-KGE_API EaseFunc Ease::SineOut      = math::EaseSineOut;
-KGE_API EaseFunc Ease::SineInOut    = math::EaseSineInOut;
-KGE_API EaseFunc Ease::BackIn       = math::EaseBackIn;
-KGE_API EaseFunc Ease::BackOut      = math::EaseBackOut;
-KGE_API EaseFunc Ease::BackInOut    = math::EaseBackInOut;
-KGE_API EaseFunc Ease::QuadIn       = math::EaseQuadIn;
-KGE_API EaseFunc Ease::QuadOut      = math::EaseQuadOut;
-KGE_API EaseFunc Ease::QuadInOut    = math::EaseQuadInOut;
-KGE_API EaseFunc Ease::CubicIn      = math::EaseCubicIn;
-KGE_API EaseFunc Ease::CubicOut     = math::EaseCubicOut;
-KGE_API EaseFunc Ease::CubicInOut   = math::EaseCubicInOut;
-KGE_API EaseFunc Ease::QuartIn      = math::EaseQuartIn;
-KGE_API EaseFunc Ease::QuartOut     = math::EaseQuartOut;
-KGE_API EaseFunc Ease::QuartInOut   = math::EaseQuartInOut;
-KGE_API EaseFunc Ease::QuintIn      = math::EaseQuintIn;
-KGE_API EaseFunc Ease::QuintOut     = math::EaseQuintOut;
-KGE_API EaseFunc Ease::QuintInOut   = math::EaseQuintInOut;
+KGE_API EaseFunc Ease::Linear       = EaseType::Linear;
+KGE_API EaseFunc Ease::EaseIn       = EaseType::EaseIn;
+KGE_API EaseFunc Ease::EaseOut      = EaseType::EaseOut;
+KGE_API EaseFunc Ease::EaseInOut    = EaseType::EaseInOut;
+KGE_API EaseFunc Ease::ExpoIn       = EaseType::ExpoIn;
+KGE_API EaseFunc Ease::ExpoOut      = EaseType::ExpoOut;
+KGE_API EaseFunc Ease::ExpoInOut    = EaseType::ExpoInOut;
+KGE_API EaseFunc Ease::BounceIn     = EaseType::BounceIn;
+KGE_API EaseFunc Ease::BounceOut    = EaseType::BounceOut;
+KGE_API EaseFunc Ease::BounceInOut  = EaseType::BounceInOut;
+KGE_API EaseFunc Ease::ElasticIn    = EaseType::ElasticIn;
+KGE_API EaseFunc Ease::ElasticOut   = EaseType::ElasticOut;
+KGE_API EaseFunc Ease::ElasticInOut = EaseType::ElasticInOut;
+KGE_API EaseFunc Ease::SineIn       = EaseType::SineIn;
+KGE_API EaseFunc Ease::SineOut      = EaseType::SineOut;
+KGE_API EaseFunc Ease::SineInOut    = EaseType::SineInOut;
+KGE_API EaseFunc Ease::BackIn       = EaseType::BackIn;
+KGE_API EaseFunc Ease::BackOut      = EaseType::BackOut;
+KGE_API EaseFunc Ease::BackInOut    = EaseType::BackInOut;
+KGE_API EaseFunc Ease::QuadIn       = EaseType::QuadIn;
+KGE_API EaseFunc Ease::QuadOut      = EaseType::QuadOut;
+KGE_API EaseFunc Ease::QuadInOut    = EaseType::QuadInOut;
+KGE_API EaseFunc Ease::CubicIn      = EaseType::CubicIn;
+KGE_API EaseFunc Ease::CubicOut     = EaseType::CubicOut;
+KGE_API EaseFunc Ease::CubicInOut   = EaseType::CubicInOut;
+KGE_API EaseFunc Ease::QuartIn      = EaseType::QuartIn;
+KGE_API EaseFunc Ease::QuartOut     = EaseType::QuartOut;
+KGE_API EaseFunc Ease::QuartInOut   = EaseType::QuartInOut;
+KGE_API EaseFunc Ease::QuintIn      = EaseType::QuintIn;
+KGE_API EaseFunc Ease::QuintOut     = EaseType::QuintOut;
+KGE_API EaseFunc Ease::QuintInOut   = EaseType::QuintInOut;
 
 }
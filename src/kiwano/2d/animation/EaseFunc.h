@@ -25,27 +25,112 @@ namespace kiwano
 {
 
 /// \~chinese
-/// @brief 
-using EaseFunc = Function<float(float)>;
+/// @brief 缓动函数类型
+enum class EaseType : uint8_t
+{
+    Linear,
+    EaseIn,
+    EaseOut,
+    EaseInOut,
+    ExpoIn,
+    ExpoOut,
+    ExpoInOut,
+    ElasticIn,
+    ElasticOut,
+    ElasticInOut,
+    BounceIn,
+    BounceOut,
+    BounceInOut,
+    BackIn,
+    BackOut,
+    BackInOut,
+    QuadIn,
+    QuadOut,
+    QuadInOut,
+    CubicIn,
+    CubicOut,
+    CubicInOut,
+    QuartIn,
+    QuartOut,
+    QuartInOut,
+    QuintIn,
+    QuintOut,
+    QuintInOut,
+    SineIn,
+    SineOut,
+    SineInOut,
+    Custom,  ///< 自定义缓动函数
+};
 
 /// \~chinese
-/// @brief ö
-/// @details 鿴 https://easings.net ȡϢ
+/// @brief 缓动函数
+/// @details 内置的缓动函数通过类型分派计算，自定义缓动函数通过函数对象计算
+class KGE_API EaseFunc
+{
+public:
+    EaseFunc();
+
+    EaseFunc(std::nullptr_t);
+
+    /// \~chinese
+    /// @brief 创建内置缓动函数
+    EaseFunc(EaseType type);
+
+    /// \~chinese
+    /// @brief 创建自定义缓动函数
+    template <typename _Func, typename _Ty = typename std::decay<_Func>::type,
+              typename = typename std::enable_if<!std::is_same<_Ty, EaseFunc>::value && !std::is_same<_Ty, EaseType>::value
+                                                 && !std::is_same<_Ty, std::nullptr_t>::value>::type>
+    EaseFunc(_Func&& func)
+        : type_(EaseType::Custom)
+        , func_(std::forward<_Func>(func))
+    {
+    }
+
+    /// \~chinese
+    /// @brief 获取缓动函数类型
+    EaseType GetType() const;
+
+    /// \~chinese
+    /// @brief 计算缓动值
+    float operator()(float step) const;
+
+    explicit operator bool() const;
+
+    /// \~chinese
+    /// @brief 计算内置缓动函数的值
+    static float Evaluate(EaseType type, float step);
+
+    /// \~chinese
+    /// @brief 批量计算内置缓动函数的值
+    /// @param type 缓动函数类型，不能为自定义类型
+    /// @param[in,out] steps 输入进度，输出缓动值
+    /// @param count 数量
+    static void Evaluate(EaseType type, float* steps, size_t count);
+
+private:
+    EaseType               type_;
+    Function<float(float)> func_;
+};
+
+/// \~chinese
+/// @brief 缓动函数枚举
+/// @details 查看 https://easings.net 获取更多信息
 struct Ease
 {
-    static KGE_API EaseFunc Linear;        ///< 
-    static KGE_API EaseFunc EaseIn;        ///< 
-    static KGE_API EaseFunc EaseOut;       ///< ɿ
-    static KGE_API EaseFunc EaseInOut;     ///< , ɿ
-    static KGE_API EaseFunc ExpoIn;        ///< 伫
-    static KGE_API EaseFunc ExpoOut;       ///< ɼ
-    static KGE_API EaseFunc ExpoInOut;     ///< , ɼ
-    static KGE_API EaseFunc ElasticIn;     ///< 㸳赯
-    static KGE_API EaseFunc ElasticOut;    ///< յ㸳赯
-    static KGE_API EaseFunc ElasticInOut;  ///< յ㸳赯
-    static KGE_API EaseFunc BounceIn;      ///< 㸳跴
-    static KGE_API EaseFunc BounceOut;     ///< յ㸳跴
-    static KGE_API EaseFunc BounceInOut;   ///< յ㸳跴
+    static KGE_API EaseFunc Linear;        ///< 线性
+    static KGE_API EaseFunc EaseIn;        ///< 由慢变快
+    static KGE_API EaseFunc EaseOut;       ///< 由快变慢
+    static KGE_API EaseFunc EaseInOut;     ///< 由慢变快, 再由快变慢
+    static KGE_API EaseFunc ExpoIn;        ///< 由慢变极快
+    static KGE_API EaseFunc ExpoOut;       ///< 由极快变慢
+    static KGE_API EaseFunc ExpoInOut;     ///< 由慢至极快, 再由极快边慢
+    static KGE_API EaseFunc ElasticIn;     ///< 自起点赋予弹性
+    static KGE_API EaseFunc ElasticOut;    ///< 自终点赋予弹性
+    static KGE_API EaseFunc ElasticInOut;  ///< 再起点和终点赋予弹性
+    static KGE_API EaseFunc BounceIn;      ///< 自起点赋予反弹力
+    static KGE_API EaseFunc BounceOut;     ///< 自终点赋予反弹力
+    static KGE_API EaseFunc BounceInOut;   ///< 在起点和终点赋予反弹力
     static KGE_API EaseFunc BackIn;
     static KGE_API EaseFunc BackOut;
     static KGE_API EaseFunc BackInOut;
@@ -66,4 +151,36 @@ struct Ease
     static KGE_API EaseFunc SineInOut;
 };
 
+inline EaseFunc::EaseFunc()
+    : type_(EaseType::Custom)
+{
+}
+
+inline EaseFunc::EaseFunc(std::nullptr_t)
+    : type_(EaseType::Custom)
+{
+}
+
+inline EaseFunc::EaseFunc(EaseType type)
+    : type_(type)
+{
+}
+
+inline EaseType EaseFunc::GetType() const
+{
+    return type_;
+}
+
+inline float EaseFunc::operator()(float step) const
+{
+    if (type_ != EaseType::Custom)
+        return Evaluate(type_, step);
+    return func_(step);
+}
+
+inline EaseFunc::operator bool() const
+{
+    return type_ != EaseType::Custom || bool(func_);
+}
+
 }
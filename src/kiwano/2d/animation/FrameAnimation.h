@@ -33,35 +33,35 @@ KGE_DECLARE_SMART_PTR(FrameAnimation);
  */
 
 /// \~chinese
-/// @brief ֡
+/// @brief 帧动画
 class KGE_API FrameAnimation : public TweenAnimation
 {
 public:
     FrameAnimation();
 
     /// \~chinese
-    /// @brief ֡
-    /// @param dur ʱ
-    /// @param frame_seq ֡
+    /// @brief 创建帧动画
+    /// @param dur 动画时长
+    /// @param frame_seq 序列帧
     FrameAnimation(Duration dur, FrameSequencePtr frame_seq);
 
     virtual ~FrameAnimation();
 
     /// \~chinese
-    /// @brief ȡ֡
+    /// @brief 获取序列帧
     FrameSequencePtr GetFrameSequence() const;
 
     /// \~chinese
-    /// @brief ֡
-    /// @param[in] frame_seq ֡
+    /// @brief 设置序列帧
+    /// @param[in] frame_seq 序列帧
     void SetFrameSequence(FrameSequencePtr frame_seq);
 
     /// \~chinese
-    /// @brief ȡöĿ
+    /// @brief 获取该动画的拷贝对象
     FrameAnimation* Clone() const override;
 
     /// \~chinese
-    /// @brief ȡöĵת
+    /// @brief 获取该动画的倒转
     FrameAnimation* Reverse() const override;
 
 protected:
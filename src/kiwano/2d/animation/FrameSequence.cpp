@@ -57,6 +57,12 @@ void FrameSequence::AddFrames(const Vector<SpriteFrame>& frames)
     }
 }
 
+void FrameSequence::SetFrame(size_t index, const SpriteFrame& frame)
+{
+    KGE_ASSERT(index < frames_.size());
+    frames_[index] = frame;
+}
+
 const SpriteFrame& FrameSequence::GetFrame(size_t index) const
 {
     KGE_ASSERT(index < frames_.size());
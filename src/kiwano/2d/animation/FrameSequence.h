@@ -29,51 +29,57 @@ KGE_DECLARE_SMART_PTR(FrameSequence);
 
 /**
  * \~chinese
- * @brief ֡
+ * @brief 序列帧
  */
 class KGE_API FrameSequence : public ObjectBase
 {
 public:
     /// \~chinese
-    /// @brief ֡
-    /// @param frames ֡
+    /// @brief 创建序列帧
+    /// @param frames 精灵帧集合
     FrameSequence(const Vector<SpriteFrame>& frames);
 
     /// \~chinese
-    /// @brief ֡
+    /// @brief 构建空序列帧
     FrameSequence();
 
     virtual ~FrameSequence();
 
     /// \~chinese
-    /// @brief Ӿ֡
-    /// @param frame ֡
+    /// @brief 添加精灵帧
+    /// @param frame 精灵帧
     void AddFrame(const SpriteFrame& frame);
 
     /// \~chinese
-    /// @brief Ӷ֡
-    /// @param frames ֡
+    /// @brief 添加多个精灵帧
+    /// @param frames 精灵帧集合
     void AddFrames(const Vector<SpriteFrame>& frames);
 
     /// \~chinese
-    /// @brief ȡ֡
-    /// @param index ֡±
+    /// @brief 替换精灵帧
+    /// @param index 精灵帧下标
+    /// @param frame 精灵帧
+    void SetFrame(size_t index, const SpriteFrame& frame);
+
+    /// \~chinese
+    /// @brief 获取精灵帧
+    /// @param index 精灵帧下标
     const SpriteFrame& GetFrame(size_t index) const;
 
     /// \~chinese
-    /// @brief ȡо֡
+    /// @brief 获取所有精灵帧
     const Vector<SpriteFrame>& GetFrames() const;
 
     /// \~chinese
-    /// @brief ȡ֡
+    /// @brief 获取精灵帧数量
     size_t GetFramesCount() const;
 
     /// \~chinese
-    /// @brief ȡ֡Ŀ
+    /// @brief 获取序列帧的拷贝对象
     FrameSequencePtr Clone() const;
 
     /// \~chinese
-    /// @brief ȡ֡ĵת
+    /// @brief 获取序列帧的倒转
     FrameSequencePtr Reverse() const;
 
 private:
@@ -30,6 +30,7 @@ PathAnimation::PathAnimation(Duration duration, ShapePtr path, bool rotating, fl
     , end_(end)
     , rotating_(rotating)
     , length_(0.f)
+    , tolerance_(ArcLengthTable::DEFAULT_TOLERANCE)
     , path_(path)
 {
 }
@@ -37,6 +38,7 @@ PathAnimation::PathAnimation(Duration duration, ShapePtr path, bool rotating, fl
 PathAnimation* PathAnimation::Clone() const
 {
     PathAnimation* ptr = new PathAnimation(GetDuration(), path_, rotating_, start_, end_);
+    ptr->SetTolerance(tolerance_);
     DoClone(ptr);
     return ptr;
 }
@@ -44,20 +46,22 @@ PathAnimation* PathAnimation::Clone() const
 PathAnimation* PathAnimation::Reverse() const
 {
     PathAnimation* ptr = new PathAnimation(GetDuration(), path_, rotating_, end_, start_);
+    ptr->SetTolerance(tolerance_);
     DoClone(ptr);
     return ptr;
 }
 
 void PathAnimation::Init(Actor* target)
 {
-    if (!path_ || !path_->IsValid())
+    table_ = (path_ && path_->IsValid()) ? path_->GetArcLengthTable(tolerance_) : nullptr;
+    if (!table_ || table_->IsEmpty())
     {
         Done();
         return;
     }
 
     start_pos_ = target->GetPosition();
-    length_    = path_->GetLength();
+    length_    = table_->GetLength();
 }
 
 void PathAnimation::UpdateTween(Actor* target, float percent)
@@ -65,7 +69,7 @@ void PathAnimation::UpdateTween(Actor* target, float percent)
     float distance = length_ * std::min(std::max((end_ - start_) * percent + start_, 0.f), 1.f);
 
     Point point, tangent;
-    if (path_->ComputePointAtLength(distance, point, tangent))
+    if (table_->ComputePointAtLength(distance, point, tangent))
     {
         target->SetPosition(start_pos_ + point);
 
@@ -33,57 +33,66 @@ KGE_DECLARE_SMART_PTR(PathAnimation);
 
 
 /// \~chinese
-/// @brief ·߶
+/// @brief 路径行走动画
 class KGE_API PathAnimation : public TweenAnimation
 {
 public:
     /// \~chinese
-    /// @brief ·߶
-    /// @param duration ʱ
-    /// @param path ·״
-    /// @param rotating Ƿ·߷ת
-    /// @param start ·㣨ٷֱȣ
-    /// @param end ·յ㣨ٷֱȣ
+    /// @brief 创建路径行走动画
+    /// @param duration 持续时长
+    /// @param path 路径形状
+    /// @param rotating 是否沿路径切线方向旋转
+    /// @param start 路径起点（百分比）
+    /// @param end 路径终点（百分比）
     PathAnimation(Duration duration, ShapePtr path, bool rotating = false, float start = 0.f, float end = 1.f);
 
     /// \~chinese
-    /// @brief ȡ·
+    /// @brief 获取路线
     ShapePtr GetPath() const;
 
     /// \~chinese
-    /// @brief Ƿ·߷ת
+    /// @brief 是否沿路径切线方向旋转
     bool IsRotating() const;
 
     /// \~chinese
-    /// @brief ȡ·㣨ٷֱȣ
+    /// @brief 获取路径起点（百分比）
     float GetStartValue() const;
 
     /// \~chinese
-    /// @brief ȡ·յ㣨ٷֱȣ
+    /// @brief 获取路径终点（百分比）
     float GetEndValue() const;
 
     /// \~chinese
-    /// @brief ·״
+    /// @brief 获取路径扁平化容差
+    float GetTolerance() const;
+
+    /// \~chinese
+    /// @brief 设置路径形状
     void SetPath(ShapePtr path);
 
     /// \~chinese
-    /// @brief ·߷ת
+    /// @brief 设置沿路径切线方向旋转
     void SetRotating(bool rotating);
 
     /// \~chinese
-    /// @brief ·㣨ٷֱȣ
+    /// @brief 设置路径起点（百分比）
     void SetStartValue(float start);
 
     /// \~chinese
-    /// @brief ·յ㣨ٷֱȣ
+    /// @brief 设置路径终点（百分比）
     void SetEndValue(float end);
 
     /// \~chinese
-    /// @brief ȡöĿ
+    /// @brief 设置路径扁平化容差
+    /// @details 动画开始时按该容差获取路径的弧长查找表，使用同一路径的动画共享查找表
+    void SetTolerance(float tolerance);
+
+    /// \~chinese
+    /// @brief 获取该动画的拷贝对象
     PathAnimation* Clone() const override;
 
     /// \~chinese
-    /// @brief ȡöĵת
+    /// @brief 获取该动画的倒转
     PathAnimation* Reverse() const override;
 
 protected:
@@ -92,12 +101,14 @@ protected:
     void UpdateTween(Actor* target, float percent) override;
 
 private:
-    bool     rotating_;
-    float    start_;
-    float    end_;
-    float    length_;
-    Point    start_pos_;
-    ShapePtr path_;
+    bool              rotating_;
+    float             start_;
+    float             end_;
+    float             length_;
+    float             tolerance_;
+    Point             start_pos_;
+    ShapePtr          path_;
+    ArcLengthTablePtr table_;
 };
 
 /** @} */
@@ -122,6 +133,11 @@ inline float PathAnimation::GetEndValue() const
     return end_;
 }
 
+inline float PathAnimation::GetTolerance() const
+{
+    return tolerance_;
+}
+
 inline void PathAnimation::SetPath(ShapePtr path)
 {
     path_ = path;
@@ -142,4 +158,9 @@ inline void PathAnimation::SetEndValue(float end)
     end_ = end;
 }
 
+inline void PathAnimation::SetTolerance(float tolerance)
+{
+    tolerance_ = tolerance;
+}
+
 }  // namespace kiwano
@@ -31,15 +31,24 @@ namespace kiwano
 TweenAnimation::TweenAnimation()
     : dur_()
     , ease_func_(nullptr)
+    , batch_channel_(0)
+    , batch_index_(0)
 {
 }
 
 TweenAnimation::TweenAnimation(Duration duration)
     : dur_(duration)
     , ease_func_(nullptr)
+    , batch_channel_(0)
+    , batch_index_(0)
 {
 }
 
+TweenAnimation::~TweenAnimation()
+{
+    LeaveBatch();
+}
+
 float TweenAnimation::Interpolate(float frac)
 {
     if (frac == 1)
@@ -76,6 +85,80 @@ void TweenAnimation::Update(Actor* target, Duration dt)
     UpdateTween(target, frac);
 }
 
+void TweenAnimation::Detach(Actor* target)
+{
+    LeaveBatch();
+}
+
+bool TweenAnimation::EnterBatch(Actor* target)
+{
+    auto& batch = TweenBatch::GetInstance();
+
+    const EaseType ease = ease_func_ ? ease_func_.GetType() : EaseType::Linear;
+    if (!batch.IsEnabled() || ease == EaseType::Custom || dur_.IsZero())
+        return false;
+
+    TweenBatch::Params params;
+    if (!GetTweenParams(params))
+        return false;
+
+    // Elapsed time in the current loop
+    const Duration elapsed = GetElapsed() - GetDelay() - dur_ * GetLoopsDone();
+
+    if (target->batched_count_++ == 0)
+        target->batch_id_ = batch.AcquireTarget();
+
+    batch.AddTween(this, target, params, ease, float(elapsed.GetMilliseconds()), float(dur_.GetMilliseconds()));
+    SetBatched(true);
+    return true;
+}
+
+void TweenAnimation::LeaveBatch()
+{
+    if (!IsBatched())
+        return;
+
+    auto& batch = TweenBatch::GetInstance();
+
+    TweenBatch::Params params;
+    float              elapsed = 0;
+    Actor*             target  = nullptr;
+    batch.RemoveTween(this, params, elapsed, target);
+
+    SetTweenParams(params);
+    SetElapsed(GetDelay() + dur_ * GetLoopsDone() + Duration(static_cast<int64_t>(elapsed)));
+    SetBatched(false);
+
+    if (--target->batched_count_ == 0)
+        batch.ReleaseTarget(target->batch_id_);
+}
+
+void TweenAnimation::StepOutOfBatch(Actor* target, float dt)
+{
+    if (!IsBatched())
+        return;
+
+    // Let the animation finish the loop and emit events by itself
+    LeaveBatch();
+    UpdateStep(target, Duration(static_cast<int64_t>(dt)));
+
+    if (IsRemoveable())
+    {
+        // Remove it now, the target may not be updated any more, e.g. it has been removed from the stage
+        AnimationPtr self = this;
+        Detach(target);
+        target->animations_.Remove(self);
+        --target->animation_count_;
+    }
+}
+
+bool TweenAnimation::GetTweenParams(TweenBatch::Params& params) const
+{
+    return false;
+}
+
+void TweenAnimation::SetTweenParams(const TweenBatch::Params& params) {}
+
 void TweenAnimation::DoClone(TweenAnimation* to) const
 {
     if (to)
@@ -115,6 +198,21 @@ void MoveByAnimation::UpdateTween(Actor* target, float frac)
     prev_pos_ = new_pos;
 }
 
+bool MoveByAnimation::GetTweenParams(TweenBatch::Params& params) const
+{
+    params.prop  = TweenBatch::Property::Position;
+    params.start = start_pos_;
+    params.delta = displacement_;
+    params.prev  = prev_pos_;
+    return true;
+}
+
+void MoveByAnimation::SetTweenParams(const TweenBatch::Params& params)
+{
+    start_pos_ = params.start;
+    prev_pos_  = params.prev;
+}
+
 MoveByAnimation* MoveByAnimation::Clone() const
 {
     MoveByAnimation* ptr = new MoveByAnimation(GetDuration(), displacement_);
@@ -241,6 +339,14 @@ void ScaleByAnimation::UpdateTween(Actor* target, float frac)
     target->SetScale(Vec2{ start_val_.x + delta_.x * frac, start_val_.y + delta_.y * frac });
 }
 
+bool ScaleByAnimation::GetTweenParams(TweenBatch::Params& params) const
+{
+    params.prop  = TweenBatch::Property::Scale;
+    params.start = start_val_;
+    params.delta = delta_;
+    return true;
+}
+
 ScaleByAnimation* ScaleByAnimation::Clone() const
 {
     ScaleByAnimation* ptr = new ScaleByAnimation(GetDuration(), delta_);
@@ -300,6 +406,14 @@ void FadeToAnimation::UpdateTween(Actor* target, float frac)
     target->SetOpacity(start_val_ + delta_val_ * frac);
 }
 
+bool FadeToAnimation::GetTweenParams(TweenBatch::Params& params) const
+{
+    params.prop  = TweenBatch::Property::Opacity;
+    params.start = Vec2(start_val_, 0);
+    params.delta = Vec2(delta_val_, 0);
+    return true;
+}
+
 FadeToAnimation* FadeToAnimation::Clone() const
 {
     FadeToAnimation* ptr = new FadeToAnimation(GetDuration(), end_val_);
@@ -335,6 +449,14 @@ void RotateByAnimation::UpdateTween(Actor* target, float frac)
     target->SetRotation(rotation);
 }
 
+bool RotateByAnimation::GetTweenParams(TweenBatch::Params& params) const
+{
+    params.prop  = TweenBatch::Property::Rotation;
+    params.start = Vec2(start_val_, 0);
+    params.delta = Vec2(delta_val_, 0);
+    return true;
+}
+
 RotateByAnimation* RotateByAnimation::Clone() const
 {
     RotateByAnimation* ptr = new RotateByAnimation(GetDuration(), delta_val_);
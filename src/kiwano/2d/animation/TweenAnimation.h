@@ -21,6 +21,7 @@
 #pragma once
 #include <kiwano/2d/animation/Animation.h>
 #include <kiwano/2d/animation/EaseFunc.h>
+#include <kiwano/2d/animation/TweenBatch.h>
 #include <kiwano/utils/Logger.h>
 
 namespace kiwano
@@ -43,26 +44,28 @@ KGE_DECLARE_SMART_PTR(RotateToAnimation);
  */
 
 /// \~chinese
-/// @brief 䶯
+/// @brief 补间动画
 class KGE_API TweenAnimation : public Animation
 {
 public:
     /// \~chinese
-    /// @brief ȡʱ
+    /// @brief 获取动画时长
     Duration GetDuration() const;
 
     /// \~chinese
-    /// @brief öʱ
+    /// @brief 设置动画时长
     void SetDuration(Duration duration);
 
     /// \~chinese
-    /// @brief ȡٶȻ
+    /// @brief 获取动画速度缓动函数
     const EaseFunc& GetEaseFunc() const;
 
     /// \~chinese
-    /// @brief öٶȻ
+    /// @brief 设置动画速度缓动函数
     void SetEaseFunc(const EaseFunc& func);
 
+    virtual ~TweenAnimation();
+
 protected:
     TweenAnimation();
 
@@ -72,41 +75,63 @@ protected:
 
     void Update(Actor* target, Duration dt) override;
 
+    void Detach(Actor* target) override;
+
+    bool EnterBatch(Actor* target) override;
+
+    void LeaveBatch() override;
+
     virtual void UpdateTween(Actor* target, float frac) = 0;
 
+    /// \~chinese
+    /// @brief 获取批处理所需的补间参数
+    /// @return 不支持批处理时返回 false
+    virtual bool GetTweenParams(TweenBatch::Params& params) const;
+
+    /// \~chinese
+    /// @brief 从批处理器取回动画时同步补间参数
+    virtual void SetTweenParams(const TweenBatch::Params& params);
+
     void DoClone(TweenAnimation* to) const;
 
+private:
+    friend class TweenBatch;
+
+    void StepOutOfBatch(Actor* target, float dt);
+
 private:
     Duration dur_;
     EaseFunc ease_func_;
+    uint32_t batch_channel_;
+    uint32_t batch_index_;
 };
 
 
 /// \~chinese
-/// @brief λƶ
+/// @brief 相对位移动画
 class KGE_API MoveByAnimation : public TweenAnimation
 {
 public:
     /// \~chinese
-    /// @brief λƶ
-    /// @param duration ʱ
-    /// @param displacement λ
+    /// @brief 创建相对位移动画
+    /// @param duration 动画时长
+    /// @param displacement 位移向量
     MoveByAnimation(Duration duration, const Vec2& displacement);
 
     /// \~chinese
-    /// @brief ȡλ
+    /// @brief 获取位移向量
     Vec2 GetDisplacement() const;
 
     /// \~chinese
-    /// @brief λ
+    /// @brief 设置位移向量
     void SetDisplacement(const Vec2& displacement);
 
     /// \~chinese
-    /// @brief ȡöĿ
+    /// @brief 获取该动画的拷贝对象
     MoveByAnimation* Clone() const override;
 
     /// \~chinese
-    /// @brief ȡöĵת
+    /// @brief 获取该动画的倒转
     MoveByAnimation* Reverse() const override;
 
 protected:
@@ -114,6 +139,10 @@ protected:
 
     void UpdateTween(Actor* target, float frac) override;
 
+    bool GetTweenParams(TweenBatch::Params& params) const override;
+
+    void SetTweenParams(const TweenBatch::Params& params) override;
+
 protected:
     Point start_pos_;
     Point prev_pos_;
@@ -122,30 +151,30 @@ protected:
 
 
 /// \~chinese
-/// @brief λƶ
+/// @brief 位移动画
 class KGE_API MoveToAnimation : public MoveByAnimation
 {
 public:
     /// \~chinese
-    /// @brief λƶ
-    /// @param duration ʱ
-    /// @param distination Ŀ
+    /// @brief 创建位移动画
+    /// @param duration 动画时长
+    /// @param distination 目的坐标
     MoveToAnimation(Duration duration, const Point& distination);
 
     /// \~chinese
-    /// @brief ȡĿ
+    /// @brief 获取目的坐标
     Point GetDistination() const;
 
     /// \~chinese
-    /// @brief Ŀ
+    /// @brief 设置目的坐标
     void SetDistination(const Point& distination);
 
     /// \~chinese
-    /// @brief ȡöĿ
+    /// @brief 获取该动画的拷贝对象
     MoveToAnimation* Clone() const override;
 
     /// \~chinese
-    /// @brief ȡöĵת
+    /// @brief 获取该动画的倒转
     MoveToAnimation* Reverse() const override
     {
         KGE_ERRORF("Reverse() not supported in MoveToAnimation");
@@ -161,48 +190,48 @@ private:
 
 
 /// \~chinese
-/// @brief Ծ
+/// @brief 相对跳跃动画
 class KGE_API JumpByAnimation : public TweenAnimation
 {
 public:
     /// \~chinese
-    /// @brief Ծ
-    /// @param duration ʱ
-    /// @param displacement Ծλ
-    /// @param height Ծ߶
-    /// @param count Ծ
+    /// @brief 创建相对跳跃动画
+    /// @param duration 动画时长
+    /// @param displacement 跳跃位移向量
+    /// @param height 跳跃高度
+    /// @param count 跳跃次数
     JumpByAnimation(Duration duration, const Vec2& displacement, float height, int count = 1);
 
     /// \~chinese
-    /// @brief ȡԾλ
+    /// @brief 获取跳跃位移
     Vec2 GetDisplacement() const;
 
     /// \~chinese
-    /// @brief ȡԾ߶
+    /// @brief 获取跳跃高度
     float GetJumpHeight() const;
 
     /// \~chinese
-    /// @brief ȡԾ
+    /// @brief 获取跳跃次数
     int GetJumpCount() const;
 
     /// \~chinese
-    /// @brief Ծλ
+    /// @brief 设置跳跃位移
     void SetDisplacement(const Vec2& displacement);
 
     /// \~chinese
-    /// @brief Ծ߶
+    /// @brief 设置跳跃高度
     void SetJumpHeight(float height);
 
     /// \~chinese
-    /// @brief Ծ
+    /// @brief 设置跳跃次数
     void SetJumpCount(int count);
 
     /// \~chinese
-    /// @brief ȡöĿ
+    /// @brief 获取该动画的拷贝对象
     JumpByAnimation* Clone() const override;
 
     /// \~chinese
-    /// @brief ȡöĵת
+    /// @brief 获取该动画的倒转
     JumpByAnimation* Reverse() const override;
 
 protected:
@@ -220,32 +249,32 @@ protected:
 
 
 /// \~chinese
-/// @brief Ծ
+/// @brief 跳跃动画
 class KGE_API JumpToAnimation : public JumpByAnimation
 {
 public:
     /// \~chinese
-    /// @brief Ծ
-    /// @param duration ʱ
-    /// @param distination Ŀ
-    /// @param height Ծ߶
-    /// @param count Ծ
+    /// @brief 创建跳跃动画
+    /// @param duration 动画时长
+    /// @param distination 目的坐标
+    /// @param height 跳跃高度
+    /// @param count 跳跃次数
     JumpToAnimation(Duration duration, const Point& distination, float height, int count = 1);
 
     /// \~chinese
-    /// @brief ȡĿ
+    /// @brief 获取目的坐标
     Point GetDistination() const;
 
     /// \~chinese
-    /// @brief Ŀ
+    /// @brief 设置目的坐标
     void SetDistination(const Point& distination);
 
     /// \~chinese
-    /// @brief ȡöĿ
+    /// @brief 获取该动画的拷贝对象
     JumpToAnimation* Clone() const override;
 
     /// \~chinese
-    /// @brief ȡöĵת
+    /// @brief 获取该动画的倒转
     JumpToAnimation* Reverse() const override
     {
         KGE_ERRORF("Reverse() not supported in JumpToAnimation");
@@ -261,38 +290,38 @@ private:
 
 
 /// \~chinese
-/// @brief Ŷ
+/// @brief 相对缩放动画
 class KGE_API ScaleByAnimation : public TweenAnimation
 {
 public:
     /// \~chinese
-    /// @brief Ŷ
-    /// @param duration ʱ
-    /// @param scale Ա仯ֵ
+    /// @brief 创建相对缩放动画
+    /// @param duration 动画时长
+    /// @param scale 缩放相对变化值
     ScaleByAnimation(Duration duration, const Vec2& scale);
 
     /// \~chinese
-    /// @brief ȡԱ仯ֵ
+    /// @brief 获取横向缩放相对变化值
     float GetScaleX() const;
 
     /// \~chinese
-    /// @brief ȡԱ仯ֵ
+    /// @brief 获取横向缩放相对变化值
     float GetScaleY() const;
 
     /// \~chinese
-    /// @brief Ա仯ֵ
+    /// @brief 设置纵向缩放相对变化值
     void SetScaleX(float scale_x);
 
     /// \~chinese
-    /// @brief Ա仯ֵ
+    /// @brief 设置纵向缩放相对变化值
     void SetScaleY(float scale_y);
 
     /// \~chinese
-    /// @brief ȡöĿ
+    /// @brief 获取该动画的拷贝对象
     ScaleByAnimation* Clone() const override;
 
     /// \~chinese
-    /// @brief ȡöĵת
+    /// @brief 获取该动画的倒转
     ScaleByAnimation* Reverse() const override;
 
 protected:
@@ -300,6 +329,8 @@ protected:
 
     void UpdateTween(Actor* target, float frac) override;
 
+    bool GetTweenParams(TweenBatch::Params& params) const override;
+
 protected:
     Vec2 start_val_;
     Vec2 delta_;
@@ -307,38 +338,38 @@ protected:
 
 
 /// \~chinese
-/// @brief Ŷ
+/// @brief 缩放动画
 class KGE_API ScaleToAnimation : public ScaleByAnimation
 {
 public:
     /// \~chinese
-    /// @brief Ŷ
-    /// @param duration ʱ
-    /// @param scale Ŀֵ
+    /// @brief 创建缩放动画
+    /// @param duration 动画时长
+    /// @param scale 缩放目标值
     ScaleToAnimation(Duration duration, const Vec2& scale);
 
     /// \~chinese
-    /// @brief ȡĿֵ
+    /// @brief 获取横向缩放目标值
     float GetTargetScaleX() const;
 
     /// \~chinese
-    /// @brief ȡĿֵ
+    /// @brief 获取横向缩放目标值
     float GetTargetScaleY() const;
 
     /// \~chinese
-    /// @brief Ŀֵ
+    /// @brief 设置纵向缩放目标值
     void SetTargetScaleX(float scale_x);
 
     /// \~chinese
-    /// @brief Ŀֵ
+    /// @brief 设置纵向缩放目标值
     void SetTargetScaleY(float scale_y);
 
     /// \~chinese
-    /// @brief ȡöĿ
+    /// @brief 获取该动画的拷贝对象
     ScaleToAnimation* Clone() const override;
 
     /// \~chinese
-    /// @brief ȡöĵת
+    /// @brief 获取该动画的倒转
     ScaleToAnimation* Reverse() const override
     {
         KGE_ERRORF("Reverse() not supported in ScaleToAnimation");
@@ -354,30 +385,30 @@ private:
 
 
 /// \~chinese
-/// @brief ͸Ƚ䶯
+/// @brief 透明度渐变动画
 class KGE_API FadeToAnimation : public TweenAnimation
 {
 public:
     /// \~chinese
-    /// @brief ͸Ƚ䶯
-    /// @param duration ʱ
-    /// @param opacity Ŀ͸
+    /// @brief 创建透明度渐变动画
+    /// @param duration 动画时长
+    /// @param opacity 目标透明度
     FadeToAnimation(Duration duration, float opacity);
 
     /// \~chinese
-    /// @brief ȡĿ͸
+    /// @brief 获取目标透明度
     float GetTargetOpacity() const;
 
     /// \~chinese
-    /// @brief Ŀ͸
+    /// @brief 设置目标透明度
     void SetTargetOpacity(float opacity);
 
     /// \~chinese
-    /// @brief ȡöĿ
+    /// @brief 获取该动画的拷贝对象
     FadeToAnimation* Clone() const override;
 
     /// \~chinese
-    /// @brief ȡöĵת
+    /// @brief 获取该动画的倒转
     FadeToAnimation* Reverse() const override
     {
         KGE_ERRORF("Reverse() not supported in FadeToAnimation");
@@ -389,6 +420,8 @@ protected:
 
     void UpdateTween(Actor* target, float frac) override;
 
+    bool GetTweenParams(TweenBatch::Params& params) const override;
+
 private:
     float start_val_;
     float delta_val_;
@@ -397,30 +430,30 @@ private:
 
 
 /// \~chinese
-/// @brief ת
+/// @brief 相对旋转动画
 class KGE_API RotateByAnimation : public TweenAnimation
 {
 public:
     /// \~chinese
-    /// @brief ת
-    /// @param duration ʱ
-    /// @param rotation ǶԱ仯ֵ
+    /// @brief 创建相对旋转动画
+    /// @param duration 动画时长
+    /// @param rotation 角度相对变化值
     RotateByAnimation(Duration duration, float rotation);
 
     /// \~chinese
-    /// @brief ȡǶԱ仯ֵ
+    /// @brief 获取角度相对变化值
     float GetRotation() const;
 
     /// \~chinese
-    /// @brief ýǶԱ仯ֵ
+    /// @brief 设置角度相对变化值
     void SetRotation(float rotation);
 
     /// \~chinese
-    /// @brief ȡöĿ
+    /// @brief 获取该动画的拷贝对象
     RotateByAnimation* Clone() const override;
 
     /// \~chinese
-    /// @brief ȡöĵת
+    /// @brief 获取该动画的倒转
     RotateByAnimation* Reverse() const override;
 
 protected:
@@ -428,6 +461,8 @@ protected:
 
     void UpdateTween(Actor* target, float frac) override;
 
+    bool GetTweenParams(TweenBatch::Params& params) const override;
+
 protected:
     float start_val_;
     float delta_val_;
@@ -435,30 +470,30 @@ protected:
 
 
 /// \~chinese
-/// @brief ת
+/// @brief 旋转动画
 class KGE_API RotateToAnimation : public RotateByAnimation
 {
 public:
     /// \~chinese
-    /// @brief ת
-    /// @param duration ʱ
-    /// @param rotation ĿǶ
+    /// @brief 创建旋转动画
+    /// @param duration 动画时长
+    /// @param rotation 目标角度
     RotateToAnimation(Duration duration, float rotation);
 
     /// \~chinese
-    /// @brief ȡĿǶ
+    /// @brief 获取目标角度
     float GetTargetRotation() const;
 
     /// \~chinese
-    /// @brief ĿǶ
+    /// @brief 设置目标角度
     void SetTargetRotation(float rotation);
 
     /// \~chinese
-    /// @brief ȡöĿ
+    /// @brief 获取该动画的拷贝对象
     RotateToAnimation* Clone() const override;
 
     /// \~chinese
-    /// @brief ȡöĵת
+    /// @brief 获取该动画的倒转
     RotateToAnimation* Reverse() const override
     {
         KGE_ERRORF("Reverse() not supported in RotateToAnimation");
@@ -486,12 +521,18 @@ inline Duration TweenAnimation::GetDuration() const
 
 inline void TweenAnimation::SetDuration(Duration duration)
 {
+    if (IsBatched())
+        LeaveBatch();
     dur_ = duration;
+    SetBatchRejected(false);
 }
 
 inline void TweenAnimation::SetEaseFunc(const EaseFunc& func)
 {
+    if (IsBatched())
+        LeaveBatch();
     ease_func_ = func;
+    SetBatchRejected(false);
 }
 
 inline Vec2 MoveByAnimation::GetDisplacement() const
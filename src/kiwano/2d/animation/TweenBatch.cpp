@@ -0,0 +1,256 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <kiwano/2d/Actor.h>
+#include <kiwano/2d/animation/TweenAnimation.h>
+#include <kiwano/2d/animation/TweenBatch.h>
+
+namespace kiwano
+{
+
+TweenBatch::TweenBatch()
+    : enabled_(false)
+    , frame_(0)
+    , tween_count_(0)
+    , last_flush_count_(0)
+{
+}
+
+TweenBatch::~TweenBatch() {}
+
+uint32_t TweenBatch::AcquireTarget()
+{
+    uint32_t id = 0;
+    if (!free_target_ids_.empty())
+    {
+        id = free_target_ids_.back();
+        free_target_ids_.pop_back();
+    }
+    else
+    {
+        id = uint32_t(target_frames_.size());
+        target_frames_.push_back(0);
+        target_dts_.push_back(0);
+    }
+
+    target_frames_[id] = frame_ - 1;
+    target_dts_[id]    = 0;
+    return id;
+}
+
+void TweenBatch::ReleaseTarget(uint32_t id)
+{
+    free_target_ids_.push_back(id);
+}
+
+void TweenBatch::AddTween(TweenAnimation* owner, Actor* target, const Params& params, EaseType ease, float elapsed,
+                          float duration)
+{
+    KGE_ASSERT(owner && target && ease != EaseType::Custom);
+
+    const size_t index = size_t(params.prop) * EASE_TYPE_COUNT + size_t(ease);
+
+    Channel& ch = channels_[index];
+    owner->batch_channel_ = uint32_t(index);
+    owner->batch_index_   = uint32_t(ch.owners.size());
+
+    ch.owners.push_back(owner);
+    ch.targets.push_back(target);
+    ch.target_ids.push_back(target->batch_id_);
+    ch.stamps.push_back(frame_);  // already stepped by the animation in this frame
+    ch.start_x.push_back(params.start.x);
+    ch.start_y.push_back(params.start.y);
+    ch.delta_x.push_back(params.delta.x);
+    ch.delta_y.push_back(params.delta.y);
+    ch.prev_x.push_back(params.prev.x);
+    ch.prev_y.push_back(params.prev.y);
+    ch.elapsed.push_back(elapsed);
+    ch.duration.push_back(duration);
+    ch.steps.push_back(0);
+    ch.active.push_back(0);
+    ++tween_count_;
+}
+
+void TweenBatch::RemoveTween(TweenAnimation* owner, Params& params, float& elapsed, Actor*& target)
+{
+    Channel&     ch    = channels_[owner->batch_channel_];
+    const size_t index = owner->batch_index_;
+    const size_t last  = ch.owners.size() - 1;
+
+    KGE_ASSERT(index <= last && ch.owners[index] == owner);
+
+    params.prop  = Property(owner->batch_channel_ / EASE_TYPE_COUNT);
+    params.start = Vec2(ch.start_x[index], ch.start_y[index]);
+    params.delta = Vec2(ch.delta_x[index], ch.delta_y[index]);
+    params.prev  = Vec2(ch.prev_x[index], ch.prev_y[index]);
+    elapsed      = ch.elapsed[index];
+    target       = ch.targets[index];
+
+    if (index != last)
+    {
+        ch.owners[index]     = ch.owners[last];
+        ch.targets[index]    = ch.targets[last];
+        ch.target_ids[index] = ch.target_ids[last];
+        ch.stamps[index]     = ch.stamps[last];
+        ch.start_x[index]    = ch.start_x[last];
+        ch.start_y[index]    = ch.start_y[last];
+        ch.delta_x[index]    = ch.delta_x[last];
+        ch.delta_y[index]    = ch.delta_y[last];
+        ch.prev_x[index]     = ch.prev_x[last];
+        ch.prev_y[index]     = ch.prev_y[last];
+        ch.elapsed[index]    = ch.elapsed[last];
+        ch.duration[index]   = ch.duration[last];
+        ch.steps[index]      = ch.steps[last];
+        ch.active[index]     = ch.active[last];
+
+        ch.owners[index]->batch_index_ = uint32_t(index);
+    }
+
+    ch.owners.pop_back();
+    ch.targets.pop_back();
+    ch.target_ids.pop_back();
+    ch.stamps.pop_back();
+    ch.start_x.pop_back();
+    ch.start_y.pop_back();
+    ch.delta_x.pop_back();
+    ch.delta_y.pop_back();
+    ch.prev_x.pop_back();
+    ch.prev_y.pop_back();
+    ch.elapsed.pop_back();
+    ch.duration.pop_back();
+    ch.steps.pop_back();
+    ch.active.pop_back();
+    --tween_count_;
+}
+
+void TweenBatch::Flush()
+{
+    size_t count = 0;
+    for (size_t i = 0; i < CHANNEL_COUNT; ++i)
+    {
+        Channel&     ch = channels_[i];
+        const size_t n  = ch.owners.size();
+        if (n == 0)
+            continue;
+
+        // Work in blocks so that the targets are still in cache when the results are written back
+        for (size_t begin = 0; begin < n; begin += BLOCK_SIZE)
+        {
+            const size_t end = std::min(begin + BLOCK_SIZE, n);
+
+            // Advance the tweens whose targets were updated in this frame
+            for (size_t j = begin; j < end; ++j)
+            {
+                const uint32_t id = ch.target_ids[j];
+
+                ch.active[j] = 0;
+                if (target_frames_[id] != frame_ || ch.stamps[j] == frame_)
+                    continue;
+
+                const float elapsed = ch.elapsed[j] + target_dts_[id];
+                if (elapsed >= ch.duration[j])
+                {
+                    // Loop events and completion are handled by the animation itself
+                    finished_.push_back(Finished{ ch.owners[j], ch.targets[j], target_dts_[id] });
+                    continue;
+                }
+
+                ch.elapsed[j] = elapsed;
+                ch.steps[j]   = elapsed / ch.duration[j];
+                ch.active[j]  = 1;
+                ++count;
+            }
+
+            EaseFunc::Evaluate(EaseType(i % EASE_TYPE_COUNT), ch.steps.data() + begin, end - begin);
+            WriteBack(i, begin, end);
+        }
+    }
+
+    for (auto& finished : finished_)
+    {
+        finished.owner->StepOutOfBatch(finished.target.Get(), finished.dt);
+    }
+    finished_.clear();
+
+    last_flush_count_ = count;
+    ++frame_;
+}
+
+void TweenBatch::WriteBack(size_t channel, size_t begin, size_t end)
+{
+    Channel& ch = channels_[channel];
+
+    switch (Property(channel / EASE_TYPE_COUNT))
+    {
+    case Property::Position:
+        for (size_t i = begin; i < end; ++i)
+        {
+            if (!ch.active[i])
+                continue;
+
+            // Keep moves made by others during the animation, as MoveByAnimation does
+            Actor*       target = ch.targets[i];
+            const Point& pos    = target->GetPosition();
+            ch.start_x[i] += pos.x - ch.prev_x[i];
+            ch.start_y[i] += pos.y - ch.prev_y[i];
+            ch.prev_x[i] = ch.start_x[i] + ch.delta_x[i] * ch.steps[i];
+            ch.prev_y[i] = ch.start_y[i] + ch.delta_y[i] * ch.steps[i];
+            target->SetPosition(Point(ch.prev_x[i], ch.prev_y[i]));
+        }
+        break;
+
+    case Property::Scale:
+        for (size_t i = begin; i < end; ++i)
+        {
+            if (ch.active[i])
+            {
+                ch.targets[i]->SetScale(Vec2(ch.start_x[i] + ch.delta_x[i] * ch.steps[i],
+                                             ch.start_y[i] + ch.delta_y[i] * ch.steps[i]));
+            }
+        }
+        break;
+
+    case Property::Rotation:
+        for (size_t i = begin; i < end; ++i)
+        {
+            if (ch.active[i])
+            {
+                float rotation = ch.start_x[i] + ch.delta_x[i] * ch.steps[i];
+                if (rotation > 360.f)
+                    rotation -= 360.f;
+
+                ch.targets[i]->SetRotation(rotation);
+            }
+        }
+        break;
+
+    case Property::Opacity:
+        for (size_t i = begin; i < end; ++i)
+        {
+            if (ch.active[i])
+            {
+                ch.targets[i]->SetOpacity(ch.start_x[i] + ch.delta_x[i] * ch.steps[i]);
+            }
+        }
+        break;
+    }
+}
+
+}  // namespace kiwano
@@ -0,0 +1,194 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <kiwano/core/Common.h>
+#include <kiwano/core/Singleton.h>
+#include <kiwano/math/Math.h>
+#include <kiwano/2d/animation/EaseFunc.h>
+
+namespace kiwano
+{
+class Actor;
+class TweenAnimation;
+
+/**
+ * \addtogroup Animation
+ * @{
+ */
+
+/**
+ * \~chinese
+ * @brief 补间动画批处理器
+ * @details 开启后，使用内置缓动函数的位移、缩放、旋转和透明度动画在开始后交由批处理器驱动，其起始值、变化量、
+ * 时长和进度按属性和缓动函数类型保存在连续数组中。每帧更新结束时统一推进进度、计算缓动并一次性写回角色，
+ * 角色的动画调度器不再逐个更新这些动画。动画循环结束、暂停或停止时会退回到动画自身处理
+ * @note 批处理的补间动画在所有角色更新结束后才写入角色，角色在自身的更新函数中读到的是上一帧的值
+ * @note 同一角色的同一属性同时被多个动画修改时，批处理的动画总是最后写入
+ */
+class KGE_API TweenBatch final : public Singleton<TweenBatch>
+{
+    friend Singleton<TweenBatch>;
+    friend class TweenAnimation;
+    friend class Animator;
+
+public:
+    /// \~chinese
+    /// @brief 补间属性
+    enum class Property : uint8_t
+    {
+        Position,  ///< 坐标
+        Scale,     ///< 缩放
+        Rotation,  ///< 旋转角度
+        Opacity,   ///< 透明度
+    };
+
+    /// \~chinese
+    /// @brief 补间参数
+    struct Params
+    {
+        Property prop;   ///< 补间属性
+        Vec2     start;  ///< 起始值
+        Vec2     delta;  ///< 变化量
+        Vec2     prev;   ///< 上一次写入的值，用于保留其他来源对坐标的修改
+    };
+
+    /// \~chinese
+    /// @brief 启用或禁用补间动画批处理
+    /// @details 禁用后已交由批处理器驱动的动画会继续运行到当前循环结束
+    void SetEnabled(bool enabled);
+
+    /// \~chinese
+    /// @brief 是否启用了补间动画批处理
+    bool IsEnabled() const;
+
+    /// \~chinese
+    /// @brief 推进所有目标角色在本帧更新过的补间，并将结果写回角色
+    void Flush();
+
+    /// \~chinese
+    /// @brief 获取补间数量
+    size_t GetTweenCount() const;
+
+    /// \~chinese
+    /// @brief 获取上一次 Flush 写回的补间数量
+    size_t GetLastFlushCount() const;
+
+    /// \~chinese
+    /// @brief 获取已经 Flush 的帧数
+    uint32_t GetFrameCount() const;
+
+private:
+    TweenBatch();
+
+    ~TweenBatch();
+
+    uint32_t AcquireTarget();
+
+    void ReleaseTarget(uint32_t id);
+
+    void MarkTargetUpdated(uint32_t id, Duration dt);
+
+    void AddTween(TweenAnimation* owner, Actor* target, const Params& params, EaseType ease, float elapsed,
+                  float duration);
+
+    void RemoveTween(TweenAnimation* owner, Params& params, float& elapsed, Actor*& target);
+
+    void WriteBack(size_t channel, size_t begin, size_t end);
+
+private:
+    static const size_t BLOCK_SIZE      = 64;
+    static const size_t PROPERTY_COUNT  = 4;
+    static const size_t EASE_TYPE_COUNT = size_t(EaseType::Custom);
+    static const size_t CHANNEL_COUNT   = PROPERTY_COUNT * EASE_TYPE_COUNT;
+
+    // Tweens of the same property and ease type, elapsed time and duration are in milliseconds
+    struct Channel
+    {
+        Vector<TweenAnimation*> owners;
+        Vector<Actor*>          targets;
+        Vector<uint32_t>        target_ids;
+        Vector<uint32_t>        stamps;
+        Vector<float>           start_x;
+        Vector<float>           start_y;
+        Vector<float>           delta_x;
+        Vector<float>           delta_y;
+        Vector<float>           prev_x;
+        Vector<float>           prev_y;
+        Vector<float>           elapsed;
+        Vector<float>           duration;
+        Vector<float>           steps;
+        Vector<uint8_t>         active;
+    };
+
+    struct Finished
+    {
+        RefPtr<TweenAnimation> owner;
+        RefPtr<Actor>          target;
+        float                  dt;
+    };
+
+    bool             enabled_;
+    uint32_t         frame_;
+    size_t           tween_count_;
+    size_t           last_flush_count_;
+    Channel          channels_[CHANNEL_COUNT];
+    Vector<Finished> finished_;
+
+    // Which targets are updated in the current frame, so tweens can be advanced without touching the targets
+    Vector<uint32_t> target_frames_;
+    Vector<float>    target_dts_;
+    Vector<uint32_t> free_target_ids_;
+};
+
+/** @} */
+
+inline void TweenBatch::SetEnabled(bool enabled)
+{
+    enabled_ = enabled;
+}
+
+inline bool TweenBatch::IsEnabled() const
+{
+    return enabled_;
+}
+
+inline size_t TweenBatch::GetTweenCount() const
+{
+    return tween_count_;
+}
+
+inline size_t TweenBatch::GetLastFlushCount() const
+{
+    return last_flush_count_;
+}
+
+inline uint32_t TweenBatch::GetFrameCount() const
+{
+    return frame_;
+}
+
+inline void TweenBatch::MarkTargetUpdated(uint32_t id, Duration dt)
+{
+    target_frames_[id] = frame_;
+    target_dts_[id]    = static_cast<float>(dt.GetMilliseconds());
+}
+
+}  // namespace kiwano
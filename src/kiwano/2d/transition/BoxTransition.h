@@ -33,16 +33,16 @@ KGE_DECLARE_SMART_PTR(BoxTransition);
 
 /**
  * \~chinese
- * @brief ״ɶ
- * @details ǰһԺ״ʧһԺ״
+ * @brief 盒状过渡动画
+ * @details 前一场景以盒状收缩至消失，后一场景以盒状扩大
  */
 class BoxTransition : public Transition
 {
 public:
     /**
      * \~chinese
-     * @brief ״ɶ
-     * @param duration ʱ
+     * @brief 创建盒状过渡动画
+     * @param duration 动画时长
      */
     BoxTransition(Duration duration);
 
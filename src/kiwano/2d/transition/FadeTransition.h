@@ -33,17 +33,17 @@ KGE_DECLARE_SMART_PTR(FadeTransition);
 
 /**
  * \~chinese
- * @brief 뵭ɶ
- * @details ǰһ󣬺һ
+ * @brief 淡入淡出过渡动画
+ * @details 前一场景淡出动画结束后，后一场景淡入
  */
 class FadeTransition : public Transition
 {
 public:
     /**
      * \~chinese
-     * @brief 뵭ɶ
-     * @param duration ʱ
-     * @param parallel ͵ͬʱ
+     * @brief 创建淡入淡出过渡动画
+     * @param duration 动画时长
+     * @param parallel 淡入和淡出同时进行
      */
     FadeTransition(Duration duration, bool parallel = false);
 
@@ -33,29 +33,29 @@ KGE_DECLARE_SMART_PTR(MoveTransition);
 
 /**
  * \~chinese
- * @brief λƹɶ
- * @details λƵķʽл
+ * @brief 位移过渡动画
+ * @details 两场景以位移的方式切换
  */
 class MoveTransition : public Transition
 {
 public:
     /**
      * \~chinese
-     * @brief λƷʽ
+     * @brief 位移方式
      */
     enum class Type : int
     {
-        Up,    ///< 
-        Down,  ///< 
-        Left,  ///< 
-        Right  ///< 
+        Up,    ///< 上移
+        Down,  ///< 下移
+        Left,  ///< 左移
+        Right  ///< 右移
     };
 
     /**
      * \~chinese
-     * @brief λƹɶ
-     * @param duration ʱ
-     * @param type λƷʽ
+     * @brief 创建位移过渡动画
+     * @param duration 动画时长
+     * @param type 位移方式
      */
     MoveTransition(Duration duration, Type type);
 
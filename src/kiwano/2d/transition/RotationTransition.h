@@ -33,17 +33,17 @@ KGE_DECLARE_SMART_PTR(RotationTransition);
 
 /**
  * \~chinese
- * @brief תɶ
- * @details ǰһתʽʧһתʽ
+ * @brief 旋转过渡动画
+ * @details 前一场景以旋转方式收缩至消失，后一场景以旋转方式扩大
  */
 class RotationTransition : public Transition
 {
 public:
     /**
      * \~chinese
-     * @brief תɶ
-     * @param duration ʱ
-     * @param rotation ת
+     * @brief 创建旋转过渡动画
+     * @param duration 动画时长
+     * @param rotation 旋转度数
      */
     RotationTransition(Duration duration, float rotation = 360.0f);
 
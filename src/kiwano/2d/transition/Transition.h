@@ -31,7 +31,7 @@ KGE_DECLARE_SMART_PTR(Transition);
 
 /**
  * \~chinese
- * \defgroup Transition ̨ɶ
+ * \defgroup Transition 舞台过渡动画
  */
 
 /**
@@ -41,7 +41,7 @@ KGE_DECLARE_SMART_PTR(Transition);
 
 /**
  * \~chinese
- * @brief ̨ɶ
+ * @brief 舞台过渡动画
  */
 class KGE_API Transition : public ObjectBase
 {
@@ -54,48 +54,48 @@ public:
 
     /**
      * \~chinese
-     * @brief öʱ
+     * @brief 设置动画时长
      */
     void SetDuration(Duration dt);
 
     /**
      * \~chinese
-     * @brief ɶǷѽ
+     * @brief 场景过渡动画是否已结束
      */
     bool IsDone();
 
 protected:
     /**
      * \~chinese
-     * @brief ʼɶ
-     * @param[in] prev ת
-     * @param[in] next ת볡
+     * @brief 初始化场景过渡动画
+     * @param[in] prev 转出场景
+     * @param[in] next 转入场景
      */
     virtual void Init(Stage* prev, Stage* next);
 
     /**
      * \~chinese
-     * @brief ¹ɶ
-     * @param dt һθµʱ
+     * @brief 更新过渡动画
+     * @param dt 距上一次更新的时间间隔
      */
     virtual void Update(Duration dt);
 
     /**
      * \~chinese
-     * @brief Ⱦȶ
-     * @param[in] ctx Ⱦ
+     * @brief 渲染过度动画
+     * @param[in] ctx 渲染上下文
      */
     virtual void Render(RenderContext& ctx);
 
     /**
      * \~chinese
-     * @brief ֹͣ
+     * @brief 停止动画
      */
     virtual void Stop();
 
     /**
      * \~chinese
-     * @brief ö
+     * @brief 重置动画
      */
     virtual void Reset() {}
 
@@ -21,6 +21,7 @@
 #include <kiwano/2d/Actor.h>
 #include <kiwano/2d/DebugActor.h>
 #include <kiwano/2d/Stage.h>
+#include <kiwano/2d/animation/TweenBatch.h>
 #include <kiwano/base/Director.h>
 
 namespace kiwano
@@ -149,6 +150,8 @@ void Director::OnUpdate(UpdateModuleContext& ctx)
 
     if (debug_actor_)
         debug_actor_->Update(ctx.dt);
+
+    TweenBatch::GetInstance().Flush();
 }
 
 void Director::OnRender(RenderModuleContext& ctx)
@@ -28,8 +28,8 @@ namespace kiwano
 {
 /**
  * \~chinese
- * @brief 
- * @details ̨Ⱦ¡¼ַԼ̨ת
+ * @brief 导演
+ * @details 导演完成舞台的渲染、更新、事件分发以及控制舞台间跳转
  * @see kiwano::Stage
  */
 class KGE_API Director
@@ -41,51 +41,51 @@ class KGE_API Director
 public:
     /**
      * \~chinese
-     * @brief л̨
-     * @param[in] stage ̨
-     * @param[in] transition ɶ
+     * @brief 切换舞台
+     * @param[in] stage 舞台
+     * @param[in] transition 过渡动画
      */
     void EnterStage(StagePtr stage, TransitionPtr transition = nullptr);
 
     /**
      * \~chinese
-     * @brief л̨ǰ̨浽ջ
-     * @param[in] stage ̨
-     * @param[in] transition ɶ
+     * @brief 切换舞台，并将当前舞台储存到栈中
+     * @param[in] stage 舞台
+     * @param[in] transition 过渡动画
      */
     void PushStage(StagePtr stage, TransitionPtr transition = nullptr);
 
     /**
      * \~chinese
-     * @brief ˳ǰ̨лһ̨
-     * @param[in] transition ɶ
+     * @brief 退出当前舞台，并切换到上一个舞台
+     * @param[in] transition 过渡动画
      */
     void PopStage(TransitionPtr transition = nullptr);
 
     /**
      * \~chinese
-     * @brief ȡǰ̨
-     * @return صǰָ̨
+     * @brief 获取当前舞台
+     * @return 返回当前舞台的指针
      */
     StagePtr GetCurrentStage();
 
     /**
      * \~chinese
-     * @brief ûýɫ߽Ⱦ
-     * @param enabled Ƿ
+     * @brief 启用或禁用角色边界渲染功能
+     * @param enabled 是否启用
      */
     void SetRenderBorderEnabled(bool enabled);
 
     /**
      * \~chinese
-     * @brief ʾصϢ
-     * @param show Ƿʾ
+     * @brief 显示或隐藏调试信息
+     * @param show 是否显示
      */
     void ShowDebugInfo(bool show = true);
 
     /**
      * \~chinese
-     * @brief ˳ǰ̨̨ջ
+     * @brief 退出当前舞台并清空舞台栈
      */
     void ClearStages();
 
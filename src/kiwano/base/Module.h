@@ -28,11 +28,11 @@ class Event;
 class Module;
 
 /// \~chinese
-/// @brief ģб
+/// @brief 模块列表
 typedef Vector<Module*> ModuleList;
 
 /// \~chinese
-/// @brief ģ
+/// @brief 模块上下文
 class KGE_API ModuleContext
 {
 public:
@@ -53,7 +53,7 @@ private:
 };
 
 /// \~chinese
-/// @brief Ⱦģ
+/// @brief 渲染模块上下文
 class KGE_API RenderModuleContext : public ModuleContext
 {
 public:
@@ -78,7 +78,7 @@ private:
 };
 
 /// \~chinese
-/// @brief ģ
+/// @brief 更新模块上下文
 class KGE_API UpdateModuleContext : public ModuleContext
 {
 public:
@@ -91,7 +91,7 @@ protected:
 };
 
 /// \~chinese
-/// @brief ʱģ
+/// @brief 时间模块上下文
 class KGE_API EventModuleContext : public ModuleContext
 {
 public:
@@ -105,42 +105,42 @@ protected:
 
 /**
  * \~chinese
- * @brief ģ
+ * @brief 基础模块
  */
 class KGE_API Module : Noncopyable
 {
 public:
     /// \~chinese
-    /// @brief ģ
+    /// @brief 启动模块
     virtual void SetupModule();
 
     /// \~chinese
-    /// @brief ģ
+    /// @brief 销毁模块
     virtual void DestroyModule();
 
     /// \~chinese
-    /// @brief ʱ
-    /// @param ctx 
+    /// @brief 更新时
+    /// @param ctx 更新上下文
     virtual void OnUpdate(UpdateModuleContext& ctx);
 
     /// \~chinese
-    /// @brief ¼
-    /// @param ctx ¼
+    /// @brief 事件处理
+    /// @param ctx 事件上下文
     virtual void HandleEvent(EventModuleContext& ctx);
 
     /// \~chinese
-    /// @brief Ⱦǰ
-    /// @param ctx Ⱦ
+    /// @brief 渲染前
+    /// @param ctx 渲染上下文
     virtual void BeforeRender(RenderModuleContext& ctx);
 
     /// \~chinese
-    /// @brief Ⱦʱ
-    /// @param ctx Ⱦ
+    /// @brief 渲染时
+    /// @param ctx 渲染上下文
     virtual void OnRender(RenderModuleContext& ctx);
 
     /// \~chinese
-    /// @brief Ⱦ
-    /// @param ctx Ⱦ
+    /// @brief 渲染后
+    /// @param ctx 渲染上下文
     virtual void AfterRender(RenderModuleContext& ctx);
 
 protected:
@@ -44,7 +44,7 @@ ObjectFailException::ObjectFailException(ObjectBase* obj, const ObjectStatus& st
 {
 }
 
-char const* ObjectFailException::what() const
+char const* ObjectFailException::what() const noexcept
 {
     return status_.msg.empty() ? "Object operation failed" : status_.msg.c_str();
 }
@@ -32,12 +32,12 @@ KGE_DECLARE_SMART_PTR(ObjectBase);
 
 /**
  * \~chinese
- * @brief ״̬
+ * @brief 对象状态
  */
 struct ObjectStatus
 {
-    int    code = 0;  ///< ״̬룬 0 ʱΪɹ״̬Ϊʧ״̬
-    String msg;       ///< ״̬Ϣ
+    int    code = 0;  ///< 状态码，等于 0 时为成功状态，否则为失败状态
+    String msg;       ///< 状态信息
 
     ObjectStatus() = default;
 
@@ -48,20 +48,20 @@ struct ObjectStatus
     }
 
     /// \~chinese
-    /// @brief ״̬Ƿɹ
+    /// @brief 对象状态是否成功
     inline bool Success() const
     {
         return this->code == 0;
     }
 
     /// \~chinese
-    /// @brief ʧ״̬
+    /// @brief 对象失败状态
     static const int fail = -1;
 };
 
 /**
  * \~chinese
- * @brief ʧ״̬쳣
+ * @brief 对象失败状态异常
  */
 class ObjectFailException : public Exception
 {
@@ -69,20 +69,20 @@ public:
     ObjectFailException(ObjectBase* obj, const ObjectStatus& status);
 
     /// \~chinese
-    /// @brief ȡʧܵĶָ
+    /// @brief 获取失败的对象指针
     inline ObjectBase* GetObj() const
     {
         return obj_;
     }
 
     /// \~chinese
-    /// @brief ȡ״̬
+    /// @brief 获取对象状态
     inline ObjectStatus GetStatus() const
     {
         return status_;
     }
 
-    virtual char const* what() const override;
+    virtual char const* what() const noexcept override;
 
 private:
     ObjectBase*  obj_;
@@ -91,45 +91,45 @@ private:
 
 /**
  * \~chinese
- * @brief Է
+ * @brief 对象处理策略方法
  */
 typedef Function<void(ObjectBase*, const ObjectStatus&)> ObjectPolicyFunc;
 
 /**
  * \~chinese
- * @brief 
+ * @brief 对象处理策略
  */
 struct ObjectPolicy
 {
     /// \~chinese
-    /// @brief Զʧ״̬
+    /// @brief 忽略对象失败状态
     static inline ObjectPolicyFunc Ignore()
     {
         return nullptr;
     }
 
     /// \~chinese
-    /// @brief ڶ״̬Ϊʧʱӡ־
-    /// @param threshold ֵ
-    /// @return Է
+    /// @brief 在对象状态变为失败时打印警告日志
+    /// @param threshold 触发阈值
+    /// @return 对象处理策略方法
     static ObjectPolicyFunc WarnLog(int threshold = ObjectStatus::fail);
 
     /// \~chinese
-    /// @brief ڶ״̬Ϊʧʱӡ־Ĭϲԣ
-    /// @param threshold ֵ
-    /// @return Է
+    /// @brief 在对象状态变为失败时打印错误日志（默认策略）
+    /// @param threshold 触发阈值
+    /// @return 对象处理策略方法
     static ObjectPolicyFunc ErrorLog(int threshold = ObjectStatus::fail);
 
     /// \~chinese
-    /// @brief ڶ״̬Ϊʧʱ׳ ObjectFailException
-    /// @param threshold ֵ
-    /// @return Է
+    /// @brief 在对象状态变为失败时抛出 ObjectFailException
+    /// @param threshold 触发阈值
+    /// @return 对象处理策略方法
     static ObjectPolicyFunc Exception(int threshold = ObjectStatus::fail);
 };
 
 /**
  * \~chinese
- * @brief 
+ * @brief 基础对象
  */
 class KGE_API ObjectBase
     : public RefObject
@@ -137,87 +137,87 @@ class KGE_API ObjectBase
 {
 public:
     /// \~chinese
-    /// @brief 
+    /// @brief 构造基础对象
     ObjectBase();
 
     virtual ~ObjectBase();
 
     /// \~chinese
-    /// @brief ö
+    /// @brief 设置对象名
     void SetName(const String& name);
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取对象名
     String GetName() const;
 
     /// \~chinese
-    /// @brief ж϶Ƿͬ
-    /// @param name Ҫжϵ
+    /// @brief 判断对象的名称是否相同
+    /// @param name 需要判断的名称
     bool IsName(const String& name) const;
 
     /// \~chinese
-    /// @brief ȡû
+    /// @brief 获取用户数据
     void* GetUserData() const;
 
     /// \~chinese
-    /// @brief û
+    /// @brief 设置用户数据
     void SetUserData(void* data);
 
     /// \~chinese
-    /// @brief ȡID
+    /// @brief 获取对象ID
     uint64_t GetObjectID() const;
 
     /// \~chinese
-    /// @brief л
+    /// @brief 序列化
     void DoSerialize(Serializer* serializer) const override;
 
     /// \~chinese
-    /// @brief л
+    /// @brief 反序列化
     void DoDeserialize(Deserializer* deserializer) override;
 
     /// \~chinese
-    /// @brief ж϶ǷЧ
+    /// @brief 判断对象是否有效
     virtual bool IsValid() const;
 
     /// \~chinese
-    /// @brief ȡ״̬
+    /// @brief 获取对象状态
     ObjectStatus* GetStatus() const;
 
     /// \~chinese
-    /// @brief ö״̬
+    /// @brief 设置对象状态
     void SetStatus(const ObjectStatus& status);
 
     /// \~chinese
-    /// @brief Ϊʧ״̬
+    /// @brief 将对象标记为失败状态
     void Fail(const String& msg, int code = ObjectStatus::fail);
 
     /// \~chinese
-    /// @brief ״̬
+    /// @brief 清除对象状态
     void ClearStatus();
 
     /// \~chinese
-    /// @brief ö
+    /// @brief 设置对象处理策略
     static void SetObjectPolicy(const ObjectPolicyFunc& policy);
 
 public:
     /// \~chinese
-    /// @brief Ƿڴй©׷
+    /// @brief 是否启用了内存泄漏追踪
     static bool IsTracingLeaks();
 
     /// \~chinese
-    /// @brief ʼ׷ڴй©
+    /// @brief 开始追踪内存泄漏
     static void StartTracingLeaks();
 
     /// \~chinese
-    /// @brief ֹͣ׷ڴй©
+    /// @brief 停止追踪内存泄漏
     static void StopTracingLeaks();
 
     /// \~chinese
-    /// @brief ӡ׷еĶϢ
+    /// @brief 打印所有追踪中的对象信息
     static void DumpTracingObjects();
 
     /// \~chinese
-    /// @brief ȡ׷еĶ
+    /// @brief 获取所有追踪中的对象
     static Vector<ObjectBase*>& GetTracingObjects();
 
 private:
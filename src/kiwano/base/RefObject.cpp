@@ -59,12 +59,12 @@ void* RefObject::operator new(size_t size)
     return ptr;
 }
 
-void RefObject::operator delete(void* ptr)
+void RefObject::operator delete(void* ptr, size_t size)
 {
-    memory::Free(ptr);
+    memory::Free(ptr, size);
 }
 
-void* RefObject::operator new(size_t size, std::nothrow_t const&)
+void* RefObject::operator new(size_t size, std::nothrow_t const&) noexcept
 {
     try
     {
@@ -77,7 +77,7 @@ void* RefObject::operator new(size_t size, std::nothrow_t const&)
     return nullptr;
 }
 
-void RefObject::operator delete(void* ptr, std::nothrow_t const&)
+void RefObject::operator delete(void* ptr, std::nothrow_t const&) noexcept
 {
     try
     {
@@ -88,7 +88,7 @@ void RefObject::operator delete(void* ptr, std::nothrow_t const&)
     }
 }
 
-void* RefObject::operator new(size_t size, void* ptr)
+void* RefObject::operator new(size_t size, void* ptr) noexcept
 {
     return ::operator new(size, ptr);
 }
@@ -27,26 +27,26 @@ namespace kiwano
 
 /**
  * \~chinese
- * @brief ü
+ * @brief 引用计数器
  */
 class KGE_API RefObject : protected Noncopyable
 {
 public:
     /// \~chinese
-    /// @brief ü
+    /// @brief 增加引用计数
     void Retain();
 
     /// \~chinese
-    /// @brief ü
+    /// @brief 减少引用计数
     void Release();
 
     /// \~chinese
-    /// @brief ȡü
+    /// @brief 获取引用计数
     uint32_t GetRefCount() const;
 
     static void* operator new(size_t size);
 
-    static void operator delete(void* ptr);
+    static void operator delete(void* ptr, size_t size);
 
     static void* operator new(size_t size, std::nothrow_t const&) noexcept;
 
@@ -26,7 +26,7 @@ namespace kiwano
 {
 
 /// \~chinese
-/// @brief Ĭϵָü
+/// @brief 默认的智能指针引用计数策略
 struct DefaultRefPtrPolicy
 {
     inline void Retain(RefObject* ptr)
@@ -43,12 +43,12 @@ struct DefaultRefPtrPolicy
 };
 
 /// \~chinese
-/// @brief üָ
+/// @brief 引用计数对象智能指针
 template <typename _Ty>
 using RefPtr = RefBasePtr<_Ty, DefaultRefPtrPolicy>;
 
 /// \~chinese
-/// @brief üָ
+/// @brief 构造引用计数对象智能指针
 template <typename _Ty, typename... _Args>
 inline RefPtr<_Ty> MakePtr(_Args&&... args)
 {
@@ -57,7 +57,7 @@ inline RefPtr<_Ty> MakePtr(_Args&&... args)
 }
 
 /// \~chinese
-/// @brief üָ
+/// @brief 构造引用计数对象智能指针
 template <typename _Ty>
 inline RefPtr<_Ty> MakePtr(_Ty* ptr)
 {
@@ -33,20 +33,20 @@ KGE_DECLARE_SMART_PTR(Button);
 
 /**
  * \~chinese
- * @brief ť
+ * @brief 基础按钮组件
  */
 class KGE_API ButtonBase : public MouseSensor
 {
 public:
     /// \~chinese
-    /// @brief ť¼
+    /// @brief 按钮事件
     enum class Event
     {
-        MouseEntered,  ///< 긡ڰť
-        MouseExited,   ///< ӰťƳ
-        Pressed,       ///< 갴
-        Released,      ///< ̧
-        Clicked,       ///< 
+        MouseEntered,  ///< 鼠标浮于按钮上
+        MouseExited,   ///< 鼠标从按钮上移出
+        Pressed,       ///< 鼠标按下
+        Released,      ///< 鼠标抬起
+        Clicked,       ///< 鼠标点击
     };
 
     ButtonBase();
@@ -54,49 +54,49 @@ public:
     virtual ~ButtonBase();
 
     /// \~chinese
-    /// @brief ť¼ʱ
+    /// @brief 按钮事件发生时
     virtual void OnEvent(Event evt) = 0;
 
 protected:
     /// \~chinese
-    /// @brief ɫ¼
+    /// @brief 处理角色事件
     void HandleEvent(kiwano::Event* evt) override;
 };
 
 /**
  * \~chinese
- * @brief ť
+ * @brief 按钮组件
  */
 class KGE_API Button : public ButtonBase
 {
 public:
     /// \~chinese
-    /// @brief ťص
+    /// @brief 按钮回调函数
     using Callback = Function<void(Button* /* self */, Event /* evt */)>;
 
     /// \~chinese
-    /// @brief ťص
+    /// @brief 按钮点击回调函数
     using ClickedCallback = Function<void(Button* /* self */)>;
 
     Button();
 
     /// \~chinese
-    /// @brief ť
-    /// @param cb ťص
+    /// @brief 创建按钮
+    /// @param cb 按钮回调函数
     Button(const Callback& cb);
 
     /// \~chinese
-    /// @brief ðťص
-    /// @param cb ťص
+    /// @brief 设置按钮回调函数
+    /// @param cb 按钮回调函数
     void SetCallback(const Callback& cb);
 
     /// \~chinese
-    /// @brief ðťص
-    /// @param cb ťص
+    /// @brief 设置按钮回调函数
+    /// @param cb 按钮回调函数
     void SetCallbackOnClicked(const ClickedCallback& cb);
 
     /// \~chinese
-    /// @brief ť״̬仯ʱ
+    /// @brief 按钮状态变化时
     void OnEvent(Event evt) override;
 
 private:
@@ -34,7 +34,7 @@ KGE_DECLARE_SMART_PTR(Component);
 
 /**
  * \~chinese
- * \defgroup Component 
+ * \defgroup Component 组件
  */
 
 /**
@@ -44,7 +44,7 @@ KGE_DECLARE_SMART_PTR(Component);
 
 /**
  * \~chinese
- * @brief 
+ * @brief 组件
  */
 class KGE_API Component
     : public ObjectBase
@@ -53,19 +53,19 @@ class KGE_API Component
 
 public:
     /// \~chinese
-    /// @brief Ƿ
+    /// @brief 是否启用组件
     bool IsEnable() const;
 
     /// \~chinese
-    /// @brief û
+    /// @brief 设置组件启用或禁用
     void SetEnabled(bool enabled);
 
     /// \~chinese
-    /// @brief ȡ󶨵Ľɫ
+    /// @brief 获取绑定的角色
     Actor* GetBoundActor() const;
 
     /// \~chinese
-    /// @brief ӽɫƳ
+    /// @brief 从角色中移除
     void RemoveFromActor();
 
 protected:
@@ -74,23 +74,23 @@ protected:
     virtual ~Component();
 
     /// \~chinese
-    /// @brief ʼ
+    /// @brief 初始化组件
     virtual void InitComponent(Actor* actor);
 
     /// \~chinese
-    /// @brief 
+    /// @brief 销毁组件
     virtual void DestroyComponent();
 
     /// \~chinese
-    /// @brief 
+    /// @brief 更新组件
     virtual void OnUpdate(Duration dt);
 
     /// \~chinese
-    /// @brief Ⱦ
+    /// @brief 渲染组件
     virtual void OnRender(RenderContext& ctx);
 
     /// \~chinese
-    /// @brief ɫ¼
+    /// @brief 处理角色事件
     virtual void HandleEvent(Event* evt);
 
 private:
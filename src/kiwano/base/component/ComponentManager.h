@@ -31,71 +31,71 @@ namespace kiwano
  */
 
 /// \~chinese
-/// @brief ӳ
+/// @brief 组件映射
 typedef UnorderedMap<size_t, ComponentPtr> ComponentMap;
 
 /**
  * \~chinese
- * @brief 
+ * @brief 组件管理器
  */
 class KGE_API ComponentManager
 {
 public:
     /// \~chinese
-    /// @brief 
-    /// @param component 
+    /// @brief 添加组件
+    /// @param component 组件
     Component* AddComponent(ComponentPtr component);
 
     /// \~chinese
-    /// @brief 
-    /// @param index ֵ
-    /// @param component 
+    /// @brief 添加组件
+    /// @param index 索引值
+    /// @param component 组件
     Component* AddComponent(size_t index, ComponentPtr component);
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取组件
     Component* GetComponent(const String& name);
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取组件
     Component* GetComponent(size_t name_hash);
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取所有组件
     ComponentMap& GetAllComponents();
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取所有组件
     const ComponentMap& GetAllComponents() const;
 
     /// \~chinese
-    /// @brief Ƴ
+    /// @brief 移除组件
     void RemoveComponent(ComponentPtr component);
 
     /// \~chinese
-    /// @brief Ƴ
-    /// @param name 
+    /// @brief 移除组件
+    /// @param name 组件名称
     void RemoveComponent(const String& name);
 
     /// \~chinese
-    /// @brief Ƴ
-    /// @param name_hash hashֵ
+    /// @brief 移除组件
+    /// @param name_hash 组件名称hash值
     void RemoveComponent(size_t name_hash);
 
     /// \~chinese
-    /// @brief Ƴ
+    /// @brief 移除所有组件
     void RemoveAllComponents();
 
     /// \~chinese
-    /// @brief 
+    /// @brief 更新组件
     void Update(Duration dt);
 
     /// \~chinese
-    /// @brief Ⱦ
+    /// @brief 渲染组件
     void Render(RenderContext& ctx);
 
     /// \~chinese
-    /// @brief ַ¼
+    /// @brief 分发事件
     void DispatchToComponents(Event* evt);
 
 protected:
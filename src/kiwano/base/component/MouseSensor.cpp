@@ -19,7 +19,8 @@
 // THE SOFTWARE.
 
 #include <kiwano/base/component/MouseSensor.h>
-#include <kiwano/2d/Actor.h>
+#include <kiwano/2d/Stage.h>
+#include <kiwano/event/EventArena.h>
 
 namespace kiwano
 {
@@ -31,27 +32,63 @@ MouseSensor::MouseSensor()
 
 MouseSensor::~MouseSensor() {}
 
+void MouseSensor::InitComponent(Actor* actor)
+{
+    Component::InitComponent(actor);
+
+    // The stage uses the counters to route mouse events with its spatial index
+    ++actor->mouse_sensor_count_;
+}
+
+void MouseSensor::DestroyComponent()
+{
+    Actor* target = GetBoundActor();
+    if (target)
+    {
+        SetHovering(false);
+        pressed_ = false;
+
+        --target->mouse_sensor_count_;
+    }
+    Component::DestroyComponent();
+}
+
+void MouseSensor::SetHovering(bool hover)
+{
+    if (hover_ != hover)
+    {
+        hover_ = hover;
+
+        Actor* target = GetBoundActor();
+        if (hover)
+            ++target->mouse_hover_count_;
+        else
+            --target->mouse_hover_count_;
+    }
+}
+
 void MouseSensor::HandleEvent(Event* evt)
 {
     Actor* target = GetBoundActor();
     if (evt->IsType<MouseMoveEvent>())
     {
-        auto mouse_evt = dynamic_cast<MouseMoveEvent*>(evt);
-        bool contains  = target->ContainsPoint(mouse_evt->pos);
+        auto   mouse_evt = dynamic_cast<MouseMoveEvent*>(evt);
+        Stage* stage     = target->GetStage();
+        bool   contains  = stage ? stage->HitTest(target, mouse_evt->pos) : target->ContainsPoint(mouse_evt->pos);
         if (!hover_ && contains)
         {
-            hover_ = true;
+            SetHovering(true);
 
-            MouseHoverEventPtr hover = new MouseHoverEvent;
+            MouseHoverEventPtr hover = EventArena::GetInstance().Create<MouseHoverEvent>();
             hover->pos               = mouse_evt->pos;
             target->HandleEvent(hover.Get());
         }
         else if (hover_ && !contains)
         {
-            hover_   = false;
+            SetHovering(false);
             pressed_ = false;
 
-            MouseOutEventPtr out = new MouseOutEvent;
+            MouseOutEventPtr out = EventArena::GetInstance().Create<MouseOutEvent>();
             out->pos             = mouse_evt->pos;
             target->HandleEvent(out.Get());
         }
@@ -68,7 +105,7 @@ void MouseSensor::HandleEvent(Event* evt)
 
         auto mouse_up_evt = dynamic_cast<MouseUpEvent*>(evt);
 
-        MouseClickEventPtr click = new MouseClickEvent;
+        MouseClickEventPtr click = EventArena::GetInstance().Create<MouseClickEvent>();
         click->pos               = mouse_up_evt->pos;
         click->button            = mouse_up_evt->button;
         target->HandleEvent(click.Get());
@@ -34,8 +34,8 @@ KGE_DECLARE_SMART_PTR(MouseSensor);
 
 /**
  * \~chinese
- * @brief 괫
- * @details ʹɫյ Hover | Out | Click Ϣ
+ * @brief 鼠标传感器
+ * @details 该组件使角色会收到鼠标的 Hover | Out | Click 消息
  */
 class KGE_API MouseSensor : public Component
 {
@@ -45,18 +45,29 @@ public:
     virtual ~MouseSensor();
 
     /// \~chinese
-    /// @brief Ƿڽɫ
+    /// @brief 鼠标是否正悬于角色上
     bool IsHovering() const;
 
     /// \~chinese
-    /// @brief Ƿڽɫ
+    /// @brief 鼠标是否正按于角色上
     bool IsPressing() const;
 
 protected:
     /// \~chinese
-    /// @brief ɫ¼
+    /// @brief 初始化组件
+    void InitComponent(Actor* actor) override;
+
+    /// \~chinese
+    /// @brief 销毁组件
+    void DestroyComponent() override;
+
+    /// \~chinese
+    /// @brief 处理角色事件
     void HandleEvent(Event* evt) override;
 
+private:
+    void SetHovering(bool hover);
+
 private:
     bool hover_;
     bool pressed_;
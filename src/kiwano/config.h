@@ -17,6 +17,9 @@
 //#define KGE_USE_DLL
 //#define KGE_EXPORT_DLL
 
+//---- Define render engine. Defaults to using DirectX on Windows and the software rasterizer on other platforms
+//#define KGE_RENDER_ENGINE KGE_RENDER_ENGINE_SOFTWARE
+
 //---- Define DirectX version. Defaults to using Direct3D11
 //#define KGE_USE_DIRECTX10
 
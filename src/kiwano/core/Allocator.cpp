@@ -27,6 +27,11 @@ namespace memory
 
 MemoryAllocator* current_allocator_ = nullptr;
 
+void MemoryAllocator::Free(void* ptr, size_t size)
+{
+    Free(ptr);
+}
+
 MemoryAllocator* GetGlobalAllocator()
 {
     class KGE_API GlobalAllocator : public MemoryAllocator
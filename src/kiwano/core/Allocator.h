@@ -30,45 +30,58 @@ namespace memory
 {
 
 /// \~chinese
-/// @brief ڴ
+/// @brief 内存分配器
 class KGE_API MemoryAllocator
 {
 public:
     /// \~chinese
-    /// @brief ڴ
+    /// @brief 申请内存
     virtual void* Alloc(size_t size) = 0;
 
     /// \~chinese
-    /// @brief ͷڴ
+    /// @brief 释放内存
     virtual void Free(void* ptr) = 0;
+
+    /// \~chinese
+    /// @brief 释放内存
+    /// @param ptr 内存地址
+    /// @param size 申请内存时的大小
+    virtual void Free(void* ptr, size_t size);
 };
 
 /// \~chinese
-/// @brief ȡǰڴ
+/// @brief 获取当前内存分配器
 MemoryAllocator* GetAllocator();
 
 /// \~chinese
-/// @brief õǰڴ
+/// @brief 设置当前内存分配器
 void SetAllocator(MemoryAllocator* allocator);
 
 /// \~chinese
-/// @brief ʹõǰڴڴ
+/// @brief 使用当前内存分配器分配内存
 inline void* Alloc(size_t size)
 {
     return memory::GetAllocator()->Alloc(size);
 }
 
 /// \~chinese
-/// @brief ʹõǰڴͷڴ
+/// @brief 使用当前内存分配器释放内存
 inline void Free(void* ptr)
 {
     memory::GetAllocator()->Free(ptr);
 }
 
+/// \~chinese
+/// @brief 使用当前内存分配器释放已知大小的内存
+inline void Free(void* ptr, size_t size)
+{
+    memory::GetAllocator()->Free(ptr, size);
+}
+
 }  // namespace memory
 
 /// \~chinese
-/// @brief 
+/// @brief 分配器
 template <typename _Ty>
 class Allocator
 {
@@ -113,7 +126,7 @@ public:
 
     inline void deallocate(void* ptr, size_t count)
     {
-        memory::Free(ptr /*, sizeof(_Ty) * count */);
+        memory::Free(ptr, sizeof(_Ty) * count);
     }
 
     template <typename _UTy, typename... _Args>
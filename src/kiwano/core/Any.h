@@ -27,7 +27,7 @@ namespace kiwano
 {
 
 /// \~chinese
-/// @brief ɴ浥
+/// @brief 可储存单个任意对象的容器
 class Any
 {
 public:
@@ -72,7 +72,7 @@ public:
     }
 
     /// \~chinese
-    /// @brief ȡж
+    /// @brief 获取含有对象类型
     inline const std::type_info& GetType() const noexcept
     {
         const std::type_info* const info = GetTypeinfo();
@@ -84,14 +84,14 @@ public:
     }
 
     /// \~chinese
-    /// @brief Ƿж
+    /// @brief 是否含有对象
     inline bool HasValue() const noexcept
     {
         return GetTypeinfo() != nullptr;
     }
 
     /// \~chinese
-    /// @brief Ӳ
+    /// @brief 从参数构造对象
     template <typename _Ty, typename... _Args>
     void Emplace(_Args&&... args)
     {
@@ -102,7 +102,7 @@ public:
     }
 
     /// \~chinese
-    /// @brief 
+    /// @brief 交换容器
     void Swap(Any& rhs) noexcept
     {
         Any old = std::move(rhs);
@@ -111,14 +111,14 @@ public:
     }
 
     /// \~chinese
-    /// @brief 
+    /// @brief 销毁所含对象
     inline void Clear() noexcept
     {
         Tidy();
     }
 
     /// \~chinese
-    /// @brief תΪָ͵ָ
+    /// @brief 转换为指定类型的指针
     template <typename _Ty>
     _Ty* CastPtr() noexcept
     {
@@ -126,7 +126,7 @@ public:
     }
 
     /// \~chinese
-    /// @brief תΪָ͵ָ
+    /// @brief 转换为指定类型的指针
     template <typename _Ty>
     const _Ty* CastPtr() const noexcept
     {
@@ -148,8 +148,8 @@ public:
     }
 
     /// \~chinese
-    /// @brief תΪָ
-    /// @throw std::bad_cast תʧʱ׳
+    /// @brief 转换为指定类型
+    /// @throw std::bad_cast 转换失败时抛出
     template <typename _Ty>
     _Ty Cast()
     {
@@ -164,8 +164,8 @@ public:
     }
 
     /// \~chinese
-    /// @brief תΪָ
-    /// @throw std::bad_cast תʧʱ׳
+    /// @brief 转换为指定类型
+    /// @throw std::bad_cast 转换失败时抛出
     template <typename _Ty>
     _Ty Cast() const
     {
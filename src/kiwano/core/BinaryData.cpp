@@ -0,0 +1,177 @@
+// Copyright (c) 2016-2018 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <kiwano/core/BinaryData.h>
+#include <kiwano/platform/FileSystem.h>
+#include <kiwano/utils/Logger.h>
+
+#if !defined(KGE_PLATFORM_WINDOWS)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace kiwano
+{
+
+namespace
+{
+
+template <typename _Ty>
+class ContainerOwner : public RefObject
+{
+public:
+    ContainerOwner(_Ty&& data)
+        : container(std::move(data))
+    {
+    }
+
+    _Ty container;
+};
+
+class FileMappingOwner : public RefObject
+{
+public:
+    FileMappingOwner(const void* view, uint64_t size)
+        : view(view)
+        , size(size)
+    {
+    }
+
+    virtual ~FileMappingOwner()
+    {
+#if defined(KGE_PLATFORM_WINDOWS)
+        ::UnmapViewOfFile(view);
+#else
+        ::munmap(const_cast<void*>(view), size_t(size));
+#endif
+    }
+
+    const void* view;
+    uint64_t    size;
+};
+
+}  // namespace
+
+BinaryData::BinaryData(Vector<uint8_t>&& data)
+    : BinaryData()
+{
+    if (!data.empty())
+    {
+        auto owner = new ContainerOwner<Vector<uint8_t>>(std::move(data));
+        buffer_    = owner->container.data();
+        size_      = owner->container.size();
+        owner_     = owner;
+    }
+}
+
+BinaryData::BinaryData(String&& data)
+    : BinaryData()
+{
+    if (!data.empty())
+    {
+        auto owner = new ContainerOwner<String>(std::move(data));
+        buffer_    = owner->container.data();
+        size_      = owner->container.size();
+        owner_     = owner;
+    }
+}
+
+BinaryData BinaryData::Copy(const void* buffer, uint64_t size)
+{
+    if (!buffer || !size)
+        return BinaryData();
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(buffer);
+    return BinaryData(Vector<uint8_t>(bytes, bytes + size_t(size)));
+}
+
+BinaryData BinaryData::FromFile(const String& file_path)
+{
+    if (!FileSystem::GetInstance().IsFileExists(file_path))
+    {
+        KGE_WARNF("BinaryData::FromFile failed: [%s] file not found.", file_path.c_str());
+        return BinaryData();
+    }
+
+    String full_path = FileSystem::GetInstance().GetFullPathForFile(file_path);
+
+    const void* view = nullptr;
+    uint64_t    size = 0;
+
+#if defined(KGE_PLATFORM_WINDOWS)
+    // Open the file with the wide API like the other file loaders
+    WideString wide_path = strings::NarrowToWide(full_path);
+
+    HANDLE file = ::CreateFileW(wide_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (file != INVALID_HANDLE_VALUE)
+    {
+        LARGE_INTEGER file_size = {};
+        if (::GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0 && uint64_t(file_size.QuadPart) <= SIZE_MAX)
+        {
+            HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping)
+            {
+                // The view keeps the mapping alive after the handles are closed
+                view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                size = uint64_t(file_size.QuadPart);
+                ::CloseHandle(mapping);
+            }
+        }
+        ::CloseHandle(file);
+    }
+#else
+    int file = ::open(full_path.c_str(), O_RDONLY);
+    if (file != -1)
+    {
+        struct stat file_stat;
+        if (::fstat(file, &file_stat) == 0 && file_stat.st_size > 0 && uint64_t(file_stat.st_size) <= SIZE_MAX)
+        {
+            void* mapped = ::mmap(nullptr, size_t(file_stat.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+            if (mapped != MAP_FAILED)
+            {
+                view = mapped;
+                size = uint64_t(file_stat.st_size);
+            }
+        }
+        ::close(file);
+    }
+#endif
+
+    if (!view)
+    {
+        KGE_WARNF("BinaryData::FromFile failed: cannot map file [%s].", file_path.c_str());
+        return BinaryData();
+    }
+    return BinaryData(view, size, new FileMappingOwner(view, size));
+}
+
+BinaryData BinaryData::Slice(uint64_t offset, uint64_t size) const
+{
+    if (offset >= size_)
+        return BinaryData();
+
+    size = std::min(size, size_ - offset);
+    return BinaryData(GetBytes() + offset, size, owner_);
+}
+
+}  // namespace kiwano
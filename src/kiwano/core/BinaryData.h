@@ -20,31 +20,142 @@
 
 #pragma once
 #include <kiwano/core/Common.h>
+#include <kiwano/base/RefPtr.h>
 
 namespace kiwano
 {
 
-/// \~chinese
-/// @brief 
-struct KGE_API BinaryData
+/**
+ * \~chinese
+ * @brief 二进制数据
+ * @details 二进制数据是一段只读内存的视图，可以共享持有这段内存的对象。复制和截取二进制数据都不会复制内存，
+ * 最后一个共享持有者的二进制数据销毁时内存才会被释放。不持有内存的二进制数据（例如程序资源）需要调用方保证内存有效
+ */
+class KGE_API BinaryData
 {
-    void*    buffer;  ///< 
-    uint32_t size;    ///< ݴС
+public:
+    /// \~chinese
+    /// @brief 截取到数据末尾
+    static const uint64_t npos = uint64_t(-1);
 
     BinaryData();
 
+    /// \~chinese
+    /// @brief 创建不持有内存的二进制数据
+    /// @param buffer 数据
+    /// @param size 数据大小
+    BinaryData(const void* buffer, uint64_t size);
+
+    /// \~chinese
+    /// @brief 创建共享持有内存的二进制数据
+    /// @param buffer 数据
+    /// @param size 数据大小
+    /// @param owner 内存的持有者
+    BinaryData(const void* buffer, uint64_t size, RefPtr<RefObject> owner);
+
+    /// \~chinese
+    /// @brief 接管字节数组
+    BinaryData(Vector<uint8_t>&& data);
+
+    /// \~chinese
+    /// @brief 接管字符串
+    BinaryData(String&& data);
+
+    /// \~chinese
+    /// @brief 复制一段内存
+    /// @param buffer 数据
+    /// @param size 数据大小
+    static BinaryData Copy(const void* buffer, uint64_t size);
+
+    /// \~chinese
+    /// @brief 将本地文件映射到内存
+    /// @param file_path 文件路径
+    /// @return 文件数据，文件不存在或映射失败时返回无效数据
+    static BinaryData FromFile(const String& file_path);
+
+    /// \~chinese
+    /// @brief 是否有效
     bool IsValid() const;
+
+    /// \~chinese
+    /// @brief 是否持有内存
+    bool IsOwner() const;
+
+    /// \~chinese
+    /// @brief 获取数据
+    const void* GetBuffer() const;
+
+    /// \~chinese
+    /// @brief 获取数据
+    const uint8_t* GetBytes() const;
+
+    /// \~chinese
+    /// @brief 获取数据大小
+    uint64_t GetSize() const;
+
+    /// \~chinese
+    /// @brief 获取内存的持有者
+    RefPtr<RefObject> GetOwner() const;
+
+    /// \~chinese
+    /// @brief 截取一段数据，截取的数据与原数据共享内存
+    /// @param offset 起始位置
+    /// @param size 数据大小，超出末尾时截取到末尾
+    BinaryData Slice(uint64_t offset, uint64_t size = npos) const;
+
+private:
+    const void*       buffer_;
+    uint64_t          size_;
+    RefPtr<RefObject> owner_;
 };
 
 inline BinaryData::BinaryData()
-    : buffer(nullptr)
-    , size(0)
+    : buffer_(nullptr)
+    , size_(0)
+{
+}
+
+inline BinaryData::BinaryData(const void* buffer, uint64_t size)
+    : buffer_(buffer)
+    , size_(size)
+{
+}
+
+inline BinaryData::BinaryData(const void* buffer, uint64_t size, RefPtr<RefObject> owner)
+    : buffer_(buffer)
+    , size_(size)
+    , owner_(owner)
 {
 }
 
 inline bool BinaryData::IsValid() const
 {
-    return buffer != nullptr && size != 0;
+    return buffer_ != nullptr && size_ != 0;
+}
+
+inline bool BinaryData::IsOwner() const
+{
+    return owner_.Get() != nullptr;
+}
+
+inline const void* BinaryData::GetBuffer() const
+{
+    return buffer_;
+}
+
+inline const uint8_t* BinaryData::GetBytes() const
+{
+    return static_cast<const uint8_t*>(buffer_);
+}
+
+inline uint64_t BinaryData::GetSize() const
+{
+    return size_;
+}
+
+inline RefPtr<RefObject> BinaryData::GetOwner() const
+{
+    return owner_;
 }
 
 }  // namespace kiwano
@@ -41,75 +41,75 @@ namespace kiwano
 {
 
 /// \~chinese
-/// @brief 
+/// @brief 输入流
 using InputStream = std::istream;
 
 /// \~chinese
-/// @brief 
+/// @brief 输出流
 using OutputStream = std::ostream;
 
 /// \~chinese
-/// @brief ַ
+/// @brief 字符串流
 using StringStream = std::stringstream;
 
 /// \~chinese
-/// @brief ַ
+/// @brief 宽字符串流
 using WideStringStream = std::wstringstream;
 
 /// \~chinese
-/// @brief 
+/// @brief 线性数组容器
 template <typename _Ty, typename _Alloc = std::allocator<_Ty>>
 using Vector = std::vector<_Ty, _Alloc>;
 
 /// \~chinese
-/// @brief 
+/// @brief 链表容器
 template <typename _Ty, typename _Alloc = std::allocator<_Ty>>
 using List = std::list<_Ty, _Alloc>;
 
 /// \~chinese
-/// @brief ˫˶
+/// @brief 双端队列容器
 template <typename _Ty, typename _Alloc = std::allocator<_Ty>>
 using Deque = std::deque<_Ty, _Alloc>;
 
 /// \~chinese
-/// @brief 
+/// @brief 队列容器
 template <typename _Ty, typename _Container = Deque<_Ty>>
 using Queue = std::queue<_Ty, _Container>;
 
 /// \~chinese
-/// @brief 
+/// @brief 集合容器
 template <typename _Kty, typename _Compare = std::less<_Kty>, typename _Alloc = std::allocator<_Kty>>
 using Set = std::set<_Kty, _Compare, _Alloc>;
 
 /// \~chinese
-/// @brief 
+/// @brief 对容器
 template <typename _Ty1, typename _Ty2>
 using Pair = std::pair<_Ty1, _Ty2>;
 
 /// \~chinese
-/// @brief 򼯺
+/// @brief 无序集合容器
 template <typename _Kty, typename _Hash = std::hash<_Kty>, typename _Keq = std::equal_to<_Kty>,
           typename _Alloc = std::allocator<_Kty>>
 using UnorderedSet = std::unordered_set<_Kty, _Hash, _Keq, _Alloc>;
 
 /// \~chinese
-/// @brief ջ
+/// @brief 栈容器
 template <typename _Ty, typename _Container = Deque<_Ty>>
 using Stack = std::stack<_Ty, _Container>;
 
 /// \~chinese
-/// @brief 
+/// @brief 排序关联容器
 template <typename _Kty, typename _Ty, typename _Compare = std::less<_Kty>, typename _Alloc = std::allocator<Pair<const _Kty, _Ty>>>
 using Map = std::map<_Kty, _Ty, _Compare, _Alloc>;
 
 /// \~chinese
-/// @brief 
+/// @brief 非排序关联容器
 template <typename _Kty, typename _Ty, typename _Hash = std::hash<_Kty>, typename _Keq = std::equal_to<_Kty>,
           typename _Alloc = std::allocator<Pair<const _Kty, _Ty>>>
 using UnorderedMap = std::unordered_map<_Kty, _Ty, _Hash, _Keq, _Alloc>;
 
 /// \~chinese
-/// @brief ɿ
+/// @brief 不可拷贝对象
 class Noncopyable
 {
 protected:
@@ -132,7 +132,7 @@ Duration Duration::Parse(const String& format)
         return ret;
     }
 
-    // λ
+    // 符号位
     if (format[0] == '-' || format[0] == '+')
     {
         negative = (format[0] == '-');
@@ -141,7 +141,7 @@ Duration Duration::Parse(const String& format)
 
     while (pos < len)
     {
-        // ֵ
+        // 数值
         size_t i = pos;
         for (; i < len; ++i)
         {
@@ -159,7 +159,7 @@ Duration Duration::Parse(const String& format)
         if (num_str.empty() || num_str == ".")
             KGE_THROW("Duration::Parse failed, invalid duration");
 
-        // λ
+        // 单位
         for (; i < len; ++i)
         {
             wchar_t ch = format[i];
@@ -26,93 +26,93 @@ namespace kiwano
 
 /**
  * \~chinese
- * @brief ʱ
+ * @brief 时间段
  * @par
- *   ʱαʾ:
+ *   时间段表示法:
  *   @code
- *     time::Millisecond * 50  // 50 
- *     time::Second * 5  // 5 
- *     time::Hour * 1.5  // 1.5 Сʱ
- *     time::Hour * 3 + time::Minute * 45 + time::Second * 15  // 3 Сʱ 45  15
+ *     time::Millisecond * 50  // 50 毫秒
+ *     time::Second * 5  // 5 秒
+ *     time::Hour * 1.5  // 1.5 小时
+ *     time::Hour * 3 + time::Minute * 45 + time::Second * 15  // 3 小时 45 分 15秒
  *   @endcode
- *    VS2015 ߰汾ʹ time literals:
+ *   在 VS2015 及更高版本可以使用 time literals:
  *   @code
  *     using namespace kiwano;
- *     50_msec                   // 50 
- *     5_sec                     // 5 
- *     1.5_hour                  // 1.5 Сʱ
- *     3_hour + 45_min + 15_sec  // 3 Сʱ 45  15 
+ *     50_msec                   // 50 毫秒
+ *     5_sec                     // 5 秒
+ *     1.5_hour                  // 1.5 小时
+ *     3_hour + 45_min + 15_sec  // 3 小时 45 分 15 秒
  *   @endcode
  */
 struct KGE_API Duration
 {
     /// \~chinese
-    /// @brief ʱ
+    /// @brief 构造时间段
     Duration();
 
     /// \~chinese
-    /// @brief ʱ
-    /// @param milliseconds 
+    /// @brief 构造时间段
+    /// @param milliseconds 毫秒数
     Duration(int64_t milliseconds);
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取毫秒数
     int64_t GetMilliseconds() const;
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取秒数
     float GetSeconds() const;
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取分钟数
     float GetMinutes() const;
 
     /// \~chinese
-    /// @brief ȡСʱ
+    /// @brief 获取小时数
     float GetHours() const;
 
     /// \~chinese
-    /// @brief ʱǷ
-    /// @return ʱ㣬true
+    /// @brief 时长是否是零
+    /// @return 若时长是零，返回true
     bool IsZero() const;
 
     /// \~chinese
-    /// @brief ú
-    /// @param ms 
+    /// @brief 设置毫秒数
+    /// @param ms 毫秒数
     void SetMilliseconds(int64_t ms);
 
     /// \~chinese
-    /// @brief 
-    /// @param seconds 
+    /// @brief 设置秒数
+    /// @param seconds 秒数
     void SetSeconds(float seconds);
 
     /// \~chinese
-    /// @brief ÷
-    /// @param minutes 
+    /// @brief 设置分钟数
+    /// @param minutes 分钟数
     void SetMinutes(float minutes);
 
     /// \~chinese
-    /// @brief Сʱ
-    /// @param hours Сʱ
+    /// @brief 设置小时数
+    /// @param hours 小时数
     void SetHours(float hours);
 
     /// \~chinese
-    /// @brief 
+    /// @brief 休眠
     void Sleep() const;
 
     /// \~chinese
-    /// @brief תΪַ
+    /// @brief 转为字符串
     String ToString() const;
 
     /// \~chinese
-    /// @brief ʱַ
-    /// @param str ʱַ
+    /// @brief 解析时间段字符串
+    /// @param str 时间段字符串
     /// @details
-    ///   ʱַзŵĸ, Ҵʱ䵥λ׺
-    ///   : "300ms", "-1.5h", "2h45m"
-    ///   ʱ䵥λ "ms", "s", "m", "h"
-    /// @return ʱ
-    /// @throw kiwano::RuntimeError һϷĸʽʱ׳
+    ///   时间段字符串允许是有符号的浮点数, 并且带有时间单位后缀
+    ///   例如: "300ms", "-1.5h", "2h45m"
+    ///   允许的时间单位有 "ms", "s", "m", "h"
+    /// @return 解析出的时间段
+    /// @throw kiwano::RuntimeError 传入一个不合法的格式时抛出
     static Duration Parse(const String& str);
 
     bool operator==(const Duration&) const;
@@ -160,10 +160,10 @@ private:
 namespace time
 {
 
-extern const Duration Millisecond;  ///< 
-extern const Duration Second;       ///< 
-extern const Duration Minute;       ///< 
-extern const Duration Hour;         ///< Сʱ
+extern const Duration Millisecond;  ///< 毫秒
+extern const Duration Second;       ///< 秒
+extern const Duration Minute;       ///< 分钟
+extern const Duration Hour;         ///< 小时
 
 }  // namespace time
 
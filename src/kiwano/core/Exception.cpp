@@ -298,6 +298,29 @@ void StackTracer::Print() const
     g_DbgHelp.SymCleanup(hProcess);
 }
 
+}  // namespace kiwano
+
+#else
+
+#if defined(KGE_PLATFORM_LINUX)
+#include <execinfo.h>
+#include <unistd.h>
+#endif
+
+namespace kiwano
+{
+
+StackTracer::StackTracer() {}
+
+void StackTracer::Print() const
+{
+#if defined(KGE_PLATFORM_LINUX)
+    void* frames[64];
+    int   count = ::backtrace(frames, 64);
+    ::backtrace_symbols_fd(frames, count, STDERR_FILENO);
 #endif
+}
 
 }  // namespace kiwano
+
+#endif
@@ -27,15 +27,15 @@ namespace kiwano
 {
 
 /// \~chinese
-/// @brief 쳣
+/// @brief 异常
 typedef std::exception Exception;
 
 /// \~chinese
-/// @brief ʱ쳣
+/// @brief 运行时异常
 typedef std::runtime_error RuntimeError;
 
 /// \~chinese
-/// @brief ϵͳ쳣
+/// @brief 系统异常
 typedef std::system_error SystemError;
 
 class StackTracer
@@ -61,6 +61,15 @@ struct IsCallable : public std::bool_constant<IsCallableHelper<_Ty, _Ret, _Args.
 {
 };
 
+//
+// Storage
+//
+
+// Large enough for a vtable pointer, an object pointer and a member function pointer
+constexpr auto FUNCTION_STORAGE_SIZE = 4 * sizeof(void*);
+
+typedef typename std::aligned_storage<FUNCTION_STORAGE_SIZE, alignof(void*)>::type FunctionStorage;
+
 //
 // Callable
 //
@@ -71,155 +80,282 @@ class Callable
 public:
     virtual ~Callable() {}
 
-    virtual void Retain()                      = 0;
-    virtual void Release()                     = 0;
     virtual _Ret Invoke(_Args&&... args) const = 0;
 
+    virtual Callable* Clone(void* storage) = 0;
+
+    virtual Callable* Move(void* storage) noexcept = 0;
+
+    virtual void Destroy() noexcept = 0;
+
     virtual const std::type_info& TargetType() const noexcept = 0;
 
     virtual const void* Target(const std::type_info& type) const noexcept = 0;
 };
 
-template <typename _Ret, typename... _Args>
-class RefCountCallable : public Callable<_Ret, _Args...>
+template <typename _Ty, typename _Ret, typename... _Args>
+class ProxyCallable : public Callable<_Ret, _Args...>
 {
 public:
-    RefCountCallable()
-        : ref_count_(0)
+    ProxyCallable(_Ty&& val)
+        : callee_(std::move(val))
     {
     }
 
-    virtual void Retain() override
+    virtual _Ret Invoke(_Args&&... args) const override
     {
-        ++ref_count_;
+        return std::invoke(callee_, std::forward<_Args>(args)...);
     }
 
-    virtual void Release() override
+    virtual const std::type_info& TargetType() const noexcept override
     {
-        --ref_count_;
-        if (ref_count_ <= 0)
-        {
-            delete this;
-        }
+        return typeid(_Ty);
     }
 
-private:
-    int ref_count_;
+    virtual const void* Target(const std::type_info& type) const noexcept override
+    {
+        if (type == this->TargetType())
+            return &callee_;
+        return nullptr;
+    }
+
+protected:
+    _Ty callee_;
 };
 
+// Callable stored in the small buffer of a function, copies are always deep
 template <typename _Ty, typename _Ret, typename... _Args>
-class ProxyCallable : public RefCountCallable<_Ret, _Args...>
+class InlineCallable final : public ProxyCallable<_Ty, _Ret, _Args...>
 {
 public:
-    ProxyCallable(_Ty&& val)
-        : callee_(std::move(val))
+    InlineCallable(_Ty&& val)
+        : ProxyCallable<_Ty, _Ret, _Args...>(std::move(val))
     {
     }
 
-    virtual _Ret Invoke(_Args&&... args) const override
+    virtual Callable<_Ret, _Args...>* Clone(void* storage) override
     {
-        return std::invoke(callee_, std::forward<_Args>(args)...);
+        return CloneImpl(storage, std::is_copy_constructible<_Ty>{});
     }
 
-    virtual const std::type_info& TargetType() const noexcept
+    virtual Callable<_Ret, _Args...>* Move(void* storage) noexcept override
     {
-        return typeid(_Ty);
+        auto ptr = ::new (storage) InlineCallable(std::move(this->callee_));
+        this->~InlineCallable();
+        return ptr;
     }
 
-    virtual const void* Target(const std::type_info& type) const noexcept
+    virtual void Destroy() noexcept override
     {
-        if (type == this->TargetType())
-            return &callee_;
-        return nullptr;
+        this->~InlineCallable();
     }
 
-    static inline Callable<_Ret, _Args...>* Make(_Ty&& val)
+    static inline Callable<_Ret, _Args...>* Make(void* storage, _Ty&& val)
     {
-        return new (std::nothrow) ProxyCallable<_Ty, _Ret, _Args...>(std::move(val));
+        return ::new (storage) InlineCallable(std::move(val));
     }
 
 private:
-    _Ty callee_;
+    Callable<_Ret, _Args...>* CloneImpl(void* storage, std::true_type)
+    {
+        _Ty copy(this->callee_);
+        return ::new (storage) InlineCallable(std::move(copy));
+    }
+
+    Callable<_Ret, _Args...>* CloneImpl(void*, std::false_type)
+    {
+        // Move-only callables are never copied, see UniqueFunction
+        return nullptr;
+    }
 };
 
+// Callable stored on heap, copies share the same object
 template <typename _Ty, typename _Ret, typename... _Args>
-class ProxyMemCallable : public RefCountCallable<_Ret, _Args...>
+class HeapCallable final : public ProxyCallable<_Ty, _Ret, _Args...>
 {
 public:
-    typedef _Ret (_Ty::*_FuncType)(_Args...);
-
-    virtual _Ret Invoke(_Args&&... args) const override
+    HeapCallable(_Ty&& val)
+        : ProxyCallable<_Ty, _Ret, _Args...>(std::move(val))
+        , ref_count_(1)
     {
-        return std::invoke(func_, ptr_, std::forward<_Args>(args)...);
     }
 
-    virtual const std::type_info& TargetType() const noexcept
+    virtual Callable<_Ret, _Args...>* Clone(void*) override
     {
-        return typeid(ProxyMemCallable);
+        ++ref_count_;
+        return this;
     }
 
-    virtual const void* Target(const std::type_info& type) const noexcept
+    virtual Callable<_Ret, _Args...>* Move(void*) noexcept override
     {
-        if (type == this->TargetType())
-            return this;
-        return nullptr;
+        return this;
     }
 
-    static inline Callable<_Ret, _Args...>* Make(_Ty* ptr, _FuncType func)
+    virtual void Destroy() noexcept override
     {
-        return new (std::nothrow) ProxyMemCallable<_Ty, _Ret, _Args...>(ptr, func);
+        --ref_count_;
+        if (ref_count_ <= 0)
+        {
+            delete this;
+        }
     }
 
-protected:
-    ProxyMemCallable(_Ty* ptr, _FuncType func)
-        : ptr_(ptr)
-        , func_(func)
+    static inline Callable<_Ret, _Args...>* Make(void*, _Ty&& val)
     {
+        return new (std::nothrow) HeapCallable(std::move(val));
     }
 
-protected:
-    _Ty*      ptr_;
-    _FuncType func_;
+private:
+    int ref_count_;
+};
+
+template <typename _Ty, typename _Ret, typename... _Args>
+struct IsInlineCallable
+    : public std::bool_constant<sizeof(InlineCallable<_Ty, _Ret, _Args...>) <= sizeof(FunctionStorage)
+                                && alignof(InlineCallable<_Ty, _Ret, _Args...>) <= alignof(FunctionStorage)
+                                && std::is_nothrow_move_constructible<_Ty>::value>
+{
 };
 
 template <typename _Ty, typename _Ret, typename... _Args>
-class ProxyConstMemCallable : public RefCountCallable<_Ret, _Args...>
+inline Callable<_Ret, _Args...>* MakeCallable(void* storage, _Ty&& val)
+{
+    typedef typename std::conditional<IsInlineCallable<_Ty, _Ret, _Args...>::value, InlineCallable<_Ty, _Ret, _Args...>,
+                                      HeapCallable<_Ty, _Ret, _Args...>>::type _CallableType;
+
+    return _CallableType::Make(storage, std::move(val));
+}
+
+// Binds an object to one of its member functions
+template <typename _Ty, typename _FuncType>
+struct MemberCallee
+{
+    _Ty*      ptr;
+    _FuncType func;
+
+    template <typename... _Args>
+    inline decltype(auto) operator()(_Args&&... args) const
+    {
+        return std::invoke(func, ptr, std::forward<_Args>(args)...);
+    }
+};
+
+//
+// FunctionBase
+//
+
+template <typename _Ret, typename... _Args>
+class FunctionBase
 {
 public:
-    typedef _Ret (_Ty::*_FuncType)(_Args...) const;
+    inline _Ret operator()(_Args... args) const
+    {
+        if (!callable_)
+            throw std::bad_function_call();
+        return callable_->Invoke(std::forward<_Args>(args)...);
+    }
 
-    virtual _Ret Invoke(_Args&&... args) const override
+    inline operator bool() const
     {
-        return std::invoke(func_, ptr_, std::forward<_Args>(args)...);
+        return !!callable_;
     }
 
-    virtual const std::type_info& TargetType() const noexcept
+    const std::type_info& target_type() const noexcept
     {
-        return typeid(ProxyConstMemCallable);
+        if (!callable_)
+            return typeid(void);
+        return callable_->TargetType();
     }
 
-    virtual const void* Target(const std::type_info& type) const noexcept
+    template <class _Fx>
+    _Fx* target() noexcept
     {
-        if (type == this->TargetType())
-            return this;
-        return nullptr;
+        if (!callable_)
+            return nullptr;
+        return reinterpret_cast<_Fx*>(const_cast<void*>(callable_->Target(typeid(_Fx))));
     }
 
-    static inline Callable<_Ret, _Args...>* Make(_Ty* ptr, _FuncType func)
+    template <class _Fx>
+    const _Fx* target() const noexcept
     {
-        return new (std::nothrow) ProxyConstMemCallable<_Ty, _Ret, _Args...>(ptr, func);
+        if (!callable_)
+            return nullptr;
+        return reinterpret_cast<const _Fx*>(callable_->Target(typeid(_Fx)));
     }
 
 protected:
-    ProxyConstMemCallable(_Ty* ptr, _FuncType func)
-        : ptr_(ptr)
-        , func_(func)
+    FunctionBase()
+        : callable_(nullptr)
     {
     }
 
-protected:
-    _Ty*      ptr_;
-    _FuncType func_;
+    FunctionBase(const FunctionBase&) = delete;
+
+    FunctionBase& operator=(const FunctionBase&) = delete;
+
+    ~FunctionBase()
+    {
+        Reset();
+    }
+
+    template <typename _Ty>
+    inline void Emplace(_Ty&& val)
+    {
+        Reset();
+        callable_ = details::MakeCallable<_Ty, _Ret, _Args...>(&storage_, std::move(val));
+    }
+
+    template <typename _Ty, typename _FuncType>
+    inline void EmplaceMember(_Ty* ptr, _FuncType func)
+    {
+        Emplace(details::MemberCallee<_Ty, _FuncType>{ ptr, func });
+    }
+
+    inline void CopyFrom(const FunctionBase& rhs)
+    {
+        if (this != &rhs)
+        {
+            Reset();
+            if (rhs.callable_)
+            {
+                callable_ = rhs.callable_->Clone(&storage_);
+            }
+        }
+    }
+
+    inline void MoveFrom(FunctionBase&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            Reset();
+            if (rhs.callable_)
+            {
+                callable_     = rhs.callable_->Move(&storage_);
+                rhs.callable_ = nullptr;
+            }
+        }
+    }
+
+    inline void Reset() noexcept
+    {
+        if (callable_)
+        {
+            callable_->Destroy();
+            callable_ = nullptr;
+        }
+    }
+
+    inline void Swap(FunctionBase& rhs) noexcept
+    {
+        FunctionBase temp;
+        temp.MoveFrom(std::move(rhs));
+        rhs.MoveFrom(std::move(*this));
+        this->MoveFrom(std::move(temp));
+    }
+
+private:
+    Callable<_Ret, _Args...>* callable_;
+    FunctionStorage           storage_;
 };
 
 }  // namespace details
@@ -227,138 +363,155 @@ protected:
 template <typename _Ty>
 class Function;
 
+template <typename _Ty>
+class UniqueFunction;
+
+/// \~chinese
+/// @brief 函数封装器
+/// @details 不超过三个指针大小的可调用对象（包括成员函数绑定）直接存储在对象内部，不会分配堆内存；
+/// 更大的可调用对象存储在堆上，复制时共享同一份对象
 template <typename _Ret, typename... _Args>
-class Function<_Ret(_Args...)>
+class Function<_Ret(_Args...)> : public details::FunctionBase<_Ret, _Args...>
 {
 public:
-    Function()
-        : callable_(nullptr)
-    {
-    }
+    Function() {}
 
-    Function(std::nullptr_t)
-        : callable_(nullptr)
-    {
-    }
+    Function(std::nullptr_t) {}
 
     Function(const Function& rhs)
-        : callable_(nullptr)
     {
-        SetCallable(rhs.callable_);
+        this->CopyFrom(rhs);
     }
 
     Function(Function&& rhs) noexcept
-        : callable_(rhs.callable_)
     {
-        rhs.callable_ = nullptr;
+        this->MoveFrom(std::move(rhs));
     }
 
     Function(_Ret (*func)(_Args...))
-        : callable_(nullptr)
     {
-        SetCallable(details::ProxyCallable<_Ret (*)(_Args...), _Ret, _Args...>::Make(std::move(func)));
+        if (func)
+        {
+            this->Emplace(std::move(func));
+        }
     }
 
     template <typename _Ty,
-              typename = typename std::enable_if<details::IsCallable<_Ty, _Ret, _Args...>::value, int>::type>
+              typename = typename std::enable_if<details::IsCallable<_Ty, _Ret, _Args...>::value
+                                                     && std::is_copy_constructible<_Ty>::value,
+                                                 int>::type>
     Function(_Ty val)
-        : callable_(nullptr)
     {
-        SetCallable(details::ProxyCallable<_Ty, _Ret, _Args...>::Make(std::move(val)));
+        this->Emplace(std::move(val));
     }
 
     template <typename _Ty, typename _Uty,
               typename = typename std::enable_if<std::is_same<_Ty, _Uty>::value || std::is_base_of<_Ty, _Uty>::value,
                                                  int>::type>
     Function(_Uty* ptr, _Ret (_Ty::*func)(_Args...))
-        : callable_(nullptr)
     {
-        SetCallable(details::ProxyMemCallable<_Ty, _Ret, _Args...>::Make(ptr, func));
+        this->EmplaceMember(static_cast<_Ty*>(ptr), func);
     }
 
     template <typename _Ty, typename _Uty,
               typename = typename std::enable_if<std::is_same<_Ty, _Uty>::value || std::is_base_of<_Ty, _Uty>::value,
                                                  int>::type>
     Function(_Uty* ptr, _Ret (_Ty::*func)(_Args...) const)
-        : callable_(nullptr)
     {
-        SetCallable(details::ProxyConstMemCallable<_Ty, _Ret, _Args...>::Make(ptr, func));
+        this->EmplaceMember(static_cast<_Ty*>(ptr), func);
     }
 
-    ~Function()
+    inline Function& operator=(const Function& rhs)
     {
-        SetCallable(nullptr);
+        this->CopyFrom(rhs);
+        return (*this);
     }
 
-    inline _Ret operator()(_Args... args) const
+    inline Function& operator=(Function&& rhs) noexcept
     {
-        if (!callable_)
-            throw std::bad_function_call();
-        return callable_->Invoke(std::forward<_Args>(args)...);
+        this->MoveFrom(std::move(rhs));
+        return (*this);
     }
 
-    inline operator bool() const
+    inline void swap(Function& rhs) noexcept
     {
-        return !!callable_;
+        this->Swap(rhs);
     }
+};
 
-    inline Function& operator=(const Function& rhs)
+/// \~chinese
+/// @brief 仅可移动的函数封装器
+/// @details 可以保存仅可移动的可调用对象（如捕获了 std::unique_ptr 的 lambda），存储策略与 Function 相同
+template <typename _Ret, typename... _Args>
+class UniqueFunction<_Ret(_Args...)> : public details::FunctionBase<_Ret, _Args...>
+{
+public:
+    UniqueFunction() {}
+
+    UniqueFunction(std::nullptr_t) {}
+
+    UniqueFunction(const UniqueFunction&) = delete;
+
+    UniqueFunction(UniqueFunction&& rhs) noexcept
     {
-        SetCallable(rhs.callable_);
-        return (*this);
+        this->MoveFrom(std::move(rhs));
     }
 
-    inline Function& operator=(Function&& rhs)
+    UniqueFunction(const Function<_Ret(_Args...)>& rhs)
     {
-        SetCallable(nullptr);
-        callable_     = rhs.callable_;
-        rhs.callable_ = nullptr;
-        return (*this);
+        this->CopyFrom(rhs);
     }
 
-    inline void swap(const Function& rhs)
+    UniqueFunction(Function<_Ret(_Args...)>&& rhs) noexcept
     {
-        std::swap(callable_, rhs.callable_);
+        this->MoveFrom(std::move(rhs));
     }
 
-    const std::type_info& target_type() const noexcept
+    UniqueFunction(_Ret (*func)(_Args...))
     {
-        return callable_->TargetType();
+        if (func)
+        {
+            this->Emplace(std::move(func));
+        }
     }
 
-    template <class _Fx>
-    _Fx* target() noexcept
+    template <typename _Ty,
+              typename = typename std::enable_if<details::IsCallable<_Ty, _Ret, _Args...>::value
+                                                     && std::is_move_constructible<_Ty>::value,
+                                                 int>::type>
+    UniqueFunction(_Ty val)
     {
-        return reinterpret_cast<_Fx*>(const_cast<void*>(callable_->Target(typeid(_Fx))));
+        this->Emplace(std::move(val));
     }
 
-    template <class _Fx>
-    const _Fx* target() const noexcept
+    template <typename _Ty, typename _Uty,
+              typename = typename std::enable_if<std::is_same<_Ty, _Uty>::value || std::is_base_of<_Ty, _Uty>::value,
+                                                 int>::type>
+    UniqueFunction(_Uty* ptr, _Ret (_Ty::*func)(_Args...))
     {
-        return reinterpret_cast<const _Fx*>(callable_->Target(typeid(_Fx)));
+        this->EmplaceMember(static_cast<_Ty*>(ptr), func);
     }
 
-private:
-    inline void SetCallable(details::Callable<_Ret, _Args...>* callable)
+    template <typename _Ty, typename _Uty,
+              typename = typename std::enable_if<std::is_same<_Ty, _Uty>::value || std::is_base_of<_Ty, _Uty>::value,
+                                                 int>::type>
+    UniqueFunction(_Uty* ptr, _Ret (_Ty::*func)(_Args...) const)
     {
-        if (callable_ != callable)
-        {
-            if (callable_)
-            {
-                callable_->Release();
-                callable_ = nullptr;
-            }
+        this->EmplaceMember(static_cast<_Ty*>(ptr), func);
+    }
 
-            callable_ = callable;
-            if (callable_)
-            {
-                callable_->Retain();
-            }
-        }
+    UniqueFunction& operator=(const UniqueFunction&) = delete;
+
+    inline UniqueFunction& operator=(UniqueFunction&& rhs) noexcept
+    {
+        this->MoveFrom(std::move(rhs));
+        return (*this);
     }
 
-private:
-    details::Callable<_Ret, _Args...>* callable_;
+    inline void swap(UniqueFunction& rhs) noexcept
+    {
+        this->Swap(rhs);
+    }
 };
 
 template <
@@ -385,4 +538,10 @@ inline void swap(kiwano::Function<_Ret(_Args...)>& lhs, kiwano::Function<_Ret(_A
     lhs.swap(rhs);
 }
 
+template <typename _Ret, typename... _Args>
+inline void swap(kiwano::UniqueFunction<_Ret(_Args...)>& lhs, kiwano::UniqueFunction<_Ret(_Args...)>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
 }  // namespace kiwano
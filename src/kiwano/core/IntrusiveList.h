@@ -28,7 +28,7 @@ namespace kiwano
 {
 
 /// \~chinese
-/// @brief ʽ
+/// @brief 侵入式链表
 template <typename _PtrTy>
 class IntrusiveList
 {
@@ -49,42 +49,42 @@ public:
     }
 
     /// \~chinese
-    /// @brief ȡԪ
+    /// @brief 获取首元素
     const value_type& GetFirst() const
     {
         return first_;
     }
 
     /// \~chinese
-    /// @brief ȡԪ
+    /// @brief 获取首元素
     value_type& GetFirst()
     {
         return first_;
     }
 
     /// \~chinese
-    /// @brief ȡβԪ
+    /// @brief 获取尾元素
     const value_type& GetLast() const
     {
         return last_;
     }
 
     /// \~chinese
-    /// @brief ȡβԪ
+    /// @brief 获取尾元素
     value_type& GetLast()
     {
         return last_;
     }
 
     /// \~chinese
-    /// @brief ǷΪ
+    /// @brief 链表是否为空
     inline bool IsEmpty() const
     {
         return first_ == nullptr;
     }
 
     /// \~chinese
-    /// @brief βӶ
+    /// @brief 在链表尾部添加对象
     void PushBack(reference child)
     {
         if (child->prev_)
@@ -108,7 +108,7 @@ public:
     }
 
     /// \~chinese
-    /// @brief ͷӶ
+    /// @brief 在链表头部添加对象
     void PushFront(reference child)
     {
         if (child->prev_)
@@ -132,7 +132,7 @@ public:
     }
 
     /// \~chinese
-    /// @brief Ķǰ¶
+    /// @brief 在链表的对象前插入新对象
     void InsertBefore(reference child, reference before)
     {
         if (child->prev_)
@@ -151,7 +151,7 @@ public:
     }
 
     /// \~chinese
-    /// @brief Ķ¶
+    /// @brief 在链表的对象后插入新对象
     void InsertAfter(reference child, reference after)
     {
         if (child->prev_)
@@ -170,7 +170,7 @@ public:
     }
 
     /// \~chinese
-    /// @brief Ƴ
+    /// @brief 移除对象
     void Remove(reference child)
     {
         if (child->next_)
@@ -196,7 +196,7 @@ public:
     }
 
     /// \~chinese
-    /// @brief ж
+    /// @brief 清空所有对象
     void Clear()
     {
         value_type p = first_;
@@ -215,7 +215,7 @@ public:
     }
 
     /// \~chinese
-    /// @brief ǷЧ
+    /// @brief 检查链表是否有效
     bool CheckValid()
     {
         if (!first_)
@@ -429,7 +429,7 @@ private:
 
 
 /// \~chinese
-/// @brief ʽԪ
+/// @brief 侵入式链表元素
 template <typename _PtrTy>
 class IntrusiveListValue
 {
@@ -456,28 +456,28 @@ public:
     }
 
     /// \~chinese
-    /// @brief ȡǰһԪ
+    /// @brief 获取前一元素
     const value_type& GetPrev() const
     {
         return prev_;
     }
 
     /// \~chinese
-    /// @brief ȡǰһԪ
+    /// @brief 获取前一元素
     value_type& GetPrev()
     {
         return prev_;
     }
 
     /// \~chinese
-    /// @brief ȡһԪ
+    /// @brief 获取下一元素
     const value_type& GetNext() const
     {
         return next_;
     }
 
     /// \~chinese
-    /// @brief ȡһԪ
+    /// @brief 获取下一元素
     value_type& GetNext()
     {
         return next_;
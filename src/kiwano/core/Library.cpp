@@ -20,6 +20,10 @@
 
 #include <kiwano/core/Library.h>
 
+#if !defined(KGE_PLATFORM_WINDOWS)
+#include <dlfcn.h>
+#endif
+
 namespace kiwano
 {
 
@@ -41,7 +45,11 @@ Library::~Library()
 
 bool Library::Load(const String& lib)
 {
+#if defined(KGE_PLATFORM_WINDOWS)
     instance_ = ::LoadLibraryA(lib.c_str());
+#else
+    instance_ = ::dlopen(lib.c_str(), RTLD_NOW);
+#endif
     return IsValid();
 }
 
@@ -54,18 +62,30 @@ void Library::Free()
 {
     if (instance_)
     {
+#if defined(KGE_PLATFORM_WINDOWS)
         ::FreeLibrary(instance_);
+#else
+        ::dlclose(instance_);
+#endif
         instance_ = nullptr;
     }
 }
 
+#if defined(KGE_PLATFORM_WINDOWS)
 FARPROC Library::GetProcess(const String& proc_name)
+#else
+void* Library::GetProcess(const String& proc_name)
+#endif
 {
     KGE_ASSERT(instance_ != nullptr);
 
     if (!IsValid())
         return nullptr;
+#if defined(KGE_PLATFORM_WINDOWS)
     return GetProcAddress(instance_, proc_name.c_str());
+#else
+    return ::dlsym(instance_, proc_name.c_str());
+#endif
 }
 
 }  // namespace kiwano
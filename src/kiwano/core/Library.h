@@ -25,43 +25,47 @@ namespace kiwano
 {
 /**
  * \~chinese
- * @brief DLL
+ * @brief DLL库
  */
 class KGE_API Library
 {
 public:
     /// \~chinese
-    /// @brief DLL
+    /// @brief 构造DLL库
     Library();
 
     /// \~chinese
-    /// @brief DLL
-    /// @param lib DLLļ·
+    /// @brief 构造DLL库
+    /// @param lib DLL文件路径
     Library(const String& lib);
 
     virtual ~Library();
 
     /// \~chinese
-    /// @brief DLL
-    /// @param lib DLLļ·
+    /// @brief 加载DLL
+    /// @param lib DLL文件路径
     bool Load(const String& lib);
 
     /// \~chinese
-    /// @brief ǷЧ
+    /// @brief 是否有效
     bool IsValid() const;
 
     /// \~chinese
-    /// @brief ͷDLL
+    /// @brief 释放DLL
     void Free();
 
     /// \~chinese
-    /// @brief ָDLLе⺯ַ
-    /// @param proc_name 
+    /// @brief 检索指定的DLL中的输出库函数地址
+    /// @param proc_name 函数名
+#if defined(KGE_PLATFORM_WINDOWS)
     FARPROC GetProcess(const String& proc_name);
+#else
+    void* GetProcess(const String& proc_name);
+#endif
 
     /// \~chinese
-    /// @brief ָDLLе⺯ַ
-    /// @param proc_name 
+    /// @brief 检索指定的DLL中的输出库函数地址
+    /// @param proc_name 函数名
     template <typename _Proc>
     inline _Proc GetProcess(const String& proc_name)
     {
@@ -69,6 +73,10 @@ public:
     }
 
 private:
+#if defined(KGE_PLATFORM_WINDOWS)
     HMODULE instance_;
+#else
+    void* instance_;
+#endif
 };
 }  // namespace kiwano
@@ -0,0 +1,237 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <kiwano/core/Common.h>
+
+namespace kiwano
+{
+
+/// \~chinese
+/// @brief 缓存统计数据
+struct CacheStats
+{
+    uint64_t hits;       ///< 命中次数
+    uint64_t misses;     ///< 未命中次数
+    uint64_t evictions;  ///< 淘汰次数
+    size_t   count;      ///< 缓存的对象数量
+    size_t   memory;     ///< 缓存的对象占用的内存（字节）
+    size_t   budget;     ///< 内存预算（字节），为零时不限制
+
+    CacheStats()
+        : hits(0)
+        , misses(0)
+        , evictions(0)
+        , count(0)
+        , memory(0)
+        , budget(0)
+    {
+    }
+};
+
+/// \~chinese
+/// @brief 按内存预算淘汰对象的 LRU 缓存
+/// @details 缓存的对象按最近一次使用的顺序排列，占用内存超出预算时，
+/// 从最久未使用的对象开始淘汰。仍在缓存外被引用的对象不会被淘汰
+/// @tparam _Kty 键类型
+/// @tparam _PtrTy 引用计数对象的智能指针类型
+/// @tparam _Hash 键的哈希函数
+template <typename _Kty, typename _PtrTy, typename _Hash = std::hash<_Kty>>
+class LruCache
+{
+public:
+    using key_type   = _Kty;
+    using value_type = _PtrTy;
+
+    LruCache() = default;
+
+    /// \~chinese
+    /// @brief 获取对象，并标记为最近使用
+    /// @return 对象不存在时返回空指针
+    value_type Get(const key_type& key)
+    {
+        auto iter = index_.find(key);
+        if (iter == index_.end())
+        {
+            ++stats_.misses;
+            return nullptr;
+        }
+
+        ++stats_.hits;
+        entries_.splice(entries_.begin(), entries_, iter->second);
+        return iter->second->value;
+    }
+
+    /// \~chinese
+    /// @brief 获取对象，不影响使用顺序和统计数据
+    value_type Peek(const key_type& key) const
+    {
+        auto iter = index_.find(key);
+        if (iter == index_.end())
+            return nullptr;
+        return iter->second->value;
+    }
+
+    /// \~chinese
+    /// @brief 添加对象，已存在的同名对象将被替换
+    /// @param key 键
+    /// @param value 对象
+    /// @param memory 对象占用的内存（字节）
+    void Add(const key_type& key, value_type value, size_t memory)
+    {
+        Remove(key);
+
+        entries_.push_front(Entry{ key, value, memory });
+        index_.insert(std::make_pair(key, entries_.begin()));
+
+        stats_.count++;
+        stats_.memory += memory;
+        Trim();
+    }
+
+    /// \~chinese
+    /// @brief 移除对象
+    bool Remove(const key_type& key)
+    {
+        auto iter = index_.find(key);
+        if (iter == index_.end())
+            return false;
+
+        stats_.count--;
+        stats_.memory -= iter->second->memory;
+        entries_.erase(iter->second);
+        index_.erase(iter);
+        return true;
+    }
+
+    /// \~chinese
+    /// @brief 清空缓存
+    void Clear()
+    {
+        entries_.clear();
+        index_.clear();
+        stats_.count  = 0;
+        stats_.memory = 0;
+    }
+
+    /// \~chinese
+    /// @brief 设置内存预算
+    /// @param budget 内存预算（字节），为零时不限制
+    void SetMemoryBudget(size_t budget)
+    {
+        stats_.budget = budget;
+        Trim();
+    }
+
+    /// \~chinese
+    /// @brief 获取内存预算
+    size_t GetMemoryBudget() const
+    {
+        return stats_.budget;
+    }
+
+    /// \~chinese
+    /// @brief 淘汰对象直到占用内存不超过预算
+    /// @return 淘汰的对象数量
+    size_t Trim()
+    {
+        if (stats_.budget == 0 || stats_.memory <= stats_.budget)
+            return 0;
+        return Evict(false);
+    }
+
+    /// \~chinese
+    /// @brief 淘汰所有只被缓存引用的对象
+    /// @return 淘汰的对象数量
+    size_t Purge()
+    {
+        return Evict(true);
+    }
+
+    /// \~chinese
+    /// @brief 获取统计数据
+    const CacheStats& GetStats() const
+    {
+        return stats_;
+    }
+
+    /// \~chinese
+    /// @brief 重置命中、未命中和淘汰次数
+    void ResetStats()
+    {
+        stats_.hits      = 0;
+        stats_.misses    = 0;
+        stats_.evictions = 0;
+    }
+
+    /// \~chinese
+    /// @brief 按使用顺序遍历对象，最近使用的对象在前
+    template <typename _Func>
+    void ForEach(_Func&& func) const
+    {
+        for (const auto& entry : entries_)
+            func(entry.key, entry.value);
+    }
+
+private:
+    size_t Evict(bool all)
+    {
+        size_t evicted = 0;
+
+        auto iter = entries_.end();
+        while (iter != entries_.begin() && (all || stats_.memory > stats_.budget))
+        {
+            --iter;
+
+            // Objects still referenced outside the cache stay, evicting them saves nothing
+            if (iter->value && iter->value->GetRefCount() > 1)
+                continue;
+
+            // Objects of unknown size do not count against the budget
+            if (!all && iter->memory == 0)
+                continue;
+
+            stats_.count--;
+            stats_.memory -= iter->memory;
+            index_.erase(iter->key);
+            iter = entries_.erase(iter);
+            ++evicted;
+        }
+
+        stats_.evictions += evicted;
+        return evicted;
+    }
+
+private:
+    struct Entry
+    {
+        key_type   key;
+        value_type value;
+        size_t     memory;
+    };
+
+    using EntryList = List<Entry>;
+
+    EntryList                                                   entries_;
+    UnorderedMap<key_type, typename EntryList::iterator, _Hash> index_;
+    CacheStats                                                  stats_;
+};
+
+}  // namespace kiwano
@@ -0,0 +1,673 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <kiwano/core/PoolAllocator.h>
+#include <new>  // std::align_val_t
+
+namespace kiwano
+{
+namespace memory
+{
+
+namespace
+{
+
+const size_t PAGE_SHIFT = 16;
+
+const uint32_t SIZE_CLASSES[PoolAllocator::SIZE_CLASS_NUM] = {
+    16,   32,   48,   64,   80,   96,   112,  128,  160,  192,  224,  256,  320,  384,
+    448,  512,  640,  768,  896,  1024, 1280, 1536, 1792, 2048, 2560, 3072, 3584, 4096,
+};
+
+struct SizeClassTable
+{
+    uint8_t  index[PoolAllocator::MAX_SMALL_SIZE / 16 + 1];
+    uint32_t batch[PoolAllocator::SIZE_CLASS_NUM];
+};
+
+constexpr SizeClassTable MakeSizeClassTable()
+{
+    SizeClassTable table{};
+
+    uint32_t size_class = 0;
+    for (uint32_t i = 0; i <= PoolAllocator::MAX_SMALL_SIZE / 16; ++i)
+    {
+        while (SIZE_CLASSES[size_class] < i * 16)
+            ++size_class;
+        table.index[i] = uint8_t(size_class);
+    }
+
+    // Blocks are moved between thread caches and central bins in batches of about 8KB
+    for (uint32_t i = 0; i < PoolAllocator::SIZE_CLASS_NUM; ++i)
+    {
+        uint32_t batch = 8192 / SIZE_CLASSES[i];
+        table.batch[i] = batch < 4 ? 4 : (batch > 64 ? 64 : batch);
+    }
+    return table;
+}
+
+constexpr SizeClassTable SIZE_CLASS_TABLE = MakeSizeClassTable();
+
+inline uint32_t GetSizeClass(size_t size)
+{
+    return SIZE_CLASS_TABLE.index[(size + 15) >> 4];
+}
+
+inline void IncreaseCounter(std::atomic<size_t>& counter)
+{
+    // Counters are only written by the owner thread, so a plain load and store is enough
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+inline void UpdatePeak(std::atomic<size_t>& peak, size_t value)
+{
+    size_t old_value = peak.load(std::memory_order_relaxed);
+    while (value > old_value && !peak.compare_exchange_weak(old_value, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+struct ThreadCacheSlot
+{
+    uint64_t allocator_id;
+    void*    cache;
+};
+
+// Trivially destructible, so it is still accessible while other thread-local objects are being destroyed
+struct ThreadCacheList
+{
+    ThreadCacheSlot slots[4];
+    bool            destroyed;
+};
+
+thread_local ThreadCacheList thread_caches;
+
+std::atomic<uint64_t> last_allocator_id(0);
+
+std::mutex& GetRegistryMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+UnorderedMap<uint64_t, PoolAllocator*>& GetRegistry()
+{
+    static UnorderedMap<uint64_t, PoolAllocator*> registry;
+    return registry;
+}
+
+}  // namespace
+
+//
+// Internal structures
+//
+
+struct PoolAllocator::FreeBlock
+{
+    FreeBlock* next;
+};
+
+struct PoolAllocator::CentralBin
+{
+    std::mutex          mutex;
+    FreeBlock*          free_list   = nullptr;
+    char*               carve_begin = nullptr;
+    char*               carve_end   = nullptr;
+    size_t              page_count  = 0;
+    std::atomic<size_t> alloc_count{ 0 };
+    std::atomic<size_t> free_count{ 0 };
+};
+
+struct PoolAllocator::ThreadCache
+{
+    struct Bin
+    {
+        FreeBlock* head;
+        uint32_t   count;
+    };
+
+    bool                attached;
+    Bin                 bins[SIZE_CLASS_NUM];
+    std::atomic<size_t> alloc_count[SIZE_CLASS_NUM];
+    std::atomic<size_t> free_count[SIZE_CLASS_NUM];
+
+    ThreadCache()
+        : attached(false)
+    {
+        for (size_t i = 0; i < SIZE_CLASS_NUM; ++i)
+        {
+            bins[i] = Bin{ nullptr, 0 };
+            alloc_count[i].store(0, std::memory_order_relaxed);
+            free_count[i].store(0, std::memory_order_relaxed);
+        }
+    }
+};
+
+// Two-level radix map from page address to size class, lookups are lock-free
+struct PoolAllocator::PageMap
+{
+    static const size_t LEAF_BITS = 16;
+    static const size_t LEAF_SIZE = size_t(1) << LEAF_BITS;
+    static const size_t ROOT_SIZE = size_t(1) << 16;
+
+    std::atomic<uint8_t*> roots[ROOT_SIZE];
+
+    PageMap()
+    {
+        for (auto& root : roots)
+            root.store(nullptr, std::memory_order_relaxed);
+    }
+
+    ~PageMap()
+    {
+        for (auto& root : roots)
+            delete[] root.load(std::memory_order_relaxed);
+    }
+
+    // Returns size class + 1 of the page, or 0 if the memory is not managed by the pool
+    inline uint8_t Lookup(const void* ptr) const
+    {
+        const uintptr_t page = uintptr_t(ptr) >> PAGE_SHIFT;
+        const uintptr_t root = page >> LEAF_BITS;
+        if (root >= ROOT_SIZE)
+            return 0;
+
+        const uint8_t* leaf = roots[root].load(std::memory_order_acquire);
+        return leaf ? leaf[page & (LEAF_SIZE - 1)] : 0;
+    }
+
+    // Must be called with the pages mutex held
+    bool Set(const void* ptr, uint8_t value)
+    {
+        const uintptr_t page = uintptr_t(ptr) >> PAGE_SHIFT;
+        const uintptr_t root = page >> LEAF_BITS;
+        if (root >= ROOT_SIZE)
+            return false;
+
+        uint8_t* leaf = roots[root].load(std::memory_order_relaxed);
+        if (!leaf)
+        {
+            leaf = new (std::nothrow) uint8_t[LEAF_SIZE]();
+            if (!leaf)
+                return false;
+            roots[root].store(leaf, std::memory_order_release);
+        }
+        leaf[page & (LEAF_SIZE - 1)] = value;
+        return true;
+    }
+};
+
+// Returns cached blocks when a thread exits
+class ThreadCacheGuard
+{
+public:
+    inline void Touch() {}
+
+    ~ThreadCacheGuard()
+    {
+        thread_caches.destroyed = true;
+
+        std::lock_guard<std::mutex> lock(GetRegistryMutex());
+
+        auto& registry = GetRegistry();
+        for (auto& slot : thread_caches.slots)
+        {
+            if (slot.allocator_id)
+            {
+                auto iter = registry.find(slot.allocator_id);
+                if (iter != registry.end())
+                {
+                    iter->second->DetachThreadCache(static_cast<PoolAllocator::ThreadCache*>(slot.cache));
+                }
+                slot = ThreadCacheSlot{ 0, nullptr };
+            }
+        }
+    }
+};
+
+thread_local ThreadCacheGuard thread_cache_guard;
+
+//
+// PoolAllocator
+//
+
+PoolAllocator::PoolAllocator()
+    : id_(++last_allocator_id)
+    , page_map_(new PageMap)
+    , bins_(new CentralBin[SIZE_CLASS_NUM])
+    , fallback_(GetAllocator())
+    , foreign_count_(0)
+    , large_live_count_(0)
+    , large_live_bytes_(0)
+    , reserved_bytes_(0)
+    , peak_bytes_(0)
+{
+    std::lock_guard<std::mutex> lock(GetRegistryMutex());
+    GetRegistry().insert(std::make_pair(id_, this));
+}
+
+PoolAllocator::~PoolAllocator()
+{
+    {
+        std::lock_guard<std::mutex> lock(GetRegistryMutex());
+        GetRegistry().erase(id_);
+    }
+
+    for (auto cache : caches_)
+    {
+        delete cache;
+    }
+    caches_.clear();
+
+    for (auto page : pages_)
+    {
+        ::operator delete(page, std::align_val_t(PAGE_SIZE));
+    }
+    pages_.clear();
+
+    for (auto& pair : large_blocks_)
+    {
+        ::operator delete(pair.first);
+    }
+    large_blocks_.clear();
+
+    delete page_map_;
+    delete[] bins_;
+}
+
+void* PoolAllocator::Alloc(size_t size)
+{
+    if (size <= MAX_SMALL_SIZE)
+    {
+        return AllocSmall(GetSizeClass(size));
+    }
+    return AllocLarge(size);
+}
+
+void PoolAllocator::Free(void* ptr)
+{
+    if (!ptr)
+        return;
+
+    // The page map decides which size class a block belongs to, pointers that don't
+    // belong to the pool must never reach the free lists
+    const uint8_t value = page_map_->Lookup(ptr);
+    if (value)
+    {
+        FreeSmall(ptr, value - 1);
+    }
+    else if (!FreeLarge(ptr))
+    {
+        FreeForeign(ptr);
+    }
+}
+
+void PoolAllocator::Free(void* ptr, size_t size)
+{
+    if (!ptr)
+        return;
+
+    // The size is only checked, the page map is trusted instead of the caller
+    KGE_ASSERT((size > MAX_SMALL_SIZE || !page_map_->Lookup(ptr) || page_map_->Lookup(ptr) == GetSizeClass(size) + 1)
+               && "Memory freed with a wrong size!");
+    KGE_NOT_USED(size);
+
+    Free(ptr);
+}
+
+PoolAllocator::Stats PoolAllocator::GetStats() const
+{
+    Stats stats            = {};
+    stats.large_live_count = large_live_count_.load(std::memory_order_relaxed);
+    stats.foreign_count    = foreign_count_.load(std::memory_order_relaxed);
+    stats.live_bytes       = large_live_bytes_.load(std::memory_order_relaxed);
+    stats.reserved_bytes   = reserved_bytes_.load(std::memory_order_relaxed);
+    stats.peak_bytes       = peak_bytes_.load(std::memory_order_relaxed);
+
+    size_t alloc_count[SIZE_CLASS_NUM] = {};
+    size_t free_count[SIZE_CLASS_NUM]  = {};
+    {
+        std::lock_guard<std::mutex> lock(caches_mutex_);
+        for (auto cache : caches_)
+        {
+            for (size_t i = 0; i < SIZE_CLASS_NUM; ++i)
+            {
+                alloc_count[i] += cache->alloc_count[i].load(std::memory_order_relaxed);
+                free_count[i] += cache->free_count[i].load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < SIZE_CLASS_NUM; ++i)
+    {
+        CentralBin& bin = bins_[i];
+
+        std::lock_guard<std::mutex> lock(bin.mutex);
+        alloc_count[i] += bin.alloc_count.load(std::memory_order_relaxed);
+        free_count[i] += bin.free_count.load(std::memory_order_relaxed);
+
+        SizeClassStats& size_class = stats.size_classes[i];
+        size_class.block_size      = SIZE_CLASSES[i];
+        size_class.live_count      = alloc_count[i] - free_count[i];
+        size_class.total_count     = alloc_count[i];
+        size_class.page_count      = bin.page_count;
+
+        stats.live_bytes += size_class.live_count * size_class.block_size;
+    }
+    return stats;
+}
+
+size_t PoolAllocator::GetBlockSize(size_t size)
+{
+    if (size <= MAX_SMALL_SIZE)
+    {
+        return SIZE_CLASSES[GetSizeClass(size)];
+    }
+    return 0;
+}
+
+PoolAllocator::ThreadCache* PoolAllocator::GetThreadCache()
+{
+    for (const auto& slot : thread_caches.slots)
+    {
+        if (slot.allocator_id == id_)
+            return static_cast<ThreadCache*>(slot.cache);
+    }
+
+    if (thread_caches.destroyed)
+        return nullptr;
+    return AttachThreadCache();
+}
+
+PoolAllocator::ThreadCache* PoolAllocator::AttachThreadCache()
+{
+    ThreadCacheSlot* free_slot = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(GetRegistryMutex());
+
+        // Slots of destroyed allocators can be reused
+        auto& registry = GetRegistry();
+        for (auto& slot : thread_caches.slots)
+        {
+            if (slot.allocator_id && registry.find(slot.allocator_id) == registry.end())
+            {
+                slot = ThreadCacheSlot{ 0, nullptr };
+            }
+
+            if (!slot.allocator_id && !free_slot)
+            {
+                free_slot = &slot;
+            }
+        }
+    }
+
+    if (!free_slot)
+        return nullptr;
+
+    ThreadCache* cache = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(caches_mutex_);
+        for (auto c : caches_)
+        {
+            if (!c->attached)
+            {
+                cache = c;
+                break;
+            }
+        }
+
+        if (!cache)
+        {
+            cache = new (std::nothrow) ThreadCache;
+            if (!cache)
+                return nullptr;
+            caches_.push_back(cache);
+        }
+        cache->attached = true;
+    }
+
+    free_slot->allocator_id = id_;
+    free_slot->cache        = cache;
+
+    // Make sure the cache will be detached when the thread exits
+    thread_cache_guard.Touch();
+    return cache;
+}
+
+void PoolAllocator::DetachThreadCache(ThreadCache* cache)
+{
+    for (uint32_t i = 0; i < SIZE_CLASS_NUM; ++i)
+    {
+        ThreadCache::Bin& bin = cache->bins[i];
+        if (bin.head)
+        {
+            FreeBlock* tail = bin.head;
+            while (tail->next)
+                tail = tail->next;
+
+            ReleaseBlocks(i, bin.head, tail);
+            bin = ThreadCache::Bin{ nullptr, 0 };
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(caches_mutex_);
+    cache->attached = false;
+}
+
+void* PoolAllocator::AllocSmall(uint32_t size_class)
+{
+    ThreadCache* cache = GetThreadCache();
+    if (cache)
+    {
+        ThreadCache::Bin& bin = cache->bins[size_class];
+        if (!bin.head)
+        {
+            bin.count = FetchBlocks(size_class, bin.head, SIZE_CLASS_TABLE.batch[size_class]);
+            if (!bin.count)
+                return nullptr;
+        }
+
+        FreeBlock* block = bin.head;
+        bin.head         = block->next;
+        --bin.count;
+
+        IncreaseCounter(cache->alloc_count[size_class]);
+        return block;
+    }
+
+    // The thread cache is not available while the thread is exiting
+    FreeBlock* block = nullptr;
+    if (!FetchBlocks(size_class, block, 1))
+        return nullptr;
+
+    bins_[size_class].alloc_count.fetch_add(1, std::memory_order_relaxed);
+    return block;
+}
+
+void PoolAllocator::FreeSmall(void* ptr, uint32_t size_class)
+{
+    FreeBlock* block = static_cast<FreeBlock*>(ptr);
+
+    ThreadCache* cache = GetThreadCache();
+    if (cache)
+    {
+        ThreadCache::Bin& bin = cache->bins[size_class];
+
+        block->next = bin.head;
+        bin.head    = block;
+        ++bin.count;
+
+        IncreaseCounter(cache->free_count[size_class]);
+
+        // Give a batch back to the central bin when too many blocks are cached
+        const uint32_t batch = SIZE_CLASS_TABLE.batch[size_class];
+        if (bin.count >= batch * 2)
+        {
+            FreeBlock* head = bin.head;
+            FreeBlock* tail = head;
+            for (uint32_t i = 1; i < batch; ++i)
+                tail = tail->next;
+
+            bin.head = tail->next;
+            bin.count -= batch;
+
+            tail->next = nullptr;
+            ReleaseBlocks(size_class, head, tail);
+        }
+        return;
+    }
+
+    block->next = nullptr;
+    ReleaseBlocks(size_class, block, block);
+
+    bins_[size_class].free_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void* PoolAllocator::AllocLarge(size_t size)
+{
+    void* ptr = ::operator new(size, std::nothrow);
+    if (!ptr)
+        return nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(large_mutex_);
+        large_blocks_.insert(std::make_pair(ptr, size));
+    }
+
+    large_live_count_.fetch_add(1, std::memory_order_relaxed);
+    large_live_bytes_.fetch_add(size, std::memory_order_relaxed);
+    UpdatePeak(peak_bytes_, reserved_bytes_.fetch_add(size, std::memory_order_relaxed) + size);
+    return ptr;
+}
+
+bool PoolAllocator::FreeLarge(void* ptr)
+{
+    size_t size = 0;
+    {
+        std::lock_guard<std::mutex> lock(large_mutex_);
+
+        auto iter = large_blocks_.find(ptr);
+        if (iter == large_blocks_.end())
+            return false;
+
+        size = iter->second;
+        large_blocks_.erase(iter);
+    }
+
+    large_live_count_.fetch_sub(1, std::memory_order_relaxed);
+    large_live_bytes_.fetch_sub(size, std::memory_order_relaxed);
+    reserved_bytes_.fetch_sub(size, std::memory_order_relaxed);
+
+    ::operator delete(ptr);
+    return true;
+}
+
+void PoolAllocator::FreeForeign(void* ptr)
+{
+    // Most likely allocated before the pool was installed
+    foreign_count_.fetch_add(1, std::memory_order_relaxed);
+    KGE_ASSERT(fallback_ != this);
+    fallback_->Free(ptr);
+}
+
+uint32_t PoolAllocator::FetchBlocks(uint32_t size_class, FreeBlock*& head, uint32_t count)
+{
+    CentralBin&  bin        = bins_[size_class];
+    const size_t block_size = SIZE_CLASSES[size_class];
+
+    std::lock_guard<std::mutex> lock(bin.mutex);
+
+    FreeBlock* tail    = nullptr;
+    uint32_t   fetched = 0;
+
+    // Recycled blocks first
+    if (bin.free_list)
+    {
+        head = tail = bin.free_list;
+        ++fetched;
+
+        while (fetched < count && tail->next)
+        {
+            tail = tail->next;
+            ++fetched;
+        }
+        bin.free_list = tail->next;
+        tail->next    = nullptr;
+    }
+
+    // Then carve new blocks from pages
+    while (fetched < count)
+    {
+        if (bin.carve_begin + block_size > bin.carve_end)
+        {
+            if (!AllocPage(size_class))
+                break;
+        }
+
+        FreeBlock* block = reinterpret_cast<FreeBlock*>(bin.carve_begin);
+        block->next      = nullptr;
+        bin.carve_begin += block_size;
+
+        if (tail)
+            tail->next = block;
+        else
+            head = block;
+        tail = block;
+        ++fetched;
+    }
+    return fetched;
+}
+
+void PoolAllocator::ReleaseBlocks(uint32_t size_class, FreeBlock* head, FreeBlock* tail)
+{
+    CentralBin& bin = bins_[size_class];
+
+    std::lock_guard<std::mutex> lock(bin.mutex);
+    tail->next    = bin.free_list;
+    bin.free_list = head;
+}
+
+bool PoolAllocator::AllocPage(uint32_t size_class)
+{
+    void* page = ::operator new(PAGE_SIZE, std::align_val_t(PAGE_SIZE), std::nothrow);
+    if (!page)
+        return false;
+
+    {
+        std::lock_guard<std::mutex> lock(pages_mutex_);
+        if (!page_map_->Set(page, uint8_t(size_class + 1)))
+        {
+            ::operator delete(page, std::align_val_t(PAGE_SIZE));
+            return false;
+        }
+        pages_.push_back(page);
+    }
+
+    CentralBin& bin = bins_[size_class];
+    bin.carve_begin = static_cast<char*>(page);
+    bin.carve_end   = bin.carve_begin + PAGE_SIZE;
+    ++bin.page_count;
+
+    UpdatePeak(peak_bytes_, reserved_bytes_.fetch_add(PAGE_SIZE, std::memory_order_relaxed) + PAGE_SIZE);
+    return true;
+}
+
+}  // namespace memory
+}  // namespace kiwano
@@ -0,0 +1,146 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <kiwano/core/Common.h>
+
+namespace kiwano
+{
+namespace memory
+{
+
+/**
+ * \~chinese
+ * @brief 内存池分配器
+ * @details 将不超过 MAX_SMALL_SIZE 字节的内存申请按大小分级，从 64KB 的内存页中切分内存块，
+ * 释放的内存块进入空闲链表循环利用。每个线程拥有独立的内存块缓存，常见的申请和释放无需加锁。
+ * 更大的内存申请直接交给全局堆处理。
+ * @details 释放内存时通过内存页表和大内存块表判断内存是否属于内存池，不属于内存池的内存（例如设置内存池之前申请的内存）
+ * 不会进入空闲链表，而是交给创建内存池时的内存分配器释放
+ * @note 内存池会在析构时释放全部内存页，请保证它的生命周期长于所有通过它分配的对象
+ */
+class KGE_API PoolAllocator : public MemoryAllocator
+{
+public:
+    /// \~chinese
+    /// @brief 内存块大小等级数量
+    static const size_t SIZE_CLASS_NUM = 28;
+
+    /// \~chinese
+    /// @brief 由内存池管理的最大内存块大小
+    static const size_t MAX_SMALL_SIZE = 4096;
+
+    /// \~chinese
+    /// @brief 内存页大小
+    static const size_t PAGE_SIZE = 64 * 1024;
+
+    /// \~chinese
+    /// @brief 内存块大小等级的统计数据
+    struct SizeClassStats
+    {
+        size_t block_size;   ///< 内存块大小
+        size_t live_count;   ///< 正在使用的内存块数量
+        size_t total_count;  ///< 累计分配的内存块数量
+        size_t page_count;   ///< 内存页数量
+    };
+
+    /// \~chinese
+    /// @brief 统计数据
+    struct Stats
+    {
+        size_t         live_bytes;        ///< 正在使用的内存大小（按内存块大小计算）
+        size_t         reserved_bytes;    ///< 从系统申请的内存大小
+        size_t         peak_bytes;        ///< 从系统申请的内存大小峰值
+        size_t         large_live_count;  ///< 正在使用的大内存块数量
+        size_t         foreign_count;     ///< 释放的不属于内存池的内存数量
+        SizeClassStats size_classes[SIZE_CLASS_NUM];
+    };
+
+    PoolAllocator();
+
+    virtual ~PoolAllocator();
+
+    void* Alloc(size_t size) override;
+
+    void Free(void* ptr) override;
+
+    void Free(void* ptr, size_t size) override;
+
+    /// \~chinese
+    /// @brief 获取统计数据
+    Stats GetStats() const;
+
+    /// \~chinese
+    /// @brief 获取申请指定大小时使用的内存块大小
+    /// @return 超出内存池管理范围时返回 0
+    static size_t GetBlockSize(size_t size);
+
+private:
+    struct FreeBlock;
+    struct CentralBin;
+    struct ThreadCache;
+    struct PageMap;
+
+    friend class ThreadCacheGuard;
+
+    ThreadCache* GetThreadCache();
+
+    ThreadCache* AttachThreadCache();
+
+    void DetachThreadCache(ThreadCache* cache);
+
+    void* AllocSmall(uint32_t size_class);
+
+    void FreeSmall(void* ptr, uint32_t size_class);
+
+    void* AllocLarge(size_t size);
+
+    bool FreeLarge(void* ptr);
+
+    void FreeForeign(void* ptr);
+
+    uint32_t FetchBlocks(uint32_t size_class, FreeBlock*& head, uint32_t count);
+
+    void ReleaseBlocks(uint32_t size_class, FreeBlock* head, FreeBlock* tail);
+
+    bool AllocPage(uint32_t size_class);
+
+private:
+    uint64_t                    id_;
+    PageMap*                    page_map_;
+    CentralBin*                 bins_;
+    mutable std::mutex          caches_mutex_;
+    Vector<ThreadCache*>        caches_;
+    std::mutex                  pages_mutex_;
+    Vector<void*>               pages_;
+    MemoryAllocator*            fallback_;
+    std::mutex                  large_mutex_;
+    UnorderedMap<void*, size_t> large_blocks_;
+    std::atomic<size_t>         foreign_count_;
+    std::atomic<size_t>         large_live_count_;
+    std::atomic<size_t>         large_live_bytes_;
+    std::atomic<size_t>         reserved_bytes_;
+    std::atomic<size_t>         peak_bytes_;
+};
+
+}  // namespace memory
+}  // namespace kiwano
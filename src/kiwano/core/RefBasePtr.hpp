@@ -28,7 +28,7 @@ namespace kiwano
 
 /**
  * \~chinese
- * @brief üָ
+ * @brief 引用计数智能指针
  */
 template <typename _Ty, typename _RefPolicy>
 class RefBasePtr : protected _RefPolicy
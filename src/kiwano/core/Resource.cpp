@@ -40,11 +40,12 @@ BinaryData Resource::GetData() const
 {
     do
     {
-        if (data_.buffer && data_.size)
+        if (data_.IsValid())
         {
             break;
         }
 
+#if defined(KGE_PLATFORM_WINDOWS)
         HRSRC res_info = FindResourceA(nullptr, MAKEINTRESOURCEA(id_), type_.data());
         if (res_info == nullptr)
         {
@@ -73,8 +74,12 @@ BinaryData Resource::GetData() const
             break;
         }
 
-        data_.buffer = static_cast<void*>(buffer);
-        data_.size   = static_cast<uint32_t>(size);
+        // Resources stay loaded until the module is unloaded, so the data does not need an owner
+        data_ = BinaryData(buffer, size);
+#else
+        // Only Windows executables carry embedded resources
+        KGE_ERRORF("Resource %u is not available on this platform", id_);
+#endif
     } while (0);
 
     return data_;
@@ -26,15 +26,15 @@ namespace kiwano
 
 /**
  * \~chinese
- * @brief Դ
+ * @brief 资源
  * @details
- *   ԴǱ exe еĶݣ
- *   磬һƵԴΪ "WAVE"ƱʶΪ
- * IDR_WAVE_1ôָԴ:
+ *   资源是保存在 exe 中的二进制数据，
+ *   例如，一份音频资源的类型为 "WAVE"，名称标识符为
+ * IDR_WAVE_1，那么可以这样指定该资源:
  *   @code
  *     Resource(IDR_WAVE_1, "WAVE");
  *   @endcode
- *   ˽ԴĸϢ:
+ *   了解资源的更多信息:
  * https://docs.microsoft.com/en-us/windows/desktop/menurc/resources
  */
 class KGE_API Resource
@@ -42,26 +42,26 @@ class KGE_API Resource
 public:
 
     /// \~chinese
-    /// @brief Դ
+    /// @brief 构造资源
     Resource();
 
     /// \~chinese
-    /// @brief Դ
-    /// @param id Դ ID
-    /// @param type Դ
+    /// @brief 构造资源
+    /// @param id 资源 ID
+    /// @param type 资源类型
     Resource(uint32_t id, const String& type);
 
     /// \~chinese
-    /// @brief ȡԴĶ
-    /// @return Դ
+    /// @brief 获取资源的二进制数据
+    /// @return 资源数据
     BinaryData GetData() const;
 
     /// \~chinese
-    /// @brief ȡԴ ID
+    /// @brief 获取资源 ID
     uint32_t GetId() const;
 
     /// \~chinese
-    /// @brief ȡԴ
+    /// @brief 获取资源类型
     String GetType() const;
 
 private:
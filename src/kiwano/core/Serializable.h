@@ -19,6 +19,7 @@
 // THE SOFTWARE.
 
 #pragma once
+#include <cstring>
 #include <kiwano/core/Common.h>
 #include <kiwano/math/Math.h>
 
@@ -26,7 +27,7 @@ namespace kiwano
 {
 /**
  * \~chinese
- * \defgroup Serialization л
+ * \defgroup Serialization 序列化
  */
 
 /**
@@ -35,15 +36,15 @@ namespace kiwano
  */
 
 /// \~chinese
-/// @brief л
+/// @brief 序列化器
 struct Serializer
 {
     /// \~chinese
-    /// @brief дֽ
+    /// @brief 写入字节序列
     virtual void WriteBytes(const uint8_t* bytes, size_t size) = 0;
 
     /// \~chinese
-    /// @brief дֵ
+    /// @brief 写入值
     template <typename _Ty>
     void WriteValue(const _Ty& value)
     {
@@ -62,7 +63,7 @@ struct Serializer
 };
 
 /// \~chinese
-/// @brief ֽڴл
+/// @brief 字节串序列化器
 struct ByteSerializer : public Serializer
 {
     ByteSerializer(Vector<uint8_t>& bytes)
@@ -106,7 +107,7 @@ private:
 };
 
 /// \~chinese
-/// @brief л
+/// @brief 流序列化器
 struct StreamSerializer : public Serializer
 {
     StreamSerializer(std::basic_ostream<char>& stream)
@@ -124,7 +125,7 @@ private:
 };
 
 /// \~chinese
-/// @brief ļл
+/// @brief 文件序列化器
 struct FileSerializer : public Serializer
 {
     FileSerializer(FILE* file)
@@ -142,15 +143,15 @@ private:
 };
 
 /// \~chinese
-/// @brief л
+/// @brief 反序列化器
 struct Deserializer
 {
     /// \~chinese
-    /// @brief ȡֽ
+    /// @brief 读取字节序列
     virtual void ReadBytes(uint8_t* bytes, size_t size) = 0;
 
     /// \~chinese
-    /// @brief ȡֵ
+    /// @brief 读取值
     template <typename _Ty>
     void ReadValue(_Ty* value)
     {
@@ -169,7 +170,7 @@ struct Deserializer
 };
 
 /// \~chinese
-/// @brief ֽڴл
+/// @brief 字节串反序列化器
 struct ByteDeserializer : public Deserializer
 {
     ByteDeserializer(const Vector<uint8_t>& bytes)
@@ -194,7 +195,7 @@ private:
 };
 
 /// \~chinese
-/// @brief л
+/// @brief 流反序列化器
 struct StreamDeserializer : public Deserializer
 {
     StreamDeserializer(std::basic_istream<char>& stream)
@@ -212,7 +213,7 @@ private:
 };
 
 /// \~chinese
-/// @brief ļл
+/// @brief 文件反序列化器
 struct FileDeserializer : public Deserializer
 {
     FileDeserializer(FILE* file)
@@ -234,12 +235,12 @@ private:
 };
 
 /// \~chinese
-/// @brief л
+/// @brief 可序列化对象
 class Serializable
 {
 public:
     /// \~chinese
-    /// @brief лΪֽڴ
+    /// @brief 序列化为字节串
     inline Vector<uint8_t> Serialize() const
     {
         Vector<uint8_t> data;
@@ -249,7 +250,7 @@ public:
     }
 
     /// \~chinese
-    /// @brief ֽڴл
+    /// @brief 从字节串反序列化
     inline void Deserialize(const Vector<uint8_t>& data)
     {
         ByteDeserializer deserializer(data);
@@ -257,11 +258,11 @@ public:
     }
 
     /// \~chinese
-    /// @brief ִл
+    /// @brief 执行序列化
     virtual void DoSerialize(Serializer* serializer) const = 0;
 
     /// \~chinese
-    /// @brief ִзл
+    /// @brief 执行反序列化
     virtual void DoDeserialize(Deserializer* deserializer) = 0;
 };
 
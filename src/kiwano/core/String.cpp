@@ -21,6 +21,9 @@
 #pragma once
 #include <kiwano/macros.h>
 #include <kiwano/core/String.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cwchar>
 
 namespace kiwano
 {
@@ -115,6 +118,109 @@ WideString NarrowToWide(const String& str)
     return WideString();
 }
 
+#else
+
+String Format(const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+
+    String result = FormatArgs(format, args);
+
+    va_end(args);
+    return result;
+}
+
+WideString Format(const wchar_t* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+
+    WideString result = FormatArgs(format, args);
+
+    va_end(args);
+    return result;
+}
+
+String FormatArgs(const char* format, va_list args)
+{
+    String result;
+    if (format)
+    {
+        va_list args_copy;
+        va_copy(args_copy, args);
+        const int len = std::vsnprintf(nullptr, 0, format, args_copy);
+        va_end(args_copy);
+
+        if (len > 0)
+        {
+            result.resize(size_t(len));
+            std::vsnprintf(&result[0], size_t(len) + 1, format, args);
+        }
+    }
+    return result;
+}
+
+WideString FormatArgs(const wchar_t* format, va_list args)
+{
+    // vswprintf cannot measure the output, so grow the buffer until it fits
+    WideString result;
+    if (format)
+    {
+        for (size_t size = 256; size <= (1u << 20); size *= 2)
+        {
+            result.resize(size);
+
+            va_list args_copy;
+            va_copy(args_copy, args);
+            const int len = std::vswprintf(&result[0], size, format, args_copy);
+            va_end(args_copy);
+
+            if (len >= 0)
+            {
+                result.resize(size_t(len));
+                return result;
+            }
+        }
+        result.clear();
+    }
+    return result;
+}
+
+String WideToNarrow(const WideString& str)
+{
+    if (str.empty())
+        return String();
+
+    const size_t len = std::wcstombs(nullptr, str.c_str(), 0);
+    if (len != static_cast<size_t>(-1))
+    {
+        String result;
+        result.resize(len);
+
+        std::wcstombs(&result[0], str.c_str(), len + 1);
+        return result;
+    }
+    return String();
+}
+
+WideString NarrowToWide(const String& str)
+{
+    if (str.empty())
+        return WideString();
+
+    const size_t len = std::mbstowcs(nullptr, str.c_str(), 0);
+    if (len != static_cast<size_t>(-1))
+    {
+        WideString result;
+        result.resize(len);
+
+        std::mbstowcs(&result[0], str.c_str(), len + 1);
+        return result;
+    }
+    return WideString();
+}
+
 #endif  // KGE_PLATFORM_WINDOWS
 
 }  // namespace string
@@ -20,22 +20,25 @@
 
 #pragma once
 #include <string>
+#include <cstdarg>
+#include <cstddef>
+#include <stdexcept>
 #include <type_traits>
 
 namespace kiwano
 {
 
 /// \~chinese
-/// @brief ַ
+/// @brief 基础字符串容器
 template <typename CharTy>
 using BasicString = std::basic_string<CharTy>;
 
 /// \~chinese
-/// @brief ַ
+/// @brief 字符串容器
 using String = BasicString<char>;
 
 /// \~chinese
-/// @brief ַ
+/// @brief 宽字符串容器
 using WideString = BasicString<wchar_t>;
 
 
@@ -43,34 +46,34 @@ namespace strings
 {
 
 /// \~chinese
-/// @brief ʽַ
+/// @brief 格式化字符串
 String Format(const char* format, ...);
 
 /// \~chinese
-/// @brief ʽַ
+/// @brief 格式化字符串
 WideString Format(const wchar_t* format, ...);
 
 /// \~chinese
-/// @brief ʽַ
+/// @brief 格式化字符串
 String FormatArgs(const char* format, va_list args);
 
 /// \~chinese
-/// @brief ʽַ
+/// @brief 格式化字符串
 WideString FormatArgs(const wchar_t* format, va_list args);
 
 /// \~chinese
-/// @brief ַתխַ
+/// @brief 宽字符串转窄字符串
 String WideToNarrow(const WideString& str);
 
 /// \~chinese
-/// @brief խַתַ
+/// @brief 窄字符串转宽字符串
 WideString NarrowToWide(const String& str);
 
 }
 
 
 /// \~chinese
-/// @brief ַͼ
+/// @brief 基础常字符串视图
 template <typename CharTy>
 class BasicStringView
 {
@@ -195,16 +198,16 @@ public:
     //
     class Iterator
     {
-        const value_type* ptr_;
+        const CharTy*     ptr_;
         size_type         pos_;
         size_type         count_;
 
     public:
         using iterator_category = std::random_access_iterator_tag;
-        using value_type        = value_type;
+        using value_type        = CharTy;
         using pointer           = value_type*;
         using reference         = value_type&;
-        using difference_type   = ptrdiff_t;
+        using difference_type   = std::ptrdiff_t;
 
         inline Iterator(pointer ptr, size_type pos, size_type count)
             : ptr_(ptr)
@@ -408,11 +411,11 @@ private:
 };
 
 /// \~chinese
-/// @brief ַͼ
+/// @brief 字符串视图
 using StringView = BasicStringView<char>;
 
 /// \~chinese
-/// @brief ַͼ
+/// @brief 宽字符串视图
 using WideStringView = BasicStringView<wchar_t>;
 
 }  // namespace kiwano
@@ -27,28 +27,28 @@ namespace kiwano
 
 /**
  * \~chinese
- * @brief ʱ
- * @par ʾ
+ * @brief 时间
+ * @par 示例：
  * @code
- *   // ʱ, ɵõһ Duration 
+ *   // 两时间相减, 可得到一个 Duration 对象
  *   Time t1 = Time::Now();
- *   // ȴһʱ
+ *   // 等待一段时间后
  *   Time t2 = Time::Now();
- *   int ms = (t2 - t1).GetMilliseconds();  // ȡʱĺ
+ *   int ms = (t2 - t1).GetMilliseconds();  // 获取两时间相差的毫秒数
  * @endcode
- * @note ʱϵͳʱ޹أ˲ܽʱתΪʱ
+ * @note 时间点与系统时钟无关，因此不能将时间点转化为时分秒
  */
 struct KGE_API Time
 {
     Time();
 
     /// \~chinese
-    /// @brief Ƿʱ
-    /// @return ʱtrue
+    /// @brief 是否是零时
+    /// @return 若是零时，返回true
     bool IsZero() const;
 
     /// \~chinese
-    /// @brief ȡǰʱ
+    /// @brief 获取当前时间
     static Time Now() noexcept;
 
     const Duration operator-(const Time&) const;
@@ -68,35 +68,35 @@ private:
 
 /**
  * \~chinese
- * @brief ʱʱ
+ * @brief 时钟时间
  */
 struct KGE_API ClockTime
 {
     ClockTime();
 
     /// \~chinese
-    /// @brief Ƿʱ
-    /// @return ʱtrue
+    /// @brief 是否是零时
+    /// @return 若是零时，返回true
     bool IsZero() const;
 
     /// \~chinese
-    /// @brief ȡǰʱ
+    /// @brief 获取当前时间戳
     int64_t GetTimeStamp() const;
 
     /// \~chinese
-    /// @brief ȡԼԪĺ
+    /// @brief 获取自纪元以来的毫秒数
     int64_t GetMillisecondsSinceEpoch() const;
 
     /// \~chinese
-    /// @brief ȡ C ʱ
+    /// @brief 获取 C 风格的时间
     std::time_t GetCTime() const;
 
     /// \~chinese
-    /// @brief ȡǰʱ
+    /// @brief 获取当前时间
     static ClockTime Now() noexcept;
 
     /// \~chinese
-    /// @brief ʱתΪʱ
+    /// @brief 时间戳转化为时间
     static ClockTime FromTimeStamp(int64_t timestamp) noexcept;
 
     const Duration operator-(const ClockTime&) const;
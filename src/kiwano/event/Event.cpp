@@ -1,4 +1,5 @@
 #include <kiwano/event/Event.h>
+#include <kiwano/event/EventArena.h>
 
 namespace kiwano
 {
@@ -9,4 +10,24 @@ Event::Event(const EventType& type)
 
 Event::~Event() {}
 
+void* Event::operator new(size_t size)
+{
+    return EventArena::AllocHeap(size);
+}
+
+void Event::operator delete(void* ptr, size_t size)
+{
+    EventArena::Free(ptr, size);
+}
+
+void* Event::operator new(size_t size, EventArena& arena)
+{
+    return arena.Alloc(size);
+}
+
+void Event::operator delete(void* ptr, EventArena& arena)
+{
+    EventArena::Free(ptr);
+}
+
 }  // namespace kiwano
@@ -28,9 +28,11 @@ namespace kiwano
 {
 KGE_DECLARE_SMART_PTR(Event);
 
+class EventArena;
+
 /**
  * \~chinese
- * \defgroup Event ¼
+ * \defgroup Event 事件
  */
 
 /**
@@ -39,44 +41,54 @@ KGE_DECLARE_SMART_PTR(Event);
  */
 
 /// \~chinese
-/// @brief ¼
+/// @brief 事件
 class KGE_API Event : public RefObject
 {
 public:
     /// \~chinese
-    /// @brief ¼
+    /// @brief 构造事件
     Event(const EventType& type);
 
     virtual ~Event();
 
     /// \~chinese
-    /// @brief ȡ¼
+    /// @brief 获取类型事件
     const EventType& GetType() const;
 
     /// \~chinese
-    /// @brief ж¼
-    /// @return ¼ͬtrue򷵻false
+    /// @brief 判断事件类型
+    /// @return 事件类型相同返回true，否则返回false
     template <typename _Ty>
     bool IsType() const;
 
     /// \~chinese
-    /// @brief תΪ¼
-    /// @return ¼ָ룬¼޷תؿָ
+    /// @brief 转换为其他类型事件
+    /// @return 其他类型事件指针，如果事件类型无法转换，返回空指针
     template <typename _Ty>
     const _Ty* Cast() const;
 
     /// \~chinese
-    /// @brief תΪ¼
-    /// @return ¼ָ룬¼޷תؿָ
+    /// @brief 转换为其他类型事件
+    /// @return 其他类型事件指针，如果事件类型无法转换，返回空指针
     template <typename _Ty>
     _Ty* Cast();
 
+    static void* operator new(size_t size);
+
+    static void operator delete(void* ptr, size_t size);
+
+    /// \~chinese
+    /// @brief 在帧事件内存池中分配事件
+    static void* operator new(size_t size, EventArena& arena);
+
+    static void operator delete(void* ptr, EventArena& arena);
+
 private:
     const EventType type_;
 };
 
 /// \~chinese
-/// @brief ¼ԣж¼Ƿͬ
+/// @brief 事件特性：判断事件类型是否相同
 template <typename _Ty>
 struct IsSameEventType
 {
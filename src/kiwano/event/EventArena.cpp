@@ -0,0 +1,232 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <atomic>
+#include <kiwano/event/EventArena.h>
+
+namespace kiwano
+{
+
+namespace
+{
+
+// Every event block starts with a header that records the owner chunk, null for heap blocks
+const size_t BLOCK_HEADER_SIZE = 16;
+
+// Keep a few chunks for the next frames, release the others
+const size_t MAX_FREE_CHUNK_NUM = 4;
+
+// Reference held by the arena while the chunk is in use, events don't need to retain the chunk one by one
+const uint32_t CHUNK_ARENA_REFS = 1u << 30;
+
+inline size_t AlignBlockSize(size_t size)
+{
+    return (size + 15) & ~size_t(15);
+}
+
+std::atomic<size_t> retained_chunk_count(0);
+
+}  // namespace
+
+struct EventArena::Chunk
+{
+    // The arena holds CHUNK_ARENA_REFS references until the chunk is reset, each living event holds one after that
+    std::atomic<uint32_t> refs;
+    uint32_t              count;
+    size_t                used;
+
+    inline char* GetData()
+    {
+        return reinterpret_cast<char*>(this) + GetHeaderSize();
+    }
+
+    static inline size_t GetHeaderSize()
+    {
+        return AlignBlockSize(sizeof(Chunk));
+    }
+
+    static inline size_t GetCapacity()
+    {
+        return CHUNK_SIZE - GetHeaderSize();
+    }
+};
+
+EventArena::EventArena()
+    : current_(nullptr)
+    , frame_event_count_(0)
+    , last_frame_event_count_(0)
+{
+}
+
+EventArena::~EventArena()
+{
+    Reset();
+
+    for (auto chunk : free_chunks_)
+    {
+        memory::Free(chunk, CHUNK_SIZE);
+    }
+    free_chunks_.clear();
+}
+
+void* EventArena::Alloc(size_t size)
+{
+    const size_t block_size = AlignBlockSize(size) + BLOCK_HEADER_SIZE;
+    if (block_size > Chunk::GetCapacity())
+    {
+        return AllocHeap(size);
+    }
+
+    if (!current_ || current_->used + block_size > Chunk::GetCapacity())
+    {
+        current_ = AllocChunk();
+        if (!current_)
+        {
+            return AllocHeap(size);
+        }
+    }
+
+    char* block = current_->GetData() + current_->used;
+    current_->used += block_size;
+    ++current_->count;
+
+    *reinterpret_cast<Chunk**>(block) = current_;
+
+    ++frame_event_count_;
+    return block + BLOCK_HEADER_SIZE;
+}
+
+void EventArena::Reset()
+{
+    for (auto chunk : frame_chunks_)
+    {
+        retained_chunk_count.fetch_add(1, std::memory_order_relaxed);
+
+        // Exchange the arena references for one reference per allocated event
+        const uint32_t arena_refs = CHUNK_ARENA_REFS - chunk->count;
+        if (chunk->refs.fetch_sub(arena_refs, std::memory_order_acq_rel) == arena_refs)
+        {
+            // No event is alive, the chunk can be reused
+            retained_chunk_count.fetch_sub(1, std::memory_order_relaxed);
+
+            if (free_chunks_.size() < MAX_FREE_CHUNK_NUM)
+            {
+                free_chunks_.push_back(chunk);
+            }
+            else
+            {
+                memory::Free(chunk, CHUNK_SIZE);
+            }
+        }
+        // Otherwise the chunk will be freed when its last event is released
+    }
+    frame_chunks_.clear();
+    current_ = nullptr;
+
+    last_frame_event_count_ = frame_event_count_;
+    frame_event_count_      = 0;
+}
+
+size_t EventArena::GetRetainedChunkCount() const
+{
+    return retained_chunk_count.load(std::memory_order_relaxed);
+}
+
+void* EventArena::AllocHeap(size_t size)
+{
+    char* block = static_cast<char*>(memory::Alloc(size + BLOCK_HEADER_SIZE));
+    if (!block)
+    {
+        throw std::bad_alloc();
+    }
+
+    *reinterpret_cast<Chunk**>(block) = nullptr;
+    return block + BLOCK_HEADER_SIZE;
+}
+
+void EventArena::Free(void* ptr)
+{
+    if (!ptr)
+        return;
+
+    char*  block = static_cast<char*>(ptr) - BLOCK_HEADER_SIZE;
+    Chunk* chunk = *reinterpret_cast<Chunk**>(block);
+    if (chunk)
+    {
+        ReleaseChunk(chunk);
+    }
+    else
+    {
+        memory::Free(block);
+    }
+}
+
+void EventArena::Free(void* ptr, size_t size)
+{
+    if (!ptr)
+        return;
+
+    char*  block = static_cast<char*>(ptr) - BLOCK_HEADER_SIZE;
+    Chunk* chunk = *reinterpret_cast<Chunk**>(block);
+    if (chunk)
+    {
+        ReleaseChunk(chunk);
+    }
+    else
+    {
+        memory::Free(block, size + BLOCK_HEADER_SIZE);
+    }
+}
+
+EventArena::Chunk* EventArena::AllocChunk()
+{
+    Chunk* chunk = nullptr;
+    if (!free_chunks_.empty())
+    {
+        chunk = free_chunks_.back();
+        free_chunks_.pop_back();
+    }
+    else
+    {
+        void* memory = memory::Alloc(CHUNK_SIZE);
+        if (!memory)
+            return nullptr;
+        chunk = ::new (memory) Chunk;
+    }
+
+    chunk->refs.store(CHUNK_ARENA_REFS, std::memory_order_relaxed);
+    chunk->count = 0;
+    chunk->used  = 0;
+
+    frame_chunks_.push_back(chunk);
+    return chunk;
+}
+
+void EventArena::ReleaseChunk(Chunk* chunk)
+{
+    if (chunk->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        // The arena has given up the chunk, and this is the last event in it
+        retained_chunk_count.fetch_sub(1, std::memory_order_relaxed);
+        memory::Free(chunk, CHUNK_SIZE);
+    }
+}
+
+}  // namespace kiwano
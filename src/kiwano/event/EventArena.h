@@ -0,0 +1,120 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <kiwano/core/Common.h>
+#include <kiwano/core/Singleton.h>
+#include <kiwano/event/Event.h>
+
+namespace kiwano
+{
+
+/**
+ * \addtogroup Event
+ * @{
+ */
+
+/**
+ * \~chinese
+ * @brief 帧事件内存池
+ * @details 鼠标悬停、物理碰撞等短生命周期的事件从按块分配的内存中顺序分配，每帧结束时统一回收。
+ * 监听器可以放心地持有事件，被持有的事件所在的内存块会在这些事件全部释放后才回收
+ * @note 只能在主线程中通过帧事件内存池创建事件，事件可以在任意线程释放
+ */
+class KGE_API EventArena final : public Singleton<EventArena>
+{
+    friend Singleton<EventArena>;
+
+public:
+    /// \~chinese
+    /// @brief 内存块大小
+    static const size_t CHUNK_SIZE = 32 * 1024;
+
+    /// \~chinese
+    /// @brief 在帧事件内存池中创建事件
+    template <typename _Ty, typename... _Args>
+    RefPtr<_Ty> Create(_Args&&... args);
+
+    /// \~chinese
+    /// @brief 分配事件内存
+    /// @param size 事件大小
+    void* Alloc(size_t size);
+
+    /// \~chinese
+    /// @brief 回收当前帧分配的内存
+    void Reset();
+
+    /// \~chinese
+    /// @brief 获取上一帧分配的事件数量
+    size_t GetLastFrameEventCount() const;
+
+    /// \~chinese
+    /// @brief 获取因事件仍被持有而延迟回收的内存块数量
+    size_t GetRetainedChunkCount() const;
+
+    /// \~chinese
+    /// @brief 从堆中分配事件内存
+    static void* AllocHeap(size_t size);
+
+    /// \~chinese
+    /// @brief 释放事件内存
+    /// @param ptr 事件内存地址
+    static void Free(void* ptr);
+
+    /// \~chinese
+    /// @brief 释放事件内存
+    /// @param ptr 事件内存地址
+    /// @param size 事件大小
+    static void Free(void* ptr, size_t size);
+
+    ~EventArena();
+
+private:
+    EventArena();
+
+    struct Chunk;
+
+    Chunk* AllocChunk();
+
+    static void ReleaseChunk(Chunk* chunk);
+
+private:
+    Chunk*         current_;
+    size_t         frame_event_count_;
+    size_t         last_frame_event_count_;
+    Vector<Chunk*> frame_chunks_;
+    Vector<Chunk*> free_chunks_;
+};
+
+/** @} */
+
+template <typename _Ty, typename... _Args>
+inline RefPtr<_Ty> EventArena::Create(_Args&&... args)
+{
+    static_assert(std::is_base_of<Event, _Ty>::value, "_Ty is not an event type.");
+    return RefPtr<_Ty>(new (*this) _Ty(std::forward<_Args>(args)...));
+}
+
+inline size_t EventArena::GetLastFrameEventCount() const
+{
+    return last_frame_event_count_;
+}
+
+}  // namespace kiwano
@@ -25,37 +25,37 @@ namespace kiwano
 {
 
 /// \~chinese
-/// @brief б
+/// @brief 监听器列表
 typedef IntrusiveList<EventListenerPtr> ListenerList;
 
 /**
  * \~chinese
- * @brief ¼ַ
+ * @brief 事件分发器
  */
 class KGE_API EventDispatcher
 {
 public:
     /// \~chinese
-    /// @brief Ӽ
+    /// @brief 添加监听器
     EventListener* AddListener(EventListenerPtr listener);
 
     /// \~chinese
-    /// @brief Ӽ
-    /// @param type ¼
-    /// @param callback ص
+    /// @brief 添加监听器
+    /// @param type 监听的事件类型
+    /// @param callback 回调函数
     EventListener* AddListener(EventType type, EventListener::Callback callback);
 
     /// \~chinese
-    /// @brief Ӽ
-    /// @param name 
-    /// @param type ¼
-    /// @param callback ص
+    /// @brief 添加监听器
+    /// @param name 监听器名称
+    /// @param type 监听的事件类型
+    /// @param callback 回调函数
     EventListener* AddListener(const String& name, EventType type, EventListener::Callback callback);
 
     /// \~chinese
-    /// @brief Ӽ
-    /// @tparam _EventTy ¼
-    /// @param callback ص
+    /// @brief 添加监听器
+    /// @tparam _EventTy 事件类型
+    /// @param callback 回调函数
     template <typename _EventTy>
     EventListener* AddListener(EventListener::Callback callback)
     {
@@ -64,10 +64,10 @@ public:
     }
 
     /// \~chinese
-    /// @brief Ӽ
-    /// @tparam _EventTy ¼
-    /// @param name 
-    /// @param callback ص
+    /// @brief 添加监听器
+    /// @tparam _EventTy 事件类型
+    /// @param name 监听器名称
+    /// @param callback 回调函数
     template <typename _EventTy>
     EventListener* AddListener(const String& name, EventListener::Callback callback)
     {
@@ -76,40 +76,40 @@ public:
     }
 
     /// \~chinese
-    /// @brief 
-    /// @param name 
+    /// @brief 启动监听器
+    /// @param name 监听器名称
     void StartListeners(const String& name);
 
     /// \~chinese
-    /// @brief ֹͣ
-    /// @param name 
+    /// @brief 停止监听器
+    /// @param name 监听器名称
     void StopListeners(const String& name);
 
     /// \~chinese
-    /// @brief Ƴ
-    /// @param name 
+    /// @brief 移除监听器
+    /// @param name 监听器名称
     void RemoveListeners(const String& name);
 
     /// \~chinese
-    /// @brief м
+    /// @brief 启动所有监听器
     void StartAllListeners();
 
     /// \~chinese
-    /// @brief ֹͣм
+    /// @brief 停止所有监听器
     void StopAllListeners();
 
     /// \~chinese
-    /// @brief Ƴм
+    /// @brief 移除所有监听器
     void RemoveAllListeners();
 
     /// \~chinese
-    /// @brief ȡм
+    /// @brief 获取所有监听器
     const ListenerList& GetAllListeners() const;
 
     /// \~chinese
-    /// @brief ַ¼
-    /// @param evt ¼
-    /// @return Ƿַ¼
+    /// @brief 分发事件
+    /// @param evt 事件
+    /// @return 是否继续分发该事件
     bool DispatchEvent(Event* evt);
 
 private:
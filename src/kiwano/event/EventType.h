@@ -31,7 +31,7 @@ namespace kiwano
  */
 
 /// \~chinese
-/// @brief ¼
+/// @brief 事件类型
 class EventType
 {
 public:
@@ -40,7 +40,7 @@ public:
     EventType(const std::type_index& type);
 
     /// \~chinese
-    /// @brief Ƿǿ
+    /// @brief 是否是空类型
     bool IsNull() const;
 
     const std::type_index& GetType() const;
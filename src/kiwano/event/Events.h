@@ -21,6 +21,7 @@
 #pragma once
 
 #include <kiwano/event/Event.h>
+#include <kiwano/event/EventArena.h>
 #include <kiwano/event/KeyEvent.h>
 #include <kiwano/event/MouseEvent.h>
 #include <kiwano/event/WindowEvent.h>
@@ -35,7 +35,7 @@ KGE_DECLARE_SMART_PTR(KeyCharEvent);
  */
 
 /// \~chinese
-/// @brief ¼
+/// @brief 键盘事件
 class KGE_API KeyEvent : public Event
 {
 public:
@@ -43,31 +43,31 @@ public:
 };
 
 /// \~chinese
-/// @brief ̰¼
+/// @brief 键盘按下事件
 class KGE_API KeyDownEvent : public KeyEvent
 {
 public:
-    KeyCode code;  ///< ֵ
+    KeyCode code;  ///< 键值
 
     KeyDownEvent();
 };
 
 /// \~chinese
-/// @brief ̧¼
+/// @brief 键盘抬起事件
 class KGE_API KeyUpEvent : public KeyEvent
 {
 public:
-    KeyCode code;  ///< ֵ
+    KeyCode code;  ///< 键值
 
     KeyUpEvent();
 };
 
 /// \~chinese
-/// @brief ַ¼
+/// @brief 键盘字符事件
 class KGE_API KeyCharEvent : public KeyEvent
 {
 public:
-    char value;  ///< ַ
+    char value;  ///< 字符
 
     KeyCharEvent();
 };
@@ -40,17 +40,17 @@ KGE_DECLARE_SMART_PTR(MouseWheelEvent);
  */
 
 /// \~chinese
-/// @brief ¼
+/// @brief 鼠标事件
 class KGE_API MouseEvent : public Event
 {
 public:
-    Point pos;  ///< λ
+    Point pos;  ///< 鼠标位置
 
     MouseEvent(const EventType& type);
 };
 
 /// \~chinese
-/// @brief ƶ¼
+/// @brief 鼠标移动事件
 class KGE_API MouseMoveEvent : public MouseEvent
 {
 public:
@@ -58,37 +58,37 @@ public:
 };
 
 /// \~chinese
-/// @brief 갴¼
+/// @brief 鼠标按键按下事件
 class KGE_API MouseDownEvent : public MouseEvent
 {
 public:
-    MouseButton button;  ///< ֵ
+    MouseButton button;  ///< 鼠标键值
 
     MouseDownEvent();
 };
 
 /// \~chinese
-/// @brief 갴̧¼
+/// @brief 鼠标按键抬起事件
 class KGE_API MouseUpEvent : public MouseEvent
 {
 public:
-    MouseButton button;  ///< ֵ
+    MouseButton button;  ///< 鼠标键值
 
     MouseUpEvent();
 };
 
 /// \~chinese
-/// @brief ¼
+/// @brief 鼠标点击事件
 class KGE_API MouseClickEvent : public MouseEvent
 {
 public:
-    MouseButton button;  ///< ֵ
+    MouseButton button;  ///< 鼠标键值
 
     MouseClickEvent();
 };
 
 /// \~chinese
-/// @brief ¼
+/// @brief 鼠标移入事件
 class KGE_API MouseHoverEvent : public MouseEvent
 {
 public:
@@ -96,7 +96,7 @@ public:
 };
 
 /// \~chinese
-/// @brief Ƴ¼
+/// @brief 鼠标移出事件
 class KGE_API MouseOutEvent : public MouseEvent
 {
 public:
@@ -104,11 +104,11 @@ public:
 };
 
 /// \~chinese
-/// @brief ¼
+/// @brief 鼠标滚轮事件
 class KGE_API MouseWheelEvent : public MouseEvent
 {
 public:
-    float wheel;  ///< ֵ
+    float wheel;  ///< 滚轮值
 
     MouseWheelEvent();
 };
@@ -38,59 +38,59 @@ class Window;
  */
 
 /// \~chinese
-/// @brief ¼
+/// @brief 窗口事件
 class KGE_API WindowEvent : public Event
 {
 public:
-    Window* window;  ///< 
+    Window* window;  ///< 窗口
 
     WindowEvent(const EventType& type);
 };
 
 /// \~chinese
-/// @brief ƶ¼
+/// @brief 窗口移动事件
 class KGE_API WindowMovedEvent : public WindowEvent
 {
 public:
-    int x;  ///< Ͻ x 
-    int y;  ///< Ͻ y 
+    int x;  ///< 窗口左上角 x 坐标
+    int y;  ///< 窗口左上角 y 坐标
 
     WindowMovedEvent();
 };
 
 /// \~chinese
-/// @brief ڴС仯¼
+/// @brief 窗口大小变化事件
 class KGE_API WindowResizedEvent : public WindowEvent
 {
 public:
-    uint32_t width;   ///< ڿ
-    uint32_t height;  ///< ڸ߶
+    uint32_t width;   ///< 窗口宽度
+    uint32_t height;  ///< 窗口高度
 
     WindowResizedEvent();
 };
 
 /// \~chinese
-/// @brief ڽ仯¼
+/// @brief 窗口焦点变化事件
 class KGE_API WindowFocusChangedEvent : public WindowEvent
 {
 public:
-    bool focus;  ///< Ƿȡ
+    bool focus;  ///< 是否获取到焦点
 
     WindowFocusChangedEvent();
 };
 
 /// \~chinese
-/// @brief ڱ¼
+/// @brief 窗口标题更改事件
 class KGE_API WindowTitleChangedEvent : public WindowEvent
 {
 public:
-    String title;  ///< 
+    String title;  ///< 标题
 
     WindowTitleChangedEvent();
 };
 
 /// \~chinese
-/// @brief ڹر¼
+/// @brief 窗口关闭事件
 class KGE_API WindowClosedEvent : public WindowEvent
 {
 public:
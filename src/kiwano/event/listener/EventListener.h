@@ -32,7 +32,7 @@ KGE_DECLARE_SMART_PTR(EventListener);
 
 /**
  * \~chinese
- * \defgroup EventListener ¼
+ * \defgroup EventListener 事件监听器
  */
 
 /**
@@ -42,7 +42,7 @@ KGE_DECLARE_SMART_PTR(EventListener);
 
 /**
  * \~chinese
- * @brief ¼
+ * @brief 事件监听器
  */
 class KGE_API EventListener
     : public ObjectBase
@@ -53,7 +53,7 @@ class KGE_API EventListener
 
 public:
     /// \~chinese
-    /// @brief ص
+    /// @brief 监听器回调函数
     using Callback = Function<void(Event*)>;
 
     EventListener();
@@ -61,61 +61,61 @@ public:
     virtual ~EventListener();
 
     /// \~chinese
-    /// @brief 
-    /// @param callback ص
+    /// @brief 创建监听器
+    /// @param callback 回调函数
     static EventListenerPtr Create(const Callback& callback);
 
     /// \~chinese
-    /// @brief 
-    /// @param name 
-    /// @param type ¼
-    /// @param callback ص
+    /// @brief 创建监听器
+    /// @param name 监听器名称
+    /// @param type 监听的事件类型
+    /// @param callback 回调函数
     static EventListenerPtr Create(const String& name, const Callback& callback);
 
     /// \~chinese
-    /// @brief 
-    /// @param type ¼
-    /// @param callback ص
+    /// @brief 创建监听器
+    /// @param type 监听的事件类型
+    /// @param callback 回调函数
     static EventListenerPtr Create(EventType type, const Callback& callback);
 
     /// \~chinese
-    /// @brief 
-    /// @param name 
-    /// @param type ¼
-    /// @param callback ص
+    /// @brief 创建监听器
+    /// @param name 监听器名称
+    /// @param type 监听的事件类型
+    /// @param callback 回调函数
     static EventListenerPtr Create(const String& name, EventType type, const Callback& callback);
 
     /// \~chinese
-    /// @brief 
+    /// @brief 启动监听器
     void Start();
 
     /// \~chinese
-    /// @brief ֹͣ
+    /// @brief 停止监听器
     void Stop();
 
     /// \~chinese
-    /// @brief Ƴ
+    /// @brief 移除监听器
     void Remove();
 
     /// \~chinese
-    /// @brief Ƿ
+    /// @brief 是否正在运行
     bool IsRunning() const;
 
     /// \~chinese
-    /// @brief ǷƳ
+    /// @brief 是否可移除
     bool IsRemoveable() const;
 
     /// \~chinese
-    /// @brief ǷϢû
+    /// @brief 是否开启消息吞没
     bool IsSwallowEnabled() const;
 
     /// \~chinese
-    /// @brief Ϣû
-    /// @param enabled Ƿ
+    /// @brief 设置消息吞没功能
+    /// @param enabled 是否启用
     void SetSwallowEnabled(bool enabled);
 
     /// \~chinese
-    /// @brief Ϣ
+    /// @brief 处理消息
     virtual void Handle(Event* evt) = 0;
 
 private:
@@ -34,24 +34,24 @@ KGE_DECLARE_SMART_PTR(KeyEventListener);
 
 /**
  * \~chinese
- * @brief ¼
+ * @brief 按键事件监听器
  */
 class KGE_API KeyEventListener
     : public EventListener
 {
 public:
     /// \~chinese
-    /// @brief ʱ
-    /// @param key ֵ
+    /// @brief 按键按下时
+    /// @param key 按键键值
     virtual void OnKeyDown(KeyCode key) {}
 
     /// \~chinese
-    /// @brief ̧ʱ
-    /// @param key ֵ
+    /// @brief 按键抬起时
+    /// @param key 按键键值
     virtual void OnKeyUp(KeyCode key) {}
 
     /// \~chinese
-    /// @brief Ϣ
+    /// @brief 处理消息
     void Handle(Event* evt) override;
 };
 
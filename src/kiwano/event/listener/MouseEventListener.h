@@ -35,43 +35,43 @@ KGE_DECLARE_SMART_PTR(MouseDragEventListener);
 
 /**
  * \~chinese
- * @brief ¼
+ * @brief 鼠标事件监听器
  */
 class KGE_API MouseEventListener
     : public EventListener
 {
 public:
     /// \~chinese
-    /// @brief ƶʱ
-    /// @param pos λ
+    /// @brief 鼠标移动时
+    /// @param pos 鼠标位置
     virtual void OnMouseMoving(const Point& pos) {}
 
     /// \~chinese
-    /// @brief 갴ʱ
-    /// @param pos λ
-    /// @param button ֵ
+    /// @brief 鼠标按下时
+    /// @param pos 鼠标位置
+    /// @param button 鼠标键值
     virtual void OnMouseDown(const Point& pos, MouseButton button) {}
 
     /// \~chinese
-    /// @brief ̧ʱ
-    /// @param pos λ
-    /// @param button ֵ
+    /// @brief 鼠标抬起时
+    /// @param pos 鼠标位置
+    /// @param button 鼠标键值
     virtual void OnMouseUp(const Point& pos, MouseButton button) {}
 
     /// \~chinese
-    /// @brief ֹʱ
-    /// @param pos λ
-    /// @param wheel ֵֹ
+    /// @brief 鼠标滚轮滚动时
+    /// @param pos 鼠标位置
+    /// @param wheel 鼠标滚轮滚动值
     virtual void OnMouseWheelScrolling(const Point& pos, float wheel) {}
 
     /// \~chinese
-    /// @brief Ϣ
+    /// @brief 处理消息
     void Handle(Event* evt) override;
 };
 
 /**
  * \~chinese
- * @brief ϶¼
+ * @brief 鼠标拖动事件监听器
  */
 class KGE_API MouseDragEventListener : public EventListener
 {
@@ -79,37 +79,37 @@ public:
     MouseDragEventListener();
 
     /// \~chinese
-    /// @brief ϶ʼ
-    /// @param pos λ
-    /// @param button ֵ
-    /// @return ǷӦ϶
+    /// @brief 鼠标拖动开始
+    /// @param pos 鼠标位置
+    /// @param button 鼠标键值
+    /// @return 是否响应这次拖动
     virtual bool OnDragStart(const Point& pos, MouseButton button)
     {
         return true;
     }
 
     /// \~chinese
-    /// @brief ϶ʱ
-    /// @param offset λƫ
-    /// @param button ֵ
+    /// @brief 鼠标拖动时
+    /// @param offset 鼠标位置偏移量
+    /// @param button 鼠标键值
     virtual void OnDragging(const Point& offset, MouseButton button) {}
 
     /// \~chinese
-    /// @brief ϶
-    /// @param pos λ
-    /// @param button ֵ
+    /// @brief 鼠标拖动结束
+    /// @param pos 鼠标位置
+    /// @param button 鼠标键值
     virtual void OnDragEnd(const Point& pos, MouseButton button) {}
 
     /// \~chinese
-    /// @brief ȡ갴϶״̬
+    /// @brief 获取鼠标按键的拖动状态
     bool IsDragging(MouseButton button);
 
     /// \~chinese
-    /// @brief ȡ갴ʼ϶λ
+    /// @brief 获取鼠标按键的起始拖动位置
     Point GetDragPoint(MouseButton button);
 
     /// \~chinese
-    /// @brief Ϣ
+    /// @brief 处理消息
     void Handle(Event* evt) override;
 
 private:
@@ -46,6 +46,7 @@
 
 #include <kiwano/core/Common.h>
 #include <kiwano/core/Defer.h>
+#include <kiwano/core/PoolAllocator.h>
 #include <kiwano/core/Resource.h>
 #include <kiwano/core/RefBasePtr.hpp>
 #include <kiwano/core/Time.h>
@@ -89,6 +90,7 @@
 #include <kiwano/render/Layer.h>
 #include <kiwano/render/TextLayout.h>
 #include <kiwano/render/TextureCache.h>
+#include <kiwano/render/TextureLoader.h>
 #include <kiwano/render/Renderer.h>
 
 //
@@ -104,7 +106,9 @@
 #include <kiwano/2d/SpriteFrame.h>
 #include <kiwano/2d/Sprite.h>
 #include <kiwano/2d/Stage.h>
+#include <kiwano/2d/SpatialIndex.h>
 #include <kiwano/2d/TextActor.h>
+#include <kiwano/2d/TextureAtlas.h>
 
 //
 // transition
@@ -124,6 +128,7 @@
 #include <kiwano/2d/animation/DelayAnimation.h>
 #include <kiwano/2d/animation/AnimationGroup.h>
 #include <kiwano/2d/animation/TweenAnimation.h>
+#include <kiwano/2d/animation/TweenBatch.h>
 #include <kiwano/2d/animation/PathAnimation.h>
 #include <kiwano/2d/animation/FrameSequence.h>
 #include <kiwano/2d/animation/FrameAnimation.h>
@@ -146,6 +151,7 @@
 
 #include <kiwano/utils/Logger.h>
 #include <kiwano/utils/ResourceCache.h>
+#include <kiwano/utils/ResourcePack.h>
 #include <kiwano/utils/ResourceLoader.h>
 #include <kiwano/utils/UserData.h>
 #include <kiwano/utils/Timer.h>
@@ -69,7 +69,15 @@
 #define KGE_RENDER_ENGINE_OPENGL 1
 #define KGE_RENDER_ENGINE_OPENGLES 2
 #define KGE_RENDER_ENGINE_DIRECTX 3
-#define KGE_RENDER_ENGINE KGE_RENDER_ENGINE_NONE
+#define KGE_RENDER_ENGINE_SOFTWARE 4
+
+#ifndef KGE_RENDER_ENGINE
+#   define KGE_RENDER_ENGINE KGE_RENDER_ENGINE_NONE
+#endif
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#   define KGE_SIMD_SSE2
+#endif
 
 /////////////////////////////////////////////////////////////
 //
@@ -185,8 +193,24 @@ KGE_SUPPRESS_WARNING(4251)
 
 #else
 
+#if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_NONE
+#   undef KGE_RENDER_ENGINE
+#   define KGE_RENDER_ENGINE KGE_RENDER_ENGINE_SOFTWARE
+#endif
+
 #if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_DIRECTX
 #   error "DirectX render engine is not supported on current platform"
 #endif
 
+#define KGE_DEPRECATED(...)
+
+#define KGE_SUPPRESS_WARNING_PUSH
+#define KGE_SUPPRESS_WARNING(CODE)
+#define KGE_SUPPRESS_WARNING_POP
+
+#ifndef KGE_API
+/* Building or calling Kiwano as a static library */
+#   define KGE_API
+#endif
+
 #endif  // KGE_PLATFORM_WINDOWS
@@ -20,6 +20,7 @@
 
 #pragma once
 #include <algorithm>
+#include <cstdint>
 #include <kiwano/math/Rect.hpp>
 #include <kiwano/math/Vec2.hpp>
 
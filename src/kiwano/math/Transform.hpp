@@ -29,7 +29,7 @@ namespace math
 
 /**
  * \~chinese
- * @brief ά任
+ * @brief 二维放射变换
  */
 template <typename _Ty>
 class TransformT
@@ -37,16 +37,16 @@ class TransformT
 public:
     using ValueType = _Ty;
 
-    float            rotation;  ///< ת
-    Vec2T<ValueType> position;  ///< 
-    Vec2T<ValueType> scale;     ///< 
-    Vec2T<ValueType> skew;      ///< нǶ
+    float            rotation;  ///< 旋转
+    Vec2T<ValueType> position;  ///< 坐标
+    Vec2T<ValueType> scale;     ///< 缩放
+    Vec2T<ValueType> skew;      ///< 错切角度
 
 public:
     TransformT();
 
     /// \~chinese
-    /// @brief ά任תΪ
+    /// @brief 将二维放射变换转换为矩阵
     Matrix3x2T<ValueType> ToMatrix() const;
 
     bool IsFast() const;
@@ -21,6 +21,8 @@
 #include <kiwano/platform/Application.h>
 #include <kiwano/core/Defer.h>
 #include <kiwano/base/Director.h>
+#include <kiwano/event/EventArena.h>
+#include <kiwano/event/WindowEvent.h>
 #include <kiwano/render/Renderer.h>
 #include <kiwano/utils/Logger.h>
 
@@ -35,7 +37,13 @@ int GetVersion()
 Application::Application()
     : running_(false)
     , is_paused_(false)
+    , pipelined_(false)
+    , render_thread_running_(false)
     , time_scale_(1.f)
+    , max_steps_(5)
+    , interpolation_alpha_(1.f)
+    , back_snapshot_(0)
+    , pending_snapshot_(nullptr)
 {
 }
 
@@ -72,6 +80,11 @@ void Application::Run(RunnerPtr runner)
     // Update everything
     this->Update(0);
 
+    if (pipelined_)
+    {
+        StartRenderThread();
+    }
+
     // Start the loop
     while (running_)
     {
@@ -106,12 +119,59 @@ void Application::Quit()
 
 void Application::UpdateFrame(Duration dt)
 {
-    this->Render();
-    this->Update(dt);
+    if (render_thread_running_)
+    {
+        // The render thread draws this snapshot while the next frame is updating
+        this->Simulate(dt);
+        this->RecordSnapshot();
+    }
+    else
+    {
+        this->Render();
+        this->Simulate(dt);
+    }
+
+    // Recycle transient events allocated in this frame
+    EventArena::GetInstance().Reset();
+
+    Actor::ResetTransformCount();
+}
+
+void Application::Simulate(Duration dt)
+{
+    if (fixed_step_.IsZero())
+    {
+        this->Update(dt);
+    }
+    else
+    {
+        accumulator_ += dt;
+
+        int steps = 0;
+        while (accumulator_ >= fixed_step_ && steps < max_steps_)
+        {
+            Actor::AdvanceSimulationStep();
+            this->Update(fixed_step_);
+
+            accumulator_ -= fixed_step_;
+            ++steps;
+        }
+
+        // Drop the time that can not be caught up with, otherwise every slow frame makes the next one slower
+        if (accumulator_ >= fixed_step_)
+        {
+            accumulator_ = Duration(accumulator_.GetMilliseconds() % fixed_step_.GetMilliseconds());
+        }
+
+        interpolation_alpha_ = accumulator_ / fixed_step_;
+        Actor::SetInterpolationAlpha(interpolation_alpha_);
+    }
 }
 
 void Application::Destroy()
 {
+    StopRenderThread();
+
     if (runner_)
     {
         runner_->OnDestroy();
@@ -148,6 +208,17 @@ void Application::SetTimeScale(float scale_factor)
     time_scale_ = scale_factor;
 }
 
+void Application::SetFixedStep(Duration step, int max_steps)
+{
+    KGE_ASSERT(max_steps > 0);
+
+    fixed_step_          = step;
+    max_steps_           = max_steps;
+    accumulator_         = 0;
+    interpolation_alpha_ = 1.f;
+    Actor::SetInterpolationAlpha(interpolation_alpha_);
+}
+
 void Application::DispatchEvent(EventPtr evt)
 {
     this->DispatchEvent(evt.Get());
@@ -158,6 +229,12 @@ void Application::DispatchEvent(Event* evt)
     if (!running_ /* Dispatch events even if application is paused */)
         return;
 
+    if (render_thread_running_ && evt->Cast<WindowResizedEvent>())
+    {
+        // The render target is going to be resized
+        WaitForRenderThread();
+    }
+
     auto ctx = EventModuleContext(modules_, evt);
     ctx.Next();
 }
@@ -205,10 +282,116 @@ void Application::Render()
     renderer.Present();
 }
 
-void Application::PreformInMainThread(Function<void()> func)
+void Application::SetPipelinedRendering(bool enabled)
+{
+    pipelined_ = enabled;
+
+    if (running_)
+    {
+        if (enabled)
+            StartRenderThread();
+        else
+            StopRenderThread();
+    }
+}
+
+void Application::RecordSnapshot()
+{
+    // Pipelining may be turned off during the update, the next frame is rendered directly then
+    if (!running_ || !render_thread_running_)
+        return;
+
+    Renderer&       renderer = Renderer::GetInstance();
+    RenderSnapshot& snapshot = *snapshots_[back_snapshot_];
+    snapshot.Reset(renderer.GetContext());
+
+    {
+        auto ctx = RenderModuleContext(modules_, snapshot);
+        ctx.Next();
+    }
+
+    // Hand the snapshot over when the previous one is done, it was recorded into the other buffer
+    std::unique_lock<std::mutex> lock(render_mutex_);
+    render_cond_.wait(lock, [this]() { return pending_snapshot_ == nullptr; });
+
+    pending_snapshot_ = &snapshot;
+    back_snapshot_    = 1 - back_snapshot_;
+    render_cond_.notify_all();
+}
+
+void Application::StartRenderThread()
+{
+    if (render_thread_running_)
+        return;
+
+    for (auto& snapshot : snapshots_)
+    {
+        if (!snapshot)
+            snapshot = MakePtr<RenderSnapshot>();
+    }
+
+    render_thread_running_ = true;
+    render_thread_         = std::thread(&Application::RenderThreadMain, this);
+}
+
+void Application::StopRenderThread()
+{
+    if (!render_thread_running_)
+        return;
+
+    {
+        std::unique_lock<std::mutex> lock(render_mutex_);
+        render_cond_.wait(lock, [this]() { return pending_snapshot_ == nullptr; });
+
+        render_thread_running_ = false;
+        render_cond_.notify_all();
+    }
+    render_thread_.join();
+
+    // Release resources held by the last frames
+    for (auto& snapshot : snapshots_)
+    {
+        snapshot = nullptr;
+    }
+}
+
+void Application::WaitForRenderThread()
+{
+    std::unique_lock<std::mutex> lock(render_mutex_);
+    render_cond_.wait(lock, [this]() { return pending_snapshot_ == nullptr; });
+}
+
+void Application::RenderThreadMain()
+{
+    Renderer&      renderer = Renderer::GetInstance();
+    RenderContext& ctx      = renderer.GetContext();
+
+    std::unique_lock<std::mutex> lock(render_mutex_);
+    while (true)
+    {
+        render_cond_.wait(lock, [this]() { return pending_snapshot_ != nullptr || !render_thread_running_; });
+        if (!pending_snapshot_)
+            break;
+
+        RenderSnapshot* snapshot = pending_snapshot_;
+        lock.unlock();
+
+        renderer.Clear();
+        ctx.BeginDraw();
+        snapshot->Replay(ctx);
+        ctx.EndDraw();
+        renderer.Present();
+
+        lock.lock();
+        pending_snapshot_ = nullptr;
+        render_cond_.notify_all();
+    }
+}
+
+void Application::PreformInMainThread(UniqueFunction<void()> func)
 {
     std::lock_guard<std::mutex> lock(perform_mutex_);
-    functions_to_perform_.push(func);
+    functions_to_perform_.push(std::move(func));
 }
 
 }  // namespace kiwano
@@ -20,6 +20,8 @@
 
 #pragma once
 #include <mutex>
+#include <thread>
+#include <condition_variable>
 #include <kiwano/core/Common.h>
 #include <kiwano/base/Module.h>
 #include <kiwano/core/Time.h>
@@ -27,6 +29,7 @@
 #include <kiwano/event/Event.h>
 #include <kiwano/platform/Runner.h>
 #include <kiwano/platform/Window.h>
+#include <kiwano/render/RenderSnapshot.h>
 #include <kiwano/utils/Timer.h>
 
 namespace kiwano
@@ -34,13 +37,13 @@ namespace kiwano
 
 /**
  * \~chinese
- * @brief ȡ汾
+ * @brief 获取版本号
  */
 extern KGE_API int GetVersion();
 
 /**
  * \~chinese
- * @brief Ӧó򣬿ϷڣʼԼ¼ַ
+ * @brief 应用程序，控制游戏的整个生命周期，包括初始化、启动、结束以及事件分发等
  */
 class KGE_API Application
     : public Singleton<Application>
@@ -54,125 +57,213 @@ public:
 
     /**
      * \~chinese
-     * @brief Ӧó
-     * @param runner 
-     * @param debug Ƿõģʽ
-     * @note úģӦóʱ
+     * @brief 启动应用程序
+     * @param runner 程序运行器
+     * @param debug 是否启用调试模式
+     * @note 该函数是阻塞的，应用程序结束时函数返回
      */
     void Run(RunnerPtr runner);
 
     /**
      * \~chinese
-     * @brief ͣӦó
+     * @brief 暂停应用程序
      */
     void Pause();
 
     /**
      * \~chinese
-     * @brief Ӧó
+     * @brief 继续应用程序
      */
     void Resume();
 
     /**
      * \~chinese
-     * @brief ֹӦó
+     * @brief 终止应用程序
      */
     void Quit();
 
     /**
      * \~chinese
-     * @brief ȡͣ״̬
+     * @brief 获取暂停状态
      */
     bool IsPaused() const;
 
     /**
      * \~chinese
-     * @brief ģ
-     * @param[in] module ģ
+     * @brief 添加模块
+     * @param[in] module 模块
      */
     void Use(Module& module);
 
     /**
      * \~chinese
-     * @brief ȡ
+     * @brief 获取程序运行器
      */
     RunnerPtr GetRunner() const;
 
     /**
      * \~chinese
-     * @brief ȡ
+     * @brief 获取窗口
      */
     WindowPtr GetWindow() const;
 
     /**
      * \~chinese
-     * @brief ʱ
-     * @details ʱӿɵȱŴСʱ
-     * @param scale_factor 
-     * @warning Ϊܵ¶ϵͳ
+     * @brief 设置时间缩放因子
+     * @details 设置时间缩放因子可等比例放大或缩小时间进度
+     * @param scale_factor 缩放因子
+     * @warning 设置为负数可能导致动画系统紊乱
      */
     void SetTimeScale(float scale_factor);
 
     /**
      * \~chinese
-     * @brief ַ¼
-     * @details ¼ַ¼ģ
-     * @param evt ¼
+     * @brief 设置固定更新步长
+     * @details 启用后每帧经过的时间累积起来，按固定步长更新所有模块零次或多次，剩余不足一个步长的时间留到下一帧，
+     * 物理等模拟不再受帧率波动影响。剩余时间与步长之比作为插值系数提供给角色渲染
+     * @param step 更新步长，为零时每帧按实际经过的时间更新一次
+     * @param max_steps 每帧最多补偿的更新次数，超出的时间被丢弃，防止卡顿后更新越来越慢
+     */
+    void SetFixedStep(Duration step, int max_steps = 5);
+
+    /**
+     * \~chinese
+     * @brief 获取固定更新步长，为零时未启用
+     */
+    Duration GetFixedStep() const;
+
+    /**
+     * \~chinese
+     * @brief 获取渲染插值系数
+     * @details 上一次固定步长更新后累积的时间与步长之比，范围 [0.0 - 1.0]，未启用固定步长时为 1.0
+     */
+    float GetInterpolationAlpha() const;
+
+    /**
+     * \~chinese
+     * @brief 启用或禁用流水线渲染
+     * @details 启用后，主线程在更新结束后将场景录制为渲染快照，由独立的渲染线程回放到渲染上下文并呈现。
+     * 渲染线程绘制上一帧的同时主线程更新下一帧，画面比更新晚一帧
+     * @note 渲染线程回放期间，不应原地修改上一帧绘制过的纹理、文字布局、画刷等资源；
+     * 在渲染回调中直接使用图形设备的模块（如 ImGui）不支持流水线渲染
+     */
+    void SetPipelinedRendering(bool enabled);
+
+    /**
+     * \~chinese
+     * @brief 是否启用了流水线渲染
+     */
+    bool IsPipelinedRendering() const;
+
+    /**
+     * \~chinese
+     * @brief 分发事件
+     * @details 将事件分发给所有事件功能模块
+     * @param evt 事件
      */
     void DispatchEvent(EventPtr evt);
 
     /**
      * \~chinese
-     * @brief ַ¼
-     * @details ¼ַ¼ģ
-     * @param evt ¼
+     * @brief 分发事件
+     * @details 将事件分发给所有事件功能模块
+     * @param evt 事件
      */
     void DispatchEvent(Event* evt);
 
     /**
      * \~chinese
-     * @brief ִ߳к
-     * @details ṩ̵߳ Kiwano 
-     * @param func Ҫִеĺ
+     * @brief 在主线程中执行函数
+     * @details 提供在其他线程调用 Kiwano 函数的能力
+     * @param func 需要执行的函数
      */
-    void PreformInMainThread(Function<void()> func);
+    void PreformInMainThread(UniqueFunction<void()> func);
 
     /**
      * \~chinese
-     * @brief һ֡
-     * @param dt ʱ
+     * @brief 更新一帧
+     * @param dt 时间间隔
      */
     void UpdateFrame(Duration dt);
 
     /**
      * \~chinese
-     * @brief ϷйвԴ
+     * @brief 销毁游戏运行过程中产生的所有资源
      */
     void Destroy();
 
 private:
     /**
      * \~chinese
-     * @brief ģ
-     * @param dt ʱ
+     * @brief 更新所有模块
+     * @param dt 时间间隔
      */
     void Update(Duration dt);
 
     /**
      * \~chinese
-     * @brief Ⱦ
+     * @brief 按固定步长或实际经过的时间更新
+     * @param dt 时间间隔
+     */
+    void Simulate(Duration dt);
+
+    /**
+     * \~chinese
+     * @brief 渲染画面
      */
     void Render();
 
+    /**
+     * \~chinese
+     * @brief 录制渲染快照并交给渲染线程
+     */
+    void RecordSnapshot();
+
+    /**
+     * \~chinese
+     * @brief 启动渲染线程
+     */
+    void StartRenderThread();
+
+    /**
+     * \~chinese
+     * @brief 等待渲染线程画完当前快照后停止
+     */
+    void StopRenderThread();
+
+    /**
+     * \~chinese
+     * @brief 等待渲染线程画完当前快照
+     */
+    void WaitForRenderThread();
+
+    /**
+     * \~chinese
+     * @brief 渲染线程入口
+     */
+    void RenderThreadMain();
+
 private:
-    bool                    running_;
-    bool                    is_paused_;
-    float                   time_scale_;
-    RunnerPtr               runner_;
-    TimerPtr                timer_;
-    ModuleList              modules_;
-    std::mutex              perform_mutex_;
-    Queue<Function<void()>> functions_to_perform_;
+    bool                          running_;
+    bool                          is_paused_;
+    bool                          pipelined_;
+    bool                          render_thread_running_;
+    float                         time_scale_;
+    int                           max_steps_;
+    float                         interpolation_alpha_;
+    Duration                      fixed_step_;
+    Duration                      accumulator_;
+    int                           back_snapshot_;
+    RenderSnapshot*               pending_snapshot_;
+    RenderSnapshotPtr             snapshots_[2];
+    std::thread                   render_thread_;
+    std::mutex                    render_mutex_;
+    std::condition_variable       render_cond_;
+    RunnerPtr                     runner_;
+    TimerPtr                      timer_;
+    ModuleList                    modules_;
+    std::mutex                    perform_mutex_;
+    Queue<UniqueFunction<void()>> functions_to_perform_;
 };
 
 inline RunnerPtr Application::GetRunner() const
@@ -192,4 +283,19 @@ inline bool Application::IsPaused() const
     return is_paused_;
 }
 
+inline Duration Application::GetFixedStep() const
+{
+    return fixed_step_;
+}
+
+inline float Application::GetInterpolationAlpha() const
+{
+    return interpolation_alpha_;
+}
+
+inline bool Application::IsPipelinedRendering() const
+{
+    return pipelined_;
+}
+
 }  // namespace kiwano
@@ -21,6 +21,12 @@
 #include <cctype>
 #include <kiwano/platform/FileSystem.h>
 
+#if !defined(KGE_PLATFORM_WINDOWS)
+#include <cstdio>
+#include <fstream>
+#include <sys/stat.h>
+#endif
+
 namespace kiwano
 {
 namespace
@@ -43,9 +49,14 @@ inline String ConvertPathFormat(const String& path)
 
 inline bool IsFileExists(const String& path)
 {
+#if defined(KGE_PLATFORM_WINDOWS)
     DWORD dwAttrib = ::GetFileAttributesA(path.c_str());
 
     return (dwAttrib != INVALID_FILE_ATTRIBUTES && !(dwAttrib & FILE_ATTRIBUTE_DIRECTORY));
+#else
+    struct stat st;
+    return ::stat(path.c_str(), &st) == 0 && !S_ISDIR(st.st_mode);
+#endif
 }
 }  // namespace
 
@@ -157,19 +168,36 @@ bool FileSystem::IsFileExists(const String& file_path) const
 
 bool FileSystem::IsAbsolutePath(const String& path) const
 {
+#if defined(KGE_PLATFORM_WINDOWS)
     // like "C:\some.file"
     return path.length() > 2 && ((std::isalpha(path[0]) && path[1] == ':') || (path[0] == '/' && path[1] == '/'));
+#else
+    return !path.empty() && path[0] == '/';
+#endif
 }
 
 bool FileSystem::RemoveFile(const String& file_path) const
 {
+#if defined(KGE_PLATFORM_WINDOWS)
     if (::DeleteFileA(file_path.c_str()))
         return true;
     return false;
+#else
+    return std::remove(file_path.c_str()) == 0;
+#endif
 }
 
 bool FileSystem::ExtractResourceToFile(const Resource& res, const String& dest_file_name) const
 {
+#if !defined(KGE_PLATFORM_WINDOWS)
+    BinaryData data = res.GetData();
+    if (!data.IsValid())
+        return false;
+
+    std::ofstream ofs(dest_file_name.c_str(), std::ios::binary | std::ios::trunc);
+    ofs.write(static_cast<const char*>(data.GetBuffer()), std::streamsize(data.GetSize()));
+    return bool(ofs);
+#else
     HANDLE file_handle =
         ::CreateFileA(dest_file_name.c_str(), GENERIC_WRITE, NULL, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
 
@@ -180,7 +208,7 @@ bool FileSystem::ExtractResourceToFile(const Resource& res, const String& dest_f
     if (data.IsValid())
     {
         DWORD written_bytes = 0;
-        ::WriteFile(file_handle, data.buffer, data.size, &written_bytes, NULL);
+        ::WriteFile(file_handle, data.GetBuffer(), DWORD(data.GetSize()), &written_bytes, NULL);
         ::CloseHandle(file_handle);
 
         return true;
@@ -191,6 +219,7 @@ bool FileSystem::ExtractResourceToFile(const Resource& res, const String& dest_f
         ::DeleteFileA(dest_file_name.c_str());
     }
     return false;
+#endif
 }
 
 }  // namespace kiwano
@@ -25,7 +25,7 @@ namespace kiwano
 {
 /**
  * \~chinese
- * @brief ļϵͳΪģṩļ
+ * @brief 文件系统，为其他模块提供文件搜索规则等
  */
 class KGE_API FileSystem : public Singleton<FileSystem>
 {
@@ -34,71 +34,71 @@ class KGE_API FileSystem : public Singleton<FileSystem>
 public:
     /**
      * \~chinese
-     * @brief ļ·
-     * @param path ļ·
+     * @brief 添加文件搜索路径
+     * @param path 文件搜索路径
      */
     void AddSearchPath(const String& path);
 
     /**
      * \~chinese
-     * @brief ļ·
-     * @param paths ·
+     * @brief 设置文件搜索路径
+     * @param paths 搜索路径数组
      */
     void SetSearchPaths(const Vector<String>& paths);
 
     /**
      * \~chinese
-     * @brief бвļȡ·
-     * @param file ļ·
-     * @return ļ·
+     * @brief 在搜索列表中查找文件并获取完整路径
+     * @param file 文件路径
+     * @return 完整的文件路径
      */
     String GetFullPathForFile(const String& file) const;
 
     /**
      * \~chinese
-     * @brief ļ·ֵ
-     * @param key ļؼ
-     * @param file_path ļ·
+     * @brief 添加文件路径查找字典规则
+     * @param key 文件关键词
+     * @param file_path 文件路径
      */
     void AddFileLookupRule(const String& key, const String& file_path);
 
     /**
      * \~chinese
-     * @brief ļ·ֵ
-     * @param dict ļ·ֵ
+     * @brief 设置文件路径查找字典
+     * @param dict 文件路径查找字典
      */
     void SetFileLookupDictionary(const UnorderedMap<String, String>& dict);
 
     /**
      * \~chinese
-     * @brief ļǷ
-     * @param file_path ļ·
-     * @return ļڣ true
+     * @brief 文件是否存在
+     * @param file_path 文件路径
+     * @return 若文件存在，返回 true
      */
     bool IsFileExists(const String& file_path) const;
 
     /**
      * \~chinese
-     * @brief ж·ǷǾ·
-     * @param path ļ·
-     * @return Ǿ· true
+     * @brief 判断路径是否是绝对路径
+     * @param path 文件路径
+     * @return 若是绝对路径，返回 true
      */
     bool IsAbsolutePath(const String& path) const;
 
     /**
      * \~chinese
-     * @brief ɾļ
-     * @param file_path ļ·
-     * @return ɾǷɹ
+     * @brief 删除文件
+     * @param file_path 文件路径
+     * @return 删除是否成功
      */
     bool RemoveFile(const String& file_path) const;
 
     /**
      * \~chinese
-     * @brief ͷŶԴʱļĿ¼
-     * @param res Դ
-     * @param dest_file_name Ŀļ
-     * @return Ƿɹ
+     * @brief 释放二进制资源到临时文件目录
+     * @param res 资源
+     * @param dest_file_name 目标文件名
+     * @return 操作是否成功
      */
     bool ExtractResourceToFile(const Resource& res, const String& dest_file_name) const;
 
@@ -31,7 +31,7 @@ namespace kiwano
 {
 /**
  * \~chinese
- * @brief 豸ʵɻȡͼ̵İ״̬
+ * @brief 输入设备实例，可获取鼠标和键盘的按键状态
  */
 class KGE_API Input final
     : public Singleton<Input>
@@ -42,63 +42,63 @@ class KGE_API Input final
 public:
     /**
      * \~chinese
-     * @brief ̰Ƿ
-     * @param key ֵ
+     * @brief 检测键盘按键是否正被按下
+     * @param key 键值
      */
     bool IsDown(KeyCode key) const;
 
     /**
      * \~chinese
-     * @brief ̰Ƿձ
-     * @param key ֵ
+     * @brief 检测键盘按键是否刚被点击
+     * @param key 键值
      */
     bool WasPressed(KeyCode key) const;
 
     /**
      * \~chinese
-     * @brief ̰Ƿ̧
-     * @param key ֵ
+     * @brief 检测键盘按键是否刚抬起
+     * @param key 键值
      */
     bool WasReleased(KeyCode key) const;
     /**
      * \~chinese
-     * @brief 갴Ƿ
-     * @param btn ֵ
+     * @brief 检测鼠标按键是否正被按下
+     * @param btn 鼠标键值
      */
     bool IsDown(MouseButton btn) const;
 
     /**
      * \~chinese
-     * @brief 갴Ƿձ
-     * @param btn ֵ
+     * @brief 检测鼠标按键是否刚被点击
+     * @param btn 鼠标键值
      */
     bool WasPressed(MouseButton btn) const;
 
     /**
      * \~chinese
-     * @brief 갴Ƿ̧
-     * @param btn ֵ
+     * @brief 检测鼠标按键是否刚抬起
+     * @param btn 鼠标键值
      */
     bool WasReleased(MouseButton btn) const;
 
     /**
      * \~chinese
-     * @brief  x 
-     * @return  x 
+     * @brief 获得鼠标 x 坐标
+     * @return 鼠标 x 坐标
      */
     float GetMouseX() const;
 
     /**
      * \~chinese
-     * @brief  y 
-     * @return  y 
+     * @brief 获得鼠标 y 坐标
+     * @return 鼠标 y 坐标
      */
     float GetMouseY() const;
 
     /**
      * \~chinese
-     * @brief 
-     * @return 
+     * @brief 获得鼠标坐标
+     * @return 鼠标坐标
      */
     Point GetMousePos() const;
 
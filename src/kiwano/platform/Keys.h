@@ -24,97 +24,97 @@
 namespace kiwano
 {
 /// \~chinese
-/// @brief 갴
+/// @brief 鼠标按键
 enum class MouseButton
 {
-    Left,    ///< 
-    Right,   ///< Ҽ
-    Middle,  ///< м
+    Left,    ///< 鼠标左键
+    Right,   ///< 鼠标右键
+    Middle,  ///< 鼠标中键
 
     Last
 };
 
 /// \~chinese
-/// @brief ֵ
+/// @brief 按键键值
 enum class KeyCode
 {
-    Unknown,  ///< δ֪
-    Up,       ///< ϼ
-    Left,     ///< 
-    Right,    ///< Ҽ
-    Down,     ///< ¼
-    Enter,    ///< س
-    Space,    ///< ո
-    Esc,      ///< ˳
-    Ctrl,     ///< CTRL
-    Shift,    ///< SHIFT
-    Alt,      ///< ALT
-    Tab,      ///< TAB
-    Delete,   ///< ɾ
-    Back,     ///< ˸
-    Super,    ///< Cmd|Super|Windows
+    Unknown,  ///< 未知
+    Up,       ///< 上键
+    Left,     ///< 左键
+    Right,    ///< 右键
+    Down,     ///< 下键
+    Enter,    ///< 回车键
+    Space,    ///< 空格键
+    Esc,      ///< 退出键
+    Ctrl,     ///< CTRL键
+    Shift,    ///< SHIFT键
+    Alt,      ///< ALT键
+    Tab,      ///< TAB键
+    Delete,   ///< 删除键
+    Back,     ///< 退格键
+    Super,    ///< Cmd|Super|Windows键
 
-    A,  ///< A
-    B,  ///< B
-    C,  ///< C
-    D,  ///< D
-    E,  ///< E
-    F,  ///< F
-    G,  ///< G
-    H,  ///< H
-    I,  ///< I
-    J,  ///< J
-    K,  ///< K
-    L,  ///< L
-    M,  ///< M
-    N,  ///< N
-    O,  ///< O
-    P,  ///< P
-    Q,  ///< Q
-    R,  ///< R
-    S,  ///< S
-    T,  ///< T
-    U,  ///< U
-    V,  ///< V
-    W,  ///< W
-    X,  ///< X
-    Y,  ///< Y
-    Z,  ///< Z
+    A,  ///< A键
+    B,  ///< B键
+    C,  ///< C键
+    D,  ///< D键
+    E,  ///< E键
+    F,  ///< F键
+    G,  ///< G键
+    H,  ///< H键
+    I,  ///< I键
+    J,  ///< J键
+    K,  ///< K键
+    L,  ///< L键
+    M,  ///< M键
+    N,  ///< N键
+    O,  ///< O键
+    P,  ///< P键
+    Q,  ///< Q键
+    R,  ///< R键
+    S,  ///< S键
+    T,  ///< T键
+    U,  ///< U键
+    V,  ///< V键
+    W,  ///< W键
+    X,  ///< X键
+    Y,  ///< Y键
+    Z,  ///< Z键
 
-    Num0,  ///< 0
-    Num1,  ///< 1
-    Num2,  ///< 2
-    Num3,  ///< 3
-    Num4,  ///< 4
-    Num5,  ///< 5
-    Num6,  ///< 6
-    Num7,  ///< 7
-    Num8,  ///< 8
-    Num9,  ///< 9
+    Num0,  ///< 数字0键
+    Num1,  ///< 数字1键
+    Num2,  ///< 数字2键
+    Num3,  ///< 数字3键
+    Num4,  ///< 数字4键
+    Num5,  ///< 数字5键
+    Num6,  ///< 数字6键
+    Num7,  ///< 数字7键
+    Num8,  ///< 数字8键
+    Num9,  ///< 数字9键
 
-    Numpad0,  ///< С0
-    Numpad1,  ///< С1
-    Numpad2,  ///< С2
-    Numpad3,  ///< С3
-    Numpad4,  ///< С4
-    Numpad5,  ///< С5
-    Numpad6,  ///< С6
-    Numpad7,  ///< С7
-    Numpad8,  ///< С8
-    Numpad9,  ///< С9
+    Numpad0,  ///< 数字小键盘0键
+    Numpad1,  ///< 数字小键盘1键
+    Numpad2,  ///< 数字小键盘2键
+    Numpad3,  ///< 数字小键盘3键
+    Numpad4,  ///< 数字小键盘4键
+    Numpad5,  ///< 数字小键盘5键
+    Numpad6,  ///< 数字小键盘6键
+    Numpad7,  ///< 数字小键盘7键
+    Numpad8,  ///< 数字小键盘8键
+    Numpad9,  ///< 数字小键盘9键
 
-    F1,   ///< F1
-    F2,   ///< F2
-    F3,   ///< F3
-    F4,   ///< F4
-    F5,   ///< F5
-    F6,   ///< F6
-    F7,   ///< F7
-    F8,   ///< F8
-    F9,   ///< F9
-    F10,  ///< F10
-    F11,  ///< F11
-    F12,  ///< F12
+    F1,   ///< F1键
+    F2,   ///< F2键
+    F3,   ///< F3键
+    F4,   ///< F4键
+    F5,   ///< F5键
+    F6,   ///< F6键
+    F7,   ///< F7键
+    F8,   ///< F8键
+    F9,   ///< F9键
+    F10,  ///< F10键
+    F11,  ///< F11键
+    F12,  ///< F12键
 
     Last
 };
@@ -71,6 +71,10 @@ void Runner::InitSettings()
     {
         frame_ticker_ = MakePtr<Ticker>(settings_.frame_interval, -1);
     }
+
+    // Separate simulation steps from rendered frames
+    Application::GetInstance().SetFixedStep(settings_.fixed_step, settings_.max_update_steps);
+    Application::GetInstance().SetPipelinedRendering(settings_.pipelined_render);
 }
 
 bool Runner::MainLoop(Duration dt)
@@ -36,28 +36,34 @@ KGE_DECLARE_SMART_PTR(Runner);
 
 /**
  * \~chinese
- * @brief Ϸ
+ * @brief 游戏设置
  */
 struct Settings
 {
-    WindowConfig window;          ///< 
-    Color        bg_color;        ///< ɫ
-    Duration     frame_interval;  ///< ֡
-    bool         vsync_enabled;   ///< ֱͬ
-    bool         debug_mode;      ///< ģʽ
+    WindowConfig window;            ///< 窗口设置
+    Color        bg_color;          ///< 背景色
+    Duration     frame_interval;    ///< 帧间隔
+    Duration     fixed_step;        ///< 固定更新步长，为零时按帧间隔更新
+    int          max_update_steps;  ///< 固定步长下每帧最多补偿的更新次数
+    bool         vsync_enabled;     ///< 垂直同步
+    bool         debug_mode;        ///< 调试模式
+    bool         pipelined_render;  ///< 流水线渲染，在独立的渲染线程中绘制上一帧
 
     Settings()
         : bg_color(Color::Black)
         , frame_interval(0)
+        , fixed_step(0)
+        , max_update_steps(5)
         , vsync_enabled(true)
         , debug_mode(false)
+        , pipelined_render(false)
     {
     }
 };
 
 /**
  * \~chinese
- * @brief 
+ * @brief 程序运行器
  */
 class KGE_API Runner : public ObjectBase
 {
@@ -65,58 +71,58 @@ public:
     Runner();
 
     /// \~chinese
-    /// @brief 
-    /// @param main_window 
+    /// @brief 创建程序运行器
+    /// @param main_window 主窗口
     Runner(const Settings& settings);
 
     virtual ~Runner();
 
     /// \~chinese
-    /// @brief ʼɴ
-    /// @details ظúӦóʼɺԶִ
+    /// @brief 初始化完成处理
+    /// @details 重载该函数以在应用程序初始化完成后自动执行
     virtual void OnReady();
 
     /// \~chinese
-    /// @brief Ӧóٴ
-    /// @details ظúԴӦóʱΪԴյ
+    /// @brief 应用程序销毁处理
+    /// @details 重载该函数以处理应用程序销毁时的行为，如完成资源回收等
     virtual void OnDestroy();
 
     /// \~chinese
-    /// @brief Ӧóرմ
-    /// @details ظúԴûرӦóʱΪ籣ûݵ
-    /// @return trueûرճ򣬷ֹر
+    /// @brief 应用程序关闭处理
+    /// @details 重载该函数以处理用户关闭应用程序时的行为，如保存用户数据等
+    /// @return 返回true允许用户关闭程序，否则阻止程序关闭
     virtual bool OnClose();
 
     /// \~chinese
-    /// @brief Ӧóѭ
-    /// @param dt ʱ
-    /// @details ظúԿƳѭ
-    /// @return false˳ѭѭ
+    /// @brief 应用程序主循环
+    /// @param dt 时间间隔
+    /// @details 重载该函数以控制程序主循环
+    /// @return 返回false退出主循环，否则继续运行主循环
     bool MainLoop(Duration dt);
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取窗口
     WindowPtr GetWindow() const;
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取设置
     Settings GetSettings() const;
 
     /// \~chinese
-    /// @brief ȡ֡ʱ
+    /// @brief 获取帧报时器
     TickerPtr GetFrameTicker() const;
 
     /// \~chinese
-    /// @brief ֡ʱ
+    /// @brief 设置帧报时器
     void SetFrameTicker(TickerPtr ticker);
 
 protected:
     /// \~chinese
-    /// @brief ޸
+    /// @brief 修改设置
     void SetSettings(Settings settings);
 
     /// \~chinese
-    /// @brief ô
+    /// @brief 设置窗口
     void SetWindow(WindowPtr window);
 
 private:
@@ -31,29 +31,29 @@ KGE_DECLARE_SMART_PTR(Window);
 
 /**
  * \~chinese
- * @brief ָ
+ * @brief 鼠标指针类型
  */
 enum class CursorType
 {
-    Arrow,      ///< ָ
-    TextInput,  ///< ı
-    Hand,       ///< 
-    SizeAll,    ///< ָĸļͷ
-    SizeWE,     ///< ָҷļͷ
-    SizeNS,     ///< ָ·ļͷ
-    SizeNESW,   ///< ָµϷļͷ
-    SizeNWSE,   ///< ָϵ·ļͷ
+    Arrow,      ///< 指针
+    TextInput,  ///< 文本
+    Hand,       ///< 手
+    SizeAll,    ///< 指向四个方向的箭头
+    SizeWE,     ///< 指向左右方向的箭头
+    SizeNS,     ///< 指向上下方向的箭头
+    SizeNESW,   ///< 指向左下到右上方向的箭头
+    SizeNWSE,   ///< 指向左上到右下方向的箭头
 };
 
 /**
  * \~chinese
- * @brief ֱ
+ * @brief 分辨率
  */
 struct Resolution
 {
-    uint32_t width = 0;         ///< ֱʿ
-    uint32_t height = 0;        ///< ֱʸ߶
-    uint32_t refresh_rate = 0;  ///< ˢ
+    uint32_t width = 0;         ///< 分辨率宽度
+    uint32_t height = 0;        ///< 分辨率高度
+    uint32_t refresh_rate = 0;  ///< 刷新率
 
     Resolution() = default;
 
@@ -67,7 +67,7 @@ struct Resolution
 
 /**
  * \~chinese
- * @brief ͼ
+ * @brief 图标
  */
 struct Icon
 {
@@ -78,10 +78,10 @@ struct Icon
     {
     }
 
-    String file_path;  ///< ļ·
+    String file_path;  ///< 文件路径
 
 #if defined(KGE_PLATFORM_WINDOWS)
-    uint32_t resource_id = 0;  ///< ԴIDwindowsЧ
+    uint32_t resource_id = 0;  ///< 资源ID，仅在windows上生效
 
     Icon(uint32_t resource_id)
         : resource_id(resource_id)
@@ -93,174 +93,176 @@ struct Icon
 
 /**
  * \~chinese
- * @brief 
+ * @brief 窗口设置
  */
 struct WindowConfig
 {
-    uint32_t width  = 640;            ///< ڿ
-    uint32_t height = 480;            ///< ڸ߶
-    String   title  = "Kiwano Game";  ///< ڱ
-    Icon     icon;                    ///< ͼ
-    bool     resizable  = false;      ///< ڴСɵ
-    bool     fullscreen = false;      ///< ȫ
+    uint32_t width  = 640;            ///< 窗口宽度
+    uint32_t height = 480;            ///< 窗口高度
+    String   title  = "Kiwano Game";  ///< 窗口标题
+    Icon     icon;                    ///< 窗口图标
+    bool     resizable  = false;      ///< 窗口大小可调整
+    bool     fullscreen = false;      ///< 窗口全屏
 };
 
 
 #if defined(KGE_PLATFORM_WINDOWS)
 typedef HWND WindowHandle;
+#else
+typedef void* WindowHandle;
 #endif
 
 
 /**
  * \~chinese
- * @brief ࣬ƴڱ⡢Сͼ
+ * @brief 窗口类，控制窗口标题、大小、图标等
  */
 class KGE_API Window : public ObjectBase
 {
 public:
     /**
      * \~chinese
-     * @brief ʼ
-     * @param config 
-     * @throw kiwano::SystemError ڴʧʱ׳
+     * @brief 初始化窗口
+     * @param config 窗口设置
+     * @throw kiwano::SystemError 窗口创建失败时抛出
      */
     static WindowPtr Create(const WindowConfig& config);
 
     /**
      * \~chinese
-     * @brief ȡڱ
-     * @return ڱ
+     * @brief 获取窗口标题
+     * @return 窗口标题
      */
     String GetTitle() const;
 
     /**
      * \~chinese
-     * @brief ȡںλ
-     * @return λ
+     * @brief 获取窗口横向位置
+     * @return 横向位置
      */
     int GetPosX() const;
 
     /**
      * \~chinese
-     * @brief ȡλ
-     * @return λ
+     * @brief 获取窗口纵向位置
+     * @return 纵向位置
      */
     int GetPosY() const;
 
     /**
      * \~chinese
-     * @brief ȡڴС
-     * @return ڴС
+     * @brief 获取窗口大小
+     * @return 窗口大小
      */
     Size GetSize() const;
 
     /**
      * \~chinese
-     * @brief ȡڿ
-     * @return ڿ
+     * @brief 获取窗口宽度
+     * @return 窗口宽度
      */
     uint32_t GetWidth() const;
 
     /**
      * \~chinese
-     * @brief ȡڸ߶
-     * @return ڸ߶
+     * @brief 获取窗口高度
+     * @return 窗口高度
      */
     uint32_t GetHeight() const;
 
     /**
      * \~chinese
-     * @brief ȡǰֱ
+     * @brief 获取当前分辨率
      */
     Resolution GetCurrentResolution() const;
 
     /**
      * \~chinese
-     * @brief ȡھ
+     * @brief 获取窗口句柄
      */
     WindowHandle GetHandle() const;
 
     /**
      * \~chinese
-     * @brief ȡֵ֧Ļֱб
+     * @brief 获取支持的屏幕分辨率列表
      */
     virtual Vector<Resolution> GetResolutions() = 0;
 
     /**
      * \~chinese
-     * @brief ñ
-     * @param title 
+     * @brief 设置标题
+     * @param title 标题
      */
     virtual void SetTitle(const String& title) = 0;
 
     /**
      * \~chinese
-     * @brief ôͼ
-     * @param icon ͼ
+     * @brief 设置窗口图标
+     * @param icon 图标
      */
     virtual void SetIcon(Icon icon) = 0;
 
     /**
      * \~chinese
-     * @brief ôڷֱ
-     * @param width ֱʿ
-     * @param height ֱʸ߶
-     * @param fullscreen Ƿȫ
+     * @brief 设置窗口分辨率
+     * @param width 分辨率宽度
+     * @param height 分辨率高度
+     * @param fullscreen 是否全屏
      */
     virtual void SetResolution(uint32_t width, uint32_t height, bool fullscreen) = 0;
 
     /**
      * \~chinese
-     * @brief ôСС
-     * @param width Сڿ
-     * @param height Сڸ߶
+     * @brief 设置窗口最小大小
+     * @param width 最小窗口宽度
+     * @param height 最小窗口高度
      */
     virtual void SetMinimumSize(uint32_t width, uint32_t height) = 0;
 
     /**
      * \~chinese
-     * @brief ôС
-     * @param width 󴰿ڿ
-     * @param height 󴰿ڸ߶
+     * @brief 设置窗口最大大小
+     * @param width 最大窗口宽度
+     * @param height 最大窗口高度
      */
     virtual void SetMaximumSize(uint32_t width, uint32_t height) = 0;
 
     /**
      * \~chinese
-     * @brief ָ
-     * @param cursor ָ
+     * @brief 设置鼠标指针类型
+     * @param cursor 鼠标指针类型
      */
     virtual void SetCursor(CursorType cursor) = 0;
 
     /**
      * \~chinese
-     * @brief ѯ¼
-     * @return ¼еĵһ¼ӶƳ, Ϊ򷵻ؿָ
+     * @brief 轮询窗口事件
+     * @return 返回事件队列中的第一个事件并将其从队列中移除, 若队列为空则返回空指针
      */
     EventPtr PollEvent();
 
     /**
      * \~chinese
-     * @brief ¼
-     * @param evt ¼
+     * @brief 将事件放入队列
+     * @param evt 事件
      */
     void PushEvent(EventPtr evt);
 
     /**
      * \~chinese
-     * @brief ȡ¼
+     * @brief 抽取窗口事件
      */
     virtual void PumpEvents() = 0;
 
     /**
      * \~chinese
-     * @brief ǷҪر
+     * @brief 窗口是否需要关闭
      */
     bool ShouldClose();
 
     /**
      * \~chinese
-     * @brief ǷҪر
+     * @brief 设置是否需要关闭
      */
     void SetShouldClose(bool should);
 
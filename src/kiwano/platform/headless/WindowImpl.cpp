@@ -0,0 +1,139 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <kiwano/platform/Window.h>
+
+#if !defined(KGE_PLATFORM_WINDOWS)
+
+#include <kiwano/utils/Logger.h>
+#include <kiwano/event/Events.h>
+
+namespace kiwano
+{
+
+KGE_DECLARE_SMART_PTR(WindowHeadlessImpl);
+
+/**
+ * \~chinese
+ * @brief 无界面窗口，仅记录窗口属性，配合软件渲染器在没有显示设备的环境中运行
+ */
+class KGE_API WindowHeadlessImpl : public Window
+{
+public:
+    WindowHeadlessImpl();
+
+    virtual ~WindowHeadlessImpl();
+
+    void Init(const WindowConfig& config);
+
+    void SetTitle(const String& title) override;
+
+    void SetIcon(Icon icon) override;
+
+    void SetMinimumSize(uint32_t width, uint32_t height) override;
+
+    void SetMaximumSize(uint32_t width, uint32_t height) override;
+
+    void SetCursor(CursorType cursor) override;
+
+    void SetResolution(uint32_t width, uint32_t height, bool fullscreen) override;
+
+    Vector<Resolution> GetResolutions() override;
+
+    void PumpEvents() override;
+};
+
+WindowPtr Window::Create(const WindowConfig& config)
+{
+    WindowHeadlessImplPtr ptr = MakePtr<WindowHeadlessImpl>();
+    if (ptr)
+    {
+        ptr->Init(config);
+    }
+    return ptr;
+}
+
+WindowHeadlessImpl::WindowHeadlessImpl() {}
+
+WindowHeadlessImpl::~WindowHeadlessImpl() {}
+
+void WindowHeadlessImpl::Init(const WindowConfig& config)
+{
+    title_         = config.title;
+    width_         = config.width;
+    height_        = config.height;
+    resolution_    = Resolution{ width_, height_, 0 };
+    is_fullscreen_ = config.fullscreen;
+
+    KGE_DEBUG_LOGF("Headless window created (%d, %d)", width_, height_);
+}
+
+void WindowHeadlessImpl::SetTitle(const String& title)
+{
+    title_ = title;
+}
+
+void WindowHeadlessImpl::SetIcon(Icon icon) {}
+
+void WindowHeadlessImpl::SetMinimumSize(uint32_t width, uint32_t height)
+{
+    min_width_  = width;
+    min_height_ = height;
+}
+
+void WindowHeadlessImpl::SetMaximumSize(uint32_t width, uint32_t height)
+{
+    max_width_  = width;
+    max_height_ = height;
+}
+
+void WindowHeadlessImpl::SetCursor(CursorType cursor) {}
+
+void WindowHeadlessImpl::SetResolution(uint32_t width, uint32_t height, bool fullscreen)
+{
+    is_fullscreen_ = fullscreen;
+    resolution_    = Resolution{ width, height, 0 };
+
+    if (width_ != width || height_ != height)
+    {
+        width_  = width;
+        height_ = height;
+
+        WindowResizedEventPtr evt = new WindowResizedEvent;
+        evt->window               = this;
+        evt->width                = width;
+        evt->height               = height;
+        this->PushEvent(evt);
+    }
+}
+
+Vector<Resolution> WindowHeadlessImpl::GetResolutions()
+{
+    return { resolution_ };
+}
+
+void WindowHeadlessImpl::PumpEvents()
+{
+    // There is no native event source, events are only pushed by the window itself
+}
+
+}  // namespace kiwano
+
+#endif
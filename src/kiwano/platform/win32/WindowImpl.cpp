@@ -503,7 +503,7 @@ LRESULT WindowWin32Impl::MessageProc(HWND hwnd, UINT32 msg, WPARAM wparam, LPARA
         KeyCode key = this->key_map_[size_t(wparam)];
         if (key != KeyCode::Unknown)
         {
-            KeyDownEventPtr evt = new KeyDownEvent;
+            KeyDownEventPtr evt = EventArena::GetInstance().Create<KeyDownEvent>();
             evt->code           = key;
             this->PushEvent(evt);
         }
@@ -516,7 +516,7 @@ LRESULT WindowWin32Impl::MessageProc(HWND hwnd, UINT32 msg, WPARAM wparam, LPARA
         KeyCode key = this->key_map_[size_t(wparam)];
         if (key != KeyCode::Unknown)
         {
-            KeyUpEventPtr evt = new KeyUpEvent;
+            KeyUpEventPtr evt = EventArena::GetInstance().Create<KeyUpEvent>();
             evt->code         = key;
             this->PushEvent(evt);
         }
@@ -525,7 +525,7 @@ LRESULT WindowWin32Impl::MessageProc(HWND hwnd, UINT32 msg, WPARAM wparam, LPARA
 
     case WM_CHAR:
     {
-        KeyCharEventPtr evt = new KeyCharEvent;
+        KeyCharEventPtr evt = EventArena::GetInstance().Create<KeyCharEvent>();
         evt->value          = char(wparam);
         this->PushEvent(evt);
     }
@@ -538,7 +538,7 @@ LRESULT WindowWin32Impl::MessageProc(HWND hwnd, UINT32 msg, WPARAM wparam, LPARA
     case WM_MBUTTONDOWN:
     case WM_MBUTTONDBLCLK:
     {
-        MouseDownEventPtr evt = new MouseDownEvent;
+        MouseDownEventPtr evt = EventArena::GetInstance().Create<MouseDownEvent>();
         evt->pos              = Point((float)GET_X_LPARAM(lparam), (float)GET_Y_LPARAM(lparam));
 
         if (msg == WM_LBUTTONDOWN || msg == WM_LBUTTONDBLCLK)
@@ -562,7 +562,7 @@ LRESULT WindowWin32Impl::MessageProc(HWND hwnd, UINT32 msg, WPARAM wparam, LPARA
     case WM_MBUTTONUP:
     case WM_RBUTTONUP:
     {
-        MouseUpEventPtr evt = new MouseUpEvent;
+        MouseUpEventPtr evt = EventArena::GetInstance().Create<MouseUpEvent>();
         evt->pos            = Point((float)GET_X_LPARAM(lparam), (float)GET_Y_LPARAM(lparam));
 
         if (msg == WM_LBUTTONUP)
@@ -584,7 +584,7 @@ LRESULT WindowWin32Impl::MessageProc(HWND hwnd, UINT32 msg, WPARAM wparam, LPARA
 
     case WM_MOUSEMOVE:
     {
-        MouseMoveEventPtr evt = new MouseMoveEvent;
+        MouseMoveEventPtr evt = EventArena::GetInstance().Create<MouseMoveEvent>();
         evt->pos              = Point((float)GET_X_LPARAM(lparam), (float)GET_Y_LPARAM(lparam));
         this->PushEvent(evt);
     }
@@ -592,7 +592,7 @@ LRESULT WindowWin32Impl::MessageProc(HWND hwnd, UINT32 msg, WPARAM wparam, LPARA
 
     case WM_MOUSEWHEEL:
     {
-        MouseWheelEventPtr evt = new MouseWheelEvent;
+        MouseWheelEventPtr evt = EventArena::GetInstance().Create<MouseWheelEvent>();
         evt->pos               = Point((float)GET_X_LPARAM(lparam), (float)GET_Y_LPARAM(lparam));
         evt->wheel             = GET_WHEEL_DELTA_WPARAM(wparam) / (float)WHEEL_DELTA;
         this->PushEvent(evt);
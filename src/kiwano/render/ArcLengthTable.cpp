@@ -0,0 +1,256 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <kiwano/render/ArcLengthTable.h>
+#include <kiwano/render/Shape.h>
+
+#if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_DIRECTX
+#include <kiwano/render/DirectX/NativePtr.h>
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+#include <kiwano/render/Software/NativePtr.h>
+#include <kiwano/render/Software/Geometry.h>
+#endif
+
+namespace kiwano
+{
+
+#if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_DIRECTX
+namespace
+{
+
+// Receives the flattened figures of a geometry, lives on the stack for the duration of ID2D1Geometry::Simplify
+class PolylineSink : public ID2D1SimplifiedGeometrySink
+{
+public:
+    struct Figure
+    {
+        size_t begin;
+        size_t end;
+        bool   closed;
+    };
+
+    Vector<Point>  points;
+    Vector<Figure> figures;
+
+    STDMETHOD_(void, SetFillMode)(D2D1_FILL_MODE fillMode) {}
+
+    STDMETHOD_(void, SetSegmentFlags)(D2D1_PATH_SEGMENT vertexFlags) {}
+
+    STDMETHOD_(void, BeginFigure)(D2D1_POINT_2F startPoint, D2D1_FIGURE_BEGIN figureBegin)
+    {
+        figures.push_back(Figure{ points.size(), points.size(), false });
+        points.push_back(Point(startPoint.x, startPoint.y));
+    }
+
+    STDMETHOD_(void, AddLines)(const D2D1_POINT_2F* linePoints, UINT32 pointsCount)
+    {
+        for (UINT32 i = 0; i < pointsCount; ++i)
+            points.push_back(Point(linePoints[i].x, linePoints[i].y));
+    }
+
+    STDMETHOD_(void, AddBeziers)(const D2D1_BEZIER_SEGMENT* beziers, UINT32 beziersCount)
+    {
+        // Not produced with D2D1_GEOMETRY_SIMPLIFICATION_OPTION_LINES
+        for (UINT32 i = 0; i < beziersCount; ++i)
+            points.push_back(Point(beziers[i].point3.x, beziers[i].point3.y));
+    }
+
+    STDMETHOD_(void, EndFigure)(D2D1_FIGURE_END figureEnd)
+    {
+        figures.back().end    = points.size();
+        figures.back().closed = (figureEnd == D2D1_FIGURE_END_CLOSED);
+    }
+
+    STDMETHOD(Close)()
+    {
+        return S_OK;
+    }
+
+    STDMETHOD_(unsigned long, AddRef)()
+    {
+        return 1;
+    }
+
+    STDMETHOD_(unsigned long, Release)()
+    {
+        return 1;
+    }
+
+    STDMETHOD(QueryInterface)(REFIID riid, void** ppvObject)
+    {
+        if (__uuidof(ID2D1SimplifiedGeometrySink) == riid || __uuidof(IUnknown) == riid)
+        {
+            *ppvObject = this;
+            return S_OK;
+        }
+        *ppvObject = NULL;
+        return E_NOINTERFACE;
+    }
+};
+
+}  // namespace
+#endif
+
+const float ArcLengthTable::DEFAULT_TOLERANCE = 0.25f;
+
+ArcLengthTablePtr ArcLengthTable::Create(const Shape& shape, float tolerance)
+{
+    ArcLengthTablePtr ptr = MakePtr<ArcLengthTable>();
+    ptr->tolerance_       = tolerance;
+
+#if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_DIRECTX
+    auto geometry = NativePtr::Get<ID2D1Geometry>(&shape);
+    if (geometry)
+    {
+        PolylineSink sink;
+
+        HRESULT hr = geometry->Simplify(D2D1_GEOMETRY_SIMPLIFICATION_OPTION_LINES, nullptr, tolerance, &sink);
+        if (SUCCEEDED(hr))
+        {
+            for (const auto& figure : sink.figures)
+            {
+                ptr->AppendFigure(&sink.points[figure.begin], figure.end - figure.begin, figure.closed);
+            }
+        }
+    }
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    auto geometry = NativePtr::Get<graphics::software::PathGeometry>(&shape);
+    if (geometry)
+    {
+        Vector<graphics::software::Polyline> polylines;
+        geometry->Flatten(nullptr, tolerance, polylines);
+
+        for (const auto& polyline : polylines)
+        {
+            ptr->AppendFigure(polyline.points.data(), polyline.points.size(), polyline.closed);
+        }
+    }
+#else
+    // not supported
+#endif
+
+    ptr->BuildIndex();
+    return ptr;
+}
+
+ArcLengthTablePtr ArcLengthTable::Create(const Vector<Point>& points, bool closed)
+{
+    ArcLengthTablePtr ptr = MakePtr<ArcLengthTable>();
+    ptr->AddFigure(points.data(), points.size(), closed);
+    return ptr;
+}
+
+ArcLengthTable::ArcLengthTable()
+    : tolerance_(0.f)
+    , bucket_scale_(0.f)
+{
+}
+
+void ArcLengthTable::AddFigure(const Point* points, size_t count, bool closed)
+{
+    AppendFigure(points, count, closed);
+    BuildIndex();
+}
+
+void ArcLengthTable::AppendFigure(const Point* points, size_t count, bool closed)
+{
+    if (count == 0)
+        return;
+
+    // Figures are chained by a zero-length jump, which is never selected as a segment
+    float length = GetLength();
+    points_.push_back(points[0]);
+    lengths_.push_back(length);
+
+    for (size_t i = 1; i < count; ++i)
+    {
+        float seg = (points[i] - points_.back()).Length();
+        if (seg > 0.f)
+        {
+            length += seg;
+            points_.push_back(points[i]);
+            lengths_.push_back(length);
+        }
+    }
+
+    if (closed && count > 2)
+    {
+        float seg = (points[0] - points_.back()).Length();
+        if (seg > 0.f)
+        {
+            points_.push_back(points[0]);
+            lengths_.push_back(length + seg);
+        }
+    }
+}
+
+void ArcLengthTable::BuildIndex()
+{
+    buckets_.clear();
+
+    float length = GetLength();
+    if (points_.size() < 2 || length <= 0.f)
+        return;
+
+    // One bucket per segment on average, each bucket keeps the first segment that may contain its lengths
+    size_t last         = points_.size() - 1;
+    size_t bucket_count = last;
+    bucket_scale_       = float(bucket_count) / length;
+    buckets_.resize(bucket_count);
+
+    size_t seg = 1;
+    for (size_t i = 0; i < bucket_count; ++i)
+    {
+        while (seg < last && size_t(lengths_[seg] * bucket_scale_) < i)
+            ++seg;
+        buckets_[i] = uint32_t(seg);
+    }
+}
+
+size_t ArcLengthTable::FindSegment(float length) const
+{
+    size_t last  = points_.size() - 1;
+    size_t index = std::min(size_t(length * bucket_scale_), buckets_.size() - 1);
+    size_t seg   = buckets_[index];
+    while (seg < last && lengths_[seg] <= length)
+        ++seg;
+
+    // Step back over the jump between two figures
+    while (seg > 1 && lengths_[seg] <= lengths_[seg - 1])
+        --seg;
+    return seg;
+}
+
+bool ArcLengthTable::ComputePointAtLength(float length, Point& point, Vec2& tangent) const
+{
+    if (IsEmpty())
+        return false;
+
+    length = std::min(std::max(length, 0.f), GetLength());
+
+    size_t seg   = FindSegment(length);
+    float  begin = lengths_[seg - 1];
+
+    tangent = (points_[seg] - points_[seg - 1]) / (lengths_[seg] - begin);
+    point   = points_[seg - 1] + tangent * (length - begin);
+    return true;
+}
+
+}  // namespace kiwano
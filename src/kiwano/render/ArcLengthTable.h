@@ -0,0 +1,130 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <kiwano/base/RefPtr.h>
+#include <kiwano/math/Math.h>
+
+namespace kiwano
+{
+class Shape;
+
+KGE_DECLARE_SMART_PTR(ArcLengthTable);
+
+/**
+ * \addtogroup Render
+ * @{
+ */
+
+/**
+ * \~chinese
+ * @brief 弧长查找表
+ * @details 将形状扁平化为折线，并记录每个顶点处的累计长度。按长度查找路径上的点和切线时只访问折线数据，
+ * 平均为常数时间，不经过渲染后端的几何对象，可以被多个动画共享
+ */
+class KGE_API ArcLengthTable : public RefObject
+{
+public:
+    /// \~chinese
+    /// @brief 默认的扁平化容差（像素）
+    static const float DEFAULT_TOLERANCE;
+
+    /// \~chinese
+    /// @brief 扁平化形状并创建弧长查找表
+    /// @param shape 形状
+    /// @param tolerance 扁平化容差，折线与原曲线之间的最大距离
+    static ArcLengthTablePtr Create(const Shape& shape, float tolerance = DEFAULT_TOLERANCE);
+
+    /// \~chinese
+    /// @brief 从折线创建弧长查找表
+    /// @param points 折线顶点
+    /// @param closed 是否闭合
+    static ArcLengthTablePtr Create(const Vector<Point>& points, bool closed = false);
+
+    ArcLengthTable();
+
+    /// \~chinese
+    /// @brief 是否为空
+    bool IsEmpty() const;
+
+    /// \~chinese
+    /// @brief 获取路径总长度
+    float GetLength() const;
+
+    /// \~chinese
+    /// @brief 获取扁平化容差
+    float GetTolerance() const;
+
+    /// \~chinese
+    /// @brief 获取折线顶点，不同图形的顶点依次相连
+    const Vector<Point>& GetPoints() const;
+
+    /// \~chinese
+    /// @brief 添加一段折线
+    /// @param points 折线顶点
+    /// @param count 顶点数量
+    /// @param closed 是否闭合
+    void AddFigure(const Point* points, size_t count, bool closed);
+
+    /// \~chinese
+    /// @brief 计算路径上点的位置和切线向量
+    /// @param[in] length 点在路径上的位置，范围 [0.0 - 路径长度]
+    /// @param[out] point 点的位置
+    /// @param[out] tangent 点的单位切线向量
+    bool ComputePointAtLength(float length, Point& point, Vec2& tangent) const;
+
+private:
+    void AppendFigure(const Point* points, size_t count, bool closed);
+
+    void BuildIndex();
+
+    size_t FindSegment(float length) const;
+
+private:
+    float            tolerance_;
+    float            bucket_scale_;
+    Vector<Point>    points_;
+    Vector<float>    lengths_;
+    Vector<uint32_t> buckets_;
+};
+
+/** @} */
+
+inline bool ArcLengthTable::IsEmpty() const
+{
+    return buckets_.empty();
+}
+
+inline float ArcLengthTable::GetLength() const
+{
+    return lengths_.empty() ? 0.f : lengths_.back();
+}
+
+inline float ArcLengthTable::GetTolerance() const
+{
+    return tolerance_;
+}
+
+inline const Vector<Point>& ArcLengthTable::GetPoints() const
+{
+    return points_;
+}
+
+}  // namespace kiwano
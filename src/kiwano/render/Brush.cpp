@@ -24,6 +24,9 @@
 
 #if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_DIRECTX
 #include <kiwano/render/DirectX/NativePtr.h>
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+#include <kiwano/render/Software/NativePtr.h>
+#include <kiwano/render/Software/Rasterizer.h>
 #endif
 
 namespace kiwano
@@ -131,6 +134,14 @@ void Brush::SetTransform(const Matrix3x2& transform)
     {
         native->SetTransform(DX::ConvertToMatrix3x2F(transform));
     }
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    auto native = NativePtr::Get<graphics::software::BrushData>(this);
+    KGE_ASSERT(native);
+
+    if (native)
+    {
+        native->transform = transform;
+    }
 #else
     // not supported
 #endif
@@ -34,11 +34,11 @@ KGE_DECLARE_SMART_PTR(Brush);
  */
 
 /// \~chinese
-/// @brief ת
+/// @brief 渐变转换点
 struct GradientStop
 {
-    float offset;  ///< ƫƾ
-    Color color;   ///< ɫ
+    float offset;  ///< 偏移距离
+    Color color;   ///< 渐变点颜色
 
     GradientStop();
 
@@ -46,23 +46,23 @@ struct GradientStop
 };
 
 /// \~chinese
-/// @brief ģʽ
-/// @details ģʽָλĲ
+/// @brief 渐变扩充模式
+/// @details 该模式用于指定画笔如何绘制正常区域外的部分
 enum class GradientExtendMode
 {
-    Clamp,  ///< ģʽظƱ߽ɫ
-    Wrap,   ///< ģʽظ
-    Mirror  ///< ģʽת
+    Clamp,  ///< 夹模式，重复绘制边界颜色
+    Wrap,   ///< 包裹模式，重复画笔内容
+    Mirror  ///< 镜像模式，反转画笔内容
 };
 
 /// \~chinese
-/// @brief Խʽ
+/// @brief 线性渐变样式
 struct LinearGradientStyle
 {
-    Point                begin;        ///< ʼ
-    Point                end;          ///< ֹ
-    Vector<GradientStop> stops;        ///< ת㼯
-    GradientExtendMode   extend_mode;  ///< ģʽ
+    Point                begin;        ///< 渐变起始点
+    Point                end;          ///< 渐变终止点
+    Vector<GradientStop> stops;        ///< 渐变转换点集合
+    GradientExtendMode   extend_mode;  ///< 渐变扩充模式
 
     LinearGradientStyle();
 
@@ -71,14 +71,14 @@ struct LinearGradientStyle
 };
 
 /// \~chinese
-/// @brief 򽥱ʽ
+/// @brief 径向渐变样式
 struct RadialGradientStyle
 {
-    Point                center;       ///< 򽥱Բ
-    Vec2                 offset;       ///< 򽥱ƫ
-    Vec2                 radius;       ///< 򽥱뾶
-    Vector<GradientStop> stops;        ///< ת㼯
-    GradientExtendMode   extend_mode;  ///< ģʽ
+    Point                center;       ///< 径向渐变圆心
+    Vec2                 offset;       ///< 径向渐变偏移
+    Vec2                 radius;       ///< 径向渐变半径
+    Vector<GradientStop> stops;        ///< 渐变转换点集合
+    GradientExtendMode   extend_mode;  ///< 渐变扩充模式
 
     RadialGradientStyle();
 
@@ -88,66 +88,66 @@ struct RadialGradientStyle
 
 /**
  * \~chinese
- * @brief ˢ
+ * @brief 画刷
  */
 class KGE_API Brush : public NativeObject
 {
 public:
     /// \~chinese
-    /// @brief ɫˢ
-    /// @param color ˢɫ
+    /// @brief 创建纯色画刷
+    /// @param color 画刷颜色
     Brush(const Color& color);
 
     /// \~chinese
-    /// @brief Խʽ
-    /// @param style Խʽ
+    /// @brief 创建线性渐变样式
+    /// @param style 线性渐变样式
     Brush(const LinearGradientStyle& style);
 
     /// \~chinese
-    /// @brief 򽥱ʽ
-    /// @param style 򽥱ʽ
+    /// @brief 创建径向渐变样式
+    /// @param style 径向渐变样式
     Brush(const RadialGradientStyle& style);
 
     Brush();
 
     /// \~chinese
-    /// @brief ôɫˢɫ
+    /// @brief 设置纯色画刷颜色
     void SetColor(const Color& color);
 
     /// \~chinese
-    /// @brief Խʽ
+    /// @brief 设置线性渐变样式
     void SetStyle(const LinearGradientStyle& style);
 
     /// \~chinese
-    /// @brief þ򽥱ʽ
+    /// @brief 设置径向渐变样式
     void SetStyle(const RadialGradientStyle& style);
 
     /// \~chinese
-    /// @brief 
+    /// @brief 设置纹理
     void SetTexture(TexturePtr texture);
 
     /// \~chinese
-    /// @brief öά任
+    /// @brief 设置二维变换
     void SetTransform(const Transform& transform);
 
     /// \~chinese
-    /// @brief öά任
+    /// @brief 设置二维变换
     void SetTransform(const Matrix3x2& transform);
 
 public:
     /// \~chinese
-    /// @brief ˢ
+    /// @brief 画刷类型
     enum class Type
     {
         None,
-        SolidColor,      ///< ɫ仭ˢ
-        LinearGradient,  ///< Խ仭ˢ
-        RadialGradient,  ///< 򽥱仭ˢ
-        Texture          ///< ˢ
+        SolidColor,      ///< 纯色填充画刷
+        LinearGradient,  ///< 线性渐变画刷
+        RadialGradient,  ///< 径向渐变画刷
+        Texture          ///< 纹理画刷
     };
 
     /// \~chinese
-    /// @brief ȡˢ
+    /// @brief 获取画刷类型
     Type GetType() const;
 
 private:
@@ -30,81 +30,81 @@ namespace kiwano
 
 /*
  * \~chinese
- * @brief ɫ
+ * @brief 颜色
  * @details
- * ʹöٱʾɫ: @code Color blue = Color::Blue; @endcode
- * ʹ RGB ʾһɫ: @code Color red = Color(255, 0, 0); @endcode
- * ʹ RGBA ʾһ͸ȵɫ: @code Color not_white = Color(255, 255, 255, 0.5f); @endcode
- * ʹһ16ֵʾ RGB ɫ: @code Color black(0x000000); @endcode
+ * 使用枚举表示颜色: @code Color blue = Color::Blue; @endcode
+ * 使用 RGB 表示一个颜色: @code Color red = Color(255, 0, 0); @endcode
+ * 使用 RGBA 表示一个带透明度的颜色: @code Color not_white = Color(255, 255, 255, 0.5f); @endcode
+ * 使用一个16进制整型值表示 RGB 颜色: @code Color black(0x000000); @endcode
  */
 class KGE_API Color
 {
 public:
     /// \~chinese
-    /// @brief ɫ
-    /// @details ĬɫΪ R: 0, G: 0, B: 0, A: 1.0
+    /// @brief 构造颜色
+    /// @details 默认颜色为 R: 0, G: 0, B: 0, A: 1.0
     Color();
 
     /// \~chinese
-    /// @brief  RGBA ɫ
-    /// @param r ɫֵΧ 0 - 1
-    /// @param g ɫֵΧ 0 - 1
-    /// @param b ɫֵΧ 0 - 1
-    /// @param alpha AlphaֵΧ 0.0 - 1.0
+    /// @brief 构造 RGBA 颜色
+    /// @param r 红色值，范围 0 - 1
+    /// @param g 绿色值，范围 0 - 1
+    /// @param b 蓝色值，范围 0 - 1
+    /// @param alpha Alpha值，范围 0.0 - 1.0
     Color(float r, float g, float b, float alpha = 1.0f);
 
     /// \~chinese
-    /// @brief  RGBA ɫ
-    /// @param r ɫֵΧ 0 - 255
-    /// @param g ɫֵΧ 0 - 255
-    /// @param b ɫֵΧ 0 - 255
-    /// @param alpha AlphaֵΧ 0.0 - 1.0
+    /// @brief 构造 RGBA 颜色
+    /// @param r 红色值，范围 0 - 255
+    /// @param g 绿色值，范围 0 - 255
+    /// @param b 蓝色值，范围 0 - 255
+    /// @param alpha Alpha值，范围 0.0 - 1.0
     Color(int r, int g, int b, float alpha = 1.0f);
 
     /// \~chinese
-    /// @brief  RGBA ɫ
-    /// @param rgb ʹ16ֵʾ RGB ɫ
-    /// @param alpha AlphaֵΧ 0.0 - 1.0
+    /// @brief 构造 RGBA 颜色
+    /// @param rgb 使用16进制整形值表示 RGB 颜色
+    /// @param alpha Alpha值，范围 0.0 - 1.0
     Color(uint32_t rgb, float alpha = 1.0f);
 
     /// \~chinese
-    /// @brief  RGB ɫ
-    /// @param r ɫֵΧ 0 - 1
-    /// @param g ɫֵΧ 0 - 1
-    /// @param b ɫֵΧ 0 - 1
+    /// @brief 构造 RGB 颜色
+    /// @param r 红色值，范围 0 - 1
+    /// @param g 绿色值，范围 0 - 1
+    /// @param b 蓝色值，范围 0 - 1
     static Color Rgb(float r, float g, float b);
 
     /// \~chinese
-    /// @brief  RGB ɫ
-    /// @param r ɫֵΧ 0 - 255
-    /// @param g ɫֵΧ 0 - 255
-    /// @param b ɫֵΧ 0 - 255
+    /// @brief 构造 RGB 颜色
+    /// @param r 红色值，范围 0 - 255
+    /// @param g 绿色值，范围 0 - 255
+    /// @param b 蓝色值，范围 0 - 255
     static Color Rgb(int r, int g, int b);
 
     /// \~chinese
-    /// @brief  RGB ɫ
-    /// @param rgb ʹ16ֵʾ RGBɫ
+    /// @brief 构造 RGB 颜色
+    /// @param rgb 使用16进制整形值表示 RGB颜色
     static Color Rgb(uint32_t rgb);
 
     /// \~chinese
-    /// @brief  RGB ɫ
-    /// @param r ɫֵΧ 0 - 1
-    /// @param g ɫֵΧ 0 - 1
-    /// @param b ɫֵΧ 0 - 1
+    /// @brief 构造 RGB 颜色
+    /// @param r 红色值，范围 0 - 1
+    /// @param g 绿色值，范围 0 - 1
+    /// @param b 蓝色值，范围 0 - 1
     static Color Rgba(float r, float g, float b, float alpha);
 
     /// \~chinese
-    /// @brief  RGBA ɫ
-    /// @param r ɫֵΧ 0 - 255
-    /// @param g ɫֵΧ 0 - 255
-    /// @param b ɫֵΧ 0 - 255
-    /// @param alpha AlphaֵΧ 0.0 - 1.0
+    /// @brief 构造 RGBA 颜色
+    /// @param r 红色值，范围 0 - 255
+    /// @param g 绿色值，范围 0 - 255
+    /// @param b 蓝色值，范围 0 - 255
+    /// @param alpha Alpha值，范围 0.0 - 1.0
     static Color Rgba(int r, int g, int b, float alpha);
 
     /// \~chinese
-    /// @brief  RGBA ɫ
-    /// @param rgb ʹ16ֵʾ RGBɫ
-    /// @param alpha AlphaֵΧ 0.0 - 1.0
+    /// @brief 构造 RGBA 颜色
+    /// @param rgb 使用16进制整形值表示 RGB颜色
+    /// @param alpha Alpha值，范围 0.0 - 1.0
     static Color Rgba(uint32_t rgb, float alpha);
 
     bool operator==(const Color& rhs) const;
@@ -113,7 +113,7 @@ public:
 
 public:
     /// \~chinese
-    /// @brief ɫö
+    /// @brief 常见颜色枚举
     enum Value : uint32_t
     {
         Black         = 0x000000,
@@ -158,14 +158,14 @@ public:
     };
 
     /// \~chinese
-    /// @brief ͸ɫ
+    /// @brief 透明色
     static const Color Transparent;
 
 public:
-    float r;  ///< ɫֵ
-    float g;  ///< ɫֵ
-    float b;  ///< ɫֵ
-    float a;  ///< Alphaֵ
+    float r;  ///< 红色值
+    float g;  ///< 绿色值
+    float b;  ///< 蓝色值
+    float a;  ///< Alpha值
 };
 
 /** @} */
@@ -57,10 +57,16 @@ public:
                                       _In_opt_ const D2D1_BITMAP_PROPERTIES* properties,
                                       _In_ ComPtr<IWICFormatConverter> converter) override;
 
+    HRESULT CreateBitmapFromWicBitmap(_Out_ ComPtr<ID2D1Bitmap>& bitmap,
+                                      _In_opt_ const D2D1_BITMAP_PROPERTIES* properties,
+                                      _In_ ComPtr<IWICBitmap> wic_bitmap) override;
+
+    HRESULT CreateWicBitmap(_Out_ ComPtr<IWICBitmap>& wic_bitmap, _In_ ComPtr<IWICBitmapSource> source) override;
+
     HRESULT CreateBitmapDecoderFromFile(_Out_ ComPtr<IWICBitmapDecoder>& decoder, _In_ LPCWSTR file_path) override;
 
-    HRESULT CreateBitmapDecoderFromResource(_Out_ ComPtr<IWICBitmapDecoder>& decoder, _In_ void* data,
-                                            DWORD data_size) override;
+    HRESULT CreateBitmapDecoderFromResource(_Out_ ComPtr<IWICBitmapDecoder>& decoder,
+                                            _In_ const BinaryData& data) override;
 
     HRESULT CreateTextFormat(_Out_ ComPtr<IDWriteTextFormat>& text_format, _In_ LPCWSTR family,
                              _In_ ComPtr<IDWriteFontCollection> collection, DWRITE_FONT_WEIGHT weight,
@@ -231,7 +237,8 @@ HRESULT D2DDeviceResources::CreateDeviceIndependentResources()
     config.debugLevel = D2D1_DEBUG_LEVEL_INFORMATION;
 #endif
 
-    hr = D2D1CreateFactory(D2D1_FACTORY_TYPE_SINGLE_THREADED, __uuidof(ID2D1Factory1), &config,
+    // Resources may be created on the update thread while the render thread is drawing
+    hr = D2D1CreateFactory(D2D1_FACTORY_TYPE_MULTI_THREADED, __uuidof(ID2D1Factory1), &config,
                            reinterpret_cast<void**>(&factory));
 
     if (SUCCEEDED(hr))
@@ -443,6 +450,41 @@ HRESULT D2DDeviceResources::CreateBitmapFromConverter(_Out_ ComPtr<ID2D1Bitmap>&
     return hr;
 }
 
+HRESULT D2DDeviceResources::CreateBitmapFromWicBitmap(_Out_ ComPtr<ID2D1Bitmap>& bitmap,
+                                                      _In_opt_ const D2D1_BITMAP_PROPERTIES* properties,
+                                                      _In_ ComPtr<IWICBitmap> wic_bitmap)
+{
+    if (!device_context_)
+        return E_UNEXPECTED;
+
+    ComPtr<ID2D1Bitmap> output;
+
+    HRESULT hr = device_context_->CreateBitmapFromWicBitmap(wic_bitmap.Get(), properties, &output);
+
+    if (SUCCEEDED(hr))
+    {
+        bitmap = output;
+    }
+    return hr;
+}
+
+HRESULT D2DDeviceResources::CreateWicBitmap(_Out_ ComPtr<IWICBitmap>& wic_bitmap, _In_ ComPtr<IWICBitmapSource> source)
+{
+    if (!imaging_factory_)
+        return E_UNEXPECTED;
+
+    ComPtr<IWICBitmap> output;
+
+    // Decode all pixels now, so that nothing is left to the thread that uploads the bitmap
+    HRESULT hr = imaging_factory_->CreateBitmapFromSource(source.Get(), WICBitmapCacheOnLoad, &output);
+
+    if (SUCCEEDED(hr))
+    {
+        wic_bitmap = output;
+    }
+    return hr;
+}
+
 HRESULT D2DDeviceResources::CreateBitmapDecoderFromFile(_Out_ ComPtr<IWICBitmapDecoder>& decoder,
                                                         _In_ LPCWSTR                     file_path)
 {
@@ -461,13 +503,14 @@ HRESULT D2DDeviceResources::CreateBitmapDecoderFromFile(_Out_ ComPtr<IWICBitmapD
     return hr;
 }
 
-HRESULT D2DDeviceResources::CreateBitmapDecoderFromResource(_Out_ ComPtr<IWICBitmapDecoder>& decoder, _In_ void* data,
-                                                            DWORD data_size)
+HRESULT D2DDeviceResources::CreateBitmapDecoderFromResource(_Out_ ComPtr<IWICBitmapDecoder>& decoder,
+                                                            _In_ const BinaryData& data)
 {
     if (!imaging_factory_)
         return E_UNEXPECTED;
 
-    HRESULT hr = data ? S_OK : E_FAIL;
+    // WIC streams can not be larger than 4GB
+    HRESULT hr = (data.IsValid() && data.GetSize() <= MAXDWORD) ? S_OK : E_FAIL;
 
     if (SUCCEEDED(hr))
     {
@@ -476,7 +519,8 @@ HRESULT D2DDeviceResources::CreateBitmapDecoderFromResource(_Out_ ComPtr<IWICBit
 
         if (SUCCEEDED(hr))
         {
-            hr = stream->InitializeFromMemory(static_cast<WICInProcPointer>(data), data_size);
+            // The stream reads the data in place, the caller keeps the data alive while the decoder is used
+            hr = stream->InitializeFromMemory(const_cast<WICInProcPointer>(data.GetBytes()), DWORD(data.GetSize()));
         }
 
         if (SUCCEEDED(hr))
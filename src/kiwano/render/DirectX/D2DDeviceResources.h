@@ -44,10 +44,16 @@ public:
                                               _In_opt_ const D2D1_BITMAP_PROPERTIES* properties,
                                               _In_ ComPtr<IWICFormatConverter> converter) = 0;
 
+    virtual HRESULT CreateBitmapFromWicBitmap(_Out_          ComPtr<ID2D1Bitmap> & bitmap,
+                                              _In_opt_ const D2D1_BITMAP_PROPERTIES* properties,
+                                              _In_ ComPtr<IWICBitmap> wic_bitmap) = 0;
+
+    virtual HRESULT CreateWicBitmap(_Out_ ComPtr<IWICBitmap> & wic_bitmap, _In_ ComPtr<IWICBitmapSource> source) = 0;
+
     virtual HRESULT CreateBitmapDecoderFromFile(_Out_ ComPtr<IWICBitmapDecoder> & decoder, _In_ LPCWSTR file_path) = 0;
 
-    virtual HRESULT CreateBitmapDecoderFromResource(_Out_ ComPtr<IWICBitmapDecoder> & decoder, _In_ void* data,
-                                                    DWORD data_size) = 0;
+    virtual HRESULT CreateBitmapDecoderFromResource(_Out_ ComPtr<IWICBitmapDecoder> & decoder,
+                                                    _In_ const BinaryData& data) = 0;
 
     virtual HRESULT CreateTextFormat(_Out_ ComPtr<IDWriteTextFormat> & text_format, _In_ LPCWSTR family,
                                      _In_ ComPtr<IDWriteFontCollection> collection, DWRITE_FONT_WEIGHT weight,
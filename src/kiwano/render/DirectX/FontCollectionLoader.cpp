@@ -777,9 +777,8 @@ public:
     virtual ULONG STDMETHODCALLTYPE   Release();
 
 private:
-    ULONG  refCount_;
-    LPVOID resourcePtr_;
-    DWORD  resourceSize_;
+    ULONG      refCount_;
+    BinaryData resource_;  // Keeps the font data alive as long as the stream
 };
 
 HRESULT IResourceFontFileStream::Create(_Out_ IResourceFontFileStream** ppStream, const BinaryData& data)
@@ -812,8 +811,6 @@ HRESULT IResourceFontFileStream::Create(_Out_ IResourceFontFileStream** ppStream
 
 ResourceFontFileStream::ResourceFontFileStream()
     : refCount_(0)
-    , resourcePtr_(NULL)
-    , resourceSize_(0)
 {
 }
 
@@ -823,8 +820,7 @@ STDMETHODIMP ResourceFontFileStream::Initialize(const BinaryData& data)
 
     if (SUCCEEDED(hr))
     {
-        resourcePtr_  = data.buffer;
-        resourceSize_ = data.size;
+        resource_ = data;
     }
     return hr;
 }
@@ -833,9 +829,10 @@ HRESULT STDMETHODCALLTYPE ResourceFontFileStream::ReadFileFragment(void const**
                                                                    UINT64 fragmentSize, _Out_ void** fragmentContext)
 {
     // The pLoader is responsible for doing a bounds check.
-    if (fileOffset <= resourceSize_ && fragmentSize <= resourceSize_ - fileOffset)
+    const UINT64 resourceSize = resource_.GetSize();
+    if (fileOffset <= resourceSize && fragmentSize <= resourceSize - fileOffset)
     {
-        *fragmentStart   = static_cast<BYTE const*>(resourcePtr_) + static_cast<uint32_t>(fileOffset);
+        *fragmentStart   = resource_.GetBytes() + fileOffset;
         *fragmentContext = NULL;
         return S_OK;
     }
@@ -851,7 +848,7 @@ void STDMETHODCALLTYPE ResourceFontFileStream::ReleaseFileFragment(void* fragmen
 
 HRESULT STDMETHODCALLTYPE ResourceFontFileStream::GetFileSize(_Out_ UINT64* fileSize)
 {
-    *fileSize = resourceSize_;
+    *fileSize = resource_.GetSize();
     return S_OK;
 }
 
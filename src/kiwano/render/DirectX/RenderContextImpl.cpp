@@ -18,6 +18,10 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <kiwano/macros.h>
+
+#if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_DIRECTX
+
 #include <kiwano/render/DirectX/RenderContextImpl.h>
 #include <kiwano/render/DirectX/NativePtr.h>
 #include <kiwano/render/Renderer.h>
@@ -58,6 +62,21 @@ HRESULT RenderContextImpl::CreateDeviceResources(ComPtr<ID2D1Factory> factory, C
         hr = factory->CreateDrawingStateBlock(&drawing_state_);
     }
 
+    // Sprite batches are available on Windows 10 and later, sprites are drawn one by one otherwise
+    if (SUCCEEDED(hr))
+    {
+        device_context3_.Reset();
+        sprite_batch_.Reset();
+
+        if (SUCCEEDED(render_target_->QueryInterface(IID_PPV_ARGS(&device_context3_))))
+        {
+            if (FAILED(device_context3_->CreateSpriteBatch(&sprite_batch_)))
+            {
+                device_context3_.Reset();
+            }
+        }
+    }
+
     if (SUCCEEDED(hr))
     {
         NativePtr::Set(this, render_target);
@@ -70,6 +89,8 @@ void RenderContextImpl::DiscardDeviceResources()
     text_renderer_.Reset();
     render_target_.Reset();
     current_brush_.Reset();
+    sprite_batch_.Reset();
+    device_context3_.Reset();
 
     ResetNativePointer();
 }
@@ -89,6 +110,8 @@ void RenderContextImpl::EndDraw()
 {
     KGE_ASSERT(render_target_ && "Render target has not been initialized!");
 
+    FlushSprites();
+
     HRESULT hr = render_target_->EndDraw();
     KGE_THROW_IF_FAILED(hr, "ID2D1RenderTarget EndDraw failed");
 
@@ -121,6 +144,91 @@ void RenderContextImpl::DrawTexture(const Texture& texture, const Rect* src_rect
     }
 }
 
+void RenderContextImpl::DrawSpriteBatch(const SpriteBatch& batch)
+{
+    KGE_ASSERT(render_target_ && "Render target has not been initialized!");
+
+    if (!batch.texture || !batch.texture->IsValid() || batch.items.empty())
+        return;
+
+    if (!sprite_batch_)
+    {
+        RenderContext::DrawSpriteBatch(batch);
+        return;
+    }
+
+    // Source rectangles of sprite batches are in pixels
+    const Size      size          = batch.texture->GetSize();
+    const PixelSize pixel_size    = batch.texture->GetSizeInPixels();
+    const float     pixel_scale_x = size.x > 0 ? float(pixel_size.x) / size.x : 1.0f;
+    const float     pixel_scale_y = size.y > 0 ? float(pixel_size.y) / size.y : 1.0f;
+
+    const uint32_t count = uint32_t(batch.items.size());
+
+    sprite_src_rects_.resize(count);
+    sprite_colors_.resize(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        const auto& item = batch.items[i];
+
+        sprite_src_rects_[i] = D2D1::RectU(uint32_t(std::lround(item.src_rect.GetLeft() * pixel_scale_x)),
+                                           uint32_t(std::lround(item.src_rect.GetTop() * pixel_scale_y)),
+                                           uint32_t(std::lround(item.src_rect.GetRight() * pixel_scale_x)),
+                                           uint32_t(std::lround(item.src_rect.GetBottom() * pixel_scale_y)));
+        sprite_colors_[i]    = D2D1::ColorF(1.0f, 1.0f, 1.0f, item.opacity);
+    }
+
+    // Destination rectangles and transforms are read from the items in place
+    const auto& first = batch.items.front();
+
+    sprite_batch_->Clear();
+    HRESULT hr = sprite_batch_->AddSprites(count, DX::ConvertToRectF(&first.dest_rect), sprite_src_rects_.data(),
+                                           sprite_colors_.data(), DX::ConvertToMatrix3x2F(&first.transform),
+                                           sizeof(SpriteBatch::Item), sizeof(D2D1_RECT_U), sizeof(D2D1_COLOR_F),
+                                           sizeof(SpriteBatch::Item));
+
+    if (SUCCEEDED(hr))
+    {
+        D2D1_BITMAP_INTERPOLATION_MODE mode;
+        if (batch.texture->GetBitmapInterpolationMode() == InterpolationMode::Linear)
+        {
+            mode = D2D1_BITMAP_INTERPOLATION_MODE_LINEAR;
+        }
+        else
+        {
+            mode = D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR;
+        }
+
+        // Sprite transforms are applied before the world transform, which only contains the global transform
+        D2D1_MATRIX_3X2_F saved_transform;
+        device_context3_->GetTransform(&saved_transform);
+        if (fast_global_transform_)
+        {
+            device_context3_->SetTransform(D2D1::Matrix3x2F::Identity());
+        }
+        else
+        {
+            device_context3_->SetTransform(DX::ConvertToMatrix3x2F(&global_transform_));
+        }
+
+        // Sprite batches can only be drawn in aliased mode, so only axis-aligned sprites are batched
+        D2D1_ANTIALIAS_MODE saved_antialias = device_context3_->GetAntialiasMode();
+        device_context3_->SetAntialiasMode(D2D1_ANTIALIAS_MODE_ALIASED);
+
+        auto bitmap = NativePtr::Get<ID2D1Bitmap>(*batch.texture);
+        device_context3_->DrawSpriteBatch(sprite_batch_.Get(), bitmap.Get(), mode);
+
+        device_context3_->SetAntialiasMode(saved_antialias);
+        device_context3_->SetTransform(saved_transform);
+
+        IncreasePrimitivesCount(count);
+    }
+    else
+    {
+        RenderContext::DrawSpriteBatch(batch);
+    }
+}
+
 void RenderContextImpl::DrawTextLayout(const TextLayout& layout, const Point& offset)
 {
     KGE_ASSERT(text_renderer_ && "Text renderer has not been initialized!");
@@ -485,3 +593,5 @@ void RenderContextImpl::RestoreDrawingState()
 }
 
 }  // namespace kiwano
+
+#endif
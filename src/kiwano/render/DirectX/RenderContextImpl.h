@@ -21,6 +21,7 @@
 #pragma once
 #include <kiwano/render/RenderContext.h>
 #include <kiwano/render/DirectX/TextRenderer.h>
+#include <d2d1_3.h>
 
 namespace kiwano
 {
@@ -42,6 +43,8 @@ public:
 
     void DrawTexture(const Texture& texture, const Rect* src_rect, const Rect* dest_rect) override;
 
+    void DrawSpriteBatch(const SpriteBatch& batch) override;
+
     void DrawTextLayout(const TextLayout& layout, const Point& offset) override;
 
     void DrawShape(const Shape& shape) override;
@@ -103,6 +106,10 @@ private:
     ComPtr<ITextRenderer>          text_renderer_;
     ComPtr<ID2D1RenderTarget>      render_target_;
     ComPtr<ID2D1DrawingStateBlock> drawing_state_;
+    ComPtr<ID2D1DeviceContext3>    device_context3_;
+    ComPtr<ID2D1SpriteBatch>       sprite_batch_;
+    Vector<D2D1_RECT_U>            sprite_src_rects_;
+    Vector<D2D1_COLOR_F>           sprite_colors_;
 };
 
 }  // namespace kiwano
@@ -18,6 +18,10 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <kiwano/macros.h>
+
+#if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_DIRECTX
+
 #include <kiwano/utils/Logger.h>
 #include <kiwano/event/Events.h>
 #include <kiwano/platform/FileSystem.h>
@@ -265,7 +269,7 @@ void RendererImpl::CreateTexture(Texture& texture, const BinaryData& data)
         if (SUCCEEDED(hr))
         {
             ComPtr<IWICBitmapDecoder> decoder;
-            hr = d2d_res_->CreateBitmapDecoderFromResource(decoder, data.buffer, (DWORD)data.size);
+            hr = d2d_res_->CreateBitmapDecoderFromResource(decoder, data);
 
             if (SUCCEEDED(hr))
             {
@@ -300,6 +304,129 @@ void RendererImpl::CreateTexture(Texture& texture, const BinaryData& data)
     KGE_SET_STATUS_IF_FAILED(hr, texture, "Load texture failed");
 }
 
+void RendererImpl::CreateTexture(Texture& texture, const DecodedImage& image)
+{
+    HRESULT hr = S_OK;
+    if (!d2d_res_)
+    {
+        hr = E_UNEXPECTED;
+    }
+
+    auto wic_bitmap = NativePtr::Get<IWICBitmap>(image);
+
+    if (!wic_bitmap)
+    {
+        hr = E_INVALIDARG;
+    }
+
+    if (SUCCEEDED(hr))
+    {
+        ComPtr<ID2D1Bitmap> bitmap;
+        hr = d2d_res_->CreateBitmapFromWicBitmap(bitmap, nullptr, wic_bitmap);
+
+        if (SUCCEEDED(hr))
+        {
+            NativePtr::Set(texture, bitmap);
+
+            texture.SetSize({ bitmap->GetSize().width, bitmap->GetSize().height });
+            texture.SetSizeInPixels({ bitmap->GetPixelSize().width, bitmap->GetPixelSize().height });
+        }
+    }
+
+    KGE_SET_STATUS_IF_FAILED(hr, texture, "Load texture failed");
+}
+
+void RendererImpl::DecodeImage(DecodedImage& image, const String& file_path)
+{
+    HRESULT hr = S_OK;
+    if (!d2d_res_)
+    {
+        hr = E_UNEXPECTED;
+    }
+
+    if (!FileSystem::GetInstance().IsFileExists(file_path))
+    {
+        hr = HRESULT_FROM_WIN32(ERROR_FILE_NOT_FOUND);
+        KGE_SET_STATUS_IF_FAILED(hr, image,
+                                 strings::Format("Texture file '%s' not found!", file_path.c_str()).c_str());
+        return;
+    }
+
+    if (SUCCEEDED(hr))
+    {
+        WideString full_path = strings::NarrowToWide(FileSystem::GetInstance().GetFullPathForFile(file_path));
+
+        ComPtr<IWICBitmapDecoder> decoder;
+        hr = d2d_res_->CreateBitmapDecoderFromFile(decoder, full_path.c_str());
+
+        if (SUCCEEDED(hr))
+        {
+            hr = DecodeImageFrame(image, decoder);
+        }
+    }
+
+    KGE_SET_STATUS_IF_FAILED(hr, image, "Decode image failed");
+}
+
+void RendererImpl::DecodeImage(DecodedImage& image, const BinaryData& data)
+{
+    HRESULT hr = S_OK;
+    if (!d2d_res_)
+    {
+        hr = E_UNEXPECTED;
+    }
+
+    if (SUCCEEDED(hr))
+    {
+        hr = data.IsValid() ? S_OK : E_FAIL;
+
+        if (SUCCEEDED(hr))
+        {
+            ComPtr<IWICBitmapDecoder> decoder;
+            hr = d2d_res_->CreateBitmapDecoderFromResource(decoder, data);
+
+            if (SUCCEEDED(hr))
+            {
+                hr = DecodeImageFrame(image, decoder);
+            }
+        }
+    }
+
+    KGE_SET_STATUS_IF_FAILED(hr, image, "Decode image failed");
+}
+
+HRESULT RendererImpl::DecodeImageFrame(DecodedImage& image, ComPtr<IWICBitmapDecoder> decoder)
+{
+    ComPtr<IWICBitmapFrameDecode> source;
+    HRESULT                       hr = decoder->GetFrame(0, &source);
+
+    if (SUCCEEDED(hr))
+    {
+        ComPtr<IWICFormatConverter> converter;
+        hr = d2d_res_->CreateBitmapConverter(converter, source, GUID_WICPixelFormat32bppPBGRA, WICBitmapDitherTypeNone,
+                                             nullptr, 0.f, WICBitmapPaletteTypeMedianCut);
+
+        if (SUCCEEDED(hr))
+        {
+            ComPtr<IWICBitmap> wic_bitmap;
+            hr = d2d_res_->CreateWicBitmap(wic_bitmap, converter);
+
+            if (SUCCEEDED(hr))
+            {
+                UINT width = 0, height = 0;
+                hr         = wic_bitmap->GetSize(&width, &height);
+
+                if (SUCCEEDED(hr))
+                {
+                    NativePtr::Set(image, wic_bitmap);
+                    image.SetSizeInPixels({ width, height });
+                }
+            }
+        }
+    }
+    return hr;
+}
+
 void RendererImpl::CreateGifImage(GifImage& gif, const String& file_path)
 {
     HRESULT hr = S_OK;
@@ -347,7 +474,7 @@ void RendererImpl::CreateGifImage(GifImage& gif, const BinaryData& data)
         if (SUCCEEDED(hr))
         {
             ComPtr<IWICBitmapDecoder> decoder;
-            hr = d2d_res_->CreateBitmapDecoderFromResource(decoder, data.buffer, (DWORD)data.size);
+            hr = d2d_res_->CreateBitmapDecoderFromResource(decoder, data);
 
             if (SUCCEEDED(hr))
             {
@@ -967,6 +1094,8 @@ RenderContextPtr RendererImpl::CreateTextureRenderContext(Texture& texture, cons
             if (SUCCEEDED(hr))
             {
                 NativePtr::Set(texture, output);
+                texture.SetSize({ output->GetSize().width, output->GetSize().height });
+                texture.SetSizeInPixels({ output->GetPixelSize().width, output->GetPixelSize().height });
             }
         }
     }
@@ -1011,3 +1140,5 @@ void RendererImpl::Resize(uint32_t width, uint32_t height)
 }
 
 }  // namespace kiwano
+
+#endif
@@ -36,6 +36,12 @@ public:
 
     void CreateTexture(Texture& texture, const BinaryData& data) override;
 
+    void CreateTexture(Texture& texture, const DecodedImage& image) override;
+
+    void DecodeImage(DecodedImage& image, const String& file_path) override;
+
+    void DecodeImage(DecodedImage& image, const BinaryData& data) override;
+
     void CreateGifImage(GifImage& gif, const String& file_path) override;
 
     void CreateGifImage(GifImage& gif, const BinaryData& data) override;
@@ -86,6 +92,9 @@ public:
 protected:
     RendererImpl();
 
+private:
+    HRESULT DecodeImageFrame(DecodedImage& image, ComPtr<IWICBitmapDecoder> decoder);
+
 private:
     using ID2DDeviceResources = kiwano::graphics::directx::ID2DDeviceResources;
     using ID3DDeviceResources = kiwano::graphics::directx::ID3DDeviceResources;
@@ -84,6 +84,36 @@ FontPtr Font::Preload(const Resource& resource)
     return ptr;
 }
 
+FontPtr Font::Preload(const BinaryData& data)
+{
+    // The same memory always holds the same font
+    size_t hash_code = std::hash<const void*>{}(data.GetBuffer());
+    if (FontPtr ptr = FontCache::GetInstance().GetFont(hash_code))
+    {
+        return ptr;
+    }
+
+    FontPtr ptr = MakePtr<Font>();
+    if (ptr)
+    {
+        Vector<String> family_names;
+        Renderer::GetInstance().CreateFontCollection(*ptr, family_names, data);
+        if (ptr->IsValid())
+        {
+            FontCache::GetInstance().AddFont(hash_code, ptr);
+            if (!family_names.empty())
+            {
+                ptr->SetFamilyName(family_names[0]);
+            }
+            for (const auto& name : family_names)
+            {
+                FontCache::GetInstance().AddFontByFamily(name, ptr);
+            }
+        }
+    }
+    return ptr;
+}
+
 Font::Font()
     : size_(18.0f)
     , weight_(FontWeight::Normal)
@@ -35,7 +35,7 @@ class Renderer;
 
 /**
  * \~chinese
- * @brief ϸֵ
+ * @brief 字体粗细值
  */
 struct FontWeight
 {
@@ -44,9 +44,9 @@ struct FontWeight
         Thin       = 100U,
         ExtraLight = 200U,
         Light      = 300U,
-        Normal     = 400U,  ///< 
+        Normal     = 400U,  ///< 正常
         Medium     = 500U,
-        Bold       = 700U,  ///< Ӵ
+        Bold       = 700U,  ///< 加粗
         ExtraBold  = 800U,
         Black      = 900U,
         ExtraBlack = 950U
@@ -55,86 +55,91 @@ struct FontWeight
 
 /**
  * \~chinese
- * @brief ̬
+ * @brief 字体形态
  */
 enum class FontPosture
 {
-    Normal,   ///< 
-    Oblique,  ///< б
-    Italic,   ///< б
+    Normal,   ///< 正常
+    Oblique,  ///< 倾斜体
+    Italic,   ///< 斜体
 };
 
 /**
  * \~chinese
- * @brief 
+ * @brief 字体拉伸
  */
 enum class FontStretch
 {
     Unknown,
     UltraCondensed,
     ExtraCondensed,
-    Condensed,       ///< ѹ
+    Condensed,       ///< 压缩
     SemiCondensed,
-    Normal,          ///< 
+    Normal,          ///< 正常
     SemiExpanded,
-    Expanded,        ///< 
+    Expanded,        ///< 扩大
     ExtraExpanded,
     UltraExpanded,
 };
 
 /**
  * \~chinese
- * @brief 
+ * @brief 字体
  */
 class Font : public NativeObject
 {
 public:
     /// \~chinese
-    /// @brief Ԥ
-    /// @param file ļ
+    /// @brief 预加载字体
+    /// @param file 字体文件
     static FontPtr Preload(const String& file);
 
     /// \~chinese
-    /// @brief Ԥ
-    /// @param resource Դ
+    /// @brief 预加载字体
+    /// @param resource 字体资源
     static FontPtr Preload(const Resource& resource);
 
     /// \~chinese
-    /// @brief ϵͳĬ
+    /// @brief 预加载字体
+    /// @param data 字体数据，不持有内存的数据在字体使用期间必须有效
+    static FontPtr Preload(const BinaryData& data);
+
+    /// \~chinese
+    /// @brief 创建系统默认字体
     Font();
 
     /// \~chinese
-    /// @brief ͨ崴
-    /// @param family_name 
-    /// @param size ֺ
-    /// @param weight ϸ
-    /// @param posture ̬
+    /// @brief 通过字体族创建字体
+    /// @param family_name 字体族
+    /// @param size 字号
+    /// @param weight 字体粗细
+    /// @param posture 字体形态
     Font(const String& family_name, float size, uint32_t weight = FontWeight::Normal,
          FontPosture posture = FontPosture::Normal, FontStretch stretch = FontStretch::Normal);
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取字体族
     String GetFamilyName() const;
 
     /// \~chinese
-    /// @brief ȡֺ
+    /// @brief 获取字号
     float GetSize() const;
 
     /// \~chinese
-    /// @brief ȡϸֵ
+    /// @brief 获取字体粗细值
     uint32_t GetWeight() const;
 
     /// \~chinese
-    /// @brief ȡ̬
+    /// @brief 获取字体形态
     FontPosture GetPosture() const;
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取字体拉伸
     FontStretch GetStretch() const;
 
 protected:
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取字体族
     void SetFamilyName(const String& name);
 
 protected:
@@ -147,7 +152,7 @@ protected:
 
 /**
  * \~chinese
- * @brief 
+ * @brief 纹理缓存
  */
 class KGE_API FontCache final : public Singleton<FontCache>
 {
@@ -155,31 +160,31 @@ class KGE_API FontCache final : public Singleton<FontCache>
 
 public:
     /// \~chinese
-    /// @brief 建
+    /// @brief 添加字体缓存
     void AddFont(size_t key, FontPtr font);
 
     /// \~chinese
-    /// @brief ӳ建
+    /// @brief 添加字体族映射字体缓存
     void AddFontByFamily(const String& font_family, FontPtr font);
 
     /// \~chinese
-    /// @brief ȡ建
+    /// @brief 获取字体缓存
     FontPtr GetFont(size_t key) const;
 
     /// \~chinese
-    /// @brief ȡӳ建
+    /// @brief 获取字体族映射字体缓存
     FontPtr GetFontByFamily(const String& font_family) const;
 
     /// \~chinese
-    /// @brief Ƴ建
+    /// @brief 移除字体缓存
     void RemoveFont(size_t key);
 
     /// \~chinese
-    /// @brief Ƴӳ建
+    /// @brief 移除字体族映射字体缓存
     void RemoveFontByFamily(const String& font_family);
 
     /// \~chinese
-    /// @brief ջ
+    /// @brief 清空缓存
     void Clear();
 
     ~FontCache();
@@ -22,6 +22,7 @@
 #include <kiwano/render/GifImage.h>
 #include <kiwano/render/Renderer.h>
 #include <kiwano/render/TextureCache.h>
+#include <kiwano/render/TextureLoader.h>
 #include <functional>  // std::hash
 
 namespace kiwano
@@ -57,6 +58,16 @@ GifImagePtr GifImage::Preload(const Resource& res)
     return ptr;
 }
 
+TextureLoadRequestPtr GifImage::PreloadAsync(const String& file_path, Function<void(GifImagePtr)> callback)
+{
+    return TextureLoader::GetInstance().LoadGifImage(file_path, callback);
+}
+
+TextureLoadRequestPtr GifImage::PreloadAsync(const Resource& res, Function<void(GifImagePtr)> callback)
+{
+    return TextureLoader::GetInstance().LoadGifImage(res, callback);
+}
+
 GifImage::GifImage(const String& file_path)
     : GifImage()
 {
@@ -81,7 +92,10 @@ bool GifImage::Load(const String& file_path)
     if (IsValid())
     {
         if (GetGlobalMetadata())
+        {
+            data_ = BinaryData();
             return true;
+        }
 
         // Clear data
         ResetNativePointer();
@@ -92,12 +106,20 @@ bool GifImage::Load(const String& file_path)
 
 bool GifImage::Load(const Resource& res)
 {
-    Renderer::GetInstance().CreateGifImage(*this, res.GetData());
+    return Load(res.GetData());
+}
+
+bool GifImage::Load(const BinaryData& data)
+{
+    Renderer::GetInstance().CreateGifImage(*this, data);
 
     if (IsValid())
     {
         if (GetGlobalMetadata())
+        {
+            data_ = data;
             return true;
+        }
 
         // Clear data
         ResetNativePointer();
@@ -145,10 +167,10 @@ bool GifImage::GetGlobalMetadata()
             PROPVARIANT prop_val;
             ::PropVariantInit(&prop_val);
 
-            // ȡȫ frame С
+            // 获取全局 frame 大小
             if (SUCCEEDED(hr))
             {
-                // ȡ
+                // 获取宽度
                 hr = metadata_reader->GetMetadataByName(L"/logscrdesc/Width", &prop_val);
 
                 if (SUCCEEDED(hr))
@@ -164,7 +186,7 @@ bool GifImage::GetGlobalMetadata()
 
             if (SUCCEEDED(hr))
             {
-                // ȡ߶
+                // 获取高度
                 hr = metadata_reader->GetMetadataByName(L"/logscrdesc/Height", &prop_val);
 
                 if (SUCCEEDED(hr))
@@ -180,7 +202,7 @@ bool GifImage::GetGlobalMetadata()
 
             if (SUCCEEDED(hr))
             {
-                // ݺ
+                // 获得像素纵横比
                 hr = metadata_reader->GetMetadataByName(L"/logscrdesc/PixelAspectRatio", &prop_val);
 
                 if (SUCCEEDED(hr))
@@ -190,11 +212,11 @@ bool GifImage::GetGlobalMetadata()
                     {
                         if (prop_val.bVal != 0)
                         {
-                            // Ҫ
-                            //  14 41Ϊ 1/64
+                            // 需要计算比率
+                            // 最高像素 1：4，最宽像素 4：1，增量为 1/64
                             float pixel_asp_ratio = (prop_val.bVal + 15.f) / 64.f;
 
-                            // سȼеͼȺ͸߶ȣֻСͼ
+                            // 根据像素长宽比计算像素中的图像宽度和高度，只缩小图像
                             if (pixel_asp_ratio > 1.f)
                             {
                                 size_in_pixels_ = { width, static_cast<uint32_t>(height / pixel_asp_ratio) };
@@ -206,7 +228,7 @@ bool GifImage::GetGlobalMetadata()
                         }
                         else
                         {
-                            // ֵΪ 0, رΪ 1
+                            // 值为 0, 所以像素比为 1
                             size_in_pixels_ = { width, height };
                         }
                     }
@@ -221,6 +243,9 @@ bool GifImage::GetGlobalMetadata()
 
 #else
 
+namespace kiwano
+{
+
 bool GifImage::GetGlobalMetadata()
 {
     return false;  // not supported
@@ -33,87 +33,111 @@ KGE_DECLARE_SMART_PTR(GifImage);
 
 /**
  * \~chinese
- * @brief GIFͼ
+ * @brief GIF图像
  */
 class KGE_API GifImage : public NativeObject
 {
 public:
     /// \~chinese
-    /// @brief ԤرGIFͼƬ
+    /// @brief 预加载本地GIF图片
     static GifImagePtr Preload(const String& file_path);
 
     /// \~chinese
-    /// @brief ԤGIFͼƬԴ
+    /// @brief 预加载GIF图片资源
     static GifImagePtr Preload(const Resource& res);
 
+    /// \~chinese
+    /// @brief 异步预加载本地GIF图片
+    /// @details 在工作线程中读取GIF图片，完成后在主线程中调用回调函数
+    /// @param file_path 图片路径
+    /// @param callback 加载完成的回调函数，加载失败时传入的GIF图像无效
+    static TextureLoadRequestPtr PreloadAsync(const String& file_path, Function<void(GifImagePtr)> callback = nullptr);
+
+    /// \~chinese
+    /// @brief 异步预加载GIF图片资源
+    /// @details 在工作线程中读取GIF图片，完成后在主线程中调用回调函数
+    /// @param res 图片资源
+    /// @param callback 加载完成的回调函数，加载失败时传入的GIF图像无效
+    static TextureLoadRequestPtr PreloadAsync(const Resource& res, Function<void(GifImagePtr)> callback = nullptr);
+
     GifImage();
 
     /// \~chinese
-    /// @brief GIFͼƬ
+    /// @brief 创建GIF图片
     GifImage(const String& file_path);
 
     /// \~chinese
-    /// @brief GIFͼƬ
+    /// @brief 创建GIF图片
     GifImage(const Resource& res);
 
     /// \~chinese
-    /// @brief رGIFͼƬ
+    /// @brief 加载本地GIF图片
     bool Load(const String& file_path);
 
     /// \~chinese
-    /// @brief GIFԴ
+    /// @brief 加载GIF资源
     bool Load(const Resource& res);
 
     /// \~chinese
-    /// @brief ȡؿ
+    /// @brief 加载GIF图片数据
+    bool Load(const BinaryData& data);
+
+    /// \~chinese
+    /// @brief 获取像素宽度
     uint32_t GetWidthInPixels() const;
 
     /// \~chinese
-    /// @brief ȡظ߶
+    /// @brief 获取像素高度
     uint32_t GetHeightInPixels() const;
 
     /// \~chinese
-    /// @brief ȡشС
+    /// @brief 获取像素大小
     PixelSize GetSizeInPixels() const;
 
     /// \~chinese
-    /// @brief ȡ֡
+    /// @brief 获取帧数量
     uint32_t GetFramesCount() const;
 
+    /// \~chinese
+    /// @brief 获取GIF图像占用的内存大小（字节）
+    /// @details GIF帧在使用时才解码，按一帧 32 位像素格式的图像估算
+    size_t GetMemorySize() const;
+
 public:
     /// \~chinese
-    /// @brief GIF֡Ĵ÷ʽ
+    /// @brief GIF帧的处置方式
     enum class DisposalType
     {
-        Unknown,     ///< δ֪
-        None,        ///< 
-        Background,  ///< 
-        Previous     ///< ָǰһ֡
+        Unknown,     ///< 未知
+        None,        ///< 不处理
+        Background,  ///< 背景
+        Previous     ///< 恢复前一帧
     };
 
     /// \~chinese
-    /// @brief GIF֡
+    /// @brief GIF帧
     struct Frame
     {
-        Duration     delay;          ///< ֡ӳ
-        TexturePtr   texture;        ///< ֡ͼ
-        Rect         rect;           ///< 
-        DisposalType disposal_type;  ///< ÷ʽ
+        Duration     delay;          ///< 帧延迟
+        TexturePtr   texture;        ///< 帧图像
+        Rect         rect;           ///< 绘制区域
+        DisposalType disposal_type;  ///< 处置方式
 
         Frame();
     };
 
     /// \~chinese
-    /// @brief ȡGIF֡
-    /// @param index ֡±
+    /// @brief 获取GIF帧
+    /// @param index 帧下标
     Frame GetFrame(uint32_t index);
 
 private:
     bool GetGlobalMetadata();
 
 private:
-    uint32_t frames_count_;
-    PixelSize size_in_pixels_;
+    uint32_t   frames_count_;
+    PixelSize  size_in_pixels_;
+    BinaryData data_;  ///< 帧在使用时才解码，图像数据需要保持有效
 };
 
 /** @} */
@@ -138,6 +162,11 @@ inline PixelSize GifImage::GetSizeInPixels() const
     return size_in_pixels_;
 }
 
+inline size_t GifImage::GetMemorySize() const
+{
+    return size_t(size_in_pixels_.x) * size_in_pixels_.y * 4;
+}
+
 inline uint32_t GifImage::GetFramesCount() const
 {
     return frames_count_;
@@ -33,7 +33,7 @@ KGE_DECLARE_SMART_PTR(Layer);
 
 /**
  * \~chinese
- * @brief ͼ
+ * @brief 图层
  */
 class KGE_API Layer : public NativeObject
 {
@@ -41,35 +41,35 @@ public:
     Layer();
 
     /// \~chinese
-    /// @brief ȡͼü
+    /// @brief 获取图层裁剪区域
     const Rect& GetClipRect() const;
 
     /// \~chinese
-    /// @brief ȡͼ͸
+    /// @brief 获取图层透明度
     float GetOpacity() const;
 
     /// \~chinese
-    /// @brief ȡɲ
+    /// @brief 获取几何蒙层
     ShapePtr GetMaskShape() const;
 
     /// \~chinese
-    /// @brief ȡɲ任
+    /// @brief 获取几何蒙层变换
     const Matrix3x2& GetMaskTransform() const;
 
     /// \~chinese
-    /// @brief ͼü
+    /// @brief 设置图层裁剪区域
     void SetClipRect(const Rect& rect);
 
     /// \~chinese
-    /// @brief ͼ͸
+    /// @brief 设置图层透明度
     void SetOpacity(float opacity);
 
     /// \~chinese
-    /// @brief üɲ
+    /// @brief 设置几何蒙层
     void SetMaskShape(ShapePtr mask);
 
     /// \~chinese
-    /// @brief üɲ任
+    /// @brief 设置几何蒙层变换
     void SetMaskTransform(const Matrix3x2& matrix);
 
 private:
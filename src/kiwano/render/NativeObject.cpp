@@ -18,9 +18,9 @@ void NativeObjectBase::ResetNativePointer(void* native_pointer)
 }
 
 //
-// NativeObject for Windows
+// NativeObject for DirectX
 //
-#if defined(KGE_PLATFORM_WINDOWS)
+#if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_DIRECTX
 
 NativeObject::~NativeObject()
 {
@@ -42,6 +42,31 @@ void NativeObject::ResetNativePointer(void* native_pointer)
     }
 }
 
+//
+// NativeObject for software renderer
+//
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+
+NativeObject::~NativeObject()
+{
+    ResetNativePointer();
+}
+
+void NativeObject::ResetNativePointer(void* native_pointer)
+{
+    if (native_pointer_)
+    {
+        static_cast<RefObject*>(native_pointer_)->Release();
+        native_pointer_ = nullptr;
+    }
+
+    if (native_pointer)
+    {
+        native_pointer_ = native_pointer;
+        static_cast<RefObject*>(native_pointer_)->Retain();
+    }
+}
+
 #endif
 
 }
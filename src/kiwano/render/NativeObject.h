@@ -37,7 +37,7 @@ KGE_DECLARE_SMART_PTR(NativeObject);
 
 /**
  * \~chinese
- * @brief бָĶ
+ * @brief 含有本地指针的对象
  */
 class KGE_API NativeObjectBase : public ObjectBase
 {
@@ -57,7 +57,7 @@ protected:
     void* native_pointer_;
 };
 
-#if defined(KGE_PLATFORM_WINDOWS)
+#if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_DIRECTX || KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
 
 class KGE_API NativeObject : public NativeObjectBase
 {
@@ -37,6 +37,7 @@ RenderContextPtr RenderContext::Create(Texture& texture, const Size& size)
 RenderContext::RenderContext()
     : collecting_status_(false)
     , fast_global_transform_(true)
+    , sprite_batching_(false)
     , brush_opacity_(1.0f)
     , antialias_(true)
     , text_antialias_(TextAntialiasMode::GrayScale)
@@ -49,11 +50,14 @@ void RenderContext::BeginDraw()
     {
         status_.start      = Time::Now();
         status_.primitives = 0;
+        status_.draw_calls = 0;
     }
 }
 
 void RenderContext::EndDraw()
 {
+    FlushSprites();
+
     if (collecting_status_)
     {
         status_.duration = Time::Now() - status_.start;
@@ -83,6 +87,7 @@ void RenderContext::IncreasePrimitivesCount(uint32_t increase) const
     if (collecting_status_)
     {
         status_.primitives += increase;
+        status_.draw_calls += 1;
     }
 }
 
@@ -121,6 +126,65 @@ void RenderContext::SetCurrentStrokeStyle(StrokeStylePtr stroke)
     current_stroke_ = stroke;
 }
 
+void RenderContext::DrawSpriteBatch(const SpriteBatch& batch)
+{
+    if (!batch.texture)
+        return;
+
+    const float opacity = brush_opacity_;
+    for (const auto& item : batch.items)
+    {
+        SetTransform(item.transform);
+        SetBrushOpacity(item.opacity);
+        DrawTexture(*batch.texture, &item.src_rect, &item.dest_rect);
+    }
+    SetBrushOpacity(opacity);
+}
+
+void RenderContext::DrawSprite(const Texture& texture, const Rect& src_rect, const Rect& dest_rect,
+                               const Matrix3x2& transform, float opacity)
+{
+    // Sprite batches may be drawn without antialiasing, which is only acceptable for axis-aligned sprites
+    if (!sprite_batching_ || transform._12 != 0 || transform._21 != 0)
+    {
+        FlushSprites();
+
+        const float saved_opacity = brush_opacity_;
+        SetTransform(transform);
+        SetBrushOpacity(opacity);
+        DrawTexture(texture, &src_rect, &dest_rect);
+        SetBrushOpacity(saved_opacity);
+        return;
+    }
+
+    if (pending_sprites_.texture.Get() != &texture)
+    {
+        FlushSprites();
+        pending_sprites_.texture = const_cast<Texture*>(&texture);
+    }
+
+    pending_sprites_.items.push_back({ src_rect, dest_rect, transform, opacity });
+}
+
+void RenderContext::FlushSprites()
+{
+    if (!pending_sprites_.items.empty())
+    {
+        DrawSpriteBatch(pending_sprites_);
+        pending_sprites_.items.clear();
+    }
+    pending_sprites_.texture = nullptr;
+}
+
+void RenderContext::SetSpriteBatchingEnabled(bool enabled)
+{
+    if (!enabled)
+    {
+        FlushSprites();
+    }
+    sprite_batching_ = enabled;
+}
+
 void RenderContext::DrawCircle(const Point& center, float radius)
 {
     this->DrawEllipse(center, Vec2(radius, radius));
@@ -37,235 +37,289 @@ KGE_DECLARE_SMART_PTR(RenderContext);
  */
 
 /// \~chinese
-/// @brief ֿģʽ
+/// @brief 文字抗锯齿模式
 enum class TextAntialiasMode
 {
-    Default,    ///< ϵͳĬ
-    ClearType,  ///< ClearType 
-    GrayScale,  ///< Ҷȿ
-    None        ///< ÿ
+    Default,    ///< 系统默认
+    ClearType,  ///< ClearType 抗锯齿
+    GrayScale,  ///< 灰度抗锯齿
+    None        ///< 不启用抗锯齿
 };
 
 /// \~chinese
-/// @brief Ⱦ
-/// @details ȾĽɻͼԪĻƣƽضƽ
+/// @brief 精灵批次
+/// @details 一组使用相同纹理绘制的精灵，每个精灵拥有独立的裁剪矩形、目标区域、二维变换和透明度
+struct SpriteBatch
+{
+    /// \~chinese
+    /// @brief 批次中的精灵
+    struct Item
+    {
+        Rect      src_rect;   ///< 源纹理裁剪矩形
+        Rect      dest_rect;  ///< 绘制的目标区域
+        Matrix3x2 transform;  ///< 二维变换
+        float     opacity;    ///< 透明度
+    };
+
+    TexturePtr   texture;  ///< 纹理
+    Vector<Item> items;    ///< 精灵
+};
+
+/// \~chinese
+/// @brief 渲染上下文
+/// @details 渲染上下文将完成基础图元的绘制，并将绘制结果输出到特定的平面中
 class KGE_API RenderContext : public NativeObject
 {
 public:
     /// \~chinese
-    /// @brief Ⱦģƽ
-    /// @param texture ƽ
+    /// @brief 创建纹理渲染上下文，将绘制结果输出到纹理中
+    /// @param texture 保存绘制结果的纹理
     static RenderContextPtr Create(Texture& texture);
 
     /// \~chinese
-    /// @brief Ⱦģƽ
-    /// @param texture ƽ
-    /// @param size ȾС
+    /// @brief 创建纹理渲染上下文，将绘制结果输出到纹理中
+    /// @param texture 保存绘制结果的纹理
+    /// @param size 渲染输出大小
     static RenderContextPtr Create(Texture& texture, const Size& size);
 
     /// \~chinese
-    /// @brief ʼȾ
+    /// @brief 开始渲染
     virtual void BeginDraw();
 
     /// \~chinese
-    /// @brief Ⱦ
+    /// @brief 结束渲染
     virtual void EndDraw();
 
     /// \~chinese
-    /// @brief 
-    /// @param texture 
-    /// @param src_rect Դü
-    /// @param dest_rect ƵĿ
+    /// @brief 绘制纹理
+    /// @param texture 纹理
+    /// @param src_rect 源纹理裁剪矩形
+    /// @param dest_rect 绘制的目标区域
     virtual void DrawTexture(const Texture& texture, const Rect* src_rect = nullptr,
                              const Rect* dest_rect = nullptr) = 0;
 
     /// \~chinese
-    /// @brief ı
-    /// @param layout ı
-    /// @param offset ƫ
+    /// @brief 绘制精灵批次
+    /// @details 默认逐个设置二维变换和透明度并绘制纹理，绘制后上下文的二维变换会被修改
+    /// @param batch 精灵批次
+    virtual void DrawSpriteBatch(const SpriteBatch& batch);
+
+    /// \~chinese
+    /// @brief 绘制精灵
+    /// @details 开启精灵批处理时，连续绘制的同一纹理的精灵会被合并为一个批次，直到纹理改变或调用 FlushSprites 时一次提交。
+    /// 旋转或斜切的精灵不参与批处理，会立即按普通纹理绘制，绘制后上下文的二维变换会被修改
+    /// @param texture 纹理
+    /// @param src_rect 源纹理裁剪矩形
+    /// @param dest_rect 绘制的目标区域
+    /// @param transform 二维变换
+    /// @param opacity 透明度
+    void DrawSprite(const Texture& texture, const Rect& src_rect, const Rect& dest_rect, const Matrix3x2& transform,
+                    float opacity);
+
+    /// \~chinese
+    /// @brief 提交尚未绘制的精灵
+    /// @details 精灵批次之后的绘制命令需要在调用该函数后执行，以保证绘制顺序
+    void FlushSprites();
+
+    /// \~chinese
+    /// @brief 启用或禁用精灵批处理（默认值为 false）
+    /// @details 批次中的精灵不进行抗锯齿，因此只有轴对齐的精灵会被合并
+    void SetSpriteBatchingEnabled(bool enabled);
+
+    /// \~chinese
+    /// @brief 是否启用了精灵批处理
+    bool IsSpriteBatchingEnabled() const;
+
+    /// \~chinese
+    /// @brief 绘制文本布局
+    /// @param layout 文本布局
+    /// @param offset 偏移量
     virtual void DrawTextLayout(const TextLayout& layout, const Point& offset = Point()) = 0;
 
     /// \~chinese
-    /// @brief ״
-    /// @param shape ״
+    /// @brief 绘制形状轮廓
+    /// @param shape 形状
     virtual void DrawShape(const Shape& shape) = 0;
 
     /// \~chinese
-    /// @brief ߶
-    /// @param point1 ߶
-    /// @param point2 ߶յ
+    /// @brief 绘制线段
+    /// @param point1 线段起点
+    /// @param point2 线段终点
     virtual void DrawLine(const Point& point1, const Point& point2) = 0;
 
     /// \~chinese
-    /// @brief ƾα߿
-    /// @param rect 
+    /// @brief 绘制矩形边框
+    /// @param rect 矩形
     virtual void DrawRectangle(const Rect& rect) = 0;
 
     /// \~chinese
-    /// @brief ԲǾα߿
-    /// @param rect 
-    /// @param radius Բǰ뾶
+    /// @brief 绘制圆角矩形边框
+    /// @param rect 矩形
+    /// @param radius 圆角半径
     virtual void DrawRoundedRectangle(const Rect& rect, const Vec2& radius) = 0;
 
     /// \~chinese
-    /// @brief Բα߿
-    /// @param center Բ
-    /// @param radius Բ뾶
+    /// @brief 绘制圆形边框
+    /// @param center 圆心
+    /// @param radius 椭圆半径
     virtual void DrawCircle(const Point& center, float radius);
 
     /// \~chinese
-    /// @brief Բ߿
-    /// @param center Բ
-    /// @param radius Բ뾶
+    /// @brief 绘制椭圆边框
+    /// @param center 圆心
+    /// @param radius 椭圆半径
     virtual void DrawEllipse(const Point& center, const Vec2& radius) = 0;
 
     /// \~chinese
-    /// @brief ״
-    /// @param shape ״
+    /// @brief 填充形状
+    /// @param shape 形状
     virtual void FillShape(const Shape& shape) = 0;
 
     /// \~chinese
-    /// @brief 
-    /// @param rect 
+    /// @brief 填充矩形
+    /// @param rect 矩形
     virtual void FillRectangle(const Rect& rect) = 0;
 
     /// \~chinese
-    /// @brief ԲǾ
-    /// @param rect 
-    /// @param radius Բǰ뾶
+    /// @brief 填充圆角矩形
+    /// @param rect 矩形
+    /// @param radius 圆角半径
     virtual void FillRoundedRectangle(const Rect& rect, const Vec2& radius) = 0;
 
     /// \~chinese
-    /// @brief Բ
-    /// @param center Բ
-    /// @param radius Բ뾶
+    /// @brief 填充圆形
+    /// @param center 圆心
+    /// @param radius 椭圆半径
     virtual void FillCircle(const Point& center, float radius);
 
     /// \~chinese
-    /// @brief Բ
-    /// @param center Բ
-    /// @param radius Բ뾶
+    /// @brief 填充椭圆
+    /// @param center 圆心
+    /// @param radius 椭圆半径
     virtual void FillEllipse(const Point& center, const Vec2& radius) = 0;
 
     /// \~chinese
-    /// @brief 
-    /// @param texture 
-    /// @param size شС
+    /// @brief 创建纹理
+    /// @param texture 纹理
+    /// @param size 纹理像素大小
     virtual void CreateTexture(Texture& texture, math::Vec2T<uint32_t> size) = 0;
 
     /// \~chinese
-    /// @brief ûƵĲü
-    /// @param clip_rect ü
+    /// @brief 设置绘制的裁剪区域
+    /// @param clip_rect 裁剪矩形
     virtual void PushClipRect(const Rect& clip_rect) = 0;
 
     /// \~chinese
-    /// @brief ȡһõĻƲü
+    /// @brief 取消上一次设置的绘制裁剪区域
     virtual void PopClipRect() = 0;
 
     /// \~chinese
-    /// @brief ͼ
-    /// @param layer ͼ
+    /// @brief 设置图层区域
+    /// @param layer 图层区域
     virtual void PushLayer(Layer& layer) = 0;
 
     /// \~chinese
-    /// @brief ȡһõͼ
+    /// @brief 取消上一次设置的图层区域
     virtual void PopLayer() = 0;
 
     /// \~chinese
-    /// @brief Ⱦ
+    /// @brief 清空渲染内容
     virtual void Clear() = 0;
 
     /// \~chinese
-    /// @brief ʹôɫȾ
-    /// @param clear_color ɫ
+    /// @brief 使用纯色清空渲染内容
+    /// @param clear_color 清屏颜色
     virtual void Clear(const Color& clear_color) = 0;
 
     /// \~chinese
-    /// @brief ȡȾС
+    /// @brief 获取渲染区域大小
     virtual Size GetSize() const = 0;
 
     /// \~chinese
-    /// @brief ȡˢ͸
+    /// @brief 获取画刷透明度
     virtual float GetBrushOpacity() const;
 
     /// \~chinese
-    /// @brief ȡǰˢ
+    /// @brief 获取当前画刷
     virtual BrushPtr GetCurrentBrush() const;
 
     /// \~chinese
-    /// @brief ȡȫֶά任
+    /// @brief 获取全局二维变换
     virtual const Matrix3x2& GetGlobalTransform() const;
 
     /// \~chinese
-    /// @brief ûˢ͸
+    /// @brief 设置画刷透明度
     virtual void SetBrushOpacity(float opacity);
 
     /// \~chinese
-    /// @brief õǰʹõĻˢ
+    /// @brief 设置当前使用的画刷
     virtual void SetCurrentBrush(BrushPtr brush);
 
     /// \~chinese
-    /// @brief õǰʹõʽ
+    /// @brief 设置当前使用的线条样式
     virtual void SetCurrentStrokeStyle(StrokeStylePtr stroke);
 
     /// \~chinese
-    /// @brief ÿģʽ
+    /// @brief 设置抗锯齿模式
     virtual void SetAntialiasMode(bool enabled) = 0;
 
     /// \~chinese
-    /// @brief ֿģʽ
+    /// @brief 设置文字抗锯齿模式
     virtual void SetTextAntialiasMode(TextAntialiasMode mode) = 0;
 
     /// \~chinese
-    /// @brief ߽Ƿ
+    /// @brief 检查边界是否在视区内
     virtual bool CheckVisibility(const Rect& bounds, const Matrix3x2& transform) = 0;
 
     /// \~chinese
-    /// @brief ȾĴС
+    /// @brief 重设渲染上下文大小
     virtual void Resize(const Size& size) = 0;
 
     /// \~chinese
-    /// @brief ĵĶά任
+    /// @brief 设置上下文的二维变换
     virtual void SetTransform(const Matrix3x2& matrix) = 0;
 
     /// \~chinese
-    /// @brief ȫֶά任
+    /// @brief 设置全局二维变换
     virtual void SetGlobalTransform(const Matrix3x2& matrix);
 
     /// \~chinese
-    /// @brief ȫֶά任
+    /// @brief 设置全局二维变换
     virtual void SetGlobalTransform(const Matrix3x2* matrix);
 
 public:
     /// \~chinese
-    /// @brief Ⱦ״̬
+    /// @brief 渲染上下文状态
     struct Status
     {
-        uint32_t primitives;  ///< ȾͼԪ
-        Time     start;       ///< Ⱦʼʱ
-        Duration duration;    ///< Ⱦʱ
+        uint32_t primitives;  ///< 渲染图元数量
+        uint32_t draw_calls;  ///< 绘制命令提交次数
+        Time     start;       ///< 渲染起始时间
+        Duration duration;    ///< 渲染时长
 
         Status();
     };
 
     /// \~chinese
-    /// @brief û״̬ռ
+    /// @brief 启用或禁用状态收集功能
     void SetCollectingStatus(bool enable);
 
     /// \~chinese
-    /// @brief ȡȾ״̬
+    /// @brief 获取渲染上下文状态
     const Status& GetStatus() const;
 
 protected:
     RenderContext();
 
     /// \~chinese
-    /// @brief ȾͼԪ
+    /// @brief 增加渲染图元数量
+    /// @details 每次调用记为一次绘制命令提交
     void IncreasePrimitivesCount(uint32_t increase = 1) const;
 
 protected:
     bool              antialias_;
     bool              fast_global_transform_;
+    bool              sprite_batching_;
     mutable bool      collecting_status_;
     float             brush_opacity_;
     TextAntialiasMode text_antialias_;
@@ -273,6 +327,7 @@ protected:
     StrokeStylePtr    current_stroke_;
     Rect              visible_size_;
     Matrix3x2         global_transform_;
+    SpriteBatch       pending_sprites_;
     mutable Status    status_;
 };
 
@@ -280,6 +335,7 @@ protected:
 
 inline RenderContext::Status::Status()
     : primitives(0)
+    , draw_calls(0)
 {
 }
 
@@ -288,4 +344,9 @@ inline const RenderContext::Status& RenderContext::GetStatus() const
     return status_;
 }
 
+inline bool RenderContext::IsSpriteBatchingEnabled() const
+{
+    return sprite_batching_;
+}
+
 }  // namespace kiwano
@@ -0,0 +1,438 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <kiwano/render/RenderSnapshot.h>
+
+namespace kiwano
+{
+
+namespace
+{
+
+enum CommandFlag : uint8_t
+{
+    HasSourceRect = 1,
+    HasDestRect   = 1 << 1,
+    HasValue      = 1 << 2,
+};
+
+inline void StoreRect(float* values, const Rect& rect)
+{
+    values[0] = rect.left_top.x;
+    values[1] = rect.left_top.y;
+    values[2] = rect.right_bottom.x;
+    values[3] = rect.right_bottom.y;
+}
+
+inline Rect LoadRect(const float* values)
+{
+    return Rect(values[0], values[1], values[2], values[3]);
+}
+
+inline void StoreMatrix(float* values, const Matrix3x2& matrix)
+{
+    for (int i = 0; i < 6; ++i)
+        values[i] = matrix.m[i];
+}
+
+inline Matrix3x2 LoadMatrix(const float* values)
+{
+    return Matrix3x2(values[0], values[1], values[2], values[3], values[4], values[5]);
+}
+
+}  // namespace
+
+RenderSnapshot::RenderSnapshot()
+    : batches_count_(0)
+    , layers_count_(0)
+{
+}
+
+RenderSnapshot::~RenderSnapshot() {}
+
+void RenderSnapshot::Reset(const RenderContext& target)
+{
+    commands_.clear();
+    pending_sprites_.items.clear();
+    pending_sprites_.texture = nullptr;
+
+    // Sprite batches are kept for the next frame to reuse their storage
+    for (size_t i = 0; i < batches_count_; ++i)
+        batches_[i].texture = nullptr;
+    batches_count_ = 0;
+
+    // So are the layers, which also keep their native layers
+    for (size_t i = 0; i < layers_count_; ++i)
+        layers_[i]->SetMaskShape(nullptr);
+    layers_count_ = 0;
+
+    size_            = target.GetSize();
+    visible_size_    = Rect(Point(), size_);
+    sprite_batching_ = target.IsSpriteBatchingEnabled();
+
+    // Recording and replaying both start from the default state, snapshots do not depend on the previous frame
+    RenderContext::SetCurrentBrush(nullptr);
+    RenderContext::SetCurrentStrokeStyle(nullptr);
+    RenderContext::SetBrushOpacity(1.f);
+}
+
+void RenderSnapshot::Replay(RenderContext& ctx) const
+{
+    ctx.SetCurrentBrush(nullptr);
+    ctx.SetCurrentStrokeStyle(nullptr);
+    ctx.SetBrushOpacity(1.f);
+    ctx.SetTransform(Matrix3x2());
+
+    for (const auto& cmd : commands_)
+    {
+        const float* v = cmd.values;
+        switch (cmd.op)
+        {
+        case Op::SetTransform:
+            ctx.SetTransform(LoadMatrix(v));
+            break;
+        case Op::SetGlobalTransform:
+            if (cmd.flags & HasValue)
+            {
+                Matrix3x2 matrix = LoadMatrix(v);
+                ctx.SetGlobalTransform(&matrix);
+            }
+            else
+            {
+                ctx.SetGlobalTransform(nullptr);
+            }
+            break;
+        case Op::SetBrushOpacity:
+            ctx.SetBrushOpacity(v[0]);
+            break;
+        case Op::SetBrush:
+            ctx.SetCurrentBrush(BrushPtr(static_cast<Brush*>(cmd.resource.Get())));
+            break;
+        case Op::SetStrokeStyle:
+            ctx.SetCurrentStrokeStyle(StrokeStylePtr(static_cast<StrokeStyle*>(cmd.resource.Get())));
+            break;
+        case Op::SetAntialias:
+            ctx.SetAntialiasMode((cmd.flags & HasValue) != 0);
+            break;
+        case Op::SetTextAntialias:
+            ctx.SetTextAntialiasMode(TextAntialiasMode(int(v[0])));
+            break;
+        case Op::DrawTexture:
+        {
+            Rect src  = LoadRect(v);
+            Rect dest = LoadRect(v + 4);
+            ctx.DrawTexture(*static_cast<Texture*>(cmd.resource.Get()), (cmd.flags & HasSourceRect) ? &src : nullptr,
+                            (cmd.flags & HasDestRect) ? &dest : nullptr);
+            break;
+        }
+        case Op::DrawSpriteBatch:
+            ctx.DrawSpriteBatch(batches_[size_t(v[0])]);
+            break;
+        case Op::DrawTextLayout:
+            ctx.DrawTextLayout(*static_cast<TextLayout*>(cmd.resource.Get()), Point(v[0], v[1]));
+            break;
+        case Op::DrawShape:
+            ctx.DrawShape(*static_cast<Shape*>(cmd.resource.Get()));
+            break;
+        case Op::DrawLine:
+            ctx.DrawLine(Point(v[0], v[1]), Point(v[2], v[3]));
+            break;
+        case Op::DrawRectangle:
+            ctx.DrawRectangle(LoadRect(v));
+            break;
+        case Op::DrawRoundedRectangle:
+            ctx.DrawRoundedRectangle(LoadRect(v), Vec2(v[4], v[5]));
+            break;
+        case Op::DrawEllipse:
+            ctx.DrawEllipse(Point(v[0], v[1]), Vec2(v[2], v[3]));
+            break;
+        case Op::FillShape:
+            ctx.FillShape(*static_cast<Shape*>(cmd.resource.Get()));
+            break;
+        case Op::FillRectangle:
+            ctx.FillRectangle(LoadRect(v));
+            break;
+        case Op::FillRoundedRectangle:
+            ctx.FillRoundedRectangle(LoadRect(v), Vec2(v[4], v[5]));
+            break;
+        case Op::FillEllipse:
+            ctx.FillEllipse(Point(v[0], v[1]), Vec2(v[2], v[3]));
+            break;
+        case Op::PushClipRect:
+            ctx.PushClipRect(LoadRect(v));
+            break;
+        case Op::PopClipRect:
+            ctx.PopClipRect();
+            break;
+        case Op::PushLayer:
+            ctx.PushLayer(*layers_[size_t(v[0])].Get());
+            break;
+        case Op::PopLayer:
+            ctx.PopLayer();
+            break;
+        case Op::Clear:
+            if (cmd.flags & HasValue)
+                ctx.Clear(Color(v[0], v[1], v[2], v[3]));
+            else
+                ctx.Clear();
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+RenderSnapshot::Command& RenderSnapshot::Record(Op op, const RefObject* resource)
+{
+    // A resource that is not held by RefPtr, e.g. a member object, would be deleted when the snapshot releases it
+    KGE_ASSERT((!resource || resource->GetRefCount() > 0) && "Resources drawn in a snapshot must be held by RefPtr");
+
+    commands_.emplace_back();
+
+    Command& cmd = commands_.back();
+    cmd.op       = op;
+    cmd.flags    = 0;
+    cmd.resource = const_cast<RefObject*>(resource);
+    return cmd;
+}
+
+void RenderSnapshot::DrawTexture(const Texture& texture, const Rect* src_rect, const Rect* dest_rect)
+{
+    Command& cmd = Record(Op::DrawTexture, &texture);
+    if (src_rect)
+    {
+        cmd.flags |= HasSourceRect;
+        StoreRect(cmd.values, *src_rect);
+    }
+    if (dest_rect)
+    {
+        cmd.flags |= HasDestRect;
+        StoreRect(cmd.values + 4, *dest_rect);
+    }
+}
+
+void RenderSnapshot::DrawSpriteBatch(const SpriteBatch& batch)
+{
+    if (batches_count_ == batches_.size())
+    {
+        batches_.emplace_back();
+    }
+
+    SpriteBatch& copy = batches_[batches_count_];
+    copy.texture      = batch.texture;
+    copy.items.assign(batch.items.begin(), batch.items.end());
+
+    Command& cmd = Record(Op::DrawSpriteBatch);
+    cmd.values[0] = float(batches_count_++);
+}
+
+void RenderSnapshot::DrawTextLayout(const TextLayout& layout, const Point& offset)
+{
+    Command& cmd  = Record(Op::DrawTextLayout, &layout);
+    cmd.values[0] = offset.x;
+    cmd.values[1] = offset.y;
+}
+
+void RenderSnapshot::DrawShape(const Shape& shape)
+{
+    Record(Op::DrawShape, &shape);
+}
+
+void RenderSnapshot::DrawLine(const Point& point1, const Point& point2)
+{
+    Command& cmd  = Record(Op::DrawLine);
+    cmd.values[0] = point1.x;
+    cmd.values[1] = point1.y;
+    cmd.values[2] = point2.x;
+    cmd.values[3] = point2.y;
+}
+
+void RenderSnapshot::DrawRectangle(const Rect& rect)
+{
+    StoreRect(Record(Op::DrawRectangle).values, rect);
+}
+
+void RenderSnapshot::DrawRoundedRectangle(const Rect& rect, const Vec2& radius)
+{
+    Command& cmd = Record(Op::DrawRoundedRectangle);
+    StoreRect(cmd.values, rect);
+    cmd.values[4] = radius.x;
+    cmd.values[5] = radius.y;
+}
+
+void RenderSnapshot::DrawEllipse(const Point& center, const Vec2& radius)
+{
+    Command& cmd  = Record(Op::DrawEllipse);
+    cmd.values[0] = center.x;
+    cmd.values[1] = center.y;
+    cmd.values[2] = radius.x;
+    cmd.values[3] = radius.y;
+}
+
+void RenderSnapshot::FillShape(const Shape& shape)
+{
+    Record(Op::FillShape, &shape);
+}
+
+void RenderSnapshot::FillRectangle(const Rect& rect)
+{
+    StoreRect(Record(Op::FillRectangle).values, rect);
+}
+
+void RenderSnapshot::FillRoundedRectangle(const Rect& rect, const Vec2& radius)
+{
+    Command& cmd = Record(Op::FillRoundedRectangle);
+    StoreRect(cmd.values, rect);
+    cmd.values[4] = radius.x;
+    cmd.values[5] = radius.y;
+}
+
+void RenderSnapshot::FillEllipse(const Point& center, const Vec2& radius)
+{
+    Command& cmd  = Record(Op::FillEllipse);
+    cmd.values[0] = center.x;
+    cmd.values[1] = center.y;
+    cmd.values[2] = radius.x;
+    cmd.values[3] = radius.y;
+}
+
+void RenderSnapshot::CreateTexture(Texture& texture, math::Vec2T<uint32_t> size)
+{
+    KGE_NOT_USED(texture);
+    KGE_NOT_USED(size);
+    KGE_ASSERT(false && "RenderSnapshot can not create textures");
+}
+
+void RenderSnapshot::PushClipRect(const Rect& clip_rect)
+{
+    StoreRect(Record(Op::PushClipRect).values, clip_rect);
+}
+
+void RenderSnapshot::PopClipRect()
+{
+    Record(Op::PopClipRect);
+}
+
+void RenderSnapshot::PushLayer(Layer& layer)
+{
+    // Layers are usually modified every frame, e.g. during transitions, so the snapshot keeps a copy
+    if (layers_count_ == layers_.size())
+    {
+        layers_.push_back(MakePtr<Layer>());
+    }
+
+    Layer& copy = *layers_[layers_count_];
+    copy.SetClipRect(layer.GetClipRect());
+    copy.SetOpacity(layer.GetOpacity());
+    copy.SetMaskShape(layer.GetMaskShape());
+    copy.SetMaskTransform(layer.GetMaskTransform());
+
+    Command& cmd  = Record(Op::PushLayer);
+    cmd.values[0] = float(layers_count_++);
+}
+
+void RenderSnapshot::PopLayer()
+{
+    Record(Op::PopLayer);
+}
+
+void RenderSnapshot::Clear()
+{
+    Record(Op::Clear);
+}
+
+void RenderSnapshot::Clear(const Color& clear_color)
+{
+    Command& cmd  = Record(Op::Clear);
+    cmd.flags     = HasValue;
+    cmd.values[0] = clear_color.r;
+    cmd.values[1] = clear_color.g;
+    cmd.values[2] = clear_color.b;
+    cmd.values[3] = clear_color.a;
+}
+
+Size RenderSnapshot::GetSize() const
+{
+    return size_;
+}
+
+void RenderSnapshot::SetBrushOpacity(float opacity)
+{
+    RenderContext::SetBrushOpacity(opacity);
+    Record(Op::SetBrushOpacity).values[0] = opacity;
+}
+
+void RenderSnapshot::SetCurrentBrush(BrushPtr brush)
+{
+    RenderContext::SetCurrentBrush(brush);
+    Record(Op::SetBrush, brush.Get());
+}
+
+void RenderSnapshot::SetCurrentStrokeStyle(StrokeStylePtr stroke)
+{
+    RenderContext::SetCurrentStrokeStyle(stroke);
+    Record(Op::SetStrokeStyle, stroke.Get());
+}
+
+void RenderSnapshot::SetAntialiasMode(bool enabled)
+{
+    antialias_ = enabled;
+    Record(Op::SetAntialias).flags = enabled ? HasValue : 0;
+}
+
+void RenderSnapshot::SetTextAntialiasMode(TextAntialiasMode mode)
+{
+    text_antialias_ = mode;
+    Record(Op::SetTextAntialias).values[0] = float(int(mode));
+}
+
+bool RenderSnapshot::CheckVisibility(const Rect& bounds, const Matrix3x2& transform)
+{
+    if (fast_global_transform_)
+    {
+        return visible_size_.Intersects(transform.Transform(bounds));
+    }
+    return visible_size_.Intersects(Matrix3x2(transform * global_transform_).Transform(bounds));
+}
+
+void RenderSnapshot::Resize(const Size& size)
+{
+    size_         = size;
+    visible_size_ = Rect(Point(), size);
+}
+
+void RenderSnapshot::SetTransform(const Matrix3x2& matrix)
+{
+    StoreMatrix(Record(Op::SetTransform).values, matrix);
+}
+
+void RenderSnapshot::SetGlobalTransform(const Matrix3x2* matrix)
+{
+    RenderContext::SetGlobalTransform(matrix);
+
+    Command& cmd = Record(Op::SetGlobalTransform);
+    if (matrix)
+    {
+        cmd.flags = HasValue;
+        StoreMatrix(cmd.values, *matrix);
+    }
+}
+
+}  // namespace kiwano
@@ -0,0 +1,177 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <kiwano/render/RenderContext.h>
+
+namespace kiwano
+{
+
+KGE_DECLARE_SMART_PTR(RenderSnapshot);
+
+/**
+ * \addtogroup Render
+ * @{
+ */
+
+/**
+ * \~chinese
+ * @brief 渲染快照
+ * @details 录制一帧中所有的绘制命令及其变换、透明度、画刷等状态，之后可以在其他线程中将这些命令回放到实际的渲染上下文。
+ * 快照持有命令中用到的纹理、形状、文字布局等资源的引用，回放期间这些资源不会被释放。图层和精灵批次在录制时复制
+ * @note 除图层外快照不会复制资源的内容，被引用的资源需要由 RefPtr 持有，并且在快照被重置前不应原地修改。
+ * TextActor 和 DebugActor 会为此创建新的文字布局，而画布等渲染目标纹理仍然会被原地更新
+ */
+class KGE_API RenderSnapshot : public RenderContext
+{
+public:
+    RenderSnapshot();
+
+    virtual ~RenderSnapshot();
+
+    /// \~chinese
+    /// @brief 清空快照，准备录制新的一帧
+    /// @param target 回放的目标渲染上下文，快照使用它的输出大小和全局变换进行可见性检查
+    void Reset(const RenderContext& target);
+
+    /// \~chinese
+    /// @brief 将录制的命令回放到渲染上下文
+    void Replay(RenderContext& ctx) const;
+
+    /// \~chinese
+    /// @brief 获取录制的命令数量
+    size_t GetCommandCount() const;
+
+    void DrawTexture(const Texture& texture, const Rect* src_rect = nullptr, const Rect* dest_rect = nullptr) override;
+
+    void DrawSpriteBatch(const SpriteBatch& batch) override;
+
+    void DrawTextLayout(const TextLayout& layout, const Point& offset = Point()) override;
+
+    void DrawShape(const Shape& shape) override;
+
+    void DrawLine(const Point& point1, const Point& point2) override;
+
+    void DrawRectangle(const Rect& rect) override;
+
+    void DrawRoundedRectangle(const Rect& rect, const Vec2& radius) override;
+
+    void DrawEllipse(const Point& center, const Vec2& radius) override;
+
+    void FillShape(const Shape& shape) override;
+
+    void FillRectangle(const Rect& rect) override;
+
+    void FillRoundedRectangle(const Rect& rect, const Vec2& radius) override;
+
+    void FillEllipse(const Point& center, const Vec2& radius) override;
+
+    void CreateTexture(Texture& texture, math::Vec2T<uint32_t> size) override;
+
+    void PushClipRect(const Rect& clip_rect) override;
+
+    void PopClipRect() override;
+
+    void PushLayer(Layer& layer) override;
+
+    void PopLayer() override;
+
+    void Clear() override;
+
+    void Clear(const Color& clear_color) override;
+
+    Size GetSize() const override;
+
+    void SetBrushOpacity(float opacity) override;
+
+    void SetCurrentBrush(BrushPtr brush) override;
+
+    void SetCurrentStrokeStyle(StrokeStylePtr stroke) override;
+
+    void SetAntialiasMode(bool enabled) override;
+
+    void SetTextAntialiasMode(TextAntialiasMode mode) override;
+
+    bool CheckVisibility(const Rect& bounds, const Matrix3x2& transform) override;
+
+    void Resize(const Size& size) override;
+
+    void SetTransform(const Matrix3x2& matrix) override;
+
+    void SetGlobalTransform(const Matrix3x2* matrix) override;
+
+    using RenderContext::SetGlobalTransform;
+
+private:
+    enum class Op : uint8_t
+    {
+        SetTransform,
+        SetGlobalTransform,
+        SetBrushOpacity,
+        SetBrush,
+        SetStrokeStyle,
+        SetAntialias,
+        SetTextAntialias,
+        DrawTexture,
+        DrawSpriteBatch,
+        DrawTextLayout,
+        DrawShape,
+        DrawLine,
+        DrawRectangle,
+        DrawRoundedRectangle,
+        DrawEllipse,
+        FillShape,
+        FillRectangle,
+        FillRoundedRectangle,
+        FillEllipse,
+        PushClipRect,
+        PopClipRect,
+        PushLayer,
+        PopLayer,
+        Clear,
+    };
+
+    struct Command
+    {
+        Op                op;
+        uint8_t           flags;
+        float             values[8];
+        RefPtr<RefObject> resource;
+    };
+
+    Command& Record(Op op, const RefObject* resource = nullptr);
+
+private:
+    Size                size_;
+    Vector<Command>     commands_;
+    Vector<SpriteBatch> batches_;
+    size_t              batches_count_;
+    Vector<LayerPtr>    layers_;
+    size_t              layers_count_;
+};
+
+/** @} */
+
+inline size_t RenderSnapshot::GetCommandCount() const
+{
+    return commands_.size();
+}
+
+}  // namespace kiwano
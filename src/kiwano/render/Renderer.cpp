@@ -20,6 +20,7 @@
 
 #include <kiwano/render/Renderer.h>
 #include <kiwano/render/TextureCache.h>
+#include <kiwano/render/TextureLoader.h>
 #include <kiwano/event/WindowEvent.h>
 
 namespace kiwano
@@ -49,6 +50,7 @@ void Renderer::ResetResolutionWhenWindowResized(bool enabled)
 
 void Renderer::Destroy()
 {
+    TextureLoader::GetInstance().Shutdown();
     TextureCache::GetInstance().Clear();
     FontCache::GetInstance().Clear();
 }
@@ -24,6 +24,9 @@
 
 #if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_DIRECTX
 #include <kiwano/render/DirectX/NativePtr.h>
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+#include <kiwano/render/Software/NativePtr.h>
+#include <kiwano/render/Software/Geometry.h>
 #endif
 
 namespace kiwano
@@ -36,6 +39,12 @@ void Shape::Clear()
     ResetNativePointer();
 }
 
+void Shape::ResetNativePointer(void* native_pointer)
+{
+    arc_length_table_ = nullptr;
+    NativeObject::ResetNativePointer(native_pointer);
+}
+
 Rect Shape::GetBoundingBox() const
 {
 #if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_DIRECTX
@@ -47,6 +56,13 @@ Rect Shape::GetBoundingBox() const
         geometry->GetBounds(nullptr, DX::ConvertToRectF(&bounds));
     }
     return bounds;
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    auto geometry = NativePtr::Get<graphics::software::PathGeometry>(this);
+    if (geometry)
+    {
+        return geometry->GetBounds(nullptr);
+    }
+    return Rect();
 #else
     return Rect();  // not supported
 #endif
@@ -63,6 +79,13 @@ Rect Shape::GetBoundingBox(const Matrix3x2& transform) const
         geometry->GetBounds(DX::ConvertToMatrix3x2F(transform), DX::ConvertToRectF(&bounds));
     }
     return bounds;
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    auto geometry = NativePtr::Get<graphics::software::PathGeometry>(this);
+    if (geometry)
+    {
+        return geometry->GetBounds(&transform);
+    }
+    return Rect();
 #else
     return Rect();  // not supported
 #endif
@@ -79,6 +102,13 @@ float Shape::GetLength() const
         geometry->ComputeLength(D2D1::Matrix3x2F::Identity(), &length);
     }
     return length;
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    auto geometry = NativePtr::Get<graphics::software::PathGeometry>(this);
+    if (geometry)
+    {
+        return geometry->ComputeLength();
+    }
+    return 0.0f;
 #else
     return 0.0f;  // not supported
 #endif
@@ -96,11 +126,27 @@ bool Shape::ComputePointAtLength(float length, Point& point, Vec2& tangent) cons
         return SUCCEEDED(hr);
     }
     return false;
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    auto geometry = NativePtr::Get<graphics::software::PathGeometry>(this);
+    if (geometry)
+    {
+        return geometry->ComputePointAtLength(length, point, tangent);
+    }
+    return false;
 #else
     return false;  // not supported
 #endif
 }
 
+ArcLengthTablePtr Shape::GetArcLengthTable(float tolerance) const
+{
+    if (!arc_length_table_ || arc_length_table_->GetTolerance() > tolerance)
+    {
+        arc_length_table_ = ArcLengthTable::Create(*this, tolerance);
+    }
+    return arc_length_table_;
+}
+
 float Shape::ComputeArea() const
 {
 #if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_DIRECTX
@@ -112,6 +158,13 @@ float Shape::ComputeArea() const
         geometry->ComputeArea(D2D1::Matrix3x2F::Identity(), &area);
     }
     return 0.f;
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    auto geometry = NativePtr::Get<graphics::software::PathGeometry>(this);
+    if (geometry)
+    {
+        return geometry->ComputeArea();
+    }
+    return 0.f;
 #else
     return 0.0f;  // not supported
 #endif
@@ -129,6 +182,12 @@ bool Shape::ContainsPoint(const Point& point, const Matrix3x2* transform) const
     geometry->FillContainsPoint(DX::ConvertToPoint2F(point), DX::ConvertToMatrix3x2F(transform),
                             D2D1_DEFAULT_FLATTENING_TOLERANCE, &ret);
     return !!ret;
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    auto geometry = NativePtr::Get<graphics::software::PathGeometry>(this);
+    if (!geometry)
+        return false;
+
+    return geometry->FillContainsPoint(point, transform);
 #else
     return false;  // not supported
 #endif
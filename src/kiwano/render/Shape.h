@@ -20,6 +20,7 @@
 
 #pragma once
 #include <kiwano/render/NativeObject.h>
+#include <kiwano/render/ArcLengthTable.h>
 
 namespace kiwano
 {
@@ -34,7 +35,7 @@ KGE_DECLARE_SMART_PTR(Shape);
 
 /**
  * \~chinese
- * @brief ״
+ * @brief 形状
  */
 class KGE_API Shape : public NativeObject
 {
@@ -42,74 +43,85 @@ class KGE_API Shape : public NativeObject
 
 public:
     /// \~chinese
-    /// @brief ߶״
-    /// @param begin ߶
-    /// @param end ߶յ
+    /// @brief 创建线段形状
+    /// @param begin 线段起点
+    /// @param end 线段终点
     static ShapePtr CreateLine(const Point& begin, const Point& end);
 
     /// \~chinese
-    /// @brief 
-    /// @param rect 
+    /// @brief 创建矩形
+    /// @param rect 矩形
     static ShapePtr CreateRect(const Rect& rect);
 
     /// \~chinese
-    /// @brief ԲǾ
-    /// @param rect 
-    /// @param radius Բǰ뾶
+    /// @brief 创建圆角矩形
+    /// @param rect 矩形
+    /// @param radius 矩形圆角半径
     static ShapePtr CreateRoundedRect(const Rect& rect, const Vec2& radius);
 
     /// \~chinese
-    /// @brief Բ
-    /// @param center Բԭ
-    /// @param radius Բΰ뾶
+    /// @brief 创建圆形
+    /// @param center 圆形原点
+    /// @param radius 圆形半径
     static ShapePtr CreateCircle(const Point& center, float radius);
 
     /// \~chinese
-    /// @brief Բ
-    /// @param center Բԭ
-    /// @param radius Բ뾶
+    /// @brief 创建椭圆形
+    /// @param center 椭圆原点
+    /// @param radius 椭圆半径
     static ShapePtr CreateEllipse(const Point& center, const Vec2& radius);
 
     /// \~chinese
-    /// @brief 
-    /// @param vertices ζ˵㼯
+    /// @brief 创建多边形
+    /// @param vertices 多边形端点集合
     static ShapePtr CreatePolygon(const Vector<Point>& vertices);
 
     Shape();
 
     /// \~chinese
-    /// @brief ȡаΧ
+    /// @brief 获取外切包围盒
     Rect GetBoundingBox() const;
 
     /// \~chinese
-    /// @brief ȡаΧ
-    /// @param transform ά任
+    /// @brief 获取外切包围盒
+    /// @param transform 二维变换
     Rect GetBoundingBox(const Matrix3x2& transform) const;
 
     /// \~chinese
-    /// @brief жͼǷ
-    /// @param point 
-    /// @param transform ӦõϵĶά任
+    /// @brief 判断图形是否包含点
+    /// @param point 点
+    /// @param transform 应用到点上的二维变换
     bool ContainsPoint(const Point& point, const Matrix3x2* transform = nullptr) const;
 
     /// \~chinese
-    /// @brief ȡͼչһֱߵĳ
+    /// @brief 获取图形展开成一条直线的长度
     float GetLength() const;
 
     /// \~chinese
-    /// @brief ͼ
+    /// @brief 计算图形面积
     float ComputeArea() const;
 
     /// \~chinese
-    /// @brief ͼϵλú
-    /// @param[in] length ͼϵλãΧ [0.0 - 1.0]
-    /// @param[out] point λ
-    /// @param[out] tangent 
+    /// @brief 计算图形上点的位置和切线向量
+    /// @param[in] length 点在图形上的位置，范围 [0.0 - 1.0]
+    /// @param[out] point 点的位置
+    /// @param[out] tangent 点的切线向量
     bool ComputePointAtLength(float length, Point& point, Vec2& tangent) const;
 
     /// \~chinese
-    /// @brief ״
+    /// @brief 获取图形的弧长查找表
+    /// @details 查找表在第一次获取时生成并缓存在形状中，容差不大于所需容差的缓存会被复用
+    /// @param tolerance 扁平化容差
+    ArcLengthTablePtr GetArcLengthTable(float tolerance = ArcLengthTable::DEFAULT_TOLERANCE) const;
+
+    /// \~chinese
+    /// @brief 清除形状
     void Clear();
+
+    void ResetNativePointer(void* native_pointer = nullptr) override;
+
+private:
+    mutable ArcLengthTablePtr arc_length_table_;
 };
 
 /** @} */
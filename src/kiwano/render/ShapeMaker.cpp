@@ -23,12 +23,19 @@
 
 #if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_DIRECTX
 #include <kiwano/render/DirectX/NativePtr.h>
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+#include <kiwano/render/Software/NativePtr.h>
+#include <kiwano/render/Software/Geometry.h>
+#include <kiwano/utils/Logger.h>
 #endif
 
 namespace kiwano
 {
 
-ShapeMaker::ShapeMaker() {}
+ShapeMaker::ShapeMaker()
+    : fill_mode_(FillMode::Alternate)
+{
+}
 
 ShapeMaker::~ShapeMaker()
 {
@@ -43,6 +50,7 @@ void ShapeMaker::Clear()
 
 ShapePtr ShapeMaker::GetShape()
 {
+    CloseStream();
     return shape_;
 }
 
@@ -61,23 +69,33 @@ void ShapeMaker::BeginPath(const Point& begin_pos)
 #if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_DIRECTX
     auto native = NativePtr::Get<ID2D1GeometrySink>(this);
     native->BeginFigure(DX::ConvertToPoint2F(begin_pos), D2D1_FIGURE_BEGIN_FILLED);
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    auto native = NativePtr::Get<graphics::software::GeometrySink>(this);
+    native->GetGeometry()->BeginFigure(begin_pos);
 #else
     // not supported
 #endif
 }
 
 void ShapeMaker::EndPath(bool closed)
+{
+    EndFigure(closed);
+    this->CloseStream();
+}
+
+void ShapeMaker::EndFigure(bool closed)
 {
     KGE_ASSERT(IsStreamOpened());
 
 #if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_DIRECTX
     auto native = NativePtr::Get<ID2D1GeometrySink>(this);
     native->EndFigure(closed ? D2D1_FIGURE_END_CLOSED : D2D1_FIGURE_END_OPEN);
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    auto native = NativePtr::Get<graphics::software::GeometrySink>(this);
+    native->GetGeometry()->EndFigure(closed);
 #else
     // not supported
 #endif
-
-    this->CloseStream();
 }
 
 void ShapeMaker::AddLine(const Point& point)
@@ -87,6 +105,9 @@ void ShapeMaker::AddLine(const Point& point)
 #if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_DIRECTX
     auto native = NativePtr::Get<ID2D1GeometrySink>(this);
     native->AddLine(DX::ConvertToPoint2F(point));
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    auto native = NativePtr::Get<graphics::software::GeometrySink>(this);
+    native->GetGeometry()->AddLine(point);
 #else
     // not supported
 #endif
@@ -99,6 +120,12 @@ void ShapeMaker::AddLines(const Vector<Point>& points)
 #if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_DIRECTX
     auto native = NativePtr::Get<ID2D1GeometrySink>(this);
     native->AddLines(reinterpret_cast<const D2D_POINT_2F*>(&points[0]), static_cast<uint32_t>(points.size()));
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    auto native = NativePtr::Get<graphics::software::GeometrySink>(this);
+    for (const auto& point : points)
+    {
+        native->GetGeometry()->AddLine(point);
+    }
 #else
     // not supported
 #endif
@@ -111,6 +138,12 @@ void kiwano::ShapeMaker::AddLines(const Point* points, size_t count)
 #if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_DIRECTX
     auto native = NativePtr::Get<ID2D1GeometrySink>(this);
     native->AddLines(reinterpret_cast<const D2D_POINT_2F*>(points), UINT32(count));
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    auto native = NativePtr::Get<graphics::software::GeometrySink>(this);
+    for (size_t i = 0; i < count; ++i)
+    {
+        native->GetGeometry()->AddLine(points[i]);
+    }
 #else
     // not supported
 #endif
@@ -124,6 +157,9 @@ void ShapeMaker::AddBezier(const Point& point1, const Point& point2, const Point
     auto native = NativePtr::Get<ID2D1GeometrySink>(this);
     native->AddBezier(
         D2D1::BezierSegment(DX::ConvertToPoint2F(point1), DX::ConvertToPoint2F(point2), DX::ConvertToPoint2F(point3)));
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    auto native = NativePtr::Get<graphics::software::GeometrySink>(this);
+    native->GetGeometry()->AddBezier(point1, point2, point3);
 #else
     // not supported
 #endif
@@ -138,6 +174,9 @@ void ShapeMaker::AddArc(const Point& point, const Size& radius, float rotation,
     native->AddArc(D2D1::ArcSegment(DX::ConvertToPoint2F(point), DX::ConvertToSizeF(radius), rotation,
                                    clockwise ? D2D1_SWEEP_DIRECTION_CLOCKWISE : D2D1_SWEEP_DIRECTION_COUNTER_CLOCKWISE,
                                    is_small ? D2D1_ARC_SIZE_SMALL : D2D1_ARC_SIZE_LARGE));
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    auto native = NativePtr::Get<graphics::software::GeometrySink>(this);
+    native->GetGeometry()->AddArc(point, radius, rotation, clockwise, is_small);
 #else
     // not supported
 #endif
@@ -160,6 +199,34 @@ ShapePtr ShapeMaker::Combine(ShapePtr shape_a, ShapePtr shape_b, CombineMode mod
 
         KGE_THROW_IF_FAILED(hr, "ID2D1Geometry::CombineWithGeometry failed");
     }
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    if (shape_a && shape_b)
+    {
+        auto geo_a  = NativePtr::Get<graphics::software::PathGeometry>(shape_a);
+        auto geo_b  = NativePtr::Get<graphics::software::PathGeometry>(shape_b);
+        auto native = NativePtr::Get<graphics::software::GeometrySink>(maker);
+
+        if (geo_a && geo_b && native)
+        {
+            // Figures of both shapes are kept as they are and the fill rule decides how they are combined.
+            // That is only exact for the symmetric difference of two even-odd shapes, where the crossing
+            // counts of both shapes add up. Any other combination would depend on the winding of the
+            // figures, so it is rejected instead of being rendered wrong.
+            bool supported = mode == CombineMode::Xor
+                             && geo_a->GetFillMode() == graphics::software::FillMode::Alternate
+                             && geo_b->GetFillMode() == graphics::software::FillMode::Alternate;
+            if (supported)
+            {
+                native->GetGeometry()->SetFillMode(graphics::software::FillMode::Alternate);
+                native->GetGeometry()->Append(*geo_a);
+                native->GetGeometry()->Append(*geo_b, matrix);
+            }
+            else
+            {
+                KGE_WARNF("ShapeMaker::Combine: combine mode %d is not supported by the software renderer", int(mode));
+            }
+        }
+    }
 #else
     // not supported
 #endif
@@ -184,10 +251,20 @@ void ShapeMaker::OpenStream()
         HRESULT hr = geometry->Open(&native);
         if (SUCCEEDED(hr))
         {
+            // The fill mode has to be set before the first figure
+            native->SetFillMode(fill_mode_ == FillMode::Winding ? D2D1_FILL_MODE_WINDING : D2D1_FILL_MODE_ALTERNATE);
             NativePtr::Set(this, native);
         }
         KGE_THROW_IF_FAILED(hr, "ID2D1PathGeometry::Open failed");
     }
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    auto geometry = NativePtr::Get<graphics::software::PathGeometry>(shape_);
+    if (geometry)
+    {
+        geometry->SetFillMode(fill_mode_ == FillMode::Winding ? graphics::software::FillMode::Winding
+                                                              : graphics::software::FillMode::Alternate);
+        NativePtr::Set(this, MakePtr<graphics::software::GeometrySink>(geometry));
+    }
 #else
     // not supported
 #endif
@@ -204,6 +281,8 @@ void ShapeMaker::CloseStream()
     HRESULT hr = native->Close();
     KGE_THROW_IF_FAILED(hr, "ID2D1PathGeometry::Close failed");
 
+    ResetNativePointer();
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
     ResetNativePointer();
 #else
     return;  // not supported
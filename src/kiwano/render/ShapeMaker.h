@@ -32,17 +32,25 @@ KGE_DECLARE_SMART_PTR(ShapeMaker);
  */
 
 /// \~chinese
-/// @brief ״ϲʽ
+/// @brief 形状合并方式
 enum class CombineMode
 {
-    Union,      ///<  (A + B)
-    Intersect,  ///<  (A + B)
-    Xor,        ///< ԳƲ ((A - B) + (B - A))
-    Exclude     ///<  (A - B)
+    Union,      ///< 并集 (A + B)
+    Intersect,  ///< 交集 (A + B)
+    Xor,        ///< 对称差集 ((A - B) + (B - A))
+    Exclude     ///< 差集 (A - B)
 };
 
 /// \~chinese
-/// @brief ״
+/// @brief 形状填充规则
+enum class FillMode
+{
+    Alternate,  ///< 奇偶规则，重叠区域交替填充
+    Winding     ///< 非零环绕规则，方向相同的子路径重叠时仍被填充
+};
+
+/// \~chinese
+/// @brief 形状生成器
 class KGE_API ShapeMaker : public NativeObject
 {
 public:
@@ -51,89 +59,116 @@ public:
     ~ShapeMaker();
 
     /// \~chinese
-    /// @brief ȡɵ״
+    /// @brief 获取生成的形状
     ShapePtr GetShape();
 
     /// \~chinese
-    /// @brief ͼ
+    /// @brief 清空图形
     void Clear();
 
     /// \~chinese
-    /// @brief ʼ·
-    /// @param begin_pos ·ʼ
+    /// @brief 设置之后生成的形状的填充规则
+    /// @details 默认为奇偶规则，在下次打开输入流时生效
+    void SetFillMode(FillMode mode);
+
+    /// \~chinese
+    /// @brief 获取填充规则
+    FillMode GetFillMode() const;
+
+    /// \~chinese
+    /// @brief 开始添加路径并打开输入流
+    /// @param begin_pos 路径起始点
     void BeginPath(const Point& begin_pos = Point());
 
     /// \~chinese
-    /// @brief ·ر
-    /// @param closed ·Ƿպ
+    /// @brief 结束路径并关闭输入流
+    /// @param closed 路径是否闭合
     void EndPath(bool closed = false);
 
     /// \~chinese
-    /// @brief һ߶
-    /// @param point ˵
+    /// @brief 结束当前子路径，但不关闭输入流
+    /// @details 之后可以继续调用 BeginPath 向同一个形状中添加子路径，调用 EndPath 或 GetShape 时关闭输入流
+    /// @param closed 子路径是否闭合
+    void EndFigure(bool closed = false);
+
+    /// \~chinese
+    /// @brief 添加一条线段
+    /// @param point 端点
     void AddLine(const Point& point);
 
     /// \~chinese
-    /// @brief Ӷ߶
-    /// @param points ˵㼯
+    /// @brief 添加多条线段
+    /// @param points 端点集合
     void AddLines(const Vector<Point>& points);
 
     /// \~chinese
-    /// @brief Ӷ߶
-    /// @param points ˵
-    /// @param count ˵
+    /// @brief 添加多条线段
+    /// @param points 端点数组
+    /// @param count 端点数量
     void AddLines(const Point* points, size_t count);
 
     /// \~chinese
-    /// @brief һη
-    /// @param point1 ߵĵһƵ
-    /// @param point2 ߵĵڶƵ
-    /// @param point3 ߵյ
+    /// @brief 添加一条三次方贝塞尔曲线
+    /// @param point1 贝塞尔曲线的第一个控制点
+    /// @param point2 贝塞尔曲线的第二个控制点
+    /// @param point3 贝塞尔曲线的终点
     void AddBezier(const Point& point1, const Point& point2, const Point& point3);
 
     /// \~chinese
-    /// @brief ӻ
-    /// @param point յ
-    /// @param radius Բ뾶
-    /// @param rotation ԲתǶ
-    /// @param clockwise ˳ʱ or ʱ
-    /// @param is_small ǷȡС 180 Ļ
+    /// @brief 添加弧线
+    /// @param point 终点
+    /// @param radius 椭圆半径
+    /// @param rotation 椭圆旋转角度
+    /// @param clockwise 顺时针 or 逆时针
+    /// @param is_small 是否取小于 180° 的弧
     void AddArc(const Point& point, const Size& radius, float rotation, bool clockwise = true, bool is_small = true);
 
     /// \~chinese
-    /// @brief ϲ״
-    /// @param shape_a ״A
-    /// @param shape_b ״B
-    /// @param mode ϲʽ
-    /// @param matrix Ӧõ״BϵĶά任
-    /// @return غϲ״
+    /// @brief 合并形状
+    /// @param shape_a 输入的形状A
+    /// @param shape_b 输入的形状B
+    /// @param mode 合并方式
+    /// @param matrix 应用到输入形状B上的二维变换
+    /// @return 返回合并后的形状
+    /// @note 软件渲染器只支持两个奇偶填充规则形状的对称差集 (Xor)，其他合并方式会返回空形状
     static ShapePtr Combine(ShapePtr shape_a, ShapePtr shape_b, CombineMode mode, const Matrix3x2* matrix = nullptr);
 
     /// \~chinese
-    /// @brief ɵ״
-    /// @note Ӧϵͳøú
+    /// @brief 设置生成的形状
+    /// @note 应由系统调用该函数
     void SetShape(ShapePtr shape);
 
 private:
     /// \~chinese
-    /// @brief 
-    /// @note Ӧϵͳøú
+    /// @brief 打开输入流
+    /// @note 应由系统调用该函数
     void OpenStream();
 
     /// \~chinese
-    /// @brief ر
-    /// @note Ӧϵͳøú
+    /// @brief 关闭输入流
+    /// @note 应由系统调用该函数
     void CloseStream();
 
     /// \~chinese
-    /// @brief ǷѾ
-    /// @note Ӧϵͳøú
+    /// @brief 输入流是否已经打开
+    /// @note 应由系统调用该函数
     bool IsStreamOpened() const;
 
 private:
+    FillMode fill_mode_;
     ShapePtr shape_;
 };
 
+inline void ShapeMaker::SetFillMode(FillMode mode)
+{
+    fill_mode_ = mode;
+}
+
+inline FillMode ShapeMaker::GetFillMode() const
+{
+    return fill_mode_;
+}
+
 /** @} */
 
 }  // namespace kiwano
@@ -0,0 +1,566 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <kiwano/render/Software/Bitmap.h>
+
+#if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+
+#include <kiwano/utils/Logger.h>
+#include <kiwano/render/Software/Inflate.h>
+#include <fstream>
+#include <cstring>
+#include <algorithm>
+
+namespace kiwano
+{
+namespace graphics
+{
+namespace software
+{
+
+namespace
+{
+
+inline uint32_t ReadU16(const uint8_t* p)
+{
+    return uint32_t(p[0]) | (uint32_t(p[1]) << 8);
+}
+
+inline uint32_t ReadU32(const uint8_t* p)
+{
+    return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+}
+
+inline uint32_t ReadU16BE(const uint8_t* p)
+{
+    return (uint32_t(p[0]) << 8) | uint32_t(p[1]);
+}
+
+inline uint32_t ReadU32BE(const uint8_t* p)
+{
+    return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+}
+
+inline void WriteU16(uint8_t* p, uint32_t v)
+{
+    p[0] = uint8_t(v);
+    p[1] = uint8_t(v >> 8);
+}
+
+inline void WriteU32(uint8_t* p, uint32_t v)
+{
+    p[0] = uint8_t(v);
+    p[1] = uint8_t(v >> 8);
+    p[2] = uint8_t(v >> 16);
+    p[3] = uint8_t(v >> 24);
+}
+
+inline uint8_t ToByte(float value)
+{
+    if (value <= 0.f)
+        return 0;
+    if (value >= 1.f)
+        return 255;
+    return uint8_t(value * 255.f + 0.5f);
+}
+
+inline uint32_t Premultiply(uint32_t a, uint32_t r, uint32_t g, uint32_t b)
+{
+    r = (r * a + 127) / 255;
+    g = (g * a + 127) / 255;
+    b = (b * a + 127) / 255;
+    return (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+const uint8_t kPngSignature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+// Starting points and steps of the seven Adam7 passes, a non-interlaced image is a single pass
+const uint32_t kAdam7[7][4] = {
+    { 0, 0, 8, 8 }, { 4, 0, 8, 8 }, { 0, 4, 4, 8 }, { 2, 0, 4, 4 }, { 0, 2, 2, 4 }, { 1, 0, 2, 2 }, { 0, 1, 1, 2 },
+};
+
+const uint32_t kSinglePass[1][4] = {
+    { 0, 0, 1, 1 },
+};
+
+// Reads the pixels of an unfiltered PNG scanline
+struct PngFormat
+{
+    uint32_t bit_depth;
+    uint32_t color_type;
+    uint32_t channels;
+    bool     has_color_key;
+    uint32_t color_key[3];
+    uint32_t palette_size;
+    uint8_t  palette[256][4];
+
+    size_t GetRowBytes(uint32_t width) const
+    {
+        return (size_t(width) * channels * bit_depth + 7) / 8;
+    }
+
+    uint32_t GetSample(const uint8_t* row, uint32_t index) const
+    {
+        if (bit_depth == 8)
+            return row[index];
+        if (bit_depth == 16)
+            return ReadU16BE(row + size_t(index) * 2);
+
+        const size_t bit = size_t(index) * bit_depth;
+        return (row[bit >> 3] >> (8 - bit_depth - (bit & 7))) & ((1u << bit_depth) - 1);
+    }
+
+    uint32_t ToByte(uint32_t sample) const
+    {
+        if (bit_depth == 16)
+            return sample >> 8;
+        if (bit_depth < 8)
+            return sample * 255 / ((1u << bit_depth) - 1);
+        return sample;
+    }
+
+    uint32_t GetPixel(const uint8_t* row, uint32_t x) const
+    {
+        switch (color_type)
+        {
+        case 0:  // gray
+        {
+            const uint32_t g = GetSample(row, x);
+            const uint32_t v = ToByte(g);
+            return Premultiply((has_color_key && g == color_key[0]) ? 0 : 255, v, v, v);
+        }
+        case 2:  // RGB
+        {
+            const uint32_t r = GetSample(row, x * 3);
+            const uint32_t g = GetSample(row, x * 3 + 1);
+            const uint32_t b = GetSample(row, x * 3 + 2);
+            const bool     transparent = has_color_key && r == color_key[0] && g == color_key[1] && b == color_key[2];
+            return Premultiply(transparent ? 0 : 255, ToByte(r), ToByte(g), ToByte(b));
+        }
+        case 3:  // palette
+        {
+            const uint32_t index = GetSample(row, x);
+            if (index >= palette_size)
+                return 0;
+            const uint8_t* entry = palette[index];
+            return Premultiply(entry[3], entry[0], entry[1], entry[2]);
+        }
+        case 4:  // gray + alpha
+        {
+            const uint32_t v = ToByte(GetSample(row, x * 2));
+            return Premultiply(ToByte(GetSample(row, x * 2 + 1)), v, v, v);
+        }
+        default:  // RGBA
+        {
+            return Premultiply(ToByte(GetSample(row, x * 4 + 3)), ToByte(GetSample(row, x * 4)),
+                               ToByte(GetSample(row, x * 4 + 1)), ToByte(GetSample(row, x * 4 + 2)));
+        }
+        }
+    }
+};
+
+// Reverses the PNG filter of a scanline in place, prior is null for the first row of a pass
+bool UnfilterRow(uint32_t filter, uint8_t* row, const uint8_t* prior, size_t row_bytes, size_t bpp)
+{
+    switch (filter)
+    {
+    case 0:  // None
+        break;
+    case 1:  // Sub
+        for (size_t i = bpp; i < row_bytes; ++i)
+            row[i] += row[i - bpp];
+        break;
+    case 2:  // Up
+        if (prior)
+        {
+            for (size_t i = 0; i < row_bytes; ++i)
+                row[i] += prior[i];
+        }
+        break;
+    case 3:  // Average
+        for (size_t i = 0; i < row_bytes; ++i)
+        {
+            const uint32_t a = i >= bpp ? row[i - bpp] : 0;
+            const uint32_t b = prior ? prior[i] : 0;
+            row[i] += uint8_t((a + b) / 2);
+        }
+        break;
+    case 4:  // Paeth
+        for (size_t i = 0; i < row_bytes; ++i)
+        {
+            const int a  = i >= bpp ? row[i - bpp] : 0;
+            const int b  = prior ? prior[i] : 0;
+            const int c  = (prior && i >= bpp) ? prior[i - bpp] : 0;
+            const int p  = a + b - c;
+            const int pa = std::abs(p - a);
+            const int pb = std::abs(p - b);
+            const int pc = std::abs(p - c);
+            row[i] += uint8_t((pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c));
+        }
+        break;
+    default:
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+uint32_t PackColor(const Color& color)
+{
+    return Premultiply(ToByte(color.a), ToByte(color.r), ToByte(color.g), ToByte(color.b));
+}
+
+Bitmap::Bitmap(uint32_t width, uint32_t height)
+    : width_(0)
+    , height_(0)
+{
+    Resize(width, height);
+}
+
+void Bitmap::Resize(uint32_t width, uint32_t height)
+{
+    width_  = width;
+    height_ = height;
+    pixels_.assign(size_t(width) * height, 0);
+}
+
+void Bitmap::Fill(uint32_t pixel)
+{
+    std::fill(pixels_.begin(), pixels_.end(), pixel);
+}
+
+void Bitmap::Fill(uint32_t pixel, int left, int top, int right, int bottom)
+{
+    left   = std::max(left, 0);
+    top    = std::max(top, 0);
+    right  = std::min(right, int(width_));
+    bottom = std::min(bottom, int(height_));
+
+    for (int y = top; y < bottom; ++y)
+    {
+        uint32_t* row = GetRow(uint32_t(y));
+        std::fill(row + left, row + right, pixel);
+    }
+}
+
+void Bitmap::CopyFrom(const Bitmap& src, int src_left, int src_top, int src_right, int src_bottom, int dest_x,
+                      int dest_y)
+{
+    src_left   = std::max(src_left, 0);
+    src_top    = std::max(src_top, 0);
+    src_right  = std::min(src_right, int(src.width_));
+    src_bottom = std::min(src_bottom, int(src.height_));
+
+    int width  = std::min(src_right - src_left, int(width_) - dest_x);
+    int height = std::min(src_bottom - src_top, int(height_) - dest_y);
+    if (width <= 0 || height <= 0 || dest_x < 0 || dest_y < 0)
+        return;
+
+    for (int y = 0; y < height; ++y)
+    {
+        const uint32_t* src_row = src.GetRow(uint32_t(src_top + y)) + src_left;
+        std::copy(src_row, src_row + width, GetRow(uint32_t(dest_y + y)) + dest_x);
+    }
+}
+
+BitmapPtr Bitmap::Decode(const uint8_t* data, size_t size)
+{
+    if (data && size >= sizeof(kPngSignature) && std::memcmp(data, kPngSignature, sizeof(kPngSignature)) == 0)
+        return DecodePng(data, size);
+
+    if (data && size >= 2 && data[0] == 'B' && data[1] == 'M')
+        return DecodeBmp(data, size);
+
+    KGE_WARNF("Unsupported image format, only PNG and uncompressed BMP are supported by the software renderer");
+    return nullptr;
+}
+
+BitmapPtr Bitmap::DecodePng(const uint8_t* data, size_t size)
+{
+    PngFormat format = {};
+
+    uint32_t        width = 0, height = 0, interlace = 0;
+    bool            has_header = false;
+    Vector<uint8_t> compressed;
+
+    size_t pos = sizeof(kPngSignature);
+    while (size - pos >= 12)
+    {
+        const uint32_t length = ReadU32BE(data + pos);
+        const uint8_t* type   = data + pos + 4;
+        const uint8_t* body   = data + pos + 8;
+        if (length > size - pos - 12)
+            break;
+        pos += size_t(length) + 12;
+
+        if (std::memcmp(type, "IHDR", 4) == 0 && length >= 13)
+        {
+            width             = ReadU32BE(body);
+            height            = ReadU32BE(body + 4);
+            format.bit_depth  = body[8];
+            format.color_type = body[9];
+            interlace         = body[12];
+            has_header        = body[10] == 0 && body[11] == 0;
+        }
+        else if (std::memcmp(type, "PLTE", 4) == 0)
+        {
+            format.palette_size = std::min(length / 3, 256u);
+            for (uint32_t i = 0; i < format.palette_size; ++i)
+            {
+                std::copy(body + i * 3, body + i * 3 + 3, format.palette[i]);
+                format.palette[i][3] = 255;
+            }
+        }
+        else if (std::memcmp(type, "tRNS", 4) == 0)
+        {
+            if (format.color_type == 3)
+            {
+                for (uint32_t i = 0; i < std::min(length, format.palette_size); ++i)
+                    format.palette[i][3] = body[i];
+            }
+            else if (format.color_type == 0 && length >= 2)
+            {
+                format.has_color_key = true;
+                format.color_key[0]  = ReadU16BE(body);
+            }
+            else if (format.color_type == 2 && length >= 6)
+            {
+                format.has_color_key = true;
+                format.color_key[0]  = ReadU16BE(body);
+                format.color_key[1]  = ReadU16BE(body + 2);
+                format.color_key[2]  = ReadU16BE(body + 4);
+            }
+        }
+        else if (std::memcmp(type, "IDAT", 4) == 0)
+        {
+            compressed.insert(compressed.end(), body, body + length);
+        }
+        else if (std::memcmp(type, "IEND", 4) == 0)
+        {
+            break;
+        }
+    }
+
+    const uint32_t depth = format.bit_depth;
+    switch (format.color_type)
+    {
+    case 0:
+        format.channels = (depth == 1 || depth == 2 || depth == 4 || depth == 8 || depth == 16) ? 1 : 0;
+        break;
+    case 2:
+        format.channels = (depth == 8 || depth == 16) ? 3 : 0;
+        break;
+    case 3:
+        format.channels = (depth == 1 || depth == 2 || depth == 4 || depth == 8) && format.palette_size ? 1 : 0;
+        break;
+    case 4:
+        format.channels = (depth == 8 || depth == 16) ? 2 : 0;
+        break;
+    case 6:
+        format.channels = (depth == 8 || depth == 16) ? 4 : 0;
+        break;
+    }
+
+    // Refuse images larger than 64M pixels rather than trying to allocate them
+    if (!has_header || !format.channels || interlace > 1 || width == 0 || height == 0
+        || uint64_t(width) * height > (uint64_t(1) << 26))
+    {
+        KGE_WARNF("Unsupported or corrupted PNG image (%ux%u, bit depth %u, color type %u)", width, height, depth,
+                  format.color_type);
+        return nullptr;
+    }
+
+    const auto*  passes     = interlace ? kAdam7 : kSinglePass;
+    const size_t pass_count = interlace ? 7 : 1;
+
+    // Every scanline is prefixed with its filter type byte
+    size_t expected_size = 0;
+    for (size_t i = 0; i < pass_count; ++i)
+    {
+        if (width <= passes[i][0] || height <= passes[i][1])
+            continue;
+
+        const uint32_t pass_width  = (width - passes[i][0] + passes[i][2] - 1) / passes[i][2];
+        const uint32_t pass_height = (height - passes[i][1] + passes[i][3] - 1) / passes[i][3];
+        expected_size += (format.GetRowBytes(pass_width) + 1) * pass_height;
+    }
+
+    Vector<uint8_t> pixels;
+    if (!InflateZlib(compressed.data(), compressed.size(), pixels, expected_size) || pixels.size() != expected_size)
+    {
+        KGE_WARNF("PNG image data is corrupted");
+        return nullptr;
+    }
+
+    const size_t bpp    = std::max<size_t>(1, format.channels * depth / 8);
+    BitmapPtr    bitmap = MakePtr<Bitmap>(width, height);
+    uint8_t*     row    = pixels.data();
+    for (size_t i = 0; i < pass_count; ++i)
+    {
+        if (width <= passes[i][0] || height <= passes[i][1])
+            continue;
+
+        const uint32_t pass_width  = (width - passes[i][0] + passes[i][2] - 1) / passes[i][2];
+        const uint32_t pass_height = (height - passes[i][1] + passes[i][3] - 1) / passes[i][3];
+        const size_t   row_bytes   = format.GetRowBytes(pass_width);
+
+        const uint8_t* prior = nullptr;
+        for (uint32_t y = 0; y < pass_height; ++y, row += row_bytes + 1)
+        {
+            if (!UnfilterRow(row[0], row + 1, prior, row_bytes, bpp))
+            {
+                KGE_WARNF("PNG image data is corrupted");
+                return nullptr;
+            }
+            prior = row + 1;
+
+            uint32_t* dst = bitmap->GetRow(passes[i][1] + y * passes[i][3]);
+            for (uint32_t x = 0; x < pass_width; ++x)
+                dst[passes[i][0] + x * passes[i][2]] = format.GetPixel(row + 1, x);
+        }
+    }
+    return bitmap;
+}
+
+BitmapPtr Bitmap::DecodeBmp(const uint8_t* data, size_t size)
+{
+    // BITMAPFILEHEADER (14 bytes) + BITMAPINFOHEADER (40 bytes)
+    if (size < 54)
+    {
+        KGE_WARNF("BMP data is truncated");
+        return nullptr;
+    }
+
+    const uint32_t offset      = ReadU32(data + 10);
+    const uint32_t header_size = ReadU32(data + 14);
+    const int32_t  width       = int32_t(ReadU32(data + 18));
+    const int32_t  height      = int32_t(ReadU32(data + 22));
+    const uint32_t bit_count   = ReadU16(data + 28);
+    const uint32_t compression = ReadU32(data + 30);
+
+    // BI_RGB = 0, BI_BITFIELDS = 3
+    const bool supported = header_size >= 40 && width > 0 && height != 0 && (bit_count == 24 || bit_count == 32)
+                           && (compression == 0 || (compression == 3 && bit_count == 32));
+    if (!supported)
+    {
+        KGE_WARNF("Unsupported BMP format (bit count %u, compression %u)", bit_count, compression);
+        return nullptr;
+    }
+
+    const bool     bottom_up  = height > 0;
+    const uint32_t w          = uint32_t(width);
+    const uint32_t h          = uint32_t(bottom_up ? height : -height);
+    const uint32_t bpp        = bit_count / 8;
+    const size_t   row_stride = (size_t(w) * bpp + 3) & ~size_t(3);
+
+    if (offset > size || size - offset < row_stride * h)
+    {
+        KGE_WARNF("BMP data is truncated");
+        return nullptr;
+    }
+
+    // 32 bits bitmaps without a BI_BITFIELDS mask carry no alpha channel in theory, but
+    // most tools write straight alpha into the fourth byte anyway
+    bool has_alpha = false;
+    if (bpp == 4)
+    {
+        for (uint32_t y = 0; y < h && !has_alpha; ++y)
+        {
+            const uint8_t* src = data + offset + row_stride * y;
+            for (uint32_t x = 0; x < w; ++x)
+            {
+                if (src[x * 4 + 3] != 0)
+                {
+                    has_alpha = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    BitmapPtr bitmap = MakePtr<Bitmap>(w, h);
+    for (uint32_t y = 0; y < h; ++y)
+    {
+        const uint8_t* src = data + offset + row_stride * (bottom_up ? (h - 1 - y) : y);
+        uint32_t*      dst = bitmap->GetRow(y);
+        for (uint32_t x = 0; x < w; ++x, src += bpp)
+        {
+            uint32_t a = (bpp == 4 && has_alpha) ? src[3] : 255;
+            dst[x]     = Premultiply(a, src[2], src[1], src[0]);
+        }
+    }
+    return bitmap;
+}
+
+bool Bitmap::SaveToFile(const String& file_path) const
+{
+    const uint32_t image_size = width_ * height_ * 4;
+
+    uint8_t header[54] = {};
+    header[0]          = 'B';
+    header[1]          = 'M';
+    WriteU32(header + 2, 54 + image_size);
+    WriteU32(header + 10, 54);
+    WriteU32(header + 14, 40);
+    WriteU32(header + 18, width_);
+    WriteU32(header + 22, uint32_t(-int32_t(height_)));  // top-down
+    WriteU16(header + 26, 1);
+    WriteU16(header + 28, 32);
+    WriteU32(header + 34, image_size);
+
+    std::ofstream ofs(file_path, std::ios::binary);
+    if (!ofs)
+    {
+        KGE_ERRORF("Cannot open file '%s' to save bitmap", file_path.c_str());
+        return false;
+    }
+
+    ofs.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+    // Un-premultiply pixels so that other tools show the expected colors
+    Vector<uint32_t> row(width_);
+    for (uint32_t y = 0; y < height_; ++y)
+    {
+        const uint32_t* src = GetRow(y);
+        for (uint32_t x = 0; x < width_; ++x)
+        {
+            uint32_t p = src[x];
+            uint32_t a = p >> 24;
+            if (a == 0 || a == 255)
+            {
+                row[x] = a ? p : 0;
+                continue;
+            }
+            uint32_t r = std::min(255u, (((p >> 16) & 0xFF) * 255 + a / 2) / a);
+            uint32_t g = std::min(255u, (((p >> 8) & 0xFF) * 255 + a / 2) / a);
+            uint32_t b = std::min(255u, ((p & 0xFF) * 255 + a / 2) / a);
+            row[x]     = (a << 24) | (r << 16) | (g << 8) | b;
+        }
+        ofs.write(reinterpret_cast<const char*>(row.data()), std::streamsize(width_) * 4);
+    }
+    return bool(ofs);
+}
+
+}  // namespace software
+}  // namespace graphics
+}  // namespace kiwano
+
+#endif
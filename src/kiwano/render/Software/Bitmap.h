@@ -0,0 +1,120 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <kiwano/base/RefPtr.h>
+#include <kiwano/render/Color.h>
+
+namespace kiwano
+{
+namespace graphics
+{
+namespace software
+{
+
+KGE_DECLARE_SMART_PTR(Bitmap);
+
+/// \~chinese
+/// @brief 将颜色转换为预乘 alpha 的 ARGB32 像素值
+uint32_t PackColor(const Color& color);
+
+/// \~chinese
+/// @brief 位图
+/// @details 像素以预乘 alpha 的 ARGB32 格式逐行存储，内存布局与 BGRA 字节序一致
+class KGE_API Bitmap : public RefObject
+{
+public:
+    Bitmap(uint32_t width, uint32_t height);
+
+    /// \~chinese
+    /// @brief 从内存数据解码位图
+    /// @details 支持 PNG 格式（包括所有颜色类型、位深度和隔行扫描）以及未压缩的 24/32 位 BMP 格式
+    /// @return 解码失败时返回空指针
+    static BitmapPtr Decode(const uint8_t* data, size_t size);
+
+    /// \~chinese
+    /// @brief 保存为 BMP 文件
+    bool SaveToFile(const String& file_path) const;
+
+    /// \~chinese
+    /// @brief 重设位图大小，原有像素将被清空
+    void Resize(uint32_t width, uint32_t height);
+
+    /// \~chinese
+    /// @brief 以指定像素值填充整个位图
+    void Fill(uint32_t pixel);
+
+    /// \~chinese
+    /// @brief 以指定像素值填充矩形区域，区域超出位图的部分将被忽略
+    void Fill(uint32_t pixel, int left, int top, int right, int bottom);
+
+    /// \~chinese
+    /// @brief 从其他位图中拷贝矩形区域
+    void CopyFrom(const Bitmap& src, int src_left, int src_top, int src_right, int src_bottom, int dest_x, int dest_y);
+
+    uint32_t GetWidth() const;
+
+    uint32_t GetHeight() const;
+
+    uint32_t* GetRow(uint32_t y);
+
+    const uint32_t* GetRow(uint32_t y) const;
+
+    uint32_t GetPixel(uint32_t x, uint32_t y) const;
+
+private:
+    static BitmapPtr DecodePng(const uint8_t* data, size_t size);
+
+    static BitmapPtr DecodeBmp(const uint8_t* data, size_t size);
+
+private:
+    uint32_t         width_;
+    uint32_t         height_;
+    Vector<uint32_t> pixels_;
+};
+
+inline uint32_t Bitmap::GetWidth() const
+{
+    return width_;
+}
+
+inline uint32_t Bitmap::GetHeight() const
+{
+    return height_;
+}
+
+inline uint32_t* Bitmap::GetRow(uint32_t y)
+{
+    return &pixels_[size_t(y) * width_];
+}
+
+inline const uint32_t* Bitmap::GetRow(uint32_t y) const
+{
+    return &pixels_[size_t(y) * width_];
+}
+
+inline uint32_t Bitmap::GetPixel(uint32_t x, uint32_t y) const
+{
+    return pixels_[size_t(y) * width_ + x];
+}
+
+}  // namespace software
+}  // namespace graphics
+}  // namespace kiwano
@@ -0,0 +1,767 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <kiwano/render/Software/Geometry.h>
+
+#if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+
+#include <algorithm>
+#include <cmath>
+
+namespace kiwano
+{
+namespace graphics
+{
+namespace software
+{
+
+namespace
+{
+
+// 4/3 * (sqrt(2) - 1), control point distance of a quarter circle approximated by a cubic bezier
+constexpr float BEZIER_KAPPA = 0.5522847498f;
+
+inline float Dot(const Vec2& a, const Vec2& b)
+{
+    return a.x * b.x + a.y * b.y;
+}
+
+inline float Cross(const Vec2& a, const Vec2& b)
+{
+    return a.x * b.y - a.y * b.x;
+}
+
+inline Vec2 Perp(const Vec2& v)
+{
+    return Vec2(-v.y, v.x);
+}
+
+void FlattenBezier(Point p0, const Point& p1, const Point& p2, const Point& p3, float tolerance,
+                   Vector<Point>& output)
+{
+    // Wang's formula: the number of segments needed to keep the error below tolerance
+    float ddx = std::max(std::abs(p0.x - 2 * p1.x + p2.x), std::abs(p1.x - 2 * p2.x + p3.x));
+    float ddy = std::max(std::abs(p0.y - 2 * p1.y + p2.y), std::abs(p1.y - 2 * p2.y + p3.y));
+    float dd  = std::sqrt(ddx * ddx + ddy * ddy);
+
+    int count = int(std::ceil(std::sqrt(0.75f * dd / tolerance)));
+    count     = std::min(std::max(count, 1), 100);
+
+    for (int i = 1; i < count; ++i)
+    {
+        float t  = float(i) / count;
+        float mt = 1 - t;
+        float a  = mt * mt * mt;
+        float b  = 3 * mt * mt * t;
+        float c  = 3 * mt * t * t;
+        float d  = t * t * t;
+        output.push_back(Point(a * p0.x + b * p1.x + c * p2.x + d * p3.x, a * p0.y + b * p1.y + c * p2.y + d * p3.y));
+    }
+    output.push_back(p3);
+}
+
+float SignedArea(const Vector<Point>& points)
+{
+    float area = 0;
+    for (size_t i = 0, n = points.size(); i < n; ++i)
+    {
+        area += Cross(points[i], points[(i + 1) % n]);
+    }
+    return area * 0.5f;
+}
+
+template <typename _Func>
+void ForEachSegment(const Vector<Polyline>& polylines, bool close_all, _Func&& func)
+{
+    for (const auto& polyline : polylines)
+    {
+        const auto& points = polyline.points;
+        for (size_t i = 1; i < points.size(); ++i)
+        {
+            func(points[i - 1], points[i]);
+        }
+        if ((close_all || polyline.closed) && points.size() > 2)
+        {
+            func(points.back(), points.front());
+        }
+    }
+}
+
+}  // namespace
+
+//
+// PathGeometry
+//
+
+PathGeometry::PathGeometry()
+    : figure_open_(false)
+    , fill_mode_(FillMode::Alternate)
+{
+}
+
+PathGeometryPtr PathGeometry::CreateLine(const Point& begin, const Point& end)
+{
+    PathGeometryPtr geometry = MakePtr<PathGeometry>();
+    geometry->BeginFigure(begin);
+    geometry->AddLine(end);
+    geometry->EndFigure(false);
+    return geometry;
+}
+
+PathGeometryPtr PathGeometry::CreateRect(const Rect& rect)
+{
+    PathGeometryPtr geometry = MakePtr<PathGeometry>();
+    geometry->BeginFigure(rect.GetLeftTop());
+    geometry->AddLine(rect.GetRightTop());
+    geometry->AddLine(rect.GetRightBottom());
+    geometry->AddLine(rect.GetLeftBottom());
+    geometry->EndFigure(true);
+    return geometry;
+}
+
+PathGeometryPtr PathGeometry::CreateRoundedRect(const Rect& rect, const Vec2& radius)
+{
+    float rx = std::min(std::abs(radius.x), rect.GetWidth() / 2);
+    float ry = std::min(std::abs(radius.y), rect.GetHeight() / 2);
+    if (rx <= 0 || ry <= 0)
+        return CreateRect(rect);
+
+    const float l = rect.GetLeft(), t = rect.GetTop(), r = rect.GetRight(), b = rect.GetBottom();
+    const float kx = rx * BEZIER_KAPPA, ky = ry * BEZIER_KAPPA;
+
+    PathGeometryPtr geometry = MakePtr<PathGeometry>();
+    geometry->BeginFigure(Point(l + rx, t));
+    geometry->AddLine(Point(r - rx, t));
+    geometry->AddBezier(Point(r - rx + kx, t), Point(r, t + ry - ky), Point(r, t + ry));
+    geometry->AddLine(Point(r, b - ry));
+    geometry->AddBezier(Point(r, b - ry + ky), Point(r - rx + kx, b), Point(r - rx, b));
+    geometry->AddLine(Point(l + rx, b));
+    geometry->AddBezier(Point(l + rx - kx, b), Point(l, b - ry + ky), Point(l, b - ry));
+    geometry->AddLine(Point(l, t + ry));
+    geometry->AddBezier(Point(l, t + ry - ky), Point(l + rx - kx, t), Point(l + rx, t));
+    geometry->EndFigure(true);
+    return geometry;
+}
+
+PathGeometryPtr PathGeometry::CreateEllipse(const Point& center, const Vec2& radius)
+{
+    const float rx = std::abs(radius.x), ry = std::abs(radius.y);
+    const float kx = rx * BEZIER_KAPPA, ky = ry * BEZIER_KAPPA;
+    const float cx = center.x, cy = center.y;
+
+    PathGeometryPtr geometry = MakePtr<PathGeometry>();
+    geometry->BeginFigure(Point(cx + rx, cy));
+    geometry->AddBezier(Point(cx + rx, cy + ky), Point(cx + kx, cy + ry), Point(cx, cy + ry));
+    geometry->AddBezier(Point(cx - kx, cy + ry), Point(cx - rx, cy + ky), Point(cx - rx, cy));
+    geometry->AddBezier(Point(cx - rx, cy - ky), Point(cx - kx, cy - ry), Point(cx, cy - ry));
+    geometry->AddBezier(Point(cx + kx, cy - ry), Point(cx + rx, cy - ky), Point(cx + rx, cy));
+    geometry->EndFigure(true);
+    return geometry;
+}
+
+void PathGeometry::BeginFigure(const Point& point)
+{
+    if (figure_open_)
+        EndFigure(false);
+
+    commands_.push_back(Command::Begin);
+    points_.push_back(point);
+    figure_open_ = true;
+}
+
+void PathGeometry::AddLine(const Point& point)
+{
+    KGE_ASSERT(figure_open_);
+
+    commands_.push_back(Command::Line);
+    points_.push_back(point);
+}
+
+void PathGeometry::AddBezier(const Point& point1, const Point& point2, const Point& point3)
+{
+    KGE_ASSERT(figure_open_);
+
+    commands_.push_back(Command::Bezier);
+    points_.push_back(point1);
+    points_.push_back(point2);
+    points_.push_back(point3);
+}
+
+void PathGeometry::AddArc(const Point& point, const Size& radius, float rotation, bool clockwise, bool is_small)
+{
+    KGE_ASSERT(figure_open_ && !points_.empty());
+
+    // Convert endpoint parameterization to center parameterization, see SVG 1.1 implementation notes F.6.5
+    const Point start = points_.back();
+    float       rx    = std::abs(radius.x);
+    float       ry    = std::abs(radius.y);
+
+    if (start == point)
+        return;
+
+    if (rx <= 0 || ry <= 0)
+    {
+        AddLine(point);
+        return;
+    }
+
+    const float phi     = math::Degree2Radian(rotation);
+    const float cos_phi = std::cos(phi);
+    const float sin_phi = std::sin(phi);
+
+    const float dx2 = (start.x - point.x) / 2;
+    const float dy2 = (start.y - point.y) / 2;
+    const float x1p = cos_phi * dx2 + sin_phi * dy2;
+    const float y1p = -sin_phi * dx2 + cos_phi * dy2;
+
+    // Scale up radii if they are too small to span the two points
+    float lambda = (x1p * x1p) / (rx * rx) + (y1p * y1p) / (ry * ry);
+    if (lambda > 1)
+    {
+        float scale = std::sqrt(lambda);
+        rx *= scale;
+        ry *= scale;
+    }
+
+    const float rx2 = rx * rx, ry2 = ry * ry;
+    const float num = rx2 * ry2 - rx2 * y1p * y1p - ry2 * x1p * x1p;
+    const float den = rx2 * y1p * y1p + ry2 * x1p * x1p;
+    float       coef = den > 0 ? std::sqrt(std::max(0.f, num / den)) : 0.f;
+    if ((!is_small) == clockwise)
+        coef = -coef;
+
+    const float cxp = coef * rx * y1p / ry;
+    const float cyp = -coef * ry * x1p / rx;
+    const float cx  = cos_phi * cxp - sin_phi * cyp + (start.x + point.x) / 2;
+    const float cy  = sin_phi * cxp + cos_phi * cyp + (start.y + point.y) / 2;
+
+    auto angle = [](float ux, float uy, float vx, float vy) { return std::atan2(ux * vy - uy * vx, ux * vx + uy * vy); };
+
+    const float theta = angle(1, 0, (x1p - cxp) / rx, (y1p - cyp) / ry);
+    float       delta = angle((x1p - cxp) / rx, (y1p - cyp) / ry, (-x1p - cxp) / rx, (-y1p - cyp) / ry);
+    if (clockwise && delta < 0)
+        delta += math::PI_F_X_2;
+    else if (!clockwise && delta > 0)
+        delta -= math::PI_F_X_2;
+
+    auto ellipse_point = [&](float a) {
+        float ca = std::cos(a), sa = std::sin(a);
+        return Point(cx + rx * cos_phi * ca - ry * sin_phi * sa, cy + rx * sin_phi * ca + ry * cos_phi * sa);
+    };
+
+    auto ellipse_derivative = [&](float a) {
+        float ca = std::cos(a), sa = std::sin(a);
+        return Vec2(-rx * cos_phi * sa - ry * sin_phi * ca, -rx * sin_phi * sa + ry * cos_phi * ca);
+    };
+
+    // Split the arc into segments no larger than a quarter turn
+    const int   segments = std::max(1, int(std::ceil(std::abs(delta) / math::PI_F_2 - 0.001f)));
+    const float step     = delta / segments;
+    const float k        = 4.f / 3.f * std::tan(step / 4);
+
+    float a0 = theta;
+    for (int i = 0; i < segments; ++i)
+    {
+        float a1 = a0 + step;
+        Point p0 = ellipse_point(a0);
+        Point p3 = (i == segments - 1) ? point : ellipse_point(a1);
+        AddBezier(p0 + ellipse_derivative(a0) * k, p3 - ellipse_derivative(a1) * k, p3);
+        a0 = a1;
+    }
+}
+
+void PathGeometry::EndFigure(bool closed)
+{
+    if (!figure_open_)
+        return;
+
+    commands_.push_back(closed ? Command::EndClosed : Command::End);
+    figure_open_ = false;
+}
+
+void PathGeometry::Append(const PathGeometry& other, const Matrix3x2* transform)
+{
+    for (auto cmd : other.commands_)
+        commands_.push_back(cmd);
+
+    for (const auto& point : other.points_)
+        points_.push_back(transform ? transform->Transform(point) : point);
+
+    figure_open_ = other.figure_open_;
+}
+
+void PathGeometry::Flatten(const Matrix3x2* transform, float tolerance, Vector<Polyline>& output) const
+{
+    auto map = [=](const Point& point) { return transform ? transform->Transform(point) : point; };
+
+    Polyline* current = nullptr;
+    size_t    index   = 0;
+    for (auto cmd : commands_)
+    {
+        switch (cmd)
+        {
+        case Command::Begin:
+            output.emplace_back();
+            current = &output.back();
+            current->points.push_back(map(points_[index++]));
+            break;
+        case Command::Line:
+            current->points.push_back(map(points_[index++]));
+            break;
+        case Command::Bezier:
+        {
+            Point p0 = current->points.back();
+            FlattenBezier(p0, map(points_[index]), map(points_[index + 1]), map(points_[index + 2]), tolerance,
+                          current->points);
+            index += 3;
+            break;
+        }
+        case Command::End:
+        case Command::EndClosed:
+            current->closed = (cmd == Command::EndClosed);
+            current         = nullptr;
+            break;
+        }
+    }
+}
+
+Rect PathGeometry::GetBounds(const Matrix3x2* transform) const
+{
+    Vector<Polyline> polylines;
+    Flatten(transform, DEFAULT_FLATTENING_TOLERANCE, polylines);
+
+    bool  empty = true;
+    Point min, max;
+    for (const auto& polyline : polylines)
+    {
+        for (const auto& point : polyline.points)
+        {
+            if (empty)
+            {
+                min = max = point;
+                empty     = false;
+                continue;
+            }
+            min.x = std::min(min.x, point.x);
+            min.y = std::min(min.y, point.y);
+            max.x = std::max(max.x, point.x);
+            max.y = std::max(max.y, point.y);
+        }
+    }
+    return Rect(min, max);
+}
+
+float PathGeometry::ComputeLength() const
+{
+    Vector<Polyline> polylines;
+    Flatten(nullptr, DEFAULT_FLATTENING_TOLERANCE, polylines);
+
+    float length = 0;
+    ForEachSegment(polylines, false, [&](const Point& a, const Point& b) { length += (b - a).Length(); });
+    return length;
+}
+
+bool PathGeometry::ComputePointAtLength(float length, Point& point, Vec2& tangent) const
+{
+    Vector<Polyline> polylines;
+    Flatten(nullptr, DEFAULT_FLATTENING_TOLERANCE, polylines);
+
+    bool  found     = false;
+    bool  has_point = false;
+    float remain    = std::max(length, 0.f);
+    ForEachSegment(polylines, false, [&](const Point& a, const Point& b) {
+        if (found)
+            return;
+
+        float seg = (b - a).Length();
+        if (seg <= 0)
+            return;
+
+        tangent   = (b - a) / seg;
+        has_point = true;
+        if (remain <= seg)
+        {
+            point = a + tangent * remain;
+            found = true;
+        }
+        else
+        {
+            point = b;
+            remain -= seg;
+        }
+    });
+    return has_point;
+}
+
+float PathGeometry::ComputeArea() const
+{
+    Vector<Polyline> polylines;
+    Flatten(nullptr, DEFAULT_FLATTENING_TOLERANCE, polylines);
+
+    float area = 0;
+    for (const auto& polyline : polylines)
+    {
+        area += std::abs(SignedArea(polyline.points));
+    }
+    return area;
+}
+
+bool PathGeometry::FillContainsPoint(const Point& point, const Matrix3x2* transform) const
+{
+    Vector<Polyline> polylines;
+    Flatten(transform, DEFAULT_FLATTENING_TOLERANCE, polylines);
+
+    int winding = 0;
+    ForEachSegment(polylines, true, [&](const Point& a, const Point& b) {
+        if (a.y <= point.y)
+        {
+            if (b.y > point.y && Cross(b - a, point - a) > 0)
+                ++winding;
+        }
+        else if (b.y <= point.y && Cross(b - a, point - a) < 0)
+        {
+            --winding;
+        }
+    });
+
+    if (fill_mode_ == FillMode::Alternate)
+        return (winding & 1) != 0;
+    return winding != 0;
+}
+
+//
+// GeometrySink
+//
+
+GeometrySink::GeometrySink(PathGeometryPtr geometry)
+    : geometry_(geometry)
+{
+}
+
+//
+// StrokeStyleData
+//
+
+StrokeStyleData::StrokeStyleData(CapStyle cap, LineJoinStyle line_join, const Vector<float>& dash_array,
+                                 float dash_offset)
+    : cap(cap)
+    , line_join(line_join)
+    , miter_limit(10.0f)
+    , dash_array(dash_array)
+    , dash_offset(dash_offset)
+{
+}
+
+//
+// Stroker
+//
+
+namespace
+{
+
+class Stroker
+{
+public:
+    Stroker(float width, const StrokeStyleData* style, float tolerance, Vector<Polyline>& output)
+        : hw_(width / 2)
+        , cap_(style ? style->cap : CapStyle::Flat)
+        , join_(style ? style->line_join : LineJoinStyle::Miter)
+        , miter_limit_(style ? style->miter_limit : 10.0f)
+        , tolerance_(tolerance)
+        , output_(output)
+    {
+    }
+
+    void Stroke(const Vector<Point>& points, bool closed)
+    {
+        if (points.empty())
+            return;
+
+        if (points.size() == 1)
+        {
+            // Zero length line only shows its caps
+            AddCap(points[0], Vec2(1, 0));
+            AddCap(points[0], Vec2(-1, 0));
+            return;
+        }
+
+        const size_t count    = points.size();
+        const size_t segments = closed ? count : count - 1;
+
+        for (size_t i = 0; i < segments; ++i)
+        {
+            const Point& a = points[i];
+            const Point& b = points[(i + 1) % count];
+
+            Vec2 n = Perp(Direction(a, b)) * hw_;
+            AddPolygon({ a + n, b + n, b - n, a - n });
+        }
+
+        for (size_t i = 1; i < count - 1; ++i)
+        {
+            AddJoin(points[i], Direction(points[i - 1], points[i]), Direction(points[i], points[i + 1]));
+        }
+
+        if (closed)
+        {
+            AddJoin(points[count - 1], Direction(points[count - 2], points[count - 1]),
+                    Direction(points[count - 1], points[0]));
+            AddJoin(points[0], Direction(points[count - 1], points[0]), Direction(points[0], points[1]));
+        }
+        else
+        {
+            AddCap(points[0], -Direction(points[0], points[1]));
+            AddCap(points[count - 1], Direction(points[count - 2], points[count - 1]));
+        }
+    }
+
+private:
+    static Vec2 Direction(const Point& a, const Point& b)
+    {
+        Vec2 d = b - a;
+        return d / d.Length();
+    }
+
+    void AddPolygon(Vector<Point>&& points)
+    {
+        if (SignedArea(points) < 0)
+            std::reverse(points.begin(), points.end());
+
+        output_.emplace_back();
+        output_.back().points = std::move(points);
+        output_.back().closed = true;
+    }
+
+    void AddCircle(const Point& center)
+    {
+        float tolerance = std::min(tolerance_, hw_);
+        float step      = 2 * std::acos(1 - tolerance / hw_);
+        int   count     = std::min(std::max(int(std::ceil(math::PI_F_X_2 / step)), 8), 128);
+
+        Vector<Point> points(count);
+        for (int i = 0; i < count; ++i)
+        {
+            float a   = math::PI_F_X_2 * i / count;
+            points[i] = Point(center.x + hw_ * std::cos(a), center.y + hw_ * std::sin(a));
+        }
+        AddPolygon(std::move(points));
+    }
+
+    void AddCap(const Point& p, const Vec2& dir)
+    {
+        Vec2 n = Perp(dir) * hw_;
+        Vec2 d = dir * hw_;
+        switch (cap_)
+        {
+        case CapStyle::Square:
+            AddPolygon({ p + n, p + n + d, p - n + d, p - n });
+            break;
+        case CapStyle::Round:
+            AddCircle(p);
+            break;
+        case CapStyle::Triangle:
+            AddPolygon({ p + n, p + d, p - n });
+            break;
+        default:
+            break;
+        }
+    }
+
+    void AddJoin(const Point& p, const Vec2& d0, const Vec2& d1)
+    {
+        const float cross = Cross(d0, d1);
+        if (std::abs(cross) < 1e-6f && Dot(d0, d1) > 0)
+            return;
+
+        if (join_ == LineJoinStyle::Round)
+        {
+            AddCircle(p);
+            return;
+        }
+
+        // Only the outer side of the corner needs to be filled
+        const float side = cross > 0 ? -1.f : 1.f;
+        const Vec2  n0   = Perp(d0) * (hw_ * side);
+        const Vec2  n1   = Perp(d1) * (hw_ * side);
+
+        if (join_ == LineJoinStyle::Miter)
+        {
+            Vec2  bisector = n0 + n1;
+            float len      = bisector.Length();
+            if (len > 1e-6f)
+            {
+                float miter = 2 * hw_ * hw_ / len;
+                if (miter <= miter_limit_ * hw_)
+                {
+                    AddPolygon({ p, p + n0, p + bisector * (miter / len), p + n1 });
+                    return;
+                }
+            }
+        }
+        AddPolygon({ p, p + n0, p + n1 });
+    }
+
+private:
+    float             hw_;
+    CapStyle          cap_;
+    LineJoinStyle     join_;
+    float             miter_limit_;
+    float             tolerance_;
+    Vector<Polyline>& output_;
+};
+
+void RemoveDuplicatePoints(const Polyline& input, Vector<Point>& output)
+{
+    output.clear();
+    for (const auto& point : input.points)
+    {
+        if (output.empty() || (point - output.back()).Length() > 1e-5f)
+            output.push_back(point);
+    }
+
+    if (input.closed && output.size() > 1 && (output.front() - output.back()).Length() <= 1e-5f)
+        output.pop_back();
+}
+
+void SplitDashes(const Vector<Point>& points, bool closed, const Vector<float>& pattern, float offset,
+                 Vector<Polyline>& output)
+{
+    float total = 0;
+    for (float dash : pattern)
+        total += dash;
+
+    if (total <= 0)
+        return;
+
+    // Find the phase to start with
+    size_t index  = 0;
+    float  remain = pattern[0];
+    offset        = std::fmod(offset, total);
+    if (offset < 0)
+        offset += total;
+
+    while (offset > 0)
+    {
+        if (offset < remain)
+        {
+            remain -= offset;
+            break;
+        }
+        offset -= remain;
+        index  = (index + 1) % pattern.size();
+        remain = pattern[index];
+    }
+
+    bool on = (index % 2) == 0;
+    if (on)
+    {
+        output.emplace_back();
+        output.back().points.push_back(points[0]);
+    }
+
+    const size_t count    = points.size();
+    const size_t segments = closed ? count : count - 1;
+    for (size_t i = 0; i < segments; ++i)
+    {
+        Point a   = points[i];
+        Point b   = points[(i + 1) % count];
+        float len = (b - a).Length();
+        Vec2  dir = (b - a) / len;
+
+        while (len > 0)
+        {
+            float step = std::min(remain, len);
+            a          = a + dir * step;
+            len -= step;
+            remain -= step;
+
+            if (on)
+                output.back().points.push_back(a);
+
+            if (remain <= 0)
+            {
+                index  = (index + 1) % pattern.size();
+                remain = pattern[index];
+                on     = (index % 2) == 0;
+                if (on)
+                {
+                    output.emplace_back();
+                    output.back().points.push_back(a);
+                }
+            }
+        }
+    }
+}
+
+}  // namespace
+
+void StrokePolylines(const Vector<Polyline>& input, float width, const StrokeStyleData* style, float tolerance,
+                     Vector<Polyline>& output)
+{
+    if (width <= 0)
+        return;
+
+    Stroker       stroker(width, style, tolerance, output);
+    Vector<Point> points;
+
+    Vector<float> pattern;
+    if (style && !style->dash_array.empty())
+    {
+        // Dash lengths are in units of the stroke width
+        pattern.reserve(style->dash_array.size() * 2);
+        for (float dash : style->dash_array)
+            pattern.push_back(std::max(dash, 0.f) * width);
+
+        if (pattern.size() % 2)
+        {
+            Vector<float> copy = pattern;
+            pattern.insert(pattern.end(), copy.begin(), copy.end());
+        }
+    }
+
+    for (const auto& polyline : input)
+    {
+        RemoveDuplicatePoints(polyline, points);
+        if (points.empty())
+            continue;
+
+        if (pattern.empty() || points.size() < 2)
+        {
+            stroker.Stroke(points, polyline.closed && points.size() > 2);
+            continue;
+        }
+
+        Vector<Polyline> dashes;
+        SplitDashes(points, polyline.closed, pattern, style->dash_offset * width, dashes);
+
+        Vector<Point> dash_points;
+        for (const auto& dash : dashes)
+        {
+            RemoveDuplicatePoints(dash, dash_points);
+            stroker.Stroke(dash_points, false);
+        }
+    }
+}
+
+}  // namespace software
+}  // namespace graphics
+}  // namespace kiwano
+
+#endif
@@ -0,0 +1,186 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <kiwano/base/RefPtr.h>
+#include <kiwano/math/Math.h>
+#include <kiwano/render/StrokeStyle.h>
+
+namespace kiwano
+{
+namespace graphics
+{
+namespace software
+{
+
+KGE_DECLARE_SMART_PTR(PathGeometry);
+KGE_DECLARE_SMART_PTR(GeometrySink);
+KGE_DECLARE_SMART_PTR(StrokeStyleData);
+
+/// \~chinese
+/// @brief 默认的曲线扁平化容差（像素）
+constexpr float DEFAULT_FLATTENING_TOLERANCE = 0.25f;
+
+/// \~chinese
+/// @brief 填充规则
+enum class FillMode
+{
+    Alternate,  ///< 奇偶规则
+    Winding     ///< 非零环绕规则
+};
+
+/// \~chinese
+/// @brief 折线，由曲线扁平化得到
+struct Polyline
+{
+    Vector<Point> points;
+    bool          closed = false;
+};
+
+/// \~chinese
+/// @brief 路径几何
+/// @details 保存直线与三次贝塞尔曲线段，椭圆弧在添加时被转换为贝塞尔曲线
+class KGE_API PathGeometry : public RefObject
+{
+public:
+    PathGeometry();
+
+    static PathGeometryPtr CreateLine(const Point& begin, const Point& end);
+
+    static PathGeometryPtr CreateRect(const Rect& rect);
+
+    static PathGeometryPtr CreateRoundedRect(const Rect& rect, const Vec2& radius);
+
+    static PathGeometryPtr CreateEllipse(const Point& center, const Vec2& radius);
+
+    void BeginFigure(const Point& point);
+
+    void AddLine(const Point& point);
+
+    void AddBezier(const Point& point1, const Point& point2, const Point& point3);
+
+    void AddArc(const Point& point, const Size& radius, float rotation, bool clockwise, bool is_small);
+
+    void EndFigure(bool closed);
+
+    /// \~chinese
+    /// @brief 追加其他几何的所有图形
+    void Append(const PathGeometry& other, const Matrix3x2* transform = nullptr);
+
+    bool IsEmpty() const;
+
+    FillMode GetFillMode() const;
+
+    void SetFillMode(FillMode mode);
+
+    /// \~chinese
+    /// @brief 将几何扁平化为折线
+    /// @param transform 变换矩阵，可以为空
+    /// @param tolerance 扁平化容差，变换后的坐标系中的最大误差
+    /// @param output 输出的折线，追加到末尾
+    void Flatten(const Matrix3x2* transform, float tolerance, Vector<Polyline>& output) const;
+
+    Rect GetBounds(const Matrix3x2* transform) const;
+
+    float ComputeLength() const;
+
+    bool ComputePointAtLength(float length, Point& point, Vec2& tangent) const;
+
+    float ComputeArea() const;
+
+    bool FillContainsPoint(const Point& point, const Matrix3x2* transform) const;
+
+private:
+    enum class Command : uint8_t
+    {
+        Begin,
+        Line,
+        Bezier,
+        End,
+        EndClosed,
+    };
+
+    bool            figure_open_;
+    FillMode        fill_mode_;
+    Vector<Command> commands_;
+    Vector<Point>   points_;
+};
+
+/// \~chinese
+/// @brief 几何生成器，向路径几何中写入图形
+class KGE_API GeometrySink : public RefObject
+{
+public:
+    GeometrySink(PathGeometryPtr geometry);
+
+    PathGeometry* GetGeometry() const;
+
+private:
+    PathGeometryPtr geometry_;
+};
+
+/// \~chinese
+/// @brief 线条样式数据
+class KGE_API StrokeStyleData : public RefObject
+{
+public:
+    StrokeStyleData(CapStyle cap, LineJoinStyle line_join, const Vector<float>& dash_array, float dash_offset);
+
+    CapStyle      cap;
+    LineJoinStyle line_join;
+    float         miter_limit;
+    Vector<float> dash_array;
+    float         dash_offset;
+};
+
+/// \~chinese
+/// @brief 计算折线描边后的轮廓
+/// @details 输出的多边形方向一致，需使用非零环绕规则填充
+/// @param input 需要描边的折线
+/// @param width 线条宽度
+/// @param style 线条样式，为空时使用实线、扁端点和斜切交点
+/// @param tolerance 圆角扁平化容差
+/// @param output 输出的多边形，追加到末尾
+void StrokePolylines(const Vector<Polyline>& input, float width, const StrokeStyleData* style, float tolerance,
+                     Vector<Polyline>& output);
+
+inline bool PathGeometry::IsEmpty() const
+{
+    return commands_.empty();
+}
+
+inline FillMode PathGeometry::GetFillMode() const
+{
+    return fill_mode_;
+}
+
+inline void PathGeometry::SetFillMode(FillMode mode)
+{
+    fill_mode_ = mode;
+}
+
+inline PathGeometry* GeometrySink::GetGeometry() const
+{
+    return geometry_.Get();
+}
+
+}  // namespace software
+}  // namespace graphics
+}  // namespace kiwano
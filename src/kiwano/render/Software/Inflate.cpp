@@ -0,0 +1,395 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <kiwano/render/Software/Inflate.h>
+
+#if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+
+#include <algorithm>
+
+namespace kiwano
+{
+namespace graphics
+{
+namespace software
+{
+
+namespace
+{
+
+const int kMaxBits      = 15;
+const int kMaxLitCodes  = 288;
+const int kMaxDistCodes = 30;
+
+const uint16_t kLengthBase[29] = { 3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+                                   31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+
+const uint8_t kLengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                   2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+
+const uint16_t kDistBase[30] = { 1,   2,   3,   4,   5,   7,    9,    13,   17,   25,   33,   49,   65,    97,    129,
+                                 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+
+const uint8_t kDistExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+                                 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+const uint8_t kCodeLengthOrder[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+// Canonical Huffman table: number of codes of each length, and the symbols ordered by code
+struct Huffman
+{
+    uint16_t count[kMaxBits + 1];
+    uint16_t symbol[kMaxLitCodes];
+
+    // Returns false for an over-subscribed code. Incomplete codes are allowed, decoding
+    // a missing code fails instead
+    bool Build(const uint8_t* lengths, int n)
+    {
+        std::fill(count, count + kMaxBits + 1, uint16_t(0));
+        for (int i = 0; i < n; ++i)
+            ++count[lengths[i]];
+
+        int left = 1;
+        for (int len = 1; len <= kMaxBits; ++len)
+        {
+            left <<= 1;
+            left -= count[len];
+            if (left < 0)
+                return false;
+        }
+
+        uint16_t offsets[kMaxBits + 1];
+        offsets[1] = 0;
+        for (int len = 1; len < kMaxBits; ++len)
+            offsets[len + 1] = offsets[len] + count[len];
+
+        for (int i = 0; i < n; ++i)
+        {
+            if (lengths[i] != 0)
+                symbol[offsets[lengths[i]]++] = uint16_t(i);
+        }
+        return true;
+    }
+};
+
+class Inflater
+{
+public:
+    Inflater(const uint8_t* data, size_t size, Vector<uint8_t>& output, size_t max_size)
+        : data_(data)
+        , size_(size)
+        , pos_(0)
+        , bit_buf_(0)
+        , bit_count_(0)
+        , failed_(false)
+        , output_(output)
+        , max_size_(max_size)
+    {
+    }
+
+    bool Run()
+    {
+        int last = 0;
+        while (!last && !failed_)
+        {
+            last     = Bits(1);
+            int type = Bits(2);
+            switch (type)
+            {
+            case 0:
+                Stored();
+                break;
+            case 1:
+                Fixed();
+                break;
+            case 2:
+                Dynamic();
+                break;
+            default:
+                failed_ = true;
+                break;
+            }
+        }
+        return !failed_;
+    }
+
+private:
+    int Bits(int need)
+    {
+        uint32_t value = bit_buf_;
+        while (bit_count_ < need)
+        {
+            if (pos_ == size_)
+            {
+                failed_ = true;
+                return 0;
+            }
+            value |= uint32_t(data_[pos_++]) << bit_count_;
+            bit_count_ += 8;
+        }
+        bit_buf_ = value >> need;
+        bit_count_ -= need;
+        return int(value & ((1u << need) - 1));
+    }
+
+    int Decode(const Huffman& h)
+    {
+        int code  = 0;
+        int first = 0;
+        int index = 0;
+        for (int len = 1; len <= kMaxBits; ++len)
+        {
+            code |= Bits(1);
+            if (failed_)
+                return -1;
+
+            int count = h.count[len];
+            if (code - count < first)
+                return h.symbol[index + (code - first)];
+
+            index += count;
+            first += count;
+            first <<= 1;
+            code <<= 1;
+        }
+        failed_ = true;
+        return -1;
+    }
+
+    void Stored()
+    {
+        bit_buf_   = 0;
+        bit_count_ = 0;
+
+        if (size_ - pos_ < 4)
+        {
+            failed_ = true;
+            return;
+        }
+
+        uint32_t len  = uint32_t(data_[pos_]) | (uint32_t(data_[pos_ + 1]) << 8);
+        uint32_t nlen = uint32_t(data_[pos_ + 2]) | (uint32_t(data_[pos_ + 3]) << 8);
+        pos_ += 4;
+
+        if (len != (~nlen & 0xFFFF) || size_ - pos_ < len || max_size_ - output_.size() < len)
+        {
+            failed_ = true;
+            return;
+        }
+        output_.insert(output_.end(), data_ + pos_, data_ + pos_ + len);
+        pos_ += len;
+    }
+
+    void Fixed()
+    {
+        struct FixedCodes
+        {
+            Huffman lit_code;
+            Huffman dist_code;
+
+            FixedCodes()
+            {
+                uint8_t lengths[kMaxLitCodes];
+                std::fill(lengths, lengths + 144, uint8_t(8));
+                std::fill(lengths + 144, lengths + 256, uint8_t(9));
+                std::fill(lengths + 256, lengths + 280, uint8_t(7));
+                std::fill(lengths + 280, lengths + kMaxLitCodes, uint8_t(8));
+                lit_code.Build(lengths, kMaxLitCodes);
+
+                std::fill(lengths, lengths + kMaxDistCodes, uint8_t(5));
+                dist_code.Build(lengths, kMaxDistCodes);
+            }
+        };
+
+        // Images are decoded on loader threads too, a function-local static is initialized only once
+        static const FixedCodes codes;
+        Codes(codes.lit_code, codes.dist_code);
+    }
+
+    void Dynamic()
+    {
+        int nlen  = Bits(5) + 257;
+        int ndist = Bits(5) + 1;
+        int ncode = Bits(4) + 4;
+        if (failed_ || nlen > 286 || ndist > kMaxDistCodes)
+        {
+            failed_ = true;
+            return;
+        }
+
+        uint8_t lengths[kMaxLitCodes + kMaxDistCodes] = {};
+        for (int i = 0; i < ncode; ++i)
+            lengths[kCodeLengthOrder[i]] = uint8_t(Bits(3));
+
+        Huffman len_code;
+        if (failed_ || !len_code.Build(lengths, 19))
+        {
+            failed_ = true;
+            return;
+        }
+
+        int index = 0;
+        while (index < nlen + ndist)
+        {
+            int symbol = Decode(len_code);
+            if (failed_)
+                return;
+
+            if (symbol < 16)
+            {
+                lengths[index++] = uint8_t(symbol);
+                continue;
+            }
+
+            uint8_t len    = 0;
+            int     repeat = 0;
+            if (symbol == 16)
+            {
+                if (index == 0)
+                {
+                    failed_ = true;
+                    return;
+                }
+                len    = lengths[index - 1];
+                repeat = 3 + Bits(2);
+            }
+            else if (symbol == 17)
+            {
+                repeat = 3 + Bits(3);
+            }
+            else
+            {
+                repeat = 11 + Bits(7);
+            }
+
+            if (failed_ || index + repeat > nlen + ndist)
+            {
+                failed_ = true;
+                return;
+            }
+            std::fill(lengths + index, lengths + index + repeat, len);
+            index += repeat;
+        }
+
+        // A block without an end-of-block code can never terminate
+        if (lengths[256] == 0)
+        {
+            failed_ = true;
+            return;
+        }
+
+        Huffman lit_code, dist_code;
+        if (!lit_code.Build(lengths, nlen) || !dist_code.Build(lengths + nlen, ndist))
+        {
+            failed_ = true;
+            return;
+        }
+        Codes(lit_code, dist_code);
+    }
+
+    void Codes(const Huffman& lit_code, const Huffman& dist_code)
+    {
+        while (!failed_)
+        {
+            int symbol = Decode(lit_code);
+            if (failed_)
+                return;
+
+            if (symbol < 256)
+            {
+                if (output_.size() == max_size_)
+                {
+                    failed_ = true;
+                    return;
+                }
+                output_.push_back(uint8_t(symbol));
+                continue;
+            }
+
+            if (symbol == 256)
+                return;
+
+            symbol -= 257;
+            if (symbol >= 29)
+            {
+                failed_ = true;
+                return;
+            }
+            size_t len = kLengthBase[symbol] + Bits(kLengthExtra[symbol]);
+
+            symbol = Decode(dist_code);
+            if (failed_ || symbol >= kMaxDistCodes)
+            {
+                failed_ = true;
+                return;
+            }
+            size_t dist = kDistBase[symbol] + Bits(kDistExtra[symbol]);
+
+            if (failed_ || dist > output_.size() || max_size_ - output_.size() < len)
+            {
+                failed_ = true;
+                return;
+            }
+
+            // The source range may overlap the bytes being written, so copy one by one
+            size_t from = output_.size() - dist;
+            for (size_t i = 0; i < len; ++i)
+                output_.push_back(output_[from + i]);
+        }
+    }
+
+private:
+    const uint8_t*   data_;
+    size_t           size_;
+    size_t           pos_;
+    uint32_t         bit_buf_;
+    int              bit_count_;
+    bool             failed_;
+    Vector<uint8_t>& output_;
+    size_t           max_size_;
+};
+
+}  // namespace
+
+bool InflateZlib(const uint8_t* data, size_t size, Vector<uint8_t>& output, size_t max_size)
+{
+    // CMF and FLG: deflate method, a valid check value and no preset dictionary
+    if (!data || size < 2)
+        return false;
+
+    const uint32_t cmf = data[0];
+    const uint32_t flg = data[1];
+    if ((cmf & 0x0F) != 8 || ((cmf << 8) | flg) % 31 != 0 || (flg & 0x20) != 0)
+        return false;
+
+    if (max_size > output.size())
+        output.reserve(max_size);
+
+    // The Adler-32 trailer is not verified
+    Inflater inflater(data + 2, size - 2, output, max_size);
+    return inflater.Run();
+}
+
+}  // namespace software
+}  // namespace graphics
+}  // namespace kiwano
+
+#endif
@@ -0,0 +1,43 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+#include <kiwano/core/Common.h>
+
+namespace kiwano
+{
+namespace graphics
+{
+namespace software
+{
+
+/// \~chinese
+/// @brief 解压 zlib 格式的数据流 (RFC 1950/1951)
+/// @param data 压缩数据
+/// @param size 压缩数据长度
+/// @param output 解压后的数据，将被追加到末尾
+/// @param max_size 解压后数据的最大长度，超出时视为数据损坏
+/// @return 数据完整且解压成功时返回 true
+bool InflateZlib(const uint8_t* data, size_t size, Vector<uint8_t>& output, size_t max_size);
+
+}  // namespace software
+}  // namespace graphics
+}  // namespace kiwano
@@ -0,0 +1,608 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <kiwano/render/Software/Rasterizer.h>
+
+#if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+
+#include <algorithm>
+#include <cmath>
+
+namespace kiwano
+{
+namespace graphics
+{
+namespace software
+{
+
+namespace
+{
+
+// Multiply all channels of a premultiplied pixel by m / 256
+inline uint32_t MulPixel(uint32_t p, uint32_t m)
+{
+    uint32_t rb = (((p & 0x00FF00FF) * m) >> 8) & 0x00FF00FF;
+    uint32_t ag = (((p >> 8) & 0x00FF00FF) * m) & 0xFF00FF00;
+    return rb | ag;
+}
+
+inline uint32_t LerpPixel(uint32_t a, uint32_t b, uint32_t t)
+{
+    return MulPixel(a, 256 - t) + MulPixel(b, t);
+}
+
+// Source-over blending with an extra coverage factor m (0 ~ 256)
+inline void BlendPixel(uint32_t& dst, uint32_t src, uint32_t m)
+{
+    if (m < 256)
+        src = MulPixel(src, m);
+
+    uint32_t alpha = src >> 24;
+    if (alpha == 255)
+        dst = src;
+    else if (alpha)
+        dst = src + MulPixel(dst, 256 - alpha);
+}
+
+inline uint32_t ToFactor(float value)
+{
+    return uint32_t(std::min(std::max(value, 0.f), 1.f) * 256.f + 0.5f);
+}
+
+inline int ClampToInt(float value)
+{
+    if (value <= -1e9f)
+        return -1000000000;
+    if (value >= 1e9f)
+        return 1000000000;
+    return int(value);
+}
+
+inline float ApplyExtendMode(float t, GradientExtendMode mode)
+{
+    switch (mode)
+    {
+    case GradientExtendMode::Wrap:
+        return t - std::floor(t);
+    case GradientExtendMode::Mirror:
+        t = std::abs(std::fmod(t, 2.f));
+        return t > 1 ? 2 - t : t;
+    default:
+        return std::min(std::max(t, 0.f), 1.f);
+    }
+}
+
+inline uint32_t SampleNearest(const Bitmap& bitmap, const PixelRect& src, float u, float v)
+{
+    int x = std::min(std::max(ClampToInt(std::floor(u)), src.left), src.right - 1);
+    int y = std::min(std::max(ClampToInt(std::floor(v)), src.top), src.bottom - 1);
+    return bitmap.GetPixel(uint32_t(x), uint32_t(y));
+}
+
+inline uint32_t SampleBilinear(const Bitmap& bitmap, const PixelRect& src, float u, float v)
+{
+    u -= 0.5f;
+    v -= 0.5f;
+
+    float fx = std::floor(u);
+    float fy = std::floor(v);
+    int   x0 = ClampToInt(fx);
+    int   y0 = ClampToInt(fy);
+    int   x1 = std::min(std::max(x0 + 1, src.left), src.right - 1);
+    int   y1 = std::min(std::max(y0 + 1, src.top), src.bottom - 1);
+    x0       = std::min(std::max(x0, src.left), src.right - 1);
+    y0       = std::min(std::max(y0, src.top), src.bottom - 1);
+
+    uint32_t tx = uint32_t((u - fx) * 256.f);
+    uint32_t ty = uint32_t((v - fy) * 256.f);
+
+    uint32_t top    = LerpPixel(bitmap.GetPixel(x0, y0), bitmap.GetPixel(x1, y0), tx);
+    uint32_t bottom = LerpPixel(bitmap.GetPixel(x0, y1), bitmap.GetPixel(x1, y1), tx);
+    return LerpPixel(top, bottom, ty);
+}
+
+}  // namespace
+
+//
+// BrushData
+//
+
+BrushData::BrushData(const Color& color)
+    : type(Type::SolidColor)
+    , color(PackColor(color))
+    , extend_mode(GradientExtendMode::Clamp)
+    , interpolation(InterpolationMode::Linear)
+{
+}
+
+BrushData::BrushData(const LinearGradientStyle& style)
+    : type(Type::LinearGradient)
+    , color(0)
+    , begin(style.begin)
+    , end(style.end)
+    , extend_mode(style.extend_mode)
+    , interpolation(InterpolationMode::Linear)
+{
+    BuildGradientLut(style.stops);
+}
+
+BrushData::BrushData(const RadialGradientStyle& style)
+    : type(Type::RadialGradient)
+    , color(0)
+    , center(style.center)
+    , offset(style.offset)
+    , radius(style.radius)
+    , extend_mode(style.extend_mode)
+    , interpolation(InterpolationMode::Linear)
+{
+    BuildGradientLut(style.stops);
+}
+
+BrushData::BrushData(BitmapPtr bitmap, InterpolationMode mode)
+    : type(Type::Bitmap)
+    , color(0)
+    , extend_mode(GradientExtendMode::Clamp)
+    , bitmap(bitmap)
+    , interpolation(mode)
+{
+}
+
+void BrushData::SetColor(const Color& color)
+{
+    this->type  = Type::SolidColor;
+    this->color = PackColor(color);
+}
+
+void BrushData::BuildGradientLut(const Vector<GradientStop>& stops)
+{
+    gradient_lut.assign(256, 0);
+    if (stops.empty())
+        return;
+
+    Vector<GradientStop> sorted = stops;
+    std::stable_sort(sorted.begin(), sorted.end(),
+                     [](const GradientStop& lhs, const GradientStop& rhs) { return lhs.offset < rhs.offset; });
+
+    size_t k = 0;
+    for (int i = 0; i < 256; ++i)
+    {
+        float t = i / 255.f;
+        while (k + 1 < sorted.size() && sorted[k + 1].offset <= t)
+            ++k;
+
+        const GradientStop& a = sorted[k];
+        if (t <= a.offset || k + 1 == sorted.size())
+        {
+            gradient_lut[i] = PackColor(a.color);
+            continue;
+        }
+
+        const GradientStop& b = sorted[k + 1];
+        float               f = (t - a.offset) / (b.offset - a.offset);
+
+        Color c(a.color.r + (b.color.r - a.color.r) * f, a.color.g + (b.color.g - a.color.g) * f,
+                a.color.b + (b.color.b - a.color.b) * f, a.color.a + (b.color.a - a.color.a) * f);
+        gradient_lut[i] = PackColor(c);
+    }
+}
+
+//
+// PixelRect
+//
+
+PixelRect PixelRect::Intersect(const PixelRect& other) const
+{
+    return PixelRect(std::max(left, other.left), std::max(top, other.top), std::min(right, other.right),
+                     std::min(bottom, other.bottom));
+}
+
+PixelRect PixelRect::FromRect(const Rect& rect)
+{
+    return PixelRect(ClampToInt(std::floor(rect.GetLeft())), ClampToInt(std::floor(rect.GetTop())),
+                     ClampToInt(std::ceil(rect.GetRight())), ClampToInt(std::ceil(rect.GetBottom())));
+}
+
+//
+// Rasterizer
+//
+
+Rasterizer::Rasterizer()
+    : stride_(0)
+{
+}
+
+void Rasterizer::FillPolygons(Bitmap& target, const PixelRect& clip, const Vector<Polyline>& polygons, FillMode mode,
+                              bool antialias, const Paint& paint)
+{
+    const bool opaque = paint.brush && paint.brush->type == BrushData::Type::SolidColor
+                        && (paint.brush->color >> 24) == 255 && paint.opacity >= 1.f;
+
+    Rasterize(clip, polygons, mode, antialias, [&](int y, int x, int count, const float* coverage) {
+        uint32_t* dst = target.GetRow(uint32_t(y)) + x;
+
+        if (opaque)
+        {
+            const uint32_t color = paint.brush->color;
+            for (int i = 0; i < count; ++i)
+            {
+                if (coverage[i] >= 1.f)
+                    dst[i] = color;
+                else
+                    BlendPixel(dst[i], color, ToFactor(coverage[i]));
+            }
+            return;
+        }
+
+        colors_.resize(size_t(count));
+        ShadeSpan(paint, x, y, count, colors_.data());
+
+        for (int i = 0; i < count; ++i)
+        {
+            uint32_t m = ToFactor(coverage[i] * paint.opacity);
+            if (m)
+                BlendPixel(dst[i], colors_[i], m);
+        }
+    });
+}
+
+void Rasterizer::Composite(Bitmap& target, const PixelRect& clip, const Bitmap& source, float opacity,
+                           const Vector<Polyline>* mask, FillMode mask_mode, bool antialias)
+{
+    PixelRect area = clip.Intersect(PixelRect(0, 0, int(target.GetWidth()), int(target.GetHeight())))
+                         .Intersect(PixelRect(0, 0, int(source.GetWidth()), int(source.GetHeight())));
+    if (area.IsEmpty())
+        return;
+
+    if (!mask)
+    {
+        const uint32_t m = ToFactor(opacity);
+        if (m == 0)
+            return;
+
+        for (int y = area.top; y < area.bottom; ++y)
+        {
+            const uint32_t* src = source.GetRow(uint32_t(y));
+            uint32_t*       dst = target.GetRow(uint32_t(y));
+            for (int x = area.left; x < area.right; ++x)
+            {
+                BlendPixel(dst[x], src[x], m);
+            }
+        }
+        return;
+    }
+
+    Rasterize(area, *mask, mask_mode, antialias, [&](int y, int x, int count, const float* coverage) {
+        const uint32_t* src = source.GetRow(uint32_t(y)) + x;
+        uint32_t*       dst = target.GetRow(uint32_t(y)) + x;
+        for (int i = 0; i < count; ++i)
+        {
+            uint32_t m = ToFactor(coverage[i] * opacity);
+            if (m)
+                BlendPixel(dst[i], src[i], m);
+        }
+    });
+}
+
+template <typename _Func>
+void Rasterizer::Rasterize(const PixelRect& clip, const Vector<Polyline>& polygons, FillMode mode, bool antialias,
+                           _Func&& func)
+{
+    // Compute bounding box of all polygons
+    bool  empty = true;
+    Point min, max;
+    for (const auto& polygon : polygons)
+    {
+        for (const auto& point : polygon.points)
+        {
+            if (empty)
+            {
+                min = max = point;
+                empty     = false;
+                continue;
+            }
+            min.x = std::min(min.x, point.x);
+            min.y = std::min(min.y, point.y);
+            max.x = std::max(max.x, point.x);
+            max.y = std::max(max.y, point.y);
+        }
+    }
+
+    if (empty)
+        return;
+
+    const PixelRect bounds = PixelRect::FromRect(Rect(min, max)).Intersect(clip);
+    if (bounds.IsEmpty())
+        return;
+
+    const int width  = bounds.right - bounds.left;
+    const int height = bounds.bottom - bounds.top;
+
+    stride_ = width + 2;
+    cells_.assign(size_t(stride_) * height, 0.f);
+    coverage_.resize(size_t(width));
+
+    const Vec2 origin(float(bounds.left), float(bounds.top));
+    for (const auto& polygon : polygons)
+    {
+        const auto& points = polygon.points;
+        for (size_t i = 0, n = points.size(); n > 1 && i < n; ++i)
+        {
+            AddEdge(points[i] - origin, points[(i + 1) % n] - origin, width, height);
+        }
+    }
+
+    for (int y = 0; y < height; ++y)
+    {
+        float* row   = &cells_[size_t(y) * stride_];
+        float  acc   = 0;
+        int    first = width;
+        int    last  = -1;
+
+        for (int x = 0; x < width; ++x)
+        {
+            acc += row[x];
+
+            float c = std::abs(acc);
+            if (mode == FillMode::Alternate)
+            {
+                c = c - 2 * std::floor(c / 2);
+                if (c > 1)
+                    c = 2 - c;
+            }
+            else if (c > 1)
+            {
+                c = 1;
+            }
+
+            if (!antialias)
+                c = c >= 0.5f ? 1.f : 0.f;
+            else if (c < 1.f / 512)
+                c = 0;
+
+            coverage_[x] = c;
+            if (c > 0)
+            {
+                first = std::min(first, x);
+                last  = x;
+            }
+        }
+
+        if (first <= last)
+        {
+            func(bounds.top + y, bounds.left + first, last - first + 1, &coverage_[first]);
+        }
+    }
+}
+
+void Rasterizer::AddEdge(Point a, Point b, int width, int height)
+{
+    if (a.y == b.y || (a.y <= 0 && b.y <= 0) || (a.y >= height && b.y >= height))
+        return;
+
+    // Split the edge where it crosses the left or right border, the parts outside
+    // are clamped to vertical lines on the border so that the winding stays correct
+    const float w = float(width);
+
+    float ts[4] = { 0, 0, 0, 1 };
+    int   count = 1;
+    if (a.x != b.x)
+    {
+        float t0 = (0 - a.x) / (b.x - a.x);
+        float t1 = (w - a.x) / (b.x - a.x);
+        if (t0 > 0 && t0 < 1)
+            ts[count++] = t0;
+        if (t1 > 0 && t1 < 1)
+            ts[count++] = t1;
+    }
+    std::sort(ts + 1, ts + count);
+    ts[count++] = 1;
+
+    Point prev = a;
+    for (int i = 1; i < count; ++i)
+    {
+        Point next = (i == count - 1) ? b : a + (b - a) * ts[i];
+
+        Point p0(std::min(std::max(prev.x, 0.f), w), prev.y);
+        Point p1(std::min(std::max(next.x, 0.f), w), next.y);
+        AddLine(p0, p1, width, height);
+
+        prev = next;
+    }
+}
+
+void Rasterizer::AddLine(const Point& p0, const Point& p1, int width, int height)
+{
+    if (p0.y == p1.y)
+        return;
+
+    float dir = 1.f;
+    Point a = p0, b = p1;
+    if (a.y > b.y)
+    {
+        dir = -1.f;
+        std::swap(a, b);
+    }
+
+    const float w    = float(width);
+    const float dxdy = (b.x - a.x) / (b.y - a.y);
+
+    float x = a.x;
+    if (a.y < 0)
+        x = std::min(std::max(x - a.y * dxdy, 0.f), w);
+
+    const int y0 = std::max(0, int(std::floor(a.y)));
+    const int y1 = std::min(height, int(std::ceil(b.y)));
+
+    for (int y = y0; y < y1; ++y)
+    {
+        float* row   = &cells_[size_t(y) * stride_];
+        float  dy    = std::min(float(y + 1), b.y) - std::max(float(y), a.y);
+        float  xnext = std::min(std::max(x + dxdy * dy, 0.f), w);
+        float  d     = dy * dir;
+
+        float x0 = std::min(x, xnext);
+        float x1 = std::max(x, xnext);
+
+        float x0floor = std::floor(x0);
+        int   x0i     = int(x0floor);
+        float x1ceil  = std::ceil(x1);
+        int   x1i     = int(x1ceil);
+
+        if (x1i <= x0i + 1)
+        {
+            float xmf = 0.5f * (x + xnext) - x0floor;
+            row[x0i] += d - d * xmf;
+            row[x0i + 1] += d * xmf;
+        }
+        else
+        {
+            float s   = 1.f / (x1 - x0);
+            float x0f = x0 - x0floor;
+            float a0  = 0.5f * s * (1 - x0f) * (1 - x0f);
+            float x1f = x1 - x1ceil + 1;
+            float am  = 0.5f * s * x1f * x1f;
+
+            row[x0i] += d * a0;
+            if (x1i == x0i + 2)
+            {
+                row[x0i + 1] += d * (1 - a0 - am);
+            }
+            else
+            {
+                float a1 = s * (1.5f - x0f);
+                row[x0i + 1] += d * (a1 - a0);
+                for (int xi = x0i + 2; xi < x1i - 1; ++xi)
+                {
+                    row[xi] += d * s;
+                }
+                float a2 = a1 + (x1i - x0i - 3) * s;
+                row[x1i - 1] += d * (1 - a2 - am);
+            }
+            row[x1i] += d * am;
+        }
+        x = xnext;
+    }
+}
+
+void Rasterizer::ShadeSpan(const Paint& paint, int x, int y, int count, uint32_t* output) const
+{
+    const Matrix3x2& m  = paint.inverse;
+    const float      py = y + 0.5f;
+
+    if (!paint.brush)
+    {
+        if (!paint.bitmap || paint.source.IsEmpty())
+        {
+            std::fill(output, output + count, 0);
+            return;
+        }
+
+        for (int i = 0; i < count; ++i)
+        {
+            Point p   = m.Transform(Point(x + i + 0.5f, py));
+            output[i] = paint.bilinear ? SampleBilinear(*paint.bitmap, paint.source, p.x, p.y)
+                                       : SampleNearest(*paint.bitmap, paint.source, p.x, p.y);
+        }
+        return;
+    }
+
+    const BrushData& brush = *paint.brush;
+    switch (brush.type)
+    {
+    case BrushData::Type::SolidColor:
+    {
+        std::fill(output, output + count, brush.color);
+        break;
+    }
+    case BrushData::Type::LinearGradient:
+    {
+        const Vec2  axis = brush.end - brush.begin;
+        const float len2 = axis.x * axis.x + axis.y * axis.y;
+        for (int i = 0; i < count; ++i)
+        {
+            Point p   = m.Transform(Point(x + i + 0.5f, py));
+            float t   = len2 > 0 ? ((p.x - brush.begin.x) * axis.x + (p.y - brush.begin.y) * axis.y) / len2 : 0.f;
+            t         = ApplyExtendMode(t, brush.extend_mode);
+            output[i] = brush.gradient_lut[int(t * 255.f + 0.5f)];
+        }
+        break;
+    }
+    case BrushData::Type::RadialGradient:
+    {
+        if (brush.radius.x == 0 || brush.radius.y == 0)
+        {
+            std::fill(output, output + count, brush.gradient_lut.back());
+            break;
+        }
+
+        // Work in the unit circle space, the focus must be inside the circle
+        Vec2  f(brush.offset.x / brush.radius.x, brush.offset.y / brush.radius.y);
+        float f2 = f.x * f.x + f.y * f.y;
+        if (f2 > 0.998f)
+        {
+            f  = f * (0.999f / std::sqrt(f2));
+            f2 = f.x * f.x + f.y * f.y;
+        }
+
+        for (int i = 0; i < count; ++i)
+        {
+            Point p = m.Transform(Point(x + i + 0.5f, py));
+            Vec2  d((p.x - brush.center.x) / brush.radius.x - f.x, (p.y - brush.center.y) / brush.radius.y - f.y);
+
+            float d2 = d.x * d.x + d.y * d.y;
+            float t  = 0;
+            if (d2 > 0)
+            {
+                // Solve |f + s * d| = 1, then t = 1 / s
+                float fd = f.x * d.x + f.y * d.y;
+                float s  = (-fd + std::sqrt(fd * fd - d2 * (f2 - 1))) / d2;
+                t        = 1 / s;
+            }
+            t         = ApplyExtendMode(t, brush.extend_mode);
+            output[i] = brush.gradient_lut[int(t * 255.f + 0.5f)];
+        }
+        break;
+    }
+    case BrushData::Type::Bitmap:
+    {
+        if (!brush.bitmap || brush.bitmap->GetWidth() == 0 || brush.bitmap->GetHeight() == 0)
+        {
+            std::fill(output, output + count, 0);
+            break;
+        }
+
+        const PixelRect source(0, 0, int(brush.bitmap->GetWidth()), int(brush.bitmap->GetHeight()));
+        const bool      bilinear = brush.interpolation == InterpolationMode::Linear;
+        for (int i = 0; i < count; ++i)
+        {
+            Point p   = m.Transform(Point(x + i + 0.5f, py));
+            output[i] = bilinear ? SampleBilinear(*brush.bitmap, source, p.x, p.y)
+                                 : SampleNearest(*brush.bitmap, source, p.x, p.y);
+        }
+        break;
+    }
+    }
+}
+
+}  // namespace software
+}  // namespace graphics
+}  // namespace kiwano
+
+#endif
@@ -0,0 +1,165 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <kiwano/render/Brush.h>
+#include <kiwano/render/Texture.h>
+#include <kiwano/render/Software/Bitmap.h>
+#include <kiwano/render/Software/Geometry.h>
+
+namespace kiwano
+{
+namespace graphics
+{
+namespace software
+{
+
+KGE_DECLARE_SMART_PTR(BrushData);
+
+/// \~chinese
+/// @brief 画刷数据
+class KGE_API BrushData : public RefObject
+{
+public:
+    enum class Type
+    {
+        SolidColor,      ///< 纯色
+        LinearGradient,  ///< 线性渐变
+        RadialGradient,  ///< 径向渐变
+        Bitmap           ///< 位图
+    };
+
+    BrushData(const Color& color);
+
+    BrushData(const LinearGradientStyle& style);
+
+    BrushData(const RadialGradientStyle& style);
+
+    BrushData(BitmapPtr bitmap, InterpolationMode mode);
+
+    void SetColor(const Color& color);
+
+    Type               type;
+    uint32_t           color;
+    Point              begin;
+    Point              end;
+    Point              center;
+    Vec2               offset;
+    Vec2               radius;
+    GradientExtendMode extend_mode;
+    Vector<uint32_t>   gradient_lut;
+    BitmapPtr          bitmap;
+    InterpolationMode  interpolation;
+    Matrix3x2          transform;
+
+private:
+    void BuildGradientLut(const Vector<GradientStop>& stops);
+};
+
+/// \~chinese
+/// @brief 像素区域
+struct PixelRect
+{
+    int left   = 0;
+    int top    = 0;
+    int right  = 0;
+    int bottom = 0;
+
+    PixelRect() = default;
+
+    PixelRect(int left, int top, int right, int bottom);
+
+    bool IsEmpty() const;
+
+    PixelRect Intersect(const PixelRect& other) const;
+
+    /// \~chinese
+    /// @brief 计算矩形的像素包围盒
+    static PixelRect FromRect(const Rect& rect);
+};
+
+/// \~chinese
+/// @brief 单次绘制的颜色来源
+struct Paint
+{
+    const BrushData* brush   = nullptr;  ///< 画刷，为空时使用位图
+    const Bitmap*    bitmap  = nullptr;  ///< 位图
+    PixelRect        source;             ///< 位图采样区域
+    bool             bilinear = true;    ///< 位图双线性插值
+    Matrix3x2        inverse;            ///< 设备坐标到画刷坐标的变换
+    float            opacity = 1.0f;     ///< 不透明度
+};
+
+/// \~chinese
+/// @brief 扫描线光栅化器
+/// @details 使用有符号面积累加计算像素覆盖率，支持抗锯齿和两种填充规则
+class KGE_API Rasterizer
+{
+public:
+    Rasterizer();
+
+    /// \~chinese
+    /// @brief 填充多边形
+    /// @param target 目标位图
+    /// @param clip 裁剪区域
+    /// @param polygons 设备坐标系下的多边形
+    void FillPolygons(Bitmap& target, const PixelRect& clip, const Vector<Polyline>& polygons, FillMode mode,
+                      bool antialias, const Paint& paint);
+
+    /// \~chinese
+    /// @brief 将位图合成到目标位图上
+    /// @param mask 设备坐标系下的蒙版多边形，为空时不使用蒙版
+    void Composite(Bitmap& target, const PixelRect& clip, const Bitmap& source, float opacity,
+                   const Vector<Polyline>* mask, FillMode mask_mode, bool antialias);
+
+private:
+    template <typename _Func>
+    void Rasterize(const PixelRect& clip, const Vector<Polyline>& polygons, FillMode mode, bool antialias,
+                   _Func&& func);
+
+    void AddEdge(Point a, Point b, int width, int height);
+
+    void AddLine(const Point& p0, const Point& p1, int width, int height);
+
+    void ShadeSpan(const Paint& paint, int x, int y, int count, uint32_t* output) const;
+
+private:
+    int              stride_;
+    Vector<float>    cells_;
+    Vector<float>    coverage_;
+    Vector<uint32_t> colors_;
+};
+
+inline PixelRect::PixelRect(int left, int top, int right, int bottom)
+    : left(left)
+    , top(top)
+    , right(right)
+    , bottom(bottom)
+{
+}
+
+inline bool PixelRect::IsEmpty() const
+{
+    return right <= left || bottom <= top;
+}
+
+}  // namespace software
+}  // namespace graphics
+}  // namespace kiwano
@@ -0,0 +1,560 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <kiwano/render/Software/RenderContextImpl.h>
+
+#if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+
+#include <kiwano/render/Software/NativePtr.h>
+#include <kiwano/render/Renderer.h>
+#include <kiwano/utils/Logger.h>
+#include <cmath>
+
+namespace kiwano
+{
+
+using namespace kiwano::graphics::software;
+
+namespace
+{
+
+inline bool IsInfinite(const Rect& rect)
+{
+    const float limit = 1e18f;
+    return rect.GetLeft() <= -limit || rect.GetTop() <= -limit || rect.GetRight() >= limit
+           || rect.GetBottom() >= limit;
+}
+
+}  // namespace
+
+RenderContextImpl::RenderContextImpl() {}
+
+RenderContextImpl::~RenderContextImpl()
+{
+    DiscardDeviceResources();
+}
+
+bool RenderContextImpl::CreateDeviceResources(BitmapPtr target)
+{
+    if (!target)
+        return false;
+
+    target_ = target;
+    current_brush_.Reset();
+
+    SetAntialiasMode(antialias_);
+    SetTextAntialiasMode(text_antialias_);
+
+    Resize(Size(float(target->GetWidth()), float(target->GetHeight())));
+
+    NativePtr::Set(this, target);
+    return true;
+}
+
+void RenderContextImpl::DiscardDeviceResources()
+{
+    target_.Reset();
+    current_brush_.Reset();
+    layer_stack_.clear();
+    layer_pool_.clear();
+
+    ResetNativePointer();
+}
+
+void RenderContextImpl::BeginDraw()
+{
+    KGE_ASSERT(target_ && "Render target has not been initialized!");
+
+    saved_transform_ = transform_;
+
+    RenderContext::BeginDraw();
+}
+
+void RenderContextImpl::EndDraw()
+{
+    KGE_ASSERT(target_ && "Render target has not been initialized!");
+    KGE_ASSERT(clip_stack_.empty() && layer_stack_.empty() && "Unbalanced clip rects or layers!");
+
+    RenderContext::EndDraw();
+
+    transform_ = saved_transform_;
+}
+
+void RenderContextImpl::DrawTexture(const Texture& texture, const Rect* src_rect, const Rect* dest_rect)
+{
+    KGE_ASSERT(target_ && "Render target has not been initialized!");
+
+    auto bitmap = NativePtr::Get<Bitmap>(texture);
+    if (!bitmap)
+        return;
+
+    Rect src  = src_rect ? *src_rect : Rect(0, 0, float(bitmap->GetWidth()), float(bitmap->GetHeight()));
+    Rect dest = dest_rect ? *dest_rect : Rect(Point(), texture.GetSize());
+
+    const bool bilinear = texture.GetBitmapInterpolationMode() == InterpolationMode::Linear;
+    if (DrawBitmap(*bitmap, bilinear, src, dest, transform_, brush_opacity_))
+    {
+        IncreasePrimitivesCount();
+    }
+}
+
+void RenderContextImpl::DrawSpriteBatch(const SpriteBatch& batch)
+{
+    KGE_ASSERT(target_ && "Render target has not been initialized!");
+
+    if (!batch.texture)
+        return;
+
+    // The bitmap is looked up once for the whole batch
+    auto bitmap = NativePtr::Get<Bitmap>(*batch.texture);
+    if (!bitmap)
+        return;
+
+    const bool bilinear = batch.texture->GetBitmapInterpolationMode() == InterpolationMode::Linear;
+
+    uint32_t count = 0;
+    for (const auto& item : batch.items)
+    {
+        const Matrix3x2 transform = fast_global_transform_ ? item.transform : item.transform * global_transform_;
+        if (DrawBitmap(*bitmap, bilinear, item.src_rect, item.dest_rect, transform, item.opacity))
+        {
+            ++count;
+        }
+    }
+
+    if (count)
+    {
+        IncreasePrimitivesCount(count);
+    }
+}
+
+bool RenderContextImpl::DrawBitmap(Bitmap& bitmap, bool bilinear, const Rect& src, const Rect& dest,
+                                   const Matrix3x2& transform, float opacity)
+{
+    if (src.GetWidth() <= 0 || src.GetHeight() <= 0 || dest.GetWidth() <= 0 || dest.GetHeight() <= 0)
+        return false;
+
+    // Map device pixels back to the source bitmap
+    const float sx = dest.GetWidth() / src.GetWidth();
+    const float sy = dest.GetHeight() / src.GetHeight();
+
+    Matrix3x2 src_to_device =
+        Matrix3x2(sx, 0, 0, sy, dest.GetLeft() - src.GetLeft() * sx, dest.GetTop() - src.GetTop() * sy) * transform;
+    if (!src_to_device.IsInvertible())
+        return false;
+
+    Paint paint;
+    paint.bitmap   = &bitmap;
+    paint.source   = PixelRect::FromRect(src).Intersect(PixelRect(0, 0, int(bitmap.GetWidth()), int(bitmap.GetHeight())));
+    paint.bilinear = bilinear;
+    paint.inverse  = src_to_device.Invert();
+    paint.opacity  = opacity;
+
+    polylines_.resize(1);
+    polylines_[0].closed = true;
+    polylines_[0].points = { transform.Transform(dest.GetLeftTop()), transform.Transform(dest.GetRightTop()),
+                             transform.Transform(dest.GetRightBottom()), transform.Transform(dest.GetLeftBottom()) };
+
+    rasterizer_.FillPolygons(GetCurrentTarget(), GetCurrentClip(), polylines_, FillMode::Winding, antialias_, paint);
+    return true;
+}
+
+void RenderContextImpl::DrawTextLayout(const TextLayout& layout, const Point& offset)
+{
+    KGE_ASSERT(target_ && "Render target has not been initialized!");
+
+    // Glyph rasterization is not supported by the software renderer, text layouts
+    // only take part in layout metrics and render status
+    if (layout.IsValid())
+    {
+        IncreasePrimitivesCount();
+    }
+}
+
+void RenderContextImpl::DrawShape(const Shape& shape)
+{
+    KGE_ASSERT(target_ && "Render target has not been initialized!");
+    KGE_ASSERT(current_brush_ && "The brush used for rendering has not been set!");
+
+    auto geometry = NativePtr::Get<PathGeometry>(shape);
+    if (geometry)
+    {
+        StrokeGeometry(*geometry);
+
+        IncreasePrimitivesCount();
+    }
+}
+
+void RenderContextImpl::DrawLine(const Point& point1, const Point& point2)
+{
+    KGE_ASSERT(target_ && "Render target has not been initialized!");
+    KGE_ASSERT(current_brush_ && "The brush used for rendering has not been set!");
+
+    polylines_.resize(1);
+    polylines_[0].closed = false;
+    polylines_[0].points = { point1, point2 };
+    StrokePolylines();
+
+    IncreasePrimitivesCount();
+}
+
+void RenderContextImpl::DrawRectangle(const Rect& rect)
+{
+    KGE_ASSERT(target_ && "Render target has not been initialized!");
+    KGE_ASSERT(current_brush_ && "The brush used for rendering has not been set!");
+
+    polylines_.resize(1);
+    polylines_[0].closed = true;
+    polylines_[0].points = { rect.GetLeftTop(), rect.GetRightTop(), rect.GetRightBottom(), rect.GetLeftBottom() };
+    StrokePolylines();
+
+    IncreasePrimitivesCount();
+}
+
+void RenderContextImpl::DrawRoundedRectangle(const Rect& rect, const Vec2& radius)
+{
+    KGE_ASSERT(target_ && "Render target has not been initialized!");
+    KGE_ASSERT(current_brush_ && "The brush used for rendering has not been set!");
+
+    StrokeGeometry(*PathGeometry::CreateRoundedRect(rect, radius));
+
+    IncreasePrimitivesCount();
+}
+
+void RenderContextImpl::DrawEllipse(const Point& center, const Vec2& radius)
+{
+    KGE_ASSERT(target_ && "Render target has not been initialized!");
+    KGE_ASSERT(current_brush_ && "The brush used for rendering has not been set!");
+
+    StrokeGeometry(*PathGeometry::CreateEllipse(center, radius));
+
+    IncreasePrimitivesCount();
+}
+
+void RenderContextImpl::FillShape(const Shape& shape)
+{
+    KGE_ASSERT(target_ && "Render target has not been initialized!");
+    KGE_ASSERT(current_brush_ && "The brush used for rendering has not been set!");
+
+    auto geometry = NativePtr::Get<PathGeometry>(shape);
+    if (geometry)
+    {
+        FillGeometry(*geometry);
+
+        IncreasePrimitivesCount();
+    }
+}
+
+void RenderContextImpl::FillRectangle(const Rect& rect)
+{
+    KGE_ASSERT(target_ && "Render target has not been initialized!");
+    KGE_ASSERT(current_brush_ && "The brush used for rendering has not been set!");
+
+    polylines_.resize(1);
+    polylines_[0].closed = true;
+    polylines_[0].points = { transform_.Transform(rect.GetLeftTop()), transform_.Transform(rect.GetRightTop()),
+                             transform_.Transform(rect.GetRightBottom()), transform_.Transform(rect.GetLeftBottom()) };
+    FillPolygons(polylines_, FillMode::Winding);
+
+    IncreasePrimitivesCount();
+}
+
+void RenderContextImpl::FillRoundedRectangle(const Rect& rect, const Vec2& radius)
+{
+    KGE_ASSERT(target_ && "Render target has not been initialized!");
+    KGE_ASSERT(current_brush_ && "The brush used for rendering has not been set!");
+
+    FillGeometry(*PathGeometry::CreateRoundedRect(rect, radius));
+
+    IncreasePrimitivesCount();
+}
+
+void RenderContextImpl::FillEllipse(const Point& center, const Vec2& radius)
+{
+    KGE_ASSERT(target_ && "Render target has not been initialized!");
+    KGE_ASSERT(current_brush_ && "The brush used for rendering has not been set!");
+
+    FillGeometry(*PathGeometry::CreateEllipse(center, radius));
+
+    IncreasePrimitivesCount();
+}
+
+void RenderContextImpl::CreateTexture(Texture& texture, math::Vec2T<uint32_t> size)
+{
+    KGE_ASSERT(target_ && "Render target has not been initialized!");
+
+    BitmapPtr bitmap = MakePtr<Bitmap>(size.x, size.y);
+
+    NativePtr::Set(texture, bitmap);
+    texture.SetSize({ float(size.x), float(size.y) });
+    texture.SetSizeInPixels(size);
+}
+
+void RenderContextImpl::PushClipRect(const Rect& clip_rect)
+{
+    KGE_ASSERT(target_ && "Render target has not been initialized!");
+
+    PixelRect clip = GetCurrentClip();
+    if (!IsInfinite(clip_rect))
+    {
+        clip = clip.Intersect(ToPixelRect(transform_.Transform(clip_rect)));
+    }
+    clip_stack_.push_back(clip);
+}
+
+void RenderContextImpl::PopClipRect()
+{
+    KGE_ASSERT(target_ && "Render target has not been initialized!");
+    KGE_ASSERT(!clip_stack_.empty());
+
+    clip_stack_.pop_back();
+}
+
+void RenderContextImpl::PushLayer(Layer& layer)
+{
+    KGE_ASSERT(target_ && "Render target has not been initialized!");
+
+    PixelRect clip = GetCurrentClip();
+    if (!IsInfinite(layer.GetClipRect()))
+    {
+        clip = clip.Intersect(ToPixelRect(transform_.Transform(layer.GetClipRect())));
+    }
+
+    BitmapPtr bitmap;
+    if (!layer_pool_.empty())
+    {
+        bitmap = layer_pool_.back();
+        layer_pool_.pop_back();
+    }
+
+    if (!bitmap)
+    {
+        bitmap = MakePtr<Bitmap>(target_->GetWidth(), target_->GetHeight());
+    }
+    else if (bitmap->GetWidth() != target_->GetWidth() || bitmap->GetHeight() != target_->GetHeight())
+    {
+        bitmap->Resize(target_->GetWidth(), target_->GetHeight());
+    }
+
+    // Only the visible part of the layer needs to be cleared
+    bitmap->Fill(0, clip.left, clip.top, clip.right, clip.bottom);
+
+    LayerData data;
+    data.bitmap    = bitmap;
+    data.opacity   = layer.GetOpacity();
+    data.clip      = clip;
+    data.has_mask  = false;
+    data.mask_mode = FillMode::Winding;
+
+    if (auto mask = NativePtr::Get<PathGeometry>(layer.GetMaskShape()))
+    {
+        Matrix3x2 mask_transform = layer.GetMaskTransform() * transform_;
+        mask->Flatten(&mask_transform, DEFAULT_FLATTENING_TOLERANCE, data.mask);
+
+        data.has_mask  = true;
+        data.mask_mode = mask->GetFillMode();
+    }
+
+    layer_stack_.push_back(std::move(data));
+    clip_stack_.push_back(clip);
+}
+
+void RenderContextImpl::PopLayer()
+{
+    KGE_ASSERT(target_ && "Render target has not been initialized!");
+    KGE_ASSERT(!layer_stack_.empty());
+
+    LayerData data = std::move(layer_stack_.back());
+    layer_stack_.pop_back();
+    clip_stack_.pop_back();
+
+    rasterizer_.Composite(GetCurrentTarget(), data.clip, *data.bitmap, data.opacity,
+                          data.has_mask ? &data.mask : nullptr, data.mask_mode, antialias_);
+
+    layer_pool_.push_back(data.bitmap);
+}
+
+void RenderContextImpl::Clear()
+{
+    Clear(Color::Transparent);
+}
+
+void RenderContextImpl::Clear(const Color& clear_color)
+{
+    KGE_ASSERT(target_ && "Render target has not been initialized!");
+
+    const PixelRect clip = GetCurrentClip();
+    GetCurrentTarget().Fill(PackColor(clear_color), clip.left, clip.top, clip.right, clip.bottom);
+}
+
+Size RenderContextImpl::GetSize() const
+{
+    if (target_)
+    {
+        return Size(float(target_->GetWidth()), float(target_->GetHeight()));
+    }
+    return Size();
+}
+
+void RenderContextImpl::SetCurrentStrokeStyle(StrokeStylePtr stroke_style)
+{
+    RenderContext::SetCurrentStrokeStyle(stroke_style);
+
+    if (current_stroke_ && !current_stroke_->IsValid())
+    {
+        Renderer::GetInstance().CreateStrokeStyle(*current_stroke_);
+    }
+}
+
+void RenderContextImpl::SetTransform(const Matrix3x2& matrix)
+{
+    KGE_ASSERT(target_ && "Render target has not been initialized!");
+
+    if (fast_global_transform_)
+    {
+        transform_ = matrix;
+    }
+    else
+    {
+        transform_ = matrix * global_transform_;
+    }
+}
+
+void RenderContextImpl::SetAntialiasMode(bool enabled)
+{
+    antialias_ = enabled;
+}
+
+void RenderContextImpl::SetTextAntialiasMode(TextAntialiasMode mode)
+{
+    text_antialias_ = mode;
+}
+
+bool RenderContextImpl::CheckVisibility(const Rect& bounds, const Matrix3x2& transform)
+{
+    KGE_ASSERT(target_ && "Render target has not been initialized!");
+
+    if (fast_global_transform_)
+    {
+        return visible_size_.Intersects(transform.Transform(bounds));
+    }
+    return visible_size_.Intersects(Matrix3x2(transform * global_transform_).Transform(bounds));
+}
+
+void RenderContextImpl::Resize(const Size& size)
+{
+    visible_size_ = Rect(Point(), size);
+}
+
+Bitmap& RenderContextImpl::GetCurrentTarget()
+{
+    if (!layer_stack_.empty())
+    {
+        return *layer_stack_.back().bitmap;
+    }
+    return *target_;
+}
+
+PixelRect RenderContextImpl::GetCurrentClip() const
+{
+    if (!clip_stack_.empty())
+    {
+        return clip_stack_.back();
+    }
+    return PixelRect(0, 0, int(target_->GetWidth()), int(target_->GetHeight()));
+}
+
+PixelRect RenderContextImpl::ToPixelRect(const Rect& rect) const
+{
+    // Clip rects are snapped to the nearest pixel edges
+    return PixelRect::FromRect(Rect(std::floor(rect.GetLeft() + 0.5f), std::floor(rect.GetTop() + 0.5f),
+                                    std::floor(rect.GetRight() + 0.5f), std::floor(rect.GetBottom() + 0.5f)));
+}
+
+void RenderContextImpl::FillGeometry(const PathGeometry& geometry)
+{
+    polylines_.clear();
+    geometry.Flatten(&transform_, DEFAULT_FLATTENING_TOLERANCE, polylines_);
+
+    FillPolygons(polylines_, geometry.GetFillMode());
+}
+
+void RenderContextImpl::StrokeGeometry(const PathGeometry& geometry)
+{
+    const float scale = std::sqrt(std::abs(transform_.Determinant()));
+    if (scale <= 0)
+        return;
+
+    polylines_.clear();
+    geometry.Flatten(nullptr, DEFAULT_FLATTENING_TOLERANCE / scale, polylines_);
+    StrokePolylines();
+}
+
+void RenderContextImpl::StrokePolylines()
+{
+    const float scale = std::sqrt(std::abs(transform_.Determinant()));
+    if (scale <= 0)
+        return;
+
+    auto  style        = NativePtr::Get<StrokeStyleData>(current_stroke_);
+    float stroke_width = current_stroke_ ? current_stroke_->GetWidth() : 1.0f;
+
+    // Outlines are computed in local space so that the stroke width is transformed along with the shape
+    stroke_polylines_.clear();
+    graphics::software::StrokePolylines(polylines_, stroke_width, style.Get(), DEFAULT_FLATTENING_TOLERANCE / scale,
+                                        stroke_polylines_);
+
+    for (auto& polygon : stroke_polylines_)
+    {
+        for (auto& point : polygon.points)
+        {
+            point = transform_.Transform(point);
+        }
+    }
+
+    FillPolygons(stroke_polylines_, FillMode::Winding);
+}
+
+void RenderContextImpl::FillPolygons(const Vector<Polyline>& polygons, FillMode mode)
+{
+    auto brush = NativePtr::Get<BrushData>(current_brush_);
+    if (!brush)
+        return;
+
+    Paint paint;
+    paint.brush   = brush.Get();
+    paint.opacity = brush_opacity_;
+
+    if (brush->type != BrushData::Type::SolidColor)
+    {
+        // Brush coordinates are relative to the current transform
+        Matrix3x2 brush_to_device = brush->transform * transform_;
+        if (brush_to_device.IsInvertible())
+        {
+            paint.inverse = brush_to_device.Invert();
+        }
+    }
+
+    rasterizer_.FillPolygons(GetCurrentTarget(), GetCurrentClip(), polygons, mode, antialias_, paint);
+}
+
+}  // namespace kiwano
+
+#endif
@@ -0,0 +1,144 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <kiwano/render/RenderContext.h>
+#include <kiwano/render/Software/Rasterizer.h>
+
+namespace kiwano
+{
+
+KGE_DECLARE_SMART_PTR(RenderContextImpl);
+
+class KGE_API RenderContextImpl : public RenderContext
+{
+public:
+    RenderContextImpl();
+
+    virtual ~RenderContextImpl();
+
+    bool CreateDeviceResources(graphics::software::BitmapPtr target);
+
+    void BeginDraw() override;
+
+    void EndDraw() override;
+
+    void DrawTexture(const Texture& texture, const Rect* src_rect, const Rect* dest_rect) override;
+
+    void DrawSpriteBatch(const SpriteBatch& batch) override;
+
+    void DrawTextLayout(const TextLayout& layout, const Point& offset) override;
+
+    void DrawShape(const Shape& shape) override;
+
+    void DrawLine(const Point& point1, const Point& point2) override;
+
+    void DrawRectangle(const Rect& rect) override;
+
+    void DrawRoundedRectangle(const Rect& rect, const Vec2& radius) override;
+
+    void DrawEllipse(const Point& center, const Vec2& radius) override;
+
+    void FillShape(const Shape& shape) override;
+
+    void FillRectangle(const Rect& rect) override;
+
+    void FillRoundedRectangle(const Rect& rect, const Vec2& radius) override;
+
+    void FillEllipse(const Point& center, const Vec2& radius) override;
+
+    void CreateTexture(Texture& texture, math::Vec2T<uint32_t> size) override;
+
+    void PushClipRect(const Rect& clip_rect) override;
+
+    void PopClipRect() override;
+
+    void PushLayer(Layer& layer) override;
+
+    void PopLayer() override;
+
+    void Clear() override;
+
+    void Clear(const Color& clear_color) override;
+
+    Size GetSize() const override;
+
+    void SetCurrentStrokeStyle(StrokeStylePtr stroke_style) override;
+
+    void SetTransform(const Matrix3x2& matrix) override;
+
+    void SetAntialiasMode(bool enabled) override;
+
+    void SetTextAntialiasMode(TextAntialiasMode mode) override;
+
+    bool CheckVisibility(const Rect& bounds, const Matrix3x2& transform) override;
+
+    void Resize(const Size& size) override;
+
+private:
+    using Bitmap       = graphics::software::Bitmap;
+    using BitmapPtr    = graphics::software::BitmapPtr;
+    using PathGeometry = graphics::software::PathGeometry;
+    using Polyline     = graphics::software::Polyline;
+    using PixelRect    = graphics::software::PixelRect;
+    using FillMode     = graphics::software::FillMode;
+
+    void DiscardDeviceResources();
+
+    Bitmap& GetCurrentTarget();
+
+    PixelRect GetCurrentClip() const;
+
+    PixelRect ToPixelRect(const Rect& rect) const;
+
+    void FillGeometry(const PathGeometry& geometry);
+
+    void StrokeGeometry(const PathGeometry& geometry);
+
+    void StrokePolylines();
+
+    void FillPolygons(const Vector<Polyline>& polygons, FillMode mode);
+
+    bool DrawBitmap(Bitmap& bitmap, bool bilinear, const Rect& src, const Rect& dest, const Matrix3x2& transform,
+                    float opacity);
+
+private:
+    struct LayerData
+    {
+        BitmapPtr        bitmap;
+        float            opacity;
+        PixelRect        clip;
+        bool             has_mask;
+        FillMode         mask_mode;
+        Vector<Polyline> mask;
+    };
+
+    BitmapPtr                      target_;
+    Matrix3x2                      transform_;
+    Matrix3x2                      saved_transform_;
+    Vector<PixelRect>              clip_stack_;
+    Vector<LayerData>              layer_stack_;
+    Vector<BitmapPtr>              layer_pool_;
+    graphics::software::Rasterizer rasterizer_;
+    Vector<Polyline>               polylines_;
+    Vector<Polyline>               stroke_polylines_;
+};
+
+}  // namespace kiwano
@@ -0,0 +1,369 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <kiwano/render/Software/RendererImpl.h>
+
+#if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+
+#include <kiwano/utils/Logger.h>
+#include <kiwano/platform/FileSystem.h>
+#include <kiwano/render/ShapeMaker.h>
+#include <kiwano/render/Software/NativePtr.h>
+#include <kiwano/render/Software/Geometry.h>
+#include <kiwano/render/Software/Rasterizer.h>
+#include <kiwano/render/Software/TextLayoutData.h>
+
+namespace kiwano
+{
+
+using namespace kiwano::graphics::software;
+
+Renderer& Renderer::GetInstance()
+{
+    return RendererImpl::GetInstance();
+}
+
+RendererImpl& RendererImpl::GetInstance()
+{
+    static RendererImpl instance;
+    return instance;
+}
+
+RendererImpl::RendererImpl() {}
+
+bool RendererImpl::SaveTargetToFile(const String& file_path) const
+{
+    if (!target_)
+        return false;
+    return target_->SaveToFile(file_path);
+}
+
+void RendererImpl::MakeContextForWindow(WindowPtr window)
+{
+    KGE_DEBUG_LOGF("Creating device resources");
+
+    Resolution resolution = window->GetCurrentResolution();
+
+    output_size_ = Size{ float(resolution.width), float(resolution.height) };
+    target_      = MakePtr<Bitmap>(resolution.width, resolution.height);
+
+    RenderContextImplPtr ctx = MakePtr<RenderContextImpl>();
+    KGE_THROW_IF(!ctx->CreateDeviceResources(target_), "Create render resources failed");
+
+    render_ctx_ = ctx;
+}
+
+void RendererImpl::Destroy()
+{
+    KGE_DEBUG_LOGF("Destroying device resources");
+
+    Renderer::Destroy();
+
+    render_ctx_.Reset();
+    target_.Reset();
+}
+
+void RendererImpl::Clear()
+{
+    KGE_ASSERT(target_);
+
+    target_->Fill(PackColor(clear_color_));
+}
+
+void RendererImpl::Present()
+{
+    KGE_ASSERT(target_);
+
+    // Nothing to present, the rendered frame stays in the target bitmap
+}
+
+void RendererImpl::CreateTexture(Texture& texture, const String& file_path)
+{
+    BinaryData data = ReadImageFile(texture, file_path);
+    if (data.IsValid())
+    {
+        LoadBitmap(texture, data.GetBytes(), size_t(data.GetSize()));
+    }
+}
+
+void RendererImpl::CreateTexture(Texture& texture, const BinaryData& data)
+{
+    if (!data.IsValid())
+    {
+        texture.Fail("RendererImpl::CreateTexture failed: invalid binary data");
+        return;
+    }
+    LoadBitmap(texture, data.GetBytes(), size_t(data.GetSize()));
+}
+
+void RendererImpl::CreateTexture(Texture& texture, const DecodedImage& image)
+{
+    BitmapPtr bitmap = NativePtr::Get<Bitmap>(image);
+    if (!bitmap)
+    {
+        texture.Fail("RendererImpl::CreateTexture failed: invalid decoded image");
+        return;
+    }
+
+    // The decoded bitmap is already in memory, the texture simply takes it over
+    NativePtr::Set(texture, bitmap);
+
+    texture.SetSize({ float(bitmap->GetWidth()), float(bitmap->GetHeight()) });
+    texture.SetSizeInPixels({ bitmap->GetWidth(), bitmap->GetHeight() });
+}
+
+void RendererImpl::DecodeImage(DecodedImage& image, const String& file_path)
+{
+    BinaryData data = ReadImageFile(image, file_path);
+    if (data.IsValid())
+    {
+        if (BitmapPtr bitmap = DecodeBitmap(image, data.GetBytes(), size_t(data.GetSize())))
+        {
+            NativePtr::Set(image, bitmap);
+            image.SetSizeInPixels({ bitmap->GetWidth(), bitmap->GetHeight() });
+        }
+    }
+}
+
+void RendererImpl::DecodeImage(DecodedImage& image, const BinaryData& data)
+{
+    if (!data.IsValid())
+    {
+        image.Fail("RendererImpl::DecodeImage failed: invalid binary data");
+        return;
+    }
+
+    if (BitmapPtr bitmap = DecodeBitmap(image, data.GetBytes(), size_t(data.GetSize())))
+    {
+        NativePtr::Set(image, bitmap);
+        image.SetSizeInPixels({ bitmap->GetWidth(), bitmap->GetHeight() });
+    }
+}
+
+BinaryData RendererImpl::ReadImageFile(ObjectBase& object, const String& file_path)
+{
+    if (!FileSystem::GetInstance().IsFileExists(file_path))
+    {
+        object.Fail(strings::Format("Texture file '%s' not found!", file_path.c_str()));
+        return BinaryData();
+    }
+
+    // The file is mapped rather than read, it is only needed until the bitmap is decoded
+    BinaryData data = BinaryData::FromFile(file_path);
+    if (!data.IsValid())
+    {
+        object.Fail(strings::Format("Texture file '%s' cannot be opened!", file_path.c_str()));
+    }
+    return data;
+}
+
+BitmapPtr RendererImpl::DecodeBitmap(ObjectBase& object, const uint8_t* data, size_t size)
+{
+    BitmapPtr bitmap = Bitmap::Decode(data, size);
+    if (!bitmap)
+    {
+        object.Fail("Load texture failed: only PNG and uncompressed BMP images are supported by the software renderer");
+    }
+    return bitmap;
+}
+
+void RendererImpl::LoadBitmap(Texture& texture, const uint8_t* data, size_t size)
+{
+    if (BitmapPtr bitmap = DecodeBitmap(texture, data, size))
+    {
+        NativePtr::Set(texture, bitmap);
+
+        texture.SetSize({ float(bitmap->GetWidth()), float(bitmap->GetHeight()) });
+        texture.SetSizeInPixels({ bitmap->GetWidth(), bitmap->GetHeight() });
+    }
+}
+
+void RendererImpl::CreateGifImage(GifImage& gif, const String& file_path)
+{
+    gif.Fail("Load GIF texture failed: GIF images are not supported by the software renderer");
+}
+
+void RendererImpl::CreateGifImage(GifImage& gif, const BinaryData& data)
+{
+    gif.Fail("Load GIF texture failed: GIF images are not supported by the software renderer");
+}
+
+void RendererImpl::CreateGifImageFrame(GifImage::Frame& frame, const GifImage& gif, size_t frame_index)
+{
+    const_cast<GifImage&>(gif).Fail("Load GIF frame failed: GIF images are not supported by the software renderer");
+}
+
+void RendererImpl::CreateFontCollection(Font& font, Vector<String>& family_names, const String& file_path)
+{
+    if (!FileSystem::GetInstance().IsFileExists(file_path))
+    {
+        font.Fail(strings::Format("Font file '%s' not found!", file_path.c_str()));
+        return;
+    }
+
+    // Glyphs are not rasterized, the font only needs to be valid for text layouts
+    NativePtr::Set(font, MakePtr<FontCollectionData>(FileSystem::GetInstance().GetFullPathForFile(file_path)));
+}
+
+void RendererImpl::CreateFontCollection(Font& font, Vector<String>& family_names, const BinaryData& data)
+{
+    if (!data.IsValid())
+    {
+        font.Fail("Create font collection failed: invalid binary data");
+        return;
+    }
+
+    NativePtr::Set(font, MakePtr<FontCollectionData>(String()));
+}
+
+void RendererImpl::CreateTextLayout(TextLayout& layout, const String& content, const TextStyle& style)
+{
+    if (content.empty())
+    {
+        layout.Clear();
+        layout.SetDirtyFlag(TextLayout::DirtyFlag::Dirty);
+        return;
+    }
+
+    FontPtr font = style.font;
+    if (!font)
+    {
+        font = new Font;
+    }
+
+    NativePtr::Set(layout, MakePtr<TextLayoutData>(content, font->GetSize()));
+    layout.SetDirtyFlag(TextLayout::DirtyFlag::Dirty);
+}
+
+void RendererImpl::CreateLineShape(Shape& shape, const Point& begin_pos, const Point& end_pos)
+{
+    NativePtr::Set(shape, PathGeometry::CreateLine(begin_pos, end_pos));
+}
+
+void RendererImpl::CreateRectShape(Shape& shape, const Rect& rect)
+{
+    NativePtr::Set(shape, PathGeometry::CreateRect(rect));
+}
+
+void RendererImpl::CreateRoundedRectShape(Shape& shape, const Rect& rect, const Vec2& radius)
+{
+    NativePtr::Set(shape, PathGeometry::CreateRoundedRect(rect, radius));
+}
+
+void RendererImpl::CreateEllipseShape(Shape& shape, const Point& center, const Vec2& radius)
+{
+    NativePtr::Set(shape, PathGeometry::CreateEllipse(center, radius));
+}
+
+void RendererImpl::CreateShapeSink(ShapeMaker& maker)
+{
+    ShapePtr shape = MakePtr<Shape>();
+    NativePtr::Set(shape, MakePtr<PathGeometry>());
+    maker.SetShape(shape);
+}
+
+void RendererImpl::CreateBrush(Brush& brush, const Color& color)
+{
+    if (brush.GetType() == Brush::Type::SolidColor && brush.IsValid())
+    {
+        auto data = NativePtr::Get<BrushData>(brush);
+        if (data)
+        {
+            data->SetColor(color);
+            return;
+        }
+    }
+    NativePtr::Set(brush, MakePtr<BrushData>(color));
+}
+
+void RendererImpl::CreateBrush(Brush& brush, const LinearGradientStyle& style)
+{
+    if (style.stops.empty())
+    {
+        brush.Fail("Create linear gradient brush failed: no gradient stops");
+        return;
+    }
+    NativePtr::Set(brush, MakePtr<BrushData>(style));
+}
+
+void RendererImpl::CreateBrush(Brush& brush, const RadialGradientStyle& style)
+{
+    if (style.stops.empty())
+    {
+        brush.Fail("Create radial gradient brush failed: no gradient stops");
+        return;
+    }
+    NativePtr::Set(brush, MakePtr<BrushData>(style));
+}
+
+void RendererImpl::CreateBrush(Brush& brush, TexturePtr texture)
+{
+    auto bitmap = NativePtr::Get<Bitmap>(texture);
+    if (!bitmap)
+    {
+        brush.Fail("Create bitmap brush failed: invalid texture");
+        return;
+    }
+    NativePtr::Set(brush, MakePtr<BrushData>(bitmap, texture->GetBitmapInterpolationMode()));
+}
+
+void RendererImpl::CreateStrokeStyle(StrokeStyle& stroke_style)
+{
+    auto output = MakePtr<StrokeStyleData>(stroke_style.GetCapStyle(), stroke_style.GetLineJoinStyle(),
+                                           stroke_style.GetDashArray(), stroke_style.GetDashOffset());
+    NativePtr::Set(stroke_style, output);
+}
+
+RenderContextPtr RendererImpl::CreateTextureRenderContext(Texture& texture, const Size* desired_size)
+{
+    Size size = desired_size ? *desired_size : output_size_;
+
+    uint32_t width  = uint32_t(std::max(size.x, 1.0f));
+    uint32_t height = uint32_t(std::max(size.y, 1.0f));
+
+    BitmapPtr            bitmap = MakePtr<Bitmap>(width, height);
+    RenderContextImplPtr ptr    = MakePtr<RenderContextImpl>();
+    if (!ptr->CreateDeviceResources(bitmap))
+        return nullptr;
+
+    NativePtr::Set(texture, bitmap);
+    texture.SetSize({ float(width), float(height) });
+    texture.SetSizeInPixels({ width, height });
+    return ptr;
+}
+
+void RendererImpl::Resize(uint32_t width, uint32_t height)
+{
+    KGE_ASSERT(target_);
+
+    output_size_.x = static_cast<float>(width);
+    output_size_.y = static_cast<float>(height);
+
+    target_->Resize(width, height);
+
+    if (render_ctx_)
+    {
+        render_ctx_->Resize(output_size_);
+    }
+}
+
+}  // namespace kiwano
+
+#endif
@@ -0,0 +1,123 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <kiwano/render/Renderer.h>
+#include <kiwano/render/Software/Bitmap.h>
+#include <kiwano/render/Software/RenderContextImpl.h>
+
+namespace kiwano
+{
+
+/**
+ * \~chinese
+ * @brief 软件渲染器
+ * @details 在内存位图上完成全部绘制，不依赖任何图形设备，可用于无窗口环境下运行和测试场景
+ */
+class KGE_API RendererImpl : public Renderer
+{
+public:
+    static RendererImpl& GetInstance();
+
+    /// \~chinese
+    /// @brief 获取渲染输出的位图
+    graphics::software::BitmapPtr GetTargetBitmap() const;
+
+    /// \~chinese
+    /// @brief 将渲染输出保存为 BMP 文件
+    bool SaveTargetToFile(const String& file_path) const;
+
+    void CreateTexture(Texture& texture, const String& file_path) override;
+
+    void CreateTexture(Texture& texture, const BinaryData& data) override;
+
+    void CreateTexture(Texture& texture, const DecodedImage& image) override;
+
+    void DecodeImage(DecodedImage& image, const String& file_path) override;
+
+    void DecodeImage(DecodedImage& image, const BinaryData& data) override;
+
+    void CreateGifImage(GifImage& gif, const String& file_path) override;
+
+    void CreateGifImage(GifImage& gif, const BinaryData& data) override;
+
+    void CreateGifImageFrame(GifImage::Frame& frame, const GifImage& gif, size_t frame_index) override;
+
+    void CreateFontCollection(Font& font, Vector<String>& family_names, const String& file_path) override;
+
+    void CreateFontCollection(Font& font, Vector<String>& family_names, const BinaryData& data) override;
+
+    void CreateTextLayout(TextLayout& layout, const String& content, const TextStyle& style) override;
+
+    void CreateLineShape(Shape& shape, const Point& begin_pos, const Point& end_pos) override;
+
+    void CreateRectShape(Shape& shape, const Rect& rect) override;
+
+    void CreateRoundedRectShape(Shape& shape, const Rect& rect, const Vec2& radius) override;
+
+    void CreateEllipseShape(Shape& shape, const Point& center, const Vec2& radius) override;
+
+    void CreateShapeSink(ShapeMaker& maker) override;
+
+    void CreateBrush(Brush& brush, const Color& color) override;
+
+    void CreateBrush(Brush& brush, const LinearGradientStyle& style) override;
+
+    void CreateBrush(Brush& brush, const RadialGradientStyle& style) override;
+
+    void CreateBrush(Brush& brush, TexturePtr texture) override;
+
+    void CreateStrokeStyle(StrokeStyle& stroke_style) override;
+
+    RenderContextPtr CreateTextureRenderContext(Texture& texture, const Size* desired_size = nullptr) override;
+
+public:
+    void Clear() override;
+
+    void Present() override;
+
+    void Resize(uint32_t width, uint32_t height) override;
+
+    void MakeContextForWindow(WindowPtr window) override;
+
+    void Destroy() override;
+
+protected:
+    RendererImpl();
+
+private:
+    BinaryData ReadImageFile(ObjectBase& object, const String& file_path);
+
+    graphics::software::BitmapPtr DecodeBitmap(ObjectBase& object, const uint8_t* data, size_t size);
+
+    void LoadBitmap(Texture& texture, const uint8_t* data, size_t size);
+
+private:
+    graphics::software::BitmapPtr target_;
+};
+
+/** @} */
+
+inline graphics::software::BitmapPtr RendererImpl::GetTargetBitmap() const
+{
+    return target_;
+}
+
+}  // namespace kiwano
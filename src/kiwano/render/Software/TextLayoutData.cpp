@@ -0,0 +1,136 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <kiwano/render/Software/TextLayoutData.h>
+
+#if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+
+#include <algorithm>
+
+namespace kiwano
+{
+namespace graphics
+{
+namespace software
+{
+
+namespace
+{
+
+// Decode one UTF-8 character, invalid bytes are treated as single characters
+uint32_t NextCodePoint(const String& str, size_t& pos)
+{
+    uint8_t  c     = uint8_t(str[pos++]);
+    uint32_t code  = c;
+    int      extra = 0;
+
+    if ((c & 0xE0) == 0xC0)
+    {
+        code  = c & 0x1F;
+        extra = 1;
+    }
+    else if ((c & 0xF0) == 0xE0)
+    {
+        code  = c & 0x0F;
+        extra = 2;
+    }
+    else if ((c & 0xF8) == 0xF0)
+    {
+        code  = c & 0x07;
+        extra = 3;
+    }
+
+    while (extra-- > 0 && pos < str.size() && (uint8_t(str[pos]) & 0xC0) == 0x80)
+    {
+        code = (code << 6) | (uint8_t(str[pos++]) & 0x3F);
+    }
+    return code;
+}
+
+float GetAdvance(uint32_t code, float font_size)
+{
+    // CJK characters and full-width forms are roughly square
+    if (code >= 0x2E80)
+        return font_size;
+    if (code == ' ')
+        return font_size * 0.3f;
+    return font_size * 0.55f;
+}
+
+}  // namespace
+
+FontCollectionData::FontCollectionData(const String& file_path)
+    : file_path(file_path)
+{
+}
+
+TextLayoutData::TextLayoutData(const String& content, float font_size)
+    : content(content)
+    , font_size(font_size)
+    , wrap_width(0)
+    , line_spacing(0)
+    , alignment(TextAlign::Left)
+    , underline(false)
+    , strikethrough(false)
+{
+}
+
+void TextLayoutData::ComputeMetrics(Size& size, uint32_t& line_count) const
+{
+    const float line_height = line_spacing > 0 ? line_spacing : font_size * 1.2f;
+
+    float max_width  = 0;
+    float line_width = 0;
+    line_count       = 1;
+
+    size_t pos = 0;
+    while (pos < content.size())
+    {
+        uint32_t code = NextCodePoint(content, pos);
+        if (code == '\n')
+        {
+            max_width  = std::max(max_width, line_width);
+            line_width = 0;
+            ++line_count;
+            continue;
+        }
+
+        if (code == '\r')
+            continue;
+
+        float advance = GetAdvance(code, font_size);
+        if (wrap_width > 0 && line_width > 0 && line_width + advance > wrap_width)
+        {
+            max_width  = std::max(max_width, line_width);
+            line_width = 0;
+            ++line_count;
+        }
+        line_width += advance;
+    }
+    max_width = std::max(max_width, line_width);
+
+    size = Size(wrap_width > 0 ? wrap_width : max_width, line_height * line_count);
+}
+
+}  // namespace software
+}  // namespace graphics
+}  // namespace kiwano
+
+#endif
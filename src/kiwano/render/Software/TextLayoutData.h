@@ -0,0 +1,68 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <kiwano/render/TextStyle.h>
+
+namespace kiwano
+{
+namespace graphics
+{
+namespace software
+{
+
+KGE_DECLARE_SMART_PTR(FontCollectionData);
+KGE_DECLARE_SMART_PTR(TextLayoutData);
+
+/// \~chinese
+/// @brief 字体集数据
+/// @details 仅记录字体来源，字体文件不会被解析
+class KGE_API FontCollectionData : public RefObject
+{
+public:
+    FontCollectionData(const String& file_path);
+
+    String file_path;
+};
+
+/// \~chinese
+/// @brief 文字布局数据
+/// @details 软件渲染器没有字形光栅化能力，这里仅以字号估算每个字符的宽度，用于计算布局大小
+class KGE_API TextLayoutData : public RefObject
+{
+public:
+    TextLayoutData(const String& content, float font_size);
+
+    /// \~chinese
+    /// @brief 计算布局大小与行数
+    void ComputeMetrics(Size& size, uint32_t& line_count) const;
+
+    String    content;
+    float     font_size;
+    float     wrap_width;
+    float     line_spacing;
+    TextAlign alignment;
+    bool      underline;
+    bool      strikethrough;
+};
+
+}  // namespace software
+}  // namespace graphics
+}  // namespace kiwano
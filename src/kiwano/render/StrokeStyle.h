@@ -32,78 +32,78 @@ KGE_DECLARE_SMART_PTR(StrokeStyle);
  */
 
 /// \~chinese
-/// @brief ˵ʽ
-/// @details ˵ʽʾ߶ζ˵㲿ֵ״
+/// @brief 线条端点样式
+/// @details 线条端点样式表示线段端点部分的形状
 enum class CapStyle
 {
-    Flat,      ///< ˵
-    Square,    ///< ζ˵㣬ͻֵ߶οȵһ
-    Round,     ///< Բζ˵㣬Բֱ߶ο
-    Triangle,  ///< ʽб߳ȵ߶ο
+    Flat,      ///< 扁端点
+    Square,    ///< 方形端点，方形突出部分等于线段宽度的一半
+    Round,     ///< 圆形端点，圆直径等于线段宽度
+    Triangle,  ///< 三角样式，三角斜边长度等于线段宽度
 };
 
 /// \~chinese
-/// @brief ʽ
-/// @details ʽʾֵཻ״
+/// @brief 线条交点样式
+/// @details 线条交点样式表示两条线相交部分的形状
 enum class LineJoinStyle
 {
-    Miter,  ///< бʽ
-    Bevel,  ///< бʽ
-    Round   ///< Բʽ
+    Miter,  ///< 斜切样式
+    Bevel,  ///< 斜角样式
+    Round   ///< 圆角样式
 };
 
 /// \~chinese
-/// @brief ʽ
-/// @details ʽʾ߶εļ϶
+/// @brief 线条虚线样式
+/// @details 线条虚线样式表示线段的间隙
 enum class DashStyle
 {
-    Solid,       ///< ޼ϵʵ
-    Dash,        ///< бʽ
-    Dot,         ///< Բʽ
-    DashDot,     ///< Բʽ
-    DashDotDot,  ///< Բʽ
+    Solid,       ///< 无间断的实线
+    Dash,        ///< 斜角样式
+    Dot,         ///< 圆角样式
+    DashDot,     ///< 圆角样式
+    DashDotDot,  ///< 圆角样式
 };
 
 /// \~chinese
-/// @brief ʽ
+/// @brief 线条样式
 class StrokeStyle : public NativeObject
 {
 public:
     /// \~chinese
-    /// @brief ʽ
-    /// @param width 
-    /// @param cap ˵ʽ
-    /// @param line_join ʽ
+    /// @brief 创建线条样式
+    /// @param width 线条宽度
+    /// @param cap 线条端点样式
+    /// @param line_join 线条交点样式
     StrokeStyle(float width, CapStyle cap = CapStyle::Flat, LineJoinStyle line_join = LineJoinStyle::Miter);
 
     /// \~chinese
-    /// @brief ʽ
-    /// @param width 
-    /// @param cap ˵ʽ
-    /// @param line_join ʽ
-    /// @param dash ʽ
-    /// @param dash_offset ƫ
+    /// @brief 创建线条样式
+    /// @param width 线条宽度
+    /// @param cap 线条端点样式
+    /// @param line_join 线条交点样式
+    /// @param dash 线条虚线样式
+    /// @param dash_offset 线条虚线偏移量
     StrokeStyle(float width, CapStyle cap, LineJoinStyle line_join, DashStyle dash, float dash_offset = 0.0f);
 
     /// \~chinese
-    /// @brief ʽ
-    /// @param width 
-    /// @param cap ˵ʽ
-    /// @param line_join ʽ
-    /// @param dash_array ߵĳ϶
-    /// @param dash_size С
-    /// @param dash_offset ƫ
+    /// @brief 创建线条样式
+    /// @param width 线条宽度
+    /// @param cap 线条端点样式
+    /// @param line_join 线条交点样式
+    /// @param dash_array 线条虚线的长度与间隙数组
+    /// @param dash_size 线条虚线数组大小
+    /// @param dash_offset 线条虚线偏移量
     StrokeStyle(float width, CapStyle cap, LineJoinStyle line_join, const float* dash_array, size_t dash_size,
                 float dash_offset = 0.0f);
 
     /// \~chinese
-    /// @brief ʽ
-    /// @tparam _DashSize С
-    /// @param width 
-    /// @param cap ˵ʽ
-    /// @param line_join ʽ
-    /// @param dash_array ߵĳ϶
-    /// @param dash_offset ƫ
+    /// @brief 创建线条样式
+    /// @tparam _DashSize 线条虚线数组大小
+    /// @param width 线条宽度
+    /// @param cap 线条端点样式
+    /// @param line_join 线条交点样式
+    /// @param dash_array 线条虚线的长度与间隙数组
+    /// @param dash_offset 线条虚线偏移量
     template <size_t _DashSize>
     StrokeStyle(float width, CapStyle cap, LineJoinStyle line_join, float (&dash_array)[_DashSize],
                 float dash_offset = 0.0f)
@@ -114,58 +114,58 @@ public:
     StrokeStyle();
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取线条宽度
     float GetWidth() const;
 
     /// \~chinese
-    /// @brief ȡ˵ʽ
+    /// @brief 获取线条端点样式
     CapStyle GetCapStyle() const;
 
     /// \~chinese
-    /// @brief ȡʽ
+    /// @brief 获取线条交点样式
     LineJoinStyle GetLineJoinStyle() const;
 
     /// \~chinese
-    /// @brief ȡߵĳ϶
+    /// @brief 获取线条虚线的长度与间隙数组
     const Vector<float>& GetDashArray() const;
 
     /// \~chinese
-    /// @brief ȡƫ
+    /// @brief 获取虚线偏移量
     float GetDashOffset() const;
 
     /// \~chinese
-    /// @brief 
-    /// @param width 
+    /// @brief 设置线条宽度
+    /// @param width 线条宽度
     void SetWidth(float width);
 
     /// \~chinese
-    /// @brief ˵ʽ
+    /// @brief 设置线条端点样式
     void SetCapStyle(CapStyle cap);
 
     /// \~chinese
-    /// @brief ʽ
+    /// @brief 设置线条交点样式
     void SetLineJoinStyle(LineJoinStyle line_join);
 
     /// \~chinese
-    /// @brief ʽ
-    /// @param dash_style ʽ
+    /// @brief 设置虚线样式
+    /// @param dash_style 线条虚线样式
     void SetDashStyle(DashStyle dash_style);
 
     /// \~chinese
-    /// @brief ʽ
-    /// @param dash_array ߵĳ϶
+    /// @brief 设置虚线样式
+    /// @param dash_array 线条虚线的长度与间隙数组
     void SetDashStyle(const Vector<float>& dash_array);
 
     /// \~chinese
-    /// @brief ʽ
-    /// @param dash_array ߵĳ϶
-    /// @param dash_size С
+    /// @brief 设置虚线样式
+    /// @param dash_array 线条虚线的长度与间隙数组
+    /// @param dash_size 线条虚线数组大小
     void SetDashStyle(const float* dash_array, size_t dash_size);
 
     /// \~chinese
-    /// @brief ʽ
-    /// @tparam _DashSize С
-    /// @param dash_array ߵĳ϶
+    /// @brief 设置虚线样式
+    /// @tparam _DashSize 线条虚线数组大小
+    /// @param dash_array 线条虚线的长度与间隙数组
     template <size_t _DashSize>
     inline void SetDashStyle(float (&dash_array)[_DashSize])
     {
@@ -173,8 +173,8 @@ public:
     }
 
     /// \~chinese
-    /// @brief ƫ
-    /// @param dash_offset ƫ
+    /// @brief 设置虚线偏移量
+    /// @param dash_offset 线条虚线偏移量
     void SetDashOffset(float dash_offset);
 
 private:
@@ -23,6 +23,9 @@
 
 #if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_DIRECTX
 #include <kiwano/render/DirectX/NativePtr.h>
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+#include <kiwano/render/Software/NativePtr.h>
+#include <kiwano/render/Software/TextLayoutData.h>
 #endif
 
 namespace kiwano
@@ -142,6 +145,14 @@ void TextLayout::SetFont(FontPtr font)
             KGE_THROW_IF_FAILED(hr, "IDWriteTextLayout::SetFontStretch failed");
         }
     }
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    auto native = NativePtr::Get<graphics::software::TextLayoutData>(this);
+    KGE_ASSERT(native);
+
+    if (native)
+    {
+        native->font_size = font->GetSize();
+    }
 #else
     // not supported
 #endif
@@ -160,6 +171,14 @@ void TextLayout::SetUnderline(bool enable)
         HRESULT hr = native->SetUnderline(enable, { 0, content_length_ });
         KGE_THROW_IF_FAILED(hr, "IDWriteTextLayout::SetUnderline failed");
     }
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    auto native = NativePtr::Get<graphics::software::TextLayoutData>(this);
+    KGE_ASSERT(native);
+
+    if (native)
+    {
+        native->underline = enable;
+    }
 #else
     // not supported
 #endif
@@ -178,6 +197,14 @@ void TextLayout::SetStrikethrough(bool enable)
         HRESULT hr = native->SetStrikethrough(enable, { 0, content_length_ });
         KGE_THROW_IF_FAILED(hr, "IDWriteTextLayout::SetStrikethrough failed");
     }
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    auto native = NativePtr::Get<graphics::software::TextLayoutData>(this);
+    KGE_ASSERT(native);
+
+    if (native)
+    {
+        native->strikethrough = enable;
+    }
 #else
     // not supported
 #endif
@@ -213,6 +240,14 @@ void TextLayout::SetAlignment(TextAlign align)
         HRESULT hr = native->SetTextAlignment(alignment);
         KGE_THROW_IF_FAILED(hr, "IDWriteTextLayout::SetTextAlignment failed");
     }
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    auto native = NativePtr::Get<graphics::software::TextLayoutData>(this);
+    KGE_ASSERT(native);
+
+    if (native)
+    {
+        native->alignment = align;
+    }
 #else
     // not supported
 #endif
@@ -243,6 +278,14 @@ void TextLayout::SetWrapWidth(float wrap_width)
         }
         KGE_THROW_IF_FAILED(hr, "IDWriteTextLayout::SetWordWrapping failed");
     }
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    auto native = NativePtr::Get<graphics::software::TextLayoutData>(this);
+    KGE_ASSERT(native);
+
+    if (native)
+    {
+        native->wrap_width = wrap_width;
+    }
 #else
     // not supported
 #endif
@@ -271,6 +314,14 @@ void TextLayout::SetLineSpacing(float line_spacing)
         }
         KGE_THROW_IF_FAILED(hr, "IDWriteTextLayout::SetLineSpacing failed");
     }
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    auto native = NativePtr::Get<graphics::software::TextLayoutData>(this);
+    KGE_ASSERT(native);
+
+    if (native)
+    {
+        native->line_spacing = line_spacing;
+    }
 #else
     // not supported
 #endif
@@ -326,6 +377,21 @@ bool TextLayout::UpdateIfDirty()
         KGE_THROW_IF_FAILED(hr, "IDWriteTextLayout::GetMetrics failed");
         return true;
     }
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    if (dirty_flag_ == DirtyFlag::Dirty)
+    {
+        SetDirtyFlag(DirtyFlag::Clean);
+
+        line_count_ = 0;
+        size_       = Size();
+
+        auto native = NativePtr::Get<graphics::software::TextLayoutData>(this);
+        if (content_length_ == 0 || !native)
+            return true;
+
+        native->ComputeMetrics(size_, line_count_);
+        return true;
+    }
 #else
     // not supported
 #endif
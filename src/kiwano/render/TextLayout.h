@@ -34,114 +34,114 @@ KGE_DECLARE_SMART_PTR(TextLayout);
  */
 
 /// \~chinese
-/// @brief ı
+/// @brief 文本布局
 class KGE_API TextLayout : public NativeObject
 {
 public:
     TextLayout();
 
     /// \~chinese
-    /// @brief ı
-    /// @param content 
-    /// @param style ıʽ
+    /// @brief 创建文本布局
+    /// @param content 文字内容
+    /// @param style 文本样式
     TextLayout(const String& content, const TextStyle& style);
 
     /// \~chinese
-    /// @brief ıǷ¾
+    /// @brief 文本布局是否陈旧
     bool IsDirty() const;
 
     /// \~chinese
-    /// @brief ı
+    /// @brief 清空文本布局
     void Clear();
 
     /// \~chinese
-    /// @brief ı
-    /// @param content 
-    /// @param style ıʽ
+    /// @brief 重设文本布局
+    /// @param content 文字内容
+    /// @param style 文本样式
     void Reset(const String& content, const TextStyle& style);
 
     /// \~chinese
-    /// @brief ȡıִС
+    /// @brief 获取文本布局大小
     Size GetSize() const;
 
     /// \~chinese
-    /// @brief ȡı
+    /// @brief 获取文本行数
     uint32_t GetLineCount() const;
 
     /// \~chinese
-    /// @brief ȡĬ仭ˢ
+    /// @brief 获取默认填充画刷
     BrushPtr GetFillBrush() const;
 
     /// \~chinese
-    /// @brief ȡĬ߻ˢ
+    /// @brief 获取默认描边画刷
     BrushPtr GetOutlineBrush() const;
 
     /// \~chinese
-    /// @brief ȡĬʽ
+    /// @brief 获取默认描边线条样式
     StrokeStylePtr GetOutlineStrokeStyle() const;
 
     /// \~chinese
-    /// @brief 
-    /// @param font 
+    /// @brief 设置字体
+    /// @param font 字体
     void SetFont(FontPtr font);
 
     /// \~chinese
-    /// @brief »
-    /// @param enable Ƿʾ»
+    /// @brief 设置下划线
+    /// @param enable 是否显示下划线
     void SetUnderline(bool enable);
 
     /// \~chinese
-    /// @brief ɾ
-    /// @param enable Ƿʾɾ
+    /// @brief 设置删除线
+    /// @param enable 是否显示删除线
     void SetStrikethrough(bool enable);
 
     /// \~chinese
-    /// @brief 仭ˢ߻ˢ߿
-    /// @param brush ˢ
+    /// @brief 设置文字填充画刷，描边画刷和描边线宽
+    /// @param brush 画刷
     void SetFillBrush(BrushPtr brush);
 
     /// \~chinese
-    /// @brief ߻ˢ
-    /// @param brush ˢ
+    /// @brief 设置文字描边画刷
+    /// @param brush 画刷
     void SetOutlineBrush(BrushPtr brush);
 
     /// \~chinese
-    /// @brief ʽ
-    /// @param stroke ʽ
+    /// @brief 设置描边线条样式
+    /// @param stroke 线条样式
     void SetOutlineStrokeStyle(StrokeStylePtr stroke);
 
     /// \~chinese
-    /// @brief ö뷽ʽ
-    /// @param align 뷽ʽ
+    /// @brief 设置对齐方式
+    /// @param align 对齐方式
     void SetAlignment(TextAlign align);
 
     /// \~chinese
-    /// @brief ıԶеĿ
+    /// @brief 设置文本自动换行的宽度
     void SetWrapWidth(float wrap_width);
 
     /// \~chinese
-    /// @brief мࣨĬΪ 0
+    /// @brief 设置行间距（默认为 0）
     void SetLineSpacing(float line_spacing);
 
     /// \~chinese
-    /// @brief ಼ֱ־
+    /// @brief 脏布局标志
     enum class DirtyFlag : uint8_t
     {
-        Clean = 0,      ///< ɾ
-        Dirty = 1 << 0  ///< ಼
+        Clean = 0,      ///< 干净布局
+        Dirty = 1 << 0  ///< 脏布局
     };
 
     /// \~chinese
-    /// @brief ȡ಼ֱ־
+    /// @brief 获取脏布局标志
     DirtyFlag GetDirtyFlag() const;
 
     /// \~chinese
-    /// @brief ಼ֱ־
+    /// @brief 设置脏布局标志
     void SetDirtyFlag(DirtyFlag flag);
 
     /// \~chinese
-    /// @brief ಼
-    /// @return ǷҪ
+    /// @brief 更新脏布局
+    /// @return 是否需要更新
     bool UpdateIfDirty();
 
 private:
@@ -33,53 +33,53 @@ namespace kiwano
 
 /**
  * \~chinese
- * @brief ı뷽ʽ
+ * @brief 文本对齐方式
  */
 enum class TextAlign
 {
-    Left,      ///< 
-    Right,     ///< Ҷ
-    Center,    ///< ж
-    Justified  ///< ˶
+    Left,      ///< 左对齐
+    Right,     ///< 右对齐
+    Center,    ///< 居中对齐
+    Justified  ///< 两端对齐
 };
 
 /**
  * \~chinese
- * @brief ıʽ
+ * @brief 文本样式
  */
 class KGE_API TextStyle
 {
 public:
-    FontPtr        font;                ///< 
-    TextAlign      alignment;           ///< 뷽ʽ
-    BrushPtr       fill_brush;          ///< 仭ˢ
-    BrushPtr       outline_brush;       ///< ߻ˢ
-    StrokeStylePtr outline_stroke;      ///< ʽ
-    float          wrap_width;          ///< Զп
-    float          line_spacing;        ///< м
-    bool           show_underline;      ///< ʾ»
-    bool           show_strikethrough;  ///< ʾɾ
+    FontPtr        font;                ///< 字体
+    TextAlign      alignment;           ///< 对齐方式
+    BrushPtr       fill_brush;          ///< 填充画刷
+    BrushPtr       outline_brush;       ///< 描边画刷
+    StrokeStylePtr outline_stroke;      ///< 描边样式
+    float          wrap_width;          ///< 自动换行宽度
+    float          line_spacing;        ///< 行间距
+    bool           show_underline;      ///< 显示下划线
+    bool           show_strikethrough;  ///< 显示删除线
 
 public:
     /**
      * \~chinese
-     * @brief Ĭıʽ
+     * @brief 构建默认文本样式
      */
     TextStyle();
 
     /**
      * \~chinese
-     * @brief ıʽ
-     * @param font 
+     * @brief 构建文本样式
+     * @param font 字体
      */
     TextStyle(FontPtr font);
 
     /**
      * \~chinese
-     * @brief ıʽ
-     * @param font_family 
-     * @param font_size С
-     * @param font_weight ϸ
+     * @brief 构建文本样式
+     * @param font_family 字体族
+     * @param font_size 字体大小
+     * @param font_weight 字体粗细
      */
     TextStyle(const String& font_family, float font_size, uint32_t font_weight = FontWeight::Normal);
 };
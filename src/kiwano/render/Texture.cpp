@@ -21,10 +21,14 @@
 #include <kiwano/render/Renderer.h>
 #include <kiwano/render/Texture.h>
 #include <kiwano/render/TextureCache.h>
+#include <kiwano/render/TextureLoader.h>
 #include <functional>  // std::hash
 
 #if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_DIRECTX
 #include <kiwano/render/DirectX/NativePtr.h>
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+#include <kiwano/render/Software/NativePtr.h>
+#include <kiwano/render/Software/Bitmap.h>
 #endif
 
 namespace kiwano
@@ -62,6 +66,16 @@ TexturePtr Texture::Preload(const Resource& res)
     return ptr;
 }
 
+TextureLoadRequestPtr Texture::PreloadAsync(const String& file_path, Function<void(TexturePtr)> callback)
+{
+    return TextureLoader::GetInstance().LoadTexture(file_path, callback);
+}
+
+TextureLoadRequestPtr Texture::PreloadAsync(const Resource& res, Function<void(TexturePtr)> callback)
+{
+    return TextureLoader::GetInstance().LoadTexture(res, callback);
+}
+
 Texture::Texture(const String& file_path)
     : Texture()
 {
@@ -89,7 +103,18 @@ bool Texture::Load(const String& file_path)
 
 bool Texture::Load(const Resource& res)
 {
-    Renderer::GetInstance().CreateTexture(*this, res.GetData());
+    return Load(res.GetData());
+}
+
+bool Texture::Load(const BinaryData& data)
+{
+    Renderer::GetInstance().CreateTexture(*this, data);
+    return IsValid();
+}
+
+bool Texture::Load(const DecodedImage& image)
+{
+    Renderer::GetInstance().CreateTexture(*this, image);
     return IsValid();
 }
 
@@ -105,6 +130,18 @@ void Texture::CopyFrom(TexturePtr copy_from)
 
         KGE_THROW_IF_FAILED(hr, "Copy texture data failed");
     }
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    if (IsValid() && copy_from)
+    {
+        auto native         = NativePtr::Get<graphics::software::Bitmap>(this);
+        auto native_to_copy = NativePtr::Get<graphics::software::Bitmap>(copy_from);
+
+        if (native && native_to_copy)
+        {
+            native->CopyFrom(*native_to_copy, 0, 0, int(native_to_copy->GetWidth()), int(native_to_copy->GetHeight()),
+                             0, 0);
+        }
+    }
 #else
     return;  // not supported
 #endif
@@ -125,6 +162,19 @@ void Texture::CopyFrom(TexturePtr copy_from, const Rect& src_rect, const Point&
 
         KGE_THROW_IF_FAILED(hr, "Copy texture data failed");
     }
+#elif KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_SOFTWARE
+    if (IsValid() && copy_from)
+    {
+        auto native         = NativePtr::Get<graphics::software::Bitmap>(this);
+        auto native_to_copy = NativePtr::Get<graphics::software::Bitmap>(copy_from);
+
+        if (native && native_to_copy)
+        {
+            native->CopyFrom(*native_to_copy, int(src_rect.GetLeft()), int(src_rect.GetTop()),
+                             int(src_rect.GetRight()), int(src_rect.GetBottom()), int(dest_point.x),
+                             int(dest_point.y));
+        }
+    }
 #else
     return;  // not supported
 #endif
@@ -26,6 +26,8 @@ namespace kiwano
 {
 
 KGE_DECLARE_SMART_PTR(Texture);
+KGE_DECLARE_SMART_PTR(DecodedImage);
+KGE_DECLARE_SMART_PTR(TextureLoadRequest);
 
 /**
  * \addtogroup Render
@@ -34,111 +36,138 @@ KGE_DECLARE_SMART_PTR(Texture);
 
 /**
  * \~chinese
- * @brief ֵģʽ
- * @details ֵģʽָλͼźתʱɫļ㷽ʽ
+ * @brief 插值模式
+ * @details 插值模式指定了位图在缩放和旋转时像素颜色的计算方式
  */
 enum class InterpolationMode
 {
-    Linear,  ///< ˫ԲֵΧĸؽԲֵ㣬ͼŴʱܻģ
-    Nearest  ///< ڽֵȡڽصɫֵ
+    Linear,  ///< 双线性插值，对周围四个像素进行两次线性插值计算，在图像放大时可能会模糊
+    Nearest  ///< 最邻近插值，取最邻近的像素点的颜色值
 };
 
 /// \~chinese
-/// @brief شС
+/// @brief 像素大小
 typedef math::Vec2T<uint32_t> PixelSize;
 
 /**
  * \~chinese
- * @brief 
+ * @brief 纹理
  */
 class KGE_API Texture : public NativeObject
 {
 public:
     /// \~chinese
-    /// @brief ԤرͼƬ
+    /// @brief 预加载本地图片
     static TexturePtr Preload(const String& file_path);
 
     /// \~chinese
-    /// @brief ԤͼƬԴ
+    /// @brief 预加载图片资源
     static TexturePtr Preload(const Resource& res);
 
+    /// \~chinese
+    /// @brief 异步预加载本地图片
+    /// @details 在工作线程中读取并解码图片，完成后在主线程中创建纹理并调用回调函数
+    /// @param file_path 图片路径
+    /// @param callback 加载完成的回调函数，加载失败时传入的纹理无效
+    static TextureLoadRequestPtr PreloadAsync(const String& file_path, Function<void(TexturePtr)> callback = nullptr);
+
+    /// \~chinese
+    /// @brief 异步预加载图片资源
+    /// @details 在工作线程中解码图片，完成后在主线程中创建纹理并调用回调函数
+    /// @param res 图片资源
+    /// @param callback 加载完成的回调函数，加载失败时传入的纹理无效
+    static TextureLoadRequestPtr PreloadAsync(const Resource& res, Function<void(TexturePtr)> callback = nullptr);
+
     Texture();
 
     /// \~chinese
-    /// @brief ӱļ
+    /// @brief 从本地文件创建纹理
     Texture(const String& file_path);
 
     /// \~chinese
-    /// @brief Դ
+    /// @brief 从资源创建纹理
     Texture(const Resource& res);
 
     virtual ~Texture();
 
     /// \~chinese
-    /// @brief رļ
+    /// @brief 加载本地文件
     bool Load(const String& file_path);
 
     /// \~chinese
-    /// @brief Դ
+    /// @brief 加载资源
     bool Load(const Resource& res);
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 加载图片数据
+    bool Load(const BinaryData& data);
+
+    /// \~chinese
+    /// @brief 从已解码的图像加载
+    bool Load(const DecodedImage& image);
+
+    /// \~chinese
+    /// @brief 获取纹理宽度
     float GetWidth() const;
 
     /// \~chinese
-    /// @brief ȡ߶
+    /// @brief 获取纹理高度
     float GetHeight() const;
 
     /// \~chinese
-    /// @brief ȡС
+    /// @brief 获取纹理大小
     Size GetSize() const;
 
     /// \~chinese
-    /// @brief ȡؿ
+    /// @brief 获取像素宽度
     uint32_t GetWidthInPixels() const;
 
     /// \~chinese
-    /// @brief ȡظ߶
+    /// @brief 获取像素高度
     uint32_t GetHeightInPixels() const;
 
     /// \~chinese
-    /// @brief ȡشС
+    /// @brief 获取像素大小
     PixelSize GetSizeInPixels() const;
 
     /// \~chinese
-    /// @brief ȡزֵʽ
+    /// @brief 获取纹理占用的内存大小（字节）
+    /// @details 按像素大小和 32 位像素格式估算
+    size_t GetMemorySize() const;
+
+    /// \~chinese
+    /// @brief 获取像素插值方式
     InterpolationMode GetBitmapInterpolationMode() const;
     /// \~chinese
-    /// @brief ôС
+    /// @brief 设置大小
     void SetSize(const Size& size);
 
     /// \~chinese
-    /// @brief شС
+    /// @brief 设置像素大小
     void SetSizeInPixels(const PixelSize& size);
 
     /// \~chinese
-    /// @brief زֵʽ
+    /// @brief 设置像素插值方式
     void SetInterpolationMode(InterpolationMode mode);
 
     /// \~chinese
-    /// @brief 
-    /// @param copy_from Դ
+    /// @brief 拷贝纹理
+    /// @param copy_from 源纹理
     void CopyFrom(TexturePtr copy_from);
 
     /// \~chinese
-    /// @brief 
-    /// @param copy_from Դ
-    /// @param src_rect Դü
-    /// @param dest_point Ŀλ
+    /// @brief 拷贝纹理
+    /// @param copy_from 源纹理
+    /// @param src_rect 源纹理裁剪矩形
+    /// @param dest_point 拷贝至目标位置
     void CopyFrom(TexturePtr copy_from, const Rect& src_rect, const Point& dest_point);
 
     /// \~chinese
-    /// @brief Ĭϵزֵʽ
+    /// @brief 设置默认的像素插值方式
     static void SetDefaultInterpolationMode(InterpolationMode mode);
 
     /// \~chinese
-    /// @brief ȡĬϵزֵʽ
+    /// @brief 获取默认的像素插值方式
     static InterpolationMode GetDefaultInterpolationMode();
 
 private:
@@ -149,6 +178,28 @@ private:
     static InterpolationMode default_interpolation_mode_;
 };
 
+/**
+ * \~chinese
+ * @brief 已解码的图像
+ * @details 保存解码后的像素数据，可以在工作线程中创建，再在主线程中转换为纹理
+ */
+class KGE_API DecodedImage : public NativeObject
+{
+public:
+    DecodedImage();
+
+    /// \~chinese
+    /// @brief 获取像素大小
+    PixelSize GetSizeInPixels() const;
+
+    /// \~chinese
+    /// @brief 设置像素大小
+    void SetSizeInPixels(const PixelSize& size);
+
+private:
+    PixelSize size_in_pixels_;
+};
+
 /** @} */
 
 inline float Texture::GetWidth() const
@@ -181,6 +232,11 @@ inline PixelSize Texture::GetSizeInPixels() const
     return size_in_pixels_;
 }
 
+inline size_t Texture::GetMemorySize() const
+{
+    return size_t(size_in_pixels_.x) * size_in_pixels_.y * 4;
+}
+
 inline InterpolationMode Texture::GetBitmapInterpolationMode() const
 {
     return interpolation_mode_;
@@ -196,4 +252,16 @@ inline void Texture::SetSizeInPixels(const PixelSize& size)
     size_in_pixels_ = size;
 }
 
+inline DecodedImage::DecodedImage() {}
+
+inline PixelSize DecodedImage::GetSizeInPixels() const
+{
+    return size_in_pixels_;
+}
+
+inline void DecodedImage::SetSizeInPixels(const PixelSize& size)
+{
+    size_in_pixels_ = size;
+}
+
 }  // namespace kiwano
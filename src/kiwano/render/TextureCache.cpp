@@ -32,46 +32,67 @@ TextureCache::~TextureCache()
 
 void TextureCache::AddTexture(size_t key, TexturePtr texture)
 {
-    texture_cache_[key] = texture;
+    cache_.Add(CacheKey{ key, false }, texture, texture ? texture->GetMemorySize() : 0);
 }
 
 void TextureCache::AddGifImage(size_t key, GifImagePtr gif)
 {
-    gif_texture_cache_[key] = gif;
+    cache_.Add(CacheKey{ key, true }, gif, gif ? gif->GetMemorySize() : 0);
 }
 
 TexturePtr TextureCache::GetTexture(size_t key) const
 {
-    if (texture_cache_.count(key))
-    {
-        return texture_cache_.at(key);
-    }
-    return TexturePtr();
+    return static_cast<Texture*>(cache_.Get(CacheKey{ key, false }).Get());
 }
 
 GifImagePtr TextureCache::GetGifImage(size_t key) const
 {
-    if (gif_texture_cache_.count(key))
-    {
-        return gif_texture_cache_.at(key);
-    }
-    return GifImagePtr();
+    return static_cast<GifImage*>(cache_.Get(CacheKey{ key, true }).Get());
 }
 
 void TextureCache::RemoveTexture(size_t key)
 {
-    texture_cache_.erase(key);
+    cache_.Remove(CacheKey{ key, false });
 }
 
 void TextureCache::RemoveGifImage(size_t key)
 {
-    gif_texture_cache_.erase(key);
+    cache_.Remove(CacheKey{ key, true });
 }
 
 void TextureCache::Clear()
 {
-    texture_cache_.clear();
-    gif_texture_cache_.clear();
+    cache_.Clear();
+}
+
+void TextureCache::SetMemoryBudget(size_t budget)
+{
+    cache_.SetMemoryBudget(budget);
+}
+
+size_t TextureCache::GetMemoryBudget() const
+{
+    return cache_.GetMemoryBudget();
+}
+
+size_t TextureCache::Trim()
+{
+    return cache_.Trim();
+}
+
+size_t TextureCache::Purge()
+{
+    return cache_.Purge();
+}
+
+const CacheStats& TextureCache::GetStats() const
+{
+    return cache_.GetStats();
+}
+
+void TextureCache::ResetStats()
+{
+    cache_.ResetStats();
 }
 
 }  // namespace kiwano
@@ -22,6 +22,7 @@
 #include <kiwano/render/GifImage.h>
 #include <kiwano/render/Texture.h>
 #include <kiwano/core/Singleton.h>
+#include <kiwano/core/LruCache.h>
 
 namespace kiwano
 {
@@ -32,7 +33,8 @@ namespace kiwano
 
 /**
  * \~chinese
- * @brief 
+ * @brief 纹理缓存
+ * @details 设置内存预算后，占用内存超出预算时将淘汰最久未使用、且只被缓存引用的纹理和GIF图像
  */
 class KGE_API TextureCache final : public Singleton<TextureCache>
 {
@@ -40,44 +42,87 @@ class KGE_API TextureCache final : public Singleton<TextureCache>
 
 public:
     /// \~chinese
-    /// @brief 
+    /// @brief 添加纹理缓存
     void AddTexture(size_t key, TexturePtr texture);
 
     /// \~chinese
-    /// @brief GIFͼ񻺴
+    /// @brief 添加GIF图像缓存
     void AddGifImage(size_t key, GifImagePtr gif);
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取纹理缓存
     TexturePtr GetTexture(size_t key) const;
 
     /// \~chinese
-    /// @brief ȡGIFͼ񻺴
+    /// @brief 获取GIF图像缓存
     GifImagePtr GetGifImage(size_t key) const;
 
     /// \~chinese
-    /// @brief Ƴ
+    /// @brief 移除纹理缓存
     void RemoveTexture(size_t key);
 
     /// \~chinese
-    /// @brief ƳGIFͼ񻺴
+    /// @brief 移除GIF图像缓存
     void RemoveGifImage(size_t key);
 
     /// \~chinese
-    /// @brief ջ
+    /// @brief 清空缓存
     void Clear();
 
+    /// \~chinese
+    /// @brief 设置内存预算
+    /// @param budget 内存预算（字节），为零时不限制
+    void SetMemoryBudget(size_t budget);
+
+    /// \~chinese
+    /// @brief 获取内存预算
+    size_t GetMemoryBudget() const;
+
+    /// \~chinese
+    /// @brief 淘汰最久未使用的纹理，直到占用内存不超过预算
+    /// @details 添加纹理时会自动淘汰，仍被使用的纹理释放后可以手动调用
+    /// @return 淘汰的纹理数量
+    size_t Trim();
+
+    /// \~chinese
+    /// @brief 淘汰所有只被缓存引用的纹理和GIF图像
+    /// @return 淘汰的纹理数量
+    size_t Purge();
+
+    /// \~chinese
+    /// @brief 获取统计数据
+    const CacheStats& GetStats() const;
+
+    /// \~chinese
+    /// @brief 重置命中、未命中和淘汰次数
+    void ResetStats();
+
     ~TextureCache();
 
 private:
     TextureCache();
 
 private:
-    using TextureMap = UnorderedMap<size_t, TexturePtr>;
-    TextureMap texture_cache_;
+    struct CacheKey
+    {
+        size_t hash;
+        bool   is_gif;
+
+        bool operator==(const CacheKey& rhs) const
+        {
+            return hash == rhs.hash && is_gif == rhs.is_gif;
+        }
+    };
+
+    struct CacheKeyHash
+    {
+        size_t operator()(const CacheKey& key) const
+        {
+            return key.hash ^ size_t(key.is_gif);
+        }
+    };
 
-    using GifImageMap = UnorderedMap<size_t, GifImagePtr>;
-    GifImageMap gif_texture_cache_;
+    mutable LruCache<CacheKey, NativeObjectPtr, CacheKeyHash> cache_;
 };
 
 /** @} */
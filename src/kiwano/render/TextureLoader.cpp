@@ -0,0 +1,487 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <kiwano/render/TextureLoader.h>
+#include <kiwano/render/TextureCache.h>
+#include <kiwano/render/Renderer.h>
+#include <kiwano/platform/Application.h>
+#include <functional>  // std::hash
+
+namespace kiwano
+{
+
+TextureLoadRequest::TextureLoadRequest()
+    : status_(Status::Loading)
+    , job_(nullptr)
+{
+}
+
+void TextureLoadRequest::Cancel()
+{
+    TextureLoader::GetInstance().Cancel(this);
+}
+
+void TextureLoadRequest::Wait()
+{
+    TextureLoader::GetInstance().Wait(this);
+}
+
+TextureLoadJob::TextureLoadJob()
+    : decoded_(false)
+    , finished_(false)
+    , is_gif_(false)
+    , from_file_(false)
+    , key_(0)
+    , canceled_(false)
+{
+}
+
+void TextureLoadJob::Decode()
+{
+    try
+    {
+        if (is_gif_)
+        {
+            if (from_file_)
+                gif_->Load(file_path_);
+            else
+                gif_->Load(data_);
+        }
+        else
+        {
+            if (from_file_)
+                Renderer::GetInstance().DecodeImage(*image_, file_path_);
+            else
+                Renderer::GetInstance().DecodeImage(*image_, data_);
+        }
+    }
+    catch (...)
+    {
+        // The object policy may throw after the failure is recorded, the request simply fails then
+    }
+}
+
+TextureLoader::TextureLoader()
+    : running_(false)
+    , upload_scheduled_(false)
+    , thread_count_(1)
+    , max_uploads_per_frame_(8)
+{
+    uint32_t cores = std::thread::hardware_concurrency();
+    if (cores > 2)
+    {
+        thread_count_ = std::min(cores - 1, 4u);
+    }
+}
+
+TextureLoader::~TextureLoader()
+{
+    Shutdown();
+}
+
+TextureLoadRequestPtr TextureLoader::LoadTexture(const String& file_path, Function<void(TexturePtr)> callback)
+{
+    TextureLoadRequest::Callback func;
+    if (callback)
+    {
+        func = [=](TextureLoadRequest& request) { callback(request.GetTexture()); };
+    }
+
+    TextureLoadJobPtr     job;
+    size_t                hash_code = std::hash<String>{}(file_path);
+    TextureLoadRequestPtr request   = AddRequest(false, hash_code, func, job);
+    if (job)
+    {
+        job->from_file_ = true;
+        job->file_path_ = file_path;
+        Enqueue(job);
+    }
+    return request;
+}
+
+TextureLoadRequestPtr TextureLoader::LoadTexture(const Resource& res, Function<void(TexturePtr)> callback)
+{
+    TextureLoadRequest::Callback func;
+    if (callback)
+    {
+        func = [=](TextureLoadRequest& request) { callback(request.GetTexture()); };
+    }
+
+    TextureLoadJobPtr     job;
+    TextureLoadRequestPtr request = AddRequest(false, res.GetId(), func, job);
+    if (job)
+    {
+        job->data_ = res.GetData();
+        Enqueue(job);
+    }
+    return request;
+}
+
+TextureLoadRequestPtr TextureLoader::LoadGifImage(const String& file_path, Function<void(GifImagePtr)> callback)
+{
+    TextureLoadRequest::Callback func;
+    if (callback)
+    {
+        func = [=](TextureLoadRequest& request) { callback(request.GetGifImage()); };
+    }
+
+    TextureLoadJobPtr     job;
+    size_t                hash_code = std::hash<String>{}(file_path);
+    TextureLoadRequestPtr request   = AddRequest(true, hash_code, func, job);
+    if (job)
+    {
+        job->from_file_ = true;
+        job->file_path_ = file_path;
+        Enqueue(job);
+    }
+    return request;
+}
+
+TextureLoadRequestPtr TextureLoader::LoadGifImage(const Resource& res, Function<void(GifImagePtr)> callback)
+{
+    TextureLoadRequest::Callback func;
+    if (callback)
+    {
+        func = [=](TextureLoadRequest& request) { callback(request.GetGifImage()); };
+    }
+
+    TextureLoadJobPtr     job;
+    TextureLoadRequestPtr request = AddRequest(true, res.GetId(), func, job);
+    if (job)
+    {
+        job->data_ = res.GetData();
+        Enqueue(job);
+    }
+    return request;
+}
+
+void TextureLoader::SetThreadCount(uint32_t count)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    thread_count_ = std::max(count, 1u);
+    if (running_)
+    {
+        while (workers_.size() < thread_count_)
+            workers_.emplace_back(&TextureLoader::WorkerMain, this);
+    }
+}
+
+void TextureLoader::SetMaxUploadsPerFrame(uint32_t count)
+{
+    max_uploads_per_frame_ = count;
+}
+
+size_t TextureLoader::GetPendingCount() const
+{
+    return loading_textures_.size() + loading_gifs_.size();
+}
+
+void TextureLoader::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+        cond_.notify_all();
+    }
+
+    for (auto& worker : workers_)
+    {
+        worker.join();
+    }
+    workers_.clear();
+
+    for (auto loading : { &loading_textures_, &loading_gifs_ })
+    {
+        for (auto& pair : *loading)
+        {
+            TextureLoadJobPtr job = pair.second;
+            for (auto& request : job->requests_)
+            {
+                request->status_   = TextureLoadRequest::Status::Canceled;
+                request->callback_ = nullptr;
+                request->job_      = nullptr;
+            }
+            job->requests_.clear();
+            job->canceled_ = true;
+        }
+        loading->clear();
+    }
+
+    queue_.clear();
+    decoded_.clear();
+    upload_scheduled_ = false;
+}
+
+TextureLoadRequestPtr TextureLoader::AddRequest(bool is_gif, size_t key, TextureLoadRequest::Callback callback,
+                                                TextureLoadJobPtr& created)
+{
+    TextureLoadRequestPtr request = new TextureLoadRequest;
+
+    created = nullptr;
+
+    TexturePtr  texture = is_gif ? nullptr : TextureCache::GetInstance().GetTexture(key);
+    GifImagePtr gif     = is_gif ? TextureCache::GetInstance().GetGifImage(key) : nullptr;
+    if (texture || gif)
+    {
+        request->status_  = TextureLoadRequest::Status::Completed;
+        request->texture_ = texture;
+        request->gif_     = gif;
+
+        // Callbacks are always called in a later frame, even if the texture is cached
+        if (callback)
+        {
+            Application::GetInstance().PreformInMainThread([=]() { callback(*request.Get()); });
+        }
+        return request;
+    }
+
+    auto&             loading = is_gif ? loading_gifs_ : loading_textures_;
+    auto              iter    = loading.find(key);
+    TextureLoadJobPtr job;
+    if (iter != loading.end())
+    {
+        job = iter->second;
+    }
+    else
+    {
+        job          = new TextureLoadJob;
+        job->is_gif_ = is_gif;
+        job->key_    = key;
+        if (is_gif)
+        {
+            job->gif_ = MakePtr<GifImage>();
+        }
+        else
+        {
+            job->image_   = MakePtr<DecodedImage>();
+            job->texture_ = MakePtr<Texture>();
+        }
+        loading.insert(std::make_pair(key, job));
+
+        created = job;
+    }
+
+    // Every caller gets its own request, so that it can be canceled without affecting the others
+    request->texture_  = job->texture_;
+    request->gif_      = job->gif_;
+    request->callback_ = callback;
+    request->job_      = job.Get();
+    job->requests_.push_back(request);
+    return request;
+}
+
+void TextureLoader::Enqueue(TextureLoadJobPtr job)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    running_ = true;
+    while (workers_.size() < thread_count_)
+        workers_.emplace_back(&TextureLoader::WorkerMain, this);
+
+    queue_.push_back(job);
+    cond_.notify_all();
+}
+
+void TextureLoader::Cancel(TextureLoadRequest* request)
+{
+    if (request->status_ != TextureLoadRequest::Status::Loading)
+        return;
+
+    TextureLoadRequestPtr hold = request;
+    TextureLoadJobPtr     job  = request->job_;
+
+    request->status_   = TextureLoadRequest::Status::Canceled;
+    request->callback_ = nullptr;
+    request->job_      = nullptr;
+
+    auto& requests = job->requests_;
+    requests.erase(std::find(requests.begin(), requests.end(), hold));
+    if (!requests.empty())
+        return;
+
+    // Nobody is waiting for the job any more
+    job->canceled_ = true;
+
+    auto& loading = job->is_gif_ ? loading_gifs_ : loading_textures_;
+    loading.erase(job->key_);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto iter = std::find(queue_.begin(), queue_.end(), job);
+    if (iter != queue_.end())
+    {
+        queue_.erase(iter);
+    }
+}
+
+void TextureLoader::Wait(TextureLoadRequest* request)
+{
+    if (request->status_ != TextureLoadRequest::Status::Loading)
+        return;
+
+    TextureLoadJobPtr job = request->job_;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        auto iter = std::find(queue_.begin(), queue_.end(), job);
+        if (iter != queue_.end())
+        {
+            // Not picked up by any worker yet, decode it here instead of waiting for the queue
+            queue_.erase(iter);
+
+            lock.unlock();
+            job->Decode();
+            lock.lock();
+
+            job->decoded_ = true;
+        }
+        else
+        {
+            cond_.wait(lock, [&]() { return job->decoded_; });
+        }
+    }
+    Finish(job.Get());
+}
+
+void TextureLoader::Finish(TextureLoadJob* job)
+{
+    if (job->finished_ || job->canceled_)
+        return;
+
+    TextureLoadJobPtr hold = job;
+    job->finished_         = true;
+
+    auto& loading = job->is_gif_ ? loading_gifs_ : loading_textures_;
+    loading.erase(job->key_);
+
+    // A failed decoding has been reported by the object policy on the worker thread
+    bool succeeded = false;
+    if (job->is_gif_)
+    {
+        succeeded = job->gif_->IsValid();
+        if (succeeded)
+        {
+            TextureCache::GetInstance().AddGifImage(job->key_, job->gif_);
+        }
+    }
+    else
+    {
+        succeeded = job->image_->IsValid() && job->texture_->Load(*job->image_);
+        if (succeeded)
+        {
+            TextureCache::GetInstance().AddTexture(job->key_, job->texture_);
+        }
+        job->image_ = nullptr;
+    }
+
+    // Update all the requests before calling back, a callback may cancel or wait on the others
+    auto requests = std::move(job->requests_);
+    for (auto& request : requests)
+    {
+        request->status_ = succeeded ? TextureLoadRequest::Status::Completed : TextureLoadRequest::Status::Failed;
+        request->job_    = nullptr;
+    }
+
+    for (auto& request : requests)
+    {
+        auto callback = std::move(request->callback_);
+        if (callback)
+        {
+            callback(*request);
+        }
+    }
+}
+
+void TextureLoader::Upload()
+{
+    Vector<TextureLoadJobPtr> jobs;
+    bool                      more = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        size_t count = decoded_.size();
+        if (max_uploads_per_frame_ && count > max_uploads_per_frame_)
+        {
+            count = max_uploads_per_frame_;
+        }
+
+        jobs.assign(decoded_.begin(), decoded_.begin() + count);
+        decoded_.erase(decoded_.begin(), decoded_.begin() + count);
+
+        more              = !decoded_.empty();
+        upload_scheduled_ = more;
+    }
+
+    for (auto& job : jobs)
+    {
+        Finish(job.Get());
+    }
+
+    if (more)
+    {
+        // Spread the remaining uploads over the next frames
+        Application::GetInstance().PreformInMainThread([this]() { Upload(); });
+    }
+}
+
+void TextureLoader::WorkerMain()
+{
+#if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_DIRECTX
+    // WIC decoders are created and used on this thread
+    ::CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+#endif
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        cond_.wait(lock, [this]() { return !queue_.empty() || !running_; });
+        if (!running_)
+            break;
+
+        TextureLoadJobPtr job = queue_.front();
+        queue_.pop_front();
+
+        lock.unlock();
+        if (!job->canceled_)
+        {
+            job->Decode();
+        }
+        lock.lock();
+
+        job->decoded_ = true;
+        cond_.notify_all();
+
+        // Jobs are always released on the main thread
+        decoded_.push_back(job);
+        if (!upload_scheduled_)
+        {
+            upload_scheduled_ = true;
+            Application::GetInstance().PreformInMainThread([this]() { Upload(); });
+        }
+    }
+    lock.unlock();
+
+#if KGE_RENDER_ENGINE == KGE_RENDER_ENGINE_DIRECTX
+    ::CoUninitialize();
+#endif
+}
+
+}  // namespace kiwano
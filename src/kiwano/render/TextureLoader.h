@@ -0,0 +1,240 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <kiwano/core/Singleton.h>
+#include <kiwano/render/GifImage.h>
+#include <kiwano/render/Texture.h>
+
+namespace kiwano
+{
+
+KGE_DECLARE_SMART_PTR(TextureLoadRequest);
+KGE_DECLARE_SMART_PTR(TextureLoadJob);
+
+/**
+ * \addtogroup Render
+ * @{
+ */
+
+/**
+ * \~chinese
+ * @brief 异步纹理加载请求
+ * @details 请求的方法只能在主线程中调用
+ */
+class KGE_API TextureLoadRequest : public RefObject
+{
+    friend class TextureLoader;
+
+public:
+    /// \~chinese
+    /// @brief 请求状态
+    enum class Status
+    {
+        Loading,    ///< 正在加载
+        Completed,  ///< 加载完成
+        Failed,     ///< 加载失败
+        Canceled    ///< 已取消
+    };
+
+    /// \~chinese
+    /// @brief 获取请求状态
+    Status GetStatus() const;
+
+    /// \~chinese
+    /// @brief 请求是否已结束
+    bool IsDone() const;
+
+    /// \~chinese
+    /// @brief 获取纹理，纹理在加载完成前无效
+    TexturePtr GetTexture() const;
+
+    /// \~chinese
+    /// @brief 获取GIF图像，GIF图像在加载完成前无效
+    GifImagePtr GetGifImage() const;
+
+    /// \~chinese
+    /// @brief 取消请求
+    /// @details 尚未完成的请求将不再调用回调函数。同一文件的异步加载共享同一次解码，
+    /// 取消只影响当前请求，所有请求都取消后才会停止解码
+    void Cancel();
+
+    /// \~chinese
+    /// @brief 阻塞等待加载完成
+    /// @details 若请求仍在排队，则直接在当前线程中解码。返回时回调函数已被调用
+    void Wait();
+
+private:
+    TextureLoadRequest();
+
+private:
+    using Callback = Function<void(TextureLoadRequest&)>;
+
+    Status          status_;
+    TexturePtr      texture_;
+    GifImagePtr     gif_;
+    Callback        callback_;
+    TextureLoadJob* job_;
+};
+
+/**
+ * \~chinese
+ * @brief 纹理解码任务
+ * @details 由异步纹理加载器内部使用，同一文件的所有请求共享同一个任务
+ */
+class KGE_API TextureLoadJob : public RefObject
+{
+    friend class TextureLoader;
+
+private:
+    TextureLoadJob();
+
+    void Decode();
+
+private:
+    bool                          decoded_;
+    bool                          finished_;
+    bool                          is_gif_;
+    bool                          from_file_;
+    size_t                        key_;
+    String                        file_path_;
+    BinaryData                    data_;
+    DecodedImagePtr               image_;
+    TexturePtr                    texture_;
+    GifImagePtr                   gif_;
+    Vector<TextureLoadRequestPtr> requests_;
+    std::atomic<bool>             canceled_;
+};
+
+/**
+ * \~chinese
+ * @brief 异步纹理加载器
+ * @details 在工作线程中读取并解码图片，解码完成后在主线程中创建纹理并加入纹理缓存。
+ * 每帧创建的纹理数量有限，避免大量纹理同时完成时造成卡顿
+ */
+class KGE_API TextureLoader final : public Singleton<TextureLoader>
+{
+    friend Singleton<TextureLoader>;
+    friend class TextureLoadRequest;
+
+public:
+    /// \~chinese
+    /// @brief 异步加载本地图片
+    TextureLoadRequestPtr LoadTexture(const String& file_path, Function<void(TexturePtr)> callback);
+
+    /// \~chinese
+    /// @brief 异步加载图片资源
+    TextureLoadRequestPtr LoadTexture(const Resource& res, Function<void(TexturePtr)> callback);
+
+    /// \~chinese
+    /// @brief 异步加载本地GIF图片
+    TextureLoadRequestPtr LoadGifImage(const String& file_path, Function<void(GifImagePtr)> callback);
+
+    /// \~chinese
+    /// @brief 异步加载GIF图片资源
+    TextureLoadRequestPtr LoadGifImage(const Resource& res, Function<void(GifImagePtr)> callback);
+
+    /// \~chinese
+    /// @brief 设置工作线程数量
+    /// @details 默认为处理器核心数减一，最少一个、最多四个。在工作线程启动后设置时，只能增加线程数量
+    void SetThreadCount(uint32_t count);
+
+    /// \~chinese
+    /// @brief 获取工作线程数量
+    uint32_t GetThreadCount() const;
+
+    /// \~chinese
+    /// @brief 设置每帧最多完成的请求数量
+    /// @param count 请求数量，为零时不限制
+    void SetMaxUploadsPerFrame(uint32_t count);
+
+    /// \~chinese
+    /// @brief 获取尚未完成的解码任务数量
+    size_t GetPendingCount() const;
+
+    /// \~chinese
+    /// @brief 取消所有请求并停止工作线程
+    void Shutdown();
+
+    ~TextureLoader();
+
+private:
+    TextureLoader();
+
+    TextureLoadRequestPtr AddRequest(bool is_gif, size_t key, TextureLoadRequest::Callback callback,
+                                     TextureLoadJobPtr& created);
+
+    void Enqueue(TextureLoadJobPtr job);
+
+    void Cancel(TextureLoadRequest* request);
+
+    void Wait(TextureLoadRequest* request);
+
+    void Finish(TextureLoadJob* job);
+
+    void Upload();
+
+    void WorkerMain();
+
+private:
+    bool                                        running_;
+    bool                                        upload_scheduled_;
+    uint32_t                                    thread_count_;
+    uint32_t                                    max_uploads_per_frame_;
+    UnorderedMap<size_t, TextureLoadJobPtr>     loading_textures_;
+    UnorderedMap<size_t, TextureLoadJobPtr>     loading_gifs_;
+    Deque<TextureLoadJobPtr>                    queue_;
+    Deque<TextureLoadJobPtr>                    decoded_;
+    Vector<std::thread>                         workers_;
+    mutable std::mutex                          mutex_;
+    std::condition_variable                     cond_;
+};
+
+/** @} */
+
+inline TextureLoadRequest::Status TextureLoadRequest::GetStatus() const
+{
+    return status_;
+}
+
+inline bool TextureLoadRequest::IsDone() const
+{
+    return status_ != Status::Loading;
+}
+
+inline TexturePtr TextureLoadRequest::GetTexture() const
+{
+    return texture_;
+}
+
+inline GifImagePtr TextureLoadRequest::GetGifImage() const
+{
+    return gif_;
+}
+
+inline uint32_t TextureLoader::GetThreadCount() const
+{
+    return thread_count_;
+}
+
+}  // namespace kiwano
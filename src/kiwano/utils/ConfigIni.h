@@ -28,164 +28,164 @@ namespace kiwano
 KGE_DECLARE_SMART_PTR(ConfigIni);
 
 /// \~chinese
-/// @brief iniʽļ
+/// @brief ini格式文件
 class KGE_API ConfigIni : public ObjectBase
 {
 public:
     /// \~chinese
-    /// @brief ֵֵ
+    /// @brief 键值字典
     typedef UnorderedMap<String, String> ValueMap;
 
     /// \~chinese
-    /// @brief Sectionֵ
+    /// @brief Section字典
     typedef UnorderedMap<String, ValueMap> SectionMap;
 
     ConfigIni();
 
     /// \~chinese
-    /// @brief  ini ļ
-    /// @param file_path ļ·
+    /// @brief 加载 ini 文件
+    /// @param file_path 文件路径
     ConfigIni(const String& file_path);
 
     /// \~chinese
-    /// @brief  ini ļ
-    /// @param file_path ļ·
+    /// @brief 加载 ini 文件
+    /// @param file_path 文件路径
     bool Load(const String& file_path);
 
     /// \~chinese
-    /// @brief  ini ļ
-    /// @param is 
+    /// @brief 加载 ini 文件
+    /// @param is 输入流
     bool Load(std::istream& is);
 
     /// \~chinese
-    /// @brief  ini ʽַ
-    /// @param content 
+    /// @brief 加载 ini 格式字符串
+    /// @param content 输入内容
     bool LoadFromString(const String& content);
 
     /// \~chinese
-    /// @brief  ini ļ
-    /// @param file_path ļ·
+    /// @brief 保存至 ini 文件
+    /// @param file_path 文件路径
     bool Save(const String& file_path);
 
     /// \~chinese
-    /// @brief  ini ļ
-    /// @param os 
+    /// @brief 保存至 ini 文件
+    /// @param os 输出流
     bool Save(std::ostream& os);
 
     /// \~chinese
-    /// @brief ַ
-    /// @param content 
+    /// @brief 保存至字符串
+    /// @param content 输出内容
     bool SaveToString(String& content);
 
     /// \~chinese
-    /// @brief Ƿsection
-    /// @param section section
+    /// @brief 是否存在section
+    /// @param section section的名称
     bool HasSection(const String& section) const;
 
     /// \~chinese
-    /// @brief Ƿֵ
-    /// @param section section
-    /// @param key key
+    /// @brief 是否存在值
+    /// @param section section的名称
+    /// @param key key的名称
     bool HasKey(const String& section, const String& key) const;
 
     /// \~chinese
-    /// @brief ȡsection
+    /// @brief 获取所有section
     SectionMap GetSectionMap() const;
 
     /// \~chinese
-    /// @brief ȡsection
-    /// @param section section
+    /// @brief 获取section
+    /// @param section section的名称
     ValueMap GetSection(const String& section) const;
 
     /// \~chinese
-    /// @brief ȡֵ
-    /// @param section section
-    /// @param key key
+    /// @brief 获取值
+    /// @param section section的名称
+    /// @param key key的名称
     String GetString(const String& section, const String& key, const String& default_value = String()) const;
 
     /// \~chinese
-    /// @brief ȡֵ
-    /// @param section section
-    /// @param key key
-    /// @param default_value ʱĬֵ
+    /// @brief 获取值
+    /// @param section section的名称
+    /// @param key key的名称
+    /// @param default_value 不存在时的默认值
     float GetFloat(const String& section, const String& key, float default_value = 0.0f) const;
 
     /// \~chinese
-    /// @brief ȡֵ
-    /// @param section section
-    /// @param key key
-    /// @param default_value ʱĬֵ
+    /// @brief 获取值
+    /// @param section section的名称
+    /// @param key key的名称
+    /// @param default_value 不存在时的默认值
     double GetDouble(const String& section, const String& key, double default_value = 0.0) const;
 
     /// \~chinese
-    /// @brief ȡֵ
-    /// @param section section
-    /// @param key key
-    /// @param default_value ʱĬֵ
+    /// @brief 获取值
+    /// @param section section的名称
+    /// @param key key的名称
+    /// @param default_value 不存在时的默认值
     int GetInt(const String& section, const String& key, int default_value = 0) const;
 
     /// \~chinese
-    /// @brief ȡֵ
-    /// @param section section
-    /// @param key key
-    /// @param default_value ʱĬֵ
+    /// @brief 获取值
+    /// @param section section的名称
+    /// @param key key的名称
+    /// @param default_value 不存在时的默认值
     bool GetBool(const String& section, const String& key, bool default_value = false) const;
 
     /// \~chinese
-    /// @brief section
-    /// @param sections sectionֵ
+    /// @brief 设置所有section
+    /// @param sections section字典
     void SetSectionMap(const SectionMap& sections);
 
     /// \~chinese
-    /// @brief section
-    /// @param section section
-    /// @param values ֵֵ
+    /// @brief 设置section
+    /// @param section section的名称
+    /// @param values 键值字典
     void SetSection(const String& section, const ValueMap& values);
 
     /// \~chinese
-    /// @brief ֵ
-    /// @param section section
-    /// @param key key
-    /// @param value ֵ
+    /// @brief 设置值
+    /// @param section section的名称
+    /// @param key key的名称
+    /// @param value 值
     void SetString(const String& section, const String& key, const String& value);
 
     /// \~chinese
-    /// @brief ֵ
-    /// @param section section
-    /// @param key key
-    /// @param value ֵ
+    /// @brief 设置值
+    /// @param section section的名称
+    /// @param key key的名称
+    /// @param value 值
     void SetFloat(const String& section, const String& key, float value);
 
     /// \~chinese
-    /// @brief ֵ
-    /// @param section section
-    /// @param key key
-    /// @param value ֵ
+    /// @brief 设置值
+    /// @param section section的名称
+    /// @param key key的名称
+    /// @param value 值
     void SetDouble(const String& section, const String& key, double value);
 
     /// \~chinese
-    /// @brief ֵ
-    /// @param section section
-    /// @param key key
-    /// @param value ֵ
+    /// @brief 设置值
+    /// @param section section的名称
+    /// @param key key的名称
+    /// @param value 值
     void SetInt(const String& section, const String& key, int value);
 
     /// \~chinese
-    /// @brief ֵ
-    /// @param section section
-    /// @param key key
-    /// @param value ֵ
+    /// @brief 设置值
+    /// @param section section的名称
+    /// @param key key的名称
+    /// @param value 值
     void SetBool(const String& section, const String& key, bool value);
 
     /// \~chinese
-    /// @brief ɾsection
-    /// @param section section
+    /// @brief 删除section
+    /// @param section section的名称
     void DeleteSection(const String& section);
 
     /// \~chinese
-    /// @brief ɾֵ
-    /// @param section section
-    /// @param key key
+    /// @brief 删除值
+    /// @param section section的名称
+    /// @param key key的名称
     void DeleteKey(const String& section, const String& key);
 
     ValueMap& operator[](const String& section);
@@ -35,7 +35,7 @@ KGE_DECLARE_SMART_PTR(EventTicker);
  */
 
 /// \~chinese
-/// @brief ʱʱ
+/// @brief 报时时间
 class KGE_API TickEvent : public Event
 {
 public:
@@ -51,7 +51,7 @@ public:
 
 
 /// \~chinese
-/// @brief ¼ʱ
+/// @brief 事件报时器
 class KGE_API EventTicker
     : public Ticker
     , public EventDispatcher
@@ -60,9 +60,9 @@ public:
     EventTicker();
 
     /// \~chinese
-    /// @brief ¼ʱ
-    /// @param interval ʱ
-    /// @param tick_count ʱ -1 Ϊã
+    /// @brief 创建事件报时器
+    /// @param interval 报时间隔
+    /// @param tick_count 报时次数（设 -1 为永久）
     EventTicker(Duration interval, int tick_count = -1);
 
     using Ticker::Tick;
@@ -26,7 +26,7 @@ namespace kiwano
 {
 
 /// \~chinese
-/// @brief JSON
+/// @brief JSON对象容器
 using Json = nlohmann::basic_json<Map, Vector, String>;
 
 }  // namespace kiwano
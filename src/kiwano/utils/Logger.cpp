@@ -19,6 +19,8 @@
 // THE SOFTWARE.
 
 #include <ctime>
+#include <climits>
+#include <cstdarg>
 #include <ios>
 #include <fstream>
 #include <iostream>
@@ -410,7 +412,7 @@ LogBuffer::int_type LogBuffer::overflow(int_type ch)
 
     seek_high_ = new_pnext + 1;
 
-    this->setp(new_ptr, new_pnext, new_ptr + new_size);
+    SetPutArea(new_ptr, new_pnext, new_ptr + new_size);
     this->setg(new_ptr, new_ptr + (this->gptr() - old_ptr), seek_high_);
     return ch;
 }
@@ -467,7 +469,7 @@ LogBuffer::pos_type LogBuffer::seekpos(pos_type pos, std::ios_base::openmode mod
 
     if ((mode & std::ios_base::out) && olg_pptr)
     {
-        this->setp(seek_low, new_ptr, this->epptr());
+        SetPutArea(seek_low, new_ptr, this->epptr());
     }
     return pos_type(offset);
 }
@@ -537,11 +539,18 @@ LogBuffer::pos_type LogBuffer::seekoff(off_type offset, std::ios_base::seekdir w
 
     if ((mode & std::ios_base::out) && old_pptr)
     {
-        this->setp(seek_low, new_ptr, this->epptr());
+        SetPutArea(seek_low, new_ptr, this->epptr());
     }
     return pos_type(offset);
 }
 
+void LogBuffer::SetPutArea(char_type* begin, char_type* next, char_type* end)
+{
+    // The standard setp only takes the range, the put pointer is moved afterwards
+    this->setp(begin, end);
+    this->pbump(static_cast<int>(next - begin));
+}
+
 //
 // Logger
 //
@@ -585,7 +594,7 @@ void Logger::Logf(LogLevel level, const char* format, ...)
 
     std::lock_guard<std::mutex> lock(mutex_);
 
-    va_list args = nullptr;
+    va_list args;
     va_start(args, format);
 
     // build message
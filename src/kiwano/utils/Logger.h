@@ -31,7 +31,7 @@
 #ifdef KGE_DEBUG
 #define KGE_DEBUG_LOG(...) ::kiwano::Logger::GetInstance().Log(::kiwano::LogLevel::Debug, __VA_ARGS__)
 #else
-#define KGE_DEBUG_LOG __noop
+#define KGE_DEBUG_LOG(...) ((void)0)
 #endif
 #endif
 
@@ -53,26 +53,26 @@
 
 #ifndef KGE_DEBUG_LOGF
 #ifdef KGE_DEBUG
-#define KGE_DEBUG_LOGF(FORMAT, ...) ::kiwano::Logger::GetInstance().Logf(::kiwano::LogLevel::Debug, FORMAT, __VA_ARGS__)
+#define KGE_DEBUG_LOGF(FORMAT, ...) ::kiwano::Logger::GetInstance().Logf(::kiwano::LogLevel::Debug, FORMAT, ##__VA_ARGS__)
 #else
-#define KGE_DEBUG_LOGF __noop
+#define KGE_DEBUG_LOGF(...) ((void)0)
 #endif
 #endif
 
 #ifndef KGE_LOGF
-#define KGE_LOGF(FORMAT, ...) ::kiwano::Logger::GetInstance().Logf(::kiwano::LogLevel::Info, FORMAT, __VA_ARGS__)
+#define KGE_LOGF(FORMAT, ...) ::kiwano::Logger::GetInstance().Logf(::kiwano::LogLevel::Info, FORMAT, ##__VA_ARGS__)
 #endif
 
 #ifndef KGE_NOTICEF
-#define KGE_NOTICEF(FORMAT, ...) ::kiwano::Logger::GetInstance().Logf(::kiwano::LogLevel::Notice, FORMAT, __VA_ARGS__)
+#define KGE_NOTICEF(FORMAT, ...) ::kiwano::Logger::GetInstance().Logf(::kiwano::LogLevel::Notice, FORMAT, ##__VA_ARGS__)
 #endif
 
 #ifndef KGE_WARNF
-#define KGE_WARNF(FORMAT, ...) ::kiwano::Logger::GetInstance().Logf(::kiwano::LogLevel::Warning, FORMAT, __VA_ARGS__)
+#define KGE_WARNF(FORMAT, ...) ::kiwano::Logger::GetInstance().Logf(::kiwano::LogLevel::Warning, FORMAT, ##__VA_ARGS__)
 #endif
 
 #ifndef KGE_ERRORF
-#define KGE_ERRORF(FORMAT, ...) ::kiwano::Logger::GetInstance().Logf(::kiwano::LogLevel::Error, FORMAT, __VA_ARGS__)
+#define KGE_ERRORF(FORMAT, ...) ::kiwano::Logger::GetInstance().Logf(::kiwano::LogLevel::Error, FORMAT, ##__VA_ARGS__)
 #endif
 
 #ifndef KGE_THROW
@@ -122,20 +122,20 @@ KGE_DECLARE_SMART_PTR(LogProvider);
 
 /**
  * \~chinese
- * @brief ־ȼ
+ * @brief 日志等级
  */
 enum class LogLevel
 {
-    Debug,    ///< 
-    Info,     ///< Ϣ
-    Notice,   ///< ע
-    Warning,  ///< 
-    Error,    ///< 
+    Debug,    ///< 调试
+    Info,     ///< 信息
+    Notice,   ///< 注意
+    Warning,  ///< 警告
+    Error,    ///< 错误
 };
 
 /**
  * \~chinese
- * @brief ־ʽ
+ * @brief 日志格式化
  */
 class KGE_API LogFormater : public ObjectBase
 {
@@ -149,7 +149,7 @@ public:
 
 /**
  * \~chinese
- * @brief ־
+ * @brief 日志流缓冲
  */
 class KGE_API LogBuffer : public std::streambuf
 {
@@ -176,6 +176,9 @@ protected:
     pos_type seekoff(off_type off, std::ios_base::seekdir dir,
                      std::ios_base::openmode which = std::ios_base::in) override;
 
+private:
+    void SetPutArea(char_type* begin, char_type* next, char_type* end);
+
 private:
     Vector<char_type> buf_;
     char_type*        seek_high_;
@@ -183,7 +186,7 @@ private:
 
 /**
  * \~chinese
- * @brief ־
+ * @brief 日志生产者
  */
 class KGE_API LogProvider : public ObjectBase
 {
@@ -209,7 +212,7 @@ protected:
 
 /**
  * \~chinese
- * @brief ̨־
+ * @brief 控制台日志生产者
  */
 class KGE_API ConsoleLogProvider : public LogProvider
 {
@@ -233,7 +236,7 @@ private:
 
 /**
  * \~chinese
- * @brief ļ־
+ * @brief 文件日志生产者
  */
 class KGE_API FileLogProvider : public LogProvider
 {
@@ -255,7 +258,7 @@ private:
 
 /**
  * \~chinese
- * @brief ־¼
+ * @brief 日志记录器
  */
 class KGE_API Logger final : public Singleton<Logger>
 {
@@ -263,56 +266,56 @@ class KGE_API Logger final : public Singleton<Logger>
 
 public:
     /// \~chinese
-    /// @brief ӡ־
-    /// @param level ־
-    /// @param format ʽַ
+    /// @brief 打印日志
+    /// @param level 日志级别
+    /// @param format 格式字符串
     void Logf(LogLevel level, const char* format, ...);
 
     /// \~chinese
-    /// @brief ӡ־
-    /// @param level ־
-    /// @param args 
+    /// @brief 打印日志
+    /// @param level 日志级别
+    /// @param args 参数
     template <typename... _Args>
     void Log(LogLevel level, _Args&&... args);
 
     /// \~chinese
-    /// @brief ˢ־
+    /// @brief 刷新日志缓冲
     void Flush();
 
     /// \~chinese
-    /// @brief ־
+    /// @brief 启用日志
     void Enable();
 
     /// \~chinese
-    /// @brief ־
+    /// @brief 禁用日志
     void Disable();
 
     /// \~chinese
-    /// @brief ־ȼ
+    /// @brief 设置日志等级
     void SetLevel(LogLevel level);
 
     /// \~chinese
-    /// @brief ־
-    /// @param provider ־
+    /// @brief 添加日志生产者
+    /// @param provider 日志生产者
     void AddProvider(LogProviderPtr provider);
 
     /// \~chinese
-    /// @brief ־ʽ
-    /// @param formater ־ʽ
+    /// @brief 设置日志格式
+    /// @param formater 日志格式化
     void SetFormater(LogFormaterPtr formater);
 
     /// \~chinese
-    /// @brief ȡ־ʽ
-    /// @return ־ʽ
+    /// @brief 获取日志格式
+    /// @return 日志格式
     LogFormaterPtr GetFormater();
 
     /// \~chinese
-    /// @brief 軺С
-    /// @param buffer_size С
+    /// @brief 重设缓冲区大小
+    /// @param buffer_size 缓冲区大小
     void ResizeBuffer(size_t buffer_size);
 
     /// \~chinese
-    /// @brief ʾرտ̨
+    /// @brief 显示或关闭控制台
     void ShowConsole(bool show);
 
     virtual ~Logger();
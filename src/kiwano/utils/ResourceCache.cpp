@@ -20,6 +20,8 @@
 
 #include <kiwano/utils/ResourceCache.h>
 #include <kiwano/utils/ResourceLoader.h>
+#include <kiwano/2d/animation/FrameSequence.h>
+#include <kiwano/render/GifImage.h>
 
 namespace kiwano
 {
@@ -45,27 +47,98 @@ bool ResourceCache::LoadFromXmlFile(const String& file_path)
     return IsValid();
 }
 
+bool ResourceCache::LoadFromPack(const String& file_path, const String& manifest)
+{
+    ResourcePackPtr pack = MakePtr<ResourcePack>();
+    if (!pack->Open(file_path))
+    {
+        SetStatus(*pack->GetStatus());
+        return false;
+    }
+
+    ResourceLoader loader(*this);
+    loader.LoadFromPack(pack, manifest);
+    return IsValid();
+}
+
 void ResourceCache::AddObject(const String& id, ObjectBasePtr obj)
 {
-    object_cache_[id] = obj;
+    object_cache_.Add(id, obj, GetMemorySize(obj.Get()));
 }
 
 void ResourceCache::Remove(const String& id)
 {
-    object_cache_.erase(id);
+    object_cache_.Remove(id);
 }
 
 void ResourceCache::Clear()
 {
-    object_cache_.clear();
+    object_cache_.Clear();
 }
 
 ObjectBasePtr ResourceCache::Get(const String& id) const
 {
-    auto iter = object_cache_.find(id);
-    if (iter == object_cache_.end())
-        return nullptr;
-    return (*iter).second;
+    return object_cache_.Get(id);
+}
+
+void ResourceCache::SetMemoryBudget(size_t budget)
+{
+    object_cache_.SetMemoryBudget(budget);
+}
+
+size_t ResourceCache::GetMemoryBudget() const
+{
+    return object_cache_.GetMemoryBudget();
+}
+
+size_t ResourceCache::Trim()
+{
+    return object_cache_.Trim();
+}
+
+size_t ResourceCache::Purge()
+{
+    return object_cache_.Purge();
+}
+
+const CacheStats& ResourceCache::GetStats() const
+{
+    return object_cache_.GetStats();
+}
+
+void ResourceCache::ResetStats()
+{
+    object_cache_.ResetStats();
+}
+
+size_t ResourceCache::GetMemorySize(const ObjectBase* obj)
+{
+    if (auto texture = dynamic_cast<const Texture*>(obj))
+    {
+        return texture->GetMemorySize();
+    }
+
+    if (auto gif = dynamic_cast<const GifImage*>(obj))
+    {
+        return gif->GetMemorySize();
+    }
+
+    if (auto frame_seq = dynamic_cast<const FrameSequence*>(obj))
+    {
+        // Frames split from one texture share it
+        size_t              memory = 0;
+        UnorderedSet<void*> textures;
+        for (const auto& frame : frame_seq->GetFrames())
+        {
+            TexturePtr texture = frame.GetTexture();
+            if (texture && textures.insert(texture.Get()).second)
+            {
+                memory += texture->GetMemorySize();
+            }
+        }
+        return memory;
+    }
+    return 0;
 }
 
 }  // namespace kiwano
@@ -20,6 +20,7 @@
 
 #pragma once
 #include <kiwano/core/Resource.h>
+#include <kiwano/core/LruCache.h>
 #include <kiwano/base/ObjectBase.h>
 
 namespace kiwano
@@ -28,7 +29,9 @@ namespace kiwano
 KGE_DECLARE_SMART_PTR(ResourceCache);
 
 /// \~chinese
-/// @brief Դ
+/// @brief 资源缓存
+/// @details 设置内存预算后，占用内存超出预算时将淘汰最久未使用、且只被缓存引用的资源。
+/// 被淘汰的资源无法再通过 Get 获取，需要重新加载
 class KGE_API ResourceCache final : public ObjectBase
 {
 public:
@@ -37,25 +40,32 @@ public:
     virtual ~ResourceCache();
 
     /// \~chinese
-    /// @brief  JSON ļԴϢ
-    /// @param file_path JSONļ·
+    /// @brief 从 JSON 文件加载资源信息
+    /// @param file_path JSON文件路径
     bool LoadFromJsonFile(const String& file_path);
 
     /// \~chinese
-    /// @brief  XML ļԴϢ
-    /// @param file_path XMLļ·
+    /// @brief 从 XML 文件加载资源信息
+    /// @param file_path XML文件路径
     bool LoadFromXmlFile(const String& file_path);
 
     /// \~chinese
-    /// @brief ȡԴ
-    /// @param id ID
+    /// @brief 从资源包加载资源信息
+    /// @details 从资源包加载的字体和GIF图像直接使用资源包中的数据，并共享持有资源包的内存映射
+    /// @param file_path 资源包文件路径
+    /// @param manifest 资源包中资源信息文件的名称，支持 JSON 和 XML 格式
+    bool LoadFromPack(const String& file_path, const String& manifest);
+
+    /// \~chinese
+    /// @brief 获取资源
+    /// @param id 对象ID
     ObjectBasePtr Get(const String& id) const;
 
     /// \~chinese
-    /// @brief ȡԴ
-    /// @tparam _Ty 
-    /// @param id ID
-    /// @return ָ͵ָ
+    /// @brief 获取资源
+    /// @tparam _Ty 对象类型
+    /// @param id 对象ID
+    /// @return 指定对象类型的指针
     template <typename _Ty>
     RefPtr<_Ty> Get(const String& id) const
     {
@@ -63,22 +73,54 @@ public:
     }
 
     /// \~chinese
-    /// @brief 뻺
-    /// @param id ID
-    /// @param obj 
+    /// @brief 将对象放入缓存
+    /// @param id 对象ID
+    /// @param obj 对象
     void AddObject(const String& id, ObjectBasePtr obj);
 
     /// \~chinese
-    /// @brief ɾָԴ
-    /// @param id ID
+    /// @brief 删除指定资源
+    /// @param id 对象ID
     void Remove(const String& id);
 
     /// \~chinese
-    /// @brief Դ
+    /// @brief 清空所有资源
     void Clear();
 
+    /// \~chinese
+    /// @brief 设置内存预算
+    /// @param budget 内存预算（字节），为零时不限制
+    void SetMemoryBudget(size_t budget);
+
+    /// \~chinese
+    /// @brief 获取内存预算
+    size_t GetMemoryBudget() const;
+
+    /// \~chinese
+    /// @brief 淘汰最久未使用的资源，直到占用内存不超过预算
+    /// @return 淘汰的资源数量
+    size_t Trim();
+
+    /// \~chinese
+    /// @brief 淘汰所有只被缓存引用的资源
+    /// @return 淘汰的资源数量
+    size_t Purge();
+
+    /// \~chinese
+    /// @brief 获取统计数据
+    const CacheStats& GetStats() const;
+
+    /// \~chinese
+    /// @brief 重置命中、未命中和淘汰次数
+    void ResetStats();
+
+    /// \~chinese
+    /// @brief 估算资源占用的内存大小（字节）
+    /// @details 支持纹理、GIF图像和序列帧，其他资源的大小视为零，不受内存预算限制
+    static size_t GetMemorySize(const ObjectBase* obj);
+
 private:
-    UnorderedMap<String, ObjectBasePtr> object_cache_;
+    mutable LruCache<String, ObjectBasePtr> object_cache_;
 };
 
 }  // namespace kiwano
@@ -33,20 +33,20 @@ namespace kiwano
 namespace resource_cache_01
 {
 
-void LoadJsonData(ResourceCache* cache, const Json& json_data);
-void LoadXmlData(ResourceCache* cache, const XmlNode& elem);
+void LoadJsonData(ResourceCache* cache, ResourcePack* pack, const Json& json_data);
+void LoadXmlData(ResourceCache* cache, ResourcePack* pack, const XmlNode& elem);
 
 }  // namespace resource_cache_01
 
 namespace
 {
 
-Map<String, Function<void(ResourceCache*, const Json&)>> load_json_funcs = {
+Map<String, Function<void(ResourceCache*, ResourcePack*, const Json&)>> load_json_funcs = {
     { "latest", resource_cache_01::LoadJsonData },
     { "0.1", resource_cache_01::LoadJsonData },
 };
 
-Map<String, Function<void(ResourceCache*, const XmlNode&)>> load_xml_funcs = {
+Map<String, Function<void(ResourceCache*, ResourcePack*, const XmlNode&)>> load_xml_funcs = {
     { "latest", resource_cache_01::LoadXmlData },
     { "0.1", resource_cache_01::LoadXmlData },
 };
@@ -55,6 +55,7 @@ Map<String, Function<void(ResourceCache*, const XmlNode&)>> load_xml_funcs = {
 
 ResourceLoader::ResourceLoader(ResourceCache& cache)
     : cache_(cache)
+    , pack_(nullptr)
 {
 }
 
@@ -103,11 +104,11 @@ void ResourceLoader::LoadFromJson(const Json& json_data)
         auto load = load_json_funcs.find(version);
         if (load != load_json_funcs.end())
         {
-            load->second(&cache_, json_data);
+            load->second(&cache_, pack_, json_data);
         }
         else if (version.empty())
         {
-            load_json_funcs["latest"](&cache_, json_data);
+            load_json_funcs["latest"](&cache_, pack_, json_data);
         }
         else
         {
@@ -155,11 +156,11 @@ void ResourceLoader::LoadFromXml(const XmlDocument& doc)
         auto load = load_xml_funcs.find(version);
         if (load != load_xml_funcs.end())
         {
-            load->second(&cache_, root);
+            load->second(&cache_, pack_, root);
         }
         else if (version.empty())
         {
-            load_xml_funcs["latest"](&cache_, root);
+            load_xml_funcs["latest"](&cache_, pack_, root);
         }
         else
         {
@@ -172,6 +173,58 @@ void ResourceLoader::LoadFromXml(const XmlDocument& doc)
     }
 }
 
+void ResourceLoader::LoadFromPack(ResourcePackPtr pack, const String& manifest)
+{
+    if (!pack || !pack->IsOpened())
+    {
+        cache_.Fail("ResourceLoader::LoadFromPack failed: resource pack is not opened");
+        return;
+    }
+
+    BinaryData data = pack->GetData(manifest);
+    if (!data.IsValid())
+    {
+        cache_.Fail(strings::Format("ResourceLoader::LoadFromPack failed: [%s] not found in resource pack.",
+                                    manifest.c_str()));
+        return;
+    }
+
+    const char* begin = static_cast<const char*>(data.GetBuffer());
+    const char* end   = begin + data.GetSize();
+
+    pack_ = pack.Get();
+
+    if (manifest.size() > 4 && manifest.compare(manifest.size() - 4, 4, ".xml") == 0)
+    {
+        XmlDocument doc;
+
+        auto result = doc.load_buffer(begin, size_t(data.GetSize()));
+        if (result)
+        {
+            LoadFromXml(doc);
+        }
+        else
+        {
+            cache_.Fail(strings::Format("ResourceLoader::LoadFromPack failed: XML file [%s] parsed with errors: %s",
+                                        manifest.c_str(), result.description()));
+        }
+    }
+    else
+    {
+        try
+        {
+            LoadFromJson(Json::parse(begin, end));
+        }
+        catch (Json::exception& e)
+        {
+            cache_.Fail(strings::Format("ResourceLoader::LoadFromPack failed: Json file [%s] parsed with errors: %s",
+                                        manifest.c_str(), e.what()));
+        }
+    }
+
+    pack_ = nullptr;
+}
+
 }  // namespace kiwano
 
 namespace kiwano
@@ -180,16 +233,67 @@ namespace resource_cache_01
 {
 struct GlobalData
 {
-    String path;
+    String        path;
+    ResourcePack* pack = nullptr;
+
+    // Files are looked up in the pack by their full path first, and then by the name in the manifest
+    BinaryData GetPackedData(const String& file) const
+    {
+        BinaryData data;
+        if (pack && !file.empty())
+        {
+            data = pack->GetData(path + file);
+            if (!data.IsValid())
+                data = pack->GetData(file);
+        }
+        return data;
+    }
 };
 
+bool LoadTexture(GlobalData* gdata, Texture& texture, const String& file)
+{
+    BinaryData data = gdata->GetPackedData(file);
+    if (data.IsValid())
+        return texture.Load(data);
+    return texture.Load(gdata->path + file);
+}
+
+bool LoadSpriteFrame(GlobalData* gdata, SpriteFrame& frame, const String& file)
+{
+    BinaryData data = gdata->GetPackedData(file);
+    if (data.IsValid())
+    {
+        TexturePtr texture = MakePtr<Texture>();
+        if (texture && texture->Load(data))
+        {
+            frame.SetTexture(texture);
+            return true;
+        }
+        return false;
+    }
+    return frame.Load(gdata->path + file);
+}
+
 void LoadTexturesFromData(ResourceCache* cache, GlobalData* gdata, const String& id, const String& type,
                           const String& file)
 {
     if (type == "gif")
     {
         // GIF image
-        GifImagePtr gif = GifImage::Preload(gdata->path + file);
+        GifImagePtr gif;
+
+        BinaryData data = gdata->GetPackedData(file);
+        if (data.IsValid())
+        {
+            gif = MakePtr<GifImage>();
+            if (gif && !gif->Load(data))
+                gif = nullptr;
+        }
+        else
+        {
+            gif = GifImage::Preload(gdata->path + file);
+        }
+
         if (gif)
         {
             cache->AddObject(id, gif);
@@ -200,7 +304,7 @@ void LoadTexturesFromData(ResourceCache* cache, GlobalData* gdata, const String&
     {
         // Simple image
         TexturePtr texture = MakePtr<Texture>();
-        if (texture && texture->Load(gdata->path + file))
+        if (texture && LoadTexture(gdata, *texture, file))
         {
             cache->AddObject(id, texture);
             return;
@@ -221,7 +325,7 @@ void LoadTexturesFromData(ResourceCache* cache, GlobalData* gdata, const String&
     for (const auto& file : files)
     {
         SpriteFrame frame;
-        if (frame.Load(gdata->path + file))
+        if (LoadSpriteFrame(gdata, frame, file))
         {
             frames.push_back(frame);
         }
@@ -249,7 +353,7 @@ void LoadTexturesFromData(ResourceCache* cache, GlobalData* gdata, const String&
         {
             // KeyFrame slices
             SpriteFrame frame;
-            if (frame.Load(gdata->path + file))
+            if (LoadSpriteFrame(gdata, frame, file))
             {
                 FrameSequencePtr frame_seq = MakePtr<FrameSequence>();
                 if (frame_seq)
@@ -264,7 +368,7 @@ void LoadTexturesFromData(ResourceCache* cache, GlobalData* gdata, const String&
         {
             // Simple image
             TexturePtr texture = MakePtr<Texture>();
-            if (texture && texture->Load(gdata->path + file))
+            if (texture && LoadTexture(gdata, *texture, file))
             {
                 cache->AddObject(id, texture);
                 return;
@@ -277,7 +381,14 @@ void LoadTexturesFromData(ResourceCache* cache, GlobalData* gdata, const String&
 
 void LoadFontsFromData(ResourceCache* cache, GlobalData* gdata, const String& id, const String& file)
 {
-    FontPtr font = Font::Preload(gdata->path + file);
+    FontPtr font;
+
+    BinaryData data = gdata->GetPackedData(file);
+    if (data.IsValid())
+        font = Font::Preload(data);
+    else
+        font = Font::Preload(gdata->path + file);
+
     if (font)
     {
         cache->AddObject(id, font);
@@ -286,9 +397,10 @@ void LoadFontsFromData(ResourceCache* cache, GlobalData* gdata, const String& id
     cache->Fail(strings::Format("%s failed", __FUNCTION__));
 }
 
-void LoadJsonData(ResourceCache* cache, const Json& json_data)
+void LoadJsonData(ResourceCache* cache, ResourcePack* pack, const Json& json_data)
 {
     GlobalData global_data;
+    global_data.pack = pack;
     if (json_data.count("path"))
     {
         global_data.path = json_data["path"].get<String>();
@@ -358,9 +470,10 @@ void LoadJsonData(ResourceCache* cache, const Json& json_data)
     }
 }
 
-void LoadXmlData(ResourceCache* cache, const XmlNode& elem)
+void LoadXmlData(ResourceCache* cache, ResourcePack* pack, const XmlNode& elem)
 {
     GlobalData global_data;
+    global_data.pack = pack;
     if (auto path = elem.child("path"))
     {
         global_data.path = path.child_value();
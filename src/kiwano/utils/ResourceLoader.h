@@ -22,6 +22,7 @@
 #include <kiwano/core/Common.h>
 #include <kiwano/utils/Json.h>
 #include <kiwano/utils/Xml.h>
+#include <kiwano/utils/ResourcePack.h>
 
 namespace kiwano
 {
@@ -29,34 +30,42 @@ namespace kiwano
 class ResourceCache;
 
 /// \~chinese
-/// @brief Դ
+/// @brief 资源加载器
 class KGE_API ResourceLoader final
 {
 public:
     ResourceLoader(ResourceCache& cache);
 
     /// \~chinese
-    /// @brief  JSON ļԴϢ
-    /// @param file_path JSONļ·
+    /// @brief 从 JSON 文件加载资源信息
+    /// @param file_path JSON文件路径
     void LoadFromJsonFile(const String& file_path);
 
     /// \~chinese
-    /// @brief  JSON ԴϢ
-    /// @param json_data JSON
+    /// @brief 从 JSON 加载资源信息
+    /// @param json_data JSON对象
     void LoadFromJson(const Json& json_data);
 
     /// \~chinese
-    /// @brief  XML ļԴϢ
-    /// @param file_path XMLļ·
+    /// @brief 从 XML 文件加载资源信息
+    /// @param file_path XML文件路径
     void LoadFromXmlFile(const String& file_path);
 
     /// \~chinese
-    /// @brief  XML ĵԴϢ
-    /// @param doc XMLĵ
+    /// @brief 从 XML 文档对象加载资源信息
+    /// @param doc XML文档对象
     void LoadFromXml(const XmlDocument& doc);
 
+    /// \~chinese
+    /// @brief 从资源包加载资源信息
+    /// @details 资源信息中的文件优先从资源包中读取，资源包中不存在的文件从本地读取
+    /// @param pack 资源包
+    /// @param manifest 资源包中资源信息文件的名称，扩展名为 .xml 时按 XML 格式解析，否则按 JSON 格式解析
+    void LoadFromPack(ResourcePackPtr pack, const String& manifest);
+
 private:
     ResourceCache& cache_;
+    ResourcePack*  pack_;
 };
 
 }  // namespace kiwano
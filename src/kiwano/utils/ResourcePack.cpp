@@ -0,0 +1,495 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <fstream>
+#include <kiwano/platform/FileSystem.h>
+#include <kiwano/utils/Logger.h>
+#include <kiwano/utils/ResourcePack.h>
+
+namespace kiwano
+{
+
+namespace
+{
+
+//
+// LZ4 block format
+// https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+//
+
+const size_t   LZ4_MIN_MATCH     = 4;
+const size_t   LZ4_LAST_LITERALS = 5;   // The last 5 bytes are always literals
+const size_t   LZ4_MF_LIMIT      = 12;  // The last match starts at least 12 bytes before the end
+const size_t   LZ4_MAX_OFFSET    = 65535;
+const uint32_t LZ4_HASH_LOG      = 16;
+
+inline uint32_t ReadUInt32(const uint8_t* p)
+{
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint32_t HashSequence(uint32_t sequence)
+{
+    return (sequence * 2654435761U) >> (32 - LZ4_HASH_LOG);
+}
+
+void WriteLength(Vector<uint8_t>& output, size_t length)
+{
+    for (; length >= 255; length -= 255)
+        output.push_back(255);
+    output.push_back(uint8_t(length));
+}
+
+void WriteSequence(Vector<uint8_t>& output, const uint8_t* literals, size_t literal_length, size_t offset,
+                   size_t match_length)
+{
+    const size_t match_code = match_length ? match_length - LZ4_MIN_MATCH : 0;
+
+    output.push_back(uint8_t((std::min<size_t>(literal_length, 15) << 4) | std::min<size_t>(match_code, 15)));
+    if (literal_length >= 15)
+        WriteLength(output, literal_length - 15);
+
+    output.insert(output.end(), literals, literals + literal_length);
+
+    // The last sequence only contains literals
+    if (match_length)
+    {
+        output.push_back(uint8_t(offset & 0xFF));
+        output.push_back(uint8_t(offset >> 8));
+        if (match_code >= 15)
+            WriteLength(output, match_code - 15);
+    }
+}
+
+void CompressLZ4(const uint8_t* src, size_t size, Vector<uint8_t>& output)
+{
+    output.clear();
+    output.reserve(size + size / 255 + 16);
+
+    size_t anchor = 0;
+    if (size > LZ4_MF_LIMIT)
+    {
+        Vector<uint32_t> table(size_t(1) << LZ4_HASH_LOG, 0);
+
+        const size_t match_limit  = size - LZ4_LAST_LITERALS;
+        const size_t search_limit = size - LZ4_MF_LIMIT;
+
+        size_t pos = 1;
+        while (pos < search_limit)
+        {
+            const uint32_t sequence  = ReadUInt32(src + pos);
+            const uint32_t hash      = HashSequence(sequence);
+            const size_t   candidate = table[hash];
+            table[hash]              = uint32_t(pos);
+
+            if (pos - candidate > LZ4_MAX_OFFSET || ReadUInt32(src + candidate) != sequence)
+            {
+                ++pos;
+                continue;
+            }
+
+            size_t length = LZ4_MIN_MATCH;
+            while (pos + length < match_limit && src[candidate + length] == src[pos + length])
+                ++length;
+
+            WriteSequence(output, src + anchor, pos - anchor, pos - candidate, length);
+
+            pos += length;
+            anchor = pos;
+        }
+    }
+
+    WriteSequence(output, src + anchor, size - anchor, 0, 0);
+}
+
+bool ReadLength(const uint8_t*& ip, const uint8_t* iend, size_t& length)
+{
+    uint8_t byte = 0;
+    do
+    {
+        if (ip >= iend)
+            return false;
+        byte = *ip++;
+        length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+bool DecompressLZ4(const uint8_t* src, size_t size, uint8_t* dest, size_t dest_size)
+{
+    const uint8_t* ip   = src;
+    const uint8_t* iend = src + size;
+    uint8_t*       op   = dest;
+    uint8_t*       oend = dest + dest_size;
+
+    while (ip < iend)
+    {
+        const uint8_t token = *ip++;
+
+        size_t literal_length = token >> 4;
+        if (literal_length == 15 && !ReadLength(ip, iend, literal_length))
+            return false;
+
+        if (literal_length > size_t(iend - ip) || literal_length > size_t(oend - op))
+            return false;
+
+        std::memcpy(op, ip, literal_length);
+        op += literal_length;
+        ip += literal_length;
+
+        if (ip == iend)
+            break;
+
+        if (iend - ip < 2)
+            return false;
+
+        const size_t offset = size_t(ip[0]) | (size_t(ip[1]) << 8);
+        ip += 2;
+
+        if (offset == 0 || offset > size_t(op - dest))
+            return false;
+
+        size_t match_length = token & 15;
+        if (match_length == 15 && !ReadLength(ip, iend, match_length))
+            return false;
+        match_length += LZ4_MIN_MATCH;
+
+        if (match_length > size_t(oend - op))
+            return false;
+
+        const uint8_t* match = op - offset;
+        if (offset >= match_length)
+        {
+            std::memcpy(op, match, match_length);
+        }
+        else
+        {
+            // Overlapped matches repeat the last bytes
+            for (size_t i = 0; i < match_length; ++i)
+                op[i] = match[i];
+        }
+        op += match_length;
+    }
+    return op == oend;
+}
+
+}  // namespace
+
+ResourcePack::ResourcePack() {}
+
+ResourcePack::ResourcePack(const String& file_path)
+    : ResourcePack()
+{
+    Open(file_path);
+}
+
+ResourcePack::~ResourcePack()
+{
+    Close();
+}
+
+bool ResourcePack::Open(const String& file_path)
+{
+    Close();
+
+    if (!FileSystem::GetInstance().IsFileExists(file_path))
+    {
+        Fail(strings::Format("ResourcePack::Open failed: [%s] file not found.", file_path.c_str()));
+        return false;
+    }
+
+    String full_path = FileSystem::GetInstance().GetFullPathForFile(file_path);
+
+    mapping_ = BinaryData::FromFile(full_path);
+
+    if (!mapping_.IsValid())
+    {
+        Fail(strings::Format("ResourcePack::Open failed: cannot map file [%s].", file_path.c_str()));
+        return false;
+    }
+
+    if (!ReadIndex())
+    {
+        entries_.clear();
+        mapping_ = BinaryData();
+        Fail(strings::Format("ResourcePack::Open failed: [%s] is not a valid resource pack.", file_path.c_str()));
+        return false;
+    }
+    return true;
+}
+
+void ResourcePack::Close()
+{
+    std::lock_guard<std::mutex> lock(decompressed_mutex_);
+
+    decompressed_.clear();
+    entries_.clear();
+    mapping_ = BinaryData();
+}
+
+bool ResourcePack::ReadIndex()
+{
+    const uint8_t* view      = mapping_.GetBytes();
+    const uint64_t view_size = mapping_.GetSize();
+
+    Header header;
+    if (view_size < sizeof(header))
+        return false;
+
+    std::memcpy(&header, view, sizeof(header));
+    if (header.magic != MAGIC || header.version != VERSION)
+        return false;
+
+    if (header.index_offset > view_size || header.index_size > view_size - header.index_offset)
+        return false;
+
+    const uint8_t* ip   = view + header.index_offset;
+    const uint8_t* iend = ip + header.index_size;
+
+    entries_.reserve(header.entry_count);
+    for (uint32_t i = 0; i < header.entry_count; ++i)
+    {
+        IndexEntry entry;
+        if (size_t(iend - ip) < sizeof(entry))
+            return false;
+
+        std::memcpy(&entry, ip, sizeof(entry));
+        ip += sizeof(entry);
+
+        if (entry.name_length > size_t(iend - ip))
+            return false;
+
+        // Blobs are stored before the index
+        if (entry.offset > header.index_offset || entry.size > header.index_offset - entry.offset)
+            return false;
+
+        if (entry.original_size > SIZE_MAX)
+            return false;
+
+        String name(reinterpret_cast<const char*>(ip), entry.name_length);
+        ip += entry.name_length;
+
+        entries_.emplace(std::move(name), entry);
+    }
+    return true;
+}
+
+bool ResourcePack::Contains(const String& name) const
+{
+    return entries_.count(NormalizeName(name)) != 0;
+}
+
+BinaryData ResourcePack::GetData(const String& name) const
+{
+    String key  = NormalizeName(name);
+    auto   iter = entries_.find(key);
+    if (iter == entries_.end())
+        return BinaryData();
+
+    const IndexEntry& entry = iter->second;
+    if (!(entry.flags & EntryFlag::Compressed))
+    {
+        return mapping_.Slice(entry.offset, entry.size);
+    }
+
+    std::lock_guard<std::mutex> lock(decompressed_mutex_);
+
+    auto decompressed = decompressed_.find(key);
+    if (decompressed == decompressed_.end())
+    {
+        Vector<uint8_t> buffer(size_t(entry.original_size));
+        if (!DecompressLZ4(mapping_.GetBytes() + entry.offset, size_t(entry.size), buffer.data(), buffer.size()))
+        {
+            KGE_ERRORF("ResourcePack::GetData failed: entry [%s] is corrupted", key.c_str());
+            return BinaryData();
+        }
+        decompressed = decompressed_.emplace(key, BinaryData(std::move(buffer))).first;
+    }
+    return decompressed->second;
+}
+
+Vector<String> ResourcePack::GetEntryNames() const
+{
+    Vector<String> names;
+    names.reserve(entries_.size());
+    for (const auto& pair : entries_)
+    {
+        names.push_back(pair.first);
+    }
+    return names;
+}
+
+String ResourcePack::NormalizeName(const String& name)
+{
+    String result = name;
+    std::replace(result.begin(), result.end(), '\\', '/');
+
+    size_t start = 0;
+    while (true)
+    {
+        if (result.compare(start, 2, "./") == 0)
+            start += 2;
+        else if (result.compare(start, 1, "/") == 0)
+            start += 1;
+        else
+            break;
+    }
+    return result.substr(start);
+}
+
+ResourcePackWriter::ResourcePackWriter(uint32_t alignment)
+    : alignment_(alignment)
+{
+    KGE_ASSERT(alignment && (alignment & (alignment - 1)) == 0 && "Alignment must be a power of 2");
+}
+
+bool ResourcePackWriter::AddFile(const String& name, const String& file_path, bool compress)
+{
+    if (!FileSystem::GetInstance().IsFileExists(file_path))
+    {
+        KGE_ERRORF("ResourcePackWriter::AddFile failed: [%s] file not found.", file_path.c_str());
+        return false;
+    }
+
+    String        full_path = FileSystem::GetInstance().GetFullPathForFile(file_path);
+    std::ifstream ifs(full_path.c_str(), std::ios::binary);
+    if (!ifs)
+    {
+        KGE_ERRORF("ResourcePackWriter::AddFile failed: cannot open file [%s].", file_path.c_str());
+        return false;
+    }
+
+    Vector<uint8_t> content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    AddData(name, BinaryData(std::move(content)), compress);
+    return true;
+}
+
+void ResourcePackWriter::AddData(const String& name, const BinaryData& data, bool compress)
+{
+    Entry entry;
+    entry.name          = ResourcePack::NormalizeName(name);
+    entry.original_size = data.GetSize();
+    entry.flags         = 0;
+
+    const uint8_t* buffer = data.GetBytes();
+    const size_t   size   = size_t(data.GetSize());
+    if (compress && size)
+    {
+        CompressLZ4(buffer, size, entry.data);
+        if (entry.data.size() < size)
+        {
+            entry.flags |= ResourcePack::EntryFlag::Compressed;
+        }
+    }
+
+    if (!(entry.flags & ResourcePack::EntryFlag::Compressed))
+    {
+        entry.data.assign(buffer, buffer + size);
+    }
+
+    // Entries with the same name are replaced
+    auto iter = std::find_if(entries_.begin(), entries_.end(), [&](const Entry& e) { return e.name == entry.name; });
+    if (iter != entries_.end())
+    {
+        *iter = std::move(entry);
+    }
+    else
+    {
+        entries_.push_back(std::move(entry));
+    }
+}
+
+bool ResourcePackWriter::Save(const String& file_path) const
+{
+    std::ofstream ofs(file_path.c_str(), std::ios::binary | std::ios::trunc);
+    if (!ofs)
+    {
+        KGE_ERRORF("ResourcePackWriter::Save failed: cannot open file [%s].", file_path.c_str());
+        return false;
+    }
+
+    ResourcePack::Header header = {};
+    header.magic                = ResourcePack::MAGIC;
+    header.version              = ResourcePack::VERSION;
+    header.entry_count          = uint32_t(entries_.size());
+    header.alignment            = alignment_;
+
+    // The header is written again after the index offset is known
+    ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    const char padding[256] = {};
+
+    uint64_t         offset = sizeof(header);
+    Vector<uint64_t> offsets;
+    offsets.reserve(entries_.size());
+    for (const auto& entry : entries_)
+    {
+        const uint64_t aligned = (offset + alignment_ - 1) & ~uint64_t(alignment_ - 1);
+        for (uint64_t pad = aligned - offset; pad > 0;)
+        {
+            const size_t n = size_t(std::min<uint64_t>(pad, sizeof(padding)));
+            ofs.write(padding, n);
+            pad -= n;
+        }
+
+        ofs.write(reinterpret_cast<const char*>(entry.data.data()), entry.data.size());
+
+        offsets.push_back(aligned);
+        offset = aligned + entry.data.size();
+    }
+
+    header.index_offset = offset;
+    for (size_t i = 0; i < entries_.size(); ++i)
+    {
+        const auto& entry = entries_[i];
+
+        ResourcePack::IndexEntry index = {};
+        index.offset                   = offsets[i];
+        index.size                     = entry.data.size();
+        index.original_size            = entry.original_size;
+        index.flags                    = entry.flags;
+        index.name_length              = uint32_t(entry.name.size());
+
+        ofs.write(reinterpret_cast<const char*>(&index), sizeof(index));
+        ofs.write(entry.name.data(), entry.name.size());
+
+        offset += sizeof(index) + entry.name.size();
+    }
+    header.index_size = offset - header.index_offset;
+
+    ofs.seekp(0);
+    ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    if (!ofs)
+    {
+        KGE_ERRORF("ResourcePackWriter::Save failed: cannot write file [%s].", file_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+void ResourcePackWriter::Clear()
+{
+    entries_.clear();
+}
+
+}  // namespace kiwano
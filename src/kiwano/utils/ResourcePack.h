@@ -0,0 +1,195 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include <mutex>
+#include <kiwano/core/Common.h>
+#include <kiwano/core/BinaryData.h>
+#include <kiwano/base/ObjectBase.h>
+
+namespace kiwano
+{
+
+KGE_DECLARE_SMART_PTR(ResourcePack);
+
+/**
+ * \~chinese
+ * @brief 资源包
+ * @details 资源包将大量小文件打包为一个文件，打开时将整个文件映射到内存，获取资源数据时不需要再打开文件或复制数据。
+ * 资源包的格式（小端序）：
+ *   - 文件头：魔数 "KPAK"、版本号、条目数量、数据对齐字节数、索引偏移和索引大小
+ *   - 数据块：每个条目的数据，起始位置按对齐字节数对齐
+ *   - 索引：每个条目的数据偏移、存储大小、原始大小、标志位、名称长度和名称
+ * 条目可以使用 LZ4 块格式压缩，压缩的条目在首次获取时解压，解压后的数据由资源包缓存
+ * @note 获取的数据直接指向映射的内存并共享持有映射，资源包关闭后数据仍然有效
+ */
+class KGE_API ResourcePack : public ObjectBase
+{
+public:
+    /// \~chinese
+    /// @brief 资源包条目标志
+    enum EntryFlag : uint32_t
+    {
+        Compressed = 1,  ///< 使用 LZ4 块格式压缩
+    };
+
+    ResourcePack();
+
+    /// \~chinese
+    /// @brief 打开资源包
+    /// @param file_path 资源包文件路径
+    ResourcePack(const String& file_path);
+
+    virtual ~ResourcePack();
+
+    /// \~chinese
+    /// @brief 打开资源包
+    /// @param file_path 资源包文件路径
+    bool Open(const String& file_path);
+
+    /// \~chinese
+    /// @brief 关闭资源包
+    void Close();
+
+    /// \~chinese
+    /// @brief 资源包是否已打开
+    bool IsOpened() const;
+
+    /// \~chinese
+    /// @brief 资源包中是否包含条目
+    /// @param name 条目名称
+    bool Contains(const String& name) const;
+
+    /// \~chinese
+    /// @brief 获取条目数据
+    /// @param name 条目名称
+    /// @return 条目数据，条目不存在或解压失败时返回无效数据
+    BinaryData GetData(const String& name) const;
+
+    /// \~chinese
+    /// @brief 获取所有条目的名称
+    Vector<String> GetEntryNames() const;
+
+    /// \~chinese
+    /// @brief 获取条目数量
+    size_t GetEntryCount() const;
+
+    /// \~chinese
+    /// @brief 规范化条目名称
+    /// @details 统一使用正斜杠作为分隔符，并去掉开头的 "./" 和 "/"
+    static String NormalizeName(const String& name);
+
+public:
+    static const uint32_t MAGIC   = 0x4B41504B;  // "KPAK"
+    static const uint32_t VERSION = 1;
+
+    /// \~chinese
+    /// @brief 资源包文件头
+    struct Header
+    {
+        uint32_t magic;         ///< 魔数
+        uint32_t version;       ///< 版本号
+        uint32_t entry_count;   ///< 条目数量
+        uint32_t alignment;     ///< 数据对齐字节数
+        uint64_t index_offset;  ///< 索引偏移
+        uint64_t index_size;    ///< 索引大小
+    };
+
+    /// \~chinese
+    /// @brief 资源包索引项，名称紧跟在索引项之后
+    struct IndexEntry
+    {
+        uint64_t offset;         ///< 数据偏移
+        uint64_t size;           ///< 存储大小
+        uint64_t original_size;  ///< 原始大小
+        uint32_t flags;          ///< 标志位
+        uint32_t name_length;    ///< 名称长度
+    };
+
+private:
+    bool ReadIndex();
+
+private:
+    BinaryData                               mapping_;
+    UnorderedMap<String, IndexEntry>         entries_;
+    mutable std::mutex                       decompressed_mutex_;
+    mutable UnorderedMap<String, BinaryData> decompressed_;
+};
+
+/**
+ * \~chinese
+ * @brief 资源包写入器
+ * @details 用于在工具或编辑器中生成资源包
+ */
+class KGE_API ResourcePackWriter : protected Noncopyable
+{
+public:
+    /// \~chinese
+    /// @brief 创建资源包写入器
+    /// @param alignment 数据对齐字节数，必须为 2 的幂
+    ResourcePackWriter(uint32_t alignment = 16);
+
+    /// \~chinese
+    /// @brief 添加文件
+    /// @param name 条目名称
+    /// @param file_path 文件路径
+    /// @param compress 是否压缩，压缩后没有变小的数据按原样保存
+    bool AddFile(const String& name, const String& file_path, bool compress = false);
+
+    /// \~chinese
+    /// @brief 添加数据
+    /// @param name 条目名称
+    /// @param data 数据
+    /// @param compress 是否压缩，压缩后没有变小的数据按原样保存
+    void AddData(const String& name, const BinaryData& data, bool compress = false);
+
+    /// \~chinese
+    /// @brief 保存资源包
+    /// @param file_path 资源包文件路径
+    bool Save(const String& file_path) const;
+
+    /// \~chinese
+    /// @brief 清空所有条目
+    void Clear();
+
+private:
+    struct Entry
+    {
+        String          name;
+        uint64_t        original_size;
+        uint32_t        flags;
+        Vector<uint8_t> data;
+    };
+
+    uint32_t      alignment_;
+    Vector<Entry> entries_;
+};
+
+inline bool ResourcePack::IsOpened() const
+{
+    return mapping_.IsValid();
+}
+
+inline size_t ResourcePack::GetEntryCount() const
+{
+    return entries_.size();
+}
+
+}  // namespace kiwano
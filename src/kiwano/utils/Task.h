@@ -29,8 +29,8 @@ class TaskScheduler;
 KGE_DECLARE_SMART_PTR(Task);
 
 /// \~chinese
-/// @brief 
-/// @details ÿһʱִһλصҿִָܴ
+/// @brief 任务
+/// @details 任务用于每隔一段时间执行一次回调函数，且可以指定执行总次数
 class KGE_API Task
     : public ObjectBase
     , protected IntrusiveListValue<TaskPtr>
@@ -40,86 +40,86 @@ class KGE_API Task
 
 public:
     /// \~chinese
-    /// @brief ص
+    /// @brief 任务回调函数
     /// @details
-    /// صһڶʱ
+    /// 回调函数第一个参数是任务自身，第二个参数是时间增量
     using Callback = Function<void(Task* /* self */, Duration /* dt */)>;
 
     /// \~chinese
-    /// @brief 
-    /// @param cb ص
-    /// @param ʱ
+    /// @brief 创建任务
+    /// @param cb 回调函数
+    /// @param 报时器
     Task(const Callback& cb, TickerPtr ticker);
 
     /// \~chinese
-    /// @brief 
-    /// @param name 
-    /// @param cb ص
-    /// @param ʱ
+    /// @brief 创建任务
+    /// @param name 名称
+    /// @param cb 回调函数
+    /// @param 报时器
     Task(const String& name, const Callback& cb, TickerPtr ticker);
 
     /// \~chinese
-    /// @brief 
-    /// @param cb ص
-    /// @param interval ʱ
-    /// @param times ִд -1 ΪִУ
+    /// @brief 创建任务
+    /// @param cb 回调函数
+    /// @param interval 时间间隔
+    /// @param times 执行次数（设 -1 为永久执行）
     Task(const Callback& cb, Duration interval, int times = -1);
 
     /// \~chinese
-    /// @brief 
-    /// @param name 
-    /// @param cb ص
-    /// @param interval ʱ
-    /// @param times ִд -1 ΪִУ
+    /// @brief 创建任务
+    /// @param name 名称
+    /// @param cb 回调函数
+    /// @param interval 时间间隔
+    /// @param times 执行次数（设 -1 为永久执行）
     Task(const String& name, const Callback& cb, Duration interval, int times = -1);
 
     /// \~chinese
-    /// @brief 
+    /// @brief 构造空任务
     Task();
 
     /// \~chinese
-    /// @brief 
+    /// @brief 启动任务
     void Start();
 
     /// \~chinese
-    /// @brief ֹͣ
+    /// @brief 停止任务
     void Stop();
 
     /// \~chinese
-    /// @brief Ƴ
+    /// @brief 移除任务
     void Remove();
 
     /// \~chinese
-    /// @brief Ƿ
+    /// @brief 任务是否在运行
     bool IsRunning() const;
 
     /// \~chinese
-    /// @brief ǷƳ
+    /// @brief 任务是否可移除
     bool IsRemoveable() const;
 
     /// \~chinese
-    /// @brief ȡص
+    /// @brief 获取任务回调函数
     Callback GetCallback() const;
 
     /// \~chinese
-    /// @brief ص
+    /// @brief 设置任务回调函数
     void SetCallback(const Callback& callback);
 
     /// \~chinese
-    /// @brief ȡıʱ
+    /// @brief 获取任务的报时器
     TickerPtr GetTicker() const;
 
     /// \~chinese
-    /// @brief ıʱ
+    /// @brief 设置任务的报时器
     void SetTicker(TickerPtr ticker);
 
 private:
     /// \~chinese
-    /// @brief 
+    /// @brief 更新任务
     void Update(Duration dt);
 
     /// \~chinese
-    /// @brief 
+    /// @brief 重置任务
     void Reset();
 
 private:
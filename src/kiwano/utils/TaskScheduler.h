@@ -25,78 +25,78 @@ namespace kiwano
 {
 
 /// \~chinese
-/// @brief б
+/// @brief 任务列表
 typedef IntrusiveList<TaskPtr> TaskList;
 
 /**
  * \~chinese
- * @brief 
+ * @brief 任务调度器
  */
 class KGE_API TaskScheduler : Noncopyable
 {
 public:
     /// \~chinese
-    /// @brief 
+    /// @brief 添加任务
     Task* AddTask(TaskPtr task);
 
     /// \~chinese
-    /// @brief 
-    /// @param cb ص
-    /// @param ʱ
+    /// @brief 添加任务
+    /// @param cb 回调函数
+    /// @param 报时器
     Task* AddTask(const Task::Callback& cb, TickerPtr ticker);
 
     /// \~chinese
-    /// @brief 
-    /// @param name 
-    /// @param cb ص
-    /// @param ʱ
+    /// @brief 添加任务
+    /// @param name 名称
+    /// @param cb 回调函数
+    /// @param 报时器
     Task* AddTask(const String& name, const Task::Callback& cb, TickerPtr ticker);
 
     /// \~chinese
-    /// @brief 
-    /// @param cb ص
-    /// @param interval ʱ
-    /// @param times ִд -1 ΪִУ
+    /// @brief 添加任务
+    /// @param cb 回调函数
+    /// @param interval 时间间隔
+    /// @param times 执行次数（设 -1 为永久执行）
     Task* AddTask(const Task::Callback& cb, Duration interval, int times = -1);
 
     /// \~chinese
-    /// @brief 
-    /// @param name 
-    /// @param cb ص
-    /// @param interval ʱ
-    /// @param times ִд -1 ΪִУ
+    /// @brief 添加任务
+    /// @param name 名称
+    /// @param cb 回调函数
+    /// @param interval 时间间隔
+    /// @param times 执行次数（设 -1 为永久执行）
     Task* AddTask(const String& name, const Task::Callback& cb, Duration interval, int times = -1);
 
     /// \~chinese
-    /// @brief 
+    /// @brief 启动任务
     void StartTasks(const String& task_name);
 
     /// \~chinese
-    /// @brief ֹͣ
+    /// @brief 停止任务
     void StopTasks(const String& task_name);
 
     /// \~chinese
-    /// @brief Ƴ
+    /// @brief 移除任务
     void RemoveTasks(const String& task_name);
 
     /// \~chinese
-    /// @brief 
+    /// @brief 启动所有任务
     void StartAllTasks();
 
     /// \~chinese
-    /// @brief ֹͣ
+    /// @brief 停止所有任务
     void StopAllTasks();
 
     /// \~chinese
-    /// @brief Ƴ
+    /// @brief 移除所有任务
     void RemoveAllTasks();
 
     /// \~chinese
-    /// @brief ȡ
+    /// @brief 获取所有任务
     const TaskList& GetAllTasks() const;
 
     /// \~chinese
-    /// @brief µ
+    /// @brief 更新调度器
     void Update(Duration dt);
 
 private:
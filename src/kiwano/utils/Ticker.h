@@ -27,80 +27,80 @@ namespace kiwano
 KGE_DECLARE_SMART_PTR(Ticker);
 
 /// \~chinese
-/// @brief ʱ
+/// @brief 报时器
 class KGE_API Ticker
     : public ObjectBase
 {
 public:
     /// \~chinese
-    /// @brief ʱ
-    /// @param interval ʱ
-    /// @param tick_count ʱ -1 Ϊã
+    /// @brief 创建报时器
+    /// @param interval 报时间隔
+    /// @param tick_count 报时次数（设 -1 为永久）
     Ticker(Duration interval, int tick_count = -1);
 
     Ticker();
 
     /// \~chinese
-    /// @brief ʱ
-    /// @return Ƿﵽʱʱ
+    /// @brief 计时
+    /// @return 是否达到报时时长
     virtual bool Tick();
 
     /// \~chinese
-    /// @brief ʱ
-    /// @param dt ʱ
-    /// @return Ƿﵽʱʱ
+    /// @brief 计时
+    /// @param dt 时间增量
+    /// @return 是否达到报时时长
     virtual bool Tick(Duration dt);
 
     /// \~chinese
-    /// @brief ȡʱ
+    /// @brief 获取时间增量
     Duration GetDeltaTime();
 
     /// \~chinese
-    /// @brief ȡͣ״̬
+    /// @brief 获取暂停状态
     bool IsPausing() const;
 
     /// \~chinese
-    /// @brief ͣʱ
+    /// @brief 暂停报时器
     void Pause();
 
     /// \~chinese
-    /// @brief ʱ
+    /// @brief 继续报时器
     void Resume();
 
     /// \~chinese
-    /// @brief ȡʱʱ
+    /// @brief 获取报时器报时次数
     int GetTickedCount() const;
 
     /// \~chinese
-    /// @brief ȡʱܱʱ
+    /// @brief 获取报时器总报时次数
     int GetTotalTickCount() const;
 
     /// \~chinese
-    /// @brief ñʱܱʱ
+    /// @brief 设置报时器总报时次数
     void SetTotalTickCount(int count);
 
     /// \~chinese
-    /// @brief ȡʱ
+    /// @brief 获取报时间隔
     Duration GetInterval() const;
 
     /// \~chinese
-    /// @brief ñʱ
+    /// @brief 设置报时间隔
     void SetInterval(Duration interval);
 
     /// \~chinese
-    /// @brief ȡʱ
+    /// @brief 获取时间误差
     Duration GetErrorTime() const;
 
     /// \~chinese
-    /// @brief ȡʱ
+    /// @brief 获取计时器
     TimerPtr GetTimer();
 
     /// \~chinese
-    /// @brief üʱ
+    /// @brief 设置计时器
     void SetTimer(TimerPtr timer);
 
     /// \~chinese
-    /// @brief ñʱ
+    /// @brief 重置报时器
     void Reset();
 
 private:
@@ -28,7 +28,7 @@ namespace kiwano
 KGE_DECLARE_SMART_PTR(Timer);
 
 /// \~chinese
-/// @brief ʱ
+/// @brief 计时器
 class KGE_API Timer
     : public ObjectBase
 {
@@ -38,31 +38,31 @@ public:
     virtual ~Timer();
 
     /// \~chinese
-    /// @brief ȡʱ
+    /// @brief 获取时间增量
     Duration GetDeltaTime() const;
 
     /// \~chinese
-    /// @brief ȡʱ
+    /// @brief 获取总时长
     Duration GetTotalTime() const;
 
     /// \~chinese
-    /// @brief ȡͣ״̬
+    /// @brief 获取暂停状态
     bool IsPausing() const;
 
     /// \~chinese
-    /// @brief ʱ
+    /// @brief 计时
     void Tick();
 
     /// \~chinese
-    /// @brief ʱ
+    /// @brief 继续计时
     void Resume();
 
     /// \~chinese
-    /// @brief ͣʱ
+    /// @brief 暂停计时
     void Pause();
 
     /// \~chinese
-    /// @brief üʱ
+    /// @brief 重置计时器
     void Reset();
 
 private:
@@ -24,61 +24,61 @@
 namespace kiwano
 {
 /// \~chinese
-/// @brief û
+/// @brief 用户数据
 /// @details
-/// UserDataһ׵ʱݿ⣬ţַ-ֵļֵԣ޳־û
+/// UserData是一个简易的运行时数据库，存放（字符串-值）的键值对，无持久化
 class KGE_API UserData final : public Singleton<UserData>
 {
     friend Singleton<UserData>;
 
 public:
     /// \~chinese
-    /// @brief ֵ
+    /// @brief 数据字典
     using DataMap = UnorderedMap<String, Any>;
 
     /// \~chinese
-    /// @brief ֵ
+    /// @brief 键值对
     using DataPair = Pair<const String, Any>;
 
     /// \~chinese
-    /// @brief ȡ
-    /// @param key 
-    /// @param default_data ݲʱصĬֵ
-    /// @return Ӧֵ
+    /// @brief 取数据
+    /// @param key 键
+    /// @param default_data 数据不存在时返回的默认值
+    /// @return 键对应的值数据
     Any Get(const String& key, const Any& default_data = Any()) const;
 
     /// \~chinese
-    /// @brief 
-    /// @param key 
-    /// @param data ֵ
+    /// @brief 存数据
+    /// @param key 键
+    /// @param data 值
     void Set(const String& key, const Any& data);
 
     /// \~chinese
-    /// @brief 
-    /// @param pair ֵ
+    /// @brief 存数据
+    /// @param pair 键值对
     void Set(const DataPair& pair);
 
     /// \~chinese
-    /// @brief 
-    /// @param list ֵб
+    /// @brief 存数据
+    /// @param list 键值对列表
     void Set(const std::initializer_list<DataPair>& list);
 
     /// \~chinese
-    /// @brief 
-    /// @param map ֵ
+    /// @brief 存数据
+    /// @param map 数据字典
     void Set(const DataMap& map);
 
     /// \~chinese
-    /// @brief жǷӦ
-    /// @param key 
+    /// @brief 判断是否包含键对应的数据
+    /// @param key 键
     bool Contains(const String& key) const;
 
     /// \~chinese
-    /// @brief ȡֵ
+    /// @brief 获取数据字典
     const DataMap& GetDataMap() const;
 
     /// \~chinese
-    /// @brief 
+    /// @brief 清空所有数据
     void Clear();
 
 private:
@@ -26,11 +26,11 @@ namespace kiwano
 {
 
 /// \~chinese
-/// @brief XMLĵ
+/// @brief XML文档
 using XmlDocument = pugi::xml_document;
 
 /// \~chinese
-/// @brief XMLĵ
+/// @brief XML文档
 using XmlNode = pugi::xml_node;
 
 }  // namespace kiwano